@@ -0,0 +1,170 @@
+#! /usr/bin/env python3
+"""
+Replays the .ulg files in the supplied directory through EKF2 (replay_mode=ekf2, as fast as possible) with several
+px4 instances in parallel and writes a summary of the estimator test ratios of the replayed logs to a csv file.
+
+The px4 binary needs to be built with replay support first:
+    make px4_sitl_default replay=<any_log.ulg>
+"""
+# -*- coding: utf-8 -*-
+
+import argparse
+import csv
+import glob
+import os
+import queue
+import shutil
+import subprocess
+import tempfile
+import time
+from concurrent.futures import ThreadPoolExecutor, as_completed
+from typing import Dict
+
+import numpy as np
+from pyulog import ULog
+
+TEST_RATIOS = ['hdg_test_ratio', 'vel_test_ratio', 'pos_test_ratio', 'hgt_test_ratio', 'tas_test_ratio',
+               'hagl_test_ratio', 'beta_test_ratio']
+
+
+def get_arguments():
+    file_dir = os.path.dirname(os.path.realpath(__file__))
+    build_dir = os.path.realpath(os.path.join(file_dir, '..', '..', 'build', 'px4_sitl_default_replay'))
+
+    parser = argparse.ArgumentParser(description='Replay the .ulg files in the specified directory through EKF2 in '
+                                                 'parallel and summarize the estimator test ratios')
+    parser.add_argument("directory_path")
+    parser.add_argument('-b', '--build-dir', type=str, default=build_dir,
+                        help='The px4 replay build directory (containing bin/px4 and etc).')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count(),
+                        help='Number of logs replayed in parallel.')
+    parser.add_argument('-o', '--output', type=str, default='replay_summary.csv',
+                        help='The csv file the summary is written to.')
+    parser.add_argument('-t', '--timeout', type=float, default=600,
+                        help='Timeout in seconds for replaying a single log.')
+    parser.add_argument('--keep-replayed', action='store_true',
+                        help='Whether to keep the replayed logs (copied next to the input log).')
+    return parser.parse_args()
+
+
+def test_ratio_metrics(ulog_file: str) -> Dict[str, float]:
+    """
+    max and mean of the test ratios of the first estimator instance
+    """
+    metrics = {}
+
+    ulog = ULog(ulog_file, ['estimator_status'])
+    estimator_status = [d for d in ulog.data_list if d.name == 'estimator_status' and d.multi_id == 0]
+
+    if not estimator_status:
+        return metrics
+
+    data = estimator_status[0].data
+
+    for test_ratio in TEST_RATIOS:
+        if test_ratio in data:
+            values = data[test_ratio][np.isfinite(data[test_ratio])]
+
+            if len(values) > 0:
+                metrics['{:s}_max'.format(test_ratio)] = float(np.amax(values))
+                metrics['{:s}_mean'.format(test_ratio)] = float(np.mean(values))
+
+    return metrics
+
+
+def replay_log(ulog_file: str, args, instances: 'queue.Queue[int]') -> Dict[str, object]:
+    """
+    replays a single log with a free px4 instance (each instance has its own lock file and working directory)
+    """
+    result = {'log': ulog_file, 'status': 'failed', 'replay_time_s': float('nan')}
+    instance = instances.get()
+    working_dir = tempfile.mkdtemp(prefix='replay_{:d}_'.format(instance))
+
+    try:
+        env = os.environ.copy()
+        env['replay'] = os.path.realpath(ulog_file)
+        env['replay_mode'] = 'ekf2'
+
+        cmd = [os.path.join(args.build_dir, 'bin', 'px4'), '-i', str(instance), '-d', '-w', working_dir,
+               os.path.join(args.build_dir, 'etc')]
+
+        start = time.monotonic()
+
+        with open(os.path.join(working_dir, 'out.log'), 'w') as output:
+            subprocess.run(cmd, env=env, stdout=output, stderr=subprocess.STDOUT, stdin=subprocess.DEVNULL,
+                           timeout=args.timeout, check=False)
+
+        result['replay_time_s'] = time.monotonic() - start
+
+        replayed = glob.glob(os.path.join(working_dir, 'log', '**', '*_replayed.ulg'), recursive=True)
+
+        if not replayed:
+            result['status'] = 'no output'
+            return result
+
+        result.update(test_ratio_metrics(replayed[0]))
+        result['status'] = 'ok'
+
+        if args.keep_replayed:
+            shutil.copy(replayed[0], os.path.splitext(ulog_file)[0] + '_replayed.ulg')
+
+    except subprocess.TimeoutExpired:
+        result['status'] = 'timeout'
+
+    except Exception as e:
+        print(str(e))
+
+    finally:
+        shutil.rmtree(working_dir, ignore_errors=True)
+        instances.put(instance)
+
+    return result
+
+
+def main() -> None:
+
+    args = get_arguments()
+
+    ulog_directory = args.directory_path
+
+    # get all the ulog files found in the specified directory and in subdirectories, skip earlier replay outputs
+    ulog_files = glob.glob(os.path.join(ulog_directory, '**/*.ulg'), recursive=True)
+    ulog_files = [ulog_file for ulog_file in ulog_files if not ulog_file.endswith('_replayed.ulg')]
+
+    n_files = len(ulog_files)
+    print("replaying {:d} .ulg files found in {:s} with {:d} jobs".format(n_files, ulog_directory, args.jobs))
+
+    instances = queue.Queue()
+
+    for instance in range(args.jobs):
+        instances.put(instance)
+
+    results = []
+
+    with ThreadPoolExecutor(max_workers=args.jobs) as executor:
+        futures = [executor.submit(replay_log, ulog_file, args, instances) for ulog_file in ulog_files]
+
+        for i, future in enumerate(as_completed(futures)):
+            result = future.result()
+            results.append(result)
+            print('{:d}/{:d} {:s}: {:s} ({:.1f} s)'.format(i + 1, n_files, result['log'], result['status'],
+                                                         result['replay_time_s']))
+
+    results.sort(key=lambda result: result['log'])
+
+    fieldnames = ['log', 'status', 'replay_time_s']
+
+    for test_ratio in TEST_RATIOS:
+        fieldnames += ['{:s}_max'.format(test_ratio), '{:s}_mean'.format(test_ratio)]
+
+    with open(args.output, 'w', newline='') as file:
+        writer = csv.DictWriter(file, fieldnames=fieldnames, restval=float('nan'))
+        writer.writeheader()
+        writer.writerows(results)
+
+    n_ok = sum(1 for result in results if result['status'] == 'ok')
+    print('{:d}/{:d} files replayed, summary written to {:s}'.format(n_ok, n_files, args.output))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,268 @@
+#! /usr/bin/env python3
+
+"""
+Generates the list of functions that should be mapped to ITCM from a runtime profile.
+
+The hand-maintained ITCM lists (e.g. boards/px4/fmu-v5x/nuttx-config/scripts/itcm_gen_functions.ld)
+go stale as code changes. This tool picks the functions that take the most samples per byte of
+code until the ITCM budget is used up, and writes them as a linker script include file in the
+format expected by the board linker scripts and Tools/itcm_check.py:
+```
+*(.text._ZN3Ekf20controlGravityFusionERKN9estimator9imuSampleE)
+*(.text._ZN7sensors22VehicleAngularVelocity21FilterAngularVelocityEiPfi)
+[...]
+```
+
+The profile is a text file of program counter samples, e.g. from DWT PC sampling over SWO or from
+the stacks log of platforms/nuttx/Debug/poor-mans-profiler.sh. Each line contributes the first
+hexadecimal address it contains, optionally followed by a sample count:
+```
+0x0800f3a4
+0x0801a2c0 17
+#0  0x08034b10 in Ekf::predictCovariance (...)
+```
+Only the innermost frame (#0) of a backtrace is used, other frames are ignored.
+
+Functions of the static list files (--static-files) are always mapped to ITCM and count against the
+budget, so they are not repeated in the generated list.
+
+Typical use with the performance test build:
+```
+make px4_fmu-v5x_default
+<collect PC samples while flying or running the test setup>
+python3 Tools/itcm_gen.py --elf-file build/px4_fmu-v5x_default/px4_fmu-v5x_default.elf \\
+    --profile pc_samples.txt --itcm-size 16384 \\
+    --static-files boards/px4/fmu-v5x/nuttx-config/scripts/itcm_static_functions.ld \\
+    --output boards/px4/fmu-v5x/nuttx-config/scripts/itcm_gen_functions.ld
+```
+"""
+
+import argparse
+import bisect
+import re
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+from pathlib import Path
+from typing import Dict, List, Tuple
+
+
+class FunctionTable:
+    """
+    Function symbols of the ELF file, sorted by address, to map program counters to functions.
+    """
+
+    def __init__(self, elf_path: Path):
+        functions = {}
+
+        with open(elf_path, 'rb') as f:
+            elf = ELFFile(f)
+            for section in elf.iter_sections():
+                if isinstance(section, SymbolTableSection):
+                    for sym in section.iter_symbols():
+                        if sym['st_info']['type'] == 'STT_FUNC' and sym['st_size'] > 0 and sym.name:
+                            # clear the thumb bit
+                            address = sym['st_value'] & ~1
+                            functions[address] = (sym.name, sym['st_size'])
+
+        self.addresses = sorted(functions.keys())
+        self.functions = [functions[address] for address in self.addresses]
+        self.sizes = {name: size for name, size in self.functions}
+
+    def lookup(self, pc: int) -> str:
+        """
+        :param pc: program counter
+
+        :return: The name of the function containing `pc`, or None.
+        """
+        index = bisect.bisect_right(self.addresses, pc) - 1
+
+        if index >= 0:
+            name, size = self.functions[index]
+
+            if pc < self.addresses[index] + size:
+                return name
+
+        return None
+
+
+def read_profile(profile_path: Path, functions: FunctionTable) -> Tuple[Dict[str, int], int]:
+    """
+    Reads the program counter samples and attributes them to functions.
+
+    :param profile_path: Path of the profile.
+    :param functions: Function table of the profiled ELF file.
+
+    :return: The samples per function name and the total number of samples.
+    """
+    address_pattern = re.compile(r"0x([0-9a-fA-F]+)(?:\s+(\d+))?")
+    samples = {}
+    total = 0
+
+    with open(profile_path, 'r') as f:
+        for line in f:
+            line = line.strip()
+
+            # only the innermost frame of a backtrace
+            if line.startswith('#') and not line.startswith('#0 '):
+                continue
+
+            match = address_pattern.search(line)
+
+            if not match:
+                continue
+
+            count = int(match.group(2)) if match.group(2) else 1
+            total += count
+            name = functions.lookup(int(match.group(1), 16))
+
+            if name:
+                samples[name] = samples.get(name, 0) + count
+
+    return samples, total
+
+
+def get_static_functions(script_paths: List[Path]) -> List[str]:
+    """
+    Gets the functions that are statically mapped to ITCM by the given linker script include files.
+
+    :param script_paths: Paths of the static linker script include files.
+
+    :return: The names of the functions.
+    """
+    section_pattern = re.compile(r"^\*\(\.text\.([a-zA-Z0-9_\.]+)\)")
+    ret = []
+
+    for script_path in script_paths:
+        with open(script_path, 'r') as f:
+            for line in f:
+                match = section_pattern.match(line.strip())
+
+                if match:
+                    ret.append(match.group(1))
+
+    return ret
+
+
+def select_functions(samples: Dict[str, int], sizes: Dict[str, int], budget: int,
+                     min_samples: int) -> List[str]:
+    """
+    Greedily selects the functions with the most samples per byte that fit into the budget.
+
+    :param samples: Samples per function name.
+    :param sizes: Code size per function name.
+    :param budget: Available ITCM in bytes.
+    :param min_samples: Functions with fewer samples are not considered.
+
+    :return: The names of the selected functions, hottest first.
+    """
+    candidates = [name for name, count in samples.items() if count >= min_samples]
+    candidates.sort(key=lambda name: samples[name] / sizes[name], reverse=True)
+
+    selected = []
+
+    for name in candidates:
+        # input sections are word aligned
+        size = (sizes[name] + 3) & ~3
+
+        if size <= budget:
+            selected.append(name)
+            budget -= size
+
+    return selected
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generates the ITCM function list from a runtime profile.")
+    parser.add_argument(
+        "--elf-file",
+        help="Path of the profiled ELF file",
+        type=Path,
+        required=True
+    )
+    parser.add_argument(
+        "--profile",
+        help="Paths of the program counter sample files",
+        nargs="+",
+        type=Path,
+        required=True
+    )
+    parser.add_argument(
+        "--itcm-size",
+        help="Size of the ITCM RAM in bytes",
+        type=int,
+        required=True
+    )
+    parser.add_argument(
+        "--reserve",
+        help="Bytes of ITCM to keep free, e.g. for functions added before the next profile",
+        type=int,
+        default=512
+    )
+    parser.add_argument(
+        "--static-files",
+        help="Paths of the linker script files with functions that are always mapped to ITCM",
+        nargs="*",
+        type=Path,
+        default=[]
+    )
+    parser.add_argument(
+        "--min-samples",
+        help="Minimum number of samples of a function to be considered",
+        type=int,
+        default=2
+    )
+    parser.add_argument(
+        "--output",
+        help="Path of the generated linker script file",
+        type=Path,
+        required=True
+    )
+
+    args = parser.parse_args()
+
+    functions = FunctionTable(args.elf_file)
+
+    samples = {}
+    total = 0
+
+    for profile_path in args.profile:
+        profile_samples, profile_total = read_profile(profile_path, functions)
+        total += profile_total
+
+        for name, count in profile_samples.items():
+            samples[name] = samples.get(name, 0) + count
+
+    if total == 0:
+        print("No samples found in the profile.")
+        exit(1)
+
+    static_functions = get_static_functions(args.static_files)
+    budget = args.itcm_size - args.reserve
+    static_samples = 0
+
+    for name in static_functions:
+        if name in functions.sizes:
+            budget -= (functions.sizes[name] + 3) & ~3
+
+        # static functions are never generated
+        static_samples += samples.pop(name, 0)
+
+    if budget <= 0:
+        print(f"The static functions already use the ITCM ({args.itcm_size} bytes).")
+        exit(1)
+
+    selected = select_functions(samples, functions.sizes, budget, args.min_samples)
+
+    with open(args.output, 'w') as f:
+        for name in selected:
+            f.write(f"*(.text.{name})\n")
+
+    selected_samples = sum(samples[name] for name in selected)
+    selected_size = sum(functions.sizes[name] for name in selected)
+    print(f"Static functions cover {100 * static_samples / total:.1f}% of {total} samples.")
+    print(f"{len(selected)} functions ({selected_size} bytes) selected, covering {100 * selected_samples / total:.1f}% of "
+          f"{total} samples.")
+
+
+if __name__ == '__main__':
+    main()
@@ -7,6 +7,7 @@ from pathlib import Path
 
 try:
     from Crypto.Cipher import ChaCha20
+    from Crypto.Cipher import AES
     from Crypto.PublicKey import RSA
     from Crypto.Cipher import PKCS1_OAEP
     from Crypto.Hash import SHA256
@@ -61,7 +62,7 @@ def decrypt_log_file(ulog_file, private_key, output_folder):
 
         data_offset = header_size + key_size + nonce_size
 
-        # Try to decrypt the ChaCha key
+        # Try to decrypt the symmetric key
         cipher_rsa = PKCS1_OAEP.new(key, SHA256)
         try:
             ulog_key = cipher_rsa.decrypt(cipher)
@@ -69,8 +70,13 @@ def decrypt_log_file(ulog_file, private_key, output_folder):
             print(f"Skipping {ulog_file}: Incorrect decryption (wrong key)")
             return
 
-        # Read and decrypt the log data
-        cipher = ChaCha20.new(key=ulog_key, nonce=nonce)
+        # Read and decrypt the log data. The algorithm is identified by the nonce size:
+        # XChaCha20 uses a 24 byte nonce, AES-256-CTR a 16 byte IV (96 bit nonce, 32 bit counter)
+        if nonce_size == 16:
+            cipher = AES.new(ulog_key, AES.MODE_CTR, nonce=nonce[:12],
+                             initial_value=int.from_bytes(nonce[12:], 'big'))
+        else:
+            cipher = ChaCha20.new(key=ulog_key, nonce=nonce)
 
         # Save decrypted log with .ulg extension
         output_path = os.path.join(output_folder, Path(ulog_file).stem + ".ulg")
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+
+"""
+Decode the TELEMETRY_BUNDLE stream (delta-encoded uORB samples packed into TUNNEL messages).
+
+The message layouts are read from a ULog file written by the same firmware version,
+the MAVLink data either from a telemetry log or a live connection.
+
+Example:
+    ./mavlink_telemetry_bundle.py log.ulg udpin:0.0.0.0:14550
+"""
+
+from argparse import ArgumentParser
+import struct
+import sys
+
+try:
+    from pymavlink import mavutil
+except ImportError as e:
+    print("Failed to import pymavlink: " + str(e))
+    print("")
+    print("You may need to install it with:")
+    print("    pip3 install --user pymavlink")
+    print("")
+    sys.exit(1)
+
+try:
+    from pyulog import ULog
+except ImportError as e:
+    print("Failed to import pyulog: " + str(e))
+    print("")
+    print("You may need to install it with:")
+    print("    pip3 install --user pyulog")
+    print("")
+    sys.exit(1)
+
+
+PAYLOAD_TYPE = 32900
+
+# order of the bits in MAV_BUNDLE_TOPICS (see src/modules/mavlink/streams/TELEMETRY_BUNDLE.hpp)
+TOPICS = [
+    'vehicle_global_position',
+    'vehicle_attitude',
+    'vehicle_status',
+    'vehicle_air_data',
+    'airspeed_validated',
+    'wind',
+    'home_position',
+    'failsafe_flags',
+    'mission_result',
+    'vehicle_land_detected',
+    'geofence_result',
+    'cpuload',
+]
+
+MAX_FIELDS = 96  # uORB::MessageFieldLayout::MAX_FIELDS
+FLAG_KEYFRAME = 1
+
+TYPES = {
+    'int8_t': 'b', 'uint8_t': 'B', 'bool': '?', 'char': 'c',
+    'int16_t': 'h', 'uint16_t': 'H',
+    'int32_t': 'i', 'uint32_t': 'I', 'float': 'f',
+    'int64_t': 'q', 'uint64_t': 'Q', 'double': 'd',
+}
+
+
+class Layout:
+    """ Field boundaries of a message, like uORB::MessageFieldLayout """
+
+    def __init__(self, formats, name):
+        self.formats = formats
+        self.fields = []  # (name, type, array size, offset, size)
+        offset = 0
+
+        for field_type, array_size, field_name in formats[name].fields:
+            size = self.field_size(field_type) * max(array_size, 1)
+
+            if not field_name.startswith('_padding'):
+                self.fields.append((field_name, field_type, array_size, offset, size))
+
+            offset += size
+
+    def field_size(self, field_type):
+        if field_type in TYPES:
+            return struct.calcsize(TYPES[field_type])
+
+        # nested type, embedded with its padding at the end (8 byte aligned)
+        size = sum(self.field_size(t) * max(a, 1) for t, a, _ in self.formats[field_type].fields)
+        return (size + 7) & ~7
+
+    def boundaries(self, message_size):
+        """ field (offset, size) list as used by the encoder for a message of message_size bytes """
+        ret = []
+
+        for _, _, _, offset, size in self.fields:
+            if offset >= message_size:
+                break
+
+            size = min(size, message_size - offset)
+
+            if len(ret) == MAX_FIELDS:
+                ret[-1] = (ret[-1][0], offset + size - ret[-1][0])
+
+            else:
+                ret.append((offset, size))
+
+        return ret
+
+    def values(self, data):
+        ret = {}
+
+        for name, field_type, array_size, offset, size in self.fields:
+            if offset + size > len(data):
+                break
+
+            raw = data[offset:offset + size]
+
+            if field_type in TYPES:
+                value = struct.unpack('<%i%s' % (max(array_size, 1), TYPES[field_type]), raw)
+                ret[name] = value[0] if array_size == 0 else list(value)
+
+            else:
+                ret[name] = raw.hex()
+
+        return ret
+
+
+class Decoder:
+    """ Decoder of a single topic, like uORB::DeltaDecoder """
+
+    def __init__(self, layout):
+        self.layout = layout
+        self.last = None
+        self.sequence = 0
+        self.synchronized = False
+
+    def decode(self, buf):
+        flags, sequence = buf[0], buf[1]
+
+        if flags & FLAG_KEYFRAME:
+            self.last = bytearray(buf[2:])
+
+        else:
+            if not self.synchronized or sequence != (self.sequence + 1) & 0xff:
+                self.synchronized = False
+                return None
+
+            fields = self.layout.boundaries(len(self.last))
+            mask_size = (len(fields) + 7) // 8
+            mask = buf[2:2 + mask_size]
+            pos = 2 + mask_size
+
+            for i, (offset, size) in enumerate(fields):
+                if mask[i // 8] & (1 << (i % 8)):
+                    self.last[offset:offset + size] = buf[pos:pos + size]
+                    pos += size
+
+            if pos != len(buf):
+                self.synchronized = False
+                return None
+
+        self.sequence = sequence
+        self.synchronized = True
+        return self.layout.values(self.last)
+
+
+def main():
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument('ulog', help='ULog file of the same firmware version (for the message formats)')
+    parser.add_argument('connection', help='MAVLink connection or telemetry log, e.g. udpin:0.0.0.0:14550')
+    parser.add_argument('--baudrate', type=int, default=57600, help='Serial baudrate')
+    args = parser.parse_args()
+
+    formats = ULog(args.ulog, message_name_filter_list=[]).message_formats
+    decoders = {}
+
+    for index, name in enumerate(TOPICS):
+        if name in formats:
+            decoders[index] = Decoder(Layout(formats, name))
+
+    mav = mavutil.mavlink_connection(args.connection, baud=args.baudrate)
+    frame_sequence = None
+
+    while True:
+        msg = mav.recv_match(type='TUNNEL', blocking=True)
+
+        if msg is None:
+            break
+
+        if msg.payload_type != PAYLOAD_TYPE:
+            continue
+
+        payload = bytes(msg.payload[:msg.payload_length])
+
+        if frame_sequence is not None and payload[0] != (frame_sequence + 1) & 0xff:
+            print('lost %i frame(s)' % ((payload[0] - frame_sequence - 1) & 0xff))
+
+        frame_sequence = payload[0]
+        pos = 1
+
+        while pos + 2 <= len(payload):
+            index, length = payload[pos], payload[pos + 1]
+            sample = payload[pos + 2:pos + 2 + length]
+            pos += 2 + length
+
+            if index not in decoders:
+                continue
+
+            values = decoders[index].decode(sample)
+
+            if values is not None:
+                print('%s: %s' % (TOPICS[index], values))
+
+
+if __name__ == '__main__':
+    main()
@@ -31,8 +31,12 @@ class LoggingCompleted(Exception):
 class MavlinkLogStreaming():
     '''Streams log data via MAVLink.
        Assumptions:
-       - the sender only sends one acked message at a time
+       - the sender has at most a small window of acked messages in flight and
+         retransmits them individually, so they can arrive out of order
        - the data is in the ULog format '''
+
+    REORDER_TIMEOUT = 0.5 # [s] time after which a missing acked message is considered lost
+    REORDER_MAX_PENDING = 32 # maximum number of buffered out-of-order messages
     def __init__(self, portname, baudrate, output_filename, debug=0):
         self.baudrate = 0
         self._debug = debug
@@ -49,6 +53,8 @@ class MavlinkLogStreaming():
         self.file = open(output_filename,'wb')
         self.start_time = timer()
         self.last_sequence = -1
+        self.pending = {} # out-of-order acked messages: sequence -> (data, first message start)
+        self.pending_since = 0
         self.logging_started = False
         self.num_dropouts = 0
         self.target_component = 1
@@ -98,8 +104,7 @@ class MavlinkLogStreaming():
                         mavutil.mavlink.MAV_AUTOPILOT_GENERIC, 0, 0, 0)
                 next_heartbeat_time = heartbeat_time + 1
 
-            m, first_msg_start, num_drops = self.read_message()
-            if m is not None:
+            for m, first_msg_start, num_drops in self.read_message():
                 self.process_streamed_ulog_data(m, first_msg_start, num_drops)
 
                 # status output
@@ -114,13 +119,17 @@ class MavlinkLogStreaming():
                         measure_time_start = measure_time_cur
                         measured_data = 0
 
+            if len(self.pending) > 0 and timer() - self.pending_since > self.REORDER_TIMEOUT:
+                for m, first_msg_start, num_drops in self.flush_pending():
+                    self.process_streamed_ulog_data(m, first_msg_start, num_drops)
+
             if not self.logging_started and timer()-self.start_time > 4:
                 raise Exception('Start timed out. Is the logger running in MAVLink mode?')
 
 
     def read_message(self):
-        ''' read a single mavlink message, handle ACK & return a tuple of (data, first
-        message start, num dropouts) '''
+        ''' read a single mavlink message, handle ACK & return a list of (data, first
+        message start, num dropouts) tuples in sequence order '''
         m = self.mav.recv_match(type=['LOGGING_DATA_ACKED',
                             'LOGGING_DATA', 'COMMAND_ACK'], blocking=True,
                             timeout=0.05)
@@ -138,7 +147,7 @@ class MavlinkLogStreaming():
                 elif m.command == mavutil.mavlink.MAV_CMD_LOGGING_STOP and \
                         m.result == mavutil.mavlink.MAV_RESULT_ACCEPTED:
                     raise LoggingCompleted()
-                return None, 0, 0
+                return []
 
             # m is either 'LOGGING_DATA_ACKED' or 'LOGGING_DATA':
             is_newer, num_drops = self.check_sequence(m.sequence)
@@ -149,23 +158,73 @@ class MavlinkLogStreaming():
                 self.mav.mav.logging_ack_send(self.mav.target_system,
                         self.target_component, m.sequence)
 
-            if is_newer:
+                if not is_newer or m.sequence in self.pending:
+                    self.debug('dup message '+str(m.sequence))
+                    return []
+
                 if num_drops > 0:
-                    self.num_dropouts += num_drops
+                    # a previous message is still being retransmitted: buffer this one
+                    self.debug('reordered message '+str(m.sequence))
+                    if len(self.pending) == 0:
+                        self.pending_since = timer()
+                    self.pending[m.sequence] = (m.data[:m.length], m.first_message_offset)
+                    if len(self.pending) > self.REORDER_MAX_PENDING:
+                        return self.flush_pending()
+                    return []
 
-                if m.get_type() == 'LOGGING_DATA':
-                    if not self.got_header_section:
-                        print('Header received in {:0.2f}s (size: {:.1f} KB)'.format(
-                              timer()-self.start_time, self.file.tell()/1024))
-                        self.logging_started = True
-                        self.got_header_section = True
                 self.last_sequence = m.sequence
-                return m.data[:m.length], m.first_message_offset, num_drops
+                return [(m.data[:m.length], m.first_message_offset, 0)] + self.pop_pending()
 
-            else:
+            if not is_newer:
                 self.debug('dup/reordered message '+str(m.sequence))
-
-        return None, 0, 0
+                return []
+
+            # unacked data: acked messages are never sent after these, so
+            # anything still missing is lost
+            ret = self.flush_pending()
+            if len(ret) > 0:
+                is_newer, num_drops = self.check_sequence(m.sequence)
+
+            if num_drops > 0:
+                self.num_dropouts += num_drops
+
+            if not self.got_header_section:
+                print('Header received in {:0.2f}s (size: {:.1f} KB)'.format(
+                      timer()-self.start_time, self.file.tell()/1024))
+                self.logging_started = True
+                self.got_header_section = True
+            self.last_sequence = m.sequence
+            return ret + [(m.data[:m.length], m.first_message_offset, num_drops)]
+
+        return []
+
+
+    def pop_pending(self):
+        ''' return the buffered messages that directly follow the last sequence '''
+        ret = []
+        while len(self.pending) > 0:
+            seq = (self.last_sequence + 1) & 0xffff
+            if seq not in self.pending:
+                break
+            data, first_msg_start = self.pending.pop(seq)
+            self.last_sequence = seq
+            ret.append((data, first_msg_start, 0))
+        if len(self.pending) > 0:
+            self.pending_since = timer()
+        return ret
+
+
+    def flush_pending(self):
+        ''' give up on the missing messages and return all the buffered ones '''
+        ret = []
+        while len(self.pending) > 0:
+            seq = min(self.pending, key=lambda s: (s - self.last_sequence) & 0xffff)
+            data, first_msg_start = self.pending.pop(seq)
+            num_drops = self.check_sequence(seq)[1]
+            self.num_dropouts += num_drops
+            self.last_sequence = seq
+            ret.append((data, first_msg_start, num_drops))
+        return ret
 
 
     def check_sequence(self, seq):
@@ -96,6 +96,47 @@ def add_fields(msg_fields, name_prefix='', offset=0):
 
 fields, struct_size = add_fields(spec.parsed_fields())
 
+# get the offsets of the fields in the uORB struct (sorted by size, see uorb/msg.h.em)
+def add_struct_offsets(msg_fields, name_prefix='', offset=0):
+	offsets = {}
+	sorted_fields = sorted(msg_fields, key=sizeof_field_type, reverse=True)
+	add_padding_bytes(sorted_fields, search_path)
+	for field in sorted_fields:
+		if field.is_header:
+			continue
+		array_size = field.array_len if field.is_array else 1
+		if field.is_builtin:
+			offsets[name_prefix+field.name] = offset
+		else:
+			children_fields = get_children_fields(field.base_type, search_path)
+			for i in range(array_size):
+				sub_name_prefix = name_prefix+field.name
+				if array_size > 1:
+					sub_name_prefix += '['+str(i)+']'
+				offsets.update(add_struct_offsets(children_fields, sub_name_prefix+'.', offset + i * field.sizeof_field_type))
+		offset += field.sizeof_field_type * array_size
+	return offsets
+
+struct_offsets = add_struct_offsets(spec.parsed_fields())
+
+# merge fields that are contiguous both in CDR and in the uORB struct into a single copy
+# (timestamps are adjusted by the time offset and always copied on their own)
+def merge_fields(fields):
+	copies = []
+	for field_type, field_name, field_size, padding in fields:
+		adjusted = field_type == 'uint64' and field_name in ('timestamp', 'timestamp_sample')
+		offset = struct_offsets[field_name]
+		if copies and padding == 0 and not adjusted and not copies[-1]['adjusted'] and copies[-1]['end'] == offset:
+			copies[-1]['fields'].append((field_name, field_size))
+			copies[-1]['size'] += field_size
+			copies[-1]['end'] += field_size
+		else:
+			copies.append({'type': field_type, 'fields': [(field_name, field_size)], 'size': field_size,
+				'padding': padding, 'end': offset + field_size, 'adjusted': adjusted})
+	return copies
+
+copies = merge_fields(fields)
+
 }@
 
 // auto-generated file
@@ -103,6 +144,7 @@ fields, struct_size = add_fields(spec.parsed_fields())
 #pragma once
 
 #include <ucdr/microcdr.h>
+#include <stddef.h>
 #include <string.h>
 #include <uORB/topics/@(topic).h>
 
@@ -128,26 +170,34 @@ static inline bool ucdr_serialize_@(topic)(const void* data, ucdrBuffer& buf, in
 {
 	const @(uorb_struct)& topic = *static_cast<const @(uorb_struct)*>(data);
 @{
-for field_type, field_name, field_size, padding in fields:
-	if padding > 0:
-		print('\tbuf.iterator += {:}; // padding'.format(padding))
-		print('\tbuf.offset += {:}; // padding'.format(padding))
+for copy in copies:
+	if copy['padding'] > 0:
+		print('\tbuf.iterator += {:}; // padding'.format(copy['padding']))
+		print('\tbuf.offset += {:}; // padding'.format(copy['padding']))
+
+	for field_name, field_size in copy['fields']:
+		print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
 
-	print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
+	field_name = copy['fields'][0][0]
 
-	if field_type == 'uint64' and field_name == 'timestamp':
+	if len(copy['fields']) > 1:
+		last_name = copy['fields'][-1][0]
+		print('\tstatic_assert(offsetof({0}, {2}) + sizeof(topic.{2}) - offsetof({0}, {1}) == {3}, "layout mismatch");'.format(uorb_struct, field_name, last_name, copy['size']))
+		print('\tmemcpy(buf.iterator, &topic.{0}, {1}); // {0} .. {2}'.format(field_name, copy['size'], last_name))
+
+	elif copy['type'] == 'uint64' and field_name == 'timestamp':
 		print('\tconst uint64_t timestamp_adjusted = topic.timestamp + time_offset;')
 		print('\tmemcpy(buf.iterator, &timestamp_adjusted, sizeof(topic.{0}));'.format(field_name))
 
-	elif field_type == 'uint64' and field_name == 'timestamp_sample':
+	elif copy['type'] == 'uint64' and field_name == 'timestamp_sample':
 		print('\tconst uint64_t timestamp_sample_adjusted = topic.timestamp_sample + time_offset;')
 		print('\tmemcpy(buf.iterator, &timestamp_sample_adjusted, sizeof(topic.{0}));'.format(field_name))
 
 	else:
 		print('\tmemcpy(buf.iterator, &topic.{0}, sizeof(topic.{0}));'.format(field_name))
 
-	print('\tbuf.iterator += sizeof(topic.{:});'.format(field_name))
-	print('\tbuf.offset += sizeof(topic.{:});'.format(field_name))
+	print('\tbuf.iterator += {:};'.format(copy['size']))
+	print('\tbuf.offset += {:};'.format(copy['size']))
 
 }@
 	return true;
@@ -156,20 +206,30 @@ for field_type, field_name, field_size, padding in fields:
 static inline bool ucdr_deserialize_@(topic)(ucdrBuffer& buf, @(uorb_struct)& topic, int64_t time_offset = 0)
 {
 @{
-for field_type, field_name, field_size, padding in fields:
-	if padding > 0:
-		print('\tbuf.iterator += {:}; // padding'.format(padding))
-		print('\tbuf.offset += {:}; // padding'.format(padding))
+for copy in copies:
+	if copy['padding'] > 0:
+		print('\tbuf.iterator += {:}; // padding'.format(copy['padding']))
+		print('\tbuf.offset += {:}; // padding'.format(copy['padding']))
+
+	for field_name, field_size in copy['fields']:
+		print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
 
-	print('\tstatic_assert(sizeof(topic.{0}) == {1}, "size mismatch");'.format(field_name, field_size))
-	print('\tmemcpy(&topic.{0}, buf.iterator, sizeof(topic.{0}));'.format(field_name))
+	field_name = copy['fields'][0][0]
+
+	if len(copy['fields']) > 1:
+		last_name = copy['fields'][-1][0]
+		print('\tstatic_assert(offsetof({0}, {2}) + sizeof(topic.{2}) - offsetof({0}, {1}) == {3}, "layout mismatch");'.format(uorb_struct, field_name, last_name, copy['size']))
+		print('\tmemcpy(&topic.{0}, buf.iterator, {1}); // {0} .. {2}'.format(field_name, copy['size'], last_name))
+
+	else:
+		print('\tmemcpy(&topic.{0}, buf.iterator, sizeof(topic.{0}));'.format(field_name))
 
-	if field_type == 'uint64' and (field_name == 'timestamp' or field_name == 'timestamp_sample'):
-		print('\tif (topic.{0} == 0) topic.{0} = hrt_absolute_time();'.format(field_name, field_name))
-		print('\telse topic.{0} = math::min(topic.{0} - time_offset, hrt_absolute_time());'.format(field_name, field_name))
+	if copy['adjusted']:
+		print('\tif (topic.{0} == 0) topic.{0} = hrt_absolute_time();'.format(field_name))
+		print('\telse topic.{0} = math::min(topic.{0} - time_offset, hrt_absolute_time());'.format(field_name))
 
-	print('\tbuf.iterator += sizeof(topic.{:});'.format(field_name))
-	print('\tbuf.offset += sizeof(topic.{:});'.format(field_name))
+	print('\tbuf.iterator += {:};'.format(copy['size']))
+	print('\tbuf.offset += {:};'.format(copy['size']))
 
 }@
 	return true;
@@ -78,6 +78,8 @@ queue_length = 1
 for constant in spec.constants:
 	if constant.name == 'ORB_QUEUE_LENGTH':
 		queue_length = constant.val
+if queue_length < 1 or (queue_length & (queue_length - 1)) != 0:
+	raise Exception("{0}: ORB_QUEUE_LENGTH must be a power of 2".format(file_name_in))
 }@
 
 @[for topic in topics]@
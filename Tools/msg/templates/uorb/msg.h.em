@@ -125,6 +125,11 @@ for constant in spec.constants:
         raise Exception("Type {0} not supported, add to to template file!".format(type_name))
 
     print('\tstatic constexpr %s %s = %s;'%(type_px4, constant.name, int(constant.val)))
+
+# message size without the padding at the end (o_size), for constant-size copies
+sorted_fields = sorted(spec.parsed_fields(), key=sizeof_field_type, reverse=True)
+struct_size, padding_end_size = add_padding_bytes(sorted_fields, search_path)
+print('\tstatic constexpr uint16_t ORB_MESSAGE_SIZE = %d;'%(struct_size - padding_end_size))
 }
 #endif
 };
@@ -0,0 +1,69 @@
+#! /usr/bin/env python3
+
+"""
+Convert a trace written with 'perf trace dump' (CSV: timestamp_us,type,thread,name)
+into the Chrome trace event JSON format, which can be opened in chrome://tracing
+or https://ui.perfetto.dev.
+
+Get the file from the vehicle e.g. via MAVLink FTP, or directly from the rootfs in SITL.
+"""
+
+import argparse
+import json
+import sys
+
+
+def convert(lines):
+    events = []
+
+    for line in lines:
+        line = line.strip()
+
+        if not line or line.startswith('#'):
+            continue
+
+        fields = line.split(',', 3)
+
+        if len(fields) != 4:
+            continue
+
+        timestamp, event_type, thread, name = fields
+        thread = int(thread)
+
+        if event_type == 'M':
+            events.append({'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': thread,
+                           'args': {'name': name}})
+            continue
+
+        event = {'name': name, 'ph': event_type, 'ts': int(timestamp), 'pid': 0, 'tid': thread}
+
+        if event_type == 'i':
+            event['s'] = 't'  # thread scoped instant
+
+        events.append(event)
+
+    # the buffers are written one after the other, the viewers expect them in order
+    events.sort(key=lambda e: e.get('ts', 0))
+
+    return {'traceEvents': events}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a PX4 perf trace to Chrome trace JSON')
+    parser.add_argument('input', help='trace CSV written by "perf trace dump"')
+    parser.add_argument('-o', '--output', help='output JSON file (default: stdout)')
+    args = parser.parse_args()
+
+    with open(args.input, 'r') as f:
+        trace = convert(f)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(trace, f)
+
+    else:
+        json.dump(trace, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,147 @@
+#! /usr/bin/env python3
+
+"""
+Decompress a heatshrink compressed ULog file (.ulgz, written by the logger with SDLOG_COMPRESS
+enabled) into a regular ULog file (.ulg).
+
+File format (little endian):
+  header: 'ULgz', uint8 version (1), uint8 window bits, uint8 lookahead bits, uint8 reserved
+  frames: uint16 compressed size, uint16 uncompressed size, compressed data
+
+Every frame is compressed independently, so a truncated file (e.g. after a power loss) can
+still be decompressed up to the last complete frame.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = b'ULgz'
+VERSION = 1
+HEADER_FORMAT = '<4sBBBB'
+FRAME_HEADER_FORMAT = '<HH'
+
+
+class BitReader:
+    def __init__(self, data):
+        self._data = data
+        self._pos = 0
+        self._bit = 0
+
+    def read(self, count):
+        """ read count bits (MSB first), None at the end of the data """
+        value = 0
+
+        for _ in range(count):
+            if self._pos >= len(self._data):
+                return None
+
+            value = (value << 1) | ((self._data[self._pos] >> (7 - self._bit)) & 1)
+            self._bit += 1
+
+            if self._bit == 8:
+                self._bit = 0
+                self._pos += 1
+
+        return value
+
+
+def heatshrink_decode(data, window_bits, lookahead_bits, expected_size):
+    out = bytearray()
+    bits = BitReader(data)
+
+    while len(out) < expected_size:
+        tag = bits.read(1)
+
+        if tag is None:
+            break
+
+        if tag:
+            # literal
+            byte = bits.read(8)
+
+            if byte is None:
+                break
+
+            out.append(byte)
+
+        else:
+            # back reference
+            index = bits.read(window_bits)
+            count = bits.read(lookahead_bits)
+
+            if index is None or count is None:
+                break
+
+            index += 1
+            count += 1
+
+            for _ in range(count):
+                # the window is zero-initialized, so references before the start are zeros
+                out.append(out[-index] if index <= len(out) else 0)
+
+    return bytes(out)
+
+
+def decompress(fin, fout):
+    header = fin.read(struct.calcsize(HEADER_FORMAT))
+
+    if len(header) != struct.calcsize(HEADER_FORMAT):
+        raise ValueError('file too short')
+
+    magic, version, window_bits, lookahead_bits, _ = struct.unpack(HEADER_FORMAT, header)
+
+    if magic != MAGIC:
+        raise ValueError('not a compressed ULog file')
+
+    if version != VERSION:
+        raise ValueError('unsupported version {}'.format(version))
+
+    num_frames = 0
+    frame_header_size = struct.calcsize(FRAME_HEADER_FORMAT)
+
+    while True:
+        frame_header = fin.read(frame_header_size)
+
+        if len(frame_header) < frame_header_size:
+            break
+
+        compressed_size, uncompressed_size = struct.unpack(FRAME_HEADER_FORMAT, frame_header)
+        compressed = fin.read(compressed_size)
+
+        if len(compressed) < compressed_size:
+            print('warning: truncated frame {} ignored'.format(num_frames), file=sys.stderr)
+            break
+
+        decompressed = heatshrink_decode(compressed, window_bits, lookahead_bits, uncompressed_size)
+
+        if len(decompressed) != uncompressed_size:
+            raise ValueError('frame {}: size mismatch ({} != {})'.format(
+                num_frames, len(decompressed), uncompressed_size))
+
+        fout.write(decompressed)
+        num_frames += 1
+
+    return num_frames
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decompress a .ulgz log file into a .ulg file')
+    parser.add_argument('input', help='compressed log file (.ulgz)')
+    parser.add_argument('-o', '--output', help='output file (default: input with .ulg extension)')
+    args = parser.parse_args()
+
+    output = args.output
+
+    if output is None:
+        output = os.path.splitext(args.input)[0] + '.ulg'
+
+    with open(args.input, 'rb') as fin, open(output, 'wb') as fout:
+        num_frames = decompress(fin, fout)
+
+    print('{}: {} frames decompressed'.format(output, num_frames))
+
+
+if __name__ == '__main__':
+    main()
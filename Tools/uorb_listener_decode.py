@@ -0,0 +1,388 @@
+#! /usr/bin/env python3
+
+"""
+Decodes the binary stream of the `listener -b` command.
+
+`listener -b <topic>[,<topic>...]` writes the raw uORB samples of the given topics without any formatting, so that
+high-rate topics can be watched live. The stream consists of frames:
+```
+0xA5 0x5A | type (1) | payload length (2) | payload | CRC-16-CCITT (2, initial 0xffff, over type, length and payload)
+```
+with all values in little-endian. Frame types:
+- 'D' definition: stream index (1), instance (1), message hash (4), message size (2), topic name
+- 'S' sample: stream index (1), message data (message size)
+
+The message layouts are reconstructed from the .msg definitions (the same way as the uORB header generator does),
+and checked against the message hash of the firmware.
+
+Read from a file or stdin, e.g. on SITL:
+```
+./build/px4_sitl_default/bin/px4-listener -b sensor_gyro -n 1000 | python3 Tools/uorb_listener_decode.py -
+```
+or let the script start the listener over the MAVLink shell:
+```
+python3 Tools/uorb_listener_decode.py --mavlink /dev/ttyACM0 --topics sensor_gyro,sensor_accel --csv gyro_accel
+```
+"""
+
+import argparse
+import binascii
+import os
+import re
+import struct
+import sys
+import time
+
+sys.path.append(os.path.join(os.path.dirname(os.path.realpath(__file__)), 'msg'))
+
+try:
+    import genmsg.command_line
+    import genmsg.msg_loader
+except ImportError as e:
+    print("Failed to import genmsg: " + str(e))
+    print("")
+    print("You may need to install it using:")
+    print("    pip3 install --user pyros-genmsg")
+    print("")
+    sys.exit(1)
+
+from px_generate_uorb_topic_helper import add_padding_bytes, bare_name, get_message_hash, sizeof_field_type
+
+PACKAGE = 'px4'
+SYNC = b'\xa5\x5a'
+FRAME_DEFINITION = ord('D')
+FRAME_SAMPLE = ord('S')
+
+struct_type_map = {
+    'int8': 'b',
+    'int16': 'h',
+    'int32': 'i',
+    'int64': 'q',
+    'uint8': 'B',
+    'uint16': 'H',
+    'uint32': 'I',
+    'uint64': 'Q',
+    'float32': 'f',
+    'float64': 'd',
+    'bool': '?',
+    'char': 'c',
+}
+
+
+def get_topics(msg_file: str):
+    """
+    :return: The topic names of a .msg file (from the "# TOPICS" line, or the file name)
+    """
+    topics = []
+
+    with open(msg_file, 'r') as f:
+        for line in f:
+            if line.startswith('# TOPICS '):
+                topics.extend(line.replace('# TOPICS ', '').split())
+
+    if not topics:
+        topics = [os.path.basename(msg_file).replace('.msg', '')]
+
+    # PascalCase to snake_case
+    return [re.sub(r'(?<!^)(?=[A-Z])', '_', topic).lower() for topic in topics]
+
+
+class MessageLayouts:
+    """
+    Struct layouts of the uORB topics, generated from the .msg files.
+    """
+
+    def __init__(self, msg_dir: str):
+        msg_dirs = [msg_dir, os.path.join(msg_dir, 'versioned')]
+        self.search_path = genmsg.command_line.includepath_to_dict([PACKAGE + ':' + d for d in msg_dirs])
+        self.msg_files = {}
+
+        for d in msg_dirs:
+            for filename in sorted(os.listdir(d)):
+                if filename.endswith('.msg'):
+                    for topic in get_topics(os.path.join(d, filename)):
+                        self.msg_files[topic] = os.path.join(d, filename)
+
+        self.layouts = {}
+
+    def _load_fields(self, msg_type: str):
+        msg_context = genmsg.msg_loader.MsgContext.create_default()
+        spec = genmsg.msg_loader.load_msg_by_type(msg_context, msg_type, self.search_path)
+        return spec.parsed_fields()
+
+    def _flatten(self, fields, prefix: str):
+        """
+        :return: list of (field name, struct format) of the sorted and padded fields
+        """
+        # same ordering and padding as the generated struct
+        sorted_fields = sorted(fields, key=sizeof_field_type, reverse=True)
+        add_padding_bytes(sorted_fields, self.search_path)
+        ret = []
+
+        for field in sorted_fields:
+            if field.is_header:
+                continue
+
+            array_size = field.array_len if field.is_array else 1
+            name = prefix + field.name
+
+            if field.name.startswith('_padding'):
+                ret.append((None, str(array_size) + 'x'))
+
+            elif field.is_builtin:
+                base_type = bare_name(field.type)
+
+                if base_type == 'char' and array_size > 1:
+                    ret.append((name, str(array_size) + 's'))
+
+                elif field.is_array:
+                    for i in range(array_size):
+                        ret.append(('%s[%i]' % (name, i), struct_type_map[base_type]))
+
+                else:
+                    ret.append((name, struct_type_map[base_type]))
+
+            else:
+                children = self._load_fields(field.base_type)
+
+                for i in range(array_size):
+                    child_prefix = ('%s[%i].' % (name, i)) if field.is_array else (name + '.')
+                    ret.extend(self._flatten(children, child_prefix))
+
+        return ret
+
+    def get(self, topic: str):
+        """
+        :return: (message hash, struct, field names) of the topic, or None if unknown
+        """
+        if topic not in self.layouts:
+            if topic not in self.msg_files:
+                return None
+
+            msg_file = self.msg_files[topic]
+            msg_type = PACKAGE + '/' + os.path.basename(msg_file).replace('.msg', '')
+            fields = self._load_fields(msg_type)
+            flat = self._flatten(fields, '')
+
+            # the firmware sends the size without the padding at the end
+            while flat and flat[-1][0] is None:
+                flat.pop()
+
+            names = [name for name, _ in flat if name is not None]
+            message_struct = struct.Struct('<' + ''.join(fmt for _, fmt in flat))
+            self.layouts[topic] = (get_message_hash(fields, self.search_path), message_struct, names)
+
+        return self.layouts[topic]
+
+
+class StreamDecoder:
+    """
+    Splits the byte stream into frames and decodes the samples.
+    """
+
+    def __init__(self, layouts: MessageLayouts, sample_callback):
+        self.layouts = layouts
+        self.sample_callback = sample_callback
+        self.buffer = bytearray()
+        self.streams = {}
+        self.num_crc_errors = 0
+
+    def _handle_definition(self, payload: bytes):
+        index, instance, message_hash, size = struct.unpack_from('<BBIH', payload)
+        topic = payload[8:].decode('utf-8', errors='replace')
+
+        if index in self.streams and self.streams[index][0] == topic:
+            return
+
+        layout = self.layouts.get(topic)
+
+        if layout is None:
+            print("Unknown topic %s, ignoring it" % topic, file=sys.stderr)
+            self.streams[index] = (topic, instance, None)
+
+        elif layout[0] != message_hash or layout[1].size != size:
+            print("Message definition of %s does not match the firmware (hash 0x%08x != 0x%08x, size %i != %i), "
+                  "ignoring it" % (topic, layout[0], message_hash, layout[1].size, size), file=sys.stderr)
+            self.streams[index] = (topic, instance, None)
+
+        else:
+            self.streams[index] = (topic, instance, layout)
+
+    def _handle_sample(self, payload: bytes):
+        if payload[0] not in self.streams:
+            return # definition not received yet
+
+        topic, instance, layout = self.streams[payload[0]]
+
+        if layout is None or len(payload) - 1 != layout[1].size:
+            return
+
+        values = layout[1].unpack_from(payload, 1)
+        self.sample_callback(topic, instance, layout[2], values)
+
+    def add(self, data: bytes):
+        self.buffer.extend(data)
+
+        while True:
+            start = self.buffer.find(SYNC)
+
+            if start < 0:
+                # keep a potential partial sync byte
+                del self.buffer[:max(len(self.buffer) - 1, 0)]
+                return
+
+            del self.buffer[:start]
+
+            if len(self.buffer) < 5:
+                return
+
+            frame_type = self.buffer[2]
+            payload_len = self.buffer[3] | (self.buffer[4] << 8)
+
+            if len(self.buffer) < payload_len + 7:
+                return
+
+            crc = self.buffer[5 + payload_len] | (self.buffer[6 + payload_len] << 8)
+
+            if binascii.crc_hqx(bytes(self.buffer[2:5 + payload_len]), 0xffff) != crc:
+                # not a frame (or corrupted), resync after the sync bytes
+                self.num_crc_errors += 1
+                del self.buffer[:2]
+                continue
+
+            payload = bytes(self.buffer[5:5 + payload_len])
+            del self.buffer[:payload_len + 7]
+
+            if frame_type == FRAME_DEFINITION:
+                self._handle_definition(payload)
+
+            elif frame_type == FRAME_SAMPLE and payload_len > 0:
+                self._handle_sample(payload)
+
+
+class PrintOutput:
+    def __call__(self, topic, instance, names, values):
+        fields = ' '.join('%s=%s' % (name, format_value(value)) for name, value in zip(names, values))
+        print('%s[%i] %s' % (topic, instance, fields))
+
+    def close(self):
+        pass
+
+
+class CsvOutput:
+    """
+    Writes one CSV file per topic instance.
+    """
+
+    def __init__(self, prefix: str):
+        self.prefix = prefix
+        self.files = {}
+
+    def __call__(self, topic, instance, names, values):
+        key = (topic, instance)
+
+        if key not in self.files:
+            f = open('%s_%s_%i.csv' % (self.prefix, topic, instance), 'w')
+            f.write(','.join(names) + '\n')
+            self.files[key] = f
+
+        self.files[key].write(','.join(format_value(value) for value in values) + '\n')
+
+    def close(self):
+        for f in self.files.values():
+            f.close()
+
+
+def format_value(value):
+    if isinstance(value, bytes):
+        return value.split(b'\0', 1)[0].decode('utf-8', errors='replace')
+
+    return str(value)
+
+
+def read_mavlink(args, decoder: StreamDecoder):
+    from mavlink_shell import MavlinkSerialPort
+
+    mav_serialport = MavlinkSerialPort(args.mavlink, args.baudrate, devnum=10)
+    mav_serialport.write('\n') # make sure the shell is started
+    time.sleep(0.5)
+    mav_serialport.read(4096) # drop the prompt
+
+    command = 'listener -b %s' % args.topics
+
+    if args.instance is not None:
+        command += ' -i %i' % args.instance
+
+    if args.rate:
+        command += ' -r %i' % args.rate
+
+    if args.num:
+        command += ' -n %i' % args.num
+
+    mav_serialport.write(command + '\n')
+
+    try:
+        while True:
+            data = mav_serialport.read(4096)
+
+            if data:
+                decoder.add(data.encode('latin-1'))
+
+    except KeyboardInterrupt:
+        mav_serialport.write('\x03')
+
+    mav_serialport.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes the binary stream of the 'listener -b' command.")
+    parser.add_argument('input', nargs='?', default=None,
+                        help="Binary stream file, '-' for stdin")
+    parser.add_argument('--mavlink', default=None,
+                        help="Start the listener over the MAVLink shell on this port instead (e.g. /dev/ttyACM0 or "
+                        "udp:0.0.0.0:14550)")
+    parser.add_argument('--baudrate', type=int, default=57600, help="MAVLink port baud rate")
+    parser.add_argument('--topics', default=None, help="Comma separated list of topics (with --mavlink)")
+    parser.add_argument('-i', dest='instance', type=int, default=None, help="Topic instance (with --mavlink)")
+    parser.add_argument('-r', dest='rate', type=int, default=0, help="Subscription rate (with --mavlink)")
+    parser.add_argument('-n', dest='num', type=int, default=0, help="Number of messages (with --mavlink)")
+    parser.add_argument('--csv', default=None, help="Write one CSV file per topic with this prefix instead of printing")
+    parser.add_argument('--msg-dir', default=os.path.join(os.path.dirname(os.path.realpath(__file__)), '..', 'msg'),
+                        help="Directory of the .msg files")
+    args = parser.parse_args()
+
+    if (args.input is None) == (args.mavlink is None):
+        parser.error("either an input or --mavlink is required")
+
+    if args.mavlink is not None and args.topics is None:
+        parser.error("--topics is required with --mavlink")
+
+    output = CsvOutput(args.csv) if args.csv else PrintOutput()
+    decoder = StreamDecoder(MessageLayouts(args.msg_dir), output)
+
+    try:
+        if args.mavlink is not None:
+            read_mavlink(args, decoder)
+
+        else:
+            f = sys.stdin.buffer if args.input == '-' else open(args.input, 'rb')
+
+            while True:
+                data = f.read1(4096) if hasattr(f, 'read1') else f.read(4096)
+
+                if not data:
+                    break
+
+                decoder.add(data)
+
+    except KeyboardInterrupt:
+        pass
+
+    output.close()
+
+    if decoder.num_crc_errors > 0:
+        print("%i CRC errors" % decoder.num_crc_errors, file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
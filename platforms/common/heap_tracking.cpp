@@ -0,0 +1,239 @@
+/****************************************************************************
+ *
+ * Copyright (C) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file heap_tracking.cpp
+ *
+ * Implementation of the API declared in px4_platform_common/heap_tracking.h.
+ */
+
+#include <px4_platform_common/heap_tracking.h>
+#include <px4_platform_common/atomic.h>
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cstddef>
+#include <new>
+
+namespace px4
+{
+namespace heap_tracking
+{
+
+struct Owner {
+	// constant-initialized, as allocations can happen before the dynamic initialization
+	px4::atomic<uintptr_t> thread; ///< pthread_self() + 1, 0 if unused
+	px4::atomic<size_t> used;
+	px4::atomic<size_t> peak;
+	px4::atomic<uint32_t> allocations;
+	char name[NAME_LENGTH] {};
+};
+
+static Owner owners[MAX_OWNERS];
+
+// in front of every allocation, padded to keep the alignment
+union Header {
+	struct {
+		size_t size;
+		int owner;
+	} info;
+	std::max_align_t align;
+};
+
+static int current_owner()
+{
+	const uintptr_t thread = (uintptr_t)pthread_self() + 1;
+
+	// entries are used in order and never released, so the first unused entry ends the search
+	for (int i = 1; i < MAX_OWNERS; i++) {
+		uintptr_t owner_thread = owners[i].thread.load();
+
+		if (owner_thread == thread) {
+			return i;
+		}
+
+		if (owner_thread == 0) {
+			if (owners[i].thread.compare_exchange(&owner_thread, thread)) {
+				pthread_getname_np(pthread_self(), owners[i].name, sizeof(owners[i].name));
+				return i;
+			}
+
+			// taken by another thread in the meantime, try the next one
+		}
+	}
+
+	return 0;
+}
+
+static void *allocate(size_t size)
+{
+	Header *header = static_cast<Header *>(malloc(sizeof(Header) + size));
+
+	if (header == nullptr) {
+		return nullptr;
+	}
+
+	const int index = current_owner();
+	Owner &owner = owners[index];
+
+	header->info.size = size;
+	header->info.owner = index;
+
+	const size_t used = owner.used.fetch_add(size) + size;
+	size_t peak = owner.peak.load();
+
+	while ((used > peak) && !owner.peak.compare_exchange(&peak, used)) {}
+
+	owner.allocations.fetch_add(1);
+
+	return header + 1;
+}
+
+static void deallocate(void *ptr)
+{
+	if (ptr == nullptr) {
+		return;
+	}
+
+	Header *header = static_cast<Header *>(ptr) - 1;
+	Owner &owner = owners[header->info.owner];
+
+	owner.used.fetch_sub(header->info.size);
+	owner.allocations.fetch_sub(1);
+
+	free(header);
+}
+
+int set_owner_name(const char *name)
+{
+	const int index = current_owner();
+
+	if (index > 0) {
+		strncpy(owners[index].name, name, sizeof(owners[index].name) - 1);
+		owners[index].name[sizeof(owners[index].name) - 1] = '\0';
+	}
+
+	return index;
+}
+
+bool get_owner_usage(int index, owner_usage_t &usage)
+{
+	if ((index < 0) || (index >= MAX_OWNERS)) {
+		return false;
+	}
+
+	const Owner &owner = owners[index];
+
+	if (index == 0) {
+		strncpy(usage.name, "other", sizeof(usage.name));
+		usage.thread = 0;
+
+	} else {
+		usage.thread = owner.thread.load();
+
+		if (usage.thread == 0) {
+			return false;
+		}
+
+		usage.thread -= 1;
+
+		// the name can be written concurrently on registration
+		memcpy(usage.name, owner.name, sizeof(usage.name));
+		usage.name[sizeof(usage.name) - 1] = '\0';
+	}
+
+	usage.used = owner.used.load();
+	usage.peak = owner.peak.load();
+	usage.allocations = owner.allocations.load();
+
+	return true;
+}
+
+} // namespace heap_tracking
+} // namespace px4
+
+/*
+ * Replacements of the global operator new/delete. Like everywhere in PX4 a failed allocation
+ * returns nullptr instead of throwing.
+ */
+void *operator new (size_t size)
+{
+	return px4::heap_tracking::allocate(size);
+}
+
+void *operator new[](size_t size)
+{
+	return px4::heap_tracking::allocate(size);
+}
+
+void *operator new (size_t size, const std::nothrow_t &) noexcept
+{
+	return px4::heap_tracking::allocate(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+	return px4::heap_tracking::allocate(size);
+}
+
+void operator delete (void *ptr) noexcept
+{
+	px4::heap_tracking::deallocate(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+	px4::heap_tracking::deallocate(ptr);
+}
+
+void operator delete (void *ptr, size_t) noexcept
+{
+	px4::heap_tracking::deallocate(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+	px4::heap_tracking::deallocate(ptr);
+}
+
+void operator delete (void *ptr, const std::nothrow_t &) noexcept
+{
+	px4::heap_tracking::deallocate(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+	px4::heap_tracking::deallocate(ptr);
+}
@@ -38,6 +38,7 @@
 #endif
 
 #include <lib/drivers/device/Device.hpp>
+#include <lib/drivers/device/I2CBusScheduler.hpp>
 #include <px4_platform_common/i2c_spi_buses.h>
 #include <px4_platform_common/px4_work_queue/WorkItemSingleShot.hpp>
 #include <px4_platform_common/log.h>
@@ -600,111 +601,172 @@ static void initializer_trampoline(void *argument)
 	data->instance = data->instantiate(data->config, data->runtime_instance);
 }
 
-int I2CSPIDriverBase::module_start(const BusCLIArguments &cli, BusInstanceIterator &iterator,
-				   void(*print_usage)(), instantiate_method instantiate)
+/**
+ * Probe of a single bus (device) that runs on the work queue thread of the bus.
+ * Probes on different buses run on different threads, so all candidate buses are probed
+ * at the same time and absent devices only cost one timeout instead of one per bus.
+ */
+struct I2CSPIDriverProbe {
+	I2CSPIDriverProbe(const BusCLIArguments &cli, const BusInstanceIterator &iterator, const px4::wq_config_t &wq_config,
+			  I2CSPIDriverBase::instantiate_method instantiate, int runtime_instance) :
+		config(cli, iterator, wq_config),
+		initializing{config, instantiate, runtime_instance},
+		initializer(wq_config, initializer_trampoline, &initializing),
+		bus_type(iterator.busType()),
+		bus(iterator.bus()),
+		devid(iterator.devid()),
+		external(iterator.external()),
+		external_bus_index(iterator.externalBusIndex())
+	{}
+
+	I2CSPIDriverConfig config;
+	I2CSPIDriverInitializing initializing;
+	px4::WorkItemSingleShot initializer;
+
+	const board_bus_types bus_type;
+	const int bus;
+	const uint32_t devid;
+	const bool external;
+	const int external_bus_index;
+};
+
+static bool finish_probe(const BusCLIArguments &cli, BusInstanceIterator &iterator, I2CSPIDriverProbe &probe)
 {
-	if (iterator.configuredBusOption() == I2CSPIBusOption::All) {
-		PX4_ERR("need to specify a bus type");
-		print_usage();
-		return -1;
+	probe.initializer.wait();
+	I2CSPIDriverBase *instance = probe.initializing.instance;
+
+	if (!instance) {
+		PX4_DEBUG("instantiate failed (no device on bus %i (devid 0x%x)?)", probe.bus, probe.devid);
+		return false;
 	}
 
-	bool started = false;
+#if defined(CONFIG_I2C)
 
-	while (iterator.next()) {
-		if (iterator.instance()) {
-			PX4_WARN("Already running on bus %i", iterator.bus());
-			continue;
-		}
+	if (cli.i2c_address != 0 && instance->get_i2c_address() == 0) {
+		PX4_ERR("Bug: driver %s does not pass the I2C address to I2CSPIDriverBase", instance->ItemName());
+	}
 
+#endif // CONFIG_I2C
 
-		device::Device::DeviceId device_id{};
-		device_id.devid_s.bus = iterator.bus();
+	// probes finish in any order, the instance number is assigned in bus order
+	const int runtime_instance = iterator.runningInstancesCount();
+	(void)runtime_instance; // unused without I2C and SPI
+	iterator.addInstance(instance);
 
-		switch (iterator.busType()) {
+	// print some info that we are running
+	switch (probe.bus_type) {
 #if defined(CONFIG_I2C)
 
-		case BOARD_I2C_BUS: device_id.devid_s.bus_type = device::Device::DeviceBusType_I2C; break;
-#endif // CONFIG_I2C
+	case BOARD_I2C_BUS:
+		PX4_INFO_RAW("%s #%i on I2C bus %d", instance->ItemName(), runtime_instance, probe.bus);
 
-#if defined(CONFIG_SPI)
+		if (probe.external) {
+			PX4_INFO_RAW(" (external)");
+		}
 
-		case BOARD_SPI_BUS: device_id.devid_s.bus_type = device::Device::DeviceBusType_SPI; break;
-#endif // CONFIG_SPI
+		if (cli.i2c_address != 0) {
+			PX4_INFO_RAW(" address 0x%X", cli.i2c_address);
+		}
 
-		case BOARD_INVALID_BUS: device_id.devid_s.bus_type = device::Device::DeviceBusType_UNKNOWN; break;
+		if (cli.rotation != 0) {
+			PX4_INFO_RAW(" rotation %d", cli.rotation);
 		}
 
+		PX4_INFO_RAW("\n");
 
-		const px4::wq_config_t &wq_config = px4::device_bus_to_wq(device_id.devid);
-		I2CSPIDriverConfig driver_config{cli, iterator, wq_config};
-		const int runtime_instance = iterator.runningInstancesCount();
-		I2CSPIDriverInitializing initializer_data{driver_config, instantiate, runtime_instance};
-		// initialize the object and bus on the work queue thread - this will also probe for the device
-		px4::WorkItemSingleShot initializer(wq_config, initializer_trampoline, &initializer_data);
-		initializer.ScheduleNow();
-		initializer.wait();
-		I2CSPIDriverBase *instance = initializer_data.instance;
+		break;
+#endif // CONFIG_I2C
+#if defined(CONFIG_SPI)
 
-		if (!instance) {
-			PX4_DEBUG("instantiate failed (no device on bus %i (devid 0x%x)?)", iterator.bus(), iterator.devid());
-			continue;
-		}
+	case BOARD_SPI_BUS:
+		PX4_INFO_RAW("%s #%i on SPI bus %d", instance->ItemName(), runtime_instance, probe.bus);
 
-#if defined(CONFIG_I2C)
+		if (probe.external) {
+			PX4_INFO_RAW(" (external, equal to '-b %i')", probe.external_bus_index);
+		}
 
-		if (cli.i2c_address != 0 && instance->_i2c_address == 0) {
-			PX4_ERR("Bug: driver %s does not pass the I2C address to I2CSPIDriverBase", instance->ItemName());
+		if (cli.rotation != 0) {
+			PX4_INFO_RAW(" rotation %d", cli.rotation);
 		}
 
-#endif // CONFIG_I2C
+		PX4_INFO_RAW("\n");
 
-		iterator.addInstance(instance);
-		started = true;
+		break;
+#endif // CONFIG_SPI
 
-		// print some info that we are running
-		switch (iterator.busType()) {
-#if defined(CONFIG_I2C)
+	case BOARD_INVALID_BUS:
+		break;
+	}
 
-		case BOARD_I2C_BUS:
-			PX4_INFO_RAW("%s #%i on I2C bus %d", instance->ItemName(), runtime_instance, iterator.bus());
+	return true;
+}
 
-			if (iterator.external()) {
-				PX4_INFO_RAW(" (external)");
-			}
+int I2CSPIDriverBase::module_start(const BusCLIArguments &cli, BusInstanceIterator &iterator,
+				   void(*print_usage)(), instantiate_method instantiate)
+{
+	if (iterator.configuredBusOption() == I2CSPIBusOption::All) {
+		PX4_ERR("need to specify a bus type");
+		print_usage();
+		return -1;
+	}
 
-			if (cli.i2c_address != 0) {
-				PX4_INFO_RAW(" address 0x%X", cli.i2c_address);
-			}
+	// number of probes that are started before waiting for their results
+	static constexpr int MAX_PARALLEL_PROBES = 8;
+	I2CSPIDriverProbe *probes[MAX_PARALLEL_PROBES] {};
+	int num_probes = 0;
+
+	bool started = false;
+	bool iterating = true;
+
+	while (iterating) {
+		iterating = iterator.next();
 
-			if (cli.rotation != 0) {
-				PX4_INFO_RAW(" rotation %d", cli.rotation);
+		if (iterating) {
+			if (iterator.instance()) {
+				PX4_WARN("Already running on bus %i", iterator.bus());
+				continue;
 			}
 
-			PX4_INFO_RAW("\n");
+			device::Device::DeviceId device_id{};
+			device_id.devid_s.bus = iterator.bus();
 
-			break;
+			switch (iterator.busType()) {
+#if defined(CONFIG_I2C)
+
+			case BOARD_I2C_BUS: device_id.devid_s.bus_type = device::Device::DeviceBusType_I2C; break;
 #endif // CONFIG_I2C
+
 #if defined(CONFIG_SPI)
 
-		case BOARD_SPI_BUS:
-			PX4_INFO_RAW("%s #%i on SPI bus %d", instance->ItemName(), runtime_instance, iterator.bus());
+			case BOARD_SPI_BUS: device_id.devid_s.bus_type = device::Device::DeviceBusType_SPI; break;
+#endif // CONFIG_SPI
 
-			if (iterator.external()) {
-				PX4_INFO_RAW(" (external, equal to '-b %i')", iterator.externalBusIndex());
+			case BOARD_INVALID_BUS: device_id.devid_s.bus_type = device::Device::DeviceBusType_UNKNOWN; break;
 			}
 
-			if (cli.rotation != 0) {
-				PX4_INFO_RAW(" rotation %d", cli.rotation);
-			}
+			// initialize the object and bus on the work queue thread - this will also probe for the device
+			const px4::wq_config_t &wq_config = px4::device_bus_to_wq(device_id.devid);
+			const int runtime_instance = iterator.runningInstancesCount() + num_probes;
+			I2CSPIDriverProbe *probe = new I2CSPIDriverProbe(cli, iterator, wq_config, instantiate, runtime_instance);
 
-			PX4_INFO_RAW("\n");
+			if (probe) {
+				probe->initializer.ScheduleNow();
+				probes[num_probes++] = probe;
 
-			break;
-#endif // CONFIG_SPI
+			} else {
+				PX4_ERR("alloc failed");
+			}
+		}
 
-		case BOARD_INVALID_BUS:
-			break;
+		// wait for the pending probes once all buses are scheduled or the batch is full
+		if (num_probes > 0 && (!iterating || num_probes == MAX_PARALLEL_PROBES)) {
+			for (int i = 0; i < num_probes; i++) {
+				started |= finish_probe(cli, iterator, *probes[i]);
+				delete probes[i];
+				probes[i] = nullptr;
+			}
+
+			num_probes = 0;
 		}
 	}
 
@@ -811,6 +873,7 @@ void I2CSPIDriverBase::print_status()
 
 	if (_bus_option == I2CSPIBusOption::I2CExternal || _bus_option == I2CSPIBusOption::I2CInternal) {
 		PX4_INFO("Running on I2C Bus %i, Address 0x%02X", _bus, get_i2c_address());
+		device::I2CBusScheduler::print_status(_bus);
 		return;
 	}
 
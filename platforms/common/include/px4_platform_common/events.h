@@ -45,6 +45,8 @@
 #endif
 
 #include <events/events_generated.h>
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/atomic.h>
 #include <uORB/topics/event.h>
 
 #include <stdint.h>
@@ -127,6 +129,48 @@ inline void send(uint32_t id, const LogLevels &log_levels, const char *message)
 	send(e);
 }
 
+/**
+ * Limit the rate of an event, for example one that is sent on every iteration while a check is failing,
+ * so it can neither flood the event queue nor use up CPU time.
+ * Declare it next to the event (e.g. as class member) and only send if allow() returns true:
+ *
+ *	if (_sensor_timeout_rate_limiter.allow()) {
+ *		events::send(events::ID("..."), events::Log::Error, "...");
+ *	}
+ *
+ * It is lock-free, and if shared between threads, only one of concurrent callers is allowed.
+ */
+class RateLimiter
+{
+public:
+	explicit RateLimiter(hrt_abstime interval) : _interval(interval) {}
+
+	/**
+	 * @return true if the event can be sent, at most once per interval
+	 */
+	bool allow(hrt_abstime now = hrt_absolute_time())
+	{
+		hrt_abstime last_sent = _last_sent.load();
+
+		if ((last_sent != 0) && (now < last_sent + _interval)) {
+			_suppressed.fetch_add(1);
+			return false;
+		}
+
+		return _last_sent.compare_exchange(&last_sent, now);
+	}
+
+	/**
+	 * @return number of events suppressed since the last call (to report them with the next allowed event)
+	 */
+	uint32_t takeSuppressedCount() { return _suppressed.fetch_and(0); }
+
+private:
+	const hrt_abstime _interval;
+	::px4::atomic<hrt_abstime> _last_sent{0};
+	::px4::atomic<uint32_t> _suppressed{0};
+};
+
 static constexpr uint16_t initial_event_sequence = 65535 - 10; // initialize with a high number so it wraps soon
 
 } // namespace events
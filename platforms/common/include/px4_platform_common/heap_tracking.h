@@ -0,0 +1,85 @@
+/****************************************************************************
+ *
+ * Copyright (C) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file heap_tracking.h
+ *
+ * Heap usage per thread (CONFIG_PLATFORM_HEAP_TRACKING).
+ *
+ * The global operator new/delete are replaced by a wrapper that stores the size and the
+ * allocating thread in front of every allocation, and accounts the bytes in use, the
+ * high watermark and the number of allocations per thread. Memory freed by another
+ * thread is still accounted to the allocating one. Allocations with malloc() are not tracked.
+ *
+ * Threads are registered on their first allocation, those beyond MAX_OWNERS are accounted
+ * together as "other". Entries are never released, a thread id reused after a thread exited
+ * continues the entry of the old thread.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace px4
+{
+namespace heap_tracking
+{
+
+static constexpr int MAX_OWNERS = 32; ///< tracked threads, including "other"
+static constexpr int NAME_LENGTH = 24;
+
+struct owner_usage_t {
+	char name[NAME_LENGTH];
+	uintptr_t thread; ///< pthread_self() of the owner, 0 for "other"
+	size_t used;      ///< bytes in use
+	size_t peak;      ///< high watermark of used
+	uint32_t allocations; ///< allocations in use
+};
+
+/**
+ * Name the calling thread in the usage reports (e.g. a work queue, as its first allocations
+ * happen before the thread name is set)
+ * @param name copied
+ * @return index of the calling thread
+ */
+int set_owner_name(const char *name);
+
+/**
+ * Usage of the thread at index, the "other" entry is at index 0
+ * @return false if there is no thread at index (the same for all higher indices)
+ */
+bool get_owner_usage(int index, owner_usage_t &usage);
+
+} // namespace heap_tracking
+} // namespace px4
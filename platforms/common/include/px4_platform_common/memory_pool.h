@@ -0,0 +1,159 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file memory_pool.h
+ *
+ * Fixed size block pools for objects that are repeatedly created and deleted at runtime
+ * (e.g. on reconfiguration), so they don't fragment the heap.
+ *
+ * A pool grows in chunks of blocks from the heap when it runs empty, but never gives memory
+ * back: freed blocks are kept in a free list and reused, so once the peak usage is reached,
+ * allocating and freeing is O(1) and does not touch the heap anymore.
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include <cstddef>
+
+namespace px4
+{
+
+class MemoryPool
+{
+public:
+	static constexpr size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+
+	/**
+	 * @param name name for the status output, must stay valid (string literal)
+	 * @param block_size size of a single allocation
+	 * @param blocks_per_chunk number of blocks to allocate from the heap at once
+	 */
+	MemoryPool(const char *name, size_t block_size, unsigned blocks_per_chunk);
+
+	// frees all chunks, all blocks must have been freed already
+	~MemoryPool();
+
+	MemoryPool(const MemoryPool &) = delete;
+	MemoryPool &operator=(const MemoryPool &) = delete;
+
+	/**
+	 * @return block of block_size() bytes, or nullptr if the pool is empty and the heap is exhausted
+	 */
+	void *allocate();
+
+	/**
+	 * Return a block to the pool
+	 * @param block must have been allocated from this pool
+	 */
+	void deallocate(void *block);
+
+	size_t block_size() const { return _block_size; }
+
+	/**
+	 * Print the usage of all pools
+	 */
+	static void printStatus();
+
+private:
+	struct FreeBlock {
+		FreeBlock *next;
+	};
+
+	struct Chunk {
+		Chunk *next;
+	};
+
+	bool grow();
+
+	const char *const _name;
+	const size_t _block_size;
+	const unsigned _blocks_per_chunk;
+
+	pthread_mutex_t _mutex{};
+
+	FreeBlock *_free_list{nullptr};
+	Chunk *_chunks{nullptr};
+
+	unsigned _num_chunks{0};
+	unsigned _used{0};
+	unsigned _peak{0};
+	unsigned _failures{0};
+
+	MemoryPool *_next_pool{nullptr}; ///< list of all pools, for printStatus()
+};
+
+/**
+ * Allocator for objects of varying size on top of a set of MemoryPool's (one per size class).
+ * Objects larger than the largest size class are allocated from the heap directly.
+ *
+ * Typically used for class specific operator new/delete of a base class:
+ *
+ *	static void *operator new(size_t size) noexcept { return allocator.allocate(size); }
+ *	static void operator delete(void *ptr) { px4::PoolAllocator::deallocate(ptr); }
+ */
+class PoolAllocator
+{
+public:
+	static constexpr size_t NUM_SIZE_CLASSES = 5;
+	static constexpr size_t MIN_BLOCK_SIZE = 64; ///< size classes 64, 128, 256, 512, 1024 bytes (including the header)
+
+	explicit PoolAllocator(const char *name);
+
+	PoolAllocator(const PoolAllocator &) = delete;
+	PoolAllocator &operator=(const PoolAllocator &) = delete;
+
+	/**
+	 * @return allocation of at least size bytes, or nullptr
+	 */
+	void *allocate(size_t size);
+
+	/**
+	 * Free an allocation of any PoolAllocator
+	 */
+	static void deallocate(void *ptr);
+
+private:
+	// in front of every allocation, padded to keep the alignment
+	union Header {
+		MemoryPool *pool; ///< nullptr for allocations from the heap
+		std::max_align_t align;
+	};
+
+	MemoryPool _pools[NUM_SIZE_CLASSES];
+};
+
+} // namespace px4
@@ -62,14 +62,29 @@ inline static param_t param_handle(px4::params p)
 #define _CALL_UPDATE(x) \
 	STRIP(x).update();
 
+#define _CALL_CHANGED_SINCE(x) \
+	|| param_changed_since(STRIP(x).handle(), _params_generation)
+
+// Re-read all parameters of the class, but only if at least one of them changed since the last update.
+// Reading all of them (not only the changed ones) restores any local modification done with set().
+#define _UPDATE_CHANGED_PARAMETERS(...) \
+	const uint32_t params_generation = param_generation(); \
+	\
+	if (false APPLY_ALL(_CALL_CHANGED_SINCE, __VA_ARGS__)) { \
+		APPLY_ALL(_CALL_UPDATE, __VA_ARGS__) \
+	} \
+	\
+	_params_generation = params_generation;
+
 // define the parameter update method, which will update all parameters.
 // It is marked as 'final', so that wrong usages lead to a compile error (see below)
 #define _DEFINE_PARAMETER_UPDATE_METHOD(...) \
 	protected: \
 	void updateParamsImpl() final { \
-		APPLY_ALL(_CALL_UPDATE, __VA_ARGS__) \
+		_UPDATE_CHANGED_PARAMETERS(__VA_ARGS__) \
 	} \
-	private:
+	private: \
+	uint32_t _params_generation{0};
 
 // Define a list of parameters. This macro also creates code to update parameters.
 // If you get a compile error like:
@@ -86,9 +101,10 @@ inline static param_t param_handle(px4::params p)
 	protected: \
 	void updateParamsImpl() override { \
 		parent_class::updateParamsImpl(); \
-		APPLY_ALL(_CALL_UPDATE, __VA_ARGS__) \
+		_UPDATE_CHANGED_PARAMETERS(__VA_ARGS__) \
 	} \
-	private:
+	private: \
+	uint32_t _params_generation{0};
 
 #define DEFINE_PARAMETERS_CUSTOM_PARENT(parent_class, ...) \
 	APPLY_ALL(_DEFINE_SINGLE_PARAMETER, __VA_ARGS__) \
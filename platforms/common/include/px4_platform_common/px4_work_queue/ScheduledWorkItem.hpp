@@ -81,6 +81,10 @@ protected:
 
 	virtual void print_run_status() override;
 
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+	uint32_t NominalInterval() const override { return (_call.period > 0) ? _call.period : 0; }
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
 private:
 
 	virtual void Run() override = 0;
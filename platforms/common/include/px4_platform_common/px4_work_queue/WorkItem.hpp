@@ -83,6 +83,30 @@ public:
 
 	const char *ItemName() const { return _item_name; }
 
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+	/**
+	 * Run time statistics since the item was created.
+	 */
+	void get_statistics(work_item_statistics_t &statistics) const;
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
+#if defined(CONFIG_WQ_EDF)
+	/**
+	 * Set the relative deadline from scheduling to running the item.
+	 * Queued items with a deadline run earliest-deadline-first, before items without one.
+	 *
+	 * @param deadline_us The relative deadline in microseconds, 0 for none.
+	 */
+	void SetDeadline(uint32_t deadline_us) { _deadline_us = deadline_us; }
+
+	uint32_t deadline() const { return _deadline_us; }
+
+	/**
+	 * Number of runs that started after their deadline.
+	 */
+	uint32_t deadline_misses() const { return _deadline_misses; }
+#endif // CONFIG_WQ_EDF
+
 	virtual ~WorkItem();
 
 protected:
@@ -112,6 +136,14 @@ protected:
 	friend void WorkQueue::Run();
 	virtual void Run() = 0;
 
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+	/**
+	 * Nominal interval between runs in microseconds, 0 if the item is not run periodically.
+	 * A run taking longer is counted as overrun.
+	 */
+	virtual uint32_t NominalInterval() const { return 0; }
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
 	/**
 	 * Initialize WorkItem given a WorkQueue config. This call
 	 * can also be used to switch to a different WorkQueue.
@@ -133,6 +165,44 @@ protected:
 
 private:
 
+	friend class WorkQueue;
+
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+	void AccountRun(hrt_abstime start, hrt_abstime end)
+	{
+		const hrt_abstime run_time = end - start;
+
+		_run_time_total += run_time;
+		_run_time_max = math::max(_run_time_max, (uint32_t)run_time);
+		_run_count_total++;
+
+		// without a nominal interval, use the time since the previous run started
+		uint32_t interval = NominalInterval();
+
+		if ((interval == 0) && (_last_run_start != 0)) {
+			interval = start - _last_run_start;
+		}
+
+		if ((interval > 0) && (run_time > interval)) {
+			_overruns++;
+		}
+
+		_last_run_start = start;
+	}
+
+	hrt_abstime	_last_run_start{0};
+	uint64_t	_run_time_total{0};
+	uint32_t	_run_time_max{0};
+	uint32_t	_run_count_total{0};
+	uint32_t	_overruns{0};
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
+#if defined(CONFIG_WQ_EDF)
+	hrt_abstime	_absolute_deadline{0}; // 0 while not queued
+	uint32_t	_deadline_us{0};
+	uint32_t	_deadline_misses{0};
+#endif // CONFIG_WQ_EDF
+
 	WorkQueue	*_wq{nullptr};
 
 };
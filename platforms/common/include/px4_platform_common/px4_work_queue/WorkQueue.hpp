@@ -73,6 +73,14 @@ public:
 
 	void print_status(bool last = false);
 
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+	/**
+	 * Statistics of the item at index, the index is decremented by the number of items otherwise.
+	 * @return true if the item is in this work queue
+	 */
+	bool get_item_statistics(unsigned &index, work_item_statistics_t &statistics);
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
 	// WorkQueues sorted numerically by relative priority (-1 to -255)
 	bool operator<=(const WorkQueue &rhs) const { return _config.relative_priority >= rhs.get_config().relative_priority; }
 
@@ -82,6 +90,9 @@ private:
 
 	inline void SignalWorkerThread();
 
+	// next item to run (FIFO, or earliest deadline with CONFIG_WQ_EDF), work_lock must be held
+	WorkItem *PopNext();
+
 #ifdef __PX4_NUTTX
 	// In NuttX work can be enqueued from an ISR
 	void work_lock() { _flags = enter_critical_section(); }
@@ -100,6 +111,15 @@ private:
 	const wq_config_t		&_config;
 	BlockingList<WorkItem *>	_work_items;
 	px4::atomic_bool		_should_exit{false};
+	bool				_processing{false}; // worker is draining _q (protected by work_lock)
+
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+	WorkItem			*_running_item{nullptr}; // protected by work_lock
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
+#if defined(CONFIG_PLATFORM_HEAP_TRACKING)
+	int				_heap_owner{-1}; // heap_tracking index of the worker thread
+#endif // CONFIG_PLATFORM_HEAP_TRACKING
 
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
 	int _lockstep_component {-1};
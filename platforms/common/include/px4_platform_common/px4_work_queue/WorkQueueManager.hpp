@@ -123,6 +123,25 @@ int WorkQueueManagerStatus();
  */
 WorkQueue *WorkQueueFindOrCreate(const wq_config_t &new_wq);
 
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+struct work_item_statistics_t {
+	const char *item_name;
+	const char *wq_name;
+	uint64_t run_time_total_us; // accumulated run time
+	uint32_t run_time_max_us;   // longest run
+	uint32_t run_count;         // number of runs
+	uint32_t overruns;          // runs longer than the nominal interval
+};
+
+/**
+ * Get the run time statistics of a WorkItem, enumerating the items of all work queues.
+ *
+ * @param index the index of the item over all work queues
+ * @return true if the item exists
+ */
+bool WorkQueueManagerItemStatistics(unsigned index, work_item_statistics_t &statistics);
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
 /**
  * Map a PX4 driver device id to a work queue (by sensor bus).
  *
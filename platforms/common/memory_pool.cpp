@@ -0,0 +1,235 @@
+/****************************************************************************
+ *
+ * Copyright (C) 2017 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file memory_pool.cpp
+ *
+ * Implementation of the API declared in px4_platform_common/memory_pool.h.
+ */
+
+#include <px4_platform_common/memory_pool.h>
+#include <px4_platform_common/log.h>
+
+#include <stdlib.h>
+
+namespace px4
+{
+
+static MemoryPool *pools_head = nullptr;
+static pthread_mutex_t pools_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static constexpr size_t align_up(size_t size)
+{
+	return (size + MemoryPool::BLOCK_ALIGNMENT - 1) & ~(MemoryPool::BLOCK_ALIGNMENT - 1);
+}
+
+MemoryPool::MemoryPool(const char *name, size_t block_size, unsigned blocks_per_chunk) :
+	_name(name),
+	// a free block must at least hold the free list pointer
+	_block_size(align_up(block_size < sizeof(FreeBlock) ? sizeof(FreeBlock) : block_size)),
+	_blocks_per_chunk(blocks_per_chunk > 0 ? blocks_per_chunk : 1)
+{
+	pthread_mutex_init(&_mutex, nullptr);
+
+	pthread_mutex_lock(&pools_mutex);
+	_next_pool = pools_head;
+	pools_head = this;
+	pthread_mutex_unlock(&pools_mutex);
+}
+
+MemoryPool::~MemoryPool()
+{
+	pthread_mutex_lock(&pools_mutex);
+
+	for (MemoryPool **pool = &pools_head; *pool != nullptr; pool = &(*pool)->_next_pool) {
+		if (*pool == this) {
+			*pool = _next_pool;
+			break;
+		}
+	}
+
+	pthread_mutex_unlock(&pools_mutex);
+
+	while (_chunks) {
+		Chunk *next = _chunks->next;
+		free(_chunks);
+		_chunks = next;
+	}
+
+	pthread_mutex_destroy(&_mutex);
+}
+
+bool MemoryPool::grow()
+{
+	// the chunk header is padded so that all blocks keep the alignment
+	const size_t header_size = align_up(sizeof(Chunk));
+	uint8_t *memory = static_cast<uint8_t *>(malloc(header_size + _blocks_per_chunk * _block_size));
+
+	if (memory == nullptr) {
+		return false;
+	}
+
+	Chunk *chunk = reinterpret_cast<Chunk *>(memory);
+	chunk->next = _chunks;
+	_chunks = chunk;
+	_num_chunks++;
+
+	// push in reverse order, so that blocks are handed out in address order
+	for (unsigned i = _blocks_per_chunk; i > 0; i--) {
+		FreeBlock *block = reinterpret_cast<FreeBlock *>(memory + header_size + (i - 1) * _block_size);
+		block->next = _free_list;
+		_free_list = block;
+	}
+
+	return true;
+}
+
+void *MemoryPool::allocate()
+{
+	pthread_mutex_lock(&_mutex);
+
+	if (_free_list == nullptr && !grow()) {
+		_failures++;
+		pthread_mutex_unlock(&_mutex);
+		return nullptr;
+	}
+
+	FreeBlock *block = _free_list;
+	_free_list = block->next;
+
+	if (++_used > _peak) {
+		_peak = _used;
+	}
+
+	pthread_mutex_unlock(&_mutex);
+
+	return block;
+}
+
+void MemoryPool::deallocate(void *block)
+{
+	if (block == nullptr) {
+		return;
+	}
+
+	pthread_mutex_lock(&_mutex);
+
+	FreeBlock *free_block = static_cast<FreeBlock *>(block);
+	free_block->next = _free_list;
+	_free_list = free_block;
+	_used--;
+
+	pthread_mutex_unlock(&_mutex);
+}
+
+void MemoryPool::printStatus()
+{
+	PX4_INFO_RAW("%-20s %6s %6s %6s %6s %6s %8s %8s\n",
+		     "POOL", "SIZE", "USED", "PEAK", "TOTAL", "CHUNKS", "RAM", "FAILURES");
+
+	pthread_mutex_lock(&pools_mutex);
+
+	for (MemoryPool *pool = pools_head; pool != nullptr; pool = pool->_next_pool) {
+		pthread_mutex_lock(&pool->_mutex);
+
+		const unsigned total = pool->_num_chunks * pool->_blocks_per_chunk;
+		PX4_INFO_RAW("%-20s %6zu %6u %6u %6u %6u %8zu %8u\n", pool->_name, pool->_block_size, pool->_used, pool->_peak, total,
+			     pool->_num_chunks, pool->_num_chunks * (align_up(sizeof(Chunk)) + pool->_blocks_per_chunk * pool->_block_size),
+			     pool->_failures);
+
+		pthread_mutex_unlock(&pool->_mutex);
+	}
+
+	pthread_mutex_unlock(&pools_mutex);
+}
+
+PoolAllocator::PoolAllocator(const char *name) :
+	// fewer blocks per chunk for the larger size classes, so a chunk is around 2 KB
+	_pools{
+	{name, MIN_BLOCK_SIZE << 0, 2048 / (MIN_BLOCK_SIZE << 0)},
+	{name, MIN_BLOCK_SIZE << 1, 2048 / (MIN_BLOCK_SIZE << 1)},
+	{name, MIN_BLOCK_SIZE << 2, 2048 / (MIN_BLOCK_SIZE << 2)},
+	{name, MIN_BLOCK_SIZE << 3, 2048 / (MIN_BLOCK_SIZE << 3)},
+	{name, MIN_BLOCK_SIZE << 4, 2},
+}
+{
+	static_assert(NUM_SIZE_CLASSES == 5, "update the pool initialization");
+	static_assert(sizeof(Header) % MemoryPool::BLOCK_ALIGNMENT == 0, "Header must keep the alignment");
+}
+
+void *PoolAllocator::allocate(size_t size)
+{
+	const size_t total_size = size + sizeof(Header);
+	Header *header = nullptr;
+
+	for (size_t i = 0; i < NUM_SIZE_CLASSES; i++) {
+		if (total_size <= _pools[i].block_size()) {
+			header = static_cast<Header *>(_pools[i].allocate());
+
+			if (header == nullptr) {
+				return nullptr;
+			}
+
+			header->pool = &_pools[i];
+			return header + 1;
+		}
+	}
+
+	// larger than the largest size class
+	header = static_cast<Header *>(malloc(total_size));
+
+	if (header == nullptr) {
+		return nullptr;
+	}
+
+	header->pool = nullptr;
+	return header + 1;
+}
+
+void PoolAllocator::deallocate(void *ptr)
+{
+	if (ptr == nullptr) {
+		return;
+	}
+
+	Header *header = static_cast<Header *>(ptr) - 1;
+
+	if (header->pool) {
+		header->pool->deallocate(header);
+
+	} else {
+		free(header);
+	}
+}
+
+} // namespace px4
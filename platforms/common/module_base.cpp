@@ -188,14 +188,17 @@ void ModuleBase::exit_and_cleanup(Descriptor &desc)
 
 int ModuleBase::wait_until_running(Descriptor &desc, int timeout_ms)
 {
+	// poll with a short interval: every module start waits here, which adds up during boot
+	static constexpr int POLL_INTERVAL_US = 500;
+	const int max_polls = timeout_ms * 1000 / POLL_INTERVAL_US;
 	int i = 0;
 
-	do {
-		px4_usleep(2000);
-
-	} while (!desc.object.load() && ++i < timeout_ms / 2);
+	// the task might already be running when the scheduler switched to it right away
+	while (!desc.object.load() && ++i < max_polls) {
+		px4_usleep(POLL_INTERVAL_US);
+	}
 
-	if (i >= timeout_ms / 2) {
+	if (i >= max_polls) {
 		PX4_ERR("Timed out while waiting for thread to start");
 		return -1;
 	}
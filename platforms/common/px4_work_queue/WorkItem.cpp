@@ -132,6 +132,18 @@ float WorkItem::average_interval() const
 	return 0.f;
 }
 
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+void WorkItem::get_statistics(work_item_statistics_t &statistics) const
+{
+	statistics.item_name = _item_name;
+	statistics.wq_name = (_wq != nullptr) ? _wq->get_name() : "";
+	statistics.run_time_total_us = _run_time_total;
+	statistics.run_time_max_us = _run_time_max;
+	statistics.run_count = _run_count_total;
+	statistics.overruns = _overruns;
+}
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
 void WorkItem::print_run_status()
 {
 	PX4_INFO_RAW("%-29s %8.1f Hz %12.0f us\n", _item_name, (double)average_rate(), (double)average_interval());
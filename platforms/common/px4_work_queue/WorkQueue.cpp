@@ -36,10 +36,12 @@
 
 #include <string.h>
 
+#include <px4_platform_common/heap_tracking.h>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/tasks.h>
 #include <px4_platform_common/time.h>
 #include <drivers/drv_hrt.h>
+#include <lib/perf/perf_trace.h>
 
 namespace px4
 {
@@ -105,6 +107,15 @@ void WorkQueue::Detach(WorkItem *item)
 
 	_work_items.remove(item);
 
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+
+	if (_running_item == item) {
+		// deleted from within its own Run()
+		_running_item = nullptr;
+	}
+
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
 	if (_work_items.size() == 0) {
 		// shutdown, no active WorkItems
 		PX4_DEBUG("stopping: %s, last active WorkItem closing", _config.name);
@@ -138,10 +149,26 @@ void WorkQueue::Add(WorkItem *item)
 
 #endif // ENABLE_LOCKSTEP_SCHEDULER
 
+#if defined(CONFIG_WQ_EDF)
+
+	// keep the deadline of an already queued item
+	if (item->_absolute_deadline == 0) {
+		item->_absolute_deadline = (item->_deadline_us > 0) ? hrt_absolute_time() + item->_deadline_us : UINT64_MAX;
+	}
+
+#endif // CONFIG_WQ_EDF
+
 	_q.push(item);
+
+	// a draining worker picks the item up without a wakeup, e.g. the next stage
+	// of a sensor -> controller chain scheduled from a running item of this queue
+	const bool signal = !_processing;
+
 	work_unlock();
 
-	SignalWorkerThread();
+	if (signal) {
+		SignalWorkerThread();
+	}
 }
 
 void WorkQueue::SignalWorkerThread()
@@ -156,7 +183,13 @@ void WorkQueue::SignalWorkerThread()
 void WorkQueue::Remove(WorkItem *item)
 {
 	work_lock();
-	_q.remove(item);
+
+	if (_q.remove(item)) {
+#if defined(CONFIG_WQ_EDF)
+		item->_absolute_deadline = 0;
+#endif // CONFIG_WQ_EDF
+	}
+
 	work_unlock();
 }
 
@@ -165,29 +198,85 @@ void WorkQueue::Clear()
 	work_lock();
 
 	while (!_q.empty()) {
+#if defined(CONFIG_WQ_EDF)
+		_q.front()->_absolute_deadline = 0;
+#endif // CONFIG_WQ_EDF
 		_q.pop();
 	}
 
 	work_unlock();
 }
 
+WorkItem *WorkQueue::PopNext()
+{
+#if defined(CONFIG_WQ_EDF)
+	// earliest deadline first, FIFO among equal deadlines
+	WorkItem *next = nullptr;
+
+	for (WorkItem *item : _q) {
+		if ((next == nullptr) || (item->_absolute_deadline < next->_absolute_deadline)) {
+			next = item;
+		}
+	}
+
+	_q.remove(next);
+
+	const hrt_abstime now = hrt_absolute_time();
+
+	if ((next->_deadline_us > 0) && (now > next->_absolute_deadline)) {
+		next->_deadline_misses++;
+	}
+
+	next->_absolute_deadline = 0;
+	return next;
+#else
+	return _q.pop();
+#endif // CONFIG_WQ_EDF
+}
+
 void WorkQueue::Run()
 {
+	perf_trace_thread_name(_config.name);
+
+#if defined(CONFIG_PLATFORM_HEAP_TRACKING)
+	_heap_owner = heap_tracking::set_owner_name(_config.name);
+#endif // CONFIG_PLATFORM_HEAP_TRACKING
+
 	while (!should_exit()) {
 		// loop as the wait may be interrupted by a signal
 		do {} while (px4_sem_wait(&_process_lock) != 0);
 
 		work_lock();
 
+		_processing = true;
+
 		// process queued work
 		while (!_q.empty()) {
-			WorkItem *work = _q.pop();
+			WorkItem *work = PopNext();
+
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+			_running_item = work;
+			const hrt_abstime start = hrt_absolute_time();
+#endif // CONFIG_WQ_ITEM_STATISTICS
 
 			work_unlock(); // unlock work queue to run (item may requeue itself)
+			const char *item_name = work->ItemName();
+			perf_trace_begin(item_name);
 			work->RunPreamble();
 			work->Run();
 			// Note: after Run() we cannot access work anymore, as it might have been deleted
+			perf_trace_end(item_name);
 			work_lock(); // re-lock
+
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+
+			// cleared by Detach() if the item was deleted
+			if (_running_item == work) {
+				work->AccountRun(start, hrt_absolute_time());
+			}
+
+			_running_item = nullptr;
+#endif // CONFIG_WQ_ITEM_STATISTICS
 		}
 
 #if defined(ENABLE_LOCKSTEP_SCHEDULER)
@@ -199,16 +288,58 @@ void WorkQueue::Run()
 
 #endif // ENABLE_LOCKSTEP_SCHEDULER
 
+		// the queue is empty, new items need to signal again
+		_processing = false;
+
 		work_unlock();
 	}
 
 	PX4_DEBUG("%s: exiting", _config.name);
 }
 
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+bool WorkQueue::get_item_statistics(unsigned &index, work_item_statistics_t &statistics)
+{
+	bool found = false;
+
+	// same lock order as Attach() and Detach(), work_lock also protects AccountRun()
+	work_lock();
+
+	{
+		LockGuard lg{_work_items.mutex()};
+
+		for (WorkItem *item : _work_items) {
+			if (index == 0) {
+				item->get_statistics(statistics);
+				found = true;
+				break;
+			}
+
+			index--;
+		}
+	}
+
+	work_unlock();
+
+	return found;
+}
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
 void WorkQueue::print_status(bool last)
 {
 	const size_t num_items = _work_items.size();
 	PX4_INFO_RAW("%-16s\n", get_name());
+
+#if defined(CONFIG_PLATFORM_HEAP_TRACKING)
+	heap_tracking::owner_usage_t heap_usage;
+
+	if ((_heap_owner > 0) && heap_tracking::get_owner_usage(_heap_owner, heap_usage)) {
+		PX4_INFO_RAW("%s   heap: %zu B, peak: %zu B, allocations: %" PRIu32 "\n", last ? " " : "|",
+			     heap_usage.used, heap_usage.peak, heap_usage.allocations);
+	}
+
+#endif // CONFIG_PLATFORM_HEAP_TRACKING
+
 	unsigned i = 0;
 
 	for (WorkItem *item : _work_items) {
@@ -229,6 +360,23 @@ void WorkQueue::print_status(bool last)
 		}
 
 		item->print_run_status();
+
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+		work_item_statistics_t statistics;
+		item->get_statistics(statistics);
+
+		PX4_INFO_RAW("%s   %s      cpu: %" PRIu64 " ms, max: %" PRIu32 " us, overruns: %" PRIu32 "\n", last ? " " : "|",
+			     (i < num_items) ? "|" : " ", statistics.run_time_total_us / 1000, statistics.run_time_max_us, statistics.overruns);
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
+#if defined(CONFIG_WQ_EDF)
+
+		if (item->deadline() > 0) {
+			PX4_INFO_RAW("%s   %s      deadline: %" PRIu32 " us, missed: %" PRIu32 "\n", last ? " " : "|",
+				     (i < num_items) ? "|" : " ", item->deadline(), item->deadline_misses());
+		}
+
+#endif // CONFIG_WQ_EDF
 	}
 }
 
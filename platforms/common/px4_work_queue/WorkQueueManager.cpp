@@ -243,6 +243,103 @@ WorkQueueRunner(void *context)
 	return nullptr;
 }
 
+#if defined(__PX4_LINUX) && defined(CONFIG_WQ_CPU_AFFINITY)
+/**
+ * Parse a CPU list ("0-1,3") into cpuset.
+ * @return true if at least one CPU was set
+ */
+static bool
+ParseCpuList(const char *cpus, const char *end, cpu_set_t &cpuset)
+{
+	bool valid = false;
+
+	while (cpus < end) {
+		char *next = nullptr;
+		const long first = strtol(cpus, &next, 10);
+
+		if (next == cpus) {
+			break;
+		}
+
+		long last = first;
+
+		if (*next == '-') {
+			cpus = next + 1;
+			last = strtol(cpus, &next, 10);
+
+			if (next == cpus) {
+				break;
+			}
+		}
+
+		for (long cpu = first; (cpu <= last) && (cpu >= 0) && (cpu < CPU_SETSIZE); cpu++) {
+			CPU_SET(cpu, &cpuset);
+			valid = true;
+		}
+
+		if (*next != ',') {
+			break;
+		}
+
+		cpus = next + 1;
+	}
+
+	return valid;
+}
+
+/**
+ * Get the configured CPU affinity of a work queue (CONFIG_WQ_CPU_AFFINITY).
+ * @return true if the work queue should be pinned
+ */
+static bool
+WorkQueueCpuAffinity(const char *wq_name, cpu_set_t &cpuset)
+{
+	CPU_ZERO(&cpuset);
+
+	// entries are given without the "wq:" prefix
+	if (strncmp(wq_name, "wq:", 3) == 0) {
+		wq_name += 3;
+	}
+
+	const size_t name_length = strlen(wq_name);
+	const char *entry = CONFIG_WQ_CPU_AFFINITY;
+
+	while (*entry != '\0') {
+		const char *entry_end = strchr(entry, ';');
+
+		if (entry_end == nullptr) {
+			entry_end = entry + strlen(entry);
+		}
+
+		const char *separator = strchr(entry, ':');
+
+		if ((separator != nullptr) && (separator < entry_end)
+		    && ((size_t)(separator - entry) == name_length) && (strncmp(entry, wq_name, name_length) == 0)) {
+			return ParseCpuList(separator + 1, entry_end, cpuset);
+		}
+
+		entry = (*entry_end == ';') ? entry_end + 1 : entry_end;
+	}
+
+#if defined(CONFIG_WQ_INS_CPU_SPREAD)
+
+	// one CPU per INS work queue
+	if ((strncmp(wq_name, "INS", 3) == 0) && (wq_name[3] >= '0') && (wq_name[3] <= '9')) {
+		const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		if (cpus > 0) {
+			CPU_SET((CONFIG_WQ_INS_CPU_FIRST + (wq_name[3] - '0')) % cpus, &cpuset);
+			return true;
+		}
+	}
+
+#endif // CONFIG_WQ_INS_CPU_SPREAD
+
+	const char *default_cpus = CONFIG_WQ_CPU_AFFINITY_DEFAULT;
+	return ParseCpuList(default_cpus, default_cpus + strlen(default_cpus), cpuset);
+}
+#endif // __PX4_LINUX && CONFIG_WQ_CPU_AFFINITY
+
 #if defined(__PX4_NUTTX) && !defined(CONFIG_BUILD_FLAT)
 // Wrapper for px4_task_spawn_cmd interface
 inline static int
@@ -319,10 +416,43 @@ WorkQueueManagerRun(int, char **)
 				PX4_ERR("setting sched params for %s failed (%i)", wq->name, ret_setschedparam);
 			}
 
+#if defined(__PX4_POSIX) && defined(CONFIG_WQ_SCHED_FIFO)
+			// otherwise policy and priority are inherited from wq:manager
+			int ret_setinheritsched = pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+
+			if (ret_setinheritsched != 0) {
+				PX4_ERR("setting explicit sched for %s failed (%i)", wq->name, ret_setinheritsched);
+			}
+
+#endif // __PX4_POSIX && CONFIG_WQ_SCHED_FIFO
+
+#if defined(__PX4_LINUX) && defined(CONFIG_WQ_CPU_AFFINITY)
+			cpu_set_t cpuset;
+
+			if (WorkQueueCpuAffinity(wq->name, cpuset)) {
+				int ret_setaffinity = pthread_attr_setaffinity_np(&attr, sizeof(cpuset), &cpuset);
+
+				if (ret_setaffinity != 0) {
+					PX4_ERR("setting cpu affinity for %s failed (%i)", wq->name, ret_setaffinity);
+				}
+			}
+
+#endif // __PX4_LINUX && CONFIG_WQ_CPU_AFFINITY
+
 			// create thread
 			pthread_t thread;
 			int ret_create = pthread_create(&thread, &attr, WorkQueueRunner, (void *)wq);
 
+#if defined(__PX4_POSIX) && defined(CONFIG_WQ_SCHED_FIFO)
+
+			if (ret_create == EPERM) {
+				PX4_WARN("no permission for SCHED_FIFO, %s inherits the scheduling policy", wq->name);
+				pthread_attr_setinheritsched(&attr, PTHREAD_INHERIT_SCHED);
+				ret_create = pthread_create(&thread, &attr, WorkQueueRunner, (void *)wq);
+			}
+
+#endif // __PX4_POSIX && CONFIG_WQ_SCHED_FIFO
+
 			if (ret_create == 0) {
 				PX4_DEBUG("starting: %s, priority: %d, stack: %zu bytes", wq->name, param.sched_priority, stacksize);
 
@@ -461,6 +591,24 @@ WorkQueueManagerStop()
 	return PX4_OK;
 }
 
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+bool
+WorkQueueManagerItemStatistics(unsigned index, work_item_statistics_t &statistics)
+{
+	if (!_wq_manager_should_exit.load() && _wq_manager_running.load()) {
+		LockGuard lg{_wq_manager_wqs_list->mutex()};
+
+		for (WorkQueue *wq : *_wq_manager_wqs_list) {
+			if (wq->get_item_statistics(index, statistics)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+#endif // CONFIG_WQ_ITEM_STATISTICS
+
 int
 WorkQueueManagerStatus()
 {
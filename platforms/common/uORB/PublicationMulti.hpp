@@ -92,6 +92,29 @@ public:
 		return (orb_publish(get_topic(), _handle, &data) == PX4_OK);
 	}
 
+	/**
+	 * Loan the next message directly from the topic queue to fill it in place (zero-copy).
+	 * Only for topics with a single publisher, do not mix with publish() on the same topic.
+	 * The message contains stale data and must be completely written before commit().
+	 * @return pointer to the message or nullptr if loaning is not available, use publish() then.
+	 */
+	T *loan()
+	{
+		if (!advertised()) {
+			advertise();
+		}
+
+		return static_cast<T *>(Manager::orb_loan(_handle));
+	}
+
+	/**
+	 * Publish the message obtained with loan()
+	 */
+	bool commit()
+	{
+		return (Manager::orb_commit(get_topic(), _handle) == PX4_OK);
+	}
+
 	int get_instance()
 	{
 		// advertise if not already advertised
@@ -163,6 +163,59 @@ public:
 		return false;
 	}
 
+	/**
+	 * Update a generated uORB message struct, with a constant-size copy.
+	 * Other types use the runtime message size.
+	 * @param dst The uORB message struct we are updating.
+	 */
+	template<typename T>
+	bool update(T *dst)
+	{
+		if (subscribe()) {
+			return Manager::orb_data_copy<orb_message_size<T>::value>(_node, dst, _last_generation, true);
+		}
+
+		return false;
+	}
+
+	/**
+	 * Copy a generated uORB message struct, with a constant-size copy.
+	 * Other types use the runtime message size.
+	 * @param dst The uORB message struct we are updating.
+	 */
+	template<typename T>
+	bool copy(T *dst)
+	{
+		if (subscribe()) {
+			return Manager::orb_data_copy<orb_message_size<T>::value>(_node, dst, _last_generation, false);
+		}
+
+		return false;
+	}
+
+	/**
+	 * Zero-copy access to the next unread message in the topic queue.
+	 * Every successful peek() must be followed by release() after the data is consumed.
+	 * @return pointer to the message or nullptr if there is no update (or zero-copy is not available).
+	 */
+	const void *peek()
+	{
+		if (subscribe()) {
+			return Manager::orb_data_peek(_node, _last_generation);
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Finish access to the message returned by peek().
+	 * @return false if the message was overwritten by a publisher while in use and must be discarded.
+	 */
+	bool release()
+	{
+		return valid() && Manager::orb_data_release(_node, _last_generation);
+	}
+
 	/**
 	 * Change subscription instance
 	 * @param instance The new multi-Subscription instance
@@ -228,7 +281,7 @@ public:
 	SubscriptionData &operator=(SubscriptionData &&) = delete;
 
 	// update the embedded struct.
-	bool update() { return Subscription::update((void *)(&_data)); }
+	bool update() { return Subscription::update(&_data); }
 
 	const T &get() const { return _data; }
 
@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file SubscriptionCallbackGroup.hpp
+ *
+ * Coalesces the publication callbacks of several topics into a single WorkItem run.
+ */
+
+#pragma once
+
+#include <uORB/SubscriptionCallback.hpp>
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+
+namespace uORB
+{
+
+class SubscriptionCallbackGroup
+{
+public:
+	static constexpr int MAX_MEMBERS = 32;
+
+	/**
+	 * All-of group: the WorkItem is scheduled once every member received an update.
+	 *
+	 * @param work_item The WorkItem to schedule.
+	 */
+	explicit SubscriptionCallbackGroup(px4::WorkItem *work_item) :
+		_work_item(work_item)
+	{
+	}
+
+	/**
+	 * Any-of group: the WorkItem is scheduled once every member received an update,
+	 * but at the latest window_us after the first update. Uses ScheduleDelayed() on the item.
+	 *
+	 * @param work_item The ScheduledWorkItem to schedule.
+	 * @param window_us Maximum time to wait for the remaining members in microseconds.
+	 */
+	SubscriptionCallbackGroup(px4::ScheduledWorkItem *work_item, uint32_t window_us) :
+		_work_item(work_item),
+		_scheduled_work_item(work_item),
+		_window_us(window_us)
+	{
+	}
+
+	~SubscriptionCallbackGroup() = default;
+
+	/**
+	 * Add a member, called by SubscriptionCallbackGroupItem.
+	 * @return the member bit, 0 if the group is full
+	 */
+	uint32_t add()
+	{
+		if (_num_members >= MAX_MEMBERS) {
+			return 0;
+		}
+
+		const uint32_t bit = 1u << _num_members++;
+		_members |= bit;
+		return bit;
+	}
+
+	/**
+	 * Called from the publication context of a member topic.
+	 */
+	void notify(uint32_t bit)
+	{
+		if (_scheduled_work_item && (_window_us > 0)) {
+			const hrt_abstime now = hrt_absolute_time();
+
+			if ((_pending.load() != 0) && (now - _window_start >= _window_us)) {
+				// the previous window was already dispatched by the timeout
+				_pending.store(0);
+			}
+
+			if (_pending.fetch_or(bit) == 0) {
+				_window_start = now;
+
+				if (bit != _members) {
+					_scheduled_work_item->ScheduleDelayed(_window_us);
+					return;
+				}
+			}
+
+		} else {
+			_pending.fetch_or(bit);
+		}
+
+		uint32_t all = _members;
+
+		// only one of concurrent publishers completes the group
+		if (_pending.compare_exchange(&all, 0)) {
+			if (_scheduled_work_item && (_window_us > 0)) {
+				_scheduled_work_item->ScheduleClear();
+			}
+
+			_work_item->ScheduleNow();
+		}
+	}
+
+	/**
+	 * Members that received an update since the last dispatch.
+	 */
+	uint32_t pending() const { return _pending.load(); }
+
+private:
+	px4::WorkItem *_work_item;
+	px4::ScheduledWorkItem *_scheduled_work_item{nullptr};
+
+	const uint32_t _window_us{0};
+	hrt_abstime _window_start{0};
+
+	px4::atomic<uint32_t> _pending{0};
+	uint32_t _members{0};
+	int _num_members{0};
+};
+
+// Subscription whose callbacks are coalesced by a SubscriptionCallbackGroup
+class SubscriptionCallbackGroupItem : public SubscriptionCallback
+{
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param group The group to join, must outlive the subscription.
+	 * @param meta The uORB metadata (usually from the ORB_ID() macro) for the topic.
+	 * @param instance The instance for multi sub.
+	 */
+	SubscriptionCallbackGroupItem(SubscriptionCallbackGroup *group, const orb_metadata *meta, uint8_t instance = 0) :
+		SubscriptionCallback(meta, 0, instance),	// interval 0
+		_group(group),
+		_bit(group->add())
+	{
+	}
+
+	virtual ~SubscriptionCallbackGroupItem() = default;
+
+	void call() override
+	{
+		if ((_bit != 0) && updated()) {
+			_group->notify(_bit);
+		}
+	}
+
+private:
+	SubscriptionCallbackGroup *_group;
+	const uint32_t _bit;
+};
+
+} // namespace uORB
@@ -109,6 +109,19 @@ public:
 	 */
 	bool copy(void *dst);
 
+	/**
+	 * Zero-copy access to the next message if updated (respecting the interval).
+	 * Every successful peek() must be followed by release() after the data is consumed.
+	 * @return pointer to the message in the topic queue, nullptr if not updated.
+	 */
+	const void *peek();
+
+	/**
+	 * Finish access to the message returned by peek().
+	 * @return false if the message was overwritten by a publisher while in use and must be discarded.
+	 */
+	bool release() { return _subscription.release(); }
+
 	bool		valid() const { return _subscription.valid(); }
 
 	uint8_t		get_instance() const { return _subscription.get_instance(); }
@@ -135,6 +148,9 @@ public:
 	void		set_last_update(hrt_abstime t) { _last_update = t; }
 protected:
 
+	/** advance the last update time after a message was read */
+	void advance_last_update();
+
 	Subscription	_subscription;
 	uint64_t	_last_update{0};	// last subscription update in microseconds
 	uint32_t	_interval_us{0};	// maximum update interval in microseconds
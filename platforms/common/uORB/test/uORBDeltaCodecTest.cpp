@@ -0,0 +1,139 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <uORB/uORBDeltaCodec.hpp>
+
+#include <gtest/gtest.h>
+#include <px4_platform_common/param.h>
+#include <uORB/topics/battery_status.h>
+
+#include <string.h>
+
+// To run: make tests TESTFILTER=uORBDeltaCodec
+
+class uORBDeltaCodecTest : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		param_control_autosave(false);
+
+		ASSERT_TRUE(encoder.init(ORB_ID(battery_status), 0));
+		ASSERT_TRUE(decoder.init(ORB_ID(battery_status)));
+
+		message.timestamp = 1000;
+		message.connected = true;
+		message.voltage_v = 16.f;
+		message.remaining = 0.8f;
+		message.cell_count = 4;
+	}
+
+	bool transmit(const battery_status_s &msg, int &encoded_size)
+	{
+		encoded_size = encoder.encode(&msg, buffer, sizeof(buffer));
+
+		if (encoded_size <= 0) {
+			return false;
+		}
+
+		battery_status_s received{};
+
+		if (!decoder.decode(buffer, encoded_size, &received)) {
+			return false;
+		}
+
+		// compare without the padding at the end
+		return memcmp(&received, &msg, ORB_ID(battery_status)->o_size) == 0;
+	}
+
+	uORB::DeltaEncoder encoder;
+	uORB::DeltaDecoder decoder;
+	battery_status_s message{};
+	uint8_t buffer[sizeof(battery_status_s) + sizeof(uORB::DeltaHeader)];
+};
+
+TEST_F(uORBDeltaCodecTest, layout_covers_message)
+{
+	uORB::MessageFieldLayout layout;
+	ASSERT_TRUE(layout.load(ORB_ID(battery_status)));
+	ASSERT_GT(layout.numFields(), 1);
+
+	EXPECT_EQ(layout.offset(0), 0); // timestamp
+	EXPECT_EQ(layout.size(0), 8);
+
+	for (int i = 1; i < layout.numFields(); ++i) {
+		EXPECT_GE(layout.offset(i), layout.offset(i - 1) + layout.size(i - 1));
+	}
+
+	const int last = layout.numFields() - 1;
+	EXPECT_LE(layout.offset(last) + layout.size(last), ORB_ID(battery_status)->o_size);
+}
+
+TEST_F(uORBDeltaCodecTest, only_changed_fields_are_sent)
+{
+	int encoded_size = 0;
+
+	// first sample is a keyframe
+	ASSERT_TRUE(transmit(message, encoded_size));
+	EXPECT_EQ(encoded_size, (int)encoder.maxEncodedSize());
+
+	// timestamp and voltage changed
+	message.timestamp += 1000;
+	message.voltage_v = 15.9f;
+	ASSERT_TRUE(transmit(message, encoded_size));
+	const int delta_size = encoded_size;
+	EXPECT_LT(delta_size, (int)encoder.maxEncodedSize() / 4);
+
+	// unchanged sample: header and bitmask only
+	ASSERT_TRUE(transmit(message, encoded_size));
+	EXPECT_EQ(encoded_size, delta_size - 8 - 4);
+}
+
+TEST_F(uORBDeltaCodecTest, resynchronize_after_loss)
+{
+	int encoded_size = 0;
+	ASSERT_TRUE(transmit(message, encoded_size));
+
+	// lose a delta sample
+	message.remaining = 0.7f;
+	EXPECT_GT(encoder.encode(&message, buffer, sizeof(buffer)), 0);
+
+	message.timestamp += 1000;
+	EXPECT_FALSE(transmit(message, encoded_size));
+	EXPECT_FALSE(decoder.synchronized());
+
+	encoder.requestKeyframe();
+	EXPECT_TRUE(transmit(message, encoded_size));
+	EXPECT_TRUE(decoder.synchronized());
+	EXPECT_EQ(encoded_size, (int)encoder.maxEncodedSize());
+}
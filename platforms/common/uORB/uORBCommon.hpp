@@ -49,5 +49,19 @@ struct orb_advertdata {
 	int *instance;
 };
 
+/**
+ * Compile-time message size (o_size) of a generated topic struct, 0 if T is not one.
+ * sizeof(T) cannot be used, it includes the padding at the end of the struct.
+ */
+template<typename T, typename = void>
+struct orb_message_size {
+	static constexpr size_t value = 0;
+};
+
+template<typename T>
+struct orb_message_size<T, decltype((void)T::ORB_MESSAGE_SIZE)> {
+	static constexpr size_t value = T::ORB_MESSAGE_SIZE;
+};
+
 }
 #endif // _uORBCommon_hpp_
@@ -0,0 +1,332 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "uORBDeltaCodec.hpp"
+#include "uORBMessageFields.hpp"
+
+#include <uORB/topics/uORBTopics.hpp>
+#include <px4_platform_common/log.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace uORB
+{
+
+static constexpr unsigned bitmask_size(int num_fields) { return (num_fields + 7) / 8; }
+
+unsigned MessageFieldLayout::fieldSize(const char *field)
+{
+	unsigned element_size = 0;
+	const char *type_end = field + 1;
+
+	switch ((unsigned char)field[0]) {
+	case 0x82: // int8_t
+	case 0x86: // uint8_t
+	case 0x8c: // bool
+	case 0x8d: // char
+		element_size = 1;
+		break;
+
+	case 0x83: // int16_t
+	case 0x87: // uint16_t
+		element_size = 2;
+		break;
+
+	case 0x84: // int32_t
+	case 0x88: // uint32_t
+	case 0x8a: // float
+		element_size = 4;
+		break;
+
+	case 0x85: // int64_t
+	case 0x89: // uint64_t
+	case 0x8b: // double
+		element_size = 8;
+		break;
+
+	default: {
+			// nested type, embedded with its padding at the end (8 byte aligned)
+			type_end = field;
+
+			while (*type_end != '\0' && *type_end != '[' && *type_end != ' ') {
+				++type_end;
+			}
+
+			const size_t type_length = type_end - field;
+			const orb_metadata *const *topics = orb_get_topics();
+
+			for (size_t i = 0; i < orb_topics_count(); ++i) {
+				if (strlen(topics[i]->o_name) == type_length && strncmp(topics[i]->o_name, field, type_length) == 0) {
+					element_size = (topics[i]->o_size + 7u) & ~7u;
+					break;
+				}
+			}
+		}
+		break;
+	}
+
+	if (*type_end == '[') {
+		element_size *= strtoul(type_end + 1, nullptr, 10);
+	}
+
+	return element_size;
+}
+
+void MessageFieldLayout::add(unsigned offset, unsigned size)
+{
+	if (offset >= _message_size) {
+		// padding at the end
+		return;
+	}
+
+	if (offset + size > _message_size) {
+		size = _message_size - offset;
+	}
+
+	if (_num_fields == MAX_FIELDS) {
+		// merge into the last field
+		_size[_num_fields - 1] = offset + size - _offset[_num_fields - 1];
+		return;
+	}
+
+	_offset[_num_fields] = offset;
+	_size[_num_fields] = size;
+	++_num_fields;
+}
+
+bool MessageFieldLayout::load(const orb_metadata *meta)
+{
+	_num_fields = 0;
+	_message_size = meta->o_size;
+
+	char buffer[256];
+	MessageFormatReader format_reader(buffer, sizeof(buffer));
+
+	if (!format_reader.readUntilFormat(meta->o_id)) {
+		PX4_ERR("failed to find format for topic %s", meta->o_name);
+		return false;
+	}
+
+	unsigned offset = 0;
+	int field_length = 0;
+
+	while (format_reader.readNextField(field_length)) {
+		const unsigned size = fieldSize(buffer);
+
+		if (size == 0) {
+			PX4_ERR("%s: unknown field %s", meta->o_name, buffer);
+			_num_fields = 0;
+			return false;
+		}
+
+		const char *name = strchr(buffer, ' ');
+
+		if (!name || strncmp(name + 1, "_padding", 8) != 0) {
+			add(offset, size);
+		}
+
+		offset += size;
+	}
+
+	if (offset < _message_size || _num_fields == 0) {
+		PX4_ERR("%s: format size mismatch (%u < %u)", meta->o_name, offset, _message_size);
+		_num_fields = 0;
+		return false;
+	}
+
+	return true;
+}
+
+bool DeltaEncoder::init(const orb_metadata *meta, unsigned keyframe_interval)
+{
+	if (!_layout.load(meta)) {
+		return false;
+	}
+
+	delete[] _last;
+	_last = new uint8_t[meta->o_size];
+
+	if (_last == nullptr) {
+		return false;
+	}
+
+	_meta = meta;
+	_keyframe_interval = keyframe_interval;
+	_keyframe_requested = true;
+	return true;
+}
+
+unsigned DeltaEncoder::maxEncodedSize() const
+{
+	// a delta larger than the full message is sent as keyframe
+	return _meta ? sizeof(DeltaHeader) + _meta->o_size : 0;
+}
+
+int DeltaEncoder::encode(const void *message, uint8_t *buffer, unsigned buffer_length)
+{
+	if (_meta == nullptr || buffer_length < maxEncodedSize()) {
+		return -1;
+	}
+
+	const uint8_t *data = static_cast<const uint8_t *>(message);
+	const unsigned mask_size = bitmask_size(_layout.numFields());
+
+	bool keyframe = _keyframe_requested
+			|| (_keyframe_interval > 0 && _samples_since_keyframe + 1 >= _keyframe_interval);
+
+	unsigned length = sizeof(DeltaHeader);
+
+	if (!keyframe) {
+		uint8_t *mask = buffer + sizeof(DeltaHeader);
+		memset(mask, 0, mask_size);
+		length += mask_size;
+
+		for (int i = 0; i < _layout.numFields(); ++i) {
+			const uint16_t offset = _layout.offset(i);
+			const uint16_t size = _layout.size(i);
+
+			if (memcmp(data + offset, _last + offset, size) != 0) {
+				if (length + size > buffer_length) {
+					keyframe = true;
+					break;
+				}
+
+				mask[i / 8] |= 1 << (i % 8);
+				memcpy(buffer + length, data + offset, size);
+				length += size;
+			}
+		}
+
+		if (length >= sizeof(DeltaHeader) + _meta->o_size) {
+			keyframe = true;
+		}
+	}
+
+	DeltaHeader header{};
+	header.sequence = _sequence++;
+
+	if (keyframe) {
+		header.flags = DeltaHeader::FLAG_KEYFRAME;
+		memcpy(buffer + sizeof(DeltaHeader), data, _meta->o_size);
+		length = sizeof(DeltaHeader) + _meta->o_size;
+		_samples_since_keyframe = 0;
+		_keyframe_requested = false;
+
+	} else {
+		++_samples_since_keyframe;
+	}
+
+	memcpy(buffer, &header, sizeof(header));
+	memcpy(_last, data, _meta->o_size);
+
+	return length;
+}
+
+bool DeltaDecoder::init(const orb_metadata *meta)
+{
+	if (!_layout.load(meta)) {
+		return false;
+	}
+
+	delete[] _last;
+	_last = new uint8_t[meta->o_size];
+
+	if (_last == nullptr) {
+		return false;
+	}
+
+	_meta = meta;
+	_synchronized = false;
+	return true;
+}
+
+bool DeltaDecoder::decode(const uint8_t *buffer, unsigned buffer_length, void *message)
+{
+	if (_meta == nullptr || buffer_length < sizeof(DeltaHeader)) {
+		return false;
+	}
+
+	DeltaHeader header;
+	memcpy(&header, buffer, sizeof(header));
+
+	if (header.flags & DeltaHeader::FLAG_KEYFRAME) {
+		if (buffer_length != sizeof(DeltaHeader) + _meta->o_size) {
+			return false;
+		}
+
+		memcpy(_last, buffer + sizeof(DeltaHeader), _meta->o_size);
+
+	} else {
+		if (!_synchronized || header.sequence != (uint8_t)(_sequence + 1)) {
+			// lost a sample, wait for the next keyframe
+			_synchronized = false;
+			return false;
+		}
+
+		const uint8_t *mask = buffer + sizeof(DeltaHeader);
+		unsigned length = sizeof(DeltaHeader) + bitmask_size(_layout.numFields());
+
+		if (buffer_length < length) {
+			return false;
+		}
+
+		// validate the length before modifying the last state
+		unsigned expected_length = length;
+
+		for (int i = 0; i < _layout.numFields(); ++i) {
+			if (mask[i / 8] & (1 << (i % 8))) {
+				expected_length += _layout.size(i);
+			}
+		}
+
+		if (buffer_length != expected_length) {
+			_synchronized = false;
+			return false;
+		}
+
+		for (int i = 0; i < _layout.numFields(); ++i) {
+			if (mask[i / 8] & (1 << (i % 8))) {
+				memcpy(_last + _layout.offset(i), buffer + length, _layout.size(i));
+				length += _layout.size(i);
+			}
+		}
+	}
+
+	_sequence = header.sequence;
+	_synchronized = true;
+	memcpy(message, _last, _meta->o_size);
+	return true;
+}
+
+} // namespace uORB
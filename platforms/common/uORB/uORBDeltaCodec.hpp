@@ -0,0 +1,170 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file uORBDeltaCodec.hpp
+ *
+ * Field-wise delta encoding of uORB messages for bandwidth limited bridges.
+ * Only the fields that changed since the previously encoded sample are transmitted.
+ */
+
+#pragma once
+
+#include <uORB/uORB.h>
+
+#include <stdint.h>
+
+namespace uORB
+{
+
+/**
+ * Field boundaries of a message, read from the uORB message formats (uORBMessageFields).
+ * Padding is excluded, nested types are handled as a single field.
+ */
+class MessageFieldLayout
+{
+public:
+	static constexpr int MAX_FIELDS = 96;
+
+	/**
+	 * Read the layout of a topic (slow, call once in thread context).
+	 * If there are more than MAX_FIELDS fields, the remaining ones are merged into the last field.
+	 * @return true on success
+	 */
+	bool load(const orb_metadata *meta);
+
+	int numFields() const { return _num_fields; }
+	uint16_t offset(int field) const { return _offset[field]; }
+	uint16_t size(int field) const { return _size[field]; }
+
+	/**
+	 * Size of a tokenized field in bytes (from the uORBMessageFields format), 0 if unknown.
+	 */
+	static unsigned fieldSize(const char *field);
+
+private:
+	void add(unsigned offset, unsigned size);
+
+	uint16_t _offset[MAX_FIELDS];
+	uint16_t _size[MAX_FIELDS];
+	int _num_fields{0};
+	uint16_t _message_size{0};
+};
+
+/**
+ * Encoded sample: header (flags, sequence), then either the full message (keyframe)
+ * or a bitmask of the changed fields followed by the data of these fields.
+ */
+struct DeltaHeader {
+	static constexpr uint8_t FLAG_KEYFRAME = 1 << 0;
+
+	uint8_t flags;
+	uint8_t sequence;
+};
+
+class DeltaEncoder
+{
+public:
+	DeltaEncoder() = default;
+	~DeltaEncoder() { delete[] _last; }
+
+	DeltaEncoder(const DeltaEncoder &) = delete;
+	DeltaEncoder &operator=(const DeltaEncoder &) = delete;
+
+	/**
+	 * @param keyframe_interval send a full message every N samples (for links with losses), 0 to disable
+	 * @return true on success
+	 */
+	bool init(const orb_metadata *meta, unsigned keyframe_interval = 50);
+
+	/**
+	 * Worst case size of an encoded sample
+	 */
+	unsigned maxEncodedSize() const;
+
+	/**
+	 * Encode a message relative to the previously encoded one.
+	 * @param message message of o_size bytes
+	 * @param buffer output buffer of at least maxEncodedSize() bytes
+	 * @return number of bytes written, -1 on error
+	 */
+	int encode(const void *message, uint8_t *buffer, unsigned buffer_length);
+
+	/**
+	 * Force the next sample to be a keyframe, e.g. on request of a decoder that lost sync
+	 */
+	void requestKeyframe() { _keyframe_requested = true; }
+
+private:
+	MessageFieldLayout _layout{};
+	const orb_metadata *_meta{nullptr};
+	uint8_t *_last{nullptr};
+
+	unsigned _keyframe_interval{0};
+	unsigned _samples_since_keyframe{0};
+	uint8_t _sequence{0};
+	bool _keyframe_requested{true};
+};
+
+class DeltaDecoder
+{
+public:
+	DeltaDecoder() = default;
+	~DeltaDecoder() { delete[] _last; }
+
+	DeltaDecoder(const DeltaDecoder &) = delete;
+	DeltaDecoder &operator=(const DeltaDecoder &) = delete;
+
+	bool init(const orb_metadata *meta);
+
+	/**
+	 * Decode a sample into the full message.
+	 * A delta sample is rejected until a keyframe was received and after a sequence gap,
+	 * in which case the sender should be asked for a keyframe (DeltaEncoder::requestKeyframe()).
+	 * @param message output message of o_size bytes
+	 * @return true if message was written
+	 */
+	bool decode(const uint8_t *buffer, unsigned buffer_length, void *message);
+
+	bool synchronized() const { return _synchronized; }
+
+private:
+	MessageFieldLayout _layout{};
+	const orb_metadata *_meta{nullptr};
+	uint8_t *_last{nullptr};
+
+	uint8_t _sequence{0};
+	bool _synchronized{false};
+};
+
+} // namespace uORB
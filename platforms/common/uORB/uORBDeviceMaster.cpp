@@ -112,7 +112,7 @@ int uORB::DeviceMaster::advertise(const struct orb_metadata *meta, bool is_adver
 
 			if (ret == -EEXIST) {
 				/* if the node exists already, get the existing one and check if it's advertised. */
-				uORB::DeviceNode *existing_node = getDeviceNodeLocked(meta, group_tries);
+				uORB::DeviceNode *existing_node = getDeviceNode(meta, group_tries);
 
 				/*
 				 * We can claim an existing node in these cases:
@@ -150,7 +150,7 @@ int uORB::DeviceMaster::advertise(const struct orb_metadata *meta, bool is_adver
 
 			// add to the node map.
 			_node_list.add(node);
-			_node_exists[node->get_instance()].set((orb_id_size_t)node->id(), true);
+			_node_table[node->get_instance()][(orb_id_size_t)node->id()].store(node);
 		}
 
 		group_tries++;
@@ -269,26 +269,43 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 {
 	bool print_active_only = true;
 	bool only_once = false; // if true, run only once, then exit
+	bool print_histograms = false;
 
 	if (topic_filter && num_filters > 0) {
 		bool show_all = false;
+		int num_options = 0;
 
 		for (int i = 0; i < num_filters; ++i) {
 			if (!strcmp("-a", topic_filter[i])) {
 				show_all = true;
+				++num_options;
 
 			} else if (!strcmp("-1", topic_filter[i])) {
 				only_once = true;
+				++num_options;
+
+			} else if (!strcmp("-l", topic_filter[i])) {
+				print_histograms = true;
+				++num_options;
 			}
 		}
 
-		print_active_only = only_once ? (num_filters == 1) : false; // print non-active if -a or some filter given
+		print_active_only = !show_all && (num_options == num_filters); // print non-active if -a or some filter given
 
 		if (show_all || print_active_only) {
 			num_filters = 0;
 		}
 	}
 
+#if !defined(CONFIG_ORB_PUBLISH_STATISTICS)
+
+	if (print_histograms) {
+		PX4_WARN("histograms require CONFIG_ORB_PUBLISH_STATISTICS");
+		print_histograms = false;
+	}
+
+#endif // !CONFIG_ORB_PUBLISH_STATISTICS
+
 	PX4_INFO_RAW("\033[2J\n"); //clear screen
 
 	lock();
@@ -385,6 +402,21 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 			PX4_INFO_RAW(CLEAR_LINE "update: 1s, topics: %i, total publications: %i, %.1f kB/s\n",
 				     num_topics, total_msgs, (double)(total_size / 1000.f));
 			PX4_INFO_RAW(CLEAR_LINE "%-*s INST #SUB RATE #Q SIZE\n", (int)max_topic_name_length - 2, "TOPIC NAME");
+
+#if defined(CONFIG_ORB_PUBLISH_STATISTICS)
+
+			if (print_histograms) {
+				PX4_INFO_RAW(CLEAR_LINE "  histogram buckets (us):");
+
+				for (int i = 0; i < DeviceNode::STATISTICS_BUCKETS - 1; ++i) {
+					PX4_INFO_RAW(" <%" PRIu32, DeviceNode::statistics_bucket_limit_us(i));
+				}
+
+				PX4_INFO_RAW(" more\n");
+			}
+
+#endif // CONFIG_ORB_PUBLISH_STATISTICS
+
 			cur_node = first_node;
 
 			while (cur_node) {
@@ -394,6 +426,29 @@ void uORB::DeviceMaster::showTop(char **topic_filter, int num_filters)
 						     cur_node->node->get_meta()->o_name, (int)cur_node->node->get_instance(),
 						     (int)cur_node->node->subscriber_count(), cur_node->pub_msg_delta,
 						     cur_node->node->get_queue_size(), cur_node->node->get_meta()->o_size);
+
+#if defined(CONFIG_ORB_PUBLISH_STATISTICS)
+
+					if (print_histograms) {
+						DeviceNode::PublishStatistics statistics;
+						cur_node->node->get_publish_statistics(statistics, true);
+
+						PX4_INFO_RAW(CLEAR_LINE "  interval:");
+
+						for (int i = 0; i < DeviceNode::STATISTICS_BUCKETS; ++i) {
+							PX4_INFO_RAW(" %" PRIu32, statistics.interval[i]);
+						}
+
+						PX4_INFO_RAW("\n" CLEAR_LINE "  latency: ");
+
+						for (int i = 0; i < DeviceNode::STATISTICS_BUCKETS; ++i) {
+							PX4_INFO_RAW(" %" PRIu32, statistics.latency[i]);
+						}
+
+						PX4_INFO_RAW("\n");
+					}
+
+#endif // CONFIG_ORB_PUBLISH_STATISTICS
 				}
 
 				cur_node = cur_node->next;
@@ -446,14 +501,3 @@ uORB::DeviceNode *uORB::DeviceMaster::getDeviceNode(const char *nodepath)
 
 	return nullptr;
 }
-
-uORB::DeviceNode *uORB::DeviceMaster::getDeviceNodeLocked(const struct orb_metadata *meta, const uint8_t instance)
-{
-	for (uORB::DeviceNode *node : _node_list) {
-		if ((strcmp(node->get_name(), meta->o_name) == 0) && (node->get_instance() == instance)) {
-			return node;
-		}
-	}
-
-	return nullptr;
-}
@@ -51,9 +51,7 @@ class Manager;
 #include <stdlib.h>
 
 #include <containers/IntrusiveSortedList.hpp>
-#include <px4_platform_common/atomic_bitset.h>
-
-using px4::AtomicBitset;
+#include <px4_platform_common/atomic.h>
 
 /**
  * Master control device for ObjDev.
@@ -68,39 +66,38 @@ public:
 	int advertise(const struct orb_metadata *meta, bool is_advertiser, int *instance);
 
 	/**
-	 * Public interface for getDeviceNodeLocked(). Takes care of synchronization.
+	 * Find a node by its path (slow, used for topics only known by name).
+	 * Takes care of synchronization.
 	 * @return node if exists, nullptr otherwise
 	 */
 	uORB::DeviceNode *getDeviceNode(const char *node_name);
+
+	/**
+	 * Constant time lookup of a node by topic and instance (lock-free).
+	 * @return node if exists, nullptr otherwise
+	 */
 	uORB::DeviceNode *getDeviceNode(const struct orb_metadata *meta, const uint8_t instance)
 	{
 		if (meta == nullptr) {
 			return nullptr;
 		}
 
-		if (!deviceNodeExists(static_cast<ORB_ID>(meta->o_id), instance)) {
-			return nullptr;
-		}
-
-		lock();
-		uORB::DeviceNode *node = getDeviceNodeLocked(meta, instance);
-		unlock();
-
 		//We can safely return the node that can be used by any thread, because
 		//a DeviceNode never gets deleted.
-		return node;
-
+		return getDeviceNode(static_cast<ORB_ID>(meta->o_id), instance);
 	}
 
-	bool deviceNodeExists(ORB_ID id, const uint8_t instance)
+	uORB::DeviceNode *getDeviceNode(ORB_ID id, const uint8_t instance)
 	{
 		if ((id == ORB_ID::INVALID) || (instance > ORB_MULTI_MAX_INSTANCES - 1)) {
-			return false;
+			return nullptr;
 		}
 
-		return _node_exists[instance][(orb_id_size_t)id];
+		return _node_table[instance][(orb_id_size_t)id].load();
 	}
 
+	bool deviceNodeExists(ORB_ID id, const uint8_t instance) { return getDeviceNode(id, instance) != nullptr; }
+
 	/**
 	 * Print statistics for each existing topic.
 	 */
@@ -132,15 +129,8 @@ private:
 
 	friend class uORB::Manager;
 
-	/**
-	 * Find a node give its name.
-	 * _lock must already be held when calling this.
-	 * @return node if exists, nullptr otherwise
-	 */
-	uORB::DeviceNode *getDeviceNodeLocked(const struct orb_metadata *meta, const uint8_t instance);
-
-	IntrusiveSortedList<uORB::DeviceNode *> _node_list;
-	AtomicBitset<ORB_TOPICS_COUNT> _node_exists[ORB_MULTI_MAX_INSTANCES];
+	IntrusiveSortedList<uORB::DeviceNode *> _node_list; /**< all nodes sorted by name, for iteration */
+	px4::atomic<uORB::DeviceNode *> _node_table[ORB_MULTI_MAX_INSTANCES][ORB_TOPICS_COUNT] {}; /**< nodes indexed by instance and ORB_ID */
 
 	px4_sem_t	_lock; /**< lock to protect access to all class members (also for derived classes) */
 
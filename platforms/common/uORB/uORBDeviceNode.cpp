@@ -38,6 +38,8 @@
 
 #include "SubscriptionCallback.hpp"
 
+#include <lib/perf/perf_trace.h>
+
 #ifdef CONFIG_ORB_COMMUNICATOR
 #include "uORBCommunicator.hpp"
 #endif /* CONFIG_ORB_COMMUNICATOR */
@@ -57,7 +59,15 @@ uORB::DeviceNode::DeviceNode(const struct orb_metadata *meta, const uint8_t inst
 
 uORB::DeviceNode::~DeviceNode()
 {
+#if defined(CONFIG_ORB_SHM)
+
+	if (_shm != nullptr) {
+		shm_destroy(_shm, _meta, _instance);
+	}
+
+#else
 	free(_data);
+#endif // CONFIG_ORB_SHM
 
 	const char *devname = get_devname();
 
@@ -155,19 +165,7 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 		if (!up_interrupt_context()) {
 #endif /* __PX4_NUTTX */
 
-			lock();
-
-			/* re-check size */
-			if (nullptr == _data) {
-				const size_t data_size = _meta->o_size * _meta->o_queue;
-				_data = (uint8_t *) px4_cache_aligned_alloc(data_size);
-
-				if (_data) {
-					memset(_data, 0, data_size);
-				}
-			}
-
-			unlock();
+			allocate_data(_meta->o_queue);
 
 #ifdef __PX4_NUTTX
 		}
@@ -185,12 +183,31 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 		return -EIO;
 	}
 
+#if defined(CONFIG_ORB_PUBLISH_STATISTICS)
+	const hrt_abstime now = hrt_absolute_time();
+#endif // CONFIG_ORB_PUBLISH_STATISTICS
+
 	/* Perform an atomic copy. */
 	ATOMIC_ENTER;
+
+	if (_loaned) {
+		// the single publisher of a loaned node is currently writing in place
+		ATOMIC_LEAVE;
+		return -EBUSY;
+	}
+
+	write_begin();
+
 	/* wrap-around happens after ~49 days, assuming a publisher rate of 1 kHz */
 	unsigned generation = _generation.fetch_add(1);
 
-	memcpy(_data + (_meta->o_size * (generation % _meta->o_queue)), buffer, _meta->o_size);
+	memcpy(slot(generation), buffer, _meta->o_size);
+
+	write_end();
+
+#if defined(CONFIG_ORB_PUBLISH_STATISTICS)
+	update_publish_statistics(slot(generation), now);
+#endif // CONFIG_ORB_PUBLISH_STATISTICS
 
 	// callbacks
 	for (auto item : _callbacks) {
@@ -202,12 +219,57 @@ uORB::DeviceNode::write(cdev::file_t *filp, const char *buffer, size_t buflen)
 
 	ATOMIC_LEAVE;
 
+#if defined(CONFIG_ORB_SHM)
+	shm_notify(_shm);
+#endif // CONFIG_ORB_SHM
+
 	/* notify any poll waiters */
 	poll_notify(POLLIN);
 
 	return _meta->o_size;
 }
 
+bool
+uORB::DeviceNode::allocate_data(uint8_t slots)
+{
+	lock();
+
+	/* re-check size */
+	if (nullptr == _data) {
+		// round up to a power of two for the slot index mask, o_queue already is one
+		uint8_t pow2_slots = 1;
+
+		while (pow2_slots < slots) {
+			pow2_slots <<= 1;
+		}
+
+		slots = pow2_slots;
+
+#if defined(CONFIG_ORB_SHM)
+		_shm = shm_create(_meta, _instance, slots);
+		uint8_t *data = (_shm != nullptr) ? shm_data(_shm) : nullptr;
+#else
+		const size_t data_size = _meta->o_size * slots;
+		uint8_t *data = (uint8_t *) px4_cache_aligned_alloc(data_size);
+
+		if (data) {
+			memset(data, 0, data_size);
+		}
+
+#endif // CONFIG_ORB_SHM
+
+		if (data) {
+			// _slots must be valid before _data is visible to lock-free readers
+			_slots = slots;
+			__atomic_store_n(&_data, data, __ATOMIC_RELEASE);
+		}
+	}
+
+	unlock();
+
+	return _data != nullptr;
+}
+
 int
 uORB::DeviceNode::ioctl(cdev::file_t *filp, int cmd, unsigned long arg)
 {
@@ -260,6 +322,8 @@ uORB::DeviceNode::publish(const orb_metadata *meta, orb_advert_t handle, const v
 		return PX4_ERROR;
 	}
 
+	perf_trace_instant(meta->o_name);
+
 	/* call the devnode write method with no file pointer */
 	ret = devnode->write(nullptr, (const char *)data, meta->o_size);
 
@@ -291,6 +355,156 @@ uORB::DeviceNode::publish(const orb_metadata *meta, orb_advert_t handle, const v
 	return PX4_OK;
 }
 
+void *
+uORB::DeviceNode::loan(orb_advert_t handle)
+{
+	uORB::DeviceNode *devnode = (uORB::DeviceNode *)handle;
+
+	if (devnode == nullptr) {
+		return nullptr;
+	}
+
+	return devnode->loan_slot();
+}
+
+ssize_t
+uORB::DeviceNode::commit(const orb_metadata *meta, orb_advert_t handle)
+{
+	uORB::DeviceNode *devnode = (uORB::DeviceNode *)handle;
+
+	if ((devnode == nullptr) || (meta == nullptr)) {
+		errno = EFAULT;
+		return PX4_ERROR;
+	}
+
+	/* check if the orb meta data matches the publication */
+	if (devnode->_meta->o_id != meta->o_id) {
+		errno = EINVAL;
+		return PX4_ERROR;
+	}
+
+	perf_trace_instant(meta->o_name);
+
+	const uint8_t *data = devnode->commit_slot();
+
+	if (data == nullptr) {
+		errno = EINVAL;
+		return PX4_ERROR;
+	}
+
+#ifdef CONFIG_ORB_COMMUNICATOR
+	uORBCommunicator::IChannel *ch = uORB::Manager::get_instance()->get_uorb_communicator();
+
+	if (ch != nullptr) {
+		if (ch->send_message(meta->o_name, meta->o_size, (uint8_t *)data) != 0) {
+			PX4_ERR("Error Sending [%s] topic data over comm_channel", meta->o_name);
+			return PX4_ERROR;
+		}
+	}
+
+#endif /* CONFIG_ORB_COMMUNICATOR */
+
+	return PX4_OK;
+}
+
+const void *
+uORB::DeviceNode::peek(unsigned &generation)
+{
+	if (_data == nullptr) {
+		return nullptr;
+	}
+
+	// no write can be in progress while selecting, later writes are detected by peek_valid()
+	ATOMIC_ENTER;
+	const void *peeked = select_slot(generation);
+	ATOMIC_LEAVE;
+
+	return peeked;
+}
+
+void *
+uORB::DeviceNode::loan_slot()
+{
+	if (nullptr == _data) {
+#ifdef __PX4_NUTTX
+
+		if (up_interrupt_context()) {
+			return nullptr;
+		}
+
+#endif /* __PX4_NUTTX */
+
+		// spare slot: the loaned slot never holds a message subscribers can still read
+		if (!allocate_data(_meta->o_queue + 1)) {
+			return nullptr;
+		}
+	}
+
+	if (_slots == _meta->o_queue) {
+		// already allocated by a regular publication
+		return nullptr;
+	}
+
+	void *loaned_slot = nullptr;
+
+	ATOMIC_ENTER;
+
+	if (!_loaned) {
+		_loaned = true;
+		loaned_slot = slot(_generation.load());
+	}
+
+	ATOMIC_LEAVE;
+
+	return loaned_slot;
+}
+
+const uint8_t *
+uORB::DeviceNode::commit_slot()
+{
+#if defined(CONFIG_ORB_PUBLISH_STATISTICS)
+	const hrt_abstime now = hrt_absolute_time();
+#endif // CONFIG_ORB_PUBLISH_STATISTICS
+
+	ATOMIC_ENTER;
+
+	if (!_loaned) {
+		ATOMIC_LEAVE;
+		return nullptr;
+	}
+
+	// the loaned slot becomes the latest message
+	const uint8_t *committed_slot = slot(_generation.fetch_add(1));
+
+	// the slot did not hold a readable message, no need for a sequence bump
+#if defined(CONFIG_ORB_SHM)
+	__atomic_store_n(&_shm->generation, _generation.load(), __ATOMIC_RELEASE);
+#endif // CONFIG_ORB_SHM
+
+#if defined(CONFIG_ORB_PUBLISH_STATISTICS)
+	update_publish_statistics(committed_slot, now);
+#endif // CONFIG_ORB_PUBLISH_STATISTICS
+
+	// callbacks
+	for (auto item : _callbacks) {
+		item->call();
+	}
+
+	_data_valid = true;
+	_loaned = false;
+
+	ATOMIC_LEAVE;
+
+#if defined(CONFIG_ORB_SHM)
+	shm_notify(_shm);
+#endif // CONFIG_ORB_SHM
+
+	/* notify any poll waiters */
+	poll_notify(POLLIN);
+
+	return committed_slot;
+}
+
 int uORB::DeviceNode::unadvertise(orb_advert_t handle)
 {
 	if (handle == nullptr) {
@@ -414,7 +628,7 @@ int16_t uORB::DeviceNode::process_add_subscription()
 	if (_data != nullptr && ch != nullptr) { // _data will not be null if there is a publisher.
 		// Only send the most recent data to initialize the remote end.
 		if (_data_valid) {
-			ch->send_message(_meta->o_name, _meta->o_size, _data + (_meta->o_size * ((_generation.load() - 1) % _meta->o_queue)));
+			ch->send_message(_meta->o_name, _meta->o_size, slot(_generation.load() - 1));
 		}
 	}
 
@@ -463,6 +677,21 @@ unsigned uORB::DeviceNode::get_initial_generation()
 	return generation;
 }
 
+#if defined(CONFIG_ORB_PUBLISH_STATISTICS)
+void
+uORB::DeviceNode::get_publish_statistics(PublishStatistics &statistics, bool reset)
+{
+	ATOMIC_ENTER;
+	statistics = _statistics;
+
+	if (reset) {
+		_statistics = {};
+	}
+
+	ATOMIC_LEAVE;
+}
+#endif // CONFIG_ORB_PUBLISH_STATISTICS
+
 bool
 uORB::DeviceNode::register_callback(uORB::SubscriptionCallback *callback_sub)
 {
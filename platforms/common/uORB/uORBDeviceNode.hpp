@@ -40,9 +40,14 @@
 
 #include <containers/IntrusiveSortedList.hpp>
 #include <containers/List.hpp>
+#include <drivers/drv_hrt.h>
 #include <px4_platform_common/atomic.h>
 #include <px4_platform_common/px4_config.h>
 
+#if defined(CONFIG_ORB_SHM)
+#include "uORBShm.hpp"
+#endif // CONFIG_ORB_SHM
+
 namespace uORB
 {
 class DeviceNode;
@@ -123,6 +128,39 @@ public:
 
 	static int        unadvertise(orb_advert_t handle);
 
+	/**
+	 * Loan the next queue slot of this node for in-place writing by a single publisher.
+	 * The slot is invisible to subscribers until it is published with commit().
+	 * The slot contains stale data, all fields need to be written.
+	 * @return pointer to the slot, nullptr if the node is already loaned or was allocated without a spare slot.
+	 */
+	static void      *loan(orb_advert_t handle);
+
+	/**
+	 * Publish a slot previously obtained with loan().
+	 */
+	static ssize_t    commit(const orb_metadata *meta, orb_advert_t handle);
+
+	/**
+	 * Get a pointer to the message for 'generation' directly in the queue (zero-copy) and advance it.
+	 * The message can be overwritten by the publisher at any time, use peek_valid() when done with it.
+	 */
+	const void *peek(unsigned &generation);
+
+	/**
+	 * Check if a message returned by peek() is still intact, i.e. no publisher has reached its slot since.
+	 * @param generation The generation returned by peek()
+	 */
+	bool peek_valid(unsigned generation) const
+	{
+		// all data reads must complete before checking the generation
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+		// write() bumps the generation before it copies, a loan writes the slot of the current generation
+		const unsigned limit = (_slots > _meta->o_queue) ? _slots : _slots + 1;
+		return (_generation.load() - (generation - 1)) < limit;
+	}
+
 #ifdef CONFIG_ORB_COMMUNICATOR
 	/**
 	 * processes a request for topic advertisement from remote
@@ -219,49 +257,68 @@ public:
 	 *   The buffer into which the data is copied.
 	 * @param generation
 	 *   The generation that was copied.
+	 * @tparam SIZE
+	 *   The message size if known at compile time (constant-size copy), 0 for the runtime o_size.
 	 * @return bool
 	 *   Returns true if the data was copied.
 	 */
+	template<size_t SIZE = 0>
 	bool copy(void *dst, unsigned &generation)
 	{
 		if ((dst != nullptr) && (_data != nullptr)) {
-			if (_meta->o_queue == 1) {
-				ATOMIC_ENTER;
-				memcpy(dst, _data, _meta->o_size);
-				generation = _generation.load();
-				ATOMIC_LEAVE;
-				return true;
-
-			} else {
-				ATOMIC_ENTER;
-				const unsigned current_generation = _generation.load();
-
-				if (current_generation == generation) {
-					/* The subscriber already read the latest message, but nothing new was published yet.
-					* Return the previous message
-					*/
-					--generation;
-				}
+#if defined(CONFIG_ORB_SEQLOCK)
 
-				// Compatible with normal and overflow conditions
-				if (!is_in_range(current_generation - _meta->o_queue, generation, current_generation - 1)) {
-					// Reader is too far behind: some messages are lost
-					generation = current_generation - _meta->o_queue;
-				}
+			// lock-free read: retry if a publisher was writing while we copied
+			for (unsigned retry = 0; retry < SEQLOCK_COPY_RETRIES; retry++) {
+				const unsigned seq = _seq.load();
 
-				memcpy(dst, _data + (_meta->o_size * (generation % _meta->o_queue)), _meta->o_size);
-				ATOMIC_LEAVE;
+				if ((seq & 1) == 0) {
+					unsigned copy_generation = generation;
+					copy_unlocked<SIZE>(dst, copy_generation);
 
-				++generation;
+					// data reads must complete before the sequence is checked again
+					__atomic_thread_fence(__ATOMIC_ACQUIRE);
 
-				return true;
+					if (_seq.load() == seq) {
+						generation = copy_generation;
+						return true;
+					}
+				}
 			}
+
+			// publisher kept interfering (or was preempted mid-write), fall back to the locked copy
+#endif // CONFIG_ORB_SEQLOCK
+
+			ATOMIC_ENTER;
+			copy_unlocked<SIZE>(dst, generation);
+			ATOMIC_LEAVE;
+
+			return true;
 		}
 
 		return false;
-
 	}
 
+#if defined(CONFIG_ORB_PUBLISH_STATISTICS)
+	static constexpr int STATISTICS_BUCKETS = 12;
+
+	/**
+	 * Log2 histograms, bucket i counts values below statistics_bucket_limit_us(i), the last one all others.
+	 */
+	struct PublishStatistics {
+		uint32_t interval[STATISTICS_BUCKETS]; ///< time between publications
+		uint32_t latency[STATISTICS_BUCKETS];  ///< publication time relative to the message timestamp
+	};
+
+	static constexpr uint32_t statistics_bucket_limit_us(int bucket) { return 64u << bucket; }
+
+	/**
+	 * Copy the publication histograms.
+	 * @param reset clear the histograms after copying
+	 */
+	void get_publish_statistics(PublishStatistics &statistics, bool reset);
+#endif // CONFIG_ORB_PUBLISH_STATISTICS
+
 	// add item to list of work items to schedule on node update
 	bool register_callback(SubscriptionCallback *callback_sub);
 
@@ -280,6 +337,8 @@ private:
 	const orb_metadata *_meta; /**< object metadata information */
 
 	uint8_t *_data{nullptr};   /**< allocated object buffer */
+	uint8_t _slots{0};         /**< number of allocated queue slots (power of two), more than o_queue if loaning is supported */
+	bool _loaned{false};       /**< a publisher currently holds a loaned slot */
 	bool _data_valid{false}; /**< At least one valid data */
 	px4::atomic<unsigned>  _generation{0};  /**< object generation count */
 	List<uORB::SubscriptionCallback *>	_callbacks;
@@ -289,6 +348,141 @@ private:
 
 	int8_t _subscriber_count{0};
 
+#if defined(CONFIG_ORB_SEQLOCK)
+	static constexpr unsigned SEQLOCK_COPY_RETRIES = 3;
+
+	px4::atomic<unsigned> _seq{0}; /**< seqlock sequence, odd while a publisher is writing */
+#endif // CONFIG_ORB_SEQLOCK
+
+#if defined(CONFIG_ORB_SHM)
+	ShmHeader *_shm{nullptr}; /**< shared memory segment holding _data */
+#endif // CONFIG_ORB_SHM
+
+#if defined(CONFIG_ORB_PUBLISH_STATISTICS)
+	PublishStatistics _statistics {};
+	hrt_abstime _last_publish_time{0};
+
+	static int statistics_bucket(uint64_t value_us)
+	{
+		if (value_us < statistics_bucket_limit_us(0)) {
+			return 0;
+		}
+
+		const uint32_t value = (value_us > UINT32_MAX) ? UINT32_MAX : value_us;
+		const int bucket = (31 - __builtin_clz(value)) - 5; // 64 us -> 1
+		return (bucket < STATISTICS_BUCKETS) ? bucket : STATISTICS_BUCKETS - 1;
+	}
+
+	/**
+	 * Must be called with ATOMIC_ENTER held.
+	 * @param message the published message, starting with its timestamp
+	 */
+	void update_publish_statistics(const uint8_t *message, hrt_abstime now)
+	{
+		if (_last_publish_time != 0) {
+			_statistics.interval[statistics_bucket(now - _last_publish_time)]++;
+		}
+
+		_last_publish_time = now;
+
+		// every message starts with its uint64_t timestamp
+		uint64_t timestamp;
+		memcpy(&timestamp, message, sizeof(timestamp));
+
+		if ((timestamp != 0) && (timestamp <= now)) {
+			_statistics.latency[statistics_bucket(now - timestamp)]++;
+		}
+	}
+#endif // CONFIG_ORB_PUBLISH_STATISTICS
+
+	/**
+	 * Mark the start of a write into the queue for lock-free readers (in and out of process).
+	 * Must be called with ATOMIC_ENTER held.
+	 */
+	void write_begin()
+	{
+#if defined(CONFIG_ORB_SEQLOCK)
+		// odd sequence: write in progress, lock-free readers will retry
+		_seq.fetch_add(1);
+#endif // CONFIG_ORB_SEQLOCK
+
+#if defined(CONFIG_ORB_SHM)
+		__atomic_fetch_add(&_shm->seq, 1, __ATOMIC_SEQ_CST);
+#endif // CONFIG_ORB_SHM
+
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+	}
+
+	void write_end()
+	{
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+
+#if defined(CONFIG_ORB_SHM)
+		__atomic_store_n(&_shm->generation, _generation.load(), __ATOMIC_RELEASE);
+		__atomic_fetch_add(&_shm->seq, 1, __ATOMIC_SEQ_CST);
+#endif // CONFIG_ORB_SHM
+
+#if defined(CONFIG_ORB_SEQLOCK)
+		_seq.fetch_add(1);
+#endif // CONFIG_ORB_SEQLOCK
+	}
+
+	/**
+	 * Copy the message for 'generation' and advance it, without any locking.
+	 * The caller is responsible for protecting against concurrent writes.
+	 */
+	template<size_t SIZE = 0>
+	void copy_unlocked(void *dst, unsigned &generation)
+	{
+		memcpy(dst, select_slot(generation), (SIZE > 0) ? SIZE : _meta->o_size);
+	}
+
+	/**
+	 * Select the queue slot to read for 'generation' and advance it.
+	 */
+	const uint8_t *select_slot(unsigned &generation) const
+	{
+		if (_meta->o_queue == 1) {
+			generation = _generation.load();
+			return slot(generation - 1);
+
+		} else {
+			const unsigned current_generation = _generation.load();
+
+			if (current_generation == generation) {
+				/* The subscriber already read the latest message, but nothing new was published yet.
+				* Return the previous message
+				*/
+				--generation;
+			}
+
+			// Compatible with normal and overflow conditions
+			if (!is_in_range(current_generation - _meta->o_queue, generation, current_generation - 1)) {
+				// Reader is too far behind: some messages are lost
+				generation = current_generation - _meta->o_queue;
+			}
+
+			return slot(generation++);
+		}
+	}
+
+	// _slots is a power of two (also keeps the index continuous on generation wrap-around)
+	uint8_t *slot(unsigned generation) const { return _data + (_meta->o_size * (generation & (_slots - 1))); }
+
+	/**
+	 * Allocate the message buffer (thread context only).
+	 * @param slots number of queue slots, o_queue or o_queue + 1 to allow loaning
+	 */
+	bool allocate_data(uint8_t slots);
+
+	void *loan_slot();
+
+	/**
+	 * Publish the loaned slot.
+	 * @return the committed slot, nullptr if nothing was loaned
+	 */
+	const uint8_t *commit_slot();
+
 
 // Determine the data range
 	static inline bool is_in_range(unsigned left, unsigned value, unsigned right)
@@ -279,6 +279,28 @@ public:
 	 */
 	static int  orb_publish(const struct orb_metadata *meta, orb_advert_t handle, const void *data);
 
+	/**
+	 * Loan the next message slot of a topic for in-place writing (zero-copy publish).
+	 *
+	 * Only valid for topics with a single publisher. Regular publications to the
+	 * same instance fail while the slot is loaned. The slot contains stale data.
+	 *
+	 * @param handle  The handle returned from orb_advertise.
+	 * @return    pointer to the slot, or nullptr if loaning is not available
+	 *      (e.g. the topic was already published with orb_publish, or NuttX protected build).
+	 */
+	static void *orb_loan(orb_advert_t handle);
+
+	/**
+	 * Publish a message slot previously obtained with orb_loan().
+	 *
+	 * @param meta    The uORB metadata (usually from the ORB_ID() macro)
+	 *      for the topic.
+	 * @handle    The handle returned from orb_advertise.
+	 * @return    OK on success, PX4_ERROR otherwise with errno set accordingly.
+	 */
+	static int  orb_commit(const struct orb_metadata *meta, orb_advert_t handle);
+
 	/**
 	 * Subscribe to a topic.
 	 *
@@ -442,6 +464,48 @@ public:
 
 	static bool orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated);
 
+	/**
+	 * orb_data_copy() with a message size known at compile time (constant-size copy).
+	 * @tparam SIZE the o_size of the topic, 0 for the runtime size
+	 */
+	template<size_t SIZE>
+	static bool orb_data_copy(void *node_handle, void *dst, unsigned &generation, bool only_if_updated)
+	{
+#if defined(__PX4_NUTTX) && !defined(CONFIG_BUILD_FLAT) && !defined(__KERNEL__)
+		// userspace of the protected build, the copy happens in the kernel
+		return orb_data_copy(node_handle, dst, generation, only_if_updated);
+#else
+
+		if (!is_advertised(node_handle)) {
+			return false;
+		}
+
+		DeviceNode *node = static_cast<DeviceNode *>(node_handle);
+
+		if (only_if_updated && !node->updates_available(generation)) {
+			return false;
+		}
+
+		if (SIZE != node->get_meta()->o_size) {
+			// not the struct of this topic
+			return node->copy(dst, generation);
+		}
+
+		return node->copy<SIZE>(dst, generation);
+#endif
+	}
+
+	/**
+	 * Zero-copy access to the next unread message, nullptr if there is none (or in NuttX protected build).
+	 * The message must be validated with orb_data_release() after use.
+	 */
+	static const void *orb_data_peek(void *node_handle, unsigned &generation);
+
+	/**
+	 * @return true if the message returned by orb_data_peek() was not overwritten in the meantime.
+	 */
+	static bool orb_data_release(const void *node_handle, unsigned generation);
+
 	static bool register_callback(void *node_handle, SubscriptionCallback *callback_sub);
 
 	static void unregister_callback(void *node_handle, SubscriptionCallback *callback_sub);
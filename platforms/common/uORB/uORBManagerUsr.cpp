@@ -147,6 +147,18 @@ int uORB::Manager::orb_unsubscribe(int fd)
 	return px4_close(fd);
 }
 
+void *uORB::Manager::orb_loan(orb_advert_t handle)
+{
+	// topic buffers live in kernel memory
+	return nullptr;
+}
+
+int uORB::Manager::orb_commit(const struct orb_metadata *meta, orb_advert_t handle)
+{
+	errno = ENOTSUP;
+	return PX4_ERROR;
+}
+
 int uORB::Manager::orb_publish(const struct orb_metadata *meta, orb_advert_t handle, const void *data)
 {
 	orbiocdevpublish_t d = {meta, handle, data, PX4_ERROR};
@@ -302,6 +314,17 @@ bool uORB::Manager::orb_data_copy(void *node_handle, void *dst, unsigned &genera
 	return data.ret;
 }
 
+const void *uORB::Manager::orb_data_peek(void *node_handle, unsigned &generation)
+{
+	// topic buffers live in kernel memory
+	return nullptr;
+}
+
+bool uORB::Manager::orb_data_release(const void *node_handle, unsigned generation)
+{
+	return false;
+}
+
 bool uORB::Manager::register_callback(void *node_handle, SubscriptionCallback *callback_sub)
 {
 	orbiocdevregcallback_t data = {node_handle, callback_sub, false};
@@ -0,0 +1,97 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "uORBShm.hpp"
+#include "uORBCommon.hpp"
+
+#include <px4_platform_common/log.h>
+
+uORB::ShmHeader *uORB::shm_create(const orb_metadata *meta, uint8_t instance, uint8_t slots)
+{
+	char name[orb_maxpath];
+
+	if (shm_mkname(name, sizeof(name), meta->o_name, instance) != 0) {
+		return nullptr;
+	}
+
+	// start from a fresh segment, external subscribers of a previous run need to resubscribe
+	shm_unlink(name);
+
+	const int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0666);
+
+	if (fd < 0) {
+		PX4_ERR("shm_open %s failed (%i)", name, errno);
+		return nullptr;
+	}
+
+	const size_t size = shm_segment_size(meta->o_size, slots);
+
+	if (ftruncate(fd, size) != 0) {
+		PX4_ERR("ftruncate %s failed (%i)", name, errno);
+		close(fd);
+		shm_unlink(name);
+		return nullptr;
+	}
+
+	void *addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (addr == MAP_FAILED) {
+		PX4_ERR("mmap %s failed (%i)", name, errno);
+		shm_unlink(name);
+		return nullptr;
+	}
+
+	// a new segment is zero filled
+	ShmHeader *header = static_cast<ShmHeader *>(addr);
+	header->message_hash = meta->message_hash;
+	header->o_size = meta->o_size;
+	header->o_queue = meta->o_queue;
+	header->slots = slots;
+
+	// subscribers only trust the header once the magic is visible
+	__atomic_store_n(&header->magic, SHM_MAGIC, __ATOMIC_RELEASE);
+
+	return header;
+}
+
+void uORB::shm_destroy(ShmHeader *header, const orb_metadata *meta, uint8_t instance)
+{
+	munmap(header, shm_segment_size(header->o_size, header->slots));
+
+	char name[orb_maxpath];
+
+	if (shm_mkname(name, sizeof(name), meta->o_name, instance) == 0) {
+		shm_unlink(name);
+	}
+}
@@ -0,0 +1,322 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file uORBShm.hpp
+ *
+ * Shared memory layout of topic buffers (CONFIG_ORB_SHM) and a subscriber
+ * for processes outside of px4. Only depends on libc, so it can be used by
+ * external applications together with the generated topic headers.
+ */
+
+#pragma once
+
+#include <uORB/uORB.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace uORB
+{
+
+static constexpr uint32_t SHM_MAGIC = 0x4f345850; // "PX4O"
+static constexpr size_t SHM_HEADER_SIZE = 64; // topic data starts cache line aligned
+
+/**
+ * Header at the start of every shared topic segment, followed by 'slots' messages of 'o_size' bytes.
+ * All counters are accessed with atomic builtins only.
+ */
+struct ShmHeader {
+	uint32_t magic;
+	uint32_t message_hash;
+	uint16_t o_size;
+	uint8_t o_queue;
+	uint8_t slots;
+	uint32_t seq;        ///< odd while the publisher is writing
+	uint32_t generation; ///< number of published messages, futex word for notification
+	uint32_t waiters;    ///< number of processes blocked on 'generation'
+};
+
+static_assert(sizeof(ShmHeader) <= SHM_HEADER_SIZE, "ShmHeader too large");
+
+static inline int shm_mkname(char *buf, size_t len, const char *topic_name, uint8_t instance)
+{
+	const int ret = snprintf(buf, len, "/px4_orb_%s%d", topic_name, instance);
+	return (ret > 0 && (size_t)ret < len) ? 0 : -ENAMETOOLONG;
+}
+
+static inline uint8_t *shm_data(ShmHeader *header) { return reinterpret_cast<uint8_t *>(header) + SHM_HEADER_SIZE; }
+
+static inline size_t shm_segment_size(uint16_t o_size, uint8_t slots) { return SHM_HEADER_SIZE + (size_t)o_size * slots; }
+
+/**
+ * Wake up all processes waiting for an update, only costs a syscall if somebody is waiting.
+ */
+static inline void shm_notify(ShmHeader *header)
+{
+#if defined(__linux__)
+
+	if (__atomic_load_n(&header->waiters, __ATOMIC_SEQ_CST) > 0) {
+		syscall(SYS_futex, &header->generation, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+	}
+
+#endif
+}
+
+/**
+ * Create (or recreate) the shared segment of a topic instance, used by DeviceNode in px4.
+ * @return the initialized header, nullptr on failure
+ */
+ShmHeader *shm_create(const orb_metadata *meta, uint8_t instance, uint8_t slots);
+
+void shm_destroy(ShmHeader *header, const orb_metadata *meta, uint8_t instance);
+
+/**
+ * Subscription to a px4 topic from another process.
+ *
+ * Mirrors the semantics of uORB::Subscription (updated/update/copy and the zero-copy peek/release).
+ * Reads are lock-free, a read that overlaps a publication is retried.
+ */
+class ShmSubscription
+{
+public:
+	ShmSubscription(const orb_metadata *meta, uint8_t instance = 0) : _meta(meta), _instance(instance) {}
+
+	~ShmSubscription() { unsubscribe(); }
+
+	ShmSubscription(const ShmSubscription &) = delete;
+	ShmSubscription &operator=(const ShmSubscription &) = delete;
+
+	/**
+	 * Map the topic segment, fails until px4 published the topic at least once.
+	 */
+	bool subscribe()
+	{
+		if (_header != nullptr) {
+			return true;
+		}
+
+		char name[NAME_MAX];
+
+		if ((_meta == nullptr) || (shm_mkname(name, sizeof(name), _meta->o_name, _instance) != 0)) {
+			return false;
+		}
+
+		// writable, waiting for updates registers in the header
+		const int fd = shm_open(name, O_RDWR, 0);
+
+		if (fd < 0) {
+			return false;
+		}
+
+		ShmHeader header{};
+
+		if (pread(fd, &header, sizeof(header), 0) != sizeof(header)
+		    || header.magic != SHM_MAGIC || header.message_hash != _meta->message_hash || header.o_size != _meta->o_size) {
+			// not initialized yet or message definition mismatch
+			close(fd);
+			return false;
+		}
+
+		_size = shm_segment_size(header.o_size, header.slots);
+		void *addr = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		close(fd);
+
+		if (addr == MAP_FAILED) {
+			return false;
+		}
+
+		_header = static_cast<ShmHeader *>(addr);
+		// like uORB::Subscription: a previous publication counts as an update
+		const unsigned current_generation = generation();
+		_last_generation = (current_generation > 0) ? current_generation - 1 : 0;
+		return true;
+	}
+
+	void unsubscribe()
+	{
+		if (_header != nullptr) {
+			munmap(_header, _size);
+			_header = nullptr;
+		}
+	}
+
+	bool updated() { return subscribe() && (generation() != _last_generation); }
+
+	bool update(void *dst) { return updated() && copy(dst); }
+
+	bool copy(void *dst)
+	{
+		if (!subscribe()) {
+			return false;
+		}
+
+		// bounded, the publisher might have died in the middle of a write
+		for (int retry = 0; retry < 1000; retry++) {
+			const uint32_t seq = __atomic_load_n(&_header->seq, __ATOMIC_ACQUIRE);
+
+			if ((seq & 1) == 0) {
+				unsigned generation = _last_generation;
+				memcpy(dst, select_slot(generation), _header->o_size);
+				__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+				if (__atomic_load_n(&_header->seq, __ATOMIC_RELAXED) == seq) {
+					_last_generation = generation;
+					return true;
+				}
+			}
+
+			sched_yield();
+		}
+
+		return false;
+	}
+
+	/**
+	 * Zero-copy access to the next unread message, must be followed by release().
+	 */
+	const void *peek()
+	{
+		if (!updated()) {
+			return nullptr;
+		}
+
+		for (int retry = 0; retry < 1000; retry++) {
+			_peek_seq = __atomic_load_n(&_header->seq, __ATOMIC_ACQUIRE);
+
+			if ((_peek_seq & 1) == 0) {
+				return select_slot(_last_generation);
+			}
+
+			sched_yield();
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * @return false if the message returned by peek() was overwritten while in use and must be discarded.
+	 */
+	bool release() const
+	{
+		if (_header == nullptr) {
+			return false;
+		}
+
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+		if (__atomic_load_n(&_header->seq, __ATOMIC_RELAXED) == _peek_seq) {
+			// nothing was written since
+			return true;
+		}
+
+		// a write in progress targets the slot of the current generation
+		return (generation() - (_last_generation - 1)) < _header->slots;
+	}
+
+	/**
+	 * Block until there is an update or the timeout expires.
+	 * @return true if updated
+	 */
+	bool wait(int timeout_ms)
+	{
+		if (updated()) {
+			return true;
+		}
+
+		if (_header == nullptr) {
+			return false;
+		}
+
+#if defined(__linux__)
+		timespec timeout{timeout_ms / 1000, (timeout_ms % 1000) * 1000000L};
+		__atomic_fetch_add(&_header->waiters, 1, __ATOMIC_SEQ_CST);
+		syscall(SYS_futex, &_header->generation, FUTEX_WAIT, _last_generation, &timeout, nullptr, 0);
+		__atomic_fetch_sub(&_header->waiters, 1, __ATOMIC_SEQ_CST);
+#else
+		usleep(timeout_ms * 1000);
+#endif
+
+		return updated();
+	}
+
+	uint8_t get_instance() const { return _instance; }
+	unsigned get_last_generation() const { return _last_generation; }
+
+private:
+	unsigned generation() const { return __atomic_load_n(&_header->generation, __ATOMIC_ACQUIRE); }
+
+	const uint8_t *slot(unsigned generation) const { return shm_data(_header) + (size_t)_header->o_size * (generation % _header->slots); }
+
+	const uint8_t *select_slot(unsigned &generation) const
+	{
+		const unsigned current_generation = this->generation();
+
+		if (_header->o_queue == 1) {
+			generation = current_generation;
+			return slot(generation - 1);
+		}
+
+		if (current_generation == generation) {
+			--generation;
+		}
+
+		// reader too far behind: skip lost messages
+		if (current_generation - generation > _header->o_queue) {
+			generation = current_generation - _header->o_queue;
+		}
+
+		return slot(generation++);
+	}
+
+	const orb_metadata *_meta{nullptr};
+	ShmHeader *_header{nullptr};
+	size_t _size{0};
+	unsigned _last_generation{0};
+	uint32_t _peek_seq{0};
+	const uint8_t _instance{0};
+};
+
+} // namespace uORB
@@ -39,7 +39,9 @@
 #include <errno.h>
 #include <math.h>
 #include <lib/cdev/CDev.hpp>
+#include <uORB/Publication.hpp>
 #include <uORB/PublicationMulti.hpp>
+#include <uORB/Subscription.hpp>
 #include <uORB/SubscriptionMultiArray.hpp>
 
 uORBTest::UnitTest &uORBTest::UnitTest::instance()
@@ -213,6 +215,12 @@ int uORBTest::UnitTest::test()
 		return ret;
 	}
 
+	ret = test_loan();
+
+	if (ret != OK) {
+		return ret;
+	}
+
 	return test_queue_poll_notify();
 }
 
@@ -821,6 +829,70 @@ int uORBTest::UnitTest::test_SubscriptionMulti()
 	return test_note("PASS orb SubscriptionMulti");
 }
 
+int uORBTest::UnitTest::test_loan()
+{
+	test_note("Testing zero-copy loan and peek");
+
+	uORB::Publication<orb_test_large_s> orb_test_large_pub{ORB_ID(orb_test_large)};
+	uORB::Subscription orb_test_large_sub{ORB_ID(orb_test_large)};
+
+	for (int i = 0; i < 10; i++) {
+		orb_test_large_s *loaned = orb_test_large_pub.loan();
+
+		if (loaned == nullptr) {
+			return test_fail("loan %d failed", i);
+		}
+
+		if (orb_test_large_pub.loan() != nullptr) {
+			return test_fail("loaned twice");
+		}
+
+		loaned->timestamp = hrt_absolute_time();
+		loaned->val = i;
+
+		if (!orb_test_large_pub.commit()) {
+			return test_fail("commit %d failed", i);
+		}
+
+		const orb_test_large_s *peeked = static_cast<const orb_test_large_s *>(orb_test_large_sub.peek());
+
+		if (peeked == nullptr) {
+			return test_fail("peek %d failed", i);
+		}
+
+		if (peeked->val != i) {
+			return test_fail("peek mismatch: %d expected %d", peeked->val, i);
+		}
+
+		if (!orb_test_large_sub.release()) {
+			return test_fail("release %d reported overwritten message", i);
+		}
+
+		if (orb_test_large_sub.peek() != nullptr) {
+			return test_fail("spurious update");
+		}
+	}
+
+	// a publisher reaching the peeked slot must invalidate it
+	orb_test_large_pub.loan()->val = 100;
+	orb_test_large_pub.commit();
+
+	if (orb_test_large_sub.peek() == nullptr) {
+		return test_fail("peek failed");
+	}
+
+	for (int i = 0; i < 2; i++) {
+		orb_test_large_pub.loan()->val = 101 + i;
+		orb_test_large_pub.commit();
+	}
+
+	if (orb_test_large_sub.release()) {
+		return test_fail("release missed overwritten message");
+	}
+
+	return test_note("PASS zero-copy loan and peek");
+}
+
 int uORBTest::UnitTest::test_queue()
 {
 	test_note("Testing orb queuing");
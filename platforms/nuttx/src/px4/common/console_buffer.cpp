@@ -35,7 +35,9 @@
 #include <px4_platform_common/console_buffer.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/sem.h>
+#include <lib/ringbuffer/LockFreeRingbuffer.hpp>
 #include <pthread.h>
+#include <stdio.h>
 #include <string.h>
 #include <fcntl.h>
 
@@ -47,6 +49,13 @@
 static ssize_t console_buffer_write(struct file *filep, const char *buffer, size_t buflen);
 
 
+/**
+ * Console history shared by all readers (dmesg, logger, ...).
+ *
+ * Writers never block: they only try to take the lock. If it is held (typically by a lower priority
+ * reader), the data is queued in a lock-free staging buffer instead, and moved into the history by the
+ * next writer or reader that gets the lock. If the staging buffer is full, the data is truncated.
+ */
 class ConsoleBuffer
 {
 public:
@@ -63,10 +72,24 @@ private:
 	void		lock() { do {} while (px4_sem_wait(&_lock) != 0); }
 	void		unlock() { px4_sem_post(&_lock); }
 
+	/** move the staged data into the buffer, lock must be held */
+	void		drain_staging();
+
+	/** append to the buffer, lock must be held */
+	void		write_locked(const char *buffer, size_t len);
+
 	char _buffer[BOARD_CONSOLE_BUFFER_SIZE];
 	int _head{0};
 	int _tail{0};
 	px4_sem_t _lock = SEM_INITIALIZER(1);
+
+	struct StagingChunk {
+		uint8_t length;
+		char data[31];
+	};
+
+	MpscRingbuffer<StagingChunk, 16> _staging{}; ///< written while the lock is taken, consumed with the lock held
+	uint32_t _staging_dropped{0}; ///< number of bytes truncated because the staging buffer was full
 };
 
 void ConsoleBuffer::print(bool follow)
@@ -108,8 +131,63 @@ void ConsoleBuffer::print(bool follow)
 
 void ConsoleBuffer::write(const char *buffer, size_t len)
 {
-	lock(); // same rule as for printf: this cannot be used from IRQ handlers
+	// same rule as for printf: this cannot be used from IRQ handlers
+	if (px4_sem_trywait(&_lock) == 0) {
+		drain_staging();
+		write_locked(buffer, len);
+		unlock();
+		return;
+	}
+
+	// the lock is held: queue the data without blocking, in batches to keep the stack usage low
+	StagingChunk chunks[4];
+
+	while (len > 0) {
+		size_t num_chunks = 0;
 
+		while (len > 0 && num_chunks < sizeof(chunks) / sizeof(chunks[0])) {
+			const size_t chunk_len = (len < sizeof(chunks[0].data)) ? len : sizeof(chunks[0].data);
+			chunks[num_chunks].length = chunk_len;
+			memcpy(chunks[num_chunks].data, buffer, chunk_len);
+			buffer += chunk_len;
+			len -= chunk_len;
+			num_chunks++;
+		}
+
+		const size_t pushed = _staging.push(chunks, num_chunks);
+
+		if (pushed < num_chunks) {
+			size_t dropped = len;
+
+			for (size_t i = pushed; i < num_chunks; i++) {
+				dropped += chunks[i].length;
+			}
+
+			__atomic_fetch_add(&_staging_dropped, dropped, __ATOMIC_RELAXED);
+			return;
+		}
+	}
+}
+
+void ConsoleBuffer::drain_staging()
+{
+	StagingChunk chunk;
+
+	while (_staging.pop(chunk)) {
+		write_locked(chunk.data, chunk.length);
+	}
+
+	const uint32_t dropped = __atomic_exchange_n(&_staging_dropped, 0, __ATOMIC_RELAXED);
+
+	if (dropped > 0) {
+		char message[48];
+		const int length = snprintf(message, sizeof(message), "\n[console: %u bytes dropped]\n", (unsigned)dropped);
+		write_locked(message, length);
+	}
+}
+
+void ConsoleBuffer::write_locked(const char *buffer, size_t len)
+{
 	for (size_t i = 0; i < len; ++i) {
 		_buffer[_tail] = buffer[i];
 		_tail = (_tail + 1) % BOARD_CONSOLE_BUFFER_SIZE;
@@ -118,13 +196,12 @@ void ConsoleBuffer::write(const char *buffer, size_t len)
 			_head = (_head + 1) % BOARD_CONSOLE_BUFFER_SIZE;
 		}
 	}
-
-	unlock();
 }
 
 int ConsoleBuffer::size()
 {
 	lock();
+	drain_staging();
 	int size;
 
 	if (_head <= _tail) {
@@ -141,6 +218,7 @@ int ConsoleBuffer::size()
 int ConsoleBuffer::read(char *buffer, int buffer_length, int *offset)
 {
 	lock();
+	drain_staging();
 
 	if (*offset == -1) {
 		*offset = _head;
@@ -37,6 +37,7 @@
  ************************************************************************************/
 
 #include <nuttx/config.h>
+#include <px4_boardconfig.h>
 
 #include <time.h>
 #include <fixedmath.h>
@@ -77,3 +78,31 @@ void up_critmon_convert(uint32_t elapsed, FAR struct timespec *ts)
 }
 
 #endif /* CONFIG_SCHED_CRITMONITOR */
+
+#if defined(CONFIG_PERF_DWT_CYCLE_COUNTER)
+
+#include <px4_platform/cycle_counter.h>
+
+#include "nvic.h"
+
+/************************************************************************************
+ * Name: px4_arch_cycle_counter_init
+ ************************************************************************************/
+
+void px4_arch_cycle_counter_init(void)
+{
+	modifyreg32(NVIC_DEMCR, 0, NVIC_DEMCR_TRCENA);
+	putreg32(0xc5acce55, 0xe0001fb0); /* DWT_LAR: unlock the DWT (Cortex-M7), ignored otherwise */
+	modifyreg32(DWT_CTRL, 0, DWT_CTRL_CYCCNTENA_MASK);
+}
+
+/************************************************************************************
+ * Name: px4_arch_cycle_counter_frequency
+ ************************************************************************************/
+
+uint32_t px4_arch_cycle_counter_frequency(void)
+{
+	return BOARD_CPU_FREQUENCY;
+}
+
+#endif /* CONFIG_PERF_DWT_CYCLE_COUNTER */
@@ -45,6 +45,7 @@
 #include <drivers/drv_dshot.h>
 
 #include <px4_platform_common/log.h>
+#include <assert.h>
 #include <stdio.h>
 #include <drivers/drv_input_capture.h>
 
@@ -122,6 +123,9 @@ static uint32_t *dshot_output_buffer[MAX_IO_TIMERS] = {};
 static uint16_t dshot_capture_buffer[MAX_NUM_CHANNELS_PER_TIMER][CHANNEL_CAPTURE_BUFF_SIZE]
 px4_cache_aligned_data() = {};
 
+// each channel is cleaned and invalidated separately, its buffer must span whole cache lines
+static_assert(sizeof(dshot_capture_buffer[0]) == DSHOT_CAPTURE_BUFFER_SIZE(1), "capture buffer not cache line aligned");
+
 static bool     _bidirectional = false;
 static uint8_t  _bidi_timer_index = 0; // TODO: BDSHOT_TIM param to select timer index?
 static uint32_t _dshot_frequency = 0;
@@ -446,11 +450,6 @@ void dma_burst_finished_callback(DMA_HANDLE handle, uint8_t status, void *arg)
 	// De-allocate timer
 	io_timer_unallocate_timer(timer_index);
 
-	// Flush cache so DMA sees the data
-	memset(dshot_capture_buffer, 0, sizeof(dshot_capture_buffer));
-	up_clean_dcache((uintptr_t) dshot_capture_buffer,
-			(uintptr_t) dshot_capture_buffer + DSHOT_CAPTURE_BUFFER_SIZE(MAX_NUM_CHANNELS_PER_TIMER));
-
 	// Unallocate timer channel for currently selected capture_channel
 	uint8_t capture_channel = timer_configs[timer_index].capture_channel_index;
 	uint8_t output_channel = output_channel_from_timer_channel(timer_index, capture_channel);
@@ -464,6 +463,12 @@ void dma_burst_finished_callback(DMA_HANDLE handle, uint8_t status, void *arg)
 
 	// Allocate DMA for currently selected capture_channel
 	capture_channel = timer_configs[timer_index].capture_channel_index;
+
+	// Flush cache so DMA sees the data (only the channel being captured)
+	memset(dshot_capture_buffer[capture_channel], 0, sizeof(dshot_capture_buffer[capture_channel]));
+	up_clean_dcache((uintptr_t) dshot_capture_buffer[capture_channel],
+			(uintptr_t) dshot_capture_buffer[capture_channel] + DSHOT_CAPTURE_BUFFER_SIZE(1));
+
 	timer_configs[timer_index].dma_handle = stm32_dmachannel(io_timers[timer_index].dshot.dma_map_ch[capture_channel]);
 
 	// If DMA handler is valid, start DMA
@@ -532,8 +537,8 @@ static void capture_complete_callback(void *arg)
 	}
 
 	// Invalidate the dcache to ensure most recent data is available
-	up_invalidate_dcache((uintptr_t) dshot_capture_buffer,
-			     (uintptr_t) dshot_capture_buffer + DSHOT_CAPTURE_BUFFER_SIZE(MAX_NUM_CHANNELS_PER_TIMER));
+	up_invalidate_dcache((uintptr_t) dshot_capture_buffer[capture_channel],
+			     (uintptr_t) dshot_capture_buffer[capture_channel] + DSHOT_CAPTURE_BUFFER_SIZE(1));
 
 	// Process eRPM frames from all channels on this timer
 	process_capture_results(timer_index, capture_channel);
@@ -691,62 +696,13 @@ void up_bdshot_status(void)
 	}
 }
 
-uint8_t nibbles_from_mapped(uint8_t mapped)
-{
-	switch (mapped) {
-	case 0x19:
-		return 0x00;
-
-	case 0x1B:
-		return 0x01;
-
-	case 0x12:
-		return 0x02;
-
-	case 0x13:
-		return 0x03;
-
-	case 0x1D:
-		return 0x04;
-
-	case 0x15:
-		return 0x05;
-
-	case 0x16:
-		return 0x06;
-
-	case 0x17:
-		return 0x07;
-
-	case 0x1a:
-		return 0x08;
-
-	case 0x09:
-		return 0x09;
-
-	case 0x0A:
-		return 0x0A;
-
-	case 0x0B:
-		return 0x0B;
-
-	case 0x1E:
-		return 0x0C;
-
-	case 0x0D:
-		return 0x0D;
-
-	case 0x0E:
-		return 0x0E;
-
-	case 0x0F:
-		return 0x0F;
-
-	default:
-		// Unknown mapped
-		return 0xFF;
-	}
-}
+// GCR 5 bit code to nibble, 0xFF for invalid codes
+static const uint8_t gcr_to_nibble[32] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x09, 0x0A, 0x0B, 0xFF, 0x0D, 0x0E, 0x0F,
+	0xFF, 0xFF, 0x02, 0x03, 0xFF, 0x05, 0x06, 0x07,
+	0xFF, 0x00, 0x08, 0x01, 0xFF, 0x04, 0x0C, 0xFF,
+};
 
 unsigned calculate_period(uint8_t timer_index, uint8_t channel_index)
 {
@@ -767,12 +723,17 @@ unsigned calculate_period(uint8_t timer_index, uint8_t channel_index)
 
 		// This seemss to work with dshot 150, 300, 600, 1200
 		// The values were found by trial and error to get the quantization just right.
-		const uint32_t bits = (dshot_capture_buffer[channel_index][i] - previous + 5) / 20;
+		uint32_t bits = (dshot_capture_buffer[channel_index][i] - previous + 5) / 20;
+
+		// a frame has 21 bits, anything beyond is not part of it
+		if (shifted + bits > 21) {
+			bits = 21 - shifted;
+		}
 
-		// Convert GCR encoded pulse train into value
-		for (unsigned bit = 0; bit < bits; ++bit) {
-			value = (value << 1) | high;
-			++shifted;
+		// Convert GCR encoded pulse train into value, shifting in the whole run of equal bits at once
+		if (bits > 0) {
+			value = (value << bits) | (high ? ((1u << bits) - 1) : 0);
+			shifted += bits;
 		}
 
 		// The next edge toggles.
@@ -798,14 +759,14 @@ unsigned calculate_period(uint8_t timer_index, uint8_t channel_index)
 
 	// 20bits -> 5 mapped -> 4 nibbles
 	for (unsigned i = 0; i < 4; ++i) {
-		uint32_t nibble = nibbles_from_mapped(gcr & 0x1F) << (4 * i);
+		const uint32_t nibble = gcr_to_nibble[gcr & 0x1F];
 
 		if (nibble == 0xFF) {
 			++read_fail_nibble[channel_index];;
 			return 0;
 		}
 
-		data |= nibble;
+		data |= nibble << (4 * i);
 		gcr >>= 5;
 	}
 
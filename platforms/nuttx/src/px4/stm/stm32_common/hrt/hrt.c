@@ -61,6 +61,7 @@
 
 #include <board_config.h>
 #include <drivers/drv_hrt.h>
+#include <lib/perf/perf_trace.h>
 
 
 #include "stm32_gpio.h"
@@ -650,7 +651,9 @@ hrt_tim_isr(int irq, void *context, void *arg)
 		hrt_latency_update();
 
 		/* run any callouts that have met their deadline */
+		perf_trace_begin("hrt_isr");
 		hrt_call_invoke();
+		perf_trace_end("hrt_isr");
 
 		/* and schedule the next interrupt */
 		hrt_call_reschedule();
@@ -0,0 +1,188 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file cryp.c
+ *
+ * AES-CTR using the STM32H7 CRYP peripheral.
+ *
+ * The data is fed through the 8 word input and output FIFOs by the CPU. The
+ * AES rounds themselves are done in hardware, which makes this a lot cheaper
+ * than a software cipher.
+ */
+
+#include <nuttx/config.h>
+#include <px4_platform_common/sem.h>
+#include <px4_arch/cryp.h>
+
+#include <string.h>
+
+#include "arm_internal.h"
+#include "chip.h"
+#include "stm32_rcc.h"
+
+#define CRYP_BASE		0x48021000
+
+#define CRYP_CR			(CRYP_BASE + 0x00)
+#define CRYP_SR			(CRYP_BASE + 0x04)
+#define CRYP_DIN		(CRYP_BASE + 0x08)
+#define CRYP_DOUT		(CRYP_BASE + 0x0c)
+#define CRYP_K0LR		(CRYP_BASE + 0x20)
+#define CRYP_IV0LR		(CRYP_BASE + 0x40)
+
+#define CRYP_CR_ALGOMODE_AES_CTR	(6 << 3)
+#define CRYP_CR_DATATYPE_8BIT		(2 << 6)
+#define CRYP_CR_KEYSIZE_128		(0 << 8)
+#define CRYP_CR_KEYSIZE_192		(1 << 8)
+#define CRYP_CR_KEYSIZE_256		(2 << 8)
+#define CRYP_CR_FFLUSH			(1 << 14)
+#define CRYP_CR_CRYPEN			(1 << 15)
+
+#define CRYP_SR_IFNF		(1 << 1)
+#define CRYP_SR_OFNE		(1 << 2)
+#define CRYP_SR_BUSY		(1 << 4)
+
+#ifndef RCC_AHB2ENR_CRYPEN
+#  define RCC_AHB2ENR_CRYPEN	(1 << 4)
+#endif
+
+#define AES_BLOCK_SIZE		16
+
+static px4_sem_t cryp_lock;
+
+static inline uint32_t load_be32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline void store_be32(uint8_t *p, uint32_t v)
+{
+	p[0] = v >> 24;
+	p[1] = v >> 16;
+	p[2] = v >> 8;
+	p[3] = v;
+}
+
+/* stream words through the FIFOs. The output lags behind the input, so in place is fine */
+static void cryp_process(const uint8_t *in, uint8_t *out, size_t num_words)
+{
+	size_t in_words = 0;
+	size_t out_words = 0;
+
+	while (out_words < num_words) {
+		const uint32_t sr = getreg32(CRYP_SR);
+
+		if (in_words < num_words && (sr & CRYP_SR_IFNF)) {
+			uint32_t word;
+			memcpy(&word, in + in_words * 4, 4);
+			putreg32(word, CRYP_DIN);
+			++in_words;
+
+		} else if (sr & CRYP_SR_OFNE) {
+			const uint32_t word = getreg32(CRYP_DOUT);
+			memcpy(out + out_words * 4, &word, 4);
+			++out_words;
+		}
+	}
+}
+
+void px4_arch_cryp_init(void)
+{
+	px4_sem_init(&cryp_lock, 0, 1);
+	modifyreg32(STM32_RCC_AHB2ENR, 0, RCC_AHB2ENR_CRYPEN);
+}
+
+bool px4_arch_aes_ctr(const uint8_t *key, size_t key_size, uint8_t iv[16], const uint8_t *in, uint8_t *out,
+		      size_t size)
+{
+	uint32_t keysize;
+
+	switch (key_size) {
+	case 16:
+		keysize = CRYP_CR_KEYSIZE_128;
+		break;
+
+	case 24:
+		keysize = CRYP_CR_KEYSIZE_192;
+		break;
+
+	case 32:
+		keysize = CRYP_CR_KEYSIZE_256;
+		break;
+
+	default:
+		return false;
+	}
+
+	const size_t num_blocks = size / AES_BLOCK_SIZE;
+	const size_t remainder = size % AES_BLOCK_SIZE;
+
+	do {} while (px4_sem_wait(&cryp_lock) != 0);
+
+	putreg32(0, CRYP_CR);
+	putreg32(CRYP_CR_ALGOMODE_AES_CTR | CRYP_CR_DATATYPE_8BIT | keysize, CRYP_CR);
+
+	/* the key is right aligned in K0LR..K3RR, the first byte is the MSB */
+	const uint32_t key_reg = CRYP_K0LR + (32 - key_size);
+
+	for (size_t i = 0; i < key_size / 4; ++i) {
+		putreg32(load_be32(key + i * 4), key_reg + i * 4);
+	}
+
+	for (size_t i = 0; i < 4; ++i) {
+		putreg32(load_be32(iv + i * 4), CRYP_IV0LR + i * 4);
+	}
+
+	modifyreg32(CRYP_CR, 0, CRYP_CR_FFLUSH);
+	modifyreg32(CRYP_CR, 0, CRYP_CR_CRYPEN);
+
+	cryp_process(in, out, num_blocks * (AES_BLOCK_SIZE / 4));
+
+	if (remainder > 0) {
+		uint8_t block[AES_BLOCK_SIZE] = {};
+		memcpy(block, in + num_blocks * AES_BLOCK_SIZE, remainder);
+		cryp_process(block, block, AES_BLOCK_SIZE / 4);
+		memcpy(out + num_blocks * AES_BLOCK_SIZE, block, remainder);
+	}
+
+	do {} while (getreg32(CRYP_SR) & CRYP_SR_BUSY);
+
+	putreg32(0, CRYP_CR);
+
+	px4_sem_post(&cryp_lock);
+
+	/* advance the block counter (the hardware only increments the lower 32 bits as well) */
+	store_be32(iv + 12, load_be32(iv + 12) + num_blocks + (remainder > 0 ? 1 : 0));
+
+	return true;
+}
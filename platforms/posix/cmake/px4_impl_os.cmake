@@ -156,7 +156,7 @@ endfunction()
 #
 #	px4_posix_generate_symlinks
 #
-#	This function generates symlinks for all modules/commands.
+#	This function generates symlinks for all modules/commands, and the session client.
 #
 #	Usage:
 #		px4_posix_generate_symlinks(
@@ -199,6 +199,13 @@ function(px4_posix_generate_symlinks)
 			)
 		endif()
 	endforeach()
+
+	# client running the commands read from stdin over a single connection
+	add_custom_command(TARGET ${TARGET}
+		POST_BUILD
+		COMMAND ${CMAKE_COMMAND} -E create_symlink ${TARGET} ${PREFIX}session
+		WORKING_DIRECTORY "${CMAKE_RUNTIME_OUTPUT_DIRECTORY}"
+	)
 endfunction()
 
 
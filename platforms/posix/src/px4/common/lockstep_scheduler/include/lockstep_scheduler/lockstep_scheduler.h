@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <mutex>
 #include <vector>
@@ -54,6 +55,13 @@ public:
 	int cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *lock, uint64_t time_us);
 	int usleep_until(uint64_t timed_us);
 
+	/**
+	 * Ratio of simulated time to wall clock time elapsed since the first call to
+	 * set_absolute_time(), or since the last reset_real_time_factor().
+	 */
+	float real_time_factor() const;
+	void reset_real_time_factor();
+
 	LockstepComponents &components() { return _components; }
 
 private:
@@ -88,6 +96,7 @@ private:
 		uint64_t time_us{0};
 		bool timeout{false};
 		std::atomic<bool> done{false};
+		std::atomic<bool> waking{false}; ///< set_absolute_time() is about to signal passed_cond
 		std::atomic<bool> removed{true};
 
 		TimedWait *next{nullptr}; ///< linked list
@@ -99,5 +108,11 @@ private:
 
 	TimedWait *_timed_waits{nullptr}; ///< head of linked list
 	std::mutex _timed_waits_mutex;
-	std::atomic<bool> _setting_time{false}; ///< true if set_absolute_time() is currently being executed
+
+	std::mutex _setting_time_mutex; ///< held by set_absolute_time() while it signals expired waits
+	std::vector<TimedWait *> _expired_waits; ///< only accessed with _setting_time_mutex held
+
+	std::atomic<uint64_t> _rtf_start_time_us{0};
+	std::atomic<int64_t> _rtf_start_wall_ns{0};
+	std::atomic<int64_t> _last_set_wall_ns{0};
 };
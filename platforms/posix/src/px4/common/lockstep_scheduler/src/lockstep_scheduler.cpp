@@ -47,17 +47,33 @@ LockstepScheduler::~LockstepScheduler()
 	}
 }
 
+static int64_t wall_time_ns()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		       std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 void LockstepScheduler::set_absolute_time(uint64_t time_us)
 {
 	if (_time_us == 0 && time_us > 0) {
 		PX4_INFO("setting initial absolute time to %" PRIu64 " us", time_us);
 	}
 
+	std::lock_guard<std::mutex> lock_setting_time(_setting_time_mutex);
+
 	_time_us = time_us;
 
+	const int64_t now_ns = wall_time_ns();
+
+	if (_rtf_start_time_us == 0) {
+		_rtf_start_wall_ns = now_ns;
+		_rtf_start_time_us = time_us;
+	}
+
+	_last_set_wall_ns = now_ns;
+
 	{
 		std::unique_lock<std::mutex> lock_timed_waits(_timed_waits_mutex);
-		_setting_time = true;
 
 		TimedWait *timed_wait = _timed_waits;
 		TimedWait *timed_wait_prev = nullptr;
@@ -81,20 +97,56 @@ void LockstepScheduler::set_absolute_time(uint64_t time_us)
 
 			if (timed_wait->time_us <= time_us &&
 			    !timed_wait->timeout) {
-				// We are abusing the condition here to signal that the time
-				// has passed.
-				pthread_mutex_lock(timed_wait->passed_lock);
-				timed_wait->timeout = true;
-				pthread_cond_broadcast(timed_wait->passed_cond);
-				pthread_mutex_unlock(timed_wait->passed_lock);
+				// Mark before re-checking 'done', so that either we skip it here or
+				// cond_timedwait() sees the flag and waits for us (see there).
+				timed_wait->waking = true;
+
+				if (timed_wait->done) {
+					timed_wait->waking = false;
+
+				} else {
+					_expired_waits.push_back(timed_wait);
+				}
 			}
 
 			timed_wait_prev = timed_wait;
 			timed_wait = timed_wait->next;
 		}
+	}
 
-		_setting_time = false;
+	// Signal outside of _timed_waits_mutex, so that the threads we wake up can
+	// immediately go back to cond_timedwait() and run in parallel, instead of
+	// queuing up behind us until every expired wait has been signalled.
+	for (TimedWait *timed_wait : _expired_waits) {
+		// We are abusing the condition here to signal that the time
+		// has passed.
+		pthread_mutex_lock(timed_wait->passed_lock);
+		timed_wait->timeout = true;
+		pthread_cond_broadcast(timed_wait->passed_cond);
+		timed_wait->waking = false;
+		pthread_mutex_unlock(timed_wait->passed_lock);
 	}
+
+	_expired_waits.clear();
+}
+
+float LockstepScheduler::real_time_factor() const
+{
+	const uint64_t start_time_us = _rtf_start_time_us;
+	const uint64_t time_us = _time_us;
+	const int64_t wall_elapsed_ns = _last_set_wall_ns - _rtf_start_wall_ns;
+
+	if (start_time_us == 0 || time_us <= start_time_us || wall_elapsed_ns <= 0) {
+		return 0.f;
+	}
+
+	return (float)((double)(time_us - start_time_us) * 1e3 / (double)wall_elapsed_ns);
+}
+
+void LockstepScheduler::reset_real_time_factor()
+{
+	// restart the measurement on the next set_absolute_time()
+	_rtf_start_time_us = 0;
 }
 
 int LockstepScheduler::cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *lock, uint64_t time_us)
@@ -134,19 +186,19 @@ int LockstepScheduler::cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *loc
 
 	timed_wait.done = true;
 
-	if (!timeout && _setting_time) {
+	if (!timeout && timed_wait.waking) {
 		// This is where it gets tricky: the timeout has not been triggered yet,
-		// and another thread is in set_absolute_time().
-		// If it already passed the 'done' check, it will access the mutex and
-		// the condition variable next. However they might be invalid as soon as we
-		// return here, so we wait until set_absolute_time() is done.
-		// In addition we have to unlock 'lock', otherwise we risk a
-		// deadlock due to a different locking order in set_absolute_time().
+		// but set_absolute_time() already picked this wait as expired and is
+		// about to access the mutex and the condition variable. However they
+		// might be invalid as soon as we return here, so we wait until
+		// set_absolute_time() is done.
+		// In addition we have to unlock 'lock', otherwise set_absolute_time()
+		// cannot signal us and we deadlock.
 		// Note that this case does not happen too frequently, and thus can be
 		// a bit more expensive.
 		pthread_mutex_unlock(lock);
-		_timed_waits_mutex.lock();
-		_timed_waits_mutex.unlock();
+		_setting_time_mutex.lock();
+		_setting_time_mutex.unlock();
 		pthread_mutex_lock(lock);
 	}
 
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <functional>
 #include <chrono>
+#include <algorithm>
 
 class TestThread
 {
@@ -307,6 +308,87 @@ void test_usleep()
 	thread.join(ls);
 }
 
+static void busy_wait_wall_us(unsigned us)
+{
+	const auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(us);
+
+	while (std::chrono::steady_clock::now() < end) {}
+}
+
+// Runs num_threads periodic "work queues" in lockstep, each doing work_us of real work
+// per simulated step, and returns the achieved real-time factor.
+float benchmark_real_time_factor(unsigned num_threads, unsigned work_us)
+{
+	constexpr uint64_t step_us = 4000;
+	constexpr unsigned num_steps = 250;
+
+	LockstepScheduler ls;
+	ls.set_absolute_time(some_time_us);
+
+	std::atomic<bool> should_exit{false};
+	std::atomic<unsigned> num_registered{0};
+	std::atomic<unsigned> num_exited{0};
+	std::vector<std::shared_ptr<TestThread>> threads{};
+
+	for (unsigned i = 0; i < num_threads; ++i) {
+		threads.push_back(std::make_shared<TestThread>([&ls, &should_exit, &num_registered, &num_exited, work_us]() {
+			const int component = ls.components().register_component();
+			++num_registered;
+
+			for (uint64_t step = 1; !should_exit; ++step) {
+				busy_wait_wall_us(work_us);
+				ls.components().lockstep_progress(component);
+				ls.usleep_until(some_time_us + step * step_us);
+			}
+
+			ls.components().unregister_component(component);
+			++num_exited;
+		}));
+	}
+
+	WAIT_FOR(num_registered == num_threads);
+
+	ls.reset_real_time_factor();
+
+	for (unsigned step = 1; step <= num_steps; ++step) {
+		ls.components().wait_for_components();
+		ls.set_absolute_time(some_time_us + step * step_us);
+	}
+
+	const float real_time_factor = ls.real_time_factor();
+
+	should_exit = true;
+
+	// keep time going until every thread noticed
+	for (uint64_t time_us = ls.get_absolute_time(); num_exited < num_threads;) {
+		time_us += step_us;
+		ls.set_absolute_time(time_us);
+		std::this_thread::yield();
+	}
+
+	for (auto &thread : threads) {
+		thread->join(ls);
+	}
+
+	return real_time_factor;
+}
+
+void test_real_time_factor()
+{
+	LockstepScheduler ls;
+	EXPECT_EQ(ls.real_time_factor(), 0.f);
+
+	ls.set_absolute_time(some_time_us);
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	ls.set_absolute_time(some_time_us + 1000000);
+
+	// 1 s of simulated time in roughly 10 ms
+	EXPECT_GT(ls.real_time_factor(), 10.f);
+
+	ls.reset_real_time_factor();
+	EXPECT_EQ(ls.real_time_factor(), 0.f);
+}
+
 TEST(LockstepScheduler, All)
 {
 	for (unsigned iteration = 1; iteration <= 100; ++iteration) {
@@ -317,4 +399,21 @@ TEST(LockstepScheduler, All)
 		test_usleep();
 		test_multiple_semaphores_waiting();
 	}
+
+	test_real_time_factor();
+}
+
+TEST(LockstepScheduler, RealTimeFactorBenchmark)
+{
+	const unsigned num_threads = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+	constexpr unsigned work_us = 1000;
+
+	const float rtf_single = benchmark_real_time_factor(1, work_us);
+	const float rtf_parallel = benchmark_real_time_factor(num_threads, work_us);
+
+	std::cout << "real-time factor: 1 thread: " << rtf_single << ", " << num_threads << " threads: "
+		  << rtf_parallel << " (" << work_us << " us of work per thread and 4 ms step)\n";
+
+	EXPECT_GT(rtf_single, 0.f);
+	EXPECT_GT(rtf_parallel, 0.f);
 }
@@ -180,6 +180,12 @@ int main(int argc, char **argv)
 		argv[0] += path_length + strlen(prefix);
 
 		px4_daemon::Client client(instance);
+
+		if (strcmp(argv[0], "session") == 0 && argc == 1) {
+			// one command per line from stdin over a single connection
+			return client.process_session(stdin);
+		}
+
 		return client.process_args(argc, (const char **)argv);
 
 	} else {
@@ -635,6 +641,9 @@ void print_usage()
 	printf("\n");
 	printf("    px4-MODULE [--instance <instance>] command using symlink.\n");
 	printf("        e.g.: px4-commander status\n");
+	printf("\n");
+	printf("    px4-session [--instance <instance>] < <commands_file>\n");
+	printf("        run the commands read from stdin (one per line) over a single connection\n");
 }
 
 int get_server_running(int instance, bool *is_server_running)
@@ -62,7 +62,7 @@ Client::Client(int instance_id) :
 {}
 
 int
-Client::process_args(const int argc, const char **argv)
+Client::_connect()
 {
 	std::string sock_path = get_socket_path(_instance_id);
 
@@ -82,19 +82,16 @@ Client::process_args(const int argc, const char **argv)
 		return -1;
 	}
 
-	int ret = _send_cmds(argc, argv);
-
-	if (ret != 0) {
-		PX4_ERR("Could not send commands");
-		return -3;
-	}
-
-	return _listen();
+	return 0;
 }
 
 int
-Client::_send_cmds(const int argc, const char **argv)
+Client::process_args(const int argc, const char **argv)
 {
+	if (_connect() != 0) {
+		return -1;
+	}
+
 	std::string cmd_buf;
 
 	for (int i = 0; i < argc; ++i) {
@@ -107,8 +104,68 @@ Client::_send_cmds(const int argc, const char **argv)
 		}
 	}
 
-	// Last byte is 'isatty'.
-	cmd_buf.push_back(isatty(STDOUT_FILENO));
+	int ret = _send_cmd(cmd_buf, isatty(STDOUT_FILENO) ? FLAG_IS_ATTY : 0);
+
+	if (ret != 0) {
+		PX4_ERR("Could not send commands");
+		return -3;
+	}
+
+	return _listen();
+}
+
+int
+Client::process_session(FILE *in)
+{
+	if (_connect() != 0) {
+		return -1;
+	}
+
+	const char flags = FLAG_KEEP_OPEN | (isatty(STDOUT_FILENO) ? FLAG_IS_ATTY : 0);
+	int ret = 0;
+	char line[1024];
+
+	while (fgets(line, sizeof(line), in) != nullptr) {
+		std::string cmd = line;
+
+		// Strip the line ending and skip empty lines and comments.
+		while (!cmd.empty() && (cmd.back() == '\n' || cmd.back() == '\r')) {
+			cmd.pop_back();
+		}
+
+		const size_t start = cmd.find_first_not_of(" \t");
+
+		if (start == std::string::npos || cmd[start] == '#') {
+			continue;
+		}
+
+		if (_send_cmd(cmd, flags) != 0) {
+			PX4_ERR("Could not send commands");
+			return -3;
+		}
+
+		char retval = 0;
+
+		if (_listen_session(retval) != 0) {
+			return -1;
+		}
+
+		if (retval != 0) {
+			// Like a shell script without 'set -e': continue with the next command.
+			ret = retval;
+		}
+	}
+
+	return ret;
+}
+
+int
+Client::_send_cmd(const std::string &cmd, char flags)
+{
+	std::string cmd_buf = cmd;
+
+	// Last byte are the flags.
+	cmd_buf.push_back(flags);
 
 	size_t n = cmd_buf.size();
 	const char *buf = cmd_buf.data();
@@ -128,6 +185,48 @@ Client::_send_cmds(const int argc, const char **argv)
 	return 0;
 }
 
+int
+Client::_listen_session(char &retval)
+{
+	char buffer[1024];
+	int n_buffer_used = 0;
+
+	// The connection stays open, so the response ends at the first {0, retval}. A 0 at the
+	// end of a read is kept until we know whether the return value follows.
+	while (true) {
+		int n_read = read(_fd, buffer + n_buffer_used, sizeof buffer - n_buffer_used);
+
+		if (n_read < 0) {
+			PX4_ERR("unable to read from socket");
+			return -1;
+
+		} else if (n_read == 0) {
+			// Stream was abruptly ended.
+			return -1;
+		}
+
+		n_read += n_buffer_used;
+		n_buffer_used = 0;
+
+		const char *end = (const char *)memchr(buffer, 0, n_read);
+
+		if (end == nullptr) {
+			fwrite(buffer, n_read, 1, stdout);
+
+		} else if (end + 1 < buffer + n_read) {
+			fwrite(buffer, end - buffer, 1, stdout);
+			fflush(stdout);
+			retval = end[1];
+			return 0;
+
+		} else {
+			fwrite(buffer, n_read - 1, 1, stdout);
+			buffer[0] = 0;
+			n_buffer_used = 1;
+		}
+	}
+}
+
 int
 Client::_listen()
 {
@@ -40,6 +40,9 @@
  * It the client dies, the connection gets closed automatically and the corresponding
  * thread in the server gets cancelled.
  *
+ * In a session, the client sends one command after the other over the same connection,
+ * so scripts running many commands don't need a new client process and connection each.
+ *
  * @author Julian Oes <julian@oes.ch>
  * @author Beat Küng <beat-kueng@gmx.net>
  * @author Mara Bos <m-ou.se@m-ou.se>
@@ -47,6 +50,9 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdio.h>
+
+#include <string>
 
 #include "sock_protocol.h"
 
@@ -76,9 +82,20 @@ public:
 	 */
 	int process_args(const int argc, const char **argv);
 
+	/**
+	 * Send each line read from the input as a command to the server, over a single connection.
+	 * Empty lines and lines starting with '#' are skipped.
+	 *
+	 * @param in: input with one command per line (e.g. stdin)
+	 * @return 0 if all commands succeeded, otherwise the return value of the last failed command
+	 */
+	int process_session(FILE *in);
+
 private:
-	int _send_cmds(const int argc, const char **argv);
+	int _connect();
+	int _send_cmd(const std::string &cmd, char flags);
 	int _listen();
+	int _listen_session(char &retval);
 
 	int _fd;
 	int _instance_id; ///< instance ID for running multiple instances of the px4 server
@@ -50,6 +50,7 @@
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/un.h>
+#include <algorithm>
 #include <vector>
 
 #include <px4_platform_common/log.h>
@@ -64,6 +65,7 @@ Server *Server::_instance = nullptr;
 
 Server::Server(int instance_id)
 	: _mutex(PTHREAD_MUTEX_INITIALIZER),
+	  _pending_cond(PTHREAD_COND_INITIALIZER),
 	  _instance_id(instance_id)
 {
 	_instance = this;
@@ -180,25 +182,13 @@ Server::_server_main()
 				// Set stream to line buffered.
 				setvbuf(thread_stdout, nullptr, _IOLBF, BUFSIZ);
 
-				// Start a new thread to handle the client.
-				pthread_t *thread = &_fd_to_thread[client];
-				ret = pthread_create(thread, nullptr, Server::_handle_client, thread_stdout);
+				// Start listening for the client hanging up.
+				poll_fds.push_back(pollfd {client, POLLHUP, 0});
 
-				if (ret != 0) {
-					PX4_ERR("could not start pthread (%i)", ret);
-					_fd_to_thread.erase(client);
-					fclose(thread_stdout);
+				// Remember the FILE *, so we can fclose() it later.
+				stdouts.push_back(thread_stdout);
 
-				} else {
-					// We won't join the thread, so detach to automatically release resources at its end
-					pthread_detach(*thread);
-
-					// Start listening for the client hanging up.
-					poll_fds.push_back(pollfd {client, POLLHUP, 0});
-
-					// Remember the FILE *, so we can fclose() it later.
-					stdouts.push_back(thread_stdout);
-				}
+				_dispatch_client(thread_stdout);
 			}
 		}
 
@@ -213,6 +203,10 @@ Server::_server_main()
 					// TODO: use a more graceful exit method to avoid resource leaks
 					pthread_cancel(thread->second);
 					_fd_to_thread.erase(thread);
+
+				} else {
+					// Not taken by a worker yet
+					_remove_pending_client(stdouts[i - 1]);
 				}
 
 				fclose(stdouts[i - 1]);
@@ -233,67 +227,160 @@ Server::_server_main()
 }
 
 void
-*Server::_handle_client(void *arg)
+Server::_dispatch_client(FILE *client_stdout)
 {
-	FILE *out = (FILE *)arg;
-	int fd = fileno(out);
+	// called with the lock held
+	_pending_clients.push_back(client_stdout);
 
-	// Read until the end of the incoming stream.
-	std::string cmd;
+	// Start a new worker if there's no idle one left for this client.
+	if (_pending_clients.size() > _num_idle_workers) {
+		pthread_t thread;
+		int ret = pthread_create(&thread, nullptr, Server::_worker_main_trampoline, this);
 
-	while (true) {
-		size_t n = cmd.size();
-		cmd.resize(n + 1024);
-		ssize_t n_read = read(fd, &cmd[n], cmd.size() - n);
+		if (ret != 0) {
+			PX4_ERR("could not start pthread (%i)", ret);
 
-		if (n_read <= 0) {
-			_cleanup(fd);
-			return nullptr;
+			if (_num_idle_workers == 0) {
+				// Nobody will handle it, hang up on it.
+				_remove_pending_client(client_stdout);
+				shutdown(fileno(client_stdout), SHUT_RDWR);
+				return;
+			}
+
+		} else {
+			// We won't join the thread, so detach to automatically release resources at its end
+			pthread_detach(thread);
+		}
+	}
+
+	pthread_cond_signal(&_pending_cond);
+}
+
+void
+Server::_remove_pending_client(FILE *client_stdout)
+{
+	// called with the lock held
+	auto pending = std::find(_pending_clients.begin(), _pending_clients.end(), client_stdout);
+
+	if (pending != _pending_clients.end()) {
+		_pending_clients.erase(pending);
+	}
+}
+
+void *
+Server::_worker_main_trampoline(void *self)
+{
+	((Server *)self)->_worker_main();
+	return nullptr;
+}
+
+void
+Server::_worker_main()
+{
+	_lock();
+
+	while (true) {
+		while (_pending_clients.empty()) {
+			++_num_idle_workers;
+			pthread_cond_wait(&_pending_cond, &_mutex);
+			--_num_idle_workers;
 		}
 
-		cmd.resize(n + n_read);
+		FILE *out = _pending_clients.front();
+		_pending_clients.pop_front();
+
+		// From here on the main thread cancels us if the client hangs up.
+		_fd_to_thread[fileno(out)] = pthread_self();
+		_unlock();
+
+		_handle_client(out);
 
-		// Command ends in 0x00 (no tty) or 0x01 (tty).
-		if (!cmd.empty() && cmd.back() < 2) {
+		_lock();
+
+		if (_num_idle_workers >= MAX_IDLE_WORKERS && _pending_clients.empty()) {
 			break;
 		}
 	}
 
-	if (cmd.size() < 2) {
-		_cleanup(fd);
-		return nullptr;
+	_unlock();
+}
+
+bool
+Server::_read_cmd(int fd, std::string &buffer, std::string &cmd, char &flags)
+{
+	// Command ends in the flags byte, anything after it belongs to the next command.
+	auto is_flags = [](char c) { return (unsigned char)c <= (unsigned char)FLAGS_MASK; };
+
+	auto end = std::find_if(buffer.begin(), buffer.end(), is_flags);
+
+	while (end == buffer.end()) {
+		size_t n = buffer.size();
+		buffer.resize(n + 1024);
+		ssize_t n_read = read(fd, &buffer[n], buffer.size() - n);
+
+		if (n_read <= 0) {
+			return false;
+		}
+
+		buffer.resize(n + n_read);
+		end = std::find_if(buffer.begin() + n, buffer.end(), is_flags);
 	}
 
-	// Last byte is 'isatty'.
-	uint8_t isatty = cmd.back();
-	cmd.pop_back();
+	cmd.assign(buffer.begin(), end);
+	flags = *end;
+	buffer.erase(buffer.begin(), end + 1);
+
+	return true;
+}
+
+void
+Server::_handle_client(FILE *out)
+{
+	int fd = fileno(out);
 
 	// We register thread specific data. This is used for PX4_INFO (etc.) log calls.
+	// Workers are reused for other clients, so it's updated for each one.
 	CmdThreadSpecificData *thread_data_ptr = static_cast<CmdThreadSpecificData *>(pthread_getspecific(_instance->_key));
 
 	if (thread_data_ptr == nullptr) {
 		thread_data_ptr = new CmdThreadSpecificData;
-		thread_data_ptr->thread_stdout = out;
-		thread_data_ptr->is_atty = isatty;
-
 		(void)pthread_setspecific(_instance->_key, (void *)thread_data_ptr);
 	}
 
-	// Run the actual command.
-	int retval = Pxh::process_line(cmd, true);
+	std::string buffer;
+	std::string cmd;
+	char flags = 0;
 
-	// Report return value.
-	char buf[2] = {0, (char)retval};
+	while (_read_cmd(fd, buffer, cmd, flags)) {
+		if (cmd.empty()) {
+			break;
+		}
+
+		thread_data_ptr->thread_stdout = out;
+		thread_data_ptr->is_atty = flags & FLAG_IS_ATTY;
 
-	if (fwrite(buf, sizeof buf, 1, out) != 1) {
-		// Don't care it went wrong, as we're cleaning up anyway.
+		// Run the actual command.
+		int retval = Pxh::process_line(cmd, true);
+
+		// Report return value.
+		char buf[2] = {0, (char)retval};
+
+		if (fwrite(buf, sizeof buf, 1, out) != 1) {
+			// Don't care it went wrong, as we're cleaning up anyway.
+		}
+
+		// Flush the FILE*'s buffer before we shut down the connection or wait for the next command.
+		fflush(out);
+
+		if (!(flags & FLAG_KEEP_OPEN)) {
+			break;
+		}
 	}
 
-	// Flush the FILE*'s buffer before we shut down the connection.
-	fflush(out);
+	// The FILE* is closed by the main thread after the hang up.
+	thread_data_ptr->thread_stdout = nullptr;
 
 	_cleanup(fd);
-	return nullptr;
 }
 
 void
@@ -37,7 +37,12 @@
  *
  * Once a client connects it will send a command and close its side of the connection.
  * The server will return the stdout of the executing command, as well as the return
- * value to the client.
+ * value to the client. A client can also keep the connection open and send several
+ * commands one after the other (see sock_protocol.h).
+ *
+ * The clients are handled by a pool of worker threads: a new worker is only started
+ * if all of them are busy (so a blocking command never delays the others), and up to
+ * MAX_IDLE_WORKERS workers are kept for the next clients instead of exiting.
  *
  * There should only every be one server running, therefore the static instance.
  * The Singleton implementation is not complete, but it should be obvious not
@@ -53,7 +58,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <pthread.h>
+#include <deque>
 #include <map>
+#include <string>
 
 #include "sock_protocol.h"
 
@@ -103,13 +110,25 @@ private:
 		pthread_mutex_unlock(&_mutex);
 	}
 
-	static void *_handle_client(void *arg);
+	void _dispatch_client(FILE *client_stdout);
+	void _remove_pending_client(FILE *client_stdout);
+
+	static void *_worker_main_trampoline(void *arg);
+	void _worker_main();
+
+	static void _handle_client(FILE *out);
+	static bool _read_cmd(int fd, std::string &buffer, std::string &cmd, char &flags);
 	static void _cleanup(int fd);
 
+	static constexpr unsigned MAX_IDLE_WORKERS = 8;
+
 	pthread_t _server_main_pthread;
 
 	std::map<int, pthread_t> _fd_to_thread;
-	pthread_mutex_t _mutex; ///< Protects _fd_to_thread.
+	std::deque<FILE *> _pending_clients; ///< accepted clients not yet taken by a worker
+	unsigned _num_idle_workers{0};
+	pthread_mutex_t _mutex; ///< Protects _fd_to_thread, _pending_clients and _num_idle_workers.
+	pthread_cond_t _pending_cond; ///< Signalled when a client is added to _pending_clients.
 
 	pthread_key_t _key;
 
@@ -33,6 +33,15 @@
 /**
  * @file sock_protocol.h
  *
+ * A command is sent as the command line followed by a flags byte, the response is the
+ * stdout of the command followed by {0, return value}.
+ *
+ * Without FLAG_KEEP_OPEN the server closes the connection after the response. With it,
+ * the client can send the next command on the same connection (a session), which avoids
+ * the connection setup for each command. The output of a command must then not end in
+ * a 0 byte followed by another byte, as the client cannot tell it from the end of
+ * the response.
+ *
  * @author Mara Bos <m-ou.se@m-ou.se>
  */
 #pragma once
@@ -44,4 +53,9 @@ namespace px4_daemon
 
 std::string get_socket_path(int instance_id);
 
+// flags byte at the end of a command
+static constexpr char FLAG_IS_ATTY = 0x01; ///< stdout of the client is a terminal
+static constexpr char FLAG_KEEP_OPEN = 0x02; ///< keep the connection open for the next command
+static constexpr char FLAGS_MASK = FLAG_IS_ATTY | FLAG_KEEP_OPEN;
+
 } // namespace px4_daemon
@@ -202,18 +202,26 @@ CameraCapture::publish_trigger()
 	if (_pps_capture_sub.update(&pps_capture)) {
 		_pps_hrt_timestamp = pps_capture.timestamp;
 		_pps_rtc_timestamp = pps_capture.rtc_timestamp;
+		_pps_hrt_drift_ppm = pps_capture.hrt_drift_ppm;
+		_pps_jitter_us = pps_capture.jitter_us;
 	}
 
+	// the timer input capture timestamps the edge itself, the GPIO interrupt adds its (unknown) latency
+	const float edge_accuracy = _gpio_capture ? NAN : TIMER_CAPTURE_ACCURACY_US;
 
 	if (_pps_hrt_timestamp > 0) {
-		// Last PPS RTC time + elapsed time to the camera capture interrupt
-		trigger.timestamp_utc = _pps_rtc_timestamp + (trigger.timestamp - _pps_hrt_timestamp);
+		// Last PPS RTC time + elapsed time to the camera capture edge, corrected for the hrt rate error
+		const int64_t elapsed = (int64_t)(trigger.timestamp - _pps_hrt_timestamp);
+		const int64_t correction = (int64_t)((double)elapsed * (double)_pps_hrt_drift_ppm * 1e-6);
+		trigger.timestamp_utc = _pps_rtc_timestamp + (elapsed - correction);
+		trigger.timestamp_accuracy = edge_accuracy + _pps_jitter_us;
 
 	} else {
 		// No PPS capture received, use RTC clock as fallback
 		timespec tv{};
 		px4_clock_gettime(CLOCK_REALTIME, &tv);
 		trigger.timestamp_utc = ts_to_abstime(&tv) - hrt_elapsed_time(&trigger.timestamp);
+		trigger.timestamp_accuracy = NAN;
 	}
 
 	_trigger_pub.publish(trigger);
@@ -134,11 +134,15 @@ private:
 
 	hrt_abstime	_pps_hrt_timestamp{0};
 	uint64_t		_pps_rtc_timestamp{0};
+	float			_pps_hrt_drift_ppm{0.f};
+	float			_pps_jitter_us{NAN};
 	uint8_t			_trigger_rate_exceeded_counter{0};
 	px4::atomic<bool> _trigger_rate_failure{false};
 
 	orb_advert_t _mavlink_log_pub{nullptr};
 
+	static constexpr float TIMER_CAPTURE_ACCURACY_US{1.f};	///< timer input capture tick
+
 	// Signal capture callback
 	void			capture_callback(uint32_t chan_index, hrt_abstime edge_time, uint32_t edge_state, uint32_t overflow);
 
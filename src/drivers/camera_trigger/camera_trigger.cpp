@@ -851,6 +851,7 @@ CameraTrigger::engage(void *arg)
 
 	trigger.seq = trig->_trigger_seq;
 	trigger.feedback = false;
+	trigger.timestamp_accuracy = NAN; // time of the trigger request, not of the exposure
 	trigger.timestamp = hrt_absolute_time();
 
 	orb_publish(ORB_ID(camera_trigger), trig->_trigger_pub, &trigger);
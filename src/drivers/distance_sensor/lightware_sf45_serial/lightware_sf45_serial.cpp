@@ -97,6 +97,8 @@ int SF45LaserSerial::init()
 				    (_yaw_cfg));
 	_obstacle_distance.angle_offset = math::degrees(matrix::wrap_2pi(yaw_cfg_angle));
 
+	_scan_binner.configure(_obstacle_distance.increment, _obstacle_distance.angle_offset, _obstacle_distance.max_distance);
+
 	start();
 	return PX4_OK;
 }
@@ -600,7 +602,7 @@ void SF45LaserSerial::sf45_process_replies()
 
 	switch (rx_field.msg_id) {
 	case SF_DISTANCE_DATA_CM: {
-			const float raw_distance = (rx_field.data[0] << 0) | (rx_field.data[1] << 8);
+			const uint16_t raw_distance = (rx_field.data[0] << 0) | (rx_field.data[1] << 8);
 			int16_t raw_yaw = ((rx_field.data[2] << 0) | (rx_field.data[3] << 8));
 
 			// The sensor scans from 0 to -160, so extract negative angle from int16 and represent as if a float
@@ -613,49 +615,20 @@ void SF45LaserSerial::sf45_process_replies()
 				raw_yaw = -raw_yaw;
 			}
 
-			// SF45/B product guide {Data output bit: 8 Description: "Yaw angle [1/100 deg] size: int16}"
-			float scaled_yaw_sensor_frame = raw_yaw * SF45_SCALE_FACTOR;
-			float scaled_yaw_frd          = ObstacleMath::wrap_360(scaled_yaw_sensor_frame + _obstacle_distance.angle_offset);
-			float distance_m              = raw_distance * SF45_SCALE_FACTOR;
-
-			// Update the current bin distance
-			_current_bin_dist = ((uint16_t)raw_distance < _current_bin_dist) ? (uint16_t)raw_distance : _current_bin_dist;
-
-			// Find bin index for the current sensor yaw angle (in sensor frame)
-			const int current_bin = ObstacleMath::get_bin_at_angle(_obstacle_distance.increment, scaled_yaw_sensor_frame);
-
-			if (current_bin != _previous_bin) {
-				PX4_DEBUG("scaled_yaw: \t %f, \t current_bin: \t %d, \t distance: \t %8.4f\n", (double)scaled_yaw_frd, current_bin,
-					  (double)distance_m);
-
-				if (_vehicle_attitude_sub.updated()) {
-					vehicle_attitude_s vehicle_attitude;
-
-					if (_vehicle_attitude_sub.copy(&vehicle_attitude)) {
-						_vehicle_attitude = matrix::Quatf(vehicle_attitude.q);
-					}
-				}
+			if (_vehicle_attitude_sub.updated()) {
+				vehicle_attitude_s vehicle_attitude;
 
-				// Scale distance with vehicle rotation
-				float current_bin_dist = static_cast<float>(_current_bin_dist);
-				float scaled_yaw_frd_rad = math::radians(static_cast<float>(scaled_yaw_frd));
-				ObstacleMath::project_distance_on_horizontal_plane(current_bin_dist, scaled_yaw_frd_rad, _vehicle_attitude);
-				_current_bin_dist = static_cast<uint16_t>(current_bin_dist);
-
-				if (_current_bin_dist > _obstacle_distance.max_distance) {
-					_current_bin_dist = _obstacle_distance.max_distance + 1; // As per ObstacleDistance.msg definition
+				if (_vehicle_attitude_sub.copy(&vehicle_attitude)) {
+					// Scale distance with vehicle rotation
+					_scan_binner.set_attitude(matrix::Quatf(vehicle_attitude.q));
 				}
+			}
 
-				hrt_abstime now = hrt_absolute_time();
-
-				_obstacle_distance.distances[current_bin] = _current_bin_dist;
-				_handle_missed_bins(current_bin, _previous_bin, _current_bin_dist, now);
+			const hrt_abstime now = hrt_absolute_time();
 
+			// SF45/B product guide {Data output bit: 8 Description: "Yaw angle [1/100 deg] size: int16}"
+			if (_scan_binner.add_point(raw_yaw, raw_distance, _obstacle_distance.distances, _data_timestamps, now) > 0) {
 				_publish_obstacle_msg(now);
-
-				// reset the values for the next measurement
-				_current_bin_dist = UINT16_MAX;
-				_previous_bin = current_bin;
 			}
 
 			break;
@@ -681,45 +654,6 @@ void SF45LaserSerial::_publish_obstacle_msg(hrt_abstime now)
 	_obstacle_distance_pub.publish(_obstacle_distance);
 }
 
-void SF45LaserSerial::_handle_missed_bins(uint8_t current_bin, uint8_t previous_bin, uint16_t measurement,
-		hrt_abstime now)
-{
-	// if the sensor has its cycle delay configured for a low value like 5, it can happen that not every bin gets a measurement.
-	// in this case we assume the measurement to be valid for all bins between the previous and the current bin.
-	uint8_t start = current_bin;
-	uint8_t end = previous_bin - 1;
-
-	if (abs(current_bin - previous_bin) > BIN_COUNT / 4) {
-		// wrap-around case is assumed to have happend when the distance between the bins is larger than 1/4 of all Bins
-		// This is simplyfied as we are not considering the scaning direction
-		start = math::max(previous_bin, current_bin);
-		end = math::min(previous_bin, current_bin);
-
-	} else if (previous_bin < current_bin) {	// Scanning clockwise
-		start = previous_bin + 1;
-		end = current_bin;
-
-	}
-
-	if (start <= end) {
-		for (uint8_t i = start; i <= end; i++) {
-			_obstacle_distance.distances[i] = measurement;
-			_data_timestamps[i] = now;
-		}
-
-	} else { // wrap-around case
-		for (uint8_t i = start; i < BIN_COUNT; i++) {
-			_obstacle_distance.distances[i] = measurement;
-			_data_timestamps[i] = now;
-		}
-
-		for (uint8_t i = 0; i <= end; i++) {
-			_obstacle_distance.distances[i] = measurement;
-			_data_timestamps[i] = now;
-		}
-	}
-}
-
 uint16_t SF45LaserSerial::sf45_format_crc(uint16_t crc, uint8_t data_val)
 {
 	uint32_t i;
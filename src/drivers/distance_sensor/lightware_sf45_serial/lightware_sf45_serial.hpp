@@ -47,6 +47,7 @@
 #include <drivers/device/device.h>
 #include <lib/parameters/param.h>
 #include <lib/perf/perf_counter.h>
+#include <ObstacleMath.hpp>
 
 #include <uORB/Publication.hpp>
 #include <uORB/Subscription.hpp>
@@ -98,7 +99,6 @@ private:
 	static constexpr uint8_t 	BIN_COUNT = sizeof(obstacle_distance_s::distances) / sizeof(
 				obstacle_distance_s::distances[0]);
 	static constexpr uint64_t 	SF45_MEAS_TIMEOUT{100_ms};
-	static constexpr float 		SF45_SCALE_FACTOR = 0.01f;
 	static constexpr float		SF45_FIELDOF_VIEW = 320.f; // degrees
 
 	void				start();
@@ -108,10 +108,10 @@ private:
 	int				collect();
 	bool				_crc_valid{false};
 
-	void 				_handle_missed_bins(uint8_t current_bin, uint8_t previous_bin, uint16_t measurement, hrt_abstime now);
 	void 				_publish_obstacle_msg(hrt_abstime now);
 	uORB::Subscription 		_vehicle_attitude_sub{ORB_ID(vehicle_attitude)};
-	uint64_t			_data_timestamps[BIN_COUNT];
+	uint64_t			_data_timestamps[BIN_COUNT] {};
+	ObstacleMath::ScanBinner	_scan_binner{};
 
 
 	char 				_port[20] {};
@@ -137,9 +137,6 @@ private:
 	uint16_t			_calc_crc{0};
 	int32_t				_yaw_cfg{0};
 	int32_t				_orient_cfg{0};
-	uint8_t				_previous_bin{0};
-	uint16_t			_current_bin_dist{UINT16_MAX};
-	matrix::Quatf			_vehicle_attitude{};
 
 	// end of SF45/B data members
 
@@ -229,6 +229,7 @@ private:
 
 	perf_counter_t _uart_tx_buffer_full_perf{perf_alloc(PC_COUNT, MODULE_NAME": tx buf full")};
 	perf_counter_t _rtcm_buffer_full_perf{perf_alloc(PC_COUNT, MODULE_NAME": rtcm buf full")};
+	perf_counter_t _inject_data_overwritten_perf{perf_alloc(PC_COUNT, MODULE_NAME": inject data overwritten")};
 
 	static px4::atomic_bool _is_gps_main_advertised; ///< for the second gps we want to make sure that it gets instance 1
 	/// and thus we wait until the first one publishes at least one message.
@@ -274,6 +275,11 @@ private:
 	 */
 	void handleInjectDataTopic();
 
+	/**
+	 * Add gps_inject_data to the RTCM parser for frame reassembly (ignoring data from this instance)
+	 */
+	void addInjectData(const gps_inject_data_s &msg);
+
 	/**
 	 * send data to the device, such as an RTCM stream
 	 * @param data
@@ -405,6 +411,7 @@ GPS::~GPS()
 
 	perf_free(_uart_tx_buffer_full_perf);
 	perf_free(_rtcm_buffer_full_perf);
+	perf_free(_inject_data_overwritten_perf);
 
 	delete _sat_info;
 	delete _dump_to_device;
@@ -591,7 +598,9 @@ void GPS::handleInjectDataTopic()
 		}
 	}
 
-	bool updated = already_copied;
+	if (already_copied) {
+		addInjectData(msg);
+	}
 
 	// Limit maximum number of GPS injections to 8 since usually
 	// GPS injections should consist of 1-4 packets (GPS, Glonass, BeiDou, Galileo).
@@ -600,38 +609,37 @@ void GPS::handleInjectDataTopic()
 	// Moving Base reuires a higher rate, so we allow up to 8 packets.
 	// Drain uORB messages into RTCM parser and inject full messages after draining the queue.
 	const size_t max_num_injections = gps_inject_data_s::ORB_QUEUE_LENGTH;
-	size_t num_injections = 0;
+	size_t num_injections = already_copied ? 1 : 0;
 
-	do {
-		if (updated) {
-			num_injections++;
+	auto &gps_inject_data_sub = _orb_inject_data_sub[_selected_rtcm_instance];
 
-			// Prevent injection of data from self
-			if (msg.device_id != get_device_id()) {
-				// Add data to the RTCM parser buffer for frame reassembly
-				size_t added = _rtcm_parser.addData(msg.data, msg.len);
+	while (num_injections < max_num_injections) {
+		const unsigned last_generation = gps_inject_data_sub.get_last_generation();
 
-				if (added < msg.len) {
-					perf_count(_rtcm_buffer_full_perf);
-				}
+		// zero-copy: add the data to the RTCM parser directly from the topic queue
+		const gps_inject_data_s *inject_data = static_cast<const gps_inject_data_s *>(gps_inject_data_sub.peek());
+		const bool peeked = (inject_data != nullptr);
 
-				_last_rtcm_injection_time = hrt_absolute_time();
+		if (!peeked) {
+			if (!gps_inject_data_sub.update(&msg)) {
+				break;
 			}
-		}
 
-		auto &gps_inject_data_sub = _orb_inject_data_sub[_selected_rtcm_instance];
+			inject_data = &msg;
+		}
 
-		const unsigned last_generation = gps_inject_data_sub.get_last_generation();
+		if (gps_inject_data_sub.get_last_generation() != last_generation + 1) {
+			PX4_WARN("gps_inject_data lost, generation %u -> %u", last_generation, gps_inject_data_sub.get_last_generation());
+		}
 
-		updated = gps_inject_data_sub.update(&msg);
+		num_injections++;
+		addInjectData(*inject_data);
 
-		if (updated) {
-			if (gps_inject_data_sub.get_last_generation() != last_generation + 1) {
-				PX4_WARN("gps_inject_data lost, generation %u -> %u", last_generation, gps_inject_data_sub.get_last_generation());
-			}
+		if (peeked && !gps_inject_data_sub.release()) {
+			// overwritten while reading, the corrupted frame is rejected by the RTCM parser CRC check
+			perf_count(_inject_data_overwritten_perf);
 		}
-
-	} while (updated && num_injections < max_num_injections);
+	}
 
 	// Now inject all complete RTCM frames from the parser buffer
 	size_t frame_len = {};
@@ -655,6 +663,22 @@ void GPS::handleInjectDataTopic()
 	}
 }
 
+void GPS::addInjectData(const gps_inject_data_s &msg)
+{
+	// Prevent injection of data from self
+	if (msg.device_id != get_device_id()) {
+		// Add data to the RTCM parser buffer for frame reassembly
+		const size_t len = math::min((size_t)msg.len, sizeof(msg.data));
+		size_t added = _rtcm_parser.addData(msg.data, len);
+
+		if (added < len) {
+			perf_count(_rtcm_buffer_full_perf);
+		}
+
+		_last_rtcm_injection_time = hrt_absolute_time();
+	}
+}
+
 bool GPS::injectData(const uint8_t *data, size_t len)
 {
 	dumpGpsData(data, len, gps_dump_comm_mode_t::Full, true);
@@ -1306,6 +1330,7 @@ GPS::print_status()
 
 	perf_print_counter(_uart_tx_buffer_full_perf);
 	perf_print_counter(_rtcm_buffer_full_perf);
+	perf_print_counter(_inject_data_overwritten_perf);
 
 	if (_instance == Instance::Main && _secondary_instance.load()) {
 		GPS *secondary_instance = _secondary_instance.load();
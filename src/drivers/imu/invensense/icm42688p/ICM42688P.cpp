@@ -757,7 +757,8 @@ void ICM42688P::ProcessAccel(const hrt_abstime &timestamp_sample, const FIFO::DA
 
 void ICM42688P::ProcessGyro(const hrt_abstime &timestamp_sample, const FIFO::DATA fifo[], const uint8_t samples)
 {
-	sensor_gyro_fifo_s gyro{};
+	// filled in place in the sensor_gyro_fifo queue (zero-copy) if possible
+	sensor_gyro_fifo_s &gyro = _px4_gyro.getFIFOSample();
 	gyro.timestamp_sample = timestamp_sample;
 	gyro.samples = 0;
 
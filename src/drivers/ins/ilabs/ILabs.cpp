@@ -334,15 +334,13 @@ void ILabs::processData(InertialLabs::SensorsData *data) {
 	// publish baro
 	if (isFilterOk && isBaroOk) {
 		if (_average_sensors_data.count > DECIMATION_VALUE) {
-			sensor_baro_s sensor_baro{};
-			sensor_baro.timestamp = time_now_us;
-			sensor_baro.timestamp_sample = time_now_us;
+			sensor_baro_s &sensor_baro = _sensor_baro_pub.get(time_now_us);
 
 			sensor_baro.device_id   = _device_id.devid;
 			sensor_baro.pressure    = _average_sensors_data.pressure / static_cast<float>(_average_sensors_data.count);    // Pa
 			sensor_baro.temperature = _average_sensors_data.temperature / static_cast<float>(_average_sensors_data.count);  // degC
 
-			_sensor_baro_pub.publish(sensor_baro);
+			_sensor_baro_pub.publish();
 			perf_count(_baro_pub_interval_perf);
 
 			_average_sensors_data.count = 0;
@@ -361,24 +359,20 @@ void ILabs::processData(InertialLabs::SensorsData *data) {
 		const matrix::Quatf quat{matrix::Eulerf(math::radians(data->ins.roll),
 							math::radians(data->ins.pitch),
 							math::radians(data->ins.yaw))};
-		vehicle_attitude_s  attitude{};
-		attitude.timestamp        = time_now_us;
-		attitude.timestamp_sample = time_now_us;
+		vehicle_attitude_s &attitude = _attitude_pub.get(time_now_us);
 
 		attitude.q[0] = quat(0);
 		attitude.q[1] = quat(1);
 		attitude.q[2] = quat(2);
 		attitude.q[3] = quat(3);
 
-		_attitude_pub.publish(attitude);
+		_attitude_pub.publish();
 		perf_count(_attitude_pub_interval_perf);
 	}
 
 	// publish local position
 	if (isFilterOk) {
-		vehicle_local_position_s local_position{};
-		local_position.timestamp        = time_now_us;
-		local_position.timestamp_sample = time_now_us;
+		vehicle_local_position_s &local_position = _local_position_pub.get(time_now_us);
 
 		local_position.xy_valid   = true;
 		local_position.z_valid    = true;
@@ -433,15 +427,13 @@ void ILabs::processData(InertialLabs::SensorsData *data) {
 		local_position.hagl_max_z  = INFINITY;
 		local_position.hagl_max_xy = INFINITY;
 
-		_local_position_pub.publish(local_position);
+		_local_position_pub.publish();
 		perf_count(_local_position_pub_interval_perf);
 	}
 
 	// publish global_position
 	if (isFilterOk) {
-		vehicle_global_position_s global_position{};
-		global_position.timestamp        = time_now_us;
-		global_position.timestamp_sample = time_now_us;
+		vehicle_global_position_s &global_position = _global_position_pub.get(time_now_us);
 
 		global_position.lat_lon_valid = true;
 		global_position.alt_valid     = true;
@@ -456,15 +448,13 @@ void ILabs::processData(InertialLabs::SensorsData *data) {
 
 		global_position.dead_reckoning = false;
 
-		_global_position_pub.publish(global_position);
+		_global_position_pub.publish();
 		perf_count(_global_position_pub_interval_perf);
 	}
 
 	// publish GPS data
 	if (hasEnoughSatellites && isFilterOk && hasNewGpsData) {
-		sensor_gps_s sensor_gps{};
-		sensor_gps.timestamp        = time_now_us;
-		sensor_gps.timestamp_sample = time_now_us;
+		sensor_gps_s &sensor_gps = _sensor_gps_pub.get(time_now_us);
 
 		sensor_gps.device_id = _device_id.devid;
 
@@ -506,14 +496,12 @@ void ILabs::processData(InertialLabs::SensorsData *data) {
 
 		// sensor_gps.s_variance_m_s = ...; // TODO: need 0x43 UDD Package?
 
-		_sensor_gps_pub.publish(sensor_gps);
+		_sensor_gps_pub.publish();
 		perf_count(_gnss_pub_interval_perf);
 	}
 
 	if (_param_ilabs_mode.get() == ILabsMode::FULL_INS) {
-		estimator_status_s estimator_status{};
-		estimator_status.timestamp        = time_now_us;
-		estimator_status.timestamp_sample = time_now_us;
+		estimator_status_s &estimator_status = _estimator_status_pub.get(time_now_us);
 
 		const float test_ratio = 0.1f;
 
@@ -527,7 +515,7 @@ void ILabs::processData(InertialLabs::SensorsData *data) {
 		estimator_status.mag_device_id  = _device_id.devid;
 		estimator_status.baro_device_id  = _device_id.devid;
 
-		_estimator_status_pub.publish(estimator_status);
+		_estimator_status_pub.publish();
 	}
 }
 
@@ -43,6 +43,7 @@
 #include <drivers/accelerometer/PX4Accelerometer.hpp>
 #include <drivers/device/Device.hpp>
 #include <drivers/gyroscope/PX4Gyroscope.hpp>
+#include <lib/drivers/ins/InsPublication.hpp>
 #include <drivers/magnetometer/PX4Magnetometer.hpp>
 #include <perf/perf_counter.h>
 #include <px4_platform_common/module.h>
@@ -105,13 +106,13 @@ private:
 
 	MapProjection _pos_ref{};
 
-	uORB::PublicationMulti<vehicle_attitude_s>        _attitude_pub{ORB_ID(vehicle_attitude)};
-	uORB::PublicationMulti<vehicle_local_position_s>  _local_position_pub{ORB_ID(vehicle_local_position)};
-	uORB::PublicationMulti<vehicle_global_position_s> _global_position_pub{ORB_ID(vehicle_global_position)};
-	uORB::PublicationMulti<sensor_baro_s>             _sensor_baro_pub{ORB_ID(sensor_baro)};
-	uORB::PublicationMulti<sensor_gps_s>              _sensor_gps_pub{ORB_ID(sensor_gps)};
+	InsPublication<vehicle_attitude_s>                _attitude_pub{ORB_ID(vehicle_attitude)};
+	InsPublication<vehicle_local_position_s>          _local_position_pub{ORB_ID(vehicle_local_position)};
+	InsPublication<vehicle_global_position_s>         _global_position_pub{ORB_ID(vehicle_global_position)};
+	InsPublication<sensor_baro_s>                     _sensor_baro_pub{ORB_ID(sensor_baro)};
+	InsPublication<sensor_gps_s>                      _sensor_gps_pub{ORB_ID(sensor_gps)};
 	uORB::Publication<sensor_selection_s>             _sensor_selection_pub{ORB_ID(sensor_selection)};
-	uORB::Publication<estimator_status_s>             _estimator_status_pub{ORB_ID(estimator_status)};
+	InsPublication<estimator_status_s, uORB::Publication<estimator_status_s>> _estimator_status_pub{ORB_ID(estimator_status)};
 
 	perf_counter_t _comms_errors{perf_alloc(PC_COUNT, MODULE_NAME ": com_err")};
 	perf_counter_t _sample_perf{perf_alloc(PC_ELAPSED, MODULE_NAME ": read")};
@@ -197,10 +197,12 @@ void SbgEcom::handleLogImuShort(const SbgEComLogUnion *ref_sbg_data, void *user_
 
 	SbgEcom *instance = static_cast<SbgEcom *>(user_arg);
 
+	const hrt_abstime timestamp_sample = instance->_timestamp.update(ref_sbg_data->imuShort.timeStamp,
+					     hrt_absolute_time());
 	const float temperature = sbgEComLogImuShortGetTemperature(&ref_sbg_data->imuShort);
 
 	// publish sensor_accel
-	instance->_px4_accel.update(hrt_absolute_time(),
+	instance->_px4_accel.update(timestamp_sample,
 				    sbgEComLogImuShortGetDeltaVelocity(&ref_sbg_data->imuShort, 0),
 				    sbgEComLogImuShortGetDeltaVelocity(&ref_sbg_data->imuShort, 1),
 				    sbgEComLogImuShortGetDeltaVelocity(&ref_sbg_data->imuShort, 2));
@@ -209,7 +211,7 @@ void SbgEcom::handleLogImuShort(const SbgEComLogUnion *ref_sbg_data, void *user_
 	perf_count(instance->_accel_pub_interval_perf);
 
 	// publish sensor_gyro
-	instance->_px4_gyro.update(hrt_absolute_time(),
+	instance->_px4_gyro.update(timestamp_sample,
 				   sbgEComLogImuShortGetDeltaAngle(&ref_sbg_data->imuShort, 0),
 				   sbgEComLogImuShortGetDeltaAngle(&ref_sbg_data->imuShort, 1),
 				   sbgEComLogImuShortGetDeltaAngle(&ref_sbg_data->imuShort, 2));
@@ -226,7 +228,7 @@ void SbgEcom::handleLogMag(const SbgEComLogUnion *ref_sbg_data, void *user_arg)
 	SbgEcom *instance = static_cast<SbgEcom *>(user_arg);
 
 	// publish sensor_mag
-	instance->_px4_mag.update(ref_sbg_data->magData.timeStamp,
+	instance->_px4_mag.update(instance->_timestamp.update(ref_sbg_data->magData.timeStamp, hrt_absolute_time()),
 				  (ref_sbg_data->magData.magnetometers[0]),
 				  (ref_sbg_data->magData.magnetometers[1]),
 				  (ref_sbg_data->magData.magnetometers[2]));
@@ -264,33 +266,27 @@ void SbgEcom::handleLogEkfQuat(const SbgEComLogUnion *ref_sbg_data, void *user_a
 
 	SbgEcom *instance = static_cast<SbgEcom *>(user_arg);
 
+	const hrt_abstime timestamp_sample = instance->_timestamp.update(ref_sbg_data->ekfQuatData.timeStamp, time_now_us);
+
 	// publish estimator_status
-	estimator_status_s estimator_status{};
-	estimator_status.timestamp = time_now_us;
-	estimator_status.timestamp_sample = ref_sbg_data->ekfQuatData.timeStamp;
+	estimator_status_s &estimator_status = instance->_estimator_status_pub.get(timestamp_sample);
 	estimator_status.accel_device_id = instance->get_device_id();
 	estimator_status.gyro_device_id = instance->get_device_id();
 	estimator_status.mag_device_id = instance->get_device_id();
 
 	instance->updateEstimatorStatus(ref_sbg_data->ekfQuatData.status, &estimator_status);
 
-	instance->_estimator_status_pub.publish(estimator_status);
+	instance->_estimator_status_pub.publish();
 
 	// publish attitude
-	vehicle_attitude_s attitude{};
-
-	attitude.timestamp = time_now_us;
-	attitude.timestamp_sample = ref_sbg_data->ekfQuatData.timeStamp;
+	const matrix::Quatf q{ref_sbg_data->ekfQuatData.quaternion};
 
-	attitude.q[0] = ref_sbg_data->ekfQuatData.quaternion[0];
-	attitude.q[1] = ref_sbg_data->ekfQuatData.quaternion[1];
-	attitude.q[2] = ref_sbg_data->ekfQuatData.quaternion[2];
-	attitude.q[3] = ref_sbg_data->ekfQuatData.quaternion[3];
+	vehicle_attitude_s &attitude = instance->_attitude_pub.get(timestamp_sample);
+	q.copyTo(attitude.q);
 
-	instance->_attitude_pub.publish(attitude);
+	instance->_attitude_pub.publish();
 	perf_count(instance->_attitude_pub_interval_perf);
 
-	matrix::Quatf q{attitude.q};
 	instance->_heading = matrix::Eulerf{q}.psi();
 }
 
@@ -303,14 +299,14 @@ void SbgEcom::handleLogEkfNav(const SbgEComLogUnion *ref_sbg_data, void *user_ar
 
 	SbgEcom *instance = static_cast<SbgEcom *>(user_arg);
 
+	const hrt_abstime timestamp_sample = instance->_timestamp.update(ref_sbg_data->ekfNavData.timeStamp, time_now_us);
+
 	// publish estimator_status
-	estimator_status_s estimator_status{};
-	estimator_status.timestamp = time_now_us;
-	estimator_status.timestamp_sample = ref_sbg_data->ekfNavData.timeStamp;
+	estimator_status_s &estimator_status = instance->_estimator_status_pub.get(timestamp_sample);
 
 	instance->updateEstimatorStatus(ref_sbg_data->ekfNavData.status, &estimator_status);
 
-	instance->_estimator_status_pub.publish(estimator_status);
+	instance->_estimator_status_pub.publish();
 
 	SbgEComSolutionMode ekf_nav_status = sbgEComLogEkfGetSolutionMode(ref_sbg_data->ekfNavData.status);
 
@@ -328,17 +324,14 @@ void SbgEcom::handleLogEkfNav(const SbgEComLogUnion *ref_sbg_data, void *user_ar
 	const double down_velocity = ref_sbg_data->ekfNavData.velocity[2];
 
 	if (!instance->_pos_ref.isInitialized()) {
-		instance->_pos_ref.initReference(latitude, longitude, time_now_us);
+		instance->_pos_ref.initReference(latitude, longitude, timestamp_sample);
 		instance->_gps_alt_ref = altitude;
 	}
 
 	const Vector2f pos_ned = instance->_pos_ref.project(latitude, longitude);
 
 	// publish local_position
-	vehicle_local_position_s local_position{};
-
-	local_position.timestamp = time_now_us;
-	local_position.timestamp_sample = ref_sbg_data->ekfNavData.timeStamp;
+	vehicle_local_position_s &local_position = instance->_local_position_pub.get(timestamp_sample);
 
 	local_position.xy_valid = math::isFinite(latitude) && math::isFinite(longitude);
 	local_position.z_valid = math::isFinite(altitude);
@@ -383,14 +376,11 @@ void SbgEcom::handleLogEkfNav(const SbgEComLogUnion *ref_sbg_data, void *user_ar
 	local_position.hagl_max_xy = INFINITY;
 	local_position.hagl_max_z = INFINITY;
 
-	instance->_local_position_pub.publish(local_position);
+	instance->_local_position_pub.publish();
 	perf_count(instance->_local_position_pub_interval_perf);
 
 	// publish global_position
-	vehicle_global_position_s global_position{};
-
-	global_position.timestamp = time_now_us;
-	global_position.timestamp_sample = ref_sbg_data->ekfNavData.timeStamp;
+	vehicle_global_position_s &global_position = instance->_global_position_pub.get(timestamp_sample);
 
 	global_position.lat = latitude;
 	global_position.lon = longitude;
@@ -406,7 +396,7 @@ void SbgEcom::handleLogEkfNav(const SbgEComLogUnion *ref_sbg_data, void *user_ar
 
 	global_position.dead_reckoning = false;
 
-	instance->_global_position_pub.publish(global_position);
+	instance->_global_position_pub.publish();
 	perf_count(instance->_global_position_pub_interval_perf);
 }
 
@@ -446,134 +436,132 @@ void SbgEcom::handleLogGnssPosVelHdt(SbgEComMsgId msg, const SbgEComLogUnion *re
 	}
 
 	if (gnss_data->pos_received && gnss_data->vel_received && gnss_data->hdt_received) {
-		// publish sensor_gps
-		sensor_gps_s sensor_gps{};
-
-		sensor_gps.timestamp = time_now_us;
-		sensor_gps.timestamp_sample = gnss_data->gps_pos.timeStamp;
-
-		sensor_gps.device_id = instance->get_device_id();
-
-		sensor_gps.latitude_deg = gnss_data->gps_pos.latitude;
-		sensor_gps.longitude_deg = gnss_data->gps_pos.longitude;
-		sensor_gps.altitude_msl_m = gnss_data->gps_pos.altitude;
-		sensor_gps.altitude_ellipsoid_m = gnss_data->gps_pos.undulation;
-
-		sensor_gps.s_variance_m_s = sqrt(pow(gnss_data->gps_vel.velocityAcc[0], 2) +
-						 pow(gnss_data->gps_vel.velocityAcc[1], 2) +
-						 pow(gnss_data->gps_vel.velocityAcc[2], 2));
-		sensor_gps.c_variance_rad = math::radians(gnss_data->gps_vel.courseAcc);
-
-		type = sbgEComLogGnssPosGetType(&gnss_data->gps_pos);
-
-		switch (type) {
-		case SBG_ECOM_GNSS_POS_TYPE_NO_SOLUTION:
-			sensor_gps.fix_type = 0;
-			break;
-
-		case SBG_ECOM_GNSS_POS_TYPE_PSRDIFF:
-		case SBG_ECOM_GNSS_POS_TYPE_SBAS:
-			sensor_gps.fix_type = 4;
-			break;
-
-		case SBG_ECOM_GNSS_POS_TYPE_RTK_FLOAT:
-			sensor_gps.fix_type = 5;
-			break;
-
-		case SBG_ECOM_GNSS_POS_TYPE_RTK_INT:
-			sensor_gps.fix_type = 6;
-			break;
-
-		case SBG_ECOM_GNSS_POS_TYPE_FIXED:
-			sensor_gps.fix_type = 7;
-			break;
-
-		case SBG_ECOM_GNSS_POS_TYPE_PPP_FLOAT:
-		case SBG_ECOM_GNSS_POS_TYPE_PPP_INT:
-			sensor_gps.fix_type = 8;
-			break;
-
-		default:
-			sensor_gps.fix_type = 3;
-			break;
-		}
+		// Check timestamp synchronization
+		const hrt_abstime max_time_diff = 1000000; // Maximum allowed time difference in microseconds (e.g., 1 second)
+		hrt_abstime pos_time = gnss_data->pos_timestamp;
+		hrt_abstime vel_time = gnss_data->vel_timestamp;
+		hrt_abstime hdt_time = gnss_data->hdt_timestamp;
 
-		sensor_gps.eph = sqrt(pow(gnss_data->gps_pos.longitudeAccuracy, 2) +
-				      pow(gnss_data->gps_pos.latitudeAccuracy, 2));
-		sensor_gps.epv = gnss_data->gps_pos.altitudeAccuracy;
+		if (((time_now_us - pos_time) < max_time_diff) &&
+		    ((time_now_us - vel_time) < max_time_diff) &&
+		    ((time_now_us - hdt_time) < max_time_diff) &&
+		    ((pos_time - vel_time) < max_time_diff) &&
+		    ((pos_time - hdt_time) < max_time_diff) &&
+		    ((vel_time - hdt_time) < max_time_diff)) {
+			// publish sensor_gps
+			const hrt_abstime timestamp_sample = instance->_timestamp.update(gnss_data->gps_pos.timeStamp, time_now_us);
+			sensor_gps_s &sensor_gps = instance->_sensor_gps_pub.get(timestamp_sample);
+
+			sensor_gps.device_id = instance->get_device_id();
+
+			sensor_gps.latitude_deg = gnss_data->gps_pos.latitude;
+			sensor_gps.longitude_deg = gnss_data->gps_pos.longitude;
+			sensor_gps.altitude_msl_m = gnss_data->gps_pos.altitude;
+			sensor_gps.altitude_ellipsoid_m = gnss_data->gps_pos.undulation;
+
+			sensor_gps.s_variance_m_s = sqrt(pow(gnss_data->gps_vel.velocityAcc[0], 2) +
+							 pow(gnss_data->gps_vel.velocityAcc[1], 2) +
+							 pow(gnss_data->gps_vel.velocityAcc[2], 2));
+			sensor_gps.c_variance_rad = math::radians(gnss_data->gps_vel.courseAcc);
+
+			type = sbgEComLogGnssPosGetType(&gnss_data->gps_pos);
+
+			switch (type) {
+			case SBG_ECOM_GNSS_POS_TYPE_NO_SOLUTION:
+				sensor_gps.fix_type = 0;
+				break;
+
+			case SBG_ECOM_GNSS_POS_TYPE_PSRDIFF:
+			case SBG_ECOM_GNSS_POS_TYPE_SBAS:
+				sensor_gps.fix_type = 4;
+				break;
+
+			case SBG_ECOM_GNSS_POS_TYPE_RTK_FLOAT:
+				sensor_gps.fix_type = 5;
+				break;
+
+			case SBG_ECOM_GNSS_POS_TYPE_RTK_INT:
+				sensor_gps.fix_type = 6;
+				break;
+
+			case SBG_ECOM_GNSS_POS_TYPE_FIXED:
+				sensor_gps.fix_type = 7;
+				break;
+
+			case SBG_ECOM_GNSS_POS_TYPE_PPP_FLOAT:
+			case SBG_ECOM_GNSS_POS_TYPE_PPP_INT:
+				sensor_gps.fix_type = 8;
+				break;
+
+			default:
+				sensor_gps.fix_type = 3;
+				break;
+			}
 
-		state = sbgEComLogGnssPosGetIfmStatus(&gnss_data->gps_pos);
+			sensor_gps.eph = sqrt(pow(gnss_data->gps_pos.longitudeAccuracy, 2) +
+					      pow(gnss_data->gps_pos.latitudeAccuracy, 2));
+			sensor_gps.epv = gnss_data->gps_pos.altitudeAccuracy;
 
-		switch (state) {
-		case SBG_ECOM_GNSS_IFM_STATUS_UNKNOWN:
-			sensor_gps.jamming_state = 0;
-			break;
+			state = sbgEComLogGnssPosGetIfmStatus(&gnss_data->gps_pos);
 
-		case SBG_ECOM_GNSS_IFM_STATUS_CLEAN:
-			sensor_gps.jamming_state = 1;
-			break;
+			switch (state) {
+			case SBG_ECOM_GNSS_IFM_STATUS_UNKNOWN:
+				sensor_gps.jamming_state = 0;
+				break;
 
-		case SBG_ECOM_GNSS_IFM_STATUS_MITIGATED:
-			sensor_gps.jamming_state = 2;
-			break;
+			case SBG_ECOM_GNSS_IFM_STATUS_CLEAN:
+				sensor_gps.jamming_state = 1;
+				break;
 
-		case SBG_ECOM_GNSS_IFM_STATUS_CRITICAL:
-			sensor_gps.jamming_state = 3;
-			break;
-		}
+			case SBG_ECOM_GNSS_IFM_STATUS_MITIGATED:
+				sensor_gps.jamming_state = 2;
+				break;
 
-		spoofing = sbgEComLogGnssPosGetSpoofingStatus(&gnss_data->gps_pos);
+			case SBG_ECOM_GNSS_IFM_STATUS_CRITICAL:
+				sensor_gps.jamming_state = 3;
+				break;
+			}
 
-		switch (spoofing) {
-		case SBG_ECOM_GNSS_SPOOFING_STATUS_UNKNOWN:
-			sensor_gps.spoofing_state = 0;
-			break;
+			spoofing = sbgEComLogGnssPosGetSpoofingStatus(&gnss_data->gps_pos);
 
-		case SBG_ECOM_GNSS_SPOOFING_STATUS_CLEAN:
-			sensor_gps.spoofing_state = 1;
-			break;
+			switch (spoofing) {
+			case SBG_ECOM_GNSS_SPOOFING_STATUS_UNKNOWN:
+				sensor_gps.spoofing_state = 0;
+				break;
 
-		case SBG_ECOM_GNSS_SPOOFING_STATUS_SINGLE:
-			sensor_gps.spoofing_state = 2;
-			break;
+			case SBG_ECOM_GNSS_SPOOFING_STATUS_CLEAN:
+				sensor_gps.spoofing_state = 1;
+				break;
 
-		case SBG_ECOM_GNSS_SPOOFING_STATUS_MULTIPLE:
-			sensor_gps.spoofing_state = 3;
-			break;
-		}
+			case SBG_ECOM_GNSS_SPOOFING_STATUS_SINGLE:
+				sensor_gps.spoofing_state = 2;
+				break;
 
-		sensor_gps.vel_m_s = sqrt(pow(gnss_data->gps_vel.velocity[0], 2) +
-					  pow(gnss_data->gps_vel.velocity[1], 2) +
-					  pow(gnss_data->gps_vel.velocity[2], 2));
-		sensor_gps.vel_n_m_s = gnss_data->gps_vel.velocity[0];
-		sensor_gps.vel_e_m_s = gnss_data->gps_vel.velocity[1];
-		sensor_gps.vel_d_m_s = gnss_data->gps_vel.velocity[2];
-		sensor_gps.vel_ned_valid = true;
+			case SBG_ECOM_GNSS_SPOOFING_STATUS_MULTIPLE:
+				sensor_gps.spoofing_state = 3;
+				break;
+			}
 
-		sensor_gps.cog_rad = math::radians(gnss_data->gps_vel.course);
+			sensor_gps.vel_m_s = sqrt(pow(gnss_data->gps_vel.velocity[0], 2) +
+						  pow(gnss_data->gps_vel.velocity[1], 2) +
+						  pow(gnss_data->gps_vel.velocity[2], 2));
+			sensor_gps.vel_n_m_s = gnss_data->gps_vel.velocity[0];
+			sensor_gps.vel_e_m_s = gnss_data->gps_vel.velocity[1];
+			sensor_gps.vel_d_m_s = gnss_data->gps_vel.velocity[2];
+			sensor_gps.vel_ned_valid = true;
 
-		sensor_gps.timestamp_time_relative = sensor_gps.timestamp_sample - time_now_us;
-		sensor_gps.time_utc_usec = 0;
+			sensor_gps.cog_rad = math::radians(gnss_data->gps_vel.course);
 
-		sensor_gps.satellites_used = gnss_data->gps_pos.numSvUsed;
+			sensor_gps.timestamp_time_relative = timestamp_sample - time_now_us;
+			sensor_gps.time_utc_usec = 0;
 
-		sensor_gps.heading = math::radians(gnss_data->gps_hdt.heading);
-		sensor_gps.heading_offset = math::radians(gnss_data->gps_hdt.pitch);
-		sensor_gps.heading_accuracy = math::radians(gnss_data->gps_hdt.headingAccuracy);
+			sensor_gps.satellites_used = gnss_data->gps_pos.numSvUsed;
 
-		// Check timestamp synchronization
-		const hrt_abstime max_time_diff = 1000000; // Maximum allowed time difference in microseconds (e.g., 1 second)
-		hrt_abstime pos_time = gnss_data->pos_timestamp;
-		hrt_abstime vel_time = gnss_data->vel_timestamp;
-		hrt_abstime hdt_time = gnss_data->hdt_timestamp;
+			sensor_gps.heading = math::radians(gnss_data->gps_hdt.heading);
+			sensor_gps.heading_offset = math::radians(gnss_data->gps_hdt.pitch);
+			sensor_gps.heading_accuracy = math::radians(gnss_data->gps_hdt.headingAccuracy);
 
-		if (((time_now_us - pos_time) < max_time_diff) &&
-		    ((time_now_us - vel_time) < max_time_diff) &&
-		    ((time_now_us - hdt_time) < max_time_diff) &&
-		    ((pos_time - vel_time) < max_time_diff) &&
-		    ((pos_time - hdt_time) < max_time_diff) &&
-		    ((vel_time - hdt_time) < max_time_diff)) {
-			instance->_sensor_gps_pub.publish(sensor_gps);
+			instance->_sensor_gps_pub.publish();
 			perf_count(instance->_gnss_pub_interval_perf);
 		}
 
@@ -48,6 +48,8 @@
 #include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 #include <lib/drivers/accelerometer/PX4Accelerometer.hpp>
 #include <lib/drivers/gyroscope/PX4Gyroscope.hpp>
+#include <lib/drivers/ins/InsPublication.hpp>
+#include <lib/drivers/ins/InsTimestamp.hpp>
 #include <lib/drivers/magnetometer/PX4Magnetometer.hpp>
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/airspeed.h>
@@ -268,11 +270,13 @@ private:
 	PX4Magnetometer  _px4_mag{0};
 
 	// Publications with topic dependent on multi-mode
-	uORB::PublicationMulti<sensor_gps_s> _sensor_gps_pub{ORB_ID(sensor_gps)};
-	uORB::PublicationMulti<vehicle_attitude_s> _attitude_pub{ORB_ID(vehicle_attitude)};
-	uORB::PublicationMulti<vehicle_local_position_s> _local_position_pub{ORB_ID(vehicle_local_position)};
-	uORB::PublicationMulti<vehicle_global_position_s> _global_position_pub{ORB_ID(vehicle_global_position)};
-	uORB::Publication<estimator_status_s> _estimator_status_pub{ORB_ID(estimator_status)};
+	InsTimestamp _timestamp{};
+
+	InsPublication<sensor_gps_s> _sensor_gps_pub{ORB_ID(sensor_gps)};
+	InsPublication<vehicle_attitude_s> _attitude_pub{ORB_ID(vehicle_attitude)};
+	InsPublication<vehicle_local_position_s> _local_position_pub{ORB_ID(vehicle_local_position)};
+	InsPublication<vehicle_global_position_s> _global_position_pub{ORB_ID(vehicle_global_position)};
+	InsPublication<estimator_status_s, uORB::Publication<estimator_status_s>> _estimator_status_pub{ORB_ID(estimator_status)};
 
 	// Subscription for INS EKF aiding
 	uORB::Subscription _air_data_sub{ORB_ID(vehicle_air_data)};
@@ -136,9 +136,6 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 
 	//size_t curGroupFieldIndex = 0;
 
-	// low pass offset between VN and hrt
-	// use timestamp for publish and timestamp_sample
-
 	// binary output 1
 	if (VnUartPacket_isCompatible(packet,
 				      COMMONGROUP_NONE,
@@ -150,8 +147,8 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 				      GPSGROUP_NONE)
 	   ) {
 		// TIMEGROUP_TIMESTARTUP
-		uint64_t time_startup = VnUartPacket_extractUint64(packet);
-		(void)time_startup;
+		const uint64_t time_startup = VnUartPacket_extractUint64(packet); // ns
+		const hrt_abstime timestamp_sample = _timestamp.update(time_startup / 1000, time_now_us);
 
 		// IMUGROUP_ACCEL
 		vec3f accel = VnUartPacket_extractVec3f(packet);
@@ -160,11 +157,11 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 		vec3f angular_rate = VnUartPacket_extractVec3f(packet);
 
 		// publish sensor_accel
-		_px4_accel.update(time_now_us, accel.c[0], accel.c[1], accel.c[2]);
+		_px4_accel.update(timestamp_sample, accel.c[0], accel.c[1], accel.c[2]);
 		perf_count(_accel_pub_interval_perf);
 
 		// publish sensor_gyro
-		_px4_gyro.update(time_now_us, angular_rate.c[0], angular_rate.c[1], angular_rate.c[2]);
+		_px4_gyro.update(timestamp_sample, angular_rate.c[0], angular_rate.c[1], angular_rate.c[2]);
 		perf_count(_gyro_pub_interval_perf);
 
 		_time_last_valid_imu_us.store(hrt_absolute_time());
@@ -181,8 +178,8 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 				      GPSGROUP_NONE)
 	   ) {
 		// TIMEGROUP_TIMESTARTUP
-		const uint64_t time_startup = VnUartPacket_extractUint64(packet);
-		(void)time_startup;
+		const uint64_t time_startup = VnUartPacket_extractUint64(packet); // ns
+		const hrt_abstime timestamp_sample = _timestamp.update(time_startup / 1000, time_now_us);
 
 		// IMUGROUP_TEMP
 		const float temperature = VnUartPacket_extractFloat(packet);
@@ -221,27 +218,23 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 		_px4_mag.set_temperature(temperature);
 
 		// publish sensor_baro
-		sensor_baro_s sensor_baro{};
+		sensor_baro_s &sensor_baro = _sensor_baro_pub.get(timestamp_sample);
 		sensor_baro.device_id = 0; // TODO: DRV_INS_DEVTYPE_VN300;
 		sensor_baro.pressure = pressure;
 		sensor_baro.temperature = temperature;
-		sensor_baro.timestamp = hrt_absolute_time();
-		_sensor_baro_pub.publish(sensor_baro);
+		_sensor_baro_pub.publish();
 		perf_count(_baro_pub_interval_perf);
 
 		// publish sensor_mag
-		_px4_mag.update(time_now_us, mag.c[0], mag.c[1], mag.c[2]);
+		_px4_mag.update(timestamp_sample, mag.c[0], mag.c[1], mag.c[2]);
 		perf_count(_mag_pub_interval_perf);
 
 		// publish attitude
-		vehicle_attitude_s attitude{};
-		attitude.timestamp_sample = time_now_us;
-		attitude.q[0] = quaternion.c[3];
-		attitude.q[1] = quaternion.c[0];
-		attitude.q[2] = quaternion.c[1];
-		attitude.q[3] = quaternion.c[2];
-		attitude.timestamp = hrt_absolute_time();
-		_attitude_pub.publish(attitude);
+		const matrix::Quatf q{quaternion.c[3], quaternion.c[0], quaternion.c[1], quaternion.c[2]};
+
+		vehicle_attitude_s &attitude = _attitude_pub.get(timestamp_sample);
+		q.copyTo(attitude.q);
+		_attitude_pub.publish();
 		perf_count(_attitude_pub_interval_perf);
 
 		// mode
@@ -278,14 +271,13 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 			const float alt_ellipsoid = positionEstimatedLla.c[2];
 
 			if (!_pos_ref.isInitialized()) {
-				_pos_ref.initReference(lat, lon, time_now_us);
+				_pos_ref.initReference(lat, lon, timestamp_sample);
 				_gps_alt_ref = alt_ellipsoid;
 			}
 
 			const Vector2f pos_ned = _pos_ref.project(lat, lon);
 
-			vehicle_local_position_s local_position{};
-			local_position.timestamp_sample = time_now_us;
+			vehicle_local_position_s &local_position = _local_position_pub.get(timestamp_sample);
 
 			local_position.xy_valid = true;
 			local_position.z_valid = true;
@@ -305,7 +297,6 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 			local_position.ay = accelerationLinearNed.c[1];
 			local_position.az = accelerationLinearNed.c[2];
 
-			matrix::Quatf q{attitude.q};
 			local_position.heading = matrix::Eulerf{q}.psi();
 			local_position.heading_good_for_control = mode_tracking;
 
@@ -334,14 +325,12 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 			local_position.hagl_max_xy = INFINITY;
 
 			local_position.unaided_heading = NAN;
-			local_position.timestamp = hrt_absolute_time();
-			_local_position_pub.publish(local_position);
+			_local_position_pub.publish();
 			perf_count(_local_position_pub_interval_perf);
 
 
 			// publish global_position
-			vehicle_global_position_s global_position{};
-			global_position.timestamp_sample = time_now_us;
+			vehicle_global_position_s &global_position = _global_position_pub.get(timestamp_sample);
 			global_position.lat = lat;
 			global_position.lon = lon;
 			global_position.lat_lon_valid = true;
@@ -352,16 +341,14 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 			global_position.eph = positionUncertaintyEstimated;
 			global_position.epv = positionUncertaintyEstimated;
 
-			global_position.timestamp = hrt_absolute_time();
-			_global_position_pub.publish(global_position);
+			_global_position_pub.publish();
 			perf_count(_global_position_pub_interval_perf);
 		}
 
 		// publish estimator_status (VN_MODE 1 only)
 		if (_param_vn_mode.get() == 1) {
 
-			estimator_status_s estimator_status{};
-			estimator_status.timestamp_sample = time_now_us;
+			estimator_status_s &estimator_status = _estimator_status_pub.get(timestamp_sample);
 
 			float test_ratio = 0.f;
 
@@ -381,8 +368,7 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 			estimator_status.accel_device_id = _px4_accel.get_device_id();
 			estimator_status.gyro_device_id = _px4_gyro.get_device_id();
 
-			estimator_status.timestamp = hrt_absolute_time();
-			_estimator_status_pub.publish(estimator_status);
+			_estimator_status_pub.publish();
 
 		}
 	}
@@ -399,8 +385,8 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 				      GPSGROUP_NONE)
 	   ) {
 		// TIMEGROUP_TIMESTARTUP
-		const uint64_t time_startup = VnUartPacket_extractUint64(packet);
-		(void)time_startup;
+		const uint64_t time_startup = VnUartPacket_extractUint64(packet); // ns
+		const hrt_abstime timestamp_sample = _timestamp.update(time_startup / 1000, time_now_us);
 
 		// GPSGROUP_UTC
 		TimeUtc timeUtc = VnUartPacket_extractTimeUtc(packet);
@@ -430,8 +416,7 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 
 		// publish sensor_gnss
 		if (gpsFix > 0) {
-			sensor_gps_s sensor_gps{};
-			sensor_gps.timestamp_sample = time_now_us;
+			sensor_gps_s &sensor_gps = _sensor_gps_pub.get(timestamp_sample);
 
 			sensor_gps.device_id = 0; // TODO
 
@@ -460,8 +445,7 @@ void VectorNav::sensorCallback(VnUartPacket *packet)
 
 			sensor_gps.s_variance_m_s = velocityUncertaintyGps;
 
-			sensor_gps.timestamp = hrt_absolute_time();
-			_sensor_gps_pub.publish(sensor_gps);
+			_sensor_gps_pub.publish();
 			perf_count(_gnss_pub_interval_perf);
 		}
 	}
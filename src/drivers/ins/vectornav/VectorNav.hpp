@@ -55,6 +55,8 @@ extern "C" {
 #include <drivers/drv_hrt.h>
 #include <lib/drivers/accelerometer/PX4Accelerometer.hpp>
 #include <lib/drivers/gyroscope/PX4Gyroscope.hpp>
+#include <lib/drivers/ins/InsPublication.hpp>
+#include <lib/drivers/ins/InsTimestamp.hpp>
 #include <lib/drivers/magnetometer/PX4Magnetometer.hpp>
 #include <lib/geo/geo.h>
 #include <lib/perf/perf_counter.h>
@@ -134,16 +136,18 @@ private:
 	MapProjection _pos_ref{};
 	float _gps_alt_ref{NAN};		///< WGS-84 height (m)
 
-	uORB::PublicationMulti<sensor_baro_s> _sensor_baro_pub{ORB_ID(sensor_baro)};
-	uORB::PublicationMulti<sensor_gps_s> _sensor_gps_pub{ORB_ID(sensor_gps)};
+	InsTimestamp _timestamp{};
+
+	InsPublication<sensor_baro_s> _sensor_baro_pub{ORB_ID(sensor_baro)};
+	InsPublication<sensor_gps_s> _sensor_gps_pub{ORB_ID(sensor_gps)};
 
 	uORB::Publication<sensor_selection_s> _sensor_selection_pub{ORB_ID(sensor_selection)};
 
-	uORB::PublicationMulti<vehicle_attitude_s> _attitude_pub;
-	uORB::PublicationMulti<vehicle_local_position_s> _local_position_pub;
-	uORB::PublicationMulti<vehicle_global_position_s> _global_position_pub;
+	InsPublication<vehicle_attitude_s> _attitude_pub;
+	InsPublication<vehicle_local_position_s> _local_position_pub;
+	InsPublication<vehicle_global_position_s> _global_position_pub;
 
-	uORB::Publication<estimator_status_s> _estimator_status_pub{ORB_ID(estimator_status)};
+	InsPublication<estimator_status_s, uORB::Publication<estimator_status_s>> _estimator_status_pub{ORB_ID(estimator_status)};
 
 	perf_counter_t _comms_errors{perf_alloc(PC_COUNT, MODULE_NAME": com_err")};
 	perf_counter_t _sample_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": read")};
@@ -161,7 +161,7 @@ void AK09916::RunImpl()
 		if (Configure()) {
 			// if configure succeeded then start reading
 			_state = STATE::READ;
-			ScheduleOnInterval(20_ms, 20_ms); // 50 Hz
+			ScheduleOnInterval(20_ms, device::I2CBusScheduler::aligned_delay(get_device_bus(), 20_ms, 20_ms)); // 50 Hz
 
 		} else {
 			// CONFIGURE not complete
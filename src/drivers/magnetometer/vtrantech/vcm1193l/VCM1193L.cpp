@@ -148,7 +148,7 @@ void VCM1193L::RunImpl()
 		if (Configure()) {
 			// if configure succeeded then start reading every 20 ms (50 Hz)
 			_state = STATE::READ;
-			ScheduleOnInterval(20_ms, 20_ms);
+			ScheduleOnInterval(20_ms, device::I2CBusScheduler::aligned_delay(get_device_bus(), 20_ms, 20_ms));
 
 		} else {
 			// CONFIGURE not complete
@@ -44,6 +44,7 @@
 
 #include <drivers/drv_hrt.h>
 #include <lib/drivers/device/i2c.h>
+#include <lib/drivers/device/I2CBusScheduler.hpp>
 #include <lib/drivers/magnetometer/PX4Magnetometer.hpp>
 #include <lib/perf/perf_counter.h>
 #include <px4_platform_common/i2c_spi_buses.h>
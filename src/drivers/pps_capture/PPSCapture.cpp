@@ -56,8 +56,13 @@ PPSCapture::PPSCapture() :
 PPSCapture::~PPSCapture()
 {
 	if (_channel >= 0) {
-		io_timer_unallocate_channel(_channel);
-		px4_arch_gpiosetevent(_pps_capture_gpio, false, false, false, nullptr, nullptr);
+		if (_timer_capture) {
+			up_input_capture_set(_channel, Disabled, 0, nullptr, nullptr);
+
+		} else {
+			io_timer_unallocate_channel(_channel);
+			px4_arch_gpiosetevent(_pps_capture_gpio, false, false, false, nullptr, nullptr);
+		}
 	}
 }
 
@@ -91,6 +96,13 @@ bool PPSCapture::init()
 		return false;
 	}
 
+	// prefer the timer input capture, the edge time is then taken from the capture register instead of
+	// the (jittering) interrupt entry time
+	if (up_input_capture_set(_channel, Rising, 0, &PPSCapture::input_capture_callback, this) == PX4_OK) {
+		_timer_capture = true;
+		return true;
+	}
+
 	int ret = io_timer_allocate_channel(_channel, IOTimerChanMode_PPS);
 
 	if (ret != PX4_OK) {
@@ -122,12 +134,18 @@ void PPSCapture::Run()
 		_last_gps_timestamp = sensor_gps.timestamp;
 	}
 
+	const hrt_abstime pps_timestamp = _hrt_timestamp;
+	update_discipline(pps_timestamp);
+
 	pps_capture_s pps_capture;
-	pps_capture.timestamp = _hrt_timestamp;
+	pps_capture.timestamp = pps_timestamp;
 	pps_capture.pps_rate_exceeded_counter = _pps_rate_exceeded_counter;
-	// GPS UTC time when the GPIO interrupt was triggered
-	// Last UTC time received from the GPS + elapsed time to the PPS interrupt
-	uint64_t gps_utc_time = _last_gps_utc_timestamp + (_hrt_timestamp - _last_gps_timestamp);
+	pps_capture.timer_capture = _timer_capture;
+	pps_capture.hrt_drift_ppm = _hrt_drift_ppm;
+	pps_capture.jitter_us = _jitter_us;
+	// GPS UTC time when the PPS edge was captured
+	// Last UTC time received from the GPS + elapsed time to the PPS edge
+	uint64_t gps_utc_time = _last_gps_utc_timestamp + (pps_timestamp - _last_gps_timestamp);
 
 	// (For ubx F9P) The rising edge of the PPS pulse is aligned to the top of second GPS time base.
 	// So, remove the fraction of second and shift to the next second. The interrupt is triggered
@@ -145,28 +163,81 @@ void PPSCapture::Run()
 	}
 }
 
-int PPSCapture::gpio_interrupt_callback(int irq, void *context, void *arg)
+void PPSCapture::update_discipline(hrt_abstime pps_timestamp)
 {
-	PPSCapture *instance = static_cast<PPSCapture *>(arg);
+	if ((_last_pps_timestamp != 0) && (pps_timestamp > _last_pps_timestamp)
+	    && (pps_timestamp - _last_pps_timestamp < MAX_DISCIPLINE_INTERVAL)) {
+
+		const hrt_abstime interval = pps_timestamp - _last_pps_timestamp;
 
-	hrt_abstime interrupt_time = hrt_absolute_time();
+		// whole seconds, as pulses can be missed
+		const uint64_t seconds = (interval + USEC_PER_SEC / 2) / USEC_PER_SEC;
 
-	if ((interrupt_time - instance->_hrt_timestamp) < 50_ms) {
-		++(instance->_pps_rate_exceeded_counter);
+		if (seconds > 0) {
+			// microseconds per second is ppm
+			const float error_ppm = (float)((int64_t)interval - (int64_t)(seconds * USEC_PER_SEC)) / (float)seconds;
+
+			if (fabsf(error_ppm) < MAX_DRIFT_PPM) {
+				if (!PX4_ISFINITE(_jitter_us)) {
+					_hrt_drift_ppm = error_ppm;
+					_jitter_us = 0.f;
+
+				} else {
+					const float residual = error_ppm - _hrt_drift_ppm;
+					_hrt_drift_ppm += DISCIPLINE_GAIN * residual;
+					_jitter_us += DISCIPLINE_GAIN * (fabsf(residual) - _jitter_us);
+				}
+			}
+		}
+	}
+
+	_last_pps_timestamp = pps_timestamp;
+}
+
+void PPSCapture::edge_captured(hrt_abstime edge_time)
+{
+	if ((edge_time - _hrt_timestamp) < 50_ms) {
+		++_pps_rate_exceeded_counter;
 
-		if (instance->_pps_rate_exceeded_counter >= 10) {
+		if (_pps_rate_exceeded_counter >= 10) {
 			// Trigger rate too high, stop future interrupts
-			px4_arch_gpiosetevent(instance->_pps_capture_gpio, false, false, false, nullptr, nullptr);
-			instance->_pps_rate_failure.store(true);
+			disable_capture();
+			_pps_rate_failure.store(true);
 		}
 	}
 
-	instance->_hrt_timestamp = interrupt_time;
-	instance->ScheduleNow(); // schedule work queue to publish PPS captured time
+	_hrt_timestamp = edge_time;
+	ScheduleNow(); // schedule work queue to publish PPS captured time
+}
+
+void PPSCapture::disable_capture()
+{
+	if (_timer_capture) {
+		up_input_capture_set(_channel, Disabled, 0, nullptr, nullptr);
+
+	} else {
+		px4_arch_gpiosetevent(_pps_capture_gpio, false, false, false, nullptr, nullptr);
+	}
+}
+
+int PPSCapture::gpio_interrupt_callback(int irq, void *context, void *arg)
+{
+	PPSCapture *instance = static_cast<PPSCapture *>(arg);
+
+	instance->edge_captured(hrt_absolute_time());
 
 	return PX4_OK;
 }
 
+void PPSCapture::input_capture_callback(void *context, uint32_t chan_index, hrt_abstime edge_time, uint32_t edge_state,
+					uint32_t overflow)
+{
+	PPSCapture *instance = static_cast<PPSCapture *>(context);
+
+	// edge time of the capture register, not affected by the interrupt latency
+	instance->edge_captured(edge_time);
+}
+
 int PPSCapture::task_spawn(int argc, char *argv[])
 {
 	PPSCapture *instance = new PPSCapture();
@@ -206,6 +277,10 @@ int PPSCapture::print_usage(const char *reason)
 ### Description
 This implements capturing PPS information from the GNSS module and calculates the drift between PPS and Real-time clock.
 
+The PPS edge is timestamped with the timer input capture of the configured channel if available, otherwise in
+the GPIO interrupt handler. The rate error of the hrt clock against the PPS second and the PPS jitter are estimated
+from consecutive pulses and published with the capture, to discipline timestamps derived from the PPS (e.g. camera capture).
+
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("pps_capture", "driver");
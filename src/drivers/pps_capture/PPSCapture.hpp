@@ -34,6 +34,7 @@
 #pragma once
 
 #include <drivers/drv_hrt.h>
+#include <drivers/drv_input_capture.h>
 #include <px4_arch/micro_hal.h>
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
@@ -65,20 +66,40 @@ public:
 
 	static int gpio_interrupt_callback(int irq, void *context, void *arg);
 
+	static void input_capture_callback(void *context, uint32_t chan_index, hrt_abstime edge_time, uint32_t edge_state,
+					   uint32_t overflow);
+
 	/** PPSCapture is an interrupt-driven task and needs to be manually stopped */
 	static void stop();
 
 private:
 	void Run() override;
 
+	void edge_captured(hrt_abstime edge_time);
+	void disable_capture();
+
+	/**
+	 * Estimate the hrt clock rate error from the PPS interval.
+	 */
+	void update_discipline(hrt_abstime pps_timestamp);
+
+	static constexpr uint64_t MAX_DISCIPLINE_INTERVAL{5_s};	///< longer gaps (missed pulses) are not used
+	static constexpr float MAX_DRIFT_PPM{500.f};		///< larger errors are outliers (spurious edges)
+	static constexpr float DISCIPLINE_GAIN{0.1f};
+
 	int _channel{-1};
 	uint32_t _pps_capture_gpio{0};
 	uORB::Publication<pps_capture_s>	_pps_capture_pub{ORB_ID(pps_capture)};
 	uORB::Subscription								_sensor_gps_sub{ORB_ID(sensor_gps)};
 	orb_advert_t											_mavlink_log_pub{nullptr};
 
+	bool _timer_capture{false};
 	hrt_abstime _hrt_timestamp{0};
 
+	hrt_abstime _last_pps_timestamp{0};
+	float _hrt_drift_ppm{0.f};
+	float _jitter_us{NAN};
+
 	hrt_abstime	_last_gps_timestamp{0};
 	uint64_t		_last_gps_utc_timestamp{0};
 	uint8_t			_pps_rate_exceeded_counter{0};
@@ -1030,7 +1030,22 @@ int PX4IO::io_get_status()
 
 int PX4IO::io_publish_raw_rc()
 {
-	const uint16_t rc_valid_update_count = io_reg_get(PX4IO_PAGE_RAW_RC_INPUT, PX4IO_P_RAW_FRAME_COUNT);
+	const unsigned prolog = (PX4IO_P_RAW_RC_BASE - PX4IO_P_RAW_RC_COUNT);
+	uint16_t regs[input_rc_s::RC_INPUT_MAX_CHANNELS + prolog];
+
+	/*
+	 * Read the prolog (channel count, flags and frame counters) and the first 9 channels in a single
+	 * transaction, instead of polling the frame counter on its own first.
+	 *
+	 * This should be the common case (9 channel R/C control being a reasonable upper bound).
+	 */
+	int ret = io_reg_get(PX4IO_PAGE_RAW_RC_INPUT, PX4IO_P_RAW_RC_COUNT, &regs[0], prolog + 9);
+
+	if (ret != OK) {
+		return ret;
+	}
+
+	const uint16_t rc_valid_update_count = regs[PX4IO_P_RAW_FRAME_COUNT];
 	const bool rc_updated = (rc_valid_update_count != _rc_valid_update_count);
 	_rc_valid_update_count = rc_valid_update_count;
 
@@ -1050,20 +1065,6 @@ int PX4IO::io_publish_raw_rc()
 	/* we don't have the status bits, so input_source has to be set elsewhere */
 	input_rc.input_source = input_rc_s::RC_INPUT_SOURCE_UNKNOWN;
 
-	const unsigned prolog = (PX4IO_P_RAW_RC_BASE - PX4IO_P_RAW_RC_COUNT);
-	uint16_t regs[input_rc_s::RC_INPUT_MAX_CHANNELS + prolog];
-
-	/*
-	 * Read the channel count and the first 9 channels.
-	 *
-	 * This should be the common case (9 channel R/C control being a reasonable upper bound).
-	 */
-	int ret = io_reg_get(PX4IO_PAGE_RAW_RC_INPUT, PX4IO_P_RAW_RC_COUNT, &regs[0], prolog + 9);
-
-	if (ret != OK) {
-		return ret;
-	}
-
 	/*
 	 * Get the channel count any any extra channels. This is no more expensive than reading the
 	 * channel count once.
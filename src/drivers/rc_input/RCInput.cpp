@@ -765,8 +765,9 @@ void RCInput::Run()
 							_rc_scan_locked = true;
 						}
 
+						// reply in the telemetry slot following the RC frame
 						if (_crsf_telemetry) {
-							_crsf_telemetry->update(cycle_timestamp);
+							_crsf_telemetry->send(cycle_timestamp);
 						}
 					}
 				}
@@ -819,8 +820,9 @@ void RCInput::Run()
 							_rc_scan_locked = true;
 						}
 
+						// reply in the telemetry slot following the RC frame
 						if (_ghst_telemetry) {
-							_ghst_telemetry->update(cycle_timestamp);
+							_ghst_telemetry->send(cycle_timestamp);
 						}
 					}
 				}
@@ -851,6 +853,17 @@ void RCInput::Run()
 			PX4_INFO("RC scan: %s RC input locked", RC_SCAN_STRING[_rc_scan_state]);
 		}
 
+		// prepare the telemetry frames for the next slot after RC decoding and publishing
+		if (_crsf_telemetry) {
+			_crsf_telemetry->update_frames();
+		}
+
+		if (_ghst_telemetry) {
+			_ghst_telemetry->update_frames();
+		}
+
+		update_schedule_interval(cycle_timestamp, rc_updated);
+
 		// set RC_INPUT_PROTO if RC successfully locked for > 3 seconds
 		if (!_armed && rc_updated && _rc_scan_locked
 		    && ((_rc_scan_begin != 0) && hrt_elapsed_time(&_rc_scan_begin) > 3_s)
@@ -863,6 +876,42 @@ void RCInput::Run()
 	}
 }
 
+void RCInput::update_schedule_interval(hrt_abstime now, bool rc_updated)
+{
+	unsigned update_interval = _update_interval;
+
+	if (!_rc_scan_locked || _rc_scan_state == RC_SCAN_PPM) {
+		_last_frame_time = 0;
+		_frame_interval = 0;
+		update_interval = _current_update_interval;
+
+	} else if (rc_updated) {
+		// The serial driver hands over whole frames once the line goes idle. Poll at twice the
+		// received frame rate, so that fast links (e.g. CRSF at 500 Hz) are decoded within half
+		// a frame period instead of waiting for the next 4 ms cycle.
+		if (_last_frame_time != 0) {
+			const unsigned frame_interval = now - _last_frame_time;
+
+			if (_frame_interval == 0) {
+				_frame_interval = frame_interval;
+
+			} else {
+				_frame_interval = (7 * _frame_interval + frame_interval) / 8;
+			}
+
+			// 500 us steps, so that jitter doesn't reschedule every cycle
+			update_interval = math::constrain((_frame_interval / 2) / 500 * 500, _min_update_interval, _current_update_interval);
+		}
+
+		_last_frame_time = now;
+	}
+
+	if (update_interval != _update_interval) {
+		_update_interval = update_interval;
+		ScheduleOnInterval(_update_interval);
+	}
+}
+
 #if defined(SPEKTRUM_POWER)
 bool RCInput::bind_spektrum(int arg) const
 {
@@ -934,7 +983,8 @@ int RCInput::custom_command(int argc, char *argv[])
 
 int RCInput::print_status()
 {
-	PX4_INFO("Max update rate: %u Hz", 1000000 / _current_update_interval);
+	PX4_INFO("Max update rate: %u Hz", 1000000 / _min_update_interval);
+	PX4_INFO("Update rate: %u Hz", 1000000 / _update_interval);
 
 	if (_device[0] != '\0') {
 		PX4_INFO("UART device: %s", _device);
@@ -38,6 +38,7 @@
 #include <board_config.h>
 #include <drivers/drv_adc.h>
 #include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
 #include <lib/perf/perf_counter.h>
 #include <lib/rc/crsf.h>
 #include <lib/rc/ghst.hpp>
@@ -130,6 +131,8 @@ private:
 	void rc_io_invert(bool invert);
 	void swap_rx_tx(void);
 
+	void update_schedule_interval(hrt_abstime now, bool rc_updated);
+
 	input_rc_s _input_rc{};
 	hrt_abstime _rc_scan_begin{0};
 
@@ -137,6 +140,11 @@ private:
 	bool _rc_scan_locked{false};
 
 	static constexpr unsigned	_current_update_interval{4000}; // 250 Hz
+	static constexpr unsigned	_min_update_interval{1000}; // 1 kHz for fast serial links
+
+	unsigned	_update_interval{_current_update_interval};
+	hrt_abstime	_last_frame_time{0};
+	unsigned	_frame_interval{0}; // filtered interval between received frames [us]
 
 	uORB::SubscriptionInterval _parameter_update_sub{ORB_ID(parameter_update), 1_s};
 
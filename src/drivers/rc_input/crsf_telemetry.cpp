@@ -34,12 +34,24 @@
 #include "crsf_telemetry.h"
 #include <lib/rc/crsf.h>
 
+#include <unistd.h>
+
 CRSFTelemetry::CRSFTelemetry(int uart_fd) :
 	_uart_fd(uart_fd)
 {
 }
 
-bool CRSFTelemetry::update(const hrt_abstime &now)
+bool CRSFTelemetry::update_frames()
+{
+	bool updated = false;
+	updated |= build_battery(_frames[0]);
+	updated |= build_gps(_frames[1]);
+	updated |= build_attitude(_frames[2]);
+	updated |= build_flight_mode(_frames[3]);
+	return updated;
+}
+
+bool CRSFTelemetry::send(const hrt_abstime &now)
 {
 	const int update_rate_hz = 10;
 
@@ -47,33 +59,22 @@ bool CRSFTelemetry::update(const hrt_abstime &now)
 		return false;
 	}
 
-	bool sent = false;
-
-	switch (_next_type) {
-	case 0:
-		sent = send_battery();
-		break;
-
-	case 1:
-		sent = send_gps();
-		break;
-
-	case 2:
-		sent = send_attitude();
-		break;
+	// round robin over the frames that changed since they were last sent
+	for (int i = 0; i < num_data_types; i++) {
+		TelemetryFrame &frame = _frames[(_next_type + i) % num_data_types];
 
-	case 3:
-		sent = send_flight_mode();
-		break;
+		if (frame.ready) {
+			frame.ready = false;
+			_last_update = now;
+			_next_type = (_next_type + i + 1) % num_data_types;
+			return write(_uart_fd, frame.buf, frame.length) == frame.length;
+		}
 	}
 
-	_last_update = now;
-	_next_type = (_next_type + 1) % num_data_types;
-
-	return sent;
+	return false;
 }
 
-bool CRSFTelemetry::send_battery()
+bool CRSFTelemetry::build_battery(TelemetryFrame &frame)
 {
 	battery_status_s battery_status;
 
@@ -85,10 +86,12 @@ bool CRSFTelemetry::send_battery()
 	uint16_t current = battery_status.current_a * 10;
 	int fuel = battery_status.discharged_mah;
 	uint8_t remaining = battery_status.remaining * 100;
-	return crsf_send_telemetry_battery(_uart_fd, voltage, current, fuel, remaining);
+	frame.length = crsf_build_telemetry_battery(frame.buf, voltage, current, fuel, remaining);
+	frame.ready = true;
+	return true;
 }
 
-bool CRSFTelemetry::send_gps()
+bool CRSFTelemetry::build_gps(TelemetryFrame &frame)
 {
 	sensor_gps_s vehicle_gps_position;
 
@@ -103,11 +106,13 @@ bool CRSFTelemetry::send_gps()
 	uint16_t altitude = static_cast<int16_t>(round(vehicle_gps_position.altitude_msl_m + 1.0));
 	uint8_t num_satellites = vehicle_gps_position.satellites_used;
 
-	return crsf_send_telemetry_gps(_uart_fd, latitude, longitude, groundspeed,
-				       gps_heading, altitude, num_satellites);
+	frame.length = crsf_build_telemetry_gps(frame.buf, latitude, longitude, groundspeed,
+						gps_heading, altitude, num_satellites);
+	frame.ready = true;
+	return true;
 }
 
-bool CRSFTelemetry::send_attitude()
+bool CRSFTelemetry::build_attitude(TelemetryFrame &frame)
 {
 	vehicle_attitude_s vehicle_attitude;
 
@@ -119,10 +124,12 @@ bool CRSFTelemetry::send_attitude()
 	int16_t pitch = attitude(1) * 1e4f;
 	int16_t roll = attitude(0) * 1e4f;
 	int16_t yaw = attitude(2) * 1e4f;
-	return crsf_send_telemetry_attitude(_uart_fd, pitch, roll, yaw);
+	frame.length = crsf_build_telemetry_attitude(frame.buf, pitch, roll, yaw);
+	frame.ready = true;
+	return true;
 }
 
-bool CRSFTelemetry::send_flight_mode()
+bool CRSFTelemetry::build_flight_mode(TelemetryFrame &frame)
 {
 	vehicle_status_s vehicle_status;
 
@@ -183,5 +190,7 @@ bool CRSFTelemetry::send_flight_mode()
 		break;
 	}
 
-	return crsf_send_telemetry_flight_mode(_uart_fd, flight_mode);
+	frame.length = crsf_build_telemetry_flight_mode(frame.buf, flight_mode);
+	frame.ready = true;
+	return true;
 }
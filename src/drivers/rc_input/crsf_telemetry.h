@@ -45,6 +45,7 @@
 #include <uORB/topics/sensor_gps.h>
 #include <uORB/topics/vehicle_status.h>
 #include <drivers/drv_hrt.h>
+#include <lib/rc/crsf.h>
 
 #include <matrix/math.hpp>
 #include <mathlib/mathlib.h>
@@ -66,17 +67,30 @@ public:
 	~CRSFTelemetry() = default;
 
 	/**
-	 * Send telemetry data. Call this regularly (i.e. at 100Hz), it will automatically
-	 * limit the sending rate.
+	 * Rebuild the telemetry frames of updated topics. Call this regularly outside of RC
+	 * decoding, the frames are kept ready for the next telemetry slot.
+	 * @return true if a frame was rebuilt
+	 */
+	bool update_frames();
+
+	/**
+	 * Send the next ready telemetry frame. Call this right after an RC frame was received,
+	 * it will automatically limit the sending rate.
 	 * @return true if new data sent
 	 */
-	bool update(const hrt_abstime &now);
+	bool send(const hrt_abstime &now);
 
 private:
-	bool send_battery();
-	bool send_gps();
-	bool send_attitude();
-	bool send_flight_mode();
+	struct TelemetryFrame {
+		uint8_t buf[CRSF_TELEMETRY_FRAME_SIZE_MAX];
+		int length{0};
+		bool ready{false};
+	};
+
+	bool build_battery(TelemetryFrame &frame);
+	bool build_gps(TelemetryFrame &frame);
+	bool build_attitude(TelemetryFrame &frame);
+	bool build_flight_mode(TelemetryFrame &frame);
 
 	uORB::Subscription _vehicle_gps_position_sub{ORB_ID(vehicle_gps_position)};
 	uORB::Subscription _battery_status_sub{ORB_ID(battery_status)};
@@ -88,5 +102,7 @@ private:
 	static constexpr int num_data_types{4}; ///< number of different telemetry data types
 	int _next_type{0};
 
+	TelemetryFrame _frames[num_data_types] {};
+
 	int _uart_fd;
 };
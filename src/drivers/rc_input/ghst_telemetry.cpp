@@ -43,6 +43,8 @@
 #include "ghst_telemetry.hpp"
 #include <lib/rc/ghst.hpp>
 
+#include <unistd.h>
+
 using time_literals::operator ""_s;
 
 GHSTTelemetry::GHSTTelemetry(int uart_fd) :
@@ -50,59 +52,56 @@ GHSTTelemetry::GHSTTelemetry(int uart_fd) :
 {
 }
 
-bool GHSTTelemetry::update(const hrt_abstime &now)
+bool GHSTTelemetry::update_frames()
 {
-	bool success = false;
-
-	if ((now - _last_update) > (1_s / (UPDATE_RATE_HZ * NUM_DATA_TYPES))) {
-
-		switch (_next_type) {
-		case 0U:
-			success = send_battery_status();
-			break;
+	bool updated = false;
+	updated |= build_battery_status(_frames[0]);
+	updated |= build_gps_status(_frames[1], _frames[2]);
+	return updated;
+}
 
-		case 1U:
-			success = send_gps1_status();
-			break;
+bool GHSTTelemetry::send(const hrt_abstime &now)
+{
+	if ((now - _last_update) <= (1_s / (UPDATE_RATE_HZ * NUM_DATA_TYPES))) {
+		return false;
+	}
 
-		case 2U:
-			success = send_gps2_status();
-			break;
+	// round robin over the frames that changed since they were last sent
+	for (uint32_t i = 0U; i < NUM_DATA_TYPES; i++) {
+		TelemetryFrame &frame = _frames[(_next_type + i) % NUM_DATA_TYPES];
 
-		default:
-			success = false;
-			break;
+		if (frame.ready) {
+			frame.ready = false;
+			_last_update = now;
+			_next_type = (_next_type + i + 1U) % NUM_DATA_TYPES;
+			return write(_uart_fd, frame.buf, frame.length) == frame.length;
 		}
-
-		_last_update = now;
-		_next_type = (_next_type + 1U) % NUM_DATA_TYPES;
 	}
 
-	return success;
+	return false;
 }
 
-bool GHSTTelemetry::send_battery_status()
+bool GHSTTelemetry::build_battery_status(TelemetryFrame &frame)
 {
-	bool success = false;
-	float voltage_in_10mV;
-	float current_in_10mA;
-	float fuel_in_10mAh;
 	battery_status_s battery_status;
 
-	if (_battery_status_sub.update(&battery_status)) {
-		voltage_in_10mV = battery_status.voltage_v * FACTOR_VOLTS_TO_10MV;
-		current_in_10mA = battery_status.current_a * FACTOR_AMPS_TO_10MA;
-		fuel_in_10mAh = battery_status.discharged_mah * FACTOR_MAH_TO_10MAH;
-		success = ghst_send_telemetry_battery_status(_uart_fd,
-				static_cast<uint16_t>(voltage_in_10mV),
-				static_cast<uint16_t>(current_in_10mA),
-				static_cast<uint16_t>(fuel_in_10mAh));
+	if (!_battery_status_sub.update(&battery_status)) {
+		return false;
 	}
 
-	return success;
+	const float voltage_in_10mV = battery_status.voltage_v * FACTOR_VOLTS_TO_10MV;
+	const float current_in_10mA = battery_status.current_a * FACTOR_AMPS_TO_10MA;
+	const float fuel_in_10mAh = battery_status.discharged_mah * FACTOR_MAH_TO_10MAH;
+	frame.length = ghst_build_telemetry_battery_status(frame.buf,
+			static_cast<uint16_t>(voltage_in_10mV),
+			static_cast<uint16_t>(current_in_10mA),
+			static_cast<uint16_t>(fuel_in_10mAh));
+	frame.ready = true;
+
+	return true;
 }
 
-bool GHSTTelemetry::send_gps1_status()
+bool GHSTTelemetry::build_gps_status(TelemetryFrame &gps1_frame, TelemetryFrame &gps2_frame)
 {
 	sensor_gps_s vehicle_gps_position;
 
@@ -114,16 +113,8 @@ bool GHSTTelemetry::send_gps1_status()
 	int32_t longitude = static_cast<int32_t>(round(vehicle_gps_position.longitude_deg * 1e7));      // 1e-7 degrees
 	uint16_t altitude = static_cast<int16_t>(round(vehicle_gps_position.altitude_msl_m));           // meters
 
-	return ghst_send_telemetry_gps1_status(_uart_fd, latitude, longitude, altitude);
-}
-
-bool GHSTTelemetry::send_gps2_status()
-{
-	sensor_gps_s vehicle_gps_position;
-
-	if (!_vehicle_gps_position_sub.update(&vehicle_gps_position)) {
-		return false;
-	}
+	gps1_frame.length = ghst_build_telemetry_gps1_status(gps1_frame.buf, latitude, longitude, altitude);
+	gps1_frame.ready = true;
 
 	uint16_t ground_speed = (uint16_t)(vehicle_gps_position.vel_d_m_s / 3.6f * 10.f);
 	uint16_t ground_course = (uint16_t)(math::degrees(vehicle_gps_position.cog_rad) * 100.f);
@@ -134,5 +125,9 @@ bool GHSTTelemetry::send_gps2_status()
 	uint16_t home_dir = 0;
 	uint8_t flags = 0;
 
-	return ghst_send_telemetry_gps2_status(_uart_fd, ground_speed, ground_course, num_sats, home_dist, home_dir, flags);
+	gps2_frame.length = ghst_build_telemetry_gps2_status(gps2_frame.buf, ground_speed, ground_course, num_sats,
+			    home_dist, home_dir, flags);
+	gps2_frame.ready = true;
+
+	return true;
 }
@@ -46,6 +46,7 @@
 #include <uORB/topics/battery_status.h>
 #include <uORB/topics/sensor_gps.h>
 #include <drivers/drv_hrt.h>
+#include <lib/rc/ghst.hpp>
 
 /**
  * High-level class that handles sending of GHST telemetry data
@@ -62,16 +63,28 @@ public:
 	~GHSTTelemetry() = default;
 
 	/**
-	 * Send telemetry data. Call this regularly (i.e. at 100Hz), it will automatically
-	 * limit the sending rate.
+	 * Rebuild the telemetry frames of updated topics. Call this regularly outside of RC
+	 * decoding, the frames are kept ready for the next telemetry slot.
+	 * @return true if a frame was rebuilt
+	 */
+	bool update_frames();
+
+	/**
+	 * Send the next ready telemetry frame. Call this right after an RC frame was received,
+	 * it will automatically limit the sending rate.
 	 * @return true if new data sent
 	 */
-	bool update(const hrt_abstime &now);
+	bool send(const hrt_abstime &now);
 
 private:
-	bool send_battery_status();
-	bool send_gps1_status();
-	bool send_gps2_status();
+	struct TelemetryFrame {
+		uint8_t buf[GHST_TELEMETRY_FRAME_SIZE];
+		int length{0};
+		bool ready{false};
+	};
+
+	bool build_battery_status(TelemetryFrame &frame);
+	bool build_gps_status(TelemetryFrame &gps1_frame, TelemetryFrame &gps2_frame);
 
 	uORB::Subscription _vehicle_gps_position_sub{ORB_ID(vehicle_gps_position)};
 	uORB::Subscription _battery_status_sub{ORB_ID(battery_status)};
@@ -83,6 +96,8 @@ private:
 	static constexpr uint32_t NUM_DATA_TYPES {3U};	// number of different telemetry data types
 	static constexpr uint32_t UPDATE_RATE_HZ {10U};	// update rate [Hz]
 
+	TelemetryFrame _frames[NUM_DATA_TYPES] {};
+
 	// Factors that should be applied to get correct values
 	static constexpr float FACTOR_VOLTS_TO_10MV {100.0F};
 	static constexpr float FACTOR_AMPS_TO_10MA {100.0F};
@@ -46,6 +46,10 @@
 #include <lib/crypto/monocypher/src/optional/monocypher-ed25519.h>
 #include <tomcrypt.h>
 
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+#include <px4_arch/cryp.h>
+#endif
+
 extern void libtomcrypt_init(void);
 
 /* room for 16 keys */
@@ -86,6 +90,10 @@ typedef struct {
 	uint64_t ctr;
 } chacha20_context_t;
 
+typedef struct {
+	uint8_t iv[16]; /* 96 bit random nonce followed by the 32 bit big endian block counter */
+} aes_ctr_context_t;
+
 static inline void initialize_tomcrypt(void)
 {
 	if (!tomcrypt_initialized) {
@@ -153,6 +161,10 @@ void crypto_init()
 {
 	keystore_init();
 	clear_key_cache();
+
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+	px4_arch_cryp_init();
+#endif
 }
 
 void crypto_deinit()
@@ -191,6 +203,24 @@ crypto_session_handle_t crypto_open(px4_crypto_algorithm_t algorithm)
 		}
 		break;
 
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+
+	case CRYPTO_AES: {
+			aes_ctr_context_t *context = XMALLOC(sizeof(aes_ctr_context_t));
+
+			if (!context) {
+				ret.handle = 0;
+				crypto_open_count--;
+
+			} else {
+				ret.context = context;
+				px4_get_secure_random(context->iv, 12);
+				memset(&context->iv[12], 0, 4);
+			}
+		}
+		break;
+#endif
+
 	default:
 		ret.context = NULL;
 	}
@@ -284,6 +314,21 @@ bool crypto_encrypt_data(crypto_session_handle_t handle,
 		}
 		break;
 
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+
+	case CRYPTO_AES: {
+			size_t key_sz;
+			const uint8_t *key = crypto_get_key_ptr(handle.keystore_handle, key_idx, &key_sz);
+			aes_ctr_context_t *context = handle.context;
+
+			if (key_sz == 32 && *cipher_size >= message_size) {
+				ret = px4_arch_aes_ctr(key, key_sz, context->iv, message, cipher, message_size);
+				*cipher_size = message_size;
+			}
+		}
+		break;
+#endif
+
 	case CRYPTO_RSA_OAEP: {
 			rsa_key key;
 			size_t key_sz;
@@ -331,6 +376,9 @@ bool crypto_generate_key(crypto_session_handle_t handle,
 
 	switch (handle.algorithm) {
 	case CRYPTO_XCHACHA20:
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+	case CRYPTO_AES:
+#endif
 		if (key_cache[idx].key_size < 32) {
 			if (key_cache[idx].key_size > 0) {
 				SECMEM_FREE(key_cache[idx].key);
@@ -426,6 +474,20 @@ bool crypto_get_nonce(crypto_session_handle_t handle,
 		}
 		break;
 
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+
+	case CRYPTO_AES: {
+			aes_ctr_context_t *context = handle.context;
+
+			if (nonce != NULL && context != NULL) {
+				memcpy(nonce, context->iv, sizeof(context->iv));
+			}
+
+			*nonce_len = sizeof(context->iv);
+		}
+		break;
+#endif
+
 	default:
 		*nonce_len = 0;
 	}
@@ -442,6 +504,13 @@ size_t crypto_get_min_blocksize(crypto_session_handle_t handle, uint8_t key_idx)
 		ret = 64;
 		break;
 
+#if defined(CONFIG_DRIVERS_SW_CRYPTO_HW_AES)
+
+	case CRYPTO_AES:
+		ret = 16;
+		break;
+#endif
+
 	default:
 		ret = 1;
 	}
@@ -45,12 +45,15 @@ public:
     struct Entry : public LinkedListNode<Entry>  // Not required to be packed - fits the block in any case
     {
         MonotonicTime deadline;
+        MonotonicTime enqueued_at;
         CanFrame frame;
         uint8_t qos;
         CanIOFlags flags;
 
-        Entry(const CanFrame& arg_frame, MonotonicTime arg_deadline, Qos arg_qos, CanIOFlags arg_flags)
+        Entry(const CanFrame& arg_frame, MonotonicTime arg_deadline, MonotonicTime arg_enqueued_at, Qos arg_qos,
+              CanIOFlags arg_flags)
             : deadline(arg_deadline)
+            , enqueued_at(arg_enqueued_at)
             , frame(arg_frame)
             , qos(uint8_t(arg_qos))
             , flags(arg_flags)
@@ -123,10 +126,19 @@ struct UAVCAN_EXPORT CanIfacePerfCounters
     uint64_t frames_rx;
     uint64_t errors;
 
+    /// Frames that could not be handed to the driver immediately and had to wait in the TX queue
+    uint64_t frames_tx_queued;
+    /// Time spent by the queued frames in the TX queue, until accepted by the driver
+    uint64_t tx_queue_latency_sum_usec;
+    uint32_t tx_queue_latency_max_usec;
+
     CanIfacePerfCounters()
         : frames_tx(0)
         , frames_rx(0)
         , errors(0)
+        , frames_tx_queued(0)
+        , tx_queue_latency_sum_usec(0)
+        , tx_queue_latency_max_usec(0)
     { }
 };
 
@@ -137,10 +149,16 @@ class UAVCAN_EXPORT CanIOManager : Noncopyable
     {
         uint64_t frames_tx;
         uint64_t frames_rx;
+        uint64_t frames_tx_queued;
+        uint64_t tx_queue_latency_sum_usec;
+        uint32_t tx_queue_latency_max_usec;
 
         IfaceFrameCounters()
             : frames_tx(0)
             , frames_rx(0)
+            , frames_tx_queued(0)
+            , tx_queue_latency_sum_usec(0)
+            , tx_queue_latency_max_usec(0)
         { }
     };
 
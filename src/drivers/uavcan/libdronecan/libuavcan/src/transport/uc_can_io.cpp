@@ -172,7 +172,7 @@ void CanTxQueue::push(const CanFrame& frame, MonotonicTime tx_deadline, Qos qos,
     {
         return;                                            // Seems that there is no memory at all.
     }
-    Entry* entry = new (praw) Entry(frame, tx_deadline, qos, flags);
+    Entry* entry = new (praw) Entry(frame, tx_deadline, timestamp, qos, flags);
     UAVCAN_ASSERT(entry);
     queue_.insertBefore(entry, PriorityInsertionComparator(frame));
 }
@@ -261,6 +261,15 @@ int CanIOManager::sendFromTxQueue(uint8_t iface_index)
     const int res = sendToIface(iface_index, entry->frame, entry->deadline, entry->flags);
     if (res > 0)
     {
+        // Queueing latency statistics, frames accepted by the driver immediately are not accounted here
+        IfaceFrameCounters& cnt = counters_[iface_index];
+        const int64_t latency_usec = (sysclock_.getMonotonic() - entry->enqueued_at).toUSec();
+        if (latency_usec > 0)
+        {
+            cnt.tx_queue_latency_sum_usec += uint64_t(latency_usec);
+            cnt.tx_queue_latency_max_usec = max(cnt.tx_queue_latency_max_usec, uint32_t(latency_usec));
+        }
+        cnt.frames_tx_queued++;
         tx_queues_[iface_index]->remove(entry);
     }
     return res;
@@ -332,6 +341,9 @@ CanIfacePerfCounters CanIOManager::getIfacePerfCounters(uint8_t iface_index) con
     cnt.errors = iface->getErrorCount() + tx_queues_[iface_index]->getRejectedFrameCount();
     cnt.frames_rx = counters_[iface_index].frames_rx;
     cnt.frames_tx = counters_[iface_index].frames_tx;
+    cnt.frames_tx_queued = counters_[iface_index].frames_tx_queued;
+    cnt.tx_queue_latency_sum_usec = counters_[iface_index].tx_queue_latency_sum_usec;
+    cnt.tx_queue_latency_max_usec = counters_[iface_index].tx_queue_latency_max_usec;
     return cnt;
 }
 
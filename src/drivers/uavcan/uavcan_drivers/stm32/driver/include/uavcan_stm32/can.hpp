@@ -66,6 +66,11 @@ class CanIface : public uavcan::ICanIface, uavcan::Noncopyable
 			, overflow_cnt_(0)
 		{ }
 
+		/**
+		 * Appends an item and returns it to be filled in place, overwriting the oldest item on overflow.
+		 * Must be called from the ISR or from a critical section.
+		 */
+		CanRxItem &push();
 		void push(const uavcan::CanFrame &frame, const uint64_t &utc_usec, uavcan::CanIOFlags flags);
 		void pop(uavcan::CanFrame &out_frame, uavcan::uint64_t &out_utc_usec, uavcan::CanIOFlags &out_flags);
 
@@ -98,11 +98,9 @@ void CanIface::RxQueue::registerOverflow()
 	}
 }
 
-void CanIface::RxQueue::push(const uavcan::CanFrame &frame, const uint64_t &utc_usec, uavcan::CanIOFlags flags)
+CanRxItem &CanIface::RxQueue::push()
 {
-	buf_[in_].frame    = frame;
-	buf_[in_].utc_usec = utc_usec;
-	buf_[in_].flags    = flags;
+	CanRxItem &item = buf_[in_];
 	in_++;
 
 	if (in_ >= capacity_) {
@@ -120,6 +118,16 @@ void CanIface::RxQueue::push(const uavcan::CanFrame &frame, const uint64_t &utc_
 			out_ = 0;
 		}
 	}
+
+	return item;
+}
+
+void CanIface::RxQueue::push(const uavcan::CanFrame &frame, const uint64_t &utc_usec, uavcan::CanIOFlags flags)
+{
+	CanRxItem &item = push();
+	item.frame    = frame;
+	item.utc_usec = utc_usec;
+	item.flags    = flags;
 }
 
 void CanIface::RxQueue::pop(uavcan::CanFrame &out_frame, uavcan::uint64_t &out_utc_usec, uavcan::CanIOFlags &out_flags)
@@ -646,47 +654,63 @@ void CanIface::handleRxInterrupt(uavcan::uint8_t fifo_index, uavcan::uint64_t ut
 	}
 
 	/*
-	 * Register overflow as a hardware error
+	 * Drain the whole hardware FIFO (up to 3 frames) at once instead of taking one interrupt per frame,
+	 * the frames are decoded directly into the RX queue.
 	 */
-	if ((*rfr_reg & bxcan::RFR_FOVR) != 0) {
-		error_cnt_++;
-	}
+	do {
+		/*
+		 * Register overflow as a hardware error
+		 */
+		if ((*rfr_reg & bxcan::RFR_FOVR) != 0) {
+			error_cnt_++;
+		}
 
-	/*
-	 * Read the frame contents
-	 */
-	uavcan::CanFrame frame;
-	const bxcan::RxMailboxType &rf = can_->RxMailbox[fifo_index];
+		/*
+		 * Read the frame contents
+		 */
+		CanRxItem &item = rx_queue_.push();
+		uavcan::CanFrame &frame = item.frame;
+		const bxcan::RxMailboxType &rf = can_->RxMailbox[fifo_index];
 
-	if ((rf.RIR & bxcan::RIR_IDE) == 0) {
-		frame.id = uavcan::CanFrame::MaskStdID & (rf.RIR >> 21);
+		if ((rf.RIR & bxcan::RIR_IDE) == 0) {
+			frame.id = uavcan::CanFrame::MaskStdID & (rf.RIR >> 21);
 
-	} else {
-		frame.id = uavcan::CanFrame::MaskExtID & (rf.RIR >> 3);
-		frame.id |= uavcan::CanFrame::FlagEFF;
-	}
+		} else {
+			frame.id = uavcan::CanFrame::MaskExtID & (rf.RIR >> 3);
+			frame.id |= uavcan::CanFrame::FlagEFF;
+		}
 
-	if ((rf.RIR & bxcan::RIR_RTR) != 0) {
-		frame.id |= uavcan::CanFrame::FlagRTR;
-	}
+		if ((rf.RIR & bxcan::RIR_RTR) != 0) {
+			frame.id |= uavcan::CanFrame::FlagRTR;
+		}
+
+		frame.dlc = rf.RDTR & 15;
+
+		const uavcan::uint32_t rdlr = rf.RDLR;
+		const uavcan::uint32_t rdhr = rf.RDHR;
+
+		frame.data[0] = uavcan::uint8_t(0xFF & (rdlr >> 0));
+		frame.data[1] = uavcan::uint8_t(0xFF & (rdlr >> 8));
+		frame.data[2] = uavcan::uint8_t(0xFF & (rdlr >> 16));
+		frame.data[3] = uavcan::uint8_t(0xFF & (rdlr >> 24));
+		frame.data[4] = uavcan::uint8_t(0xFF & (rdhr >> 0));
+		frame.data[5] = uavcan::uint8_t(0xFF & (rdhr >> 8));
+		frame.data[6] = uavcan::uint8_t(0xFF & (rdhr >> 16));
+		frame.data[7] = uavcan::uint8_t(0xFF & (rdhr >> 24));
+
+		item.utc_usec = utc_usec;
+		item.flags    = 0;
 
-	frame.dlc = rf.RDTR & 15;
+		*rfr_reg = bxcan::RFR_RFOM | bxcan::RFR_FOVR | bxcan::RFR_FULL;  // Release FIFO entry we just read
 
-	frame.data[0] = uavcan::uint8_t(0xFF & (rf.RDLR >> 0));
-	frame.data[1] = uavcan::uint8_t(0xFF & (rf.RDLR >> 8));
-	frame.data[2] = uavcan::uint8_t(0xFF & (rf.RDLR >> 16));
-	frame.data[3] = uavcan::uint8_t(0xFF & (rf.RDLR >> 24));
-	frame.data[4] = uavcan::uint8_t(0xFF & (rf.RDHR >> 0));
-	frame.data[5] = uavcan::uint8_t(0xFF & (rf.RDHR >> 8));
-	frame.data[6] = uavcan::uint8_t(0xFF & (rf.RDHR >> 16));
-	frame.data[7] = uavcan::uint8_t(0xFF & (rf.RDHR >> 24));
+		// FMP is only updated once the hardware has released the output mailbox
+		while ((*rfr_reg & bxcan::RFR_RFOM) != 0) { }
 
-	*rfr_reg = bxcan::RFR_RFOM | bxcan::RFR_FOVR | bxcan::RFR_FULL;  // Release FIFO entry we just read
+	} while ((*rfr_reg & bxcan::RFR_FMP_MASK) != 0);
 
 	/*
-	 * Store with timeout into the FIFO buffer and signal update event
+	 * Signal update event once for all the frames
 	 */
-	rx_queue_.push(frame, utc_usec, 0);
 	had_activity_ = true;
 	update_event_.signalFromInterrupt();
 
@@ -1190,6 +1190,15 @@ UavcanNode::print_info()
 			printf("\tIO errors: %" PRIu64 "\n", iface_perf_cnt.errors);
 			printf("\tRX frames: %" PRIu64 "\n", iface_perf_cnt.frames_rx);
 			printf("\tTX frames: %" PRIu64 "\n", iface_perf_cnt.frames_tx);
+
+			// frames that had to wait for a free TX mailbox, the latency is measured until accepted by the driver
+			const uint64_t tx_queued = iface_perf_cnt.frames_tx_queued;
+			printf("\tTX queued: %" PRIu64 "\n", tx_queued);
+
+			if (tx_queued > 0) {
+				printf("\tTX queue latency: mean %" PRIu64 " us, max %" PRIu32 " us\n",
+				       iface_perf_cnt.tx_queue_latency_sum_usec / tx_queued, iface_perf_cnt.tx_queue_latency_max_usec);
+			}
 		}
 	}
 
@@ -69,9 +69,10 @@ void FakeMagnetometer::Run()
 			if (gps.eph < 1000) {
 
 				// magnetic field data returned by the geo library using the current GPS position
-				const float declination_rad = math::radians(get_mag_declination_degrees(gps.latitude_deg, gps.longitude_deg));
-				const float inclination_rad = math::radians(get_mag_inclination_degrees(gps.latitude_deg, gps.longitude_deg));
-				const float field_strength_gauss = get_mag_strength_gauss(gps.latitude_deg, gps.longitude_deg);
+				const MagField field = get_mag_field(gps.latitude_deg, gps.longitude_deg);
+				const float declination_rad = math::radians(field.declination_deg);
+				const float inclination_rad = math::radians(field.inclination_deg);
+				const float field_strength_gauss = field.strength_gauss;
 
 				_mag_earth_pred = Dcmf(Eulerf(0, -inclination_rad, declination_rad)) * Vector3f(field_strength_gauss, 0, 0);
 
@@ -168,6 +168,49 @@ void AdsbConflict::remove_expired_conflicts()
 	}
 }
 
+void AdsbConflict::update_traffic(const transponder_report_s &transponder_report)
+{
+	_traffic_table.update(transponder_report, hrt_absolute_time());
+}
+
+bool AdsbConflict::check_traffic_table(double lat_now, double lon_now, float alt_now, float vx_now, float vy_now,
+				       float vz_now)
+{
+	_traffic_table.remove_expired(hrt_absolute_time());
+
+	const int num_candidates = _traffic_table.detect_conflicts(lat_now, lon_now, alt_now, vx_now, vy_now, vz_now,
+				   _conflict_detection_params.crosstrack_separation, _conflict_detection_params.vertical_separation,
+				   _conflict_detection_params.collision_time_threshold);
+
+	bool take_action = false;
+
+	// new and ongoing conflicts
+	for (int k = 0; k < num_candidates; k++) {
+		const int index = _traffic_table.candidate(k);
+
+		if (_traffic_table.in_conflict(index)) {
+			_traffic_table.get_report(index, _transponder_report);
+			_crosstrack_error.distance = _traffic_table.crosstrack_distance(index);
+			_conflict_detected = true;
+			take_action |= handle_traffic_conflict();
+		}
+	}
+
+	// resolved conflicts of the targets still in the table, backwards as they get removed from the list
+	for (int i = (int)_traffic_buffer.icao_address.size() - 1; i >= 0; i--) {
+		const int index = _traffic_table.find(_traffic_buffer.icao_address[i]);
+
+		if ((index >= 0) && !_traffic_table.in_conflict(index)) {
+			_traffic_table.get_report(index, _transponder_report);
+			_crosstrack_error.distance = _traffic_table.crosstrack_distance(index);
+			_conflict_detected = false;
+			take_action |= handle_traffic_conflict();
+		}
+	}
+
+	return take_action;
+}
+
 bool AdsbConflict::handle_traffic_conflict()
 {
 	const hrt_abstime now = hrt_absolute_time();
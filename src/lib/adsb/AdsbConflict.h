@@ -52,6 +52,8 @@
 
 #include <containers/Array.hpp>
 
+#include "TrafficTable.h"
+
 using namespace time_literals;
 
 static constexpr uint8_t NAVIGATOR_MAX_TRAFFIC{10};
@@ -133,6 +135,19 @@ public:
 
 	void remove_expired_conflicts();
 
+	/**
+	 * Add a transponder report to the traffic table
+	 */
+	void update_traffic(const transponder_report_s &transponder_report);
+
+	/**
+	 * Batched conflict detection against all targets in the traffic table, and state update of the
+	 * targets that are in conflict or in the conflict list
+	 *
+	 * @return true if an action needs to be taken
+	 */
+	bool check_traffic_table(double lat_now, double lon_now, float alt_now, float vx_now, float vy_now, float vz_now);
+
 	bool _conflict_detected{false};
 
 	TRAFFIC_STATE _traffic_state{TRAFFIC_STATE::NO_CONFLICT};
@@ -143,6 +158,8 @@ public:
 protected:
 	traffic_buffer_s _traffic_buffer;
 
+	TrafficTable _traffic_table;
+
 private:
 
 	crosstrack_error_s _crosstrack_error{};
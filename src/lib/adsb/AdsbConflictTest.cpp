@@ -312,3 +312,125 @@ TEST_F(AdsbConflictTest, trafficReminder)
 	printf("adsb_conflict._traffic_state %d \n", (int)adsb_conflict._traffic_state);
 	EXPECT_TRUE(adsb_conflict._traffic_state == TRAFFIC_STATE::ADD_CONFLICT);
 }
+
+TEST_F(AdsbConflictTest, trafficTableConflicts)
+{
+	int collision_time_threshold = 60;
+
+	float crosstrack_separation = 500.0f;
+	float vertical_separation = 500.0f;
+
+	double lat_now = 32.617013;
+	double lon_now = -96.490564;
+	float alt_now = 1000.0f;
+
+	uint32_t traffic_dataset_size = sizeof(traffic_dataset) / sizeof(traffic_dataset[0]);
+
+	uint32_t mismatches = 0;
+
+	for (uint32_t start = 0; start < traffic_dataset_size; start += TRAFFIC_TABLE_SIZE) {
+		// GIVEN a full table of traffic
+		TrafficTable traffic_table;
+
+		for (uint32_t i = start; (i < traffic_dataset_size) && (i < start + TRAFFIC_TABLE_SIZE); i++) {
+			transponder_report_s transponder_report{};
+			transponder_report.icao_address = i;
+			transponder_report.lat = traffic_dataset[i].lat_traffic;
+			transponder_report.lon = traffic_dataset[i].lon_traffic;
+			transponder_report.altitude = traffic_dataset[i].alt_traffic;
+			transponder_report.heading = traffic_dataset[i].heading_traffic;
+			transponder_report.hor_velocity = traffic_dataset[i].vxy_traffic;
+			transponder_report.ver_velocity = traffic_dataset[i].vz_traffic;
+			EXPECT_TRUE(traffic_table.update(transponder_report, 1_s));
+		}
+
+		// WHEN detecting the conflicts in a batch
+		traffic_table.detect_conflicts(lat_now, lon_now, alt_now, 0.f, 0.f, 0.f, crosstrack_separation, vertical_separation,
+					       collision_time_threshold);
+
+		// THEN they are the same as detected per report
+		for (int index = 0; index < traffic_table.size(); index++) {
+			if (traffic_table.in_conflict(index) != (bool)traffic_dataset[traffic_table.icao_address(index)].in_conflict) {
+				mismatches++;
+			}
+		}
+	}
+
+	EXPECT_EQ(mismatches, 0u);
+}
+
+TEST_F(AdsbConflictTest, trafficTableBuckets)
+{
+	TrafficTable traffic_table;
+
+	transponder_report_s transponder_report{};
+	transponder_report.lat = 47.3977;
+	transponder_report.lon = 8.5456;
+	transponder_report.hor_velocity = 10.f;
+
+	// GIVEN a close and a far target
+	transponder_report.icao_address = 1;
+	EXPECT_TRUE(traffic_table.update(transponder_report, 1_s));
+
+	transponder_report.icao_address = 2;
+	transponder_report.lat += 0.3; // ~33km
+	EXPECT_TRUE(traffic_table.update(transponder_report, 2_s));
+
+	// WHEN detecting conflicts with a short collision time threshold
+	const int num_candidates = traffic_table.detect_conflicts(47.3977, 8.5456, 0.f, 0.f, 0.f, 0.f, 500.f, 500.f, 60.f);
+
+	// THEN only the close target gets checked
+	EXPECT_EQ(num_candidates, 1);
+	EXPECT_EQ(traffic_table.icao_address(traffic_table.candidate(0)), 1u);
+
+	// WHEN the close target moves away
+	transponder_report.icao_address = 1;
+	transponder_report.lat = 47.3977 - 0.3;
+	EXPECT_TRUE(traffic_table.update(transponder_report, 3_s));
+
+	// THEN it isn't checked anymore
+	EXPECT_EQ(traffic_table.size(), 2);
+	EXPECT_EQ(traffic_table.detect_conflicts(47.3977, 8.5456, 0.f, 0.f, 0.f, 0.f, 500.f, 500.f, 60.f), 0);
+
+	// WHEN the second target expires
+	traffic_table.remove_expired(2_s + TRAFFIC_TABLE_ENTRY_LIFETIME + 1_ms);
+
+	// THEN only the first is left
+	EXPECT_EQ(traffic_table.size(), 1);
+	EXPECT_EQ(traffic_table.find(1), 0);
+	EXPECT_EQ(traffic_table.find(2), -1);
+}
+
+TEST_F(AdsbConflictTest, trafficTableFull)
+{
+	TrafficTable traffic_table;
+
+	transponder_report_s transponder_report{};
+	transponder_report.lon = 8.5456;
+
+	// GIVEN a full table with targets at increasing distance
+	for (int i = 0; i < TRAFFIC_TABLE_SIZE; i++) {
+		transponder_report.icao_address = i;
+		transponder_report.lat = 47.3977 + 0.001 * i;
+		EXPECT_TRUE(traffic_table.update(transponder_report, 1_s));
+	}
+
+	traffic_table.detect_conflicts(47.3977, 8.5456, 0.f, 0.f, 0.f, 0.f, 500.f, 500.f, 60.f);
+
+	// WHEN a target further than all others is added
+	transponder_report.icao_address = 10000;
+	transponder_report.lat = 47.3977 + 0.001 * TRAFFIC_TABLE_SIZE;
+
+	// THEN it gets dropped
+	EXPECT_FALSE(traffic_table.update(transponder_report, 1_s));
+
+	// WHEN a closer target is added
+	transponder_report.icao_address = 10001;
+	transponder_report.lat = 47.3977 - 0.0005;
+
+	// THEN it replaces the furthest
+	EXPECT_TRUE(traffic_table.update(transponder_report, 1_s));
+	EXPECT_EQ(traffic_table.size(), TRAFFIC_TABLE_SIZE);
+	EXPECT_GE(traffic_table.find(10001), 0);
+	EXPECT_EQ(traffic_table.find(TRAFFIC_TABLE_SIZE - 1), -1);
+}
@@ -0,0 +1,329 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "TrafficTable.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+TrafficTable::TrafficTable()
+{
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		_bucket_head[i] = -1;
+	}
+}
+
+int TrafficTable::find(uint32_t icao_address) const
+{
+	for (int i = 0; i < _size; i++) {
+		if (_icao_address[i] == icao_address) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+bool TrafficTable::update(const transponder_report_s &transponder_report, hrt_abstime now)
+{
+	if (!_reference.isInitialized()) {
+		update_reference(transponder_report.lat, transponder_report.lon);
+	}
+
+	int index = find(transponder_report.icao_address);
+
+	if (index < 0) {
+		if (_size < TRAFFIC_TABLE_SIZE) {
+			index = _size++;
+
+		} else {
+			// table full: replace the target furthest from the own-ship, if the new one is closer
+			float x, y;
+			_reference.project(transponder_report.lat, transponder_report.lon, x, y);
+			float furthest_distance_sq = (x - _x_now) * (x - _x_now) + (y - _y_now) * (y - _y_now);
+
+			for (int i = 0; i < _size; i++) {
+				const float distance_sq = (_x[i] - _x_now) * (_x[i] - _x_now) + (_y[i] - _y_now) * (_y[i] - _y_now);
+
+				if (distance_sq > furthest_distance_sq) {
+					furthest_distance_sq = distance_sq;
+					index = i;
+				}
+			}
+
+			if (index < 0) {
+				return false;
+			}
+
+			bucket_remove(index);
+		}
+
+		_in_conflict[index] = false;
+		_crosstrack_distance[index] = 0.f;
+
+	} else {
+		bucket_remove(index);
+	}
+
+	set_entry(index, transponder_report, now);
+	bucket_insert(index);
+	return true;
+}
+
+void TrafficTable::remove_expired(hrt_abstime now)
+{
+	for (int i = 0; i < _size;) {
+		if ((now > _timestamp[i]) && (now - _timestamp[i] > TRAFFIC_TABLE_ENTRY_LIFETIME)) {
+			remove(i);
+
+		} else {
+			i++;
+		}
+	}
+}
+
+int TrafficTable::detect_conflicts(double lat_now, double lon_now, float alt_now, float vx_now, float vy_now,
+				   float vz_now, float crosstrack_separation, float vertical_separation, float collision_time_threshold)
+{
+	update_reference(lat_now, lon_now);
+	_reference.project(lat_now, lon_now, _x_now, _y_now);
+
+	const float own_speed = sqrtf(vx_now * vx_now + vy_now * vy_now + vz_now * vz_now);
+
+	float max_speed = 0.f;
+
+	for (int i = 0; i < _size; i++) {
+		max_speed = fmaxf(max_speed, _speed[i]);
+	}
+
+	for (int i = 0; i < _size; i++) {
+		_in_conflict[i] = false;
+	}
+
+	// only the targets within this range can reach the own-ship in time
+	const float range = (own_speed + max_speed) * collision_time_threshold;
+	const float cells = ceilf(range / TRAFFIC_TABLE_CELL_SIZE);
+	int num_candidates = 0;
+
+	if (!(2.f * cells + 1.f < GRID_SIZE)) {
+		// the grid wraps around within range
+		for (int i = 0; i < _size; i++) {
+			_candidates[num_candidates++] = i;
+		}
+
+	} else {
+		const int range_cells = (int)cells;
+		const int cell_x = (int)floorf(_x_now / TRAFFIC_TABLE_CELL_SIZE);
+		const int cell_y = (int)floorf(_y_now / TRAFFIC_TABLE_CELL_SIZE);
+
+		for (int dx = -range_cells; dx <= range_cells; dx++) {
+			for (int dy = -range_cells; dy <= range_cells; dy++) {
+				for (int i = _bucket_head[cell_bucket(cell_x + dx, cell_y + dy)]; i >= 0; i = _next[i]) {
+					_candidates[num_candidates++] = i;
+				}
+			}
+		}
+	}
+
+	// closest point of approach of the target track and time to collision, in one pass over the candidates
+	for (int k = 0; k < num_candidates; k++) {
+		const int i = _candidates[k];
+
+		const float dx = _x_now - _x[i];
+		const float dy = _y_now - _y[i];
+		const float dz = alt_now - _altitude[i];
+
+		// distance to the target track, positive if the own-ship is right of it
+		const float crosstrack = _heading_cos[i] * dy - _heading_sin[i] * dx;
+		const float d_xyz = sqrtf(dx * dx + dy * dy + dz * dz);
+
+		//assume always pointing at each other
+		const float relative_speed = _speed[i] + own_speed;
+
+		_crosstrack_distance[i] = crosstrack;
+		_in_conflict[i] = (fabsf(crosstrack) < crosstrack_separation)
+				  && (fabsf(dz) < vertical_separation)
+				  && (relative_speed > FLT_EPSILON)
+				  && (d_xyz < collision_time_threshold * relative_speed);
+	}
+
+	return num_candidates;
+}
+
+void TrafficTable::get_report(int index, transponder_report_s &transponder_report) const
+{
+	transponder_report.icao_address = _icao_address[index];
+	transponder_report.lat = _lat[index];
+	transponder_report.lon = _lon[index];
+	transponder_report.altitude = _altitude[index];
+	transponder_report.heading = _heading[index];
+	transponder_report.hor_velocity = _hor_velocity[index];
+	transponder_report.ver_velocity = _ver_velocity[index];
+	transponder_report.flags = _flags[index];
+	memcpy(transponder_report.callsign, _callsign[index], sizeof(transponder_report.callsign));
+}
+
+void TrafficTable::set_entry(int index, const transponder_report_s &transponder_report, hrt_abstime now)
+{
+	_icao_address[index] = transponder_report.icao_address;
+	_timestamp[index] = now;
+	_lat[index] = transponder_report.lat;
+	_lon[index] = transponder_report.lon;
+	_altitude[index] = transponder_report.altitude;
+	_heading[index] = transponder_report.heading;
+	_heading_cos[index] = cosf(transponder_report.heading);
+	_heading_sin[index] = sinf(transponder_report.heading);
+	_hor_velocity[index] = transponder_report.hor_velocity;
+	_ver_velocity[index] = transponder_report.ver_velocity;
+	_speed[index] = sqrtf(transponder_report.hor_velocity * transponder_report.hor_velocity +
+			      transponder_report.ver_velocity * transponder_report.ver_velocity);
+	_flags[index] = transponder_report.flags;
+	memcpy(_callsign[index], transponder_report.callsign, sizeof(_callsign[index]));
+
+	update_position(index);
+}
+
+void TrafficTable::remove(int index)
+{
+	bucket_remove(index);
+
+	const int last = --_size;
+
+	if (index != last) {
+		move(last, index);
+	}
+}
+
+void TrafficTable::move(int from, int to)
+{
+	_icao_address[to] = _icao_address[from];
+	_timestamp[to] = _timestamp[from];
+	_lat[to] = _lat[from];
+	_lon[to] = _lon[from];
+	_x[to] = _x[from];
+	_y[to] = _y[from];
+	_altitude[to] = _altitude[from];
+	_heading[to] = _heading[from];
+	_heading_cos[to] = _heading_cos[from];
+	_heading_sin[to] = _heading_sin[from];
+	_hor_velocity[to] = _hor_velocity[from];
+	_ver_velocity[to] = _ver_velocity[from];
+	_speed[to] = _speed[from];
+	_flags[to] = _flags[from];
+	memcpy(_callsign[to], _callsign[from], sizeof(_callsign[to]));
+	_in_conflict[to] = _in_conflict[from];
+	_crosstrack_distance[to] = _crosstrack_distance[from];
+
+	// relink
+	_bucket[to] = _bucket[from];
+	_prev[to] = _prev[from];
+	_next[to] = _next[from];
+
+	if (_prev[to] >= 0) {
+		_next[_prev[to]] = to;
+
+	} else {
+		_bucket_head[_bucket[to]] = to;
+	}
+
+	if (_next[to] >= 0) {
+		_prev[_next[to]] = to;
+	}
+}
+
+void TrafficTable::update_position(int index)
+{
+	_reference.project(_lat[index], _lon[index], _x[index], _y[index]);
+}
+
+void TrafficTable::update_reference(double lat, double lon)
+{
+	if (_reference.isInitialized()) {
+		float x, y;
+		_reference.project(lat, lon, x, y);
+
+		if (x * x + y * y < TRAFFIC_TABLE_MAX_REFERENCE_DISTANCE * TRAFFIC_TABLE_MAX_REFERENCE_DISTANCE) {
+			return;
+		}
+	}
+
+	// the local frame is only accurate close to the reference, move it and reproject all targets
+	_reference.initReference(lat, lon);
+
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		_bucket_head[i] = -1;
+	}
+
+	for (int i = 0; i < _size; i++) {
+		update_position(i);
+		bucket_insert(i);
+	}
+}
+
+int TrafficTable::cell_bucket(int cell_x, int cell_y) const
+{
+	const int x = ((cell_x % GRID_SIZE) + GRID_SIZE) % GRID_SIZE;
+	const int y = ((cell_y % GRID_SIZE) + GRID_SIZE) % GRID_SIZE;
+	return x * GRID_SIZE + y;
+}
+
+void TrafficTable::bucket_insert(int index)
+{
+	const int bucket = cell_bucket((int)floorf(_x[index] / TRAFFIC_TABLE_CELL_SIZE),
+				       (int)floorf(_y[index] / TRAFFIC_TABLE_CELL_SIZE));
+	_bucket[index] = bucket;
+	_prev[index] = -1;
+	_next[index] = _bucket_head[bucket];
+
+	if (_next[index] >= 0) {
+		_prev[_next[index]] = index;
+	}
+
+	_bucket_head[bucket] = index;
+}
+
+void TrafficTable::bucket_remove(int index)
+{
+	if (_prev[index] >= 0) {
+		_next[_prev[index]] = _next[index];
+
+	} else {
+		_bucket_head[_bucket[index]] = _next[index];
+	}
+
+	if (_next[index] >= 0) {
+		_prev[_next[index]] = _prev[index];
+	}
+}
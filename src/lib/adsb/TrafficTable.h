@@ -0,0 +1,160 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file TrafficTable.h
+ *
+ * Table of the ADS-B traffic around the own-ship for batched conflict detection.
+ *
+ * The targets are stored as structure of arrays in a local frame, projected once when a report
+ * arrives. They are sorted into the buckets of a coarse grid, so the conflict detection only
+ * needs to look at the targets within reach of the own-ship within the collision time threshold,
+ * and then runs the closest point of approach checks on all of them in one pass.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <drivers/drv_hrt.h>
+#include <lib/geo/geo.h>
+#include <uORB/topics/transponder_report.h>
+
+using namespace time_literals;
+
+#if defined(CONFIG_NAVIGATOR_ADSB_TRAFFIC_TABLE_SIZE)
+static constexpr uint16_t TRAFFIC_TABLE_SIZE{CONFIG_NAVIGATOR_ADSB_TRAFFIC_TABLE_SIZE};
+#else
+static constexpr uint16_t TRAFFIC_TABLE_SIZE{128};
+#endif
+
+static constexpr uint64_t TRAFFIC_TABLE_ENTRY_LIFETIME{10_s}; //targets without a report for longer get removed
+
+static constexpr float TRAFFIC_TABLE_CELL_SIZE{5000.0f}; //grid cell size [m]
+
+static constexpr float TRAFFIC_TABLE_MAX_REFERENCE_DISTANCE{50000.0f}; //reproject all targets if the own-ship is further from the reference [m]
+
+class TrafficTable
+{
+public:
+	TrafficTable();
+	~TrafficTable() = default;
+
+	/**
+	 * Add a new target or update an existing one with the same ICAO address.
+	 * When the table is full, the target furthest from the own-ship gets replaced if the new one is closer.
+	 *
+	 * @return false if the target was dropped
+	 */
+	bool update(const transponder_report_s &transponder_report, hrt_abstime now);
+
+	/**
+	 * Remove the targets without a report for longer than TRAFFIC_TABLE_ENTRY_LIFETIME
+	 */
+	void remove_expired(hrt_abstime now);
+
+	/**
+	 * Detect the conflicts of all targets that can reach the own-ship within the collision time threshold.
+	 *
+	 * A target is in conflict if the own-ship is closer than crosstrack_separation to the target's track (the
+	 * horizontal closest point of approach), within vertical_separation, and the target can reach the own-ship
+	 * within collision_time_threshold with both flying towards each other.
+	 *
+	 * @return number of targets that were checked, see candidate()
+	 */
+	int detect_conflicts(double lat_now, double lon_now, float alt_now, float vx_now, float vy_now, float vz_now,
+			     float crosstrack_separation, float vertical_separation, float collision_time_threshold);
+
+	int size() const { return _size; }
+
+	/** index of the i-th target checked by the last detect_conflicts() */
+	int candidate(int i) const { return _candidates[i]; }
+
+	bool in_conflict(int index) const { return _in_conflict[index]; }
+	float crosstrack_distance(int index) const { return _crosstrack_distance[index]; }
+	uint32_t icao_address(int index) const { return _icao_address[index]; }
+
+	/** @return index of the target, -1 if not in the table */
+	int find(uint32_t icao_address) const;
+
+	/** fill the fields of the last report of a target used for the conflict warnings */
+	void get_report(int index, transponder_report_s &transponder_report) const;
+
+private:
+	static constexpr int GRID_SIZE{16}; //the grid wraps around every GRID_SIZE cells in each direction
+	static constexpr int NUM_BUCKETS{GRID_SIZE * GRID_SIZE};
+
+	void set_entry(int index, const transponder_report_s &transponder_report, hrt_abstime now);
+	void remove(int index);
+	void move(int from, int to);
+	void update_position(int index);
+	void update_reference(double lat, double lon);
+
+	int cell_bucket(int cell_x, int cell_y) const;
+	void bucket_insert(int index);
+	void bucket_remove(int index);
+
+	MapProjection _reference{};
+	float _x_now{0.f};
+	float _y_now{0.f};
+
+	int _size{0};
+
+	// structure of arrays, the batched conflict detection only touches the local state
+	uint32_t _icao_address[TRAFFIC_TABLE_SIZE];
+	hrt_abstime _timestamp[TRAFFIC_TABLE_SIZE];
+	double _lat[TRAFFIC_TABLE_SIZE];
+	double _lon[TRAFFIC_TABLE_SIZE];
+	float _x[TRAFFIC_TABLE_SIZE]; //north [m]
+	float _y[TRAFFIC_TABLE_SIZE]; //east [m]
+	float _altitude[TRAFFIC_TABLE_SIZE];
+	float _heading[TRAFFIC_TABLE_SIZE];
+	float _heading_cos[TRAFFIC_TABLE_SIZE];
+	float _heading_sin[TRAFFIC_TABLE_SIZE];
+	float _hor_velocity[TRAFFIC_TABLE_SIZE];
+	float _ver_velocity[TRAFFIC_TABLE_SIZE];
+	float _speed[TRAFFIC_TABLE_SIZE]; //3D speed
+	uint16_t _flags[TRAFFIC_TABLE_SIZE];
+	char _callsign[TRAFFIC_TABLE_SIZE][sizeof(transponder_report_s::callsign)];
+
+	// detection results
+	bool _in_conflict[TRAFFIC_TABLE_SIZE];
+	float _crosstrack_distance[TRAFFIC_TABLE_SIZE];
+	int16_t _candidates[TRAFFIC_TABLE_SIZE];
+
+	// doubly linked lists of the targets in each grid bucket
+	int16_t _bucket_head[NUM_BUCKETS];
+	int16_t _bucket[TRAFFIC_TABLE_SIZE];
+	int16_t _next[TRAFFIC_TABLE_SIZE];
+	int16_t _prev[TRAFFIC_TABLE_SIZE];
+};
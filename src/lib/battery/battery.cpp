@@ -57,6 +57,8 @@ Battery::Battery(int index, ModuleParams *parent, const int sample_interval_us,
 	_current_average_filter_a.setParameters(expected_filter_dt, 50.f);
 	_ocv_filter_v.setParameters(expected_filter_dt, 1.f);
 	_cell_voltage_filter_v.setParameters(expected_filter_dt, 1.f);
+	_rls_current_filter_a.setParameters(expected_filter_dt, 1.f);
+	_rls_current_variance_filter.setParameters(expected_filter_dt, 1.f);
 
 	if (index > 9 || index < 1) {
 		PX4_ERR("Battery index must be between 1 and 9 (inclusive). Received %d. Defaulting to 1.", index);
@@ -238,6 +240,25 @@ float Battery::calculateStateOfChargeVoltageBased(const float voltage_v, const f
 
 void Battery::updateInternalResistanceEstimation(const float voltage_v, const float current_a)
 {
+	// The estimate only improves with a varying current, otherwise the update is rejected below anyway.
+	// So the full update runs on every sample while the current varies and decimated while it is constant.
+	_rls_current_filter_a.update(current_a);
+	const float current_deviation = current_a - _rls_current_filter_a.getState();
+	_rls_current_variance_filter.update(current_deviation * current_deviation);
+
+	const float current_variance = _rls_current_variance_filter.getState();
+	const int decimation = (current_variance * RLS_DECIMATION_MAX > RLS_EXCITATION_VARIANCE) ?
+			       math::max(static_cast<int>(RLS_EXCITATION_VARIANCE / current_variance), 1) : RLS_DECIMATION_MAX;
+
+	if (++_rls_samples_skipped < decimation) {
+		// Update OCV estimate with IR estimate
+		_RLS_est(0) = voltage_v + _RLS_est(1) * current_a;
+		_ocv_filter_v.update(voltage_v + _internal_resistance_estimate * _params.n_cells * current_a);
+		return;
+	}
+
+	_rls_samples_skipped = 0;
+
 	Vector2f x{1, -current_a};
 	_voltage_prediction = (x.transpose() * _RLS_est)(0, 0);
 	_prediction_error = voltage_v - _voltage_prediction;
@@ -276,6 +297,11 @@ void Battery::resetInternalResistanceEstimation(const float voltage_v, const flo
 	_internal_resistance_estimate = R_DEFAULT;
 	_ocv_filter_v.reset(voltage_v + _internal_resistance_estimate * _params.n_cells * current_a);
 
+	// start with every sample until the excitation is known
+	_rls_current_filter_a.reset(current_a);
+	_rls_current_variance_filter.reset(RLS_EXCITATION_VARIANCE);
+	_rls_samples_skipped = 0;
+
 	if (_params.r_internal >= 0.f) { // Use user specified internal resistance value
 		_cell_voltage_filter_v.reset(voltage_v / _params.n_cells + _params.r_internal * current_a);
 
@@ -212,11 +212,16 @@ private:
 	float _internal_resistance_estimate{0.005f}; // [Ohm] Per cell estimate of the internal resistance
 	float _voltage_prediction{0.f}; // [V] Predicted voltage of the estimator
 	float _prediction_error{0.f}; // [V] Error between the predicted and measured voltage
+	AlphaFilter<float> _rls_current_filter_a; // [A] Mean current around which the estimator excitation is measured
+	AlphaFilter<float> _rls_current_variance_filter; // [A^2] Variance of the current, the estimator excitation
+	int _rls_samples_skipped{0};
 	static constexpr float LAMBDA = 0.95f; 	// [0, 1] Forgetting factor (Tuning parameter for the RLS algorithm)
 	static constexpr float R_DEFAULT = 0.005f; // [Ohm] Initial per cell estimate of the internal resistance
 	static constexpr float OCV_DEFAULT = 4.2f; // [V] Initial per cell estimate of the open circuit voltage
 	static constexpr float R_COVARIANCE = 0.1f; // Initial per cell covariance of the internal resistance
 	static constexpr float OCV_COVARIANCE = 1.5f; // Initial per cell covariance of the open circuit voltage
+	static constexpr float RLS_EXCITATION_VARIANCE = 0.25f; // [A^2] Current variance from which the estimator runs on every sample
+	static constexpr int RLS_DECIMATION_MAX = 10; // Estimator update interval in samples with a constant current
 
 	// Temperature [degC] above which an overtemperature fault is declared,
 	// leading to a failsafe warning recommending immediate landing. Note
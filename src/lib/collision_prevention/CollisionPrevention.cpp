@@ -158,26 +158,28 @@ void CollisionPrevention::_updateObstacleData()
 	_closest_dist = UINT16_MAX;
 	_closest_dist_dir.setZero();
 
+	const hrt_abstime now = getTime();
+	const bool map_stale = (now - _obstacle_map_body_frame.timestamp) >= RANGE_STREAM_TIMEOUT_US;
+
 	for (int i = 0; i < BIN_COUNT; i++) {
 		// if the data is stale, reset the bin
-		if (getTime() - _data_timestamps[i] > RANGE_STREAM_TIMEOUT_US) {
+		if (now - _data_timestamps[i] > RANGE_STREAM_TIMEOUT_US) {
 			_obstacle_map_body_frame.distances[i] = UINT16_MAX;
 		}
 
 		float angle = wrap_2pi(_vehicle_yaw + math::radians((float)i * BIN_SIZE +
 				       _obstacle_map_body_frame.angle_offset));
-		const Vector2f bin_direction = {cosf(angle), sinf(angle)};
+		_bin_directions[i] = {cosf(angle), sinf(angle)};
 		const uint16_t bin_distance = _obstacle_map_body_frame.distances[i];
 
 		// check if there is avaliable data and the data of the map is not stale
-		if (bin_distance < UINT16_MAX
-		    && (getTime() - _obstacle_map_body_frame.timestamp) < RANGE_STREAM_TIMEOUT_US) {
+		if (bin_distance < UINT16_MAX && !map_stale) {
 			_obstacle_data_present = true;
 		}
 
 		if (bin_distance * 0.01f < _closest_dist) {
 			_closest_dist = bin_distance * 0.01f;
-			_closest_dist_dir = bin_direction;
+			_closest_dist_dir = _bin_directions[i];
 		}
 	}
 }
@@ -198,8 +200,7 @@ void CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint_accel
 		float vel_comp_accel = INFINITY;
 		Vector2f vel_comp_accel_dir{};
 
-		_getVelocityCompensationAcceleration(_vehicle_yaw, setpoint_vel, now,
-						     vel_comp_accel, vel_comp_accel_dir);
+		_getVelocityCompensationAcceleration(setpoint_vel, now, vel_comp_accel, vel_comp_accel_dir);
 
 		Vector2f constr_accel_setpoint{};
 
@@ -229,96 +230,66 @@ void CollisionPrevention::_calculateConstrainedSetpoint(Vector2f &setpoint_accel
 // TODO this gives false output if the offset is not a multiple of the resolution. to be fixed...
 void CollisionPrevention::_addObstacleSensorData(const obstacle_distance_s &obstacle, const float vehicle_yaw)
 {
-
-	float vehicle_orientation_deg = math::degrees(vehicle_yaw);
-
+	float msg_angle_offset = obstacle.angle_offset;
 
 	if (obstacle.frame == obstacle.MAV_FRAME_GLOBAL || obstacle.frame == obstacle.MAV_FRAME_LOCAL_NED) {
 		// Obstacle message arrives in local_origin frame (north aligned)
 		// corresponding data index (convert to world frame and shift by msg offset)
-		for (int i = 0; i < BIN_COUNT; i++) {
-			for (int j = 0; (j < 360 / obstacle.increment) && (j < BIN_COUNT); j++) {
-				float bin_lower_angle = ObstacleMath::get_lower_bound_angle(i, _obstacle_map_body_frame.increment,
-							_obstacle_map_body_frame.angle_offset);
-				float bin_upper_angle = ObstacleMath::get_lower_bound_angle(i + 1, _obstacle_map_body_frame.increment,
-							_obstacle_map_body_frame.angle_offset);
-				float msg_lower_angle = ObstacleMath::get_lower_bound_angle(j, obstacle.increment,
-							obstacle.angle_offset - vehicle_orientation_deg);
-				float msg_upper_angle = ObstacleMath::get_lower_bound_angle(j + 1, obstacle.increment,
-							obstacle.angle_offset - vehicle_orientation_deg);
-
-				// if a bin stretches over the 0/360 degree line, adjust the angles
-				if (bin_lower_angle > bin_upper_angle) {
-					bin_lower_angle -= 360;
-				}
-
-				if (msg_lower_angle > msg_upper_angle) {
-					msg_lower_angle -= 360;
-				}
+		msg_angle_offset -= math::degrees(vehicle_yaw);
 
-				// Check for overlaps.
-				if ((msg_lower_angle > bin_lower_angle && msg_lower_angle < bin_upper_angle) ||
-				    (msg_upper_angle > bin_lower_angle && msg_upper_angle < bin_upper_angle) ||
-				    (msg_lower_angle <= bin_lower_angle && msg_upper_angle >= bin_upper_angle) ||
-				    (msg_lower_angle >= bin_lower_angle && msg_upper_angle <= bin_upper_angle)) {
-					if (obstacle.distances[j] != UINT16_MAX) {
-						if (_enterData(i, obstacle.max_distance * 0.01f, obstacle.distances[j] * 0.01f)) {
-							_obstacle_map_body_frame.distances[i] = obstacle.distances[j];
-							_data_timestamps[i] = _obstacle_map_body_frame.timestamp;
-							_data_maxranges[i] = obstacle.max_distance;
-							_data_fov[i] = 1;
-						}
-					}
-				}
+	} else if (obstacle.frame != obstacle.MAV_FRAME_BODY_FRD) {
+		mavlink_log_critical(&_mavlink_log_pub, "Obstacle message received in unsupported frame %i\t",
+				     obstacle.frame);
+		events::send<uint8_t>(events::ID("col_prev_unsup_frame"), events::Log::Error,
+				      "Obstacle message received in unsupported frame {1}", obstacle.frame);
+		return;
+	}
 
-			}
+	for (int j = 0; (j < 360 / obstacle.increment) && (j < BIN_COUNT); j++) {
+		if (obstacle.distances[j] == UINT16_MAX) {
+			continue;
 		}
 
-	} else if (obstacle.frame == obstacle.MAV_FRAME_BODY_FRD) {
-		// Obstacle message arrives in body frame (front aligned)
-		// corresponding data index (shift by msg offset)
-		for (int i = 0; i < BIN_COUNT; i++) {
-			for (int j = 0; j < 360 / obstacle.increment; j++) {
-				float bin_lower_angle = ObstacleMath::get_lower_bound_angle(i, _obstacle_map_body_frame.increment,
-							_obstacle_map_body_frame.angle_offset);
-				float bin_upper_angle = ObstacleMath::get_lower_bound_angle(i + 1, _obstacle_map_body_frame.increment,
-							_obstacle_map_body_frame.angle_offset);
-				float msg_lower_angle = ObstacleMath::get_lower_bound_angle(j, obstacle.increment, obstacle.angle_offset);
-				float msg_upper_angle = ObstacleMath::get_lower_bound_angle(j + 1, obstacle.increment, obstacle.angle_offset);
-
-				// if a bin stretches over the 0/360 degree line, adjust the angles
-				if (bin_lower_angle > bin_upper_angle) {
-					bin_lower_angle -= 360;
-				}
+		float msg_lower_angle = ObstacleMath::get_lower_bound_angle(j, obstacle.increment, msg_angle_offset);
+		const float msg_upper_angle = ObstacleMath::get_lower_bound_angle(j + 1, obstacle.increment, msg_angle_offset);
 
-				if (msg_lower_angle > msg_upper_angle) {
-					msg_lower_angle -= 360;
-				}
+		// if a bin stretches over the 0/360 degree line, adjust the angles
+		if (msg_lower_angle > msg_upper_angle) {
+			msg_lower_angle -= 360;
+		}
 
-				// Check for overlaps.
-				if ((msg_lower_angle > bin_lower_angle && msg_lower_angle < bin_upper_angle) ||
-				    (msg_upper_angle > bin_lower_angle && msg_upper_angle < bin_upper_angle) ||
-				    (msg_lower_angle <= bin_lower_angle && msg_upper_angle >= bin_upper_angle) ||
-				    (msg_lower_angle >= bin_lower_angle && msg_upper_angle <= bin_upper_angle)) {
-					if (obstacle.distances[j] != UINT16_MAX) {
-
-						if (_enterData(i, obstacle.max_distance * 0.01f, obstacle.distances[j] * 0.01f)) {
-							_obstacle_map_body_frame.distances[i] = obstacle.distances[j];
-							_data_timestamps[i] = _obstacle_map_body_frame.timestamp;
-							_data_maxranges[i] = obstacle.max_distance;
-							_data_fov[i] = 1;
-						}
-					}
-				}
+		// only the map bins around the message bin can overlap with it, instead of checking all of them
+		const float map_angle_offset = _obstacle_map_body_frame.angle_offset - BIN_SIZE / 2.f;
+		const int first_bin = static_cast<int>(floorf((msg_lower_angle - map_angle_offset) / BIN_SIZE)) - 1;
+		const float msg_end_angle = msg_lower_angle + obstacle.increment;
+		const int last_bin = math::min(static_cast<int>(floorf((msg_end_angle - map_angle_offset) / BIN_SIZE)) + 1,
+					       first_bin + BIN_COUNT - 1);
+
+		for (int bin = first_bin; bin <= last_bin; bin++) {
+			const int i = ObstacleMath::wrap_bin(bin % BIN_COUNT, BIN_COUNT);
+			float bin_lower_angle = ObstacleMath::get_lower_bound_angle(i, _obstacle_map_body_frame.increment,
+						_obstacle_map_body_frame.angle_offset);
+			const float bin_upper_angle = ObstacleMath::get_lower_bound_angle(i + 1, _obstacle_map_body_frame.increment,
+						      _obstacle_map_body_frame.angle_offset);
+
+			// if a bin stretches over the 0/360 degree line, adjust the angles
+			if (bin_lower_angle > bin_upper_angle) {
+				bin_lower_angle -= 360;
+			}
 
+			// Check for overlaps.
+			if ((msg_lower_angle > bin_lower_angle && msg_lower_angle < bin_upper_angle) ||
+			    (msg_upper_angle > bin_lower_angle && msg_upper_angle < bin_upper_angle) ||
+			    (msg_lower_angle <= bin_lower_angle && msg_upper_angle >= bin_upper_angle) ||
+			    (msg_lower_angle >= bin_lower_angle && msg_upper_angle <= bin_upper_angle)) {
+				if (_enterData(i, obstacle.max_distance * 0.01f, obstacle.distances[j] * 0.01f)) {
+					_obstacle_map_body_frame.distances[i] = obstacle.distances[j];
+					_data_timestamps[i] = _obstacle_map_body_frame.timestamp;
+					_data_maxranges[i] = obstacle.max_distance;
+					_data_fov[i] = 1;
+				}
 			}
 		}
-
-	} else {
-		mavlink_log_critical(&_mavlink_log_pub, "Obstacle message received in unsupported frame %i\t",
-				     obstacle.frame);
-		events::send<uint8_t>(events::ID("col_prev_unsup_frame"), events::Log::Error,
-				      "Obstacle message received in unsupported frame {1}", obstacle.frame);
 	}
 }
 
@@ -523,18 +494,12 @@ CollisionPrevention::_getScale(const float &reference_distance)
 	return scale;
 }
 
-void CollisionPrevention::_getVelocityCompensationAcceleration(const float vehicle_yaw_angle_rad,
-		const Vector2f &setpoint_vel,
-		const hrt_abstime now, float &vel_comp_accel, Vector2f &vel_comp_accel_dir)
+void CollisionPrevention::_getVelocityCompensationAcceleration(const Vector2f &setpoint_vel, const hrt_abstime now,
+		float &vel_comp_accel, Vector2f &vel_comp_accel_dir)
 {
 	for (int i = 0; i < BIN_COUNT; i++) {
 		const float max_range = _data_maxranges[i] * 0.01f;
-
-		// get the vector pointing into the direction of current bin
-		float bin_angle = wrap_2pi(vehicle_yaw_angle_rad
-					   + math::radians((float)i * BIN_SIZE + _obstacle_map_body_frame.angle_offset));
-
-		const Vector2f bin_direction = { cosf(bin_angle), sinf(bin_angle) };
+		const Vector2f &bin_direction = _bin_directions[i];
 		float bin_distance = _obstacle_map_body_frame.distances[i];
 
 		// only consider bins which are between min and max values
@@ -98,6 +98,7 @@ protected:
 	bool _data_fov[BIN_COUNT] {};
 	uint64_t _data_timestamps[BIN_COUNT] {};
 	uint16_t _data_maxranges[BIN_COUNT] {}; /**< in cm */
+	matrix::Vector2f _bin_directions[BIN_COUNT] {}; /**< world frame bin directions */
 
 	void _addDistanceSensorData(distance_sensor_s &distance_sensor, const matrix::Quatf &vehicle_attitude);
 
@@ -136,8 +137,8 @@ protected:
 	 */
 	matrix::Vector2f _constrainAccelerationSetpoint(const float &setpoint_length);
 
-	void _getVelocityCompensationAcceleration(const float vehicle_yaw_angle_rad, const matrix::Vector2f &setpoint_vel,
-			const hrt_abstime now, float &vel_comp_accel, matrix::Vector2f &vel_comp_accel_dir);
+	void _getVelocityCompensationAcceleration(const matrix::Vector2f &setpoint_vel, const hrt_abstime now,
+			float &vel_comp_accel, matrix::Vector2f &vel_comp_accel_dir);
 
 	float _getObstacleDistance(const matrix::Vector2f &direction);
 
@@ -127,4 +127,108 @@ float wrap_360(const float angle)
 	return matrix::wrap(angle, 0.0f, 360.0f);
 }
 
+bool ScanBinner::configure(float bin_width, float angle_offset, uint16_t max_distance)
+{
+	const int32_t bin_width_cdeg = (int32_t)roundf(bin_width * 100.f);
+
+	if ((bin_width_cdeg <= 0) || (36000 % bin_width_cdeg != 0) || (36000 / bin_width_cdeg > BIN_COUNT_MAX)) {
+		return false;
+	}
+
+	_bin_width_cdeg = bin_width_cdeg;
+	_bin_count = 36000 / bin_width_cdeg;
+	_max_distance = max_distance;
+
+	for (int i = 0; i < _bin_count; i++) {
+		const float yaw = math::radians(i * bin_width + angle_offset);
+		_bin_cos[i] = cosf(yaw);
+		_bin_sin[i] = sinf(yaw);
+	}
+
+	reset();
+	return true;
+}
+
+void ScanBinner::set_attitude(const matrix::Quatf &q_world_vehicle)
+{
+	// the projection of a horizontal body direction only depends on the upper left of the rotation matrix
+	_rotation_xy = Dcmf(q_world_vehicle).slice<2, 2>(0, 0);
+}
+
+int ScanBinner::get_bin(int32_t angle_cdeg) const
+{
+	// round to the nearest bin, halfway rounds up like get_bin_at_angle()
+	const int32_t numerator = 2 * angle_cdeg + _bin_width_cdeg;
+	const int32_t denominator = 2 * _bin_width_cdeg;
+
+	int bin = (numerator >= 0) ? (numerator / denominator) : -((denominator - 1 - numerator) / denominator);
+	bin %= _bin_count;
+
+	return (bin < 0) ? bin + _bin_count : bin;
+}
+
+int ScanBinner::add_point(int32_t angle_cdeg, uint16_t distance, uint16_t distances[], uint64_t timestamps[],
+			  uint64_t now)
+{
+	if (_bin_count == 0) {
+		return 0;
+	}
+
+	const int bin = get_bin(angle_cdeg);
+
+	if ((_current_bin < 0) || (bin == _current_bin)) {
+		_current_bin = bin;
+		_current_distance = math::min(_current_distance, distance);
+		return 0;
+	}
+
+	// the scan left the current bin
+	const uint16_t bin_distance = project(_current_bin, _current_distance);
+
+	int step = wrap_bin(bin - _current_bin, _bin_count);
+	int direction = 1;
+
+	if (step > _bin_count / 2) {
+		step = _bin_count - step;
+		direction = -1;
+	}
+
+	// the measurement is assumed to be valid for the bins skipped by the scan, but a large jump is missing data
+	const int written = (step <= _bin_count / 4) ? step : 1;
+
+	int write_bin = _current_bin;
+
+	for (int i = 0; i < written; i++) {
+		distances[write_bin] = bin_distance;
+		timestamps[write_bin] = now;
+		write_bin = wrap_bin(write_bin + direction, _bin_count);
+	}
+
+	_current_bin = bin;
+	_current_distance = distance;
+
+	return written;
+}
+
+void ScanBinner::reset()
+{
+	_current_bin = -1;
+	_current_distance = UINT16_MAX;
+}
+
+uint16_t ScanBinner::project(int bin, uint16_t distance) const
+{
+	const float x = _rotation_xy(0, 0) * _bin_cos[bin] + _rotation_xy(0, 1) * _bin_sin[bin];
+	const float y = _rotation_xy(1, 0) * _bin_cos[bin] + _rotation_xy(1, 1) * _bin_sin[bin];
+	const float horizontal_projection_scale = math::constrain(sqrtf(x * x + y * y), FLT_EPSILON, 1.0f);
+
+	const float projected_distance = distance * horizontal_projection_scale;
+
+	if (projected_distance > _max_distance) {
+		return _max_distance + 1; // As per ObstacleDistance.msg definition
+	}
+
+	return static_cast<uint16_t>(roundf(projected_distance));
+}
+
 } // ObstacleMath
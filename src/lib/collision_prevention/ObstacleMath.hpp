@@ -31,6 +31,7 @@
  *
  ****************************************************************************/
 
+#include <stdint.h>
 #include <matrix/math.hpp>
 
 namespace ObstacleMath
@@ -103,5 +104,72 @@ int wrap_bin(int bin, int bin_count);
  */
 float wrap_360(const float angle);
 
+/**
+ * Incremental binning of the points of a scanning range finder (e.g. a 2D lidar) into obstacle_distance bins.
+ *
+ * The bin of a point is found with integer arithmetic on the sensor angle, and the yaw of every bin is
+ * precomputed in configure(), so the horizontal projection of a completed bin only costs a few
+ * multiplications with the attitude set by set_attitude(). A bin is written out once the scan leaves it.
+ */
+class ScanBinner
+{
+public:
+	static constexpr int BIN_COUNT_MAX{72};
+
+	/**
+	 * @param bin_width width of a bin in degrees, 360 must be a multiple of it
+	 * @param angle_offset clockwise angle of the sensor frame from the vehicle forward axis in degrees
+	 * @param max_distance larger (projected) distances are written as max_distance + 1
+	 * @return false if the bin width is not supported
+	 */
+	bool configure(float bin_width, float angle_offset, uint16_t max_distance);
+
+	/**
+	 * Sets the vehicle attitude used to project completed bins onto the world horizontal plane
+	 * @param q_world_vehicle vehicle attitude quaternion
+	 */
+	void set_attitude(const matrix::Quatf &q_world_vehicle);
+
+	/**
+	 * Returns the bin index of an angle, same as get_bin_at_angle()
+	 * @param angle_cdeg clockwise angle in the sensor frame in centidegrees
+	 */
+	int get_bin(int32_t angle_cdeg) const;
+
+	/**
+	 * Adds a point of the scan. When the point is in another bin than the previous points, the minimum
+	 * distance of the previous bin is projected and written to it, and to the bins the scan skipped.
+	 * @param angle_cdeg clockwise angle in the sensor frame in centidegrees
+	 * @param distance measured distance
+	 * @param distances bin array to write completed bins to
+	 * @param timestamps time of the last write of each bin
+	 * @param now current time
+	 * @return number of bins written
+	 */
+	int add_point(int32_t angle_cdeg, uint16_t distance, uint16_t distances[], uint64_t timestamps[], uint64_t now);
+
+	/**
+	 * Discards the points of the current bin
+	 */
+	void reset();
+
+	int bin_count() const { return _bin_count; }
+
+private:
+	uint16_t project(int bin, uint16_t distance) const;
+
+	int _bin_count{0};
+	int32_t _bin_width_cdeg{0};
+	uint16_t _max_distance{UINT16_MAX};
+
+	float _bin_cos[BIN_COUNT_MAX] {};
+	float _bin_sin[BIN_COUNT_MAX] {};
+
+	matrix::Matrix2f _rotation_xy{matrix::eye<float, 2>()}; ///< horizontal part of the vehicle rotation
+
+	int _current_bin{-1};
+	uint16_t _current_distance{UINT16_MAX};
+};
+
 
 } // ObstacleMath
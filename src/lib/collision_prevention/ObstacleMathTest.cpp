@@ -255,3 +255,110 @@ TEST(ObstacleMathTest, HandleMissedBins)
 	EXPECT_EQ(measurements[6], 1);
 	EXPECT_EQ(measurements[7], 1);
 }
+
+TEST(ObstacleMathTest, ScanBinnerGetBin)
+{
+	// GIVEN: a scan binner with 5 degree bins
+	ObstacleMath::ScanBinner binner;
+	ASSERT_TRUE(binner.configure(5.f, 0.f, 5000));
+	EXPECT_EQ(binner.bin_count(), 72);
+
+	// WHEN: we get the bin of angles all around the sensor
+	// THEN: the bin should be the same as with get_bin_at_angle()
+	for (int32_t angle_cdeg = -36000; angle_cdeg <= 36000; angle_cdeg += 25) {
+		EXPECT_EQ(binner.get_bin(angle_cdeg), ObstacleMath::get_bin_at_angle(5.f, angle_cdeg / 100.f)) << angle_cdeg;
+	}
+
+	// THEN: bin widths that do not divide the circle or need more bins than obstacle_distance has are rejected
+	EXPECT_FALSE(binner.configure(7.f, 0.f, 5000));
+	EXPECT_FALSE(binner.configure(2.f, 0.f, 5000));
+}
+
+TEST(ObstacleMathTest, ScanBinnerProjection)
+{
+	// GIVEN: a scan binner with 45 degree bins, a sensor facing right and a rolled vehicle
+	ObstacleMath::ScanBinner binner;
+	ASSERT_TRUE(binner.configure(45.f, 90.f, 5000));
+
+	const Quatf vehicle_attitude(Eulerf(M_PI_4_F / 2.f, 0.3f, 1.f));
+	binner.set_attitude(vehicle_attitude);
+
+	uint16_t distances[8];
+	uint64_t timestamps[8] {};
+
+	for (int bin = 0; bin < 8; bin++) {
+		// WHEN: the scan leaves a bin
+		binner.reset();
+		binner.add_point(bin * 4500, 1000, distances, timestamps, 1);
+		EXPECT_EQ(binner.add_point((bin + 1) * 4500, 1000, distances, timestamps, 1), 1);
+
+		// THEN: the distance is projected like project_distance_on_horizontal_plane()
+		float expected_distance = 1000.f;
+		ObstacleMath::project_distance_on_horizontal_plane(expected_distance, math::radians(bin * 45.f + 90.f),
+				vehicle_attitude);
+		EXPECT_NEAR(distances[bin], expected_distance, 1.f);
+	}
+}
+
+TEST(ObstacleMathTest, ScanBinnerIncremental)
+{
+	// GIVEN: a scan binner with 5 degree bins
+	ObstacleMath::ScanBinner binner;
+	ASSERT_TRUE(binner.configure(5.f, 0.f, 5000));
+
+	uint16_t distances[72];
+	uint64_t timestamps[72] {};
+
+	for (int i = 0; i < 72; i++) {
+		distances[i] = UINT16_MAX;
+	}
+
+	// WHEN: points are added within a bin
+	EXPECT_EQ(binner.add_point(1000, 300, distances, timestamps, 1), 0);
+	EXPECT_EQ(binner.add_point(1100, 200, distances, timestamps, 1), 0);
+	EXPECT_EQ(binner.add_point(1200, 400, distances, timestamps, 1), 0);
+
+	// THEN: nothing is written until the scan leaves the bin, then the minimum is written
+	EXPECT_EQ(distances[2], UINT16_MAX);
+	EXPECT_EQ(binner.add_point(1300, 500, distances, timestamps, 2), 1);
+	EXPECT_EQ(distances[2], 200);
+	EXPECT_EQ(timestamps[2], 2);
+
+	// WHEN: the scan skips two bins clockwise
+	EXPECT_EQ(binner.add_point(2800, 600, distances, timestamps, 3), 3);
+
+	// THEN: the skipped bins get the measurement of the completed bin
+	EXPECT_EQ(distances[3], 500);
+	EXPECT_EQ(distances[4], 500);
+	EXPECT_EQ(distances[5], 500);
+	EXPECT_EQ(distances[6], UINT16_MAX);
+
+	// WHEN: the scan wraps around counter clockwise across 0 degrees
+	binner.reset();
+	binner.add_point(500, 700, distances, timestamps, 4);
+	EXPECT_EQ(binner.add_point(-1000, 800, distances, timestamps, 4), 3);
+
+	// THEN: the bins between are written
+	EXPECT_EQ(distances[1], 700);
+	EXPECT_EQ(distances[0], 700);
+	EXPECT_EQ(distances[71], 700);
+	EXPECT_EQ(distances[70], UINT16_MAX);
+
+	// WHEN: the scan jumps by more than a quarter turn
+	binner.reset();
+	binner.add_point(18000, 900, distances, timestamps, 5);
+	EXPECT_EQ(binner.add_point(0, 100, distances, timestamps, 5), 1);
+
+	// THEN: only the completed bin is written
+	EXPECT_EQ(distances[36], 900);
+	EXPECT_EQ(distances[35], UINT16_MAX);
+	EXPECT_EQ(distances[37], UINT16_MAX);
+
+	// WHEN: the distance is larger than the maximum distance
+	binner.reset();
+	binner.add_point(1000, 6000, distances, timestamps, 6);
+	binner.add_point(1500, 100, distances, timestamps, 6);
+
+	// THEN: it is written as out of range
+	EXPECT_EQ(distances[2], 5001);
+}
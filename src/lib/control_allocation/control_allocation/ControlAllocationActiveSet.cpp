@@ -0,0 +1,332 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ControlAllocationActiveSet.cpp
+ *
+ * Active-set solver for the actuator constrained weighted least squares allocation problem:
+ *
+ *   min  gamma * ||Wv * (B * du - v)||^2 + ||du - du_pinv||^2
+ *   s.t. u_min - u_trim <= du <= u_max - u_trim
+ *
+ * with du = u - u_trim, v = c - c_trim and du_pinv the unconstrained pseudo-inverse solution.
+ * See Härkegård, "Efficient active set algorithms for solving constrained least squares problems
+ * in aircraft control allocation", 2002.
+ */
+
+#include "ControlAllocationActiveSet.hpp"
+
+#include <mathlib/math/Limits.hpp>
+
+// Control error weights Wv: roll and pitch have priority over thrust, and thrust over yaw
+static constexpr float AXIS_WEIGHTS[ControlAllocation::NUM_AXES] {1.f, 1.f, 0.1f, 0.3f, 0.3f, 0.3f};
+
+void
+ControlAllocationActiveSet::updateCostFunction()
+{
+	// Effectiveness in the units of the (normalized) control setpoint, like getAllocatedControl()
+	for (int i = 0; i < NUM_AXES; i++) {
+		const float weight = CONTROL_ERROR_WEIGHT * AXIS_WEIGHTS[i] * AXIS_WEIGHTS[i] * _control_allocation_scale(i);
+
+		for (int j = 0; j < NUM_ACTUATORS; j++) {
+			_weighted_effectiveness(i, j) = weight * _effectiveness(i, j);
+		}
+	}
+
+	for (int j = 0; j < _num_actuators; j++) {
+		for (int k = j; k < _num_actuators; k++) {
+			float h = (j == k) ? 1.f : 0.f;
+
+			for (int i = 0; i < NUM_AXES; i++) {
+				h += _weighted_effectiveness(i, j) * _control_allocation_scale(i) * _effectiveness(i, k);
+			}
+
+			_hessian(j, k) = h;
+			_hessian(k, j) = h;
+		}
+	}
+}
+
+bool
+ControlAllocationActiveSet::computeStep(const ActuatorVector &du, const ActuatorVector &gradient_offset,
+					ActuatorVector &step)
+{
+	int free_idx[NUM_ACTUATORS];
+	int num_free = 0;
+
+	for (int i = 0; i < _num_actuators; i++) {
+		if (_working_set[i] == BoundState::Free) {
+			free_idx[num_free++] = i;
+		}
+	}
+
+	step.setZero();
+
+	if (num_free == 0) {
+		return true;
+	}
+
+	// Negative gradient of the cost restricted to the free actuators (stored in step)
+	for (int a = 0; a < num_free; a++) {
+		const int i = free_idx[a];
+		float gradient = -gradient_offset(i);
+
+		for (int j = 0; j < _num_actuators; j++) {
+			gradient += _hessian(i, j) * du(j);
+		}
+
+		step(a) = -gradient;
+	}
+
+	// Cholesky factorization of the reduced Hessian (lower triangle)
+	for (int a = 0; a < num_free; a++) {
+		for (int b = 0; b <= a; b++) {
+			float sum = _hessian(free_idx[a], free_idx[b]);
+
+			for (int k = 0; k < b; k++) {
+				sum -= _factor(a, k) * _factor(b, k);
+			}
+
+			if (a == b) {
+				if (sum < FLT_EPSILON) {
+					return false;
+				}
+
+				_factor(a, a) = sqrtf(sum);
+
+			} else {
+				_factor(a, b) = sum / _factor(b, b);
+			}
+		}
+	}
+
+	// Forward and back substitution
+	for (int a = 0; a < num_free; a++) {
+		for (int k = 0; k < a; k++) {
+			step(a) -= _factor(a, k) * step(k);
+		}
+
+		step(a) /= _factor(a, a);
+	}
+
+	for (int a = num_free - 1; a >= 0; a--) {
+		for (int k = a + 1; k < num_free; k++) {
+			step(a) -= _factor(k, a) * step(k);
+		}
+
+		step(a) /= _factor(a, a);
+	}
+
+	// Scatter to the actuator indexes (free_idx is increasing, so go backwards)
+	for (int a = num_free - 1; a >= 0; a--) {
+		const float value = step(a);
+		step(a) = 0.f;
+		step(free_idx[a]) = value;
+	}
+
+	return true;
+}
+
+void
+ControlAllocationActiveSet::allocate()
+{
+	const bool cost_update_needed = _mix_update_needed;
+
+	//Compute new gains if needed
+	updatePseudoInverse();
+
+	if (cost_update_needed) {
+		updateCostFunction();
+	}
+
+	_prev_actuator_sp = _actuator_sp;
+	_last_iteration_count = 0;
+
+	const matrix::Vector<float, NUM_AXES> control = _control_sp - _control_trim;
+	const ActuatorVector du_pinv = _mix * control;
+
+	ActuatorVector du_min;
+	ActuatorVector du_max;
+	bool unconstrained_feasible = true;
+
+	for (int i = 0; i < _num_actuators; i++) {
+		if (_actuator_max(i) < _actuator_min(i)) {
+			// disabled actuator, kept at trim like clipActuatorSetpoint() does
+			du_min(i) = 0.f;
+			du_max(i) = 0.f;
+
+		} else {
+			du_min(i) = _actuator_min(i) - _actuator_trim(i);
+			du_max(i) = _actuator_max(i) - _actuator_trim(i);
+		}
+
+		if (du_pinv(i) < du_min(i) || du_pinv(i) > du_max(i)) {
+			unconstrained_feasible = false;
+		}
+	}
+
+	if (unconstrained_feasible) {
+		// the pseudo-inverse solution is the optimum if no actuator saturates
+		_actuator_sp = _actuator_trim + du_pinv;
+
+		for (int i = 0; i < NUM_ACTUATORS; i++) {
+			_working_set[i] = BoundState::Free;
+		}
+
+		return;
+	}
+
+	// Warm start from the working set of the previous allocation. Without one (nothing was saturated),
+	// start with the saturated actuators of the pseudo-inverse solution as active bounds.
+	bool cold_start = true;
+
+	for (int i = 0; i < _num_actuators; i++) {
+		if (_working_set[i] != BoundState::Free) {
+			cold_start = false;
+		}
+	}
+
+	ActuatorVector du;
+
+	for (int i = 0; i < _num_actuators; i++) {
+		if (du_max(i) - du_min(i) < FLT_EPSILON) {
+			_working_set[i] = BoundState::Lower;
+
+		} else if (cold_start) {
+			if (du_pinv(i) < du_min(i)) {
+				_working_set[i] = BoundState::Lower;
+
+			} else if (du_pinv(i) > du_max(i)) {
+				_working_set[i] = BoundState::Upper;
+			}
+		}
+
+		switch (_working_set[i]) {
+		case BoundState::Lower:
+			du(i) = du_min(i);
+			break;
+
+		case BoundState::Upper:
+			du(i) = du_max(i);
+			break;
+
+		case BoundState::Free:
+			du(i) = math::constrain(du_pinv(i), du_min(i), du_max(i));
+			break;
+		}
+	}
+
+	// The gradient of the cost is hessian * du - gradient_offset
+	const ActuatorVector gradient_offset = _weighted_effectiveness.transpose() * control + du_pinv;
+
+	ActuatorVector step;
+	bool subspace_optimal = false;
+
+	while (_last_iteration_count < MAX_ITERATIONS) {
+		++_last_iteration_count;
+
+		if (!subspace_optimal) {
+			if (!computeStep(du, gradient_offset, step)) {
+				break;
+			}
+
+			// Go as far as possible along the step without violating a bound
+			float alpha = 1.f;
+			int blocking_idx = -1;
+			BoundState blocking_state = BoundState::Free;
+
+			for (int i = 0; i < _num_actuators; i++) {
+				if (_working_set[i] != BoundState::Free) {
+					continue;
+				}
+
+				if (step(i) < 0.f && du(i) + alpha * step(i) < du_min(i)) {
+					alpha = (du_min(i) - du(i)) / step(i);
+					blocking_idx = i;
+					blocking_state = BoundState::Lower;
+
+				} else if (step(i) > 0.f && du(i) + alpha * step(i) > du_max(i)) {
+					alpha = (du_max(i) - du(i)) / step(i);
+					blocking_idx = i;
+					blocking_state = BoundState::Upper;
+				}
+			}
+
+			for (int i = 0; i < _num_actuators; i++) {
+				du(i) += alpha * step(i);
+			}
+
+			if (blocking_idx >= 0) {
+				du(blocking_idx) = (blocking_state == BoundState::Lower) ? du_min(blocking_idx) : du_max(blocking_idx);
+				_working_set[blocking_idx] = blocking_state;
+
+			} else {
+				subspace_optimal = true;
+			}
+
+			continue;
+		}
+
+		// At the optimum of the current subspace: release the bound with the most negative Lagrange multiplier
+		int release_idx = -1;
+		float min_multiplier = -FLT_EPSILON;
+
+		for (int i = 0; i < _num_actuators; i++) {
+			if (_working_set[i] == BoundState::Free || du_max(i) - du_min(i) < FLT_EPSILON) {
+				continue;
+			}
+
+			float gradient = -gradient_offset(i);
+
+			for (int j = 0; j < _num_actuators; j++) {
+				gradient += _hessian(i, j) * du(j);
+			}
+
+			const float multiplier = (_working_set[i] == BoundState::Lower) ? gradient : -gradient;
+
+			if (multiplier < min_multiplier) {
+				min_multiplier = multiplier;
+				release_idx = i;
+			}
+		}
+
+		if (release_idx < 0) {
+			break; // optimal
+		}
+
+		_working_set[release_idx] = BoundState::Free;
+		subspace_optimal = false;
+	}
+
+	_actuator_sp = _actuator_trim + du;
+}
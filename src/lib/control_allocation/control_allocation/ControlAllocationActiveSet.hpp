@@ -0,0 +1,97 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ControlAllocationActiveSet.hpp
+ *
+ * Control Allocation Algorithm which solves the actuator constrained weighted least squares problem
+ * with an active-set method.
+ *
+ * The control error is minimized with a priority on roll and pitch, and the actuator limits are
+ * always respected. The solver is warm-started from the working set of the previous allocation
+ * and its iteration count is bounded, so the worst-case execution time is fixed.
+ */
+
+#pragma once
+
+#include "ControlAllocationPseudoInverse.hpp"
+
+class ControlAllocationActiveSet: public ControlAllocationPseudoInverse
+{
+public:
+	ControlAllocationActiveSet() = default;
+	virtual ~ControlAllocationActiveSet() = default;
+
+	void allocate() override;
+
+	/**
+	 * Maximum number of active-set iterations per allocation (one linear solve or
+	 * one Lagrange multiplier check each). If the budget is exhausted, the last
+	 * (feasible) iterate is used.
+	 */
+	static constexpr int MAX_ITERATIONS{10};
+
+	/**
+	 * Relative weight of the control error (per axis) with respect to the actuator deviation from the
+	 * unconstrained pseudo-inverse solution.
+	 */
+	static constexpr float CONTROL_ERROR_WEIGHT{1000.f};
+
+	int lastIterationCount() const { return _last_iteration_count; }
+
+private:
+	enum class BoundState : uint8_t {
+		Free,
+		Lower,
+		Upper
+	};
+
+	/**
+	 * Recompute the Hessian and the weighted effectiveness of the least squares problem
+	 * after a change of the effectiveness matrix or the normalization scale.
+	 */
+	void updateCostFunction();
+
+	/**
+	 * Solve for the step minimizing the cost within the subspace of the free actuators.
+	 * @return false if the reduced Hessian is not positive definite
+	 */
+	bool computeStep(const ActuatorVector &du, const ActuatorVector &gradient_offset, ActuatorVector &step);
+
+	matrix::SquareMatrix<float, NUM_ACTUATORS> _hessian;  ///< gamma * Bn^T * Wv^2 * Bn + I, with Bn = S * B the normalized effectiveness
+	matrix::SquareMatrix<float, NUM_ACTUATORS> _factor;  ///< scratch space for the Cholesky factor of the reduced Hessian
+	matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> _weighted_effectiveness; ///< gamma * Wv^2 * Bn
+
+	BoundState _working_set[NUM_ACTUATORS] {};
+	int _last_iteration_count{0};
+};
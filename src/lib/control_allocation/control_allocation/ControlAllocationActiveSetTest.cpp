@@ -0,0 +1,130 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file ControlAllocationActiveSetTest.cpp
+ *
+ * Tests for the active-set Control Allocation Algorithm
+ */
+
+#include <gtest/gtest.h>
+#include <ControlAllocationActiveSet.hpp>
+
+using namespace matrix;
+
+namespace
+{
+
+// Quadrotor in X configuration
+matrix::Matrix<float, 6, 16> quadEffectiveness()
+{
+	matrix::Matrix<float, 6, 16> effectiveness;
+	const float roll[4] {-1.f, 1.f, 1.f, -1.f};
+	const float pitch[4] {1.f, -1.f, 1.f, -1.f};
+	const float yaw[4] {0.05f, 0.05f, -0.05f, -0.05f};
+
+	for (int i = 0; i < 4; i++) {
+		effectiveness(0, i) = roll[i];
+		effectiveness(1, i) = pitch[i];
+		effectiveness(2, i) = yaw[i];
+		effectiveness(5, i) = -1.f;
+	}
+
+	return effectiveness;
+}
+
+template<typename Allocation>
+matrix::Vector<float, 16> allocate(Allocation &method, const matrix::Vector<float, 6> &control_sp)
+{
+	const matrix::Vector<float, 16> zero;
+	method.setEffectivenessMatrix(quadEffectiveness(), zero, zero, 4, true);
+	method.setControlSetpoint(control_sp);
+	method.allocate();
+	return method.getActuatorSetpoint();
+}
+
+} // namespace
+
+TEST(ControlAllocationActiveSetTest, UnsaturatedMatchesPseudoInverse)
+{
+	ControlAllocationActiveSet method;
+	ControlAllocationPseudoInverse pseudo_inverse;
+
+	matrix::Vector<float, 6> control_sp;
+	control_sp(0) = 0.1f;
+	control_sp(2) = 0.05f;
+	control_sp(5) = -0.5f;
+
+	const matrix::Vector<float, 16> actuator_sp = allocate(method, control_sp);
+	const matrix::Vector<float, 16> actuator_sp_expected = allocate(pseudo_inverse, control_sp);
+
+	EXPECT_EQ(actuator_sp, actuator_sp_expected);
+	EXPECT_EQ(method.lastIterationCount(), 0);
+}
+
+TEST(ControlAllocationActiveSetTest, SaturatedRespectsLimits)
+{
+	ControlAllocationActiveSet method;
+	ControlAllocationPseudoInverse pseudo_inverse;
+
+	// full roll at high thrust saturates two motors
+	matrix::Vector<float, 6> control_sp;
+	control_sp(0) = 0.5f;
+	control_sp(2) = 0.2f;
+	control_sp(5) = -0.9f;
+
+	const matrix::Vector<float, 16> actuator_sp = allocate(method, control_sp);
+	allocate(pseudo_inverse, control_sp);
+	pseudo_inverse.clipActuatorSetpoint();
+
+	for (int i = 0; i < 4; i++) {
+		EXPECT_GE(actuator_sp(i), 0.f);
+		EXPECT_LE(actuator_sp(i), 1.f);
+	}
+
+	EXPECT_LE(method.lastIterationCount(), ControlAllocationActiveSet::MAX_ITERATIONS);
+
+	// roll has priority and is better tracked than with output clipping
+	const float roll_error = fabsf(method.getAllocatedControl()(0) - control_sp(0));
+	const float roll_error_clipped = fabsf(pseudo_inverse.getAllocatedControl()(0) - control_sp(0));
+	EXPECT_LT(roll_error, roll_error_clipped);
+	EXPECT_LT(roll_error, 0.01f);
+
+	// the warm start from the previous working set directly finds the same solution
+	allocate(method, control_sp);
+	EXPECT_LE(method.lastIterationCount(), 2);
+
+	for (int i = 0; i < 4; i++) {
+		EXPECT_NEAR(method.getActuatorSetpoint()(i), actuator_sp(i), 1e-4f);
+	}
+}
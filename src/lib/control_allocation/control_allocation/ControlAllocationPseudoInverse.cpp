@@ -41,15 +41,22 @@
 
 #include "ControlAllocationPseudoInverse.hpp"
 
+#include <string.h>
+
 void
 ControlAllocationPseudoInverse::setEffectivenessMatrix(
 	const matrix::Matrix<float, ControlAllocation::NUM_AXES, ControlAllocation::NUM_ACTUATORS> &effectiveness,
 	const ActuatorVector &actuator_trim, const ActuatorVector &linearization_point, int num_actuators,
 	bool update_normalization_scale)
 {
+	// The allocator sets all the matrices on every update, even if only one of them changed (e.g. the
+	// rotors of a tiltrotor, but not its control surfaces). Only recompute the inverse if needed.
+	const bool effectiveness_changed = (num_actuators != _num_actuators)
+					   || (memcmp(&effectiveness, &_effectiveness, sizeof(_effectiveness)) != 0);
+
 	ControlAllocation::setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, num_actuators,
 			update_normalization_scale);
-	_mix_update_needed = true;
+	_mix_update_needed = _mix_update_needed || effectiveness_changed || update_normalization_scale;
 	_normalization_needs_update = update_normalization_scale;
 
 	if (_metric_allocation && update_normalization_scale) {
@@ -57,7 +57,11 @@ public:
 	void setEffectivenessMatrix(const matrix::Matrix<float, NUM_AXES, NUM_ACTUATORS> &effectiveness,
 				    const ActuatorVector &actuator_trim, const ActuatorVector &linearization_point, int num_actuators,
 				    bool update_normalization_scale) override;
-	void setMetricAllocation(bool metric_allocation) { _metric_allocation = metric_allocation; }
+	void setMetricAllocation(bool metric_allocation)
+	{
+		_mix_update_needed = _mix_update_needed || (metric_allocation != _metric_allocation);
+		_metric_allocation = metric_allocation;
+	}
 
 protected:
 	matrix::Matrix<float, NUM_ACTUATORS, NUM_AXES> _mix;
@@ -91,3 +91,40 @@ TEST(ControlAllocationMetricTest, AllZeroCase)
 	EXPECT_EQ(actuator_sp, actuator_sp_expected);
 	EXPECT_EQ(control_allocated, control_allocated_expected);
 }
+
+TEST(ControlAllocationMetricTest, EffectivenessUpdate)
+{
+	ControlAllocationPseudoInverse method;
+
+	matrix::Vector<float, 6> control_sp;
+	matrix::Matrix<float, 6, 16> effectiveness;
+	matrix::Vector<float, 16> actuator_trim;
+	matrix::Vector<float, 16> linearization_point;
+
+	// 4 vertical rotors
+	for (int i = 0; i < 4; i++) {
+		effectiveness(5, i) = -1.f;
+	}
+
+	control_sp(5) = -2.f;
+
+	method.setMetricAllocation(true);
+	method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 4, false);
+	method.setControlSetpoint(control_sp);
+	method.allocate();
+	EXPECT_FLOAT_EQ(method.getActuatorSetpoint()(0), 0.5f);
+
+	// setting the same matrix again keeps the allocation
+	method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 4, false);
+	method.allocate();
+	EXPECT_FLOAT_EQ(method.getActuatorSetpoint()(0), 0.5f);
+
+	// a changed matrix is applied
+	for (int i = 0; i < 4; i++) {
+		effectiveness(5, i) = -2.f;
+	}
+
+	method.setEffectivenessMatrix(effectiveness, actuator_trim, linearization_point, 4, false);
+	method.allocate();
+	EXPECT_FLOAT_EQ(method.getActuatorSetpoint()(0), 0.25f);
+}
@@ -39,13 +39,52 @@
 
 #include "rotation.h"
 
+namespace
+{
+
+struct RotMatrixTable {
+	float dcm[ROTATION_MAX][3][3];
+};
+
+// same as matrix::Dcm(Euler), evaluated at compile time
+constexpr RotMatrixTable generateRotMatrixTable()
+{
+	RotMatrixTable table{};
+
+	for (int rot = 0; rot < ROTATION_MAX; rot++) {
+		const double cos_phi = math::cosDegConstexpr(rot_lookup[rot].roll);
+		const double sin_phi = math::sinDegConstexpr(rot_lookup[rot].roll);
+		const double cos_the = math::cosDegConstexpr(rot_lookup[rot].pitch);
+		const double sin_the = math::sinDegConstexpr(rot_lookup[rot].pitch);
+		const double cos_psi = math::cosDegConstexpr(rot_lookup[rot].yaw);
+		const double sin_psi = math::sinDegConstexpr(rot_lookup[rot].yaw);
+
+		float (&dcm)[3][3] = table.dcm[rot];
+
+		dcm[0][0] = static_cast<float>(cos_the * cos_psi);
+		dcm[0][1] = static_cast<float>(-cos_phi * sin_psi + sin_phi * sin_the * cos_psi);
+		dcm[0][2] = static_cast<float>(sin_phi * sin_psi + cos_phi * sin_the * cos_psi);
+
+		dcm[1][0] = static_cast<float>(cos_the * sin_psi);
+		dcm[1][1] = static_cast<float>(cos_phi * cos_psi + sin_phi * sin_the * sin_psi);
+		dcm[1][2] = static_cast<float>(-sin_phi * cos_psi + cos_phi * sin_the * sin_psi);
+
+		dcm[2][0] = static_cast<float>(-sin_the);
+		dcm[2][1] = static_cast<float>(sin_phi * cos_the);
+		dcm[2][2] = static_cast<float>(cos_phi * cos_the);
+	}
+
+	return table;
+}
+
+constexpr RotMatrixTable rot_matrix_table = generateRotMatrixTable();
+
+} // namespace
+
 __EXPORT matrix::Dcmf
 get_rot_matrix(enum Rotation rot)
 {
-	return matrix::Dcmf{matrix::Eulerf{
-			math::radians((float)rot_lookup[rot].roll),
-			math::radians((float)rot_lookup[rot].pitch),
-			math::radians((float)rot_lookup[rot].yaw)}};
+	return matrix::Dcmf{rot_matrix_table.dcm[rot]};
 }
 
 __EXPORT matrix::Quatf
@@ -0,0 +1,117 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+#include "crc.h"
+}
+
+// bit by bit reference implementations
+static uint16_t crc16_reference(uint16_t crc, size_t length, const uint8_t *bytes)
+{
+	for (size_t i = 0; i < length; i++) {
+		crc ^= (uint16_t)(bytes[i] << 8);
+
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+		}
+	}
+
+	return crc;
+}
+
+static uint32_t crc32_reference(uint32_t crc, size_t length, const uint8_t *bytes)
+{
+	for (size_t i = 0; i < length; i++) {
+		crc ^= bytes[i];
+
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc & 1) ? (crc >> 1) ^ 0xedb88320u : crc >> 1;
+		}
+	}
+
+	return crc;
+}
+
+TEST(CrcTest, CheckValues)
+{
+	const char *check = "123456789";
+	const uint8_t *bytes = (const uint8_t *)check;
+
+	// CRC-16/CCITT-FALSE
+	EXPECT_EQ(crc16_signature(CRC16_INITIAL, 9, bytes), 0x29B1);
+
+	// CRC-32 (ISO-HDLC) with the initial and final inversion done by the caller
+	EXPECT_EQ(crc32_signature(0xFFFFFFFFu, 9, bytes) ^ 0xFFFFFFFFu, 0xCBF43926u);
+}
+
+TEST(CrcTest, MatchesBitwise)
+{
+	uint8_t data[301];
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 151u + 17u);
+	}
+
+	// all lengths and offsets around the 8 byte blocks
+	for (size_t offset = 0; offset < 9; offset++) {
+		for (size_t length = 0; length + offset <= sizeof(data); length += 7) {
+			EXPECT_EQ(crc16_signature(0x1D0F, length, &data[offset]), crc16_reference(0x1D0F, length, &data[offset]));
+			EXPECT_EQ(crc32_signature(0x12345678u, length, &data[offset]), crc32_reference(0x12345678u, length, &data[offset]));
+		}
+	}
+}
+
+TEST(CrcTest, Incremental)
+{
+	uint8_t data[100];
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 31u);
+	}
+
+	uint16_t crc16 = CRC16_INITIAL;
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		crc16 = crc16_add(crc16, data[i]);
+	}
+
+	EXPECT_EQ(crc16, crc16_signature(CRC16_INITIAL, sizeof(data), data));
+
+	// splitting the data must not change the result
+	const uint32_t crc32_part = crc32_signature(0, 13, data);
+	EXPECT_EQ(crc32_signature(crc32_part, sizeof(data) - 13, &data[13]), crc32_signature(0, sizeof(data), data));
+}
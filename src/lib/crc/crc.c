@@ -38,6 +38,7 @@
  * Included Files
  ****************************************************************************/
 
+#include <px4_boardconfig.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include "crc.h"
@@ -46,6 +47,12 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+#if defined(CONFIG_LIB_CRC_SLICING_BY_8)
+#  define CRC_TABLE_SLICES 8
+#elif defined(CONFIG_LIB_CRC_TABLES)
+#  define CRC_TABLE_SLICES 1
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -58,6 +65,10 @@
  * Private Data
  ****************************************************************************/
 
+#if defined(CRC_TABLE_SLICES)
+#  include "crc_tables.h"
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -88,6 +99,9 @@
 
 uint16_t crc16_add(uint16_t crc, uint8_t value)
 {
+#if defined(CRC_TABLE_SLICES)
+	return (uint16_t)((crc << 8u) ^ crc16_table[0][(uint8_t)((crc >> 8u) ^ value)]);
+#else
 	uint32_t i;
 	const uint16_t poly = 0x1021u;
 	crc ^= (uint16_t)((uint16_t) value << 8u);
@@ -102,6 +116,7 @@ uint16_t crc16_add(uint16_t crc, uint8_t value)
 	}
 
 	return crc;
+#endif
 }
 
 /****************************************************************************
@@ -123,9 +138,21 @@ uint16_t crc16_add(uint16_t crc, uint8_t value)
 
 uint16_t crc16_signature(uint16_t initial, size_t length, const uint8_t *bytes)
 {
-	size_t i;
+	size_t i = 0u;
+
+#if defined(CONFIG_LIB_CRC_SLICING_BY_8)
+
+	/* 8 bytes at a time, the crc only overlaps the first two of them */
+	for (; i + 8u <= length; i += 8u) {
+		const uint8_t *b = &bytes[i];
+		initial = crc16_table[7][(uint8_t)((initial >> 8u) ^ b[0])] ^ crc16_table[6][(uint8_t)(initial ^ b[1])] ^
+			  crc16_table[5][b[2]] ^ crc16_table[4][b[3]] ^ crc16_table[3][b[4]] ^
+			  crc16_table[2][b[5]] ^ crc16_table[1][b[6]] ^ crc16_table[0][b[7]];
+	}
+
+#endif
 
-	for (i = 0u; i < length; i++) {
+	for (; i < length; i++) {
 		initial = crc16_add(initial, bytes[i]);
 	}
 
@@ -150,12 +177,32 @@ uint16_t crc16_signature(uint16_t initial, size_t length, const uint8_t *bytes)
 
 uint32_t crc32_signature(uint32_t acc, size_t length, const uint8_t *bytes)
 {
-	size_t i;
+	size_t i = 0u;
+
+#if defined(CONFIG_LIB_CRC_SLICING_BY_8)
+
+	/* 8 bytes at a time (slicing-by-8), the crc overlaps the first four of them */
+	for (; i + 8u <= length; i += 8u) {
+		const uint8_t *b = &bytes[i];
+		acc = crc32_table[7][(uint8_t)(acc ^ b[0])] ^ crc32_table[6][(uint8_t)((acc >> 8u) ^ b[1])] ^
+		      crc32_table[5][(uint8_t)((acc >> 16u) ^ b[2])] ^ crc32_table[4][(uint8_t)((acc >> 24u) ^ b[3])] ^
+		      crc32_table[3][b[4]] ^ crc32_table[2][b[5]] ^ crc32_table[1][b[6]] ^ crc32_table[0][b[7]];
+	}
+
+#endif
+
+#if defined(CRC_TABLE_SLICES)
+
+	for (; i < length; i++) {
+		acc = crc32_table[0][(uint8_t)(acc ^ bytes[i])] ^ (acc >> 8u);
+	}
+
+#else
 	const uint32_t poly = 0xedb88320u;
 	const uint8_t  bits = 8u;
 	uint8_t        w = bits;
 
-	for (i = 0u; i < length; i++) {
+	for (; i < length; i++) {
 		acc ^= bytes[i];
 		w = bits;
 
@@ -166,6 +213,8 @@ uint32_t crc32_signature(uint32_t acc, size_t length, const uint8_t *bytes)
 		}
 	}
 
+#endif
+
 	return acc;
 }
 
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""
+Generate crc_tables.h, the lookup tables of crc.c
+
+CRC-16-CCITT (0x1021, MSB first) and the reflected CRC-32 (0xEDB88320),
+8 tables each for slicing-by-8, table[k][b] being the CRC of byte b followed by k zero bytes.
+
+Usage:
+    ./crc_tables.py > crc_tables.h
+"""
+
+SLICES = 8
+
+
+def crc16_tables():
+    tables = [[0] * 256 for _ in range(SLICES)]
+
+    for b in range(256):
+        crc = b << 8
+
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+
+        tables[0][b] = crc & 0xffff
+
+    for k in range(1, SLICES):
+        for b in range(256):
+            prev = tables[k - 1][b]
+            tables[k][b] = ((prev << 8) & 0xffff) ^ tables[0][prev >> 8]
+
+    return tables
+
+
+def crc32_tables():
+    tables = [[0] * 256 for _ in range(SLICES)]
+
+    for b in range(256):
+        crc = b
+
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0xedb88320 if crc & 1 else crc >> 1
+
+        tables[0][b] = crc
+
+    for k in range(1, SLICES):
+        for b in range(256):
+            prev = tables[k - 1][b]
+            tables[k][b] = (prev >> 8) ^ tables[0][prev & 0xff]
+
+    return tables
+
+
+def print_tables(name, c_type, digits, tables):
+    print('static const %s %s[CRC_TABLE_SLICES][256] = {' % (c_type, name))
+
+    for k, table in enumerate(tables):
+        if k == 1:
+            print('#if CRC_TABLE_SLICES == 8')
+
+        print('\t{')
+
+        for i in range(0, 256, 8):
+            print('\t\t' + ', '.join('0x%0*x' % (digits, v) for v in table[i:i + 8]) + ',')
+
+        print('\t},')
+
+    print('#endif // CRC_TABLE_SLICES == 8')
+    print('};')
+
+
+print('/* Generated by crc_tables.py, do not edit */')
+print('')
+print('#pragma once')
+print('')
+print_tables('crc16_table', 'uint16_t', 4, crc16_tables())
+print('')
+print_tables('crc32_table', 'uint32_t', 8, crc32_tables())
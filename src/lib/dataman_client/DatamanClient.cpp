@@ -613,9 +613,14 @@ bool DatamanCache::writeWait(dm_item_t item, uint32_t index, uint8_t *buffer, ui
 void DatamanCache::update()
 {
 	if (_item_counter > 0) {
-
 		_client.update();
+	}
+
+	// Continue with the next item right away as long as there is no response to wait for,
+	// so the cache gets filled in half the number of calls
+	for (uint32_t i = 0; (i < _num_items) && (_item_counter > 0); ++i) {
 
+		const uint32_t update_index = _update_index;
 		bool success = false;
 		bool response_success = false;
 
@@ -673,6 +678,10 @@ void DatamanCache::update()
 			changeUpdateIndex();
 		}
 
+		if (_update_index == update_index) {
+			// waiting for a response
+			break;
+		}
 	}
 }
 
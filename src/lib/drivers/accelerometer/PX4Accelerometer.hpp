@@ -35,6 +35,7 @@
 
 #include <drivers/drv_hrt.h>
 #include <lib/conversion/rotation.h>
+#include <lib/drivers/sensor_timing/SensorTiming.hpp>
 #include <lib/geo/geo.h>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/topics/sensor_accel.h>
@@ -83,4 +84,6 @@ private:
 	uint32_t		_error_count{0};
 
 	int16_t			_last_sample[3] {};
+
+	SensorTiming		*_timing{nullptr}; ///< optional FIFO timing statistics (SENS_IMU_TIMING)
 };
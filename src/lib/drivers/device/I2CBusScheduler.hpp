@@ -0,0 +1,152 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file I2CBusScheduler.hpp
+ *
+ * Per I2C bus coordination of periodic transactions and bus utilization accounting.
+ *
+ * All the drivers of a bus run on the same work queue. If each of them starts its
+ * interval at an arbitrary time the transactions drift into and out of each other,
+ * causing bursts and idle gaps. Drivers starting their interval with aligned_delay()
+ * instead share a common epoch per bus and each get their own slot after the previously
+ * registered ones, so the periodic transactions run back-to-back in a fixed order.
+ *
+ * Transfers on a bus are serialized by its work queue, the accounting is not locked.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/log.h>
+
+namespace device
+{
+
+class I2CBusScheduler
+{
+public:
+	static constexpr int MAX_BUSES = 8;
+	static constexpr uint32_t DEFAULT_SLOT_US = 250; ///< a short register read at 400 kHz
+
+	/**
+	 * Delay to pass to ScheduleOnInterval() to phase align a periodic transaction with
+	 * the others on the bus.
+	 *
+	 * @param bus I2C bus number (1-based)
+	 * @param interval_us schedule interval
+	 * @param min_delay_us minimum delay before the first run
+	 * @param slot_us expected duration of the transaction
+	 * @return delay in microseconds (>= min_delay_us)
+	 */
+	static uint32_t aligned_delay(int bus, uint32_t interval_us, uint32_t min_delay_us = 0,
+				      uint32_t slot_us = DEFAULT_SLOT_US)
+	{
+		const hrt_abstime now = hrt_absolute_time();
+
+		if (!valid(bus) || (interval_us == 0)) {
+			return min_delay_us;
+		}
+
+		Bus &b = _buses[bus - 1];
+
+		if (b.epoch == 0) {
+			b.epoch = now;
+		}
+
+		const uint32_t offset = b.next_slot_us % interval_us;
+		b.next_slot_us += slot_us;
+
+		const uint32_t phase = (now + min_delay_us - b.epoch) % interval_us;
+
+		return min_delay_us + (offset + interval_us - phase) % interval_us;
+	}
+
+	/**
+	 * Account a completed transfer (including retries).
+	 */
+	static void record_transfer(int bus, const hrt_abstime &start, bool success)
+	{
+		if (!valid(bus)) {
+			return;
+		}
+
+		Bus &b = _buses[bus - 1];
+
+		if (b.stats_start == 0) {
+			b.stats_start = start;
+		}
+
+		b.busy_us += hrt_elapsed_time(&start);
+		b.transfers++;
+
+		if (!success) {
+			b.errors++;
+		}
+	}
+
+	static void print_status(int bus)
+	{
+		if (!valid(bus)) {
+			return;
+		}
+
+		const Bus &b = _buses[bus - 1];
+
+		if (b.transfers > 0) {
+			const hrt_abstime elapsed = hrt_elapsed_time(&b.stats_start);
+			const float utilization = (elapsed > 0) ? 100.f * b.busy_us / elapsed : 0.f;
+
+			PX4_INFO("I2C Bus %i utilization: %.1f%%, %" PRIu32 " transfers, %" PRIu32 " errors, %" PRIu32 " us slots allocated",
+				 bus, (double)utilization, b.transfers, b.errors, b.next_slot_us);
+		}
+	}
+
+private:
+	// zero initialized (static storage)
+	struct Bus {
+		hrt_abstime epoch;
+		uint32_t next_slot_us;
+
+		hrt_abstime stats_start;
+		uint64_t busy_us;
+		uint32_t transfers;
+		uint32_t errors;
+	};
+
+	static bool valid(int bus) { return (bus >= 1) && (bus <= MAX_BUSES); }
+
+	static inline Bus _buses[MAX_BUSES];
+};
+
+} // namespace device
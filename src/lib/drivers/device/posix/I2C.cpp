@@ -41,6 +41,7 @@
  */
 
 #include "I2C.hpp"
+#include "../I2CBusScheduler.hpp"
 
 #if defined(CONFIG_I2C)
 
@@ -133,6 +134,8 @@ I2C::transfer(const uint8_t *send, const unsigned send_len, uint8_t *recv, const
 		return PX4_ERROR;
 	}
 
+	const hrt_abstime transfer_start = hrt_absolute_time();
+
 	do {
 		DEVICE_DEBUG("transfer out %p/%u  in %p/%u", send, send_len, recv, recv_len);
 
@@ -177,6 +180,8 @@ I2C::transfer(const uint8_t *send, const unsigned send_len, uint8_t *recv, const
 
 	} while (retry_count++ < _retries);
 
+	I2CBusScheduler::record_transfer(get_device_bus(), transfer_start, ret == PX4_OK);
+
 	return ret;
 }
 
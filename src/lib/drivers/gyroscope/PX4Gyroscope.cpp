@@ -39,31 +39,25 @@
 
 using namespace time_literals;
 
-static constexpr int32_t sum(const int16_t samples[], uint8_t len)
+// trapezoidal integration (equally spaced) and clipping count of one FIFO axis in a single pass
+// returns the sum of all samples except the last one, which is weighted by 0.5 by the caller
+static inline int32_t sum_and_clipping(const int16_t samples[], uint8_t len, uint8_t &clip_count)
 {
 	int32_t sum = 0;
+	unsigned clip = 0;
 
 	for (int n = 0; n < len; n++) {
 		sum += samples[n];
-	}
-
-	return sum;
-}
 
-static constexpr uint8_t clipping(const int16_t samples[], uint8_t len)
-{
-	unsigned clip_count = 0;
-
-	for (int n = 0; n < len; n++) {
 		// - consider data clipped/saturated if it's INT16_MIN/INT16_MAX or within 1
 		// - this accommodates rotated data (|INT16_MIN| = INT16_MAX + 1)
 		//   and sensors that may re-use the lowest bit for other purposes (sync indicator, etc)
-		if ((samples[n] <= INT16_MIN + 1) || (samples[n] >= INT16_MAX - 1)) {
-			clip_count++;
-		}
+		clip += (samples[n] <= INT16_MIN + 1) || (samples[n] >= INT16_MAX - 1);
 	}
 
-	return clip_count;
+	clip_count = clip;
+
+	return sum - samples[len - 1];
 }
 
 PX4Gyroscope::PX4Gyroscope(uint32_t device_id, enum Rotation rotation) :
@@ -74,10 +68,16 @@ PX4Gyroscope::PX4Gyroscope(uint32_t device_id, enum Rotation rotation) :
 	_sensor_pub.advertise();
 
 	param_get(param_find("IMU_GYRO_RATEMAX"), &_imu_gyro_rate_max);
+
+	if (SensorTiming::enabled()) {
+		_timing = new SensorTiming(ORB_ID(sensor_gyro_timing));
+	}
 }
 
 PX4Gyroscope::~PX4Gyroscope()
 {
+	delete _timing;
+
 	_sensor_pub.unadvertise();
 	_sensor_fifo_pub.unadvertise();
 }
@@ -134,20 +134,42 @@ void PX4Gyroscope::update(const hrt_abstime &timestamp_sample, float x, float y,
 	_sensor_pub.publish(report);
 }
 
+sensor_gyro_fifo_s &PX4Gyroscope::getFIFOSample()
+{
+	if (_fifo_loan == nullptr) {
+		_fifo_loan = _sensor_fifo_pub.loan();
+	}
+
+	return (_fifo_loan != nullptr) ? *_fifo_loan : _fifo_sample;
+}
+
 void PX4Gyroscope::updateFIFO(sensor_gyro_fifo_s &sample)
 {
 	// rotate all raw samples and publish fifo
 	const uint8_t N = sample.samples;
 
-	for (int n = 0; n < N; n++) {
-		rotate_3i(_rotation, sample.x[n], sample.y[n], sample.z[n]);
+	if (_rotation != ROTATION_NONE) {
+		for (int n = 0; n < N; n++) {
+			rotate_3i(_rotation, sample.x[n], sample.y[n], sample.z[n]);
+		}
 	}
 
 	sample.device_id = _device_id;
 	sample.scale = _scale;
 	sample.timestamp = hrt_absolute_time();
-	_sensor_fifo_pub.publish(sample);
 
+	if (_timing) {
+		_timing->update(_device_id, sample.timestamp, sample.timestamp_sample, sample.dt, N);
+	}
+
+	if (&sample == _fifo_loan) {
+		// filled in place, the message stays readable after commit (single publisher)
+		_sensor_fifo_pub.commit();
+		_fifo_loan = nullptr;
+
+	} else {
+		_sensor_fifo_pub.publish(sample);
+	}
 
 	// publish
 	sensor_gyro_s report;
@@ -156,19 +178,16 @@ void PX4Gyroscope::updateFIFO(sensor_gyro_fifo_s &sample)
 	report.temperature = _temperature;
 	report.error_count = _error_count;
 
-	// trapezoidal integration (equally spaced)
+	// trapezoidal integration (equally spaced) and clipping
 	const float scale = _scale / (float)N;
-	report.x = (0.5f * (_last_sample[0] + sample.x[N - 1]) + sum(sample.x, N - 1)) * scale;
-	report.y = (0.5f * (_last_sample[1] + sample.y[N - 1]) + sum(sample.y, N - 1)) * scale;
-	report.z = (0.5f * (_last_sample[2] + sample.z[N - 1]) + sum(sample.z, N - 1)) * scale;
+	report.x = (0.5f * (_last_sample[0] + sample.x[N - 1]) + sum_and_clipping(sample.x, N, report.clip_counter[0])) * scale;
+	report.y = (0.5f * (_last_sample[1] + sample.y[N - 1]) + sum_and_clipping(sample.y, N, report.clip_counter[1])) * scale;
+	report.z = (0.5f * (_last_sample[2] + sample.z[N - 1]) + sum_and_clipping(sample.z, N, report.clip_counter[2])) * scale;
 
 	_last_sample[0] = sample.x[N - 1];
 	_last_sample[1] = sample.y[N - 1];
 	_last_sample[2] = sample.z[N - 1];
 
-	report.clip_counter[0] = clipping(sample.x, N);
-	report.clip_counter[1] = clipping(sample.y, N);
-	report.clip_counter[2] = clipping(sample.z, N);
 	report.samples = N;
 	report.timestamp = hrt_absolute_time();
 
@@ -35,6 +35,7 @@
 
 #include <drivers/drv_hrt.h>
 #include <lib/conversion/rotation.h>
+#include <lib/drivers/sensor_timing/SensorTiming.hpp>
 #include <uORB/PublicationMulti.hpp>
 #include <uORB/topics/sensor_gyro.h>
 #include <uORB/topics/sensor_gyro_fifo.h>
@@ -55,6 +56,13 @@ public:
 
 	void update(const hrt_abstime &timestamp_sample, float x, float y, float z);
 
+	/**
+	 * Get the FIFO message to fill and pass to updateFIFO(). It is loaned directly from the
+	 * sensor_gyro_fifo topic queue if possible (zero-copy), only samples, timestamp_sample,
+	 * dt and the first samples of x, y, z need to be written.
+	 */
+	sensor_gyro_fifo_s &getFIFOSample();
+
 	void updateFIFO(sensor_gyro_fifo_s &sample);
 
 	uint32_t get_device_id() const { return _device_id; }
@@ -81,4 +89,9 @@ private:
 	uint32_t		_error_count{0};
 
 	int16_t			_last_sample[3] {};
+
+	SensorTiming		*_timing{nullptr}; ///< optional FIFO timing statistics (SENS_IMU_TIMING)
+
+	sensor_gyro_fifo_s	*_fifo_loan{nullptr};
+	sensor_gyro_fifo_s	_fifo_sample{};
 };
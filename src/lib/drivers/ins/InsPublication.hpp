@@ -0,0 +1,92 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file InsPublication.hpp
+ * Output topic publication shared by the external INS drivers.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <uORB/PublicationMulti.hpp>
+
+/**
+ * Publication of an INS output topic (vehicle_attitude, vehicle_local_position, sensor_gps, ...).
+ *
+ * The message is filled in place in the topic queue when the topic can be loaned, instead of
+ * being built on the stack and copied on publish. Otherwise it falls back to a local message.
+ */
+template<typename T, typename Publication = uORB::PublicationMulti<T>>
+class InsPublication
+{
+public:
+	explicit InsPublication(const orb_metadata *meta) : _pub{meta} {}
+
+	/**
+	 * Get the zero initialized message to fill, to be published with publish().
+	 * @param timestamp_sample sample time of the packet [us]
+	 */
+	T &get(const hrt_abstime &timestamp_sample)
+	{
+		_loan = _pub.loan();
+
+		T &msg = (_loan != nullptr) ? *_loan : _msg;
+		msg = {};
+		msg.timestamp_sample = timestamp_sample;
+		return msg;
+	}
+
+	/**
+	 * Publish the message obtained with get().
+	 */
+	bool publish()
+	{
+		if (_loan != nullptr) {
+			_loan->timestamp = hrt_absolute_time();
+			_loan = nullptr;
+			return _pub.commit();
+		}
+
+		_msg.timestamp = hrt_absolute_time();
+		return _pub.publish(_msg);
+	}
+
+	bool advertise() { return _pub.advertise(); }
+
+private:
+	Publication _pub;
+
+	T *_loan{nullptr};
+	T _msg{};
+};
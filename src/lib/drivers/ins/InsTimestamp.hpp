@@ -0,0 +1,87 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file InsTimestamp.hpp
+ * Device to hrt time mapping shared by the external INS drivers.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+
+using namespace time_literals;
+
+/**
+ * Maps the device time of INS packets to hrt time, once per packet.
+ *
+ * The clock offset is the smallest observed difference between receive time and device time,
+ * which is the packet with the least transport latency, and slowly follows the clock drift.
+ */
+class InsTimestamp
+{
+public:
+	/**
+	 * @param device_time_us device time of the packet [us]
+	 * @param time_received hrt time the packet was received [us]
+	 * @return hrt time of the packet sample [us]
+	 */
+	hrt_abstime update(uint64_t device_time_us, const hrt_abstime &time_received)
+	{
+		const int64_t offset = static_cast<int64_t>(time_received) - static_cast<int64_t>(device_time_us);
+
+		if ((_offset == INT64_MIN) || (offset < _offset) || (offset - _offset > RESET_THRESHOLD)) {
+			// less latency than before, or the device clock was reset
+			_offset = offset;
+
+		} else {
+			_offset += (offset - _offset) / DRIFT_FILTER;
+		}
+
+		const int64_t timestamp_sample = static_cast<int64_t>(device_time_us) + _offset;
+
+		if ((timestamp_sample <= 0) || (timestamp_sample > static_cast<int64_t>(time_received))) {
+			return time_received;
+		}
+
+		return timestamp_sample;
+	}
+
+	void reset() { _offset = INT64_MIN; }
+
+private:
+	static constexpr int64_t RESET_THRESHOLD{1_s};
+	static constexpr int64_t DRIFT_FILTER{1000};
+
+	int64_t _offset{INT64_MIN};
+};
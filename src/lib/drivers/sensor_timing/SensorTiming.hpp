@@ -0,0 +1,158 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file SensorTiming.hpp
+ * FIFO timing statistics of an IMU driver (enabled with SENS_IMU_TIMING), shared by
+ * PX4Accelerometer and PX4Gyroscope.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
+#include <lib/parameters/param.h>
+#include <uORB/PublicationMulti.hpp>
+#include <uORB/topics/sensor_timing.h>
+
+class SensorTiming
+{
+public:
+	SensorTiming(const orb_metadata *meta) : _sensor_timing_pub{meta} {}
+
+	static bool enabled()
+	{
+		int32_t sens_imu_timing = 0;
+		param_get(param_find("SENS_IMU_TIMING"), &sens_imu_timing);
+		return sens_imu_timing != 0;
+	}
+
+	/**
+	 * Account for a FIFO publication.
+	 *
+	 * @param device_id sensor device id
+	 * @param timestamp publication time (us)
+	 * @param timestamp_sample FIFO timestamp_sample (us)
+	 * @param dt configured delta time between samples (us)
+	 * @param samples number of samples read
+	 */
+	void update(uint32_t device_id, const hrt_abstime &timestamp, const hrt_abstime &timestamp_sample, float dt,
+		    uint8_t samples)
+	{
+		if (_last_publish == 0) {
+			_last_publish = timestamp;
+		}
+
+		_publications++;
+		_samples_sum += samples;
+		_samples_min = math::min(_samples_min, samples);
+		_samples_max = math::max(_samples_max, samples);
+
+		const uint32_t latency = (timestamp > timestamp_sample) ? timestamp - timestamp_sample : 0;
+		_latency_sum += latency;
+		_latency_max = math::max(_latency_max, latency);
+
+		if ((_timestamp_sample_last != 0) && (timestamp_sample > _timestamp_sample_last) && (dt > 0.f)) {
+			const float expected = samples * dt;
+			const float jitter = (timestamp_sample - _timestamp_sample_last) - expected;
+
+			if (jitter > 0.5f * dt) {
+				// a larger interval than the samples account for means samples were lost in between
+				_samples_missed += roundf(jitter / dt);
+
+			} else {
+				_jitter_sum_sq += jitter * jitter;
+				_jitter_max = math::max(_jitter_max, fabsf(jitter));
+				_jitter_count++;
+			}
+		}
+
+		_timestamp_sample_last = timestamp_sample;
+
+		if (timestamp >= _last_publish + PUBLISH_INTERVAL_US) {
+			sensor_timing_s sensor_timing{};
+			sensor_timing.device_id = device_id;
+			sensor_timing.dt = dt;
+			sensor_timing.publications = _publications;
+			sensor_timing.samples_min = _samples_min;
+			sensor_timing.samples_max = _samples_max;
+			sensor_timing.samples_mean = (float)_samples_sum / _publications;
+			sensor_timing.latency_mean = (float)_latency_sum / _publications;
+			sensor_timing.latency_max = _latency_max;
+			sensor_timing.jitter_rms = (_jitter_count > 0) ? sqrtf(_jitter_sum_sq / _jitter_count) : 0.f;
+			sensor_timing.jitter_max = _jitter_max;
+			sensor_timing.samples_missed = _samples_missed;
+			sensor_timing.timestamp = hrt_absolute_time();
+			_sensor_timing_pub.publish(sensor_timing);
+
+			_last_publish = timestamp;
+			reset();
+		}
+	}
+
+private:
+	static constexpr hrt_abstime PUBLISH_INTERVAL_US{1'000'000};
+
+	void reset()
+	{
+		_publications = 0;
+		_samples_sum = 0;
+		_samples_min = UINT8_MAX;
+		_samples_max = 0;
+		_latency_sum = 0;
+		_latency_max = 0;
+		_jitter_sum_sq = 0.f;
+		_jitter_max = 0.f;
+		_jitter_count = 0;
+		_samples_missed = 0;
+	}
+
+	uORB::PublicationMulti<sensor_timing_s> _sensor_timing_pub;
+
+	hrt_abstime _last_publish{0};
+	hrt_abstime _timestamp_sample_last{0};
+
+	uint64_t _latency_sum{0};
+	uint32_t _latency_max{0};
+
+	uint32_t _samples_sum{0};
+	uint32_t _samples_missed{0};
+
+	float _jitter_sum_sq{0.f};
+	float _jitter_max{0.f};
+	uint32_t _jitter_count{0};
+
+	uint16_t _publications{0};
+	uint8_t _samples_min{UINT8_MAX};
+	uint8_t _samples_max{0};
+};
@@ -87,6 +87,34 @@ void MapProjection::project(double lat, double lon, float &x, float &y) const
 	y = static_cast<float>(k * cos_lat * sin(lon_rad - _ref_lon) * CONSTANTS_RADIUS_OF_EARTH);
 }
 
+void MapProjection::projectFast(double lat, double lon, float &x, float &y) const
+{
+	const double d_lat = math::radians(lat) - _ref_lat;
+	const double d_lon = math::radians(lon) - _ref_lon;
+
+	if ((fabs(d_lat) > FAST_PROJECTION_MAX_ANGLE) || (fabs(d_lon) > FAST_PROJECTION_MAX_ANGLE)) {
+		project(lat, lon, x, y);
+		return;
+	}
+
+	// azimuthal equidistant projection expanded to second order in d_lat and d_lon,
+	// the (large) reference coordinates are removed in double precision before
+	const float d_lat_f = static_cast<float>(d_lat);
+	const float d_lon_f = static_cast<float>(d_lon);
+	const float sin_lat = static_cast<float>(_ref_sin_lat);
+	const float cos_lat = static_cast<float>(_ref_cos_lat);
+
+	x = (d_lat_f + 0.5f * sin_lat * cos_lat * d_lon_f * d_lon_f) * CONSTANTS_RADIUS_OF_EARTH_F;
+	y = d_lon_f * (cos_lat - sin_lat * d_lat_f) * CONSTANTS_RADIUS_OF_EARTH_F;
+}
+
+void MapProjection::project(const double lat[], const double lon[], matrix::Vector2f local[], size_t count) const
+{
+	for (size_t i = 0; i < count; i++) {
+		projectFast(lat[i], lon[i], local[i](0), local[i](1));
+	}
+}
+
 void MapProjection::reproject(float x, float y, double &lat, double &lon) const
 {
 	const double x_rad = (double)x / CONSTANTS_RADIUS_OF_EARTH;
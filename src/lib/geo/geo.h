@@ -158,6 +158,8 @@ private:
 	double _ref_cos_lat{0.0};
 	bool _ref_init_done{false};
 
+	static constexpr double FAST_PROJECTION_MAX_ANGLE = 1e-3; ///< [rad] latitude and longitude range of projectFast()
+
 public:
 	/**
 	 * @brief Construct a new Map Projection object
@@ -214,6 +216,26 @@ public:
 	 */
 	void project(double lat, double lon, float &x, float &y) const;
 
+	/**
+	 * Same as project(), but points close to the reference (within FAST_PROJECTION_MAX_ANGLE in latitude and
+	 * longitude, about 6 km) use a second order expansion around the reference in single precision,
+	 * which needs no trigonometric functions per point. The difference to project() is below 5 mm there.
+	 * Points further away fall back to project().
+	 * @param lat in degrees (47.1234567°, not 471234567°)
+	 * @param lon in degrees (8.1234567°, not 81234567°)
+	 * @param x north
+	 * @param y east
+	 */
+	void projectFast(double lat, double lon, float &x, float &y) const;
+
+	/**
+	 * Transform an array of points with projectFast()
+	 * @param lat in degrees, count elements
+	 * @param lon in degrees, count elements
+	 * @param local output, north / east of each point
+	 */
+	void project(const double lat[], const double lon[], matrix::Vector2f local[], size_t count) const;
+
 	/**
 	 * Transform a point in the geographic coordinate system to the local
 	 * azimuthal equidistant plane using the projection
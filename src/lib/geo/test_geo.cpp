@@ -92,6 +92,52 @@ TEST_F(GeoTest, projectReproject)
 	EXPECT_FLOAT_EQ(lon, lon_new);
 }
 
+TEST_F(GeoTest, projectFast)
+{
+	// GIVEN: points within and beyond the range of the fast projection, also at high latitude
+	for (double ref_lat : {47.3566094, -75.1, 89.}) {
+		const MapProjection ref(ref_lat, 8.5190237);
+
+		for (float distance : {0.f, 10.f, 1000.f, 6000.f, 20000.f}) {
+			for (float bearing = -M_PI_F; bearing < M_PI_F; bearing += 0.3f) {
+				double lat;
+				double lon;
+				ref.reproject(distance * cosf(bearing), distance * sinf(bearing), lat, lon);
+
+				// WHEN: projecting with both implementations
+				float x;
+				float y;
+				ref.project(lat, lon, x, y);
+				float x_fast;
+				float y_fast;
+				ref.projectFast(lat, lon, x_fast, y_fast);
+
+				// THEN: the difference is below 5 mm
+				EXPECT_NEAR(x, x_fast, 0.005f);
+				EXPECT_NEAR(y, y_fast, 0.005f);
+			}
+		}
+	}
+}
+
+TEST_F(GeoTest, projectBatch)
+{
+	// GIVEN: a few points around the reference
+	const double lat[3] = {47.3566094, 47.36, 47.5};
+	const double lon[3] = {8.5190237, 8.52, 8.3};
+	matrix::Vector2f local[3];
+
+	// WHEN: projecting all of them at once
+	proj.project(lat, lon, local, 3);
+
+	// THEN: each point matches the single point projection
+	for (int i = 0; i < 3; i++) {
+		const matrix::Vector2f expected = proj.project(lat[i], lon[i]);
+		EXPECT_NEAR(local[i](0), expected(0), 0.005f);
+		EXPECT_NEAR(local[i](1), expected(1), 0.005f);
+	}
+}
+
 TEST_F(GeoTest, waypoint_from_heading_and_zero_distance)
 {
 	// GIVEN: a starting waypoint, a heading and a distance of 0
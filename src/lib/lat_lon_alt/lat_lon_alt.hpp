@@ -106,13 +106,13 @@ public:
 		static constexpr double gravity_equator = 9.7803253359;
 	};
 
+	static void computeRadiiOfCurvature(const double latitude, double &meridian_radius_of_curvature,
+					    double &transverse_radius_of_curvature);
+
 private:
 	// Convert between curvilinear and cartesian errors
 	static matrix::Vector2d deltaLatLonToDeltaXY(const double latitude, const float altitude);
 
-	static void computeRadiiOfCurvature(const double latitude, double &meridian_radius_of_curvature,
-					    double &transverse_radius_of_curvature);
-
 	double _latitude_rad{0.0};
 	double _longitude_rad{0.0};
 	float _altitude{0.0};
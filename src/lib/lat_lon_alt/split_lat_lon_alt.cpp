@@ -0,0 +1,126 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include "split_lat_lon_alt.hpp"
+
+using matrix::Vector2f;
+using matrix::Vector3f;
+
+LatLonAlt SplitLatLonAlt::toLatLonAlt() const
+{
+	LatLonAlt lla = _origin + Vector3f(_offset(0), _offset(1), 0.f);
+	lla.setAltitude(_altitude);
+	return lla;
+}
+
+void SplitLatLonAlt::setOrigin(const LatLonAlt &lla)
+{
+	_origin = lla;
+	_offset.setZero();
+	_offset_rounding_error.setZero();
+
+	double meridian_radius_of_curvature;
+	double transverse_radius_of_curvature;
+	LatLonAlt::computeRadiiOfCurvature(_origin.latitude_rad(), meridian_radius_of_curvature, transverse_radius_of_curvature);
+
+	_origin_latitude_rad = static_cast<float>(_origin.latitude_rad());
+	_tan_latitude = static_cast<float>(tan(_origin.latitude_rad()));
+	_meridian_radius_of_curvature = static_cast<float>(meridian_radius_of_curvature);
+	_transverse_radius_of_curvature = static_cast<float>(transverse_radius_of_curvature);
+}
+
+void SplitLatLonAlt::setLatLon(const SplitLatLonAlt &lla)
+{
+	const float altitude = _altitude;
+	*this = lla;
+	_altitude = altitude;
+}
+
+SplitLatLonAlt SplitLatLonAlt::operator+(const Vector3f &delta_pos) const
+{
+	SplitLatLonAlt lla_new{*this};
+	lla_new += delta_pos;
+	return lla_new;
+}
+
+void SplitLatLonAlt::operator+=(const Vector3f &delta_pos)
+{
+	addToOffset(delta_pos.xy());
+	_altitude -= delta_pos(2);
+}
+
+void SplitLatLonAlt::operator+=(const Vector2f &delta_pos)
+{
+	addToOffset(delta_pos);
+}
+
+void SplitLatLonAlt::addToOffset(const Vector2f &delta_pos)
+{
+	// compensated summation: small increments would otherwise be rounded to the resolution of the offset
+	const Vector2f delta_pos_compensated = delta_pos - _offset_rounding_error;
+	const Vector2f offset_new = _offset + delta_pos_compensated;
+	_offset_rounding_error = (offset_new - _offset) - delta_pos_compensated;
+	_offset = offset_new;
+
+	if ((fabsf(_offset(0)) > kMaxOffset) || (fabsf(_offset(1)) > kMaxOffset)) {
+		setOrigin(toLatLonAlt());
+	}
+}
+
+Vector3f SplitLatLonAlt::operator-(const SplitLatLonAlt &lla) const
+{
+	if ((_origin.latitude_rad() == lla._origin.latitude_rad()) && (_origin.longitude_rad() == lla._origin.longitude_rad())) {
+		const Vector2f delta_offset = _offset - lla._offset;
+		return Vector3f(delta_offset(0), delta_offset(1), -(_altitude - lla._altitude));
+	}
+
+	return toLatLonAlt() - lla.toLatLonAlt();
+}
+
+Vector3f SplitLatLonAlt::operator-(const LatLonAlt &lla) const
+{
+	Vector3f delta_pos = _origin - lla;
+	delta_pos(0) += _offset(0);
+	delta_pos(1) += _offset(1);
+	delta_pos(2) = -(_altitude - lla.altitude());
+	return delta_pos;
+}
+
+Vector3f SplitLatLonAlt::computeAngularRateNavFrame(const Vector3f &v_ned) const
+{
+	return Vector3f(
+		       v_ned(1) / (_transverse_radius_of_curvature + _altitude),
+		       -v_ned(0) / (_meridian_radius_of_curvature + _altitude),
+		       -v_ned(1) * _tan_latitude / (_transverse_radius_of_curvature + _altitude));
+}
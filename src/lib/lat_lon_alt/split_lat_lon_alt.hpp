@@ -0,0 +1,121 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#pragma once
+
+#include "lat_lon_alt.hpp"
+
+/**
+ * Global position stored as a double precision origin plus a single precision
+ * north/east offset (m) from it.
+ *
+ * Incrementing the position, differencing two positions sharing the same origin and
+ * computing the transport rate only use single precision arithmetic. Double precision
+ * is only used when the origin is moved, once the offset exceeds kMaxOffset, and when
+ * converting to or from a LatLonAlt.
+ */
+class SplitLatLonAlt
+{
+public:
+	SplitLatLonAlt() { reset(LatLonAlt(0.0, 0.0, 0.f)); }
+
+	SplitLatLonAlt(const double latitude_deg, const double longitude_deg, const float altitude_m)
+	{
+		reset(LatLonAlt(latitude_deg, longitude_deg, altitude_m));
+	}
+
+	explicit SplitLatLonAlt(const LatLonAlt &lla) { reset(lla); }
+
+	LatLonAlt toLatLonAlt() const;
+
+	void setZero() { reset(LatLonAlt(0.0, 0.0, 0.f)); }
+
+	double latitude_deg() const { return toLatLonAlt().latitude_deg(); }
+	double longitude_deg() const { return toLatLonAlt().longitude_deg(); }
+
+	double latitude_rad() const { return toLatLonAlt().latitude_rad(); }
+	double longitude_rad() const { return toLatLonAlt().longitude_rad(); }
+	float altitude() const { return _altitude; }
+
+	// latitude of the origin in single precision, within kMaxOffset of the position (rad)
+	float origin_latitude_rad() const { return _origin_latitude_rad; }
+
+	void setAltitude(const float altitude) { _altitude = altitude; }
+
+	void setLatLon(const LatLonAlt &lla) { setOrigin(lla); }
+	void setLatLon(const SplitLatLonAlt &lla);
+	void setLatLonDeg(const double latitude, const double longitude) { setOrigin(LatLonAlt(latitude, longitude, _altitude)); }
+
+	/*
+	 * The plus and minus operators below use approximations and should only be used when the Cartesian component is small
+	 */
+	SplitLatLonAlt operator+(const matrix::Vector3f &delta_pos) const;
+	void operator+=(const matrix::Vector3f &delta_pos);
+	void operator+=(const matrix::Vector2f &delta_pos);
+	matrix::Vector3f operator-(const SplitLatLonAlt &lla) const;
+	matrix::Vector3f operator-(const LatLonAlt &lla) const;
+
+	/*
+	 * Compute the angular rate of the local navigation frame at the current latitude and height
+	 * with respect to an inertial frame and resolved in the navigation frame
+	 */
+	matrix::Vector3f computeAngularRateNavFrame(const matrix::Vector3f &v_ned) const;
+
+	// the offset is kept small enough for its resolution to stay in the micrometer range
+	static constexpr float kMaxOffset = 10.f;
+
+private:
+	void reset(const LatLonAlt &lla)
+	{
+		_altitude = lla.altitude();
+		setOrigin(lla);
+	}
+
+	// move the origin to the given position (altitude is not changed) and reset the offset
+	void setOrigin(const LatLonAlt &lla);
+
+	// add to the offset and move the origin to the current position if the offset gets too large
+	void addToOffset(const matrix::Vector2f &delta_pos);
+
+	LatLonAlt _origin{};
+	matrix::Vector2f _offset{}; ///< north/east position relative to the origin (m)
+	matrix::Vector2f _offset_rounding_error{}; ///< rounding error of the last offset increment (m)
+	float _altitude{0.f};
+
+	// evaluated at the origin
+	float _origin_latitude_rad{0.f};
+	float _tan_latitude{0.f};
+	float _meridian_radius_of_curvature{0.f};
+	float _transverse_radius_of_curvature{0.f};
+};
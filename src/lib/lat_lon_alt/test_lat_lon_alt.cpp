@@ -36,6 +36,7 @@
 #include <lib/geo/geo.h>
 
 #include "lat_lon_alt.hpp"
+#include "split_lat_lon_alt.hpp"
 
 using namespace matrix;
 using math::radians;
@@ -119,3 +120,71 @@ TEST(TestLatLonAlt, fromAndToECEF)
 		}
 	}
 }
+
+TEST(TestSplitLatLonAlt, init)
+{
+	SplitLatLonAlt lla(5.7, -2.3, 420);
+	ASSERT_FLOAT_EQ(lla.latitude_deg(), 5.7);
+	ASSERT_FLOAT_EQ(lla.longitude_deg(), -2.3);
+	ASSERT_EQ(lla.altitude(), 420);
+}
+
+TEST(TestSplitLatLonAlt, integrateDeltaPos)
+{
+	// the split representation follows the double precision one, including across origin changes
+	LatLonAlt lla(47.3977, 8.5456, 400.f);
+	SplitLatLonAlt lla_split(lla);
+
+	const Vector3f delta_pos(0.011f, -0.0043f, 0.0007f);
+
+	for (int i = 0; i < 20000; i++) {
+		lla += delta_pos;
+		lla_split += delta_pos;
+	}
+
+	const Vector3f error = lla_split.toLatLonAlt() - lla;
+	EXPECT_LT(error.xy().norm(), 1e-4f);
+	EXPECT_NEAR(lla_split.altitude(), lla.altitude(), 1e-3f);
+}
+
+TEST(TestSplitLatLonAlt, subSplitLatLonAlt)
+{
+	SplitLatLonAlt lla(60.0, 5.0, 10.f);
+	SplitLatLonAlt lla_moved(lla);
+
+	const Vector3f delta_pos(3.f, -4.f, 1.f);
+	lla_moved += delta_pos;
+
+	// same origin
+	Vector3f delta = lla_moved - lla;
+	EXPECT_FLOAT_EQ(delta(0), delta_pos(0));
+	EXPECT_FLOAT_EQ(delta(1), delta_pos(1));
+	EXPECT_FLOAT_EQ(delta(2), delta_pos(2));
+
+	// different origins
+	lla_moved += Vector3f(2.f * SplitLatLonAlt::kMaxOffset, 0.f, 0.f);
+	delta = lla_moved - lla;
+	EXPECT_NEAR(delta(0), delta_pos(0) + 2.f * SplitLatLonAlt::kMaxOffset, 1e-3f);
+	EXPECT_NEAR(delta(1), delta_pos(1), 1e-3f);
+	EXPECT_FLOAT_EQ(delta(2), delta_pos(2));
+
+	// double precision position
+	delta = lla_moved - lla.toLatLonAlt();
+	EXPECT_NEAR(delta(0), delta_pos(0) + 2.f * SplitLatLonAlt::kMaxOffset, 1e-3f);
+	EXPECT_NEAR(delta(1), delta_pos(1), 1e-3f);
+	EXPECT_FLOAT_EQ(delta(2), delta_pos(2));
+}
+
+TEST(TestSplitLatLonAlt, angularRateNavFrame)
+{
+	const LatLonAlt lla(-33.9, 151.2, 120.f);
+	const SplitLatLonAlt lla_split(lla);
+	const Vector3f v_ned(12.f, -7.f, 1.f);
+
+	const Vector3f rate = lla.computeAngularRateNavFrame(v_ned);
+	const Vector3f rate_split = lla_split.computeAngularRateNavFrame(v_ned);
+
+	for (int i = 0; i < 3; i++) {
+		EXPECT_NEAR(rate_split(i), rate(i), 1e-12f);
+	}
+}
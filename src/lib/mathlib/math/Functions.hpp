@@ -41,6 +41,9 @@
 
 #include "Limits.hpp"
 
+#include <float.h>
+#include <string.h>
+
 #include <px4_platform_common/defines.h>
 #include <matrix/matrix/math.hpp>
 
@@ -49,7 +52,7 @@ namespace math
 
 // Type-safe signum function with zero treated as positive
 template<typename T>
-int signNoZero(T val)
+constexpr int signNoZero(T val)
 {
 	return (T(0) <= val) - (val < T(0));
 }
@@ -60,13 +63,13 @@ int signNoZero(T val)
  * @param[in] positive Truth value to take the sign from
  * @return 1 if positive is true, -1 if positive is false
  */
-inline int signFromBool(bool positive)
+constexpr int signFromBool(bool positive)
 {
 	return positive ? 1 : -1;
 }
 
 template<typename T>
-T sq(T val)
+constexpr T sq(T val)
 {
 	return val * val;
 }
@@ -242,7 +245,7 @@ const T sqrt_linear(const T &value)
  * Any value for s is valid.
  */
 template<typename T>
-const T lerp(const T &a, const T &b, const T &s)
+constexpr T lerp(const T &a, const T &b, const T &s)
 {
 	return (static_cast<T>(1) - s) * a + s * b;
 }
@@ -273,7 +276,7 @@ constexpr int16_t negate<int16_t>(int16_t value)
  */
 
 template<typename T>
-int countSetBits(T n)
+constexpr int countSetBits(T n)
 {
 	int count = 0;
 
@@ -285,6 +288,144 @@ int countSetBits(T n)
 	return count;
 }
 
+/**
+ * Sine of an angle in degrees that can be evaluated at compile time (Taylor series in double precision),
+ * e.g. for constant rotation tables. At runtime std::sin() is faster.
+ */
+constexpr double sinDegConstexpr(double degrees)
+{
+	// reduce to [-90, 90] degrees, where the series converges quickly
+	while (degrees > 180.) {
+		degrees -= 360.;
+	}
+
+	while (degrees < -180.) {
+		degrees += 360.;
+	}
+
+	if (degrees > 90.) {
+		degrees = 180. - degrees;
+
+	} else if (degrees < -90.) {
+		degrees = -180. - degrees;
+	}
+
+	const double x = degrees * M_PI / 180.;
+	double term = x;
+	double sum = x;
+
+	for (int k = 1; k < 12; k++) {
+		term *= -x * x / ((2 * k) * (2 * k + 1));
+		sum += term;
+	}
+
+	return sum;
+}
+
+constexpr double cosDegConstexpr(double degrees)
+{
+	return sinDegConstexpr(degrees + 90.);
+}
+
+/**
+ * Polynomial approximations of the trigonometric and exponential functions for paths where a bounded error is
+ * acceptable in exchange for speed (newlib's implementations are slow on Cortex-M). Callers opt in explicitly.
+ * The maximum errors are checked by FunctionsTest. sqrtf() is a single FPU instruction and has no approximation here.
+ */
+namespace fast
+{
+
+// argument reduction to [-pi, pi], with 2 pi split in two parts so k * part is exact
+inline float reduceAngle(float x)
+{
+	const float k = static_cast<float>(static_cast<int>(x * (0.5f / M_PI_F) + (x >= 0.f ? 0.5f : -0.5f)));
+	return (x - k * 6.28125f) - k * 1.93530717e-3f;
+}
+
+// max absolute error 5e-7 for |x| <= 1000, falls back to std::sin() outside
+inline float sin(float x)
+{
+	if (!(fabsf(x) <= 1000.f)) {
+		return std::sin(x);
+	}
+
+	x = reduceAngle(x);
+
+	// reduce to [-pi/2, pi/2]
+	if (x > M_PI_2_F) {
+		x = M_PI_F - x;
+
+	} else if (x < -M_PI_2_F) {
+		x = -M_PI_F - x;
+	}
+
+	// Taylor series up to x^11
+	const float x2 = x * x;
+	return x * (1.f + x2 * (-1.f / 6.f + x2 * (1.f / 120.f + x2 * (-1.f / 5040.f + x2 * (1.f / 362880.f
+						      + x2 * (-1.f / 39916800.f))))));
+}
+
+// max absolute error 5e-7 for |x| <= 1000, falls back to std::cos() outside
+inline float cos(float x)
+{
+	if (!(fabsf(x) <= 1000.f)) {
+		return std::cos(x);
+	}
+
+	return sin(reduceAngle(x) + M_PI_2_F);
+}
+
+// max absolute error 3e-6 rad, returns 0 for x = y = 0
+inline float atan2(float y, float x)
+{
+	const float abs_x = fabsf(x);
+	const float abs_y = fabsf(y);
+	const float max = (abs_x > abs_y) ? abs_x : abs_y;
+
+	if (max < FLT_MIN) {
+		return 0.f;
+	}
+
+	// minimax polynomial of atan(z) for z in [0, 1]
+	const float z = ((abs_x > abs_y) ? abs_y : abs_x) / max;
+	const float z2 = z * z;
+	float res = z * (0.99997726f + z2 * (-0.33262347f + z2 * (0.19354346f + z2 * (-0.11643287f + z2 * (0.05265332f
+								  + z2 * -0.01172120f)))));
+
+	if (abs_y > abs_x) {
+		res = M_PI_2_F - res;
+	}
+
+	if (x < 0.f) {
+		res = M_PI_F - res;
+	}
+
+	return (y < 0.f) ? -res : res;
+}
+
+// max relative error 5e-7 for |x| <= 87, falls back to std::exp() outside
+inline float exp(float x)
+{
+	if (!(fabsf(x) <= 87.f)) {
+		return std::exp(x);
+	}
+
+	// exp(x) = 2^k * exp(r), with ln(2) split in two parts so k * part is exact
+	const int k = static_cast<int>(x * 1.44269504f + (x >= 0.f ? 0.5f : -0.5f));
+	const float r = (x - k * 0.693145752f) - k * 1.42860677e-6f;
+	const float exp_r = 1.f + r * (1.f + r * (0.5f + r * (1.f / 6.f + r * (1.f / 24.f + r * (1.f / 120.f + r *
+					   (1.f / 720.f))))));
+
+	// 2^k built directly from the exponent bits
+	const uint32_t bits = static_cast<uint32_t>(k + 127) << 23;
+	float scale;
+	memcpy(&scale, &bits, sizeof(scale));
+
+	return exp_r * scale;
+}
+
+} // namespace fast
+
 inline bool isFinite(const float &value)
 {
 	return PX4_ISFINITE(value);
@@ -238,3 +238,69 @@ TEST(FunctionsTest, isFiniteVector3f)
 	EXPECT_FALSE(isFinite(matrix::Vector3f(NAN, NAN, 0.f)));
 	EXPECT_FALSE(isFinite(matrix::Vector3f(NAN, NAN, NAN)));
 }
+
+TEST(FunctionsTest, sinCosDegConstexpr)
+{
+	static_assert(sinDegConstexpr(0.) > -1e-15 && sinDegConstexpr(0.) < 1e-15, "compile time evaluation");
+
+	for (int deg = -720; deg <= 720; deg++) {
+		const double rad = deg * M_PI / 180.;
+		EXPECT_NEAR(sinDegConstexpr(deg), sin(rad), 1e-14);
+		EXPECT_NEAR(cosDegConstexpr(deg), cos(rad), 1e-14);
+	}
+
+	EXPECT_FLOAT_EQ(static_cast<float>(sinDegConstexpr(90.)), 1.f);
+	EXPECT_FLOAT_EQ(static_cast<float>(cosDegConstexpr(180.)), -1.f);
+}
+
+TEST(FunctionsTest, fastSinCos)
+{
+	float max_error_sin = 0.f;
+	float max_error_cos = 0.f;
+
+	for (float x = -1000.f; x <= 1000.f; x += 0.0123f) {
+		max_error_sin = fmaxf(max_error_sin, fabsf(fast::sin(x) - sinf(x)));
+		max_error_cos = fmaxf(max_error_cos, fabsf(fast::cos(x) - cosf(x)));
+	}
+
+	EXPECT_LT(max_error_sin, 5e-7f);
+	EXPECT_LT(max_error_cos, 5e-7f);
+
+	// outside of the approximated range
+	EXPECT_FLOAT_EQ(fast::sin(1e5f), sinf(1e5f));
+	EXPECT_TRUE(std::isnan(fast::cos(NAN)));
+}
+
+TEST(FunctionsTest, fastAtan2)
+{
+	float max_error = 0.f;
+
+	for (float angle = -M_PI_F; angle <= M_PI_F; angle += 1e-4f) {
+		for (float radius : {1e-3f, 1.f, 1e3f}) {
+			const float y = radius * sinf(angle);
+			const float x = radius * cosf(angle);
+			max_error = fmaxf(max_error, fabsf(fast::atan2(y, x) - atan2f(y, x)));
+		}
+	}
+
+	EXPECT_LT(max_error, 3e-6f);
+	EXPECT_FLOAT_EQ(fast::atan2(0.f, 0.f), 0.f);
+	EXPECT_FLOAT_EQ(fast::atan2(0.f, -1.f), M_PI_F);
+	EXPECT_FLOAT_EQ(fast::atan2(-1.f, 0.f), -M_PI_2_F);
+}
+
+TEST(FunctionsTest, fastExp)
+{
+	float max_relative_error = 0.f;
+
+	for (float x = -87.f; x <= 87.f; x += 0.0071f) {
+		max_relative_error = fmaxf(max_relative_error, fabsf(fast::exp(x) - expf(x)) / expf(x));
+	}
+
+	EXPECT_LT(max_relative_error, 5e-7f);
+	EXPECT_FLOAT_EQ(fast::exp(0.f), 1.f);
+
+	// outside of the approximated range
+	EXPECT_FLOAT_EQ(fast::exp(-100.f), expf(-100.f));
+	EXPECT_TRUE(std::isinf(fast::exp(INFINITY)));
+}
@@ -127,6 +127,149 @@ public:
 		return valid();
 	}
 
+	/**
+	 * Add a block of samples (e.g. the arrays of a sensor FIFO message) at once, computing the mean
+	 * and M2 of the block in two passes and combining them with Chan's parallel algorithm.
+	 * Only one division per block is needed instead of one per sample.
+	 *
+	 * @param samples per axis array of count samples, e.g. {fifo.x, fifo.y, fifo.z}
+	 * @param count number of samples per axis
+	 * @param scale sample scale factor
+	 * @param offset subtracted from all (scaled) samples
+	 */
+	template<typename T>
+	bool update(const T *const samples[N], size_t count, Type scale = Type(1),
+		    const matrix::Vector<Type, N> &offset = matrix::Vector<Type, N> {})
+	{
+		if (count == 0 || count > UINT16_MAX) {
+			return valid();
+		}
+
+		matrix::Vector<Type, N> mean_block{};
+
+		for (size_t r = 0; r < N; r++) {
+			Type sum = 0;
+
+			for (size_t i = 0; i < count; i++) {
+				sum += samples[r][i];
+			}
+
+			mean_block(r) = sum * scale / count;
+		}
+
+		matrix::SquareMatrix<Type, N> M2_block{};
+
+		for (size_t i = 0; i < count; i++) {
+			matrix::Vector<Type, N> delta;
+
+			for (size_t r = 0; r < N; r++) {
+				delta(r) = samples[r][i] * scale - mean_block(r);
+			}
+
+			for (size_t r = 0; r < N; r++) {
+				for (size_t c = r; c < N; c++) {
+					M2_block(r, c) += delta(r) * delta(c);
+				}
+			}
+		}
+
+		for (size_t r = 0; r < N; r++) {
+			for (size_t c = r + 1; c < N; c++) {
+				M2_block(c, r) = M2_block(r, c);
+			}
+		}
+
+		return combine(count, mean_block - offset, M2_block);
+	}
+
+	/**
+	 * Combine with the statistics of a separate set of samples (Chan's parallel algorithm)
+	 *
+	 * @param count number of samples of the other set
+	 * @param mean mean of the other set
+	 * @param M2 sum of the squared differences from the mean of the other set
+	 */
+	bool combine(uint16_t count, const matrix::Vector<Type, N> &mean, const matrix::SquareMatrix<Type, N> &M2)
+	{
+		if (count == 0) {
+			return valid();
+		}
+
+		if (_count == 0) {
+			reset();
+			_count = count;
+			_mean = mean;
+			_M2 = M2;
+
+			if (!_mean.isAllFinite() || !_M2.isAllFinite()) {
+				reset();
+				return false;
+			}
+
+			return valid();
+		}
+
+		if (_count > UINT16_MAX - count) {
+			// count overflow
+			//  reset count, but maintain mean and variance
+			_M2 = _M2 / _count;
+			_M2_accum.zero();
+
+			_count = 1;
+		}
+
+		const Type count_a = _count;
+		const Type count_b = count;
+		const Type count_ab = count_a + count_b;
+		_count += count;
+
+		// mean (Kahan summation)
+		const matrix::Vector<Type, N> delta{mean - _mean};
+		{
+			const matrix::Vector<Type, N> y = (delta * (count_b / count_ab)) - _mean_accum;
+			const matrix::Vector<Type, N> t = _mean + y;
+			_mean_accum = (t - _mean) - y;
+			_mean = t;
+		}
+
+		if (!_mean.isAllFinite()) {
+			reset();
+			return false;
+		}
+
+		// covariance: M2 = M2_a + M2_b + delta * delta^T * count_a * count_b / count_ab (Kahan summation)
+		const Type weight = count_a * count_b / count_ab;
+
+		for (size_t r = 0; r < N; r++) {
+			for (size_t c = r; c < N; c++) {
+				const Type y = M2(r, c) + delta(r) * delta(c) * weight - _M2_accum(r, c);
+				const Type t = _M2(r, c) + y;
+				_M2_accum(r, c) = (t - _M2(r, c)) - y;
+
+				_M2(r, c) = t;
+			}
+
+			// protect against floating point precision causing negative variances
+			if (_M2(r, r) < 0) {
+				_M2(r, r) = 0;
+			}
+		}
+
+		// make symmetric
+		for (size_t r = 0; r < N; r++) {
+			for (size_t c = r + 1; c < N; c++) {
+				_M2(c, r) = _M2(r, c);
+			}
+		}
+
+		if (!_M2.isAllFinite()) {
+			reset();
+			return false;
+		}
+
+		return valid();
+	}
+
 	bool valid() const { return _count > 2; }
 	auto count() const { return _count; }
 
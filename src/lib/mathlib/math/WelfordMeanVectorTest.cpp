@@ -65,3 +65,54 @@ TEST(WelfordMeanVectorTest, NoisySignal)
 	EXPECT_NEAR(var(1), var_real, 0.1f);
 	EXPECT_NEAR(var(2), var_real, 0.1f);
 }
+
+TEST(WelfordMeanVectorTest, BlockUpdate)
+{
+	std::normal_distribution<float> standard_normal_distribution{0.f, 1.f};
+	std::default_random_engine random_generator{};
+	random_generator.seed(42);
+
+	WelfordMeanVector<float, 3> welford{};
+	WelfordMeanVector<float, 3> welford_block{};
+
+	const float scale = 0.01f;
+	const Vector3f offset{0.1f, -0.2f, 0.3f};
+
+	int16_t x[32];
+	int16_t y[32];
+	int16_t z[32];
+	const int16_t *const xyz[3] {x, y, z};
+
+	for (int block = 0; block < 100; block++) {
+		// varying FIFO lengths
+		const uint8_t samples = 1 + (block * 7) % 32;
+
+		for (int i = 0; i < samples; i++) {
+			x[i] = 500 + 100.f * standard_normal_distribution(random_generator);
+			y[i] = -300 + 50.f * standard_normal_distribution(random_generator);
+			z[i] = x[i] / 2 + 20.f * standard_normal_distribution(random_generator);
+
+			welford.update(Vector3f(x[i] * scale, y[i] * scale, z[i] * scale) - offset);
+		}
+
+		welford_block.update(xyz, samples, scale, offset);
+	}
+
+	EXPECT_TRUE(welford_block.valid());
+	EXPECT_EQ(welford_block.count(), welford.count());
+
+	// same result as one sample at a time
+	EXPECT_FALSE(Vector3f(welford_block.mean() - welford.mean()).longerThan(1e-5f));
+
+	const matrix::Matrix3f cov = welford.covariance();
+	const matrix::Matrix3f cov_block = welford_block.covariance();
+
+	for (int r = 0; r < 3; r++) {
+		for (int c = 0; c < 3; c++) {
+			EXPECT_NEAR(cov_block(r, c), cov(r, c), 1e-4f * fabsf(cov(0, 0)));
+		}
+	}
+
+	EXPECT_NEAR(welford_block.mean()(0), 5.f - 0.1f, 0.05f);
+	EXPECT_NEAR(welford_block.variance()(0), 1.f, 0.1f);
+}
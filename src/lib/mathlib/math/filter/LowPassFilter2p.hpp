@@ -40,6 +40,8 @@
 
 #include <mathlib/math/Functions.hpp>
 #include <float.h>
+#include <stdint.h>
+#include <type_traits>
 #include <matrix/math.hpp>
 
 namespace math
@@ -111,9 +113,14 @@ public:
 	// Filter array of samples in place using the Direct form II.
 	inline void applyArray(T samples[], int num_samples)
 	{
-		for (int n = 0; n < num_samples; n++) {
-			samples[n] = apply(samples[n]);
-		}
+		applyBlock(samples, 1.f, samples, num_samples);
+	}
+
+	// Filter a block of raw sensor samples (e.g. a sensor FIFO) converted with scale into output.
+	// The input and output must not overlap.
+	inline void applyArray(const int16_t *__restrict input, const float scale, T *__restrict output, int num_samples)
+	{
+		applyBlock(input, scale, output, num_samples);
 	}
 
 	// Return the cutoff frequency
@@ -161,6 +168,43 @@ public:
 	}
 
 protected:
+
+	// Block processing kernel (Direct form II), input can be the same as output (in place) if it's of type T
+	template<typename Input>
+	inline void applyBlock(const Input *input, const float scale, T *output, int num_samples)
+	{
+		// local copies of the coefficients and delay elements, output could alias the members
+		const float b0 = _b0;
+		const float b1 = _b1;
+		const float b2 = _b2;
+		const float a1 = _a1;
+		const float a2 = _a2;
+
+		T d1 = _delay_element_1;
+		T d2 = _delay_element_2;
+
+		for (int n = 0; n < num_samples; n++) {
+			T x0;
+
+			if constexpr (std::is_same<Input, T>::value) {
+				x0 = input[n];
+
+			} else {
+				x0 = scale * input[n];
+			}
+
+			const T d0{x0 - d1 * a1 - d2 * a2};
+
+			output[n] = d0 * b0 + d1 * b1 + d2 * b2;
+
+			d2 = d1;
+			d1 = d0;
+		}
+
+		_delay_element_1 = d1;
+		_delay_element_2 = d2;
+	}
+
 	T _delay_element_1{}; // buffered sample -1
 	T _delay_element_2{}; // buffered sample -2
 
@@ -45,6 +45,8 @@
 #include <mathlib/math/Functions.hpp>
 #include <cmath>
 #include <float.h>
+#include <stdint.h>
+#include <type_traits>
 #include <matrix/math.hpp>
 
 namespace math
@@ -82,9 +84,21 @@ public:
 			_initialized = true;
 		}
 
-		for (int n = 0; n < num_samples; n++) {
-			samples[n] = applyInternal(samples[n]);
+		applyBlock(samples, 1.f, samples, num_samples);
+	}
+
+	/**
+	 * Filter a block of raw sensor samples (e.g. a sensor FIFO) converted with scale into output
+	 * using the direct form I. The input and output must not overlap.
+	 */
+	inline void applyArray(const int16_t *__restrict input, const float scale, T *__restrict output, int num_samples)
+	{
+		if (!_initialized) {
+			reset(scale * input[0]);
+			_initialized = true;
 		}
+
+		applyBlock(input, scale, output, num_samples);
 	}
 
 	float getNotchFreq() const { return _notch_freq; }
@@ -165,6 +179,49 @@ public:
 
 protected:
 
+	// Block processing kernel, input can be the same as output (in place) if it's of type T
+	template<typename Input>
+	inline void applyBlock(const Input *input, const float scale, T *output, int num_samples)
+	{
+		// work on local copies of the coefficients and delay elements, writing to output could
+		// otherwise alias the members and force a reload and store of all of them for every sample
+		const float b0 = _b0;
+		const float b1 = _b1;
+		const float b2 = _b2;
+		const float a1 = _a1;
+		const float a2 = _a2;
+
+		T x1 = _delay_element_1;
+		T x2 = _delay_element_2;
+		T y1 = _delay_element_output_1;
+		T y2 = _delay_element_output_2;
+
+		for (int n = 0; n < num_samples; n++) {
+			T x0;
+
+			if constexpr (std::is_same<Input, T>::value) {
+				x0 = input[n];
+
+			} else {
+				x0 = scale * input[n];
+			}
+
+			const T y0 = b0 * x0 + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+
+			x2 = x1;
+			x1 = x0;
+			y2 = y1;
+			y1 = y0;
+
+			output[n] = y0;
+		}
+
+		_delay_element_1 = x1;
+		_delay_element_2 = x2;
+		_delay_element_output_1 = y1;
+		_delay_element_output_2 = y2;
+	}
+
 	/**
 	 * Add a new raw value to the filter using the Direct Form I
 	 *
@@ -241,7 +298,8 @@ bool NotchFilter<T>::setParameters(float sample_freq, float notch_freq, float ba
 			// only notch frequency has changed
 			_notch_freq = notch_freq_new;
 
-			const float beta = -cosf(2.f * M_PI_F * _notch_freq / _sample_freq);
+			// called per sample when tracking e.g. ESC RPM harmonics, math::fast::cos() is accurate enough here
+			const float beta = -fast::cos(2.f * M_PI_F * _notch_freq / _sample_freq);
 
 			_b1 = 2.f * beta * _b0;
 			_a1 = _b1;
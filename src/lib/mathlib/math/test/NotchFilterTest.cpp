@@ -347,3 +347,65 @@ TEST_F(NotchFilterTest, setCoefficients)
 		EXPECT_EQ(b[i], b_new[i]);
 	}
 }
+
+TEST_F(NotchFilterTest, applyArray)
+{
+	// GIVEN: two identical filters
+	NotchFilter<float> notch_array;
+	_notch_float.setParameters(_sample_freq, _notch_freq, _bandwidth);
+	notch_array.setParameters(_sample_freq, _notch_freq, _bandwidth);
+
+	const float signal_freq = 10.f;
+	const float omega = 2.f * M_PI_F * signal_freq;
+	const float dt = 1.f / _sample_freq;
+
+	// WHEN: blocks of samples are filtered in place by one and sample by sample by the other
+	for (int block = 0; block < 20; block++) {
+		float samples[8];
+
+		for (int n = 0; n < 8; n++) {
+			samples[n] = sinf(omega * (block * 8 + n) * dt) + 0.5f;
+		}
+
+		float expected[8];
+
+		for (int n = 0; n < 8; n++) {
+			expected[n] = _notch_float.apply(samples[n]);
+		}
+
+		notch_array.applyArray(samples, 8);
+
+		// THEN: the outputs are identical
+		for (int n = 0; n < 8; n++) {
+			EXPECT_EQ(samples[n], expected[n]);
+		}
+	}
+}
+
+TEST_F(NotchFilterTest, applyArrayRawSamples)
+{
+	// GIVEN: two identical filters
+	NotchFilter<float> notch_raw;
+	_notch_float.setParameters(_sample_freq, _notch_freq, _bandwidth);
+	notch_raw.setParameters(_sample_freq, _notch_freq, _bandwidth);
+
+	const float scale = 1e-3f;
+
+	// WHEN: a block of raw FIFO samples is filtered by one and the converted samples by the other
+	int16_t raw[32];
+	float samples[32];
+
+	for (int n = 0; n < 32; n++) {
+		raw[n] = static_cast<int16_t>(1000.f * sinf(2.f * M_PI_F * 50.f * n / _sample_freq) + 200);
+		samples[n] = scale * raw[n];
+	}
+
+	float output[32];
+	notch_raw.applyArray(raw, scale, output, 32);
+	_notch_float.applyArray(samples, 32);
+
+	// THEN: the outputs are identical
+	for (int n = 0; n < 32; n++) {
+		EXPECT_EQ(output[n], samples[n]);
+	}
+}
@@ -38,7 +38,7 @@ public:
 	 *
 	 * @param other vector to copy
 	 */
-	Euler(const Vector<Type, 3> &other) :
+	constexpr Euler(const Vector<Type, 3> &other) :
 		Vector<Type, 3>(other)
 	{
 	}
@@ -48,7 +48,7 @@ public:
 	 *
 	 * @param other Matrix31 to copy
 	 */
-	Euler(const Matrix<Type, 3, 1> &other) :
+	constexpr Euler(const Matrix<Type, 3, 1> &other) :
 		Vector<Type, 3>(other)
 	{
 	}
@@ -64,7 +64,7 @@ public:
 	 * @param theta_ rotation angle about Y axis
 	 * @param psi_ rotation angle about Z axis
 	 */
-	Euler(Type phi_, Type theta_, Type psi_) : Vector<Type, 3>()
+	constexpr Euler(Type phi_, Type theta_, Type psi_) : Vector<Type, 3>()
 	{
 		phi() = phi_;
 		theta() = theta_;
@@ -113,28 +113,28 @@ public:
 	{
 	}
 
-	inline Type phi() const
+	inline constexpr Type phi() const
 	{
 		return (*this)(0);
 	}
-	inline Type theta() const
+	inline constexpr Type theta() const
 	{
 		return (*this)(1);
 	}
-	inline Type psi() const
+	inline constexpr Type psi() const
 	{
 		return (*this)(2);
 	}
 
-	inline Type &phi()
+	inline constexpr Type &phi()
 	{
 		return (*this)(0);
 	}
-	inline Type &theta()
+	inline constexpr Type &theta()
 	{
 		return (*this)(1);
 	}
-	inline Type &psi()
+	inline constexpr Type &psi()
 	{
 		return (*this)(2);
 	}
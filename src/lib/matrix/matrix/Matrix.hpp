@@ -11,6 +11,7 @@
 #include <cmath>
 #include <cstdio>
 #include <cstring>
+#include <utility>
 
 #include "helper_functions.hpp"
 #include "Slice.hpp"
@@ -28,7 +29,7 @@ public:
 	// Constructors
 	Matrix() = default;
 
-	explicit Matrix(const Type data_[M * N])
+	explicit constexpr Matrix(const Type data_[M * N])
 	{
 		for (size_t i = 0; i < M; i++) {
 			for (size_t j = 0; j < N; j++) {
@@ -37,7 +38,7 @@ public:
 		}
 	}
 
-	explicit Matrix(const Type data_[M][N])
+	explicit constexpr Matrix(const Type data_[M][N])
 	{
 		for (size_t i = 0; i < M; i++) {
 			for (size_t j = 0; j < N; j++) {
@@ -46,7 +47,7 @@ public:
 		}
 	}
 
-	Matrix(const Matrix &other)
+	constexpr Matrix(const Matrix &other)
 	{
 		for (size_t i = 0; i < M; i++) {
 			for (size_t j = 0; j < N; j++) {
@@ -56,7 +57,7 @@ public:
 	}
 
 	template<typename S>
-	Matrix(const Matrix<S, M, N> &aa)
+	constexpr Matrix(const Matrix<S, M, N> &aa)
 	{
 		for (size_t i = 0; i < M; i++) {
 			for (size_t j = 0; j < N; j++) {
@@ -94,7 +95,7 @@ public:
 	 */
 
 
-	inline const Type &operator()(size_t i, size_t j) const
+	inline constexpr const Type &operator()(size_t i, size_t j) const
 	{
 		assert(i < M);
 		assert(j < N);
@@ -102,7 +103,7 @@ public:
 		return _data[i][j];
 	}
 
-	inline Type &operator()(size_t i, size_t j)
+	inline constexpr Type &operator()(size_t i, size_t j)
 	{
 		assert(i < M);
 		assert(j < N);
@@ -110,7 +111,7 @@ public:
 		return _data[i][j];
 	}
 
-	Matrix<Type, M, N> &operator=(const Matrix<Type, M, N> &other)
+	constexpr Matrix<Type, M, N> &operator=(const Matrix<Type, M, N> &other)
 	{
 		if (this != &other) {
 			Matrix<Type, M, N> &self = *this;
@@ -157,6 +158,20 @@ public:
 	// compile time size_t checking
 	template<size_t P>
 	Matrix<Type, M, P> operator*(const Matrix<Type, N, P> &other) const
+	{
+		if constexpr (M <= 4 && N <= 4 && P <= 4) {
+			// small shapes (3x3, 4x4, 3x1, ...) are fully unrolled at compile time,
+			// -Os builds would otherwise keep the loops
+			return multiplyUnrolled(other, std::make_index_sequence<M * P> {});
+
+		} else {
+			return multiplyGeneric(other);
+		}
+	}
+
+	// generic implementation of operator*, also used as reference for the unrolled one
+	template<size_t P>
+	Matrix<Type, M, P> multiplyGeneric(const Matrix<Type, N, P> &other) const
 	{
 		const Matrix<Type, M, N> &self = *this;
 		Matrix<Type, M, P> res{};
@@ -172,9 +187,27 @@ public:
 		return res;
 	}
 
+	// A * B + C in a single pass, without the temporary of A * B
+	template<size_t P>
+	Matrix<Type, M, P> multiplyAdd(const Matrix<Type, N, P> &other, const Matrix<Type, M, P> &addend) const
+	{
+		const Matrix<Type, M, N> &self = *this;
+		Matrix<Type, M, P> res(addend);
+
+		for (size_t i = 0; i < M; i++) {
+			for (size_t k = 0; k < P; k++) {
+				for (size_t j = 0; j < N; j++) {
+					res(i, k) += self(i, j) * other(j, k);
+				}
+			}
+		}
+
+		return res;
+	}
+
 	// Using this function reduces the number of temporary variables needed to compute A * B.T
 	template<size_t P>
-	Matrix<Type, M, M> multiplyByTranspose(const Matrix<Type, P, N> &other) const
+	Matrix<Type, M, P> multiplyByTranspose(const Matrix<Type, P, N> &other) const
 	{
 		Matrix<Type, M, P> res;
 		const Matrix<Type, M, N> &self = *this;
@@ -679,6 +712,23 @@ public:
 
 		return true;
 	}
+
+private:
+
+	template<size_t P, size_t... IK>
+	Matrix<Type, M, P> multiplyUnrolled(const Matrix<Type, N, P> &other, std::index_sequence<IK...>) const
+	{
+		Matrix<Type, M, P> res;
+		((res(IK / P, IK % P) = dotUnrolled<IK / P, IK % P>(other, std::make_index_sequence<N> {})), ...);
+		return res;
+	}
+
+	// same summation order as multiplyGeneric(), so the results are identical
+	template<size_t I, size_t K, size_t P, size_t... J>
+	Type dotUnrolled(const Matrix<Type, N, P> &other, std::index_sequence<J...>) const
+	{
+		return (... + (_data[I][J] * other(J, K)));
+	}
 };
 
 template<typename Type, size_t M, size_t N>
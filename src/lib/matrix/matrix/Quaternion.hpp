@@ -60,7 +60,7 @@ public:
 	 *
 	 * @param data_ array
 	 */
-	explicit Quaternion(const Type data_[4]) :
+	explicit constexpr Quaternion(const Type data_[4]) :
 		Vector4<Type>(data_)
 	{
 	}
@@ -68,7 +68,7 @@ public:
 	/**
 	 * Standard constructor
 	 */
-	Quaternion()
+	constexpr Quaternion()
 	{
 		Quaternion &q = *this;
 		q(0) = 1;
@@ -82,7 +82,7 @@ public:
 	 *
 	 * @param other Matrix41 to copy
 	 */
-	Quaternion(const Matrix41 &other) :
+	constexpr Quaternion(const Matrix41 &other) :
 		Vector4<Type>(other)
 	{
 	}
@@ -249,7 +249,7 @@ public:
 	 * @param c set quaternion value 2
 	 * @param d set quaternion value 3
 	 */
-	Quaternion(Type a, Type b, Type c, Type d)
+	constexpr Quaternion(Type a, Type b, Type c, Type d)
 	{
 		Quaternion &q = *this;
 		q(0) = a;
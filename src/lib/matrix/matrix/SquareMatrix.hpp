@@ -21,17 +21,17 @@ class SquareMatrix : public Matrix<Type, M, M>
 public:
 	SquareMatrix() = default;
 
-	explicit SquareMatrix(const Type data_[M][M]) :
+	explicit constexpr SquareMatrix(const Type data_[M][M]) :
 		Matrix<Type, M, M>(data_)
 	{
 	}
 
-	explicit SquareMatrix(const Type data_[M * M]) :
+	explicit constexpr SquareMatrix(const Type data_[M * M]) :
 		Matrix<Type, M, M>(data_)
 	{
 	}
 
-	SquareMatrix(const Matrix<Type, M, M> &other) :
+	constexpr SquareMatrix(const Matrix<Type, M, M> &other) :
 		Matrix<Type, M, M>(other)
 	{
 	}
@@ -341,6 +341,36 @@ SquareMatrix<Type, M> diag(Vector<Type, M> d)
 	return m;
 }
 
+/**
+ * A * P * A.T + Q, e.g. for a covariance propagation or an innovation covariance.
+ * Only a single row of A * P is kept, instead of the full A * P, A.T and A * P * A.T temporaries.
+ */
+template<typename Type, size_t M, size_t N>
+SquareMatrix<Type, M> transformCovariance(const Matrix<Type, M, N> &A, const Matrix<Type, N, N> &P,
+		const Matrix<Type, M, M> &Q)
+{
+	SquareMatrix<Type, M> res(Q);
+	Type AP_row[N];
+
+	for (size_t i = 0; i < M; i++) {
+		for (size_t k = 0; k < N; k++) {
+			AP_row[k] = Type(0);
+
+			for (size_t j = 0; j < N; j++) {
+				AP_row[k] += A(i, j) * P(j, k);
+			}
+		}
+
+		for (size_t l = 0; l < M; l++) {
+			for (size_t k = 0; k < N; k++) {
+				res(i, l) += AP_row[k] * A(l, k);
+			}
+		}
+	}
+
+	return res;
+}
+
 template<typename Type, size_t M>
 SquareMatrix<Type, M> expm(const Matrix<Type, M, M> &A, size_t order = 5)
 {
@@ -619,6 +649,70 @@ SquareMatrix <Type, M> choleskyInv(const SquareMatrix<Type, M> &A)
 	return L_inv.T() * L_inv;
 }
 
+/**
+ * In-place LDL^T decomposition of a symmetric positive definite matrix
+ *
+ * Only the lower triangle of A is used. On return the strictly lower triangle holds L (unit diagonal)
+ * and the diagonal holds D. Unlike cholesky() no square roots are needed.
+ *
+ * @return false if A is not positive definite, A is then not usable by ldltSolve()
+ */
+template<typename Type, size_t M>
+bool ldlt(SquareMatrix<Type, M> &A)
+{
+	for (size_t j = 0; j < M; j++) {
+		Type d = A(j, j);
+
+		for (size_t k = 0; k < j; k++) {
+			d -= A(j, k) * A(j, k) * A(k, k);
+		}
+
+		if (!(d > Type(0))) {
+			return false;
+		}
+
+		A(j, j) = d;
+
+		for (size_t i = j + 1; i < M; i++) {
+			Type sum = A(i, j);
+
+			for (size_t k = 0; k < j; k++) {
+				sum -= A(i, k) * A(j, k) * A(k, k);
+			}
+
+			A(i, j) = sum / d;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Solve A * x = b in-place (b is replaced by x), with LD being the ldlt() decomposition of A
+ */
+template<typename Type, size_t M>
+void ldltSolve(const SquareMatrix<Type, M> &LD, Vector<Type, M> &b)
+{
+	// L * y = b
+	for (size_t i = 0; i < M; i++) {
+		for (size_t k = 0; k < i; k++) {
+			b(i) -= LD(i, k) * b(k);
+		}
+	}
+
+	// D * z = y
+	for (size_t i = 0; i < M; i++) {
+		b(i) /= LD(i, i);
+	}
+
+	// L^T * x = z
+	for (size_t i = M; i-- > 0;) {
+		for (size_t k = i + 1; k < M; k++) {
+			b(i) -= LD(k, i) * b(k);
+		}
+	}
+}
+
 using Matrix2f = SquareMatrix<float, 2>;
 using Matrix3f = SquareMatrix<float, 3>;
 using Matrix3d = SquareMatrix<double, 3>;
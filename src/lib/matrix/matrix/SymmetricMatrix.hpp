@@ -0,0 +1,182 @@
+/**
+ * @file SymmetricMatrix.hpp
+ *
+ * Symmetric matrix class with packed storage of the upper triangle.
+ *
+ */
+
+#pragma once
+
+#include "SquareMatrix.hpp"
+
+namespace matrix
+{
+
+// Symmetric N x N matrix, only the N * (N + 1) / 2 elements of the upper triangle are stored (row by row).
+// (i, j) and (j, i) access the same element, so the matrix is always exactly symmetric.
+template<typename Type, size_t N>
+class SymmetricMatrix
+{
+public:
+	static constexpr size_t PACKED_SIZE = N * (N + 1) / 2;
+
+	SymmetricMatrix() = default;
+
+	// takes the upper triangle of other
+	explicit SymmetricMatrix(const Matrix<Type, N, N> &other)
+	{
+		for (size_t i = 0; i < N; i++) {
+			for (size_t j = i; j < N; j++) {
+				_data[index(i, j)] = other(i, j);
+			}
+		}
+	}
+
+	inline const Type &operator()(size_t i, size_t j) const
+	{
+		assert(i < N);
+		assert(j < N);
+
+		return _data[index(i, j)];
+	}
+
+	inline Type &operator()(size_t i, size_t j)
+	{
+		assert(i < N);
+		assert(j < N);
+
+		return _data[index(i, j)];
+	}
+
+	void setZero()
+	{
+		memset(_data, 0, sizeof(_data));
+	}
+
+	void setIdentity()
+	{
+		setZero();
+
+		for (size_t i = 0; i < N; i++) {
+			_data[index(i, i)] = Type(1);
+		}
+	}
+
+	// this += alpha * v * v.T, only updating the stored upper triangle
+	void rankOneUpdate(const Vector<Type, N> &v, Type alpha = Type(1))
+	{
+		size_t n = 0;
+
+		for (size_t i = 0; i < N; i++) {
+			const Type alpha_vi = alpha * v(i);
+
+			for (size_t j = i; j < N; j++) {
+				_data[n++] += alpha_vi * v(j);
+			}
+		}
+	}
+
+	Vector<Type, N> operator*(const Vector<Type, N> &x) const
+	{
+		Vector<Type, N> res;
+		size_t n = 0;
+
+		// every stored off-diagonal element contributes to two rows
+		for (size_t i = 0; i < N; i++) {
+			res(i) += _data[n++] * x(i);
+
+			for (size_t j = i + 1; j < N; j++) {
+				res(i) += _data[n] * x(j);
+				res(j) += _data[n] * x(i);
+				n++;
+			}
+		}
+
+		return res;
+	}
+
+	SymmetricMatrix<Type, N> operator+(const SymmetricMatrix<Type, N> &other) const
+	{
+		SymmetricMatrix<Type, N> res;
+
+		for (size_t n = 0; n < PACKED_SIZE; n++) {
+			res._data[n] = _data[n] + other._data[n];
+		}
+
+		return res;
+	}
+
+	SymmetricMatrix<Type, N> &operator+=(const SymmetricMatrix<Type, N> &other)
+	{
+		for (size_t n = 0; n < PACKED_SIZE; n++) {
+			_data[n] += other._data[n];
+		}
+
+		return *this;
+	}
+
+	SymmetricMatrix<Type, N> operator*(Type scalar) const
+	{
+		SymmetricMatrix<Type, N> res;
+
+		for (size_t n = 0; n < PACKED_SIZE; n++) {
+			res._data[n] = _data[n] * scalar;
+		}
+
+		return res;
+	}
+
+	Vector<Type, N> diag() const
+	{
+		Vector<Type, N> res;
+
+		for (size_t i = 0; i < N; i++) {
+			res(i) = _data[index(i, i)];
+		}
+
+		return res;
+	}
+
+	Type trace() const
+	{
+		Type res = Type(0);
+
+		for (size_t i = 0; i < N; i++) {
+			res += _data[index(i, i)];
+		}
+
+		return res;
+	}
+
+	// full storage copy, e.g. for the inversion
+	SquareMatrix<Type, N> full() const
+	{
+		SquareMatrix<Type, N> res;
+
+		for (size_t i = 0; i < N; i++) {
+			for (size_t j = i; j < N; j++) {
+				res(i, j) = res(j, i) = _data[index(i, j)];
+			}
+		}
+
+		return res;
+	}
+
+private:
+	static constexpr size_t index(size_t i, size_t j)
+	{
+		return (i <= j) ? (i * N - (i * (i - 1)) / 2 + (j - i)) : index(j, i);
+	}
+
+	Type _data[PACKED_SIZE] {};
+};
+
+template<typename Type, size_t N>
+SymmetricMatrix<Type, N> operator*(Type scalar, const SymmetricMatrix<Type, N> &other)
+{
+	return other * scalar;
+}
+
+using SymmetricMatrix3f = SymmetricMatrix<float, 3>;
+
+} // namespace matrix
@@ -21,12 +21,12 @@ public:
 
 	Vector() = default;
 
-	Vector(const MatrixM1 &other) :
+	constexpr Vector(const MatrixM1 &other) :
 		MatrixM1(other)
 	{
 	}
 
-	explicit Vector(const Type data_[M]) :
+	explicit constexpr Vector(const Type data_[M]) :
 		MatrixM1(data_)
 	{
 	}
@@ -63,7 +63,7 @@ public:
 		}
 	}
 
-	inline const Type &operator()(size_t i) const
+	inline constexpr const Type &operator()(size_t i) const
 	{
 		assert(i < M);
 
@@ -71,7 +71,7 @@ public:
 		return v(i, 0);
 	}
 
-	inline Type &operator()(size_t i)
+	inline constexpr Type &operator()(size_t i)
 	{
 		assert(i < M);
 
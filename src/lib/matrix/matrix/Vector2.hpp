@@ -23,17 +23,17 @@ public:
 
 	Vector2() = default;
 
-	Vector2(const Matrix21 &other) :
+	constexpr Vector2(const Matrix21 &other) :
 		Vector<Type, 2>(other)
 	{
 	}
 
-	explicit Vector2(const Type data_[2]) :
+	explicit constexpr Vector2(const Type data_[2]) :
 		Vector<Type, 2>(data_)
 	{
 	}
 
-	Vector2(Type x, Type y)
+	constexpr Vector2(Type x, Type y)
 	{
 		Vector2 &v(*this);
 		v(0) = x;
@@ -25,17 +25,17 @@ public:
 
 	Vector3() = default;
 
-	Vector3(const Matrix31 &other) :
+	constexpr Vector3(const Matrix31 &other) :
 		Vector<Type, 3>(other)
 	{
 	}
 
-	explicit Vector3(const Type data_[3]) :
+	explicit constexpr Vector3(const Type data_[3]) :
 		Vector<Type, 3>(data_)
 	{
 	}
 
-	Vector3(Type x, Type y, Type z)
+	constexpr Vector3(Type x, Type y, Type z)
 	{
 		Vector3 &v(*this);
 		v(0) = x;
@@ -54,17 +54,17 @@ public:
 
 	Vector4() = default;
 
-	Vector4(const Matrix41 &other) :
+	constexpr Vector4(const Matrix41 &other) :
 		Vector<Type, 4>(other)
 	{
 	}
 
-	explicit Vector4(const Type data_[3]) :
+	explicit constexpr Vector4(const Type data_[3]) :
 		Vector<Type, 4>(data_)
 	{
 	}
 
-	Vector4(Type x1, Type x2, Type x3, Type x4)
+	constexpr Vector4(Type x1, Type x2, Type x3, Type x4)
 	{
 		Vector4 &v(*this);
 		v(0) = x1;
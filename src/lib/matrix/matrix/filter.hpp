@@ -17,7 +17,7 @@ int kalman_correct(
 	Type &beta
 )
 {
-	SquareMatrix<Type, N> S_I = SquareMatrix<Type, N>(C * P * C.T() + R).I();
+	SquareMatrix<Type, N> S_I = transformCovariance(C, P, R).I();
 	Matrix<Type, M, N> K = P * C.T() * S_I;
 	dx = K * r;
 	beta = Scalar<Type>(r.T() * S_I * r);
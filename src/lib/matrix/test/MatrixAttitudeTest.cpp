@@ -494,3 +494,20 @@ TEST(MatrixAttitudeTest, Attitude)
 	R = Dcmf(q);
 	EXPECT_EQ(q, Quatf(R));
 }
+
+TEST(MatrixAttitudeTest, ConstexprConstruction)
+{
+	constexpr Vector3f v(1.f, 2.f, 3.f);
+	static_assert(v(1) > 1.5f && v(1) < 2.5f, "constexpr Vector3 access");
+
+	constexpr float data[3][3] = {{0, -1, 0}, {1, 0, 0}, {0, 0, 1}};
+	constexpr Dcmf R(data);
+	static_assert(R(1, 0) > 0.5f, "constexpr Dcm access");
+
+	constexpr Quatf q(1.f, 0.f, 0.f, 0.f);
+	constexpr Eulerf e(0.1f, 0.2f, 0.3f);
+	static_assert(q(0) > 0.5f && e.psi() > 0.25f, "constexpr Quaternion and Euler access");
+
+	EXPECT_EQ(Vector3f(R * v), Vector3f(-2.f, 1.f, 3.f));
+	EXPECT_EQ(q, Quatf());
+}
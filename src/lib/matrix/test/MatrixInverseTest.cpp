@@ -193,3 +193,45 @@ TEST(MatrixInverseTest, Inverse)
 	EXPECT_EQ(choleskyInv(A4)*A4, I3);
 	EXPECT_EQ(cholesky(Z3), Z3);
 }
+
+TEST(MatrixInverseTest, Ldlt)
+{
+	float data[16] = {4, 1, 0.5f, 0.2f,
+			  1, 3, -1, 0,
+			  0.5f, -1, 2, 0.3f,
+			  0.2f, 0, 0.3f, 1
+			 };
+	const SquareMatrix<float, 4> A(data);
+	const Vector4f b(1.f, -2.f, 0.5f, 3.f);
+
+	SquareMatrix<float, 4> LD = A;
+	EXPECT_TRUE(ldlt(LD));
+
+	Vector4f x = b;
+	ldltSolve(LD, x);
+	EXPECT_TRUE(isEqual(Vector4f(A * x), b));
+	EXPECT_TRUE(isEqual(x, Vector4f(inv(A) * b)));
+
+	// L * D * L^T reconstructs A
+	SquareMatrix<float, 4> L;
+	SquareMatrix<float, 4> D;
+
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t j = 0; j < i; j++) {
+			L(i, j) = LD(i, j);
+		}
+
+		L(i, i) = 1.f;
+		D(i, i) = LD(i, i);
+	}
+
+	EXPECT_TRUE(isEqual(SquareMatrix<float, 4>(L * D * L.T()), A));
+
+	// not positive definite
+	SquareMatrix<float, 4> B = A;
+	B(3, 3) = -1.f;
+	EXPECT_FALSE(ldlt(B));
+
+	SquareMatrix<float, 4> Z;
+	EXPECT_FALSE(ldlt(Z));
+}
@@ -98,3 +98,55 @@ TEST(MatrixMultiplicationTest, Multiplication)
 	Matrix<float, 4, 2> m42_plus2 = m42 - (-2);
 	EXPECT_EQ(m42_plus2, m42_plus2_check);
 }
+
+TEST(MatrixMultiplicationTest, UnrolledSmallShapes)
+{
+	float data_44[16] = {1.5f, -3.f, 2.25f, 0.1f,
+			     2.f, 2.f, -1.f, 7.f,
+			     -5.f, 0.3f, 1.f, 4.f,
+			     2.f, 3.f, -4.5f, 0.f
+			    };
+	SquareMatrix<float, 4> A(data_44);
+	SquareMatrix<float, 4> B = A.transpose() * 0.5f - 1.f;
+
+	// shapes up to 4x4 take the unrolled path, the results have to match the generic loops
+	EXPECT_EQ(A * B, A.multiplyGeneric(B));
+
+	Matrix3f C = A.slice<3, 3>(0, 0);
+	Matrix3f D = B.slice<3, 3>(1, 1);
+	EXPECT_EQ(C * D, C.multiplyGeneric(D));
+
+	Vector3f v(0.2f, -1.f, 3.f);
+	EXPECT_EQ(Vector3f(C * v), Vector3f(C.multiplyGeneric(v)));
+
+	Matrix<float, 4, 3> E = A.slice<4, 3>(0, 1);
+	Matrix<float, 3, 2> F = D.slice<3, 2>(0, 0);
+	EXPECT_EQ((E * F), E.multiplyGeneric(F));
+	EXPECT_EQ((v.transpose() * C), v.transpose().multiplyGeneric(C));
+
+	// larger shapes keep the loops
+	Matrix<float, 6, 5> G;
+	G.setAll(2.f);
+	Matrix<float, 5, 4> H;
+	H.setAll(0.5f);
+	Matrix<float, 6, 4> GH;
+	GH.setAll(5.f);
+	EXPECT_EQ(G * H, GH);
+}
+
+TEST(MatrixMultiplicationTest, MultiplyAdd)
+{
+	float data_23[6] = {1, 2, 0,
+			    -1, 0.5f, 3
+			   };
+	float data_32[6] = {2, 3,
+			    1, 7,
+			    5, 4
+			   };
+	float data_22[4] = {1, 2, 3, 4};
+	Matrix<float, 2, 3> A(data_23);
+	Matrix<float, 3, 2> B(data_32);
+	Matrix<float, 2, 2> C(data_22);
+
+	EXPECT_TRUE(isEqual(A.multiplyAdd(B, C), Matrix<float, 2, 2>(A * B + C)));
+}
@@ -210,3 +210,21 @@ TEST(MatrixSquareTest, Square)
 	M.copyUpperToLowerTriangle();
 	EXPECT_EQ(M, L_check);
 }
+
+TEST(MatrixSquareTest, TransformCovariance)
+{
+	float data_A[6] = {1, 2, 0,
+			   -1, 0.5f, 3
+			  };
+	float data_P[9] = {4, 1, 0.5f,
+			   1, 3, -1,
+			   0.5f, -1, 2
+			  };
+	Matrix<float, 2, 3> A(data_A);
+	SquareMatrix<float, 3> P(data_P);
+	SquareMatrix<float, 2> Q = eye<float, 2>() * 0.1f;
+
+	SquareMatrix<float, 2> S = transformCovariance(A, P, Q);
+	EXPECT_TRUE(isEqual(S, SquareMatrix<float, 2>(A * P * A.T() + Q)));
+	EXPECT_TRUE(S.isBlockSymmetric<2>(0));
+}
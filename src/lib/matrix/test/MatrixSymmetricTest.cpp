@@ -0,0 +1,73 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <matrix/math.hpp>
+
+using namespace matrix;
+
+TEST(MatrixSymmetricTest, Symmetric)
+{
+	float data[9] = {4, 1, 0.5f,
+			 1, 3, -1,
+			 0.5f, -1, 2
+			};
+	SquareMatrix3f A(data);
+	SymmetricMatrix3f S(A);
+
+	EXPECT_EQ(S.full(), A);
+	EXPECT_EQ(S.diag(), A.diag());
+	EXPECT_FLOAT_EQ(S.trace(), A.trace());
+
+	// both triangles access the same element
+	S(2, 0) = 7.f;
+	EXPECT_FLOAT_EQ(S(0, 2), 7.f);
+	S(0, 2) = 0.5f;
+
+	Vector3f x(1.f, -2.f, 0.5f);
+	EXPECT_TRUE(isEqual(S * x, Vector3f(A * x)));
+
+	// rank one update of the upper triangle
+	SymmetricMatrix3f R(A);
+	R.rankOneUpdate(x, 2.f);
+	EXPECT_TRUE(isEqual(R.full(), SquareMatrix3f(A + x.multiplyByTranspose(x) * 2.f)));
+
+	EXPECT_TRUE(isEqual((S + S).full(), SquareMatrix3f(A * 2.f)));
+	EXPECT_TRUE(isEqual((0.5f * S).full(), SquareMatrix3f(A * 0.5f)));
+
+	SymmetricMatrix<float, 4> I;
+	I.setIdentity();
+	EXPECT_EQ(I.full(), (eye<float, 4>()));
+	EXPECT_EQ(sizeof(SymmetricMatrix<float, 24>), 300 * sizeof(float));
+}
@@ -0,0 +1,118 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "control_latency.hpp"
+
+#include <string.h>
+
+void ControlLatency::update(hrt_abstime timestamp_sample, hrt_abstime timestamp_motors, hrt_abstime now)
+{
+	// count every control cycle only once (outputs can be updated again without new data)
+	if (timestamp_sample == _last_timestamp_sample) {
+		return;
+	}
+
+	_last_timestamp_sample = timestamp_sample;
+
+	_vehicle_angular_velocity_sub.update(&_vehicle_angular_velocity);
+	_vehicle_torque_setpoint_sub.update(&_vehicle_torque_setpoint);
+
+	++_control_latency.samples;
+
+	// the intermediate topics might already be newer (or older) than the motor setpoint being output
+	const bool angular_velocity_matches = _vehicle_angular_velocity.timestamp_sample == timestamp_sample;
+	const bool torque_setpoint_matches = _vehicle_torque_setpoint.timestamp_sample == timestamp_sample;
+
+	if (angular_velocity_matches) {
+		addSample(control_latency_s::STAGE_FILTER, timestamp_sample, _vehicle_angular_velocity.timestamp);
+	}
+
+	if (angular_velocity_matches && torque_setpoint_matches) {
+		addSample(control_latency_s::STAGE_RATE_CONTROL, _vehicle_angular_velocity.timestamp, _vehicle_torque_setpoint.timestamp);
+	}
+
+	if (torque_setpoint_matches) {
+		addSample(control_latency_s::STAGE_ALLOCATION, _vehicle_torque_setpoint.timestamp, timestamp_motors);
+	}
+
+	addSample(control_latency_s::STAGE_OUTPUT, timestamp_motors, now);
+	addSample(control_latency_s::STAGE_TOTAL, timestamp_sample, now);
+
+	if (now - _last_publish >= PUBLISH_INTERVAL) {
+		publish(now);
+	}
+}
+
+void ControlLatency::addSample(int stage, hrt_abstime start, hrt_abstime end)
+{
+	if (end < start) {
+		return;
+	}
+
+	const uint32_t latency = (end - start > UINT32_MAX) ? UINT32_MAX : end - start;
+
+	int bin = latency / control_latency_s::BIN_WIDTH;
+
+	if (bin >= control_latency_s::NUM_BINS) {
+		bin = control_latency_s::NUM_BINS - 1;
+	}
+
+	uint16_t &count = _control_latency.histogram[stage * control_latency_s::NUM_BINS + bin];
+
+	if (count < UINT16_MAX) {
+		++count;
+	}
+
+	++_control_latency.stage_samples[stage];
+	_latency_sum[stage] += latency;
+
+	if (latency > _control_latency.latency_max[stage]) {
+		_control_latency.latency_max[stage] = latency;
+	}
+}
+
+void ControlLatency::publish(hrt_abstime now)
+{
+	for (int stage = 0; stage < control_latency_s::NUM_STAGES; ++stage) {
+		const uint32_t samples = _control_latency.stage_samples[stage];
+		_control_latency.latency_mean[stage] = (samples > 0) ? (float)_latency_sum[stage] / samples : 0.f;
+	}
+
+	_control_latency.timestamp = now;
+	_control_latency_pub.publish(_control_latency);
+
+	// start a new interval
+	memset(&_control_latency, 0, sizeof(_control_latency));
+	memset(_latency_sum, 0, sizeof(_latency_sum));
+	_last_publish = now;
+}
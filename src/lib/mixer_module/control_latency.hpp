@@ -0,0 +1,78 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <uORB/PublicationMulti.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/topics/control_latency.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_torque_setpoint.h>
+
+/**
+ * @class ControlLatency
+ * Latency statistics along the rate control pipeline, from the gyro sample to the output driver update.
+ * The intermediate stages are matched via the propagated gyro sample timestamp.
+ */
+class ControlLatency
+{
+public:
+	ControlLatency() = default;
+
+	/**
+	 * Add the latencies of an output update
+	 * @param timestamp_sample gyro sample timestamp of the actuator_motors message
+	 * @param timestamp_motors publication timestamp of the actuator_motors message
+	 * @param now time of the output update
+	 */
+	void update(hrt_abstime timestamp_sample, hrt_abstime timestamp_motors, hrt_abstime now);
+
+private:
+	static constexpr hrt_abstime PUBLISH_INTERVAL{1000000}; // 1 Hz
+
+	void addSample(int stage, hrt_abstime start, hrt_abstime end);
+	void publish(hrt_abstime now);
+
+	uORB::Subscription _vehicle_angular_velocity_sub{ORB_ID(vehicle_angular_velocity)};
+	uORB::Subscription _vehicle_torque_setpoint_sub{ORB_ID(vehicle_torque_setpoint)};
+	uORB::PublicationMulti<control_latency_s> _control_latency_pub{ORB_ID(control_latency)};
+
+	vehicle_angular_velocity_s _vehicle_angular_velocity{};
+	vehicle_torque_setpoint_s _vehicle_torque_setpoint{};
+
+	control_latency_s _control_latency{};
+	uint64_t _latency_sum[control_latency_s::NUM_STAGES] {};
+	hrt_abstime _last_timestamp_sample{0};
+	hrt_abstime _last_publish{0};
+};
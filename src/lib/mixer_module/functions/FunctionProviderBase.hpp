@@ -68,6 +68,11 @@ public:
 
 	virtual bool getLatestSampleTimestamp(hrt_abstime &t) const { return false; }
 
+	/**
+	 * Get the publication timestamp of the latest input message (for the output latency)
+	 */
+	virtual bool getLatestPublicationTimestamp(hrt_abstime &t) const { return false; }
+
 	/**
 	 * Check whether the output (motor) is configured to be reversible
 	 */
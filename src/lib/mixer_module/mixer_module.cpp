@@ -76,6 +76,7 @@ MixingOutput::MixingOutput(const char *param_prefix, uint8_t max_num_outputs, Ou
 	_max_num_outputs(max_num_outputs < MAX_ACTUATORS ? max_num_outputs : MAX_ACTUATORS),
 	_interface(interface),
 	_control_latency_perf(perf_alloc(PC_ELAPSED, "control latency")),
+	_output_latency_perf(perf_alloc(PC_ELAPSED, "output latency")),
 	_param_prefix(param_prefix)
 {
 	/* Safely initialize armed flags */
@@ -102,6 +103,7 @@ MixingOutput::MixingOutput(const char *param_prefix, uint8_t max_num_outputs, Ou
 MixingOutput::~MixingOutput()
 {
 	perf_free(_control_latency_perf);
+	perf_free(_output_latency_perf);
 	px4_sem_destroy(&_lock);
 
 	cleanupFunctions();
@@ -136,6 +138,7 @@ void MixingOutput::printStatus() const
 {
 	PX4_INFO("Param prefix: %s", _param_prefix);
 	perf_print_counter(_control_latency_perf);
+	perf_print_counter(_output_latency_perf);
 
 	if (_wq_switched) {
 		PX4_INFO("Switched to rate_ctrl work queue");
@@ -681,10 +684,21 @@ MixingOutput::updateLatencyPerfCounter(const actuator_outputs_s &actuator_output
 	// Just check the first function. It means we only get the latency if motors are assigned first, which is the default
 	if (_function_allocated[0]) {
 		hrt_abstime timestamp_sample;
+		hrt_abstime timestamp_published;
+		const bool has_sample = _function_allocated[0]->getLatestSampleTimestamp(timestamp_sample);
+		const bool has_published = _function_allocated[0]->getLatestPublicationTimestamp(timestamp_published);
 
-		if (_function_allocated[0]->getLatestSampleTimestamp(timestamp_sample)) {
+		if (has_sample) {
 			perf_set_elapsed(_control_latency_perf, actuator_outputs.timestamp - timestamp_sample);
 		}
+
+		if (has_published) {
+			perf_set_elapsed(_output_latency_perf, actuator_outputs.timestamp - timestamp_published);
+		}
+
+		if (has_sample && has_published) {
+			_control_latency.update(timestamp_sample, timestamp_published, actuator_outputs.timestamp);
+		}
 	}
 }
 
@@ -34,6 +34,7 @@
 #pragma once
 
 #include "actuator_test.hpp"
+#include "control_latency.hpp"
 
 #include "functions/FunctionActuatorSet.hpp"
 #include "functions/FunctionConstantMax.hpp"
@@ -278,7 +279,8 @@ private:
 
 	OutputModuleInterface &_interface;
 
-	perf_counter_t _control_latency_perf;
+	perf_counter_t _control_latency_perf; ///< gyro sample to output
+	perf_counter_t _output_latency_perf; ///< actuator_motors publication to output (scheduling, mixing and driver update)
 
 	FunctionProviderBase *_function_allocated[MAX_ACTUATORS] {}; ///< unique allocated functions
 	FunctionProviderBase *_functions[MAX_ACTUATORS] {}; ///< currently assigned functions
@@ -290,6 +292,7 @@ private:
 	param_t _param_handle_rev_range{PARAM_INVALID};
 	hrt_abstime _lowrate_schedule_interval{300_ms};
 	ActuatorTest _actuator_test{_function_assignment};
+	ControlLatency _control_latency;
 	uint32_t _reversible_mask{0}; ///< per-output bits. If set, the output is configured to be reversible (motors only)
 	bool _was_all_disabled{false};
 
@@ -35,6 +35,7 @@
 #include "TrajectoryConstraints.hpp"
 #include <mathlib/mathlib.h>
 #include <matrix/matrix/math.hpp>
+#include <cstring>
 
 void PositionSmoothing::_generateSetpoints(
 	const Vector3f &position,
@@ -313,9 +314,43 @@ void PositionSmoothing::_generateTrajectory(
 		out_setpoints.position(i) = _trajectory[i].getCurrentPosition();
 	}
 
+	if (_isPlanningValid(velocity_setpoint)) {
+		// Keep following the previously computed (and synchronized) durations
+		return;
+	}
+
 	for (int i = 0; i < 3; ++i) {
 		_trajectory[i].updateDurations(velocity_setpoint(i));
+		_planning_inputs[i] = {velocity_setpoint(i), _trajectory[i].getMaxJerk(), _trajectory[i].getMaxAccel(),
+				       _trajectory[i].getMaxVel()
+				      };
 	}
 
 	VelocitySmoothing::timeSynchronization(_trajectory, 3);
+	_planning_valid = true;
+}
+
+bool PositionSmoothing::_isPlanningValid(const Vector3f &velocity_setpoint) const
+{
+	if (!_planning_valid) {
+		return false;
+	}
+
+	for (int i = 0; i < 3; ++i) {
+		const PlanningInputs inputs{velocity_setpoint(i), _trajectory[i].getMaxJerk(), _trajectory[i].getMaxAccel(),
+					    _trajectory[i].getMaxVel()};
+
+		if (memcmp(&inputs, &_planning_inputs[i], sizeof(inputs)) != 0) {
+			return false;
+		}
+
+		// The durations can end up short of the setpoint (e.g.: no real solution for the synchronized time),
+		// in that case they have to be computed again from the current state
+		if (_trajectory[i].isDurationElapsed()
+		    && fabsf(_trajectory[i].getCurrentVelocity() - _trajectory[i].getVelSp()) > 1e-3f) {
+			return false;
+		}
+	}
+
+	return true;
 }
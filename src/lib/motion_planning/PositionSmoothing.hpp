@@ -128,6 +128,8 @@ public:
 		for (size_t i = 0; i < 3; i++) {
 			_trajectory[i].reset(acceleration(i), velocity(i), position(i));
 		}
+
+		_planning_valid = false;
 	}
 
 	/**
@@ -376,6 +378,8 @@ public:
 				_trajectory[i].setCurrentPosition(position(i));
 			}
 		}
+
+		_planning_valid = false;
 	}
 
 	/**
@@ -391,6 +395,8 @@ public:
 				_trajectory[i].setCurrentVelocity(velocity(i));
 			}
 		}
+
+		_planning_valid = false;
 	}
 
 	/**
@@ -406,6 +412,8 @@ public:
 				_trajectory[i].setCurrentAcceleration(acceleration(i));
 			}
 		}
+
+		_planning_valid = false;
 	}
 
 
@@ -422,9 +430,26 @@ private:
 	VelocitySmoothing _trajectory[3]; ///< Trajectories in x, y and z directions
 	float _max_speed_previous{0.f};
 
+	/* Inputs of the last duration computation, the durations are reused as long as they don't change */
+	struct PlanningInputs {
+		float vel_sp;
+		float max_jerk;
+		float max_accel;
+		float max_vel;
+	};
+
+	PlanningInputs _planning_inputs[3] {};
+	bool _planning_valid{false}; ///< false if the trajectory state was modified since the last duration computation
+
 	/* Internal functions */
 	bool _isTurning(const Vector3f &target) const;
 
+	/**
+	 * @return true if the durations computed in a previous cycle still describe the trajectory
+	 * towards the given velocity setpoint, so they don't need to be computed again
+	 */
+	bool _isPlanningValid(const Vector3f &velocity_setpoint) const;
+
 	void _generateSetpoints(
 		const Vector3f &position,
 		const Vector3f(&waypoints)[3],
@@ -193,3 +193,35 @@ TEST_F(PositionSmoothingTest, reachesTargetInitialVelocity)
 	EXPECT_LT(fabsf(position(2) - TARGET(2)), Z_ACC_RAD);
 	EXPECT_LT(iteration, N_ITER) << "Took too long to converge\n";
 }
+
+TEST_F(PositionSmoothingTest, cachedDurationsMatchRecomputation)
+{
+	const int N_ITER = 500;
+	const float DELTA_T = 0.02f;
+	const Vector3f NO_TARGET{NAN, NAN, NAN};
+	const Vector3f VELOCITY_TARGET{3.f, -1.f, 0.5f};
+
+	Vector3f waypoints[3] = {NO_TARGET, NO_TARGET, NO_TARGET};
+
+	// Forcing the state every cycle invalidates the cached durations, so this one solves the full profile each time
+	PositionSmoothing recomputed = _position_smoothing;
+
+	PositionSmoothing::PositionSmoothingSetpoints out{};
+	PositionSmoothing::PositionSmoothingSetpoints out_recomputed{};
+
+	for (int iteration = 0; iteration < N_ITER; iteration++) {
+		const Vector3f velocity_sp = iteration < N_ITER / 2 ? VELOCITY_TARGET : -VELOCITY_TARGET;
+
+		_position_smoothing.generateSetpoints(out.position, waypoints, velocity_sp, DELTA_T, false, out);
+
+		recomputed.forceSetPosition(recomputed.getCurrentPosition());
+		recomputed.generateSetpoints(out_recomputed.position, waypoints, velocity_sp, DELTA_T, false, out_recomputed);
+
+		// Re-synchronizing the shorter axes every cycle reaches the same end state on a slightly different path
+		expectDynamicsLimitsRespected(out);
+		EXPECT_LT(Vector3f(out.velocity - out_recomputed.velocity).norm(), 1e-2f);
+		EXPECT_LT(Vector3f(out.position - out_recomputed.position).norm(), 1e-2f);
+	}
+
+	EXPECT_LT(Vector3f(out.velocity + VELOCITY_TARGET).norm(), 1e-3f);
+}
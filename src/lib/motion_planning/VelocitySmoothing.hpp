@@ -112,6 +112,16 @@ public:
 	float getT3() const { return _T3; }
 	float getTotalTime() const { return _T1 + _T2 + _T3; }
 
+	/**
+	 * @return the (constrained) velocity setpoint used by the last updateDurations()
+	 */
+	float getVelSp() const { return _vel_sp; }
+
+	/**
+	 * @return true once updateTraj() integrated past the end of the last computed durations
+	 */
+	bool isDurationElapsed() const { return _local_time >= getTotalTime(); }
+
 	/**
 	 * Synchronize several trajectories to have the same total time. This is required to generate
 	 * straight lines.
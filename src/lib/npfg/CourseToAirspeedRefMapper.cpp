@@ -37,6 +37,24 @@ using matrix::Vector2f;
 float
 CourseToAirspeedRefMapper::mapCourseSetpointToHeadingSetpoint(const float bearing_setpoint, const Vector2f &wind_vel,
 		float airspeed_sp) const
+{
+	return headingSetpoint(bearing_setpoint, wind_vel, wind_vel.norm(), airspeed_sp);
+}
+
+void
+CourseToAirspeedRefMapper::mapCourseSetpointsToHeadingSetpoints(const float *bearing_setpoints,
+		float *heading_setpoints, int num_setpoints, const Vector2f &wind_vel, float airspeed_sp) const
+{
+	const float wind_speed = wind_vel.norm();
+
+	for (int i = 0; i < num_setpoints; i++) {
+		heading_setpoints[i] = headingSetpoint(bearing_setpoints[i], wind_vel, wind_speed, airspeed_sp);
+	}
+}
+
+float
+CourseToAirspeedRefMapper::headingSetpoint(const float bearing_setpoint, const Vector2f &wind_vel,
+		const float wind_speed, float airspeed_sp) const
 {
 	const Vector2f bearing_vector = Vector2f{cosf(bearing_setpoint), sinf(bearing_setpoint)};
 	const float wind_cross_bearing = wind_vel.cross(bearing_vector);
@@ -44,13 +62,13 @@ CourseToAirspeedRefMapper::mapCourseSetpointToHeadingSetpoint(const float bearin
 
 	Vector2f air_vel_ref;
 
-	if (bearingIsFeasible(wind_cross_bearing, wind_dot_bearing, airspeed_sp, wind_vel.norm())) {
+	if (bearingIsFeasible(wind_cross_bearing, wind_dot_bearing, airspeed_sp, wind_speed)) {
 
 		const float airsp_dot_bearing = projectAirspOnBearing(airspeed_sp, wind_cross_bearing);
 		air_vel_ref = solveWindTriangle(wind_cross_bearing, airsp_dot_bearing, bearing_vector);
 
 	} else {
-		air_vel_ref = infeasibleAirVelRef(wind_vel, bearing_vector, wind_vel.norm(), airspeed_sp);
+		air_vel_ref = infeasibleAirVelRef(wind_vel, bearing_vector, wind_speed, airspeed_sp);
 	}
 
 	return atan2f(air_vel_ref(1), air_vel_ref(0));
@@ -73,10 +73,27 @@ public:
 
 	float mapCourseSetpointToHeadingSetpoint(const float bearing_setpoint,
 			const matrix::Vector2f &wind_vel, float airspeed_sp) const;
+
+	/*
+	 * Batch version of mapCourseSetpointToHeadingSetpoint(), for several course setpoints with the same
+	 * wind and airspeed setpoint (e.g. the results of DirectionalGuidance::evaluatePaths()).
+	 *
+	 * @param[in] bearing_setpoints Array of num_setpoints course setpoints [rad]
+	 * @param[out] heading_setpoints Array of num_setpoints heading setpoints [rad]
+	 */
+	void mapCourseSetpointsToHeadingSetpoints(const float *bearing_setpoints, float *heading_setpoints, int num_setpoints,
+			const matrix::Vector2f &wind_vel, float airspeed_sp) const;
 	float getMinAirspeedForCurrentBearing(const float bearing_setpoint,
 					      const matrix::Vector2f &wind_vel, float max_airspeed, float min_ground_speed) const;
 
 private:
+	/*
+	 * Heading setpoint for a course setpoint, see mapCourseSetpointToHeadingSetpoint().
+	 *
+	 * @param[in] wind_speed Wind speed [m/s]
+	 */
+	float headingSetpoint(const float bearing_setpoint, const matrix::Vector2f &wind_vel, const float wind_speed,
+			      float airspeed_sp) const;
 	/*
 	 * Projection of the air velocity vector onto the bearing line considering
 	 * a connected wind triangle.
@@ -49,57 +49,99 @@ DirectionalGuidance::guideToPath(const Vector2f &curr_pos_local, const Vector2f
 				 const float path_curvature)
 {
 	const float ground_speed = ground_vel.norm();
+	const float airspeed = (ground_vel - wind_vel).norm();
+	const float wind_speed = wind_vel.norm();
+
+	const GuidanceState state = evaluatePath(curr_pos_local, ground_vel, wind_vel, ground_speed, airspeed, wind_speed,
+				    DirectionalGuidancePath{unit_path_tangent, position_on_path, path_curvature});
 
-	const Vector2f air_vel = ground_vel - wind_vel;
-	const float airspeed = air_vel.norm();
+	signed_track_error_ = state.signed_track_error;
+	feas_on_track_ = state.feas_on_track;
+	adapted_period_ = state.adapted_period;
+	track_error_bound_ = state.track_error_bound;
+	track_proximity_ = state.track_proximity;
+	bearing_vec_ = state.bearing_vec;
+	feas_ = state.feas;
+	lateral_accel_ff_ = state.lateral_accel_ff;
+	course_sp_ = state.course_sp;
+
+	return DirectionalGuidanceOutput{.course_setpoint = course_sp_,
+					 .lateral_acceleration_feedforward = lateral_accel_ff_};
+}
 
+void DirectionalGuidance::evaluatePaths(const Vector2f &curr_pos_local, const Vector2f &ground_vel,
+					const Vector2f &wind_vel, const DirectionalGuidancePath *paths,
+					DirectionalGuidancePathEvaluation *evaluations, int num_paths) const
+{
+	// the vehicle state is the same for all the paths
+	const float ground_speed = ground_vel.norm();
+	const float airspeed = (ground_vel - wind_vel).norm();
 	const float wind_speed = wind_vel.norm();
 
-	const Vector2f path_pos_to_vehicle{curr_pos_local - position_on_path};
-	signed_track_error_ = unit_path_tangent.cross(path_pos_to_vehicle);
+	for (int i = 0; i < num_paths; i++) {
+		const GuidanceState state = evaluatePath(curr_pos_local, ground_vel, wind_vel, ground_speed, airspeed, wind_speed,
+					    paths[i]);
+
+		evaluations[i].course_setpoint = state.course_sp;
+		evaluations[i].lateral_acceleration_feedforward = state.lateral_accel_ff;
+		evaluations[i].signed_track_error = state.signed_track_error;
+		evaluations[i].track_error_bound = state.track_error_bound;
+		evaluations[i].bearing_feasibility = state.feas * state.feas_on_track;
+	}
+}
+
+DirectionalGuidance::GuidanceState
+DirectionalGuidance::evaluatePath(const Vector2f &curr_pos_local, const Vector2f &ground_vel, const Vector2f &wind_vel,
+				  const float ground_speed, const float airspeed, const float wind_speed,
+				  const DirectionalGuidancePath &path) const
+{
+	const Vector2f &unit_path_tangent = path.unit_path_tangent;
+	GuidanceState state;
+
+	const Vector2f path_pos_to_vehicle{curr_pos_local - path.position_on_path};
+	state.signed_track_error = unit_path_tangent.cross(path_pos_to_vehicle);
 
 	// on-track wind triangle projections
 	const float wind_cross_upt = wind_vel.cross(unit_path_tangent);
 	const float wind_dot_upt = wind_vel.dot(unit_path_tangent);
 
 	// calculate the bearing feasibility on the track at the current closest point
-	feas_on_track_ = bearingFeasibility(wind_cross_upt, wind_dot_upt, airspeed, wind_speed);
+	state.feas_on_track = bearingFeasibility(wind_cross_upt, wind_dot_upt, airspeed, wind_speed);
 
-	const float track_error = fabsf(signed_track_error_);
+	const float track_error = fabsf(state.signed_track_error);
 
 	// update control parameters considering upper and lower stability bounds (if enabled)
 	// must be called before trackErrorBound() as it updates time_const_
-	adapted_period_ = adaptPeriod(ground_speed, airspeed, wind_speed, track_error,
-				      path_curvature, wind_vel, unit_path_tangent, feas_on_track_);
-	const float time_const = timeConst(adapted_period_, damping_);
+	state.adapted_period = adaptPeriod(ground_speed, airspeed, wind_speed, track_error,
+					   path.path_curvature, wind_vel, unit_path_tangent, state.feas_on_track);
+	const float time_const = timeConst(state.adapted_period, damping_);
 
 	// track error bound is dynamic depending on ground speed
-	track_error_bound_ = trackErrorBound(ground_speed, time_const);
-	const float normalized_track_error = normalizedTrackError(track_error, track_error_bound_);
+	state.track_error_bound = trackErrorBound(ground_speed, time_const);
+	const float normalized_track_error = normalizedTrackError(track_error, state.track_error_bound);
 
 	// look ahead angle based solely on track proximity
 	const float look_ahead_ang = lookAheadAngle(normalized_track_error);
 
-	track_proximity_ = trackProximity(look_ahead_ang);
+	state.track_proximity = trackProximity(look_ahead_ang);
 
-	bearing_vec_ = bearingVec(unit_path_tangent, look_ahead_ang, signed_track_error_);
+	state.bearing_vec = bearingVec(unit_path_tangent, look_ahead_ang, state.signed_track_error);
 
 	// wind triangle projections
-	const float wind_cross_bearing = wind_vel.cross(bearing_vec_);
-	const float wind_dot_bearing = wind_vel.dot(bearing_vec_);
+	const float wind_cross_bearing = wind_vel.cross(state.bearing_vec);
+	const float wind_dot_bearing = wind_vel.dot(state.bearing_vec);
 
 	// continuous representation of the bearing feasibility
-	feas_ = bearingFeasibility(wind_cross_bearing, wind_dot_bearing, airspeed, wind_speed);
+	state.feas = bearingFeasibility(wind_cross_bearing, wind_dot_bearing, airspeed, wind_speed);
 
 	// we consider feasibility of both the current bearing as well as that on the track at the current closest point
-	const float feas_combined = feas_ * feas_on_track_;
+	const float feas_combined = state.feas * state.feas_on_track;
 	// lateral acceleration needed to stay on curved track (assuming no heading error)
-	lateral_accel_ff_ = lateralAccelFF(unit_path_tangent, ground_vel, wind_dot_upt,
-					   wind_cross_upt, airspeed, wind_speed, signed_track_error_, path_curvature) * feas_combined * track_proximity_;
-	course_sp_ = atan2f(bearing_vec_(1), bearing_vec_(0));
+	state.lateral_accel_ff = lateralAccelFF(unit_path_tangent, ground_vel, wind_dot_upt, wind_cross_upt, airspeed,
+						wind_speed, state.signed_track_error, path.path_curvature) * feas_combined * state.track_proximity;
+	state.course_sp = atan2f(state.bearing_vec(1), state.bearing_vec(0));
 
-	return DirectionalGuidanceOutput{.course_setpoint = course_sp_,
-					 .lateral_acceleration_feedforward = lateral_accel_ff_};
+	return state;
 }
 
 float DirectionalGuidance::adaptPeriod(const float ground_speed, const float airspeed, const float wind_speed,
@@ -66,6 +66,23 @@ struct DirectionalGuidanceOutput {
 	float lateral_acceleration_feedforward{NAN};
 };
 
+/*
+ * A path to evaluate the guidance law for, given by its closest point to the vehicle.
+ */
+struct DirectionalGuidancePath {
+	matrix::Vector2f unit_path_tangent; // unit vector tangent to path at closest point in direction of path
+	matrix::Vector2f position_on_path; // closest point on path [m]
+	float path_curvature{0.f}; // path curvature at closest point on track [m^-1]
+};
+
+struct DirectionalGuidancePathEvaluation {
+	float course_setpoint{NAN}; // [rad]
+	float lateral_acceleration_feedforward{NAN}; // [m/s^2]
+	float signed_track_error{NAN}; // [m]
+	float track_error_bound{NAN}; // [m]
+	float bearing_feasibility{NAN}; // combined feasibility of the bearing and of the track at the closest point [0,1]
+};
+
 class DirectionalGuidance
 {
 public:
@@ -76,6 +93,19 @@ public:
 					      const matrix::Vector2f &wind_vel,
 					      const matrix::Vector2f &unit_path_tangent, const matrix::Vector2f &position_on_path,
 					      const float path_curvature);
+
+	/*
+	 * Evaluate the guidance law for several candidate paths at once, e.g. to score paths
+	 * or look-ahead points before committing to one. The vehicle dependent terms are only
+	 * computed once, and the guidance states (getters) are not modified.
+	 *
+	 * @param[in] paths Array of num_paths paths
+	 * @param[out] evaluations Array of num_paths results, in the order of paths
+	 */
+	void evaluatePaths(const matrix::Vector2f &curr_pos_local, const matrix::Vector2f &ground_vel,
+			   const matrix::Vector2f &wind_vel, const DirectionalGuidancePath *paths,
+			   DirectionalGuidancePathEvaluation *evaluations, int num_paths) const;
+
 	/*
 	 * Set the nominal controller period [s].
 	 */
@@ -173,6 +203,31 @@ private:
 	float course_sp_{0.f}; // course setpoint [rad]
 	float lateral_accel_ff_{0.f}; // lateral acceleration feedforward [m/s^2]
 
+	// result of one evaluation of the guidance law
+	struct GuidanceState {
+		float signed_track_error;
+		float feas_on_track;
+		float adapted_period;
+		float track_error_bound;
+		float track_proximity;
+		matrix::Vector2f bearing_vec;
+		float feas;
+		float lateral_accel_ff;
+		float course_sp;
+	};
+
+	/*
+	 * Evaluates the guidance law for a single path, see guideToPath().
+	 *
+	 * @param[in] ground_speed Vehicle ground speed [m/s]
+	 * @param[in] airspeed Vehicle true airspeed [m/s]
+	 * @param[in] wind_speed Wind speed [m/s]
+	 * @return Guidance state for the path
+	 */
+	GuidanceState evaluatePath(const matrix::Vector2f &curr_pos_local, const matrix::Vector2f &ground_vel,
+				   const matrix::Vector2f &wind_vel, const float ground_speed, const float airspeed,
+				   const float wind_speed, const DirectionalGuidancePath &path) const;
+
 	/*
 	 * Cacluates a continuous representation of the bearing feasibility from [0,1].
 	 * 0 = infeasible, 1 = fully feasible, partial feasibility in between.
@@ -45,6 +45,7 @@
 #include <gtest/gtest.h>
 #include <lib/npfg/CourseToAirspeedRefMapper.hpp>
 #include <lib/npfg/AirspeedDirectionController.hpp>
+#include <lib/npfg/DirectionalGuidance.hpp>
 
 using namespace matrix;
 
@@ -366,3 +367,56 @@ TEST(NpfgTest, HeadingControl)
 	// THEN: we we expect maxmimum lateral acceleration setpoint
 	EXPECT_NEAR(lateral_acceleration_setpoint, airspeed * p_gain, 0.01f);
 }
+
+TEST(NpfgTest, BatchPathEvaluation)
+{
+	DirectionalGuidance guidance;
+	CourseToAirspeedRefMapper course_to_airspeed;
+	guidance.setRollTimeConst(0.5f);
+
+	// GIVEN: candidate straight and curved paths around the vehicle in a cross wind
+	const Vector2f curr_pos_local(10.f, -5.f);
+	const Vector2f ground_vel(14.f, 3.f);
+	const Vector2f wind_vel(0.f, 6.f);
+	const float airspeed_setpoint = 15.f;
+
+	static constexpr int NUM_PATHS = 4;
+	const DirectionalGuidancePath paths[NUM_PATHS] {
+		{Vector2f(1.f, 0.f), Vector2f(10.f, 0.f), 0.f},
+		{Vector2f(0.f, 1.f), Vector2f(50.f, -5.f), 0.f},
+		{Vector2f(-1.f, 0.f), Vector2f(10.f, -100.f), 0.01f},
+		{Vector2f(M_SQRT1_2_F, -M_SQRT1_2_F), Vector2f(12.f, -7.f), -0.02f},
+	};
+
+	// WHEN: we evaluate them in one batch
+	DirectionalGuidancePathEvaluation evaluations[NUM_PATHS];
+	guidance.evaluatePaths(curr_pos_local, ground_vel, wind_vel, paths, evaluations, NUM_PATHS);
+
+	float course_setpoints[NUM_PATHS];
+	float heading_setpoints[NUM_PATHS];
+
+	for (int i = 0; i < NUM_PATHS; i++) {
+		course_setpoints[i] = evaluations[i].course_setpoint;
+	}
+
+	course_to_airspeed.mapCourseSetpointsToHeadingSetpoints(course_setpoints, heading_setpoints, NUM_PATHS, wind_vel,
+			airspeed_setpoint);
+
+	// THEN: the guidance states are untouched
+	EXPECT_FLOAT_EQ(guidance.getSignedTrackError(), 0.f);
+
+	// AND: the results match guiding to each path on its own
+	for (int i = 0; i < NUM_PATHS; i++) {
+		const DirectionalGuidanceOutput output = guidance.guideToPath(curr_pos_local, ground_vel, wind_vel,
+				paths[i].unit_path_tangent, paths[i].position_on_path, paths[i].path_curvature);
+
+		EXPECT_FLOAT_EQ(evaluations[i].course_setpoint, output.course_setpoint);
+		EXPECT_FLOAT_EQ(evaluations[i].lateral_acceleration_feedforward, output.lateral_acceleration_feedforward);
+		EXPECT_FLOAT_EQ(evaluations[i].signed_track_error, guidance.getSignedTrackError());
+		EXPECT_FLOAT_EQ(evaluations[i].track_error_bound, guidance.getTrackErrorBound());
+		EXPECT_FLOAT_EQ(evaluations[i].bearing_feasibility,
+				guidance.getBearingFeasibility() * guidance.getBearingFeasibilityOnTrack());
+		EXPECT_FLOAT_EQ(heading_setpoints[i], course_to_airspeed.mapCourseSetpointToHeadingSetpoint(output.course_setpoint,
+				wind_vel, airspeed_setpoint));
+	}
+}
@@ -106,3 +106,87 @@ TEST_F(ParameterTest, testUorbSendReceive)
 	// AND: all the bytes should be equal
 	EXPECT_EQ(0, memcmp(&message, &obstacle_distance, sizeof(message)));
 }
+
+
+class ParameterTestModule : public ModuleParams
+{
+public:
+	ParameterTestModule() : ModuleParams(nullptr) {}
+
+	void update() { updateParams(); }
+
+	float getDist() const { return _param_cp_dist.get(); }
+	void setDist(float dist) { _param_cp_dist.set(dist); }
+
+private:
+	DEFINE_PARAMETERS(
+		(ParamFloat<px4::params::CP_DIST>) _param_cp_dist,
+		(ParamFloat<px4::params::CP_DELAY>) _param_cp_delay
+	)
+};
+
+
+TEST_F(ParameterTest, testParamChangedSince)
+{
+	// GIVEN a parameter handle and the current generation
+	param_t param = param_handle(px4::params::CP_DIST);
+	const uint32_t generation = param_generation();
+
+	// WHEN: we set the parameter to its current value
+	float value = -1.f;
+	param_set(param, &value);
+
+	// THEN: nothing changed
+	EXPECT_FALSE(param_changed_since(param, generation));
+	EXPECT_EQ(generation, param_generation());
+
+	// WHEN: we change the parameter
+	value = 3.f;
+	param_set(param, &value);
+
+	// THEN: it changed since the generation, but not since the new one
+	EXPECT_TRUE(param_changed_since(param, generation));
+	EXPECT_FALSE(param_changed_since(param, param_generation()));
+	EXPECT_FALSE(param_changed_since(param_handle(px4::params::CP_DELAY), generation));
+
+	// WHEN: we reset the parameter
+	const uint32_t generation_set = param_generation();
+	param_reset(param);
+
+	// THEN: it changed again
+	EXPECT_TRUE(param_changed_since(param, generation_set));
+}
+
+
+TEST_F(ParameterTest, testModuleParamsUpdate)
+{
+	// GIVEN a module with parameters
+	ParameterTestModule module;
+	EXPECT_FLOAT_EQ(-1.f, module.getDist());
+
+	// WHEN: a parameter of the module changes
+	float value = 5.f;
+	param_set(param_handle(px4::params::CP_DIST), &value);
+	module.update();
+
+	// THEN: the module has the new value
+	EXPECT_FLOAT_EQ(5.f, module.getDist());
+
+	// WHEN: the value is modified locally and another parameter of the module changes
+	module.setDist(7.f);
+	value = 0.2f;
+	param_set(param_handle(px4::params::CP_DELAY), &value);
+	module.update();
+
+	// THEN: all parameters of the module are read again
+	EXPECT_FLOAT_EQ(5.f, module.getDist());
+
+	// WHEN: only a parameter not used by the module changes
+	module.setDist(7.f);
+	int32_t value_int = 1;
+	param_set(param_handle(px4::params::CP_GO_NO_DATA), &value_int);
+	module.update();
+
+	// THEN: the module's parameters are not read
+	EXPECT_FLOAT_EQ(7.f, module.getDist());
+}
@@ -782,6 +782,38 @@ int parameter_flashfs_read(flash_file_token_t token, uint8_t **buffer, size_t
 	return rv;
 }
 
+/****************************************************************************
+ * Name: parameter_flashfs_delete
+ *
+ * Description:
+ *   This function marks the entry of the file token erased
+ *
+ * Input Parameters:
+ *   token       - File Token File to delete
+ *
+ * Returned value:
+ *   On success 0 or a negative errno value,
+ *
+ ****************************************************************************/
+
+int parameter_flashfs_delete(flash_file_token_t token)
+{
+	int rv = -ENXIO;
+
+	if (sector_map) {
+
+		rv = -ENOENT;
+		flash_entry_header_t *pf = find_entry(token);
+
+		if (pf) {
+			rv = erase_entry(pf);
+			rv = rv < 0 ? rv : 0;
+		}
+	}
+
+	return rv;
+}
+
 /****************************************************************************
  * Name: parameter_flashfs_write
  *
@@ -839,7 +871,23 @@ parameter_flashfs_write(flash_file_token_t token, uint8_t *buffer, size_t buf_si
 
 			sector_descriptor_t *current_sector = check_free_space_in_sector(pf,
 							      total_size);
+			flash_entry_header_t *pfree = NULL;
 
+			if (current_sector == 0) {
+
+				/* The space after the entry may be used by entries of other tokens,
+				 * if so use any free space or else continue with the next sector */
+
+				pfree = next_entry(pf);
+
+				if (!blank_check(pfree, total_size)) {
+					pfree = find_free(total_size);
+
+					if (pfree == NULL) {
+						current_sector = get_sector_info(pf);
+					}
+				}
+			}
 
 			if (current_sector == 0) {
 
@@ -857,7 +905,7 @@ parameter_flashfs_write(flash_file_token_t token, uint8_t *buffer, size_t buf_si
 
 				/* We had space and marked the last entry erased so use the  Next Free */
 
-				pf = next_entry(pf);
+				pf = pfree;
 
 			} else {
 
@@ -156,6 +156,22 @@ __EXPORT int parameter_flashfs_init(sector_descriptor_t *fconfig, uint8_t *buffe
 
 __EXPORT int parameter_flashfs_read(flash_file_token_t ft, uint8_t **buffer, size_t *buf_size);
 
+/****************************************************************************
+ * Name: parameter_flashfs_delete
+ *
+ * Description:
+ *   This function marks the entry of the file token erased
+ *
+ * Input Parameters:
+ *   token       - File Token File to delete
+ *
+ * Returned value:
+ *   On success 0 or a negative errno value,
+ *
+ ****************************************************************************/
+
+__EXPORT int parameter_flashfs_delete(flash_file_token_t ft);
+
 /****************************************************************************
  * Name: parameter_flashfs_write
  *
@@ -40,8 +40,14 @@
  * parameter system but replace the IO with non file based flash
  * i/o routines. So that the code my be implemented on a SMALL memory
  * foot print device.
+ *
+ * With CONFIG_PARAM_FLASH_DELTA_LOG the 'parm' entry holds a snapshot of all
+ * changed parameters, and each save appends an entry with only the parameters
+ * that differ from the snapshot and the previous deltas. Once the log is full
+ * (or out of flash space) a new snapshot is written and the deltas are deleted.
  */
 
+#include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/posix.h>
@@ -53,6 +59,7 @@
 #include <stdint.h>
 #include <errno.h>
 
+#include <containers/Bitset.hpp>
 #include <parameters/param.h>
 
 #include <lib/tinybson/tinybson.h>
@@ -75,6 +82,108 @@ struct param_wbuf_s {
 	param_t                 param;
 };
 
+#if defined(CONFIG_PARAM_FLASH_DELTA_LOG)
+static constexpr char delta_epoch_name[] = "_DELTA_EPOCH"; ///< snapshot node with the epoch of its deltas
+static constexpr uint8_t delta_max_count = 64;
+
+static uint8_t delta_epoch{0};    ///< epoch of the snapshot in flash, part of the delta tokens
+static uint8_t delta_count{0};    ///< number of deltas following the snapshot
+static bool delta_valid{false};   ///< snapshot and deltas in flash are known (after import or save)
+
+// flash state of each parameter (snapshot + deltas) used to build a delta, protected by the caller's lock
+static px4::Bitset<ParamLayer::PARAM_COUNT> delta_stored;
+static px4::Bitset<ParamLayer::PARAM_COUNT> delta_stored_current;
+
+static flash_file_token_t delta_token(uint8_t epoch, uint8_t index)
+{
+	flash_file_token_t token;
+	token.n[0] = 'p';
+	token.n[1] = 'd';
+	token.n[2] = epoch;
+	token.n[3] = index;
+	return token;
+}
+#endif // CONFIG_PARAM_FLASH_DELTA_LOG
+
+static int
+param_encode(bson_encoder_t encoder, param_t param)
+{
+	/* append the appropriate BSON type object */
+
+	switch (param_type(param)) {
+	case PARAM_TYPE_INT32:
+		if (bson_encoder_append_int32(encoder, param_name(param), user_config.get(param).i)) {
+			debug("BSON append failed for '%s'", param_name(param));
+			return -1;
+		}
+
+		return 0;
+
+	case PARAM_TYPE_FLOAT:
+		if (bson_encoder_append_double(encoder, param_name(param), (double)user_config.get(param).f)) {
+			debug("BSON append failed for '%s'", param_name(param));
+			return -1;
+		}
+
+		return 0;
+
+	default:
+		debug("unrecognized parameter type");
+		return -1;
+	}
+}
+
+/**
+ * Finalize the encoding and write it to the flash entry of token (unless it is unchanged).
+ * The encoder buffer is freed in any case.
+ */
+static int
+param_write_entry(flash_file_token_t token, bson_encoder_t encoder, int result)
+{
+	if (result == 0) {
+
+		/* Finalize the bison encoding*/
+
+		bson_encoder_fini(encoder);
+
+		/* Get requiered space */
+
+		size_t buf_size = bson_encoder_buf_size(encoder);
+
+		/* Get a buffer from the flash driver with enough space */
+
+		uint8_t *buffer;
+		result = parameter_flashfs_alloc(token, &buffer, &buf_size);
+
+		if (result == OK) {
+
+			/* Check for a write that has no changes */
+
+			uint8_t *was_buffer;
+			size_t was_buf_size;
+			int was_result = parameter_flashfs_read(token, &was_buffer, &was_buf_size);
+
+			void *enc_buff = bson_encoder_buf_data(encoder);
+
+			bool commit = was_result < OK || was_buf_size != buf_size || 0 != memcmp(was_buffer, enc_buff, was_buf_size);
+
+			if (commit) {
+
+				memcpy(buffer, enc_buff, buf_size);
+				result = parameter_flashfs_write(token, buffer, buf_size);
+				result = result == buf_size ? OK : (result < 0 ? result : -EFBIG);
+
+			}
+
+			parameter_flashfs_free();
+		}
+	}
+
+	free(bson_encoder_buf_data(encoder));
+
+	return result;
+}
+
 static int
 param_export_internal(param_filter_func filter)
 {
@@ -86,91 +195,185 @@ param_export_internal(param_filter_func filter)
 	bson_encoder_init_buf(&encoder, nullptr, 0);
 	auto changed_params = user_config.containedAsBitset();
 
+#if defined(CONFIG_PARAM_FLASH_DELTA_LOG)
+	/* Start a new epoch if deltas were written, so that they don't apply to the new snapshot */
+	const uint8_t epoch = (delta_count > 0) ? delta_epoch + 1 : delta_epoch;
+
+	if (bson_encoder_append_int32(&encoder, delta_epoch_name, epoch)) {
+		goto out;
+	}
+
+#endif // CONFIG_PARAM_FLASH_DELTA_LOG
+
 	for (param_t param = 0; param < user_config.PARAM_COUNT; param++) {
 
 		if (!changed_params[param] || (filter && !filter(param))) {
 			continue;
 		}
 
-		int32_t i;
-		float   f;
+		if (param_encode(&encoder, param)) {
+			goto out;
+		}
+	}
+
+	result = 0;
 
-		/* append the appropriate BSON type object */
+out:
+	result = param_write_entry(parameters_token, &encoder, result);
 
-		switch (param_type(param)) {
-		case PARAM_TYPE_INT32:
-			i = user_config.get(param).i;
+#if defined(CONFIG_PARAM_FLASH_DELTA_LOG)
 
-			if (bson_encoder_append_int32(&encoder, param_name(param), i)) {
-				debug("BSON append failed for '%s'", param_name(s->param));
-				goto out;
-			}
+	if (result == OK) {
+		/* The deltas of the previous epoch are obsolete */
+		for (uint8_t index = 0; index < delta_count; index++) {
+			parameter_flashfs_delete(delta_token(delta_epoch, index));
+		}
 
-			break;
+		delta_epoch = epoch;
+		delta_count = 0;
+		delta_valid = (filter == nullptr);
+	}
 
-		case PARAM_TYPE_FLOAT:
-			f = user_config.get(param).f;
+#endif // CONFIG_PARAM_FLASH_DELTA_LOG
 
-			if (bson_encoder_append_double(&encoder, param_name(param), (double)f)) {
-				debug("BSON append failed for '%s'", param_name(s->param));
-				goto out;
-			}
+	return result;
+}
 
-			break;
+#if defined(CONFIG_PARAM_FLASH_DELTA_LOG)
+static int
+param_stored_callback(bson_decoder_t decoder, bson_node_t node)
+{
+	if (node->type == BSON_EOO) {
+		return 0;
+	}
 
-		default:
-			debug("unrecognized parameter type");
-			goto out;
+	if (param_modify_on_import(node) == param_modify_on_import_ret::PARAM_SKIP_IMPORT) {
+		return 1;
+	}
+
+	param_t param = param_find_no_notification(node->name);
+
+	if (param == PARAM_INVALID) {
+		return 1;
+	}
+
+	/* the last node of a parameter defines its stored state */
+
+	const param_value_u value = user_config.get(param);
+	bool current = false;
+
+	switch (node->type) {
+	case BSON_INT32:
+		current = (param_type(param) == PARAM_TYPE_INT32) && (node->i32 == value.i);
+		break;
+
+	case BSON_DOUBLE: {
+			/* compare the bits, as the value is stored as double but applied as float */
+			const float stored = (float)node->d;
+			current = (param_type(param) == PARAM_TYPE_FLOAT) && (memcmp(&stored, &value.f, sizeof(stored)) == 0);
 		}
+		break;
+
+	case BSON_BOOL:
+		/* reset to the default */
+		delta_stored.set(param, false);
+		return 1;
+
+	default:
+		break;
 	}
 
-	result = 0;
+	delta_stored.set(param, true);
+	delta_stored_current.set(param, current);
+	return 1;
+}
 
-out:
+static int
+param_decode_entry(flash_file_token_t token, bson_decoder_callback callback)
+{
+	bson_decoder_s decoder{};
+	uint8_t *buffer = nullptr;
+	size_t buf_size;
+	int result = parameter_flashfs_read(token, &buffer, &buf_size);
 
-	if (result == 0) {
+	if (result < 0) {
+		return result;
+	}
 
-		/* Finalize the bison encoding*/
+	if (bson_decoder_init_buf(&decoder, buffer, buf_size, callback)) {
+		debug("decoder init failed");
+		return -1;
+	}
 
-		bson_encoder_fini(&encoder);
+	do {
+		result = bson_decoder_next(&decoder);
 
-		/* Get requiered space */
+	} while (result > 0);
 
-		size_t buf_size = bson_encoder_buf_size(&encoder);
+	return result;
+}
 
-		/* Get a buffer from the flash driver with enough space */
+/**
+ * Append the parameters that differ from the flash state as a new delta.
+ * @return OK, or a negative value if a new snapshot needs to be written instead
+ */
+static int
+param_export_delta()
+{
+	if (!delta_valid || delta_count >= delta_max_count) {
+		return -ENOSPC;
+	}
 
-		uint8_t *buffer;
-		result = parameter_flashfs_alloc(parameters_token, &buffer, &buf_size);
+	/* get the stored state of each parameter */
 
-		if (result == OK) {
+	delta_stored.reset();
+	delta_stored_current.reset();
 
-			/* Check for a write that has no changes */
+	if (param_decode_entry(parameters_token, param_stored_callback) < 0) {
+		return -EINVAL;
+	}
 
-			uint8_t *was_buffer;
-			size_t was_buf_size;
-			int was_result = parameter_flashfs_read(parameters_token, &was_buffer, &was_buf_size);
+	for (uint8_t index = 0; index < delta_count; index++) {
+		if (param_decode_entry(delta_token(delta_epoch, index), param_stored_callback) < 0) {
+			return -EINVAL;
+		}
+	}
 
-			void *enc_buff = bson_encoder_buf_data(&encoder);
+	/* encode the changed parameters */
 
-			bool commit = was_result < OK || was_buf_size != buf_size || 0 != memcmp(was_buffer, enc_buff, was_buf_size);
+	bson_encoder_s encoder{};
+	int result = 0;
+	int count = 0;
 
-			if (commit) {
+	bson_encoder_init_buf(&encoder, nullptr, 0);
+	auto changed_params = user_config.containedAsBitset();
 
-				memcpy(buffer, enc_buff, buf_size);
-				result = parameter_flashfs_write(parameters_token, buffer, buf_size);
-				result = result == buf_size ? OK : -EFBIG;
+	for (param_t param = 0; param < user_config.PARAM_COUNT && result == 0; param++) {
 
-			}
+		if (changed_params[param] && !(delta_stored[param] && delta_stored_current[param])) {
+			result = param_encode(&encoder, param);
+			count++;
 
-			free(enc_buff);
-			parameter_flashfs_free();
+		} else if (!changed_params[param] && delta_stored[param]) {
+			result = bson_encoder_append_bool(&encoder, param_name(param), false);
+			count++;
 		}
 	}
 
+	if (result != 0 || count == 0) {
+		free(bson_encoder_buf_data(&encoder));
+		return result;
+	}
+
+	result = param_write_entry(delta_token(delta_epoch, delta_count), &encoder, result);
+
+	if (result == OK) {
+		delta_count++;
+	}
+
 	return result;
 }
-
+#endif // CONFIG_PARAM_FLASH_DELTA_LOG
 
 static int
 param_import_callback(bson_decoder_t decoder, bson_node_t node)
@@ -189,6 +392,15 @@ param_import_callback(bson_decoder_t decoder, bson_node_t node)
 		return 0;
 	}
 
+#if defined(CONFIG_PARAM_FLASH_DELTA_LOG)
+
+	if (node->type == BSON_INT32 && strcmp(node->name, delta_epoch_name) == 0) {
+		delta_epoch = node->i32;
+		return 1;
+	}
+
+#endif // CONFIG_PARAM_FLASH_DELTA_LOG
+
 	if (param_modify_on_import(node) == param_modify_on_import_ret::PARAM_SKIP_IMPORT) {
 		return 1;
 	}
@@ -231,6 +443,15 @@ param_import_callback(bson_decoder_t decoder, bson_node_t node)
 		v = &f;
 		break;
 
+#if defined(CONFIG_PARAM_FLASH_DELTA_LOG)
+
+	case BSON_BOOL:
+		/* a delta entry resetting the parameter to its default */
+		param_reset_no_notification(param);
+		result = 1;
+		goto out;
+#endif // CONFIG_PARAM_FLASH_DELTA_LOG
+
 	default:
 		PX4_ERR("%s unrecognised node type %d", node->name, node->type);
 		result = 1; // just skip this entry
@@ -252,6 +473,39 @@ out:
 static int
 param_import_internal()
 {
+#if defined(CONFIG_PARAM_FLASH_DELTA_LOG)
+	delta_epoch = 0;
+	delta_count = 0;
+	delta_valid = false;
+
+	int result = param_decode_entry(parameters_token, param_import_callback);
+
+	if (result < 0) {
+		debug("BSON error decoding parameters");
+		return result;
+	}
+
+	/* apply the deltas of the snapshot in order */
+
+	while (delta_count < delta_max_count) {
+		uint8_t *buffer;
+		size_t buf_size;
+
+		if (parameter_flashfs_read(delta_token(delta_epoch, delta_count), &buffer, &buf_size) < 0) {
+			break;
+		}
+
+		if (param_decode_entry(delta_token(delta_epoch, delta_count), param_import_callback) < 0) {
+			debug("BSON error decoding parameter delta %d", delta_count);
+			return -1;
+		}
+
+		delta_count++;
+	}
+
+	delta_valid = true;
+	return result;
+#else
 	bson_decoder_s decoder{};
 	int result = -1;
 
@@ -276,10 +530,20 @@ out:
 	}
 
 	return result;
+#endif // CONFIG_PARAM_FLASH_DELTA_LOG
 }
 
 int flash_param_save(param_filter_func filter)
 {
+#if defined(CONFIG_PARAM_FLASH_DELTA_LOG)
+
+	/* only append the changes, unless the log is full */
+	if (filter == nullptr && param_export_delta() == OK) {
+		return OK;
+	}
+
+#endif // CONFIG_PARAM_FLASH_DELTA_LOG
+
 	return param_export_internal(filter);
 }
 
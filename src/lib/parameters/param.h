@@ -189,6 +189,24 @@ __EXPORT bool		param_value_is_default(param_t param);
  */
 __EXPORT bool		param_value_unsaved(param_t param);
 
+/**
+ * Get the current parameter change generation.
+ *
+ * The generation is incremented whenever a parameter value changes.
+ *
+ * @return		The current generation.
+ */
+__EXPORT uint32_t	param_generation(void);
+
+/**
+ * Test whether a parameter's value has changed after a given generation.
+ *
+ * @param param		A handle returned by param_find or passed by param_foreach.
+ * @param generation	A generation previously returned by param_generation.
+ * @return		If true, the parameter's value changed after the generation was read.
+ */
+__EXPORT bool		param_changed_since(param_t param, uint32_t generation);
+
 /**
  * Obtain the type of a parameter.
  *
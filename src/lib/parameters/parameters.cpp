@@ -55,6 +55,7 @@
 #include <drivers/drv_hrt.h>
 #include <lib/perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/atomic.h>
 #include <px4_platform_common/atomic_bitset.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/posix.h>
@@ -100,6 +101,9 @@ static ParamAutosave *autosave_instance {nullptr};
 static px4::AtomicBitset<param_info_count> params_active;  // params found
 static px4::AtomicBitset<param_info_count> params_unsaved;
 
+static px4::atomic<uint32_t> params_generation{0};           // incremented on every value change
+static uint32_t params_changed_generation[param_info_count] {}; // generation of the last change per param
+
 static ConstLayer firmware_defaults;
 static DynamicSparseLayer runtime_defaults{&firmware_defaults};
 DynamicSparseLayer user_config{&runtime_defaults};
@@ -130,7 +134,7 @@ void
 param_init()
 {
 	param_export_perf = perf_alloc(PC_ELAPSED, "param: export");
-	param_find_perf = perf_alloc(PC_COUNT, "param: find");
+	param_find_perf = perf_alloc(PC_ELAPSED, "param: find");
 	param_get_perf = perf_alloc(PC_COUNT, "param: get");
 	param_set_perf = perf_alloc(PC_ELAPSED, "param: set");
 
@@ -179,10 +183,38 @@ param_notify_changes()
 #endif
 }
 
+#if !defined(CONSTRAINED_FLASH)
+// 32 bit FNV-1a hash of a parameter name (must match px_generate_params.py)
+static uint32_t param_name_hash(const char *name)
+{
+	uint32_t hash = 2166136261u;
+
+	for (; *name != '\0'; name++) {
+		hash ^= static_cast<uint8_t>(*name);
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+// hash for a given seed of the perfect hash (murmur3 finalizer, must match px_generate_params.py)
+static uint32_t param_hash_mix(uint32_t hash, uint32_t seed)
+{
+	hash ^= seed * 0x9e3779b9u;
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35u;
+	hash ^= hash >> 16;
+	return hash;
+}
+#endif // !CONSTRAINED_FLASH
+
 static param_t param_find_internal(const char *name, bool notification)
 {
-	perf_count(param_find_perf);
+	perf_begin(param_find_perf);
 
+#if defined(CONSTRAINED_FLASH)
 	param_t middle;
 	param_t front = 0;
 	param_t last = param_info_count;
@@ -198,6 +230,7 @@ static param_t param_find_internal(const char *name, bool notification)
 				param_set_used(middle);
 			}
 
+			perf_end(param_find_perf);
 			return middle;
 
 		} else if (middle == front) {
@@ -212,7 +245,28 @@ static param_t param_find_internal(const char *name, bool notification)
 		}
 	}
 
+#else
+	/* look up the only candidate in the perfect hash table generated with the parameters */
+	static constexpr size_t bucket_count = sizeof(px4::parameters_hash_displacement) / sizeof(uint16_t);
+	static constexpr size_t table_size = sizeof(px4::parameters_hash_table) / sizeof(uint16_t);
+
+	const uint32_t hash = param_name_hash(name);
+	const uint16_t seed = px4::parameters_hash_displacement[param_hash_mix(hash, 0) % bucket_count];
+	const param_t param = px4::parameters_hash_table[param_hash_mix(hash, seed) % table_size];
+
+	if (handle_in_range(param) && strcmp(name, param_name(param)) == 0) {
+		if (notification) {
+			param_set_used(param);
+		}
+
+		perf_end(param_find_perf);
+		return param;
+	}
+
+#endif // CONSTRAINED_FLASH
+
 	/* not found */
+	perf_end(param_find_perf);
 	return PARAM_INVALID;
 }
 
@@ -283,6 +337,24 @@ param_value_unsaved(param_t param)
 	return handle_in_range(param) ? params_unsaved[param] : false;
 }
 
+static void
+param_mark_changed(param_t param)
+{
+	params_changed_generation[param] = params_generation.fetch_add(1) + 1;
+}
+
+uint32_t
+param_generation()
+{
+	return params_generation.load();
+}
+
+bool
+param_changed_since(param_t param, uint32_t generation)
+{
+	return handle_in_range(param) ? (params_changed_generation[param] > generation) : false;
+}
+
 int
 param_get(param_t param, void *val)
 {
@@ -441,6 +513,11 @@ param_set_internal(param_t param, const void *val, bool mark_saved, bool notify_
 		params_unsaved.set(param, !mark_saved && param_changed);
 		result = PX4_OK;
 
+		// compare the raw value, as modules read values below the float notification threshold as well
+		if (user_config_value.i != new_value.i) {
+			param_mark_changed(param);
+		}
+
 	} else {
 		PX4_ERR("param_set failed to store param %s", param_name(param));
 		result = PX4_ERROR;
@@ -600,6 +677,11 @@ int param_set_default_value(param_t param, const void *val)
 	}
 
 
+	if (result == PX4_OK) {
+		// the effective value changes as well unless overridden by the user config
+		param_mark_changed(param);
+	}
+
 	if ((result == PX4_OK) && param_used(param)) {
 		// send notification if param is already in use
 		param_notify_changes();
@@ -619,6 +701,10 @@ static int param_reset_internal(param_t param, bool notify = true, bool autosave
 
 	if (handle_in_range(param)) {
 		user_config.reset(param);
+
+		if (param_found) {
+			param_mark_changed(param);
+		}
 	}
 
 	if (autosave) {
@@ -989,8 +1075,9 @@ static int param_verify(int fd)
 	}
 
 	bson_decoder_s decoder{};
+	uint8_t bson_buffer[256];
 
-	if (bson_decoder_init_file(&decoder, fd, param_verify_callback) == 0) {
+	if (bson_decoder_init_buf_file(&decoder, fd, &bson_buffer, sizeof(bson_buffer), param_verify_callback) == 0) {
 		int result = -1;
 
 		do {
@@ -1214,10 +1301,13 @@ param_import_internal(int fd)
 {
 	static constexpr int MAX_ATTEMPTS = 3;
 
+	// read in blocks of the SD card sector size instead of per node element
+	uint8_t bson_buffer[512];
+
 	for (int attempt = 1; attempt <= MAX_ATTEMPTS; attempt++) {
 		bson_decoder_s decoder{};
 
-		if (bson_decoder_init_file(&decoder, fd, param_import_callback) == 0) {
+		if (bson_decoder_init_buf_file(&decoder, fd, &bson_buffer, sizeof(bson_buffer), param_import_callback) == 0) {
 			int result = -1;
 
 			do {
@@ -1374,6 +1464,8 @@ void param_print_status()
 		 counts.set_value_request_sent, counts.set_value_response_received);
 	PX4_INFO("resets sent: %" PRIu32 ", set used requests received: %" PRIu32,
 		 counts.reset_sent, counts.set_used_received);
+	PX4_INFO("sync requests received: %" PRIu32 ", sync values sent: %" PRIu32,
+		 counts.sync_request_received, counts.sync_values_sent);
 #endif
 
 #if defined(CONFIG_PARAM_REMOTE)
@@ -1385,6 +1477,8 @@ void param_print_status()
 		 counts.set_value_request_sent, counts.set_value_response_received);
 	PX4_INFO("resets received: %" PRIu32 ", set used requests sent: %" PRIu32,
 		 counts.reset_received, counts.set_used_sent);
+	PX4_INFO("sync requests sent: %" PRIu32 ", sync values received: %" PRIu32,
+		 counts.sync_request_sent, counts.sync_values_received);
 #endif
 
 }
@@ -32,9 +32,11 @@
  ****************************************************************************/
 
 #include "parameters_primary.h"
+#include "parameters_sync.h"
 
 #include "uORB/uORBManager.hpp"
 
+#include <px4_platform_common/atomic.h>
 #include <px4_platform_common/log.h>
 #include <px4_platform_common/tasks.h>
 
@@ -43,6 +45,7 @@
 #include <uORB/topics/parameter_set_used_request.h>
 #include <uORB/topics/parameter_set_value_request.h>
 #include <uORB/topics/parameter_set_value_response.h>
+#include <uORB/topics/parameter_sync_values.h>
 
 // Debug flag
 static bool debug = false;
@@ -60,6 +63,85 @@ static orb_advert_t param_reset_req_h     = nullptr;
 
 static int param_set_rsp_fd = PX4_ERROR;
 
+// Until the remote requested a sync it gets all values at once, so there is no need
+// to wait for a response to each single change (e.g. during the import at boot)
+static px4::atomic_bool remote_synced{false};
+
+static void send_sync_values(orb_advert_t &values_h, parameter_sync_values_s &values)
+{
+	values.timestamp = hrt_absolute_time();
+
+	if (values_h == nullptr) {
+		values_h = orb_advertise(ORB_ID(parameter_sync_values), &values);
+
+	} else {
+		orb_publish(ORB_ID(parameter_sync_values), values_h, &values);
+	}
+
+	param_primary_counters.sync_values_sent += values.count;
+	values.count = 0;
+
+	// don't overrun the queue of the remote
+	px4_usleep(TIMEOUT_WAIT);
+}
+
+static void handle_sync_request(const parameter_sync_request_s &req, uint32_t table_hash, orb_advert_t &values_h)
+{
+	static bool values_sent = false;
+
+	parameter_sync_values_s values{};
+	values.request_timestamp = req.timestamp;
+
+	remote_synced.store(true);
+
+	if ((req.param_count != param_count()) || (req.table_hash != table_hash)) {
+		// fall back to the single value updates
+		PX4_ERR("Parameter table of the remote does not match, not syncing");
+
+	} else {
+		for (unsigned i = 0; i < req.group_count; i++) {
+			const unsigned group = req.group_first + i;
+
+			if (group >= param_sync_group_count() || param_sync_group_hash(group) == req.group_hash[i]) {
+				continue;
+			}
+
+			const unsigned first = group * parameter_sync_request_s::GROUP_SIZE;
+
+			for (unsigned p = first; p < first + parameter_sync_request_s::GROUP_SIZE && p < param_count(); p++) {
+				values.parameter_index[values.count] = p;
+				values.value[values.count] = param_sync_value(p);
+				values.count++;
+
+				if (values.count == sizeof(values.value) / sizeof(values.value[0])) {
+					send_sync_values(values_h, values);
+					values_sent = true;
+				}
+			}
+		}
+	}
+
+	if (req.last) {
+		values_sent = values_sent || values.count > 0;
+		values.done = true;
+		send_sync_values(values_h, values);
+
+		if (debug) {
+			PX4_INFO("Parameter sync done");
+		}
+
+		// remote modules get the update notification of the primary
+		if (values_sent) {
+			param_notify_changes();
+			values_sent = false;
+		}
+
+	} else if (values.count > 0) {
+		send_sync_values(values_h, values);
+		values_sent = true;
+	}
+}
+
 static int primary_sync_thread(int argc, char *argv[])
 {
 	// Need to wait until the uORB and muORB are ready
@@ -70,22 +152,28 @@ static int primary_sync_thread(int argc, char *argv[])
 	while (uORB::Manager::get_instance()->get_uorb_communicator() == nullptr) { px4_usleep(100); }
 
 	orb_advert_t _set_value_rsp_h = nullptr;
+	orb_advert_t _sync_values_h = nullptr;
 
 	int _set_used_req_fd  = orb_subscribe(ORB_ID(parameter_set_used_request));
 	int _set_value_req_fd = orb_subscribe(ORB_ID(parameter_primary_set_value_request));
+	int _sync_req_fd      = orb_subscribe(ORB_ID(parameter_sync_request));
 
 	struct parameter_set_used_request_s   _set_used_request;
 	struct parameter_set_value_request_s  _set_value_request;
 	struct parameter_set_value_response_s _set_value_response;
+	struct parameter_sync_request_s       _sync_request;
 
-	px4_pollfd_struct_t fds[2] = { { .fd = _set_used_req_fd,  .events = POLLIN },
-		{ .fd = _set_value_req_fd, .events = POLLIN }
+	px4_pollfd_struct_t fds[3] = { { .fd = _set_used_req_fd,  .events = POLLIN },
+		{ .fd = _set_value_req_fd, .events = POLLIN },
+		{ .fd = _sync_req_fd, .events = POLLIN }
 	};
 
+	const uint32_t table_hash = param_sync_table_hash();
+
 	PX4_INFO("Starting parameter primary sync thread");
 
 	while (true) {
-		px4_poll(fds, 2, 1000);
+		px4_poll(fds, 3, 1000);
 
 		if (fds[0].revents & POLLIN) {
 			bool updated = true;
@@ -150,6 +238,25 @@ static int primary_sync_thread(int argc, char *argv[])
 				(void) orb_check(_set_value_req_fd, &updated);
 			}
 		}
+
+		if (fds[2].revents & POLLIN) {
+			bool updated = true;
+
+			while (updated) {
+				orb_copy(ORB_ID(parameter_sync_request), _sync_req_fd, &_sync_request);
+
+				if (debug) {
+					PX4_INFO("Got parameter_sync_request for groups %d - %d", _sync_request.group_first,
+						 _sync_request.group_first + _sync_request.group_count - 1);
+				}
+
+				param_primary_counters.sync_request_received++;
+
+				handle_sync_request(_sync_request, table_hash, _sync_values_h);
+
+				(void) orb_check(_sync_req_fd, &updated);
+			}
+		}
 	}
 
 	return 0;
@@ -170,6 +277,10 @@ void param_primary_init()
 // void param_primary_set_value(param_t param, const void *val, bool from_file)
 void param_primary_set_value(param_t param, const void *val)
 {
+	if (!remote_synced.load()) {
+		return;
+	}
+
 	bool send_request = true;
 	struct parameter_set_value_request_s req;
 	req.timestamp = hrt_absolute_time();
@@ -42,6 +42,8 @@ struct param_primary_counters {
 	uint32_t set_value_request_sent;
 	uint32_t set_value_response_received;
 	uint32_t set_used_received;
+	uint32_t sync_request_received;
+	uint32_t sync_values_sent;
 };
 
 void param_primary_init();
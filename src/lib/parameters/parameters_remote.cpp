@@ -32,6 +32,7 @@
  ****************************************************************************/
 
 #include "parameters_remote.h"
+#include "parameters_sync.h"
 
 #include "uORB/uORBManager.hpp"
 
@@ -45,6 +46,9 @@
 #include <uORB/topics/parameter_set_used_request.h>
 #include <uORB/topics/parameter_set_value_request.h>
 #include <uORB/topics/parameter_set_value_response.h>
+#include <uORB/topics/parameter_sync_values.h>
+
+using namespace time_literals;
 
 // Debug flag
 static bool debug = false;
@@ -62,6 +66,38 @@ static int param_set_rsp_fd = PX4_ERROR;
 static px4_task_t sync_thread_tid;
 static const char *sync_thread_name = "param_remote_sync";
 
+static void send_sync_request(orb_advert_t &sync_req_h, uint32_t table_hash)
+{
+	// Send the hashes of all parameter groups, the primary answers with the values of the groups that differ
+	struct parameter_sync_request_s req{};
+	req.timestamp = hrt_absolute_time();
+	req.param_count = param_count();
+	req.table_hash = table_hash;
+
+	const unsigned group_count = param_sync_group_count();
+	const unsigned max_groups = sizeof(req.group_hash) / sizeof(req.group_hash[0]);
+
+	for (unsigned group_first = 0; group_first < group_count || group_first == 0; group_first += max_groups) {
+		req.group_first = group_first;
+		req.group_count = 0;
+
+		for (unsigned group = group_first; group < group_count && req.group_count < max_groups; group++) {
+			req.group_hash[req.group_count++] = param_sync_group_hash(group);
+		}
+
+		req.last = group_first + req.group_count >= group_count;
+
+		if (sync_req_h == nullptr) {
+			sync_req_h = orb_advertise(ORB_ID(parameter_sync_request), &req);
+
+		} else {
+			orb_publish(ORB_ID(parameter_sync_request), sync_req_h, &req);
+		}
+	}
+
+	param_remote_counters.sync_request_sent++;
+}
+
 static int remote_sync_thread(int argc, char *argv[])
 {
 	// This thread gets started by the remote side during PX4 initialization.
@@ -73,22 +109,36 @@ static int remote_sync_thread(int argc, char *argv[])
 	usleep(200000);
 
 	orb_advert_t _set_value_rsp_h = nullptr;
+	orb_advert_t _sync_req_h = nullptr;
 
 	int _reset_req_fd  = orb_subscribe(ORB_ID(parameter_reset_request));
 	int _set_value_req_fd = orb_subscribe(ORB_ID(parameter_remote_set_value_request));
+	int _sync_values_fd = orb_subscribe(ORB_ID(parameter_sync_values));
 
 	struct parameter_reset_request_s      _reset_request;
 	struct parameter_set_value_request_s  _set_value_request;
 	struct parameter_set_value_response_s _set_value_response;
+	struct parameter_sync_values_s        _sync_values;
 
-	px4_pollfd_struct_t fds[2] = { { .fd = _reset_req_fd,  .events = POLLIN },
-		{ .fd = _set_value_req_fd, .events = POLLIN }
+	px4_pollfd_struct_t fds[3] = { { .fd = _reset_req_fd,  .events = POLLIN },
+		{ .fd = _set_value_req_fd, .events = POLLIN },
+		{ .fd = _sync_values_fd, .events = POLLIN }
 	};
 
+	const uint32_t table_hash = param_sync_table_hash();
+	bool synced = false;
+	hrt_abstime sync_request_time = 0;
+
 	PX4_INFO("Starting parameter remote sync thread");
 
 	while (true) {
-		px4_poll(fds, 2, 1000);
+		// Request a bulk sync until the primary answered
+		if (!synced && hrt_elapsed_time(&sync_request_time) > 1_s) {
+			send_sync_request(_sync_req_h, table_hash);
+			sync_request_time = hrt_absolute_time();
+		}
+
+		px4_poll(fds, 3, 1000);
 
 		if (fds[0].revents & POLLIN) {
 			bool updated = true;
@@ -164,6 +214,33 @@ static int remote_sync_thread(int argc, char *argv[])
 				(void) orb_check(_set_value_req_fd, &updated);
 			}
 		}
+
+		if (fds[2].revents & POLLIN) {
+			bool updated = true;
+
+			while (updated) {
+				orb_copy(ORB_ID(parameter_sync_values), _sync_values_fd, &_sync_values);
+
+				if (debug) {
+					PX4_INFO("Got %d parameter_sync_values for request %" PRIu64, _sync_values.count,
+						 _sync_values.request_timestamp);
+				}
+
+				param_remote_counters.sync_values_received += _sync_values.count;
+
+				for (unsigned i = 0; i < _sync_values.count; i++) {
+					// the value is raw and picked up according to the type of the parameter
+					param_set_no_remote_update(_sync_values.parameter_index[i], (const void *) &_sync_values.value[i], false);
+				}
+
+				if (_sync_values.done && !synced) {
+					PX4_INFO("Parameters synced with primary");
+					synced = true;
+				}
+
+				(void) orb_check(_sync_values_fd, &updated);
+			}
+		}
 	}
 
 	return 0;
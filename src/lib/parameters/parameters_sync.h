@@ -0,0 +1,122 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file parameters_sync.h
+ *
+ * Helpers for the bulk parameter sync between the primary and the remote.
+ * Both sides hash their values in groups of consecutive parameters, and only
+ * the groups that differ are transferred.
+ */
+
+#pragma once
+
+#include "param.h"
+
+#include <string.h>
+
+#include <uORB/topics/parameter_sync_request.h>
+
+static constexpr uint32_t param_sync_hash_init = 2166136261u;
+
+static inline uint32_t param_sync_hash(uint32_t hash, uint32_t value)
+{
+	// FNV-1a
+	for (int i = 0; i < 4; i++) {
+		hash = (hash ^ ((value >> (i * 8)) & 0xff)) * 16777619u;
+	}
+
+	return hash;
+}
+
+/**
+ * Raw value of a parameter (int32 or float bits).
+ */
+static inline uint32_t param_sync_value(param_t param)
+{
+	uint32_t value = 0;
+
+	if (param_type(param) == PARAM_TYPE_FLOAT) {
+		float f = 0.f;
+		param_get(param, &f);
+		memcpy(&value, &f, sizeof(value));
+
+	} else {
+		int32_t i = 0;
+		param_get(param, &i);
+		memcpy(&value, &i, sizeof(value));
+	}
+
+	return value;
+}
+
+static inline unsigned param_sync_group_count()
+{
+	return (param_count() + parameter_sync_request_s::GROUP_SIZE - 1) / parameter_sync_request_s::GROUP_SIZE;
+}
+
+/**
+ * Hash of all parameter names, to make sure both sides share the same parameter table.
+ */
+static inline uint32_t param_sync_table_hash()
+{
+	uint32_t hash = param_sync_hash_init;
+
+	for (unsigned i = 0; i < param_count(); i++) {
+		for (const char *name = param_name(i); *name != '\0'; name++) {
+			hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;
+		}
+
+		hash = param_sync_hash(hash, param_type(i));
+	}
+
+	return hash;
+}
+
+static inline uint32_t param_sync_group_hash(unsigned group)
+{
+	const unsigned first = group * parameter_sync_request_s::GROUP_SIZE;
+	unsigned last = first + parameter_sync_request_s::GROUP_SIZE;
+
+	if (last > param_count()) {
+		last = param_count();
+	}
+
+	uint32_t hash = param_sync_hash_init;
+
+	for (unsigned i = first; i < last; i++) {
+		hash = param_sync_hash(hash, param_sync_value(i));
+	}
+
+	return hash;
+}
@@ -19,6 +19,70 @@ except ImportError as e:
 
 import os
 
+def param_name_hash(name):
+    """
+    32 bit FNV-1a hash of a parameter name.
+    Must match param_name_hash() in parameters.cpp.
+    """
+    h = 2166136261
+    for c in name.encode():
+        h ^= c
+        h = (h * 16777619) & 0xffffffff
+    return h
+
+def param_hash_mix(h, seed):
+    """
+    Hash of a parameter name hash for a given seed (murmur3 finalizer).
+    Must match param_hash_mix() in parameters.cpp.
+    """
+    h = (h ^ (seed * 0x9e3779b9)) & 0xffffffff
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & 0xffffffff
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & 0xffffffff
+    h ^= h >> 16
+    return h
+
+def generate_perfect_hash(names, bucket_size=4):
+    """
+    Generate a minimal perfect hash over the parameter names (hash and displace).
+
+    Every name is first assigned to a bucket with seed 0. Then for each bucket (largest first)
+    a seed is searched that maps all of its names to free slots of a table with one slot per name.
+
+    @return: (per bucket seed list, per slot parameter index list)
+    """
+    count = len(names)
+    bucket_count = max((count + bucket_size - 1) // bucket_size, 1)
+    table_size = max(count, 1) # 1 unused slot (0xffff) without parameters
+
+    hashes = [param_name_hash(name) for name in names]
+
+    buckets = [[] for _ in range(bucket_count)]
+    for index, h in enumerate(hashes):
+        buckets[param_hash_mix(h, 0) % bucket_count].append(index)
+
+    displacement = [0] * bucket_count
+    table = [0xffff] * table_size
+
+    for bucket in sorted(range(bucket_count), key=lambda b: len(buckets[b]), reverse=True):
+        if not buckets[bucket]:
+            break
+
+        for seed in range(1, 0x10000):
+            slots = [param_hash_mix(hashes[index], seed) % table_size for index in buckets[bucket]]
+
+            if len(set(slots)) == len(slots) and all(table[slot] == 0xffff for slot in slots):
+                break
+        else:
+            raise Exception("no perfect hash found for parameter bucket %i" % bucket)
+
+        displacement[bucket] = seed
+        for slot, index in zip(slots, buckets[bucket]):
+            table[slot] = index
+
+    return displacement, table
+
 def generate(xml_file, dest='.'):
     """
     Generate px4 param source from xml.
@@ -39,6 +103,8 @@ def generate(xml_file, dest='.'):
 
     params = sorted(params, key=lambda name: name.attrib["name"])
 
+    hash_displacement, hash_table = generate_perfect_hash([param.attrib["name"] for param in params])
+
     script_path = os.path.dirname(os.path.realpath(__file__))
 
     # for jinja docs see: http://jinja.pocoo.org/docs/2.9/api/
@@ -55,7 +121,9 @@ def generate(xml_file, dest='.'):
         template = env.get_template(template_file)
         with open(os.path.join(
                 dest, template_file.replace('.jinja','')), 'w') as fid:
-            fid.write(template.render(params=params))
+            fid.write(template.render(params=params,
+                                      hash_displacement=hash_displacement,
+                                      hash_table=hash_table))
 
 if __name__ == "__main__":
     arg_parser = argparse.ArgumentParser()
@@ -95,6 +95,19 @@ param_value_unsaved(param_t param)
 	return data.ret;
 }
 
+uint32_t
+param_generation()
+{
+	// no change tracking across the kernel boundary, param_changed_since() always reports a change
+	return 0;
+}
+
+bool
+param_changed_since(param_t param, uint32_t generation)
+{
+	return true;
+}
+
 int
 param_get(param_t param, void *val)
 {
@@ -47,6 +47,24 @@
 #include <systemlib/err.h>
 
 #include "perf_counter.h"
+#include "perf_shard.h"
+
+#if defined(__PX4_NUTTX) && defined(CONFIG_PERF_DWT_CYCLE_COUNTER) && defined(CONFIG_BUILD_FLAT)
+# define PERF_ELAPSED_CYCLE_COUNTER
+# include <px4_platform/cycle_counter.h>
+
+// PC_ELAPSED min/max/total are kept in ns
+static constexpr uint32_t PERF_ELAPSED_UNITS_PER_US = 1000;
+# define PERF_ELAPSED_MIN_MAX_FMT "min %.3fus max %.3fus"
+# define PERF_ELAPSED_MIN_MAX(pce) (double)(pce)->time_least / PERF_ELAPSED_UNITS_PER_US, \
+	(double)(pce)->time_most / PERF_ELAPSED_UNITS_PER_US
+
+static uint32_t perf_ns_per_cycle_q16{0}; // ns per cycle in 16.16 fixed point
+#else
+static constexpr uint32_t PERF_ELAPSED_UNITS_PER_US = 1;
+# define PERF_ELAPSED_MIN_MAX_FMT "min %" PRIu32 "us max %" PRIu32 "us"
+# define PERF_ELAPSED_MIN_MAX(pce) (pce)->time_least, (pce)->time_most
+#endif
 
 /**
  * Header common to all counters.
@@ -60,14 +78,18 @@ struct perf_ctr_header {
 /**
  * PC_EVENT counter.
  */
-struct perf_ctr_count : public perf_ctr_header {
+struct alignas(PERF_SHARD_ALIGN) perf_count_shard {
 	uint64_t		event_count{0};
 };
 
+struct perf_ctr_count : public perf_ctr_header {
+	perf_count_shard	shards[PERF_SHARDS];
+};
+
 /**
  * PC_ELAPSED counter.
  */
-struct perf_ctr_elapsed : public perf_ctr_header {
+struct alignas(PERF_SHARD_ALIGN) perf_elapsed_shard {
 	uint64_t		event_count{0};
 	uint64_t		time_start{0};
 	uint64_t		time_total{0};
@@ -77,6 +99,10 @@ struct perf_ctr_elapsed : public perf_ctr_header {
 	float			M2{0.0f};
 };
 
+struct perf_ctr_elapsed : public perf_ctr_header {
+	perf_elapsed_shard	shards[PERF_SHARDS];
+};
+
 /**
  * PC_INTERVAL counter.
  */
@@ -91,6 +117,173 @@ struct perf_ctr_interval : public perf_ctr_header {
 	float			M2{0.0f};
 };
 
+/**
+ * PC_HISTOGRAM counter.
+ */
+struct alignas(PERF_SHARD_ALIGN) perf_histogram_shard {
+	uint64_t		event_count{0};
+	uint64_t		time_start{0};
+	uint64_t		time_total{0};
+	uint32_t		time_most{0};
+	uint32_t		buckets[PERF_HISTOGRAM_BUCKETS] {};
+};
+
+struct perf_ctr_histogram : public perf_ctr_header {
+	perf_histogram_shard	shards[PERF_SHARDS];
+};
+
+static uint64_t perf_count_merged(const perf_ctr_count *pcc)
+{
+	uint64_t event_count = 0;
+
+	for (unsigned i = 0; i < PERF_SHARDS; i++) {
+		event_count += pcc->shards[i].event_count;
+	}
+
+	return event_count;
+}
+
+/**
+ * Combine the shards of an elapsed counter (parallel variant of Welford's algorithm for mean and M2).
+ */
+static perf_elapsed_shard perf_elapsed_merged(const perf_ctr_elapsed *pce)
+{
+	if (PERF_SHARDS == 1) {
+		return pce->shards[0];
+	}
+
+	perf_elapsed_shard merged{};
+
+	for (unsigned i = 0; i < PERF_SHARDS; i++) {
+		const perf_elapsed_shard shard = pce->shards[i];
+
+		if (shard.event_count == 0) {
+			continue;
+		}
+
+		const uint64_t event_count = merged.event_count + shard.event_count;
+		const float delta = shard.mean - merged.mean;
+		const float weight = (float)shard.event_count / (float)event_count;
+
+		merged.M2 += shard.M2 + delta * delta * (float)merged.event_count * weight;
+		merged.mean += delta * weight;
+		merged.event_count = event_count;
+		merged.time_total += shard.time_total;
+
+		if ((merged.time_least > shard.time_least) || (merged.time_least == 0)) {
+			merged.time_least = shard.time_least;
+		}
+
+		if (merged.time_most < shard.time_most) {
+			merged.time_most = shard.time_most;
+		}
+	}
+
+	return merged;
+}
+
+/**
+ * @param elapsed elapsed time in PERF_ELAPSED_UNITS_PER_US
+ */
+static void perf_elapsed_add(perf_elapsed_shard *pce, uint64_t elapsed)
+{
+	pce->event_count++;
+	pce->time_total += elapsed;
+
+	if ((pce->time_least > (uint32_t)elapsed) || (pce->time_least == 0)) {
+		pce->time_least = elapsed;
+	}
+
+	if (pce->time_most < (uint32_t)elapsed) {
+		pce->time_most = elapsed;
+	}
+
+	// maintain mean and variance of the elapsed time in seconds
+	// Knuth/Welford recursive mean and variance of update intervals (via Wikipedia)
+	float dt = elapsed / (1e6f * PERF_ELAPSED_UNITS_PER_US);
+	float delta_intvl = dt - pce->mean;
+	pce->mean += delta_intvl / pce->event_count;
+	pce->M2 += delta_intvl * (dt - pce->mean);
+
+	pce->time_start = 0;
+}
+
+static perf_histogram_shard perf_histogram_merged(const perf_ctr_histogram *pch)
+{
+	if (PERF_SHARDS == 1) {
+		return pch->shards[0];
+	}
+
+	perf_histogram_shard merged{};
+
+	for (unsigned i = 0; i < PERF_SHARDS; i++) {
+		const perf_histogram_shard &shard = pch->shards[i];
+
+		merged.event_count += shard.event_count;
+		merged.time_total += shard.time_total;
+
+		if (merged.time_most < shard.time_most) {
+			merged.time_most = shard.time_most;
+		}
+
+		for (int bucket = 0; bucket < PERF_HISTOGRAM_BUCKETS; bucket++) {
+			merged.buckets[bucket] += shard.buckets[bucket];
+		}
+	}
+
+	return merged;
+}
+
+static inline int perf_histogram_bucket(uint32_t elapsed)
+{
+	if (elapsed < 2) {
+		return 0;
+	}
+
+	const int bucket = 31 - __builtin_clz(elapsed); // floor(log2(elapsed))
+	return (bucket < PERF_HISTOGRAM_BUCKETS) ? bucket : PERF_HISTOGRAM_BUCKETS - 1;
+}
+
+static inline uint32_t perf_histogram_bucket_lower_us(int bucket)
+{
+	return (bucket == 0) ? 0 : (1u << bucket);
+}
+
+static float perf_histogram_percentile(const perf_histogram_shard &pch, float percentile)
+{
+	if (pch.event_count == 0) {
+		return 0.f;
+	}
+
+	const float target = percentile * (float)pch.event_count;
+	uint64_t cumulative = 0;
+
+	for (int bucket = 0; bucket < PERF_HISTOGRAM_BUCKETS; bucket++) {
+		const uint32_t count = pch.buckets[bucket];
+
+		if (count == 0) {
+			continue;
+		}
+
+		if ((float)(cumulative + count) >= target) {
+			// interpolate linearly within the bucket, the last one is open ended
+			const float lower = perf_histogram_bucket_lower_us(bucket);
+			float upper = (bucket == PERF_HISTOGRAM_BUCKETS - 1) ? pch.time_most : (2u << bucket);
+
+			if (upper > pch.time_most) {
+				upper = pch.time_most;
+			}
+
+			const float fraction = (target - (float)cumulative) / (float)count;
+			return lower + (upper - lower) * fraction;
+		}
+
+		cumulative += count;
+	}
+
+	return pch.time_most;
+}
+
 /**
  * List of all known counters.
  */
@@ -120,12 +313,25 @@ perf_alloc(enum perf_counter_type type, const char *name)
 
 	case PC_ELAPSED:
 		ctr = new perf_ctr_elapsed();
+
+#if defined(PERF_ELAPSED_CYCLE_COUNTER)
+
+		if (perf_ns_per_cycle_q16 == 0) {
+			px4_arch_cycle_counter_init();
+			perf_ns_per_cycle_q16 = (uint32_t)((1000000000ull << 16) / px4_arch_cycle_counter_frequency());
+		}
+
+#endif // PERF_ELAPSED_CYCLE_COUNTER
 		break;
 
 	case PC_INTERVAL:
 		ctr = new perf_ctr_interval();
 		break;
 
+	case PC_HISTOGRAM:
+		ctr = new perf_ctr_histogram();
+		break;
+
 	default:
 		break;
 	}
@@ -194,6 +400,10 @@ perf_free(perf_counter_t handle)
 		delete (struct perf_ctr_interval *)handle;
 		break;
 
+	case PC_HISTOGRAM:
+		delete (struct perf_ctr_histogram *)handle;
+		break;
+
 	default:
 		break;
 	}
@@ -208,7 +418,7 @@ perf_count(perf_counter_t handle)
 
 	switch (handle->type) {
 	case PC_COUNT:
-		((struct perf_ctr_count *)handle)->event_count++;
+		((struct perf_ctr_count *)handle)->shards[perf_shard()].event_count++;
 		break;
 
 	case PC_INTERVAL:
@@ -229,7 +439,16 @@ perf_begin(perf_counter_t handle)
 
 	switch (handle->type) {
 	case PC_ELAPSED:
-		((struct perf_ctr_elapsed *)handle)->time_start = hrt_absolute_time();
+#if defined(PERF_ELAPSED_CYCLE_COUNTER)
+		// bit 32 marks a started event, the counter itself can be 0
+		((struct perf_ctr_elapsed *)handle)->shards[perf_shard()].time_start = (1ull << 32) | px4_arch_cycle_counter();
+#else
+		((struct perf_ctr_elapsed *)handle)->shards[perf_shard()].time_start = hrt_absolute_time();
+#endif // PERF_ELAPSED_CYCLE_COUNTER
+		break;
+
+	case PC_HISTOGRAM:
+		((struct perf_ctr_histogram *)handle)->shards[perf_shard()].time_start = hrt_absolute_time();
 		break;
 
 	default:
@@ -246,10 +465,24 @@ perf_end(perf_counter_t handle)
 
 	switch (handle->type) {
 	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
+			perf_elapsed_shard *pce = &((struct perf_ctr_elapsed *)handle)->shards[perf_shard()];
 
 			if (pce->time_start != 0) {
-				perf_set_elapsed(handle, hrt_elapsed_time(&pce->time_start));
+#if defined(PERF_ELAPSED_CYCLE_COUNTER)
+				const uint32_t cycles = px4_arch_cycle_counter() - (uint32_t)pce->time_start;
+				perf_elapsed_add(pce, ((uint64_t)cycles * perf_ns_per_cycle_q16) >> 16);
+#else
+				perf_elapsed_add(pce, hrt_elapsed_time(&pce->time_start));
+#endif // PERF_ELAPSED_CYCLE_COUNTER
+			}
+		}
+		break;
+
+	case PC_HISTOGRAM: {
+			perf_histogram_shard *pch = &((struct perf_ctr_histogram *)handle)->shards[perf_shard()];
+
+			if (pch->time_start != 0) {
+				perf_set_elapsed(handle, hrt_elapsed_time(&pch->time_start));
 			}
 		}
 		break;
@@ -267,29 +500,29 @@ perf_set_elapsed(perf_counter_t handle, int64_t elapsed)
 	}
 
 	switch (handle->type) {
-	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
+	case PC_ELAPSED:
+		if (elapsed >= 0) {
+			perf_elapsed_add(&((struct perf_ctr_elapsed *)handle)->shards[perf_shard()],
+					 (uint64_t)elapsed * PERF_ELAPSED_UNITS_PER_US);
+		}
+
+		break;
+
+	case PC_HISTOGRAM: {
+			perf_histogram_shard *pch = &((struct perf_ctr_histogram *)handle)->shards[perf_shard()];
 
 			if (elapsed >= 0) {
-				pce->event_count++;
-				pce->time_total += elapsed;
+				const uint32_t elapsed_us = (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
 
-				if ((pce->time_least > (uint32_t)elapsed) || (pce->time_least == 0)) {
-					pce->time_least = elapsed;
-				}
+				pch->event_count++;
+				pch->time_total += elapsed_us;
+				pch->buckets[perf_histogram_bucket(elapsed_us)]++;
 
-				if (pce->time_most < (uint32_t)elapsed) {
-					pce->time_most = elapsed;
+				if (pch->time_most < elapsed_us) {
+					pch->time_most = elapsed_us;
 				}
 
-				// maintain mean and variance of the elapsed time in seconds
-				// Knuth/Welford recursive mean and variance of update intervals (via Wikipedia)
-				float dt = elapsed / 1e6f;
-				float delta_intvl = dt - pce->mean;
-				pce->mean += delta_intvl / pce->event_count;
-				pce->M2 += delta_intvl * (dt - pce->mean);
-
-				pce->time_start = 0;
+				pch->time_start = 0;
 			}
 		}
 		break;
@@ -362,7 +595,11 @@ perf_set_count(perf_counter_t handle, uint64_t count)
 
 	switch (handle->type) {
 	case PC_COUNT: {
-			((struct perf_ctr_count *)handle)->event_count = count;
+			struct perf_ctr_count *pcc = (struct perf_ctr_count *)handle;
+
+			for (unsigned i = 0; i < PERF_SHARDS; i++) {
+				pcc->shards[i].event_count = (i == 0) ? count : 0;
+			}
 		}
 		break;
 
@@ -381,12 +618,14 @@ perf_cancel(perf_counter_t handle)
 
 	switch (handle->type) {
 	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
-
-			pce->time_start = 0;
+			((struct perf_ctr_elapsed *)handle)->shards[perf_shard()].time_start = 0;
 		}
 		break;
 
+	case PC_HISTOGRAM:
+		((struct perf_ctr_histogram *)handle)->shards[perf_shard()].time_start = 0;
+		break;
+
 	default:
 		break;
 	}
@@ -400,19 +639,30 @@ perf_reset(perf_counter_t handle)
 	}
 
 	switch (handle->type) {
-	case PC_COUNT:
-		((struct perf_ctr_count *)handle)->event_count = 0;
-		break;
+	case PC_COUNT: {
+			struct perf_ctr_count *pcc = (struct perf_ctr_count *)handle;
+
+			for (unsigned i = 0; i < PERF_SHARDS; i++) {
+				pcc->shards[i].event_count = 0;
+			}
+
+			break;
+		}
 
 	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
-			pce->event_count = 0;
-			pce->time_start = 0;
-			pce->time_total = 0;
-			pce->time_least = 0;
-			pce->time_most = 0;
-			pce->mean = 0.0f;
-			pce->M2 = 0.0f;
+			struct perf_ctr_elapsed *pce_ctr = (struct perf_ctr_elapsed *)handle;
+
+			for (unsigned i = 0; i < PERF_SHARDS; i++) {
+				perf_elapsed_shard *pce = &pce_ctr->shards[i];
+				pce->event_count = 0;
+				pce->time_start = 0;
+				pce->time_total = 0;
+				pce->time_least = 0;
+				pce->time_most = 0;
+				pce->mean = 0.0f;
+				pce->M2 = 0.0f;
+			}
+
 			break;
 		}
 
@@ -428,6 +678,16 @@ perf_reset(perf_counter_t handle)
 			pci->M2 = 0.0f;
 			break;
 		}
+
+	case PC_HISTOGRAM: {
+			struct perf_ctr_histogram *pch = (struct perf_ctr_histogram *)handle;
+
+			for (unsigned i = 0; i < PERF_SHARDS; i++) {
+				pch->shards[i] = perf_histogram_shard{};
+			}
+
+			break;
+		}
 	}
 }
 
@@ -442,20 +702,20 @@ perf_print_counter(perf_counter_t handle)
 	case PC_COUNT:
 		PX4_INFO_RAW("%s: %" PRIu64 " events\n",
 			     handle->name,
-			     ((struct perf_ctr_count *)handle)->event_count);
+			     perf_count_merged((struct perf_ctr_count *)handle));
 		break;
 
 	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
+			const perf_elapsed_shard merged = perf_elapsed_merged((struct perf_ctr_elapsed *)handle);
+			const perf_elapsed_shard *pce = &merged;
 			float rms = sqrtf(pce->M2 / (pce->event_count - 1));
-			PX4_INFO_RAW("%s: %" PRIu64 " events, %" PRIu64 "us elapsed, %.2fus avg, min %" PRIu32 "us max %" PRIu32
-				     "us %5.3fus rms\n",
+			PX4_INFO_RAW("%s: %" PRIu64 " events, %" PRIu64 "us elapsed, %.2fus avg, " PERF_ELAPSED_MIN_MAX_FMT
+				     " %5.3fus rms\n",
 				     handle->name,
 				     pce->event_count,
-				     pce->time_total,
-				     (pce->event_count == 0) ? 0 : (double)pce->time_total / (double)pce->event_count,
-				     pce->time_least,
-				     pce->time_most,
+				     pce->time_total / PERF_ELAPSED_UNITS_PER_US,
+				     (pce->event_count == 0) ? 0 : (double)pce->time_total / (double)pce->event_count / PERF_ELAPSED_UNITS_PER_US,
+				     PERF_ELAPSED_MIN_MAX(pce),
 				     (double)(1e6f * rms));
 			break;
 		}
@@ -474,6 +734,20 @@ perf_print_counter(perf_counter_t handle)
 			break;
 		}
 
+	case PC_HISTOGRAM: {
+			const perf_histogram_shard pch = perf_histogram_merged((struct perf_ctr_histogram *)handle);
+
+			PX4_INFO_RAW("%s: %" PRIu64 " events, %.2fus avg, p50 %.1fus p99 %.1fus p999 %.1fus max %" PRIu32 "us\n",
+				     handle->name,
+				     pch.event_count,
+				     (pch.event_count == 0) ? 0 : (double)pch.time_total / (double)pch.event_count,
+				     (double)perf_histogram_percentile(pch, 0.5f),
+				     (double)perf_histogram_percentile(pch, 0.99f),
+				     (double)perf_histogram_percentile(pch, 0.999f),
+				     pch.time_most);
+			break;
+		}
+
 	default:
 		break;
 	}
@@ -493,20 +767,20 @@ perf_print_counter_buffer(char *buffer, int length, perf_counter_t handle)
 	case PC_COUNT:
 		num_written = snprintf(buffer, length, "%s: %" PRIu64 " events",
 				       handle->name,
-				       ((struct perf_ctr_count *)handle)->event_count);
+				       perf_count_merged((struct perf_ctr_count *)handle));
 		break;
 
 	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
+			const perf_elapsed_shard merged = perf_elapsed_merged((struct perf_ctr_elapsed *)handle);
+			const perf_elapsed_shard *pce = &merged;
 			float rms = sqrtf(pce->M2 / (pce->event_count - 1));
 			num_written = snprintf(buffer, length,
-					       "%s: %" PRIu64 " events, %" PRIu64 "us elapsed, %.2fus avg, min %" PRIu32 "us max %" PRIu32 "us %5.3fus rms",
+					       "%s: %" PRIu64 " events, %" PRIu64 "us elapsed, %.2fus avg, " PERF_ELAPSED_MIN_MAX_FMT " %5.3fus rms",
 					       handle->name,
 					       pce->event_count,
-					       pce->time_total,
-					       (pce->event_count == 0) ? 0 : (double)pce->time_total / (double)pce->event_count,
-					       pce->time_least,
-					       pce->time_most,
+					       pce->time_total / PERF_ELAPSED_UNITS_PER_US,
+					       (pce->event_count == 0) ? 0 : (double)pce->time_total / (double)pce->event_count / PERF_ELAPSED_UNITS_PER_US,
+					       PERF_ELAPSED_MIN_MAX(pce),
 					       (double)(1e6f * rms));
 			break;
 		}
@@ -526,6 +800,21 @@ perf_print_counter_buffer(char *buffer, int length, perf_counter_t handle)
 			break;
 		}
 
+	case PC_HISTOGRAM: {
+			const perf_histogram_shard pch = perf_histogram_merged((struct perf_ctr_histogram *)handle);
+
+			num_written = snprintf(buffer, length,
+					       "%s: %" PRIu64 " events, %.2fus avg, p50 %.1fus p99 %.1fus p999 %.1fus max %" PRIu32 "us",
+					       handle->name,
+					       pch.event_count,
+					       (pch.event_count == 0) ? 0 : (double)pch.time_total / (double)pch.event_count,
+					       (double)perf_histogram_percentile(pch, 0.5f),
+					       (double)perf_histogram_percentile(pch, 0.99f),
+					       (double)perf_histogram_percentile(pch, 0.999f),
+					       pch.time_most);
+			break;
+		}
+
 	default:
 		break;
 	}
@@ -543,11 +832,17 @@ perf_event_count(perf_counter_t handle)
 
 	switch (handle->type) {
 	case PC_COUNT:
-		return ((struct perf_ctr_count *)handle)->event_count;
+		return perf_count_merged((struct perf_ctr_count *)handle);
 
 	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
-			return pce->event_count;
+			const struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
+			uint64_t event_count = 0;
+
+			for (unsigned i = 0; i < PERF_SHARDS; i++) {
+				event_count += pce->shards[i].event_count;
+			}
+
+			return event_count;
 		}
 
 	case PC_INTERVAL: {
@@ -555,6 +850,9 @@ perf_event_count(perf_counter_t handle)
 			return pci->event_count;
 		}
 
+	case PC_HISTOGRAM:
+		return perf_histogram_merged((struct perf_ctr_histogram *)handle).event_count;
+
 	default:
 		break;
 	}
@@ -570,16 +868,20 @@ perf_mean(perf_counter_t handle)
 	}
 
 	switch (handle->type) {
-	case PC_ELAPSED: {
-			struct perf_ctr_elapsed *pce = (struct perf_ctr_elapsed *)handle;
-			return pce->mean;
-		}
+	case PC_ELAPSED:
+		return perf_elapsed_merged((struct perf_ctr_elapsed *)handle).mean;
+
 
 	case PC_INTERVAL: {
 			struct perf_ctr_interval *pci = (struct perf_ctr_interval *)handle;
 			return pci->mean;
 		}
 
+	case PC_HISTOGRAM: {
+			const perf_histogram_shard pch = perf_histogram_merged((struct perf_ctr_histogram *)handle);
+			return (pch.event_count == 0) ? 0.f : (float)((double)pch.time_total / (double)pch.event_count / 1e6);
+		}
+
 	default:
 		break;
 	}
@@ -587,6 +889,55 @@ perf_mean(perf_counter_t handle)
 	return 0.0f;
 }
 
+void
+perf_get_stats(perf_counter_t handle, struct perf_counter_stats *stats)
+{
+	*stats = perf_counter_stats{};
+
+	if (handle == nullptr) {
+		return;
+	}
+
+	stats->type = handle->type;
+	stats->name = handle->name;
+
+	switch (handle->type) {
+	case PC_COUNT:
+		stats->event_count = perf_count_merged((struct perf_ctr_count *)handle);
+		break;
+
+	case PC_ELAPSED: {
+			const perf_elapsed_shard pce = perf_elapsed_merged((struct perf_ctr_elapsed *)handle);
+			stats->event_count = pce.event_count;
+			stats->elapsed_total_ns = pce.time_total * (1000 / PERF_ELAPSED_UNITS_PER_US);
+			stats->elapsed_max_ns = (uint64_t)pce.time_most * (1000 / PERF_ELAPSED_UNITS_PER_US);
+			break;
+		}
+
+	case PC_INTERVAL:
+		stats->event_count = ((struct perf_ctr_interval *)handle)->event_count;
+		break;
+
+	case PC_HISTOGRAM: {
+			const perf_histogram_shard pch = perf_histogram_merged((struct perf_ctr_histogram *)handle);
+			stats->event_count = pch.event_count;
+			stats->elapsed_total_ns = pch.time_total * 1000;
+			stats->elapsed_max_ns = (uint64_t)pch.time_most * 1000;
+			break;
+		}
+	}
+}
+
+float
+perf_percentile(perf_counter_t handle, float percentile)
+{
+	if (handle == nullptr || handle->type != PC_HISTOGRAM) {
+		return 0.f;
+	}
+
+	return perf_histogram_percentile(perf_histogram_merged((struct perf_ctr_histogram *)handle), percentile);
+}
+
 void
 perf_iterate_all(perf_callback cb, void *user)
 {
@@ -629,6 +980,37 @@ perf_print_latency(void)
 	// print the overflow bucket value
 	latency = get_latency(get_latency_bucket_count() - 1, get_latency_bucket_count());
 	PX4_INFO_RAW(" >%4" PRIu16 " : %" PRIu32 "\n", latency.bucket, latency.counter);
+
+	// histogram counters
+	pthread_mutex_lock(&perf_counters_mutex);
+	perf_counter_t handle = (perf_counter_t)sq_peek(&perf_counters);
+
+	while (handle != nullptr) {
+		if (handle->type == PC_HISTOGRAM) {
+			const perf_histogram_shard pch = perf_histogram_merged((struct perf_ctr_histogram *)handle);
+
+			PX4_INFO_RAW("\n");
+			perf_print_counter(handle);
+			PX4_INFO_RAW("bucket [us] : events\n");
+
+			for (int bucket = 0; bucket < PERF_HISTOGRAM_BUCKETS; bucket++) {
+				if (pch.buckets[bucket] == 0) {
+					continue;
+				}
+
+				if (bucket == PERF_HISTOGRAM_BUCKETS - 1) {
+					PX4_INFO_RAW(" >=%8" PRIu32 " : %" PRIu32 "\n", perf_histogram_bucket_lower_us(bucket), pch.buckets[bucket]);
+
+				} else {
+					PX4_INFO_RAW("   %8" PRIu32 " : %" PRIu32 "\n", perf_histogram_bucket_lower_us(bucket), pch.buckets[bucket]);
+				}
+			}
+		}
+
+		handle = (perf_counter_t)sq_next(&handle->link);
+	}
+
+	pthread_mutex_unlock(&perf_counters_mutex);
 }
 
 void
@@ -48,12 +48,30 @@
 enum perf_counter_type {
 	PC_COUNT,		/**< count the number of times an event occurs */
 	PC_ELAPSED,		/**< measure the time elapsed performing an event */
-	PC_INTERVAL		/**< measure the interval between instances of an event */
+	PC_INTERVAL,		/**< measure the interval between instances of an event */
+	PC_HISTOGRAM		/**< measure the distribution (log2 buckets) of the time elapsed performing an event */
 };
 
+/**
+ * Number of PC_HISTOGRAM buckets. Bucket 0 holds elapsed times < 2us, bucket i
+ * [2^i, 2^(i+1)) us and the last bucket everything above.
+ */
+#define PERF_HISTOGRAM_BUCKETS 24
+
 struct perf_ctr_header;
 typedef struct perf_ctr_header	*perf_counter_t;
 
+/**
+ * Accumulated values of a counter, see perf_get_stats().
+ */
+struct perf_counter_stats {
+	enum perf_counter_type	type;
+	const char		*name;
+	uint64_t		event_count;
+	uint64_t		elapsed_total_ns;	/**< PC_ELAPSED, PC_HISTOGRAM: sum of all elapsed times */
+	uint64_t		elapsed_max_ns;		/**< PC_ELAPSED, PC_HISTOGRAM: longest elapsed time */
+};
+
 __BEGIN_DECLS
 
 /**
@@ -97,7 +115,7 @@ __EXPORT extern void		perf_count(perf_counter_t handle);
 /**
  * Begin a performance event.
  *
- * This call applies to counters that operate over ranges of time; PC_ELAPSED etc.
+ * This call applies to counters that operate over ranges of time; PC_ELAPSED, PC_HISTOGRAM etc.
  *
  * @param handle		The handle returned from perf_alloc.
  */
@@ -205,7 +223,7 @@ typedef void (*perf_callback)(perf_counter_t handle, void *user);
 __EXPORT extern void	perf_iterate_all(perf_callback cb, void *user);
 
 /**
- * Print hrt latency counters.
+ * Print hrt latency counters and the buckets of all PC_HISTOGRAM counters.
  */
 __EXPORT extern void		perf_print_latency(void);
 
@@ -230,6 +248,26 @@ __EXPORT extern uint64_t	perf_event_count(perf_counter_t handle);
  */
 __EXPORT extern float		perf_mean(perf_counter_t handle);
 
+/**
+ * Get the accumulated values of a counter (e.g. to compute deltas)
+ *
+ * @param handle		The handle returned from perf_alloc.
+ * @param stats			filled in, zeroed for an invalid handle
+ */
+__EXPORT extern void		perf_get_stats(perf_counter_t handle, struct perf_counter_stats *stats);
+
+/**
+ * Return a percentile of a PC_HISTOGRAM counter
+ *
+ * The value is interpolated within its log2 bucket, so it is only accurate to
+ * the bucket resolution.
+ *
+ * @param handle		The handle returned from perf_alloc.
+ * @param percentile		percentile in [0, 1], e.g. 0.99
+ * @param return		elapsed time in us, or 0 if there are no events
+ */
+__EXPORT extern float		perf_percentile(perf_counter_t handle, float percentile);
+
 __END_DECLS
 
 #endif
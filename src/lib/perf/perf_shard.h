@@ -0,0 +1,68 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file perf_shard.h
+ *
+ * Per-thread shard selection shared by the perf counters and the trace buffer.
+ */
+
+#pragma once
+
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_config.h>
+
+#if defined(CONFIG_PERF_COUNTER_SHARDS) && (CONFIG_PERF_COUNTER_SHARDS > 1)
+# define PERF_COUNTER_SHARDED
+static constexpr unsigned PERF_SHARDS = CONFIG_PERF_COUNTER_SHARDS;
+static constexpr size_t PERF_SHARD_ALIGN = 64; // cache line
+#else
+static constexpr unsigned PERF_SHARDS = 1;
+static constexpr size_t PERF_SHARD_ALIGN = alignof(uint64_t);
+#endif
+
+/**
+ * Shard of the calling thread. Each thread sticks to one shard, so that updates
+ * of a counter from different threads (mostly) do not share a cache line and
+ * perf_begin()/perf_end() pairs stay consistent.
+ */
+static inline unsigned perf_shard()
+{
+#if defined(PERF_COUNTER_SHARDED)
+	static px4::atomic<unsigned> next_shard{0};
+	static thread_local unsigned shard = next_shard.fetch_add(1) % PERF_SHARDS;
+	return shard;
+#else
+	return 0;
+#endif
+}
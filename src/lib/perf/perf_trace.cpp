@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file perf_trace.cpp
+ *
+ * Trace event ring buffers, one per perf shard (thread group) on POSIX and a
+ * single one on NuttX.
+ */
+
+#include "perf_trace.h"
+
+#if defined(PERF_TRACE_ENABLED)
+
+#include "perf_shard.h"
+
+#include <drivers/drv_hrt.h>
+#include <px4_platform_common/log.h>
+#include <px4_platform_common/tasks.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+static constexpr uint32_t PERF_TRACE_EVENTS = CONFIG_PERF_TRACE_EVENTS;
+static_assert((PERF_TRACE_EVENTS & (PERF_TRACE_EVENTS - 1)) == 0, "CONFIG_PERF_TRACE_EVENTS must be a power of 2");
+
+struct perf_trace_record {
+	uint64_t	timestamp;
+	const char	*name;
+	uint32_t	sequence;	///< index + 1 once completely written, 0 while being written
+	uint16_t	thread;
+	char		type;
+};
+
+struct alignas(PERF_SHARD_ALIGN) perf_trace_ring {
+	px4::atomic<uint32_t>	head{0};
+	perf_trace_record	records[PERF_TRACE_EVENTS] {};
+};
+
+static perf_trace_ring perf_trace_rings[PERF_SHARDS];
+
+static constexpr int PERF_TRACE_THREAD_NAMES = 64;
+
+struct perf_trace_thread_name_t {
+	px4::atomic<const char *>	name{nullptr};
+	uint16_t			thread{0};
+};
+
+static perf_trace_thread_name_t perf_trace_thread_names[PERF_TRACE_THREAD_NAMES];
+static px4::atomic<int> perf_trace_thread_names_count{0};
+
+static inline uint16_t perf_trace_thread()
+{
+#if defined(__PX4_NUTTX)
+	return (uint16_t)getpid();
+#else
+	static px4::atomic<uint16_t> next_thread{1};
+	static thread_local uint16_t thread = next_thread.fetch_add(1);
+	return thread;
+#endif
+}
+
+void perf_trace_event(enum perf_trace_event_type type, const char *name)
+{
+	perf_trace_ring &ring = perf_trace_rings[perf_shard()];
+
+	// reserve a slot, the oldest event is overwritten
+	const uint32_t index = ring.head.fetch_add(1);
+	perf_trace_record &record = ring.records[index & (PERF_TRACE_EVENTS - 1)];
+
+	__atomic_store_n(&record.sequence, 0, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	record.timestamp = hrt_absolute_time();
+	record.name = name;
+	record.thread = perf_trace_thread();
+	record.type = (char)type;
+
+	__atomic_store_n(&record.sequence, index + 1, __ATOMIC_RELEASE);
+}
+
+void perf_trace_thread_name(const char *name)
+{
+	const int index = perf_trace_thread_names_count.fetch_add(1);
+
+	if (index < PERF_TRACE_THREAD_NAMES) {
+		perf_trace_thread_names[index].thread = perf_trace_thread();
+		perf_trace_thread_names[index].name.store(name);
+	}
+}
+
+int perf_trace_dump(const char *path)
+{
+	FILE *file = fopen(path, "w");
+
+	if (file == nullptr) {
+		return -errno;
+	}
+
+	fprintf(file, "# timestamp_us,type,thread,name\n");
+
+	int events = 0;
+
+	for (perf_trace_thread_name_t &thread_name : perf_trace_thread_names) {
+		const char *name = thread_name.name.load();
+
+		if (name != nullptr) {
+			fprintf(file, "0,%c,%" PRIu16 ",%s\n", PERF_TRACE_EVENT_METADATA, thread_name.thread, name);
+		}
+	}
+
+	for (perf_trace_ring &ring : perf_trace_rings) {
+		const uint32_t head = ring.head.load();
+		const uint32_t count = (head > PERF_TRACE_EVENTS) ? PERF_TRACE_EVENTS : head;
+
+		for (uint32_t index = head - count; index != head; index++) {
+			const perf_trace_record &source = ring.records[index & (PERF_TRACE_EVENTS - 1)];
+
+			// copy and only keep it if it was not (re-)written in the meantime
+			if (__atomic_load_n(&source.sequence, __ATOMIC_ACQUIRE) != index + 1) {
+				continue;
+			}
+
+			const perf_trace_record record = source;
+			__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+			if (__atomic_load_n(&source.sequence, __ATOMIC_RELAXED) != index + 1) {
+				continue;
+			}
+
+			fprintf(file, "%" PRIu64 ",%c,%" PRIu16 ",%s\n", record.timestamp, record.type, record.thread,
+				record.name ? record.name : "");
+			events++;
+		}
+	}
+
+	fclose(file);
+	return events;
+}
+
+void perf_trace_reset()
+{
+	for (perf_trace_ring &ring : perf_trace_rings) {
+		for (perf_trace_record &record : ring.records) {
+			__atomic_store_n(&record.sequence, 0, __ATOMIC_RELAXED);
+		}
+	}
+}
+
+#endif // PERF_TRACE_ENABLED
@@ -0,0 +1,110 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file perf_trace.h
+ *
+ * Lightweight event tracing into lock-free ring buffers.
+ *
+ * Events are begin/end pairs or instants, tagged with a timestamp, the thread
+ * and a name. The name must be a string with static lifetime (e.g. a module or
+ * topic name), only the pointer is stored.
+ * The buffers are written out with 'perf trace dump' and can be converted with
+ * Tools/perf_trace_to_chrome.py for chrome://tracing or Perfetto.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <px4_platform_common/defines.h>
+#include <px4_platform_common/px4_config.h>
+
+// in a protected build only the user side has the buffers
+#if defined(CONFIG_PERF_TRACE) && (!defined(__PX4_NUTTX) || defined(CONFIG_BUILD_FLAT) || !defined(__KERNEL__))
+# define PERF_TRACE_ENABLED 1
+#endif
+
+enum perf_trace_event_type {
+	PERF_TRACE_EVENT_BEGIN = 'B',
+	PERF_TRACE_EVENT_END = 'E',
+	PERF_TRACE_EVENT_INSTANT = 'i',
+	PERF_TRACE_EVENT_METADATA = 'M',
+};
+
+__BEGIN_DECLS
+
+#if defined(PERF_TRACE_ENABLED)
+
+/**
+ * Record an event. Safe to call from any thread and from interrupt context.
+ *
+ * @param type			event type
+ * @param name			event name (static lifetime)
+ */
+__EXPORT extern void		perf_trace_event(enum perf_trace_event_type type, const char *name);
+
+/**
+ * Name the calling thread in the trace (e.g. with the work queue name).
+ *
+ * @param name			thread name (static lifetime)
+ */
+__EXPORT extern void		perf_trace_thread_name(const char *name);
+
+/**
+ * Write all buffered events to a file as CSV (timestamp_us,type,thread,name).
+ * Thread names are written as 'M' events.
+ *
+ * @param path			file to write
+ * @return			number of events written, or negative errno
+ */
+__EXPORT extern int		perf_trace_dump(const char *path);
+
+/**
+ * Drop all buffered events.
+ */
+__EXPORT extern void		perf_trace_reset(void);
+
+static inline void perf_trace_begin(const char *name) { perf_trace_event(PERF_TRACE_EVENT_BEGIN, name); }
+static inline void perf_trace_end(const char *name) { perf_trace_event(PERF_TRACE_EVENT_END, name); }
+static inline void perf_trace_instant(const char *name) { perf_trace_event(PERF_TRACE_EVENT_INSTANT, name); }
+
+#else
+
+static inline void perf_trace_begin(const char *name) { (void)name; }
+static inline void perf_trace_end(const char *name) { (void)name; }
+static inline void perf_trace_instant(const char *name) { (void)name; }
+static inline void perf_trace_thread_name(const char *name) { (void)name; }
+
+#endif // PERF_TRACE_ENABLED
+
+__END_DECLS
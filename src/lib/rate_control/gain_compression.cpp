@@ -68,11 +68,20 @@ void GainCompression3d::update(const Vector3f &input, const float dt)
 
 	Vector3f hpf;
 	Vector3f lpf;
-	const float sample_freq = 1.f / math::constrain(dt, 1e-3f, 100e-3f);
+
+	// The filter coefficients only depend on the sample interval, compute them once for all axes:
+	// alpha_lpf = dt / (dt + tau_lpf), alpha_hpf = fs / (fs + 2 pi fc_hpf) = 1 / (1 + 2 pi fc_hpf dt)
+	const float sample_interval = math::constrain(dt, 1e-3f, 100e-3f);
+
+	if (sample_interval < 0.5f / _kLpfCutoffFrequency) {
+		// otherwise the LPF cutoff is above Nyquist, keep the previous coefficients (like AlphaFilter::setCutoffFreq())
+		_alpha_lpf = sample_interval / (sample_interval + _kLpfTimeConstant);
+	}
+
+	const float alpha_hpf = 1.f / (1.f + _kHpfCutoffOmega * sample_interval);
 
 	for (unsigned i = 0; i < 3; i++) {
-		_compression_gains[i].setLpfCutoffFrequency(sample_freq, _kLpfCutoffFrequency);
-		_compression_gains[i].setHpfCutoffFrequency(sample_freq, _kHpfCutoffFrequency);
+		_compression_gains[i].setFilterCoefficients(_alpha_lpf, alpha_hpf);
 
 		_gains(i) = _compression_gains[i].update(input(i), dt);
 
@@ -66,6 +66,11 @@ public:
 	}
 	void setHpfCutoffFrequency(float sample_freq, float cutoff) { _alpha_hpf = sample_freq / (sample_freq + 2.f * M_PI_F * cutoff); }
 
+	/**
+	 * Set precomputed filter coefficients, e.g. shared between axes running at the same rate
+	 */
+	void setFilterCoefficients(float alpha_lpf, float alpha_hpf) { _lpf.setAlpha(alpha_lpf); _alpha_hpf = alpha_hpf; }
+
 	float getSpectralDamperHpf() const { return _hpf * _hpf; }
 	float getSpectralDamperLpf() const { return _lpf.getState(); }
 	void setCompressionGainMin(float gain_min) { _compression_gain_min = gain_min; }
@@ -111,6 +116,10 @@ private:
 
 	static constexpr float _kLpfCutoffFrequency{5.f}; // Just above the control bandwidth of most UAVs
 	static constexpr float _kHpfCutoffFrequency{2.f * _kLpfCutoffFrequency}; // 1 Octave above LPF cutoff, as recommended by the reference paper
+	static constexpr float _kLpfTimeConstant{1.f / (2.f * M_PI_F * _kLpfCutoffFrequency)};
+	static constexpr float _kHpfCutoffOmega{2.f * M_PI_F * _kHpfCutoffFrequency};
+
+	float _alpha_lpf{0.f};
 
 	DEFINE_PARAMETERS(
 		(ParamBool<px4::params::FW_GC_EN>) _param_fw_gc_en,
@@ -123,6 +123,8 @@ public:
 private:
 	void updateIntegral(matrix::Vector3f &rate_error, const float dt);
 
+	static constexpr float I_FACTOR_RATE_INV{1.f / math::radians(400.f)}; ///< inverse of the rate error for the I term reduction
+
 	// Gains
 	matrix::Vector3f _gain_p; ///< rate control proportional gain for all axes x, y, z
 	matrix::Vector3f _gain_i; ///< rate control integral gain
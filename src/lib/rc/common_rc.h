@@ -27,3 +27,11 @@ extern rc_decode_buf_t rc_decode_buf;
 
 uint8_t crc8_dvb_s2(uint8_t crc, uint8_t a);
 uint8_t crc8_dvb_s2_buf(uint8_t *buf, int len);
+
+/**
+ * Unpack consecutive little-endian 11 bit values, as used by the SBUS and CRSF channel data.
+ * @param data packed data, at least (11 * num_values + 7) / 8 bytes
+ * @param values unpacked raw values
+ * @param num_values number of values to unpack
+ */
+void rc_unpack_11bit_channels(const uint8_t *data, uint16_t *values, unsigned num_values);
@@ -101,29 +101,6 @@ enum class crsf_address_t : uint8_t {
 	crsf_transmitter = 0xEE
 };
 
-#pragma pack(push, 1)
-struct crsf_payload_RC_channels_packed_t {
-	// 176 bits of data (11 bits per channel * 16 channels) = 22 bytes
-	unsigned chan0 : 11;
-	unsigned chan1 : 11;
-	unsigned chan2 : 11;
-	unsigned chan3 : 11;
-	unsigned chan4 : 11;
-	unsigned chan5 : 11;
-	unsigned chan6 : 11;
-	unsigned chan7 : 11;
-	unsigned chan8 : 11;
-	unsigned chan9 : 11;
-	unsigned chan10 : 11;
-	unsigned chan11 : 11;
-	unsigned chan12 : 11;
-	unsigned chan13 : 11;
-	unsigned chan14 : 11;
-	unsigned chan15 : 11;
-};
-
-#pragma pack(pop)
-
 enum class crsf_parser_state_t : uint8_t {
 	unsynced = 0,
 	synced
@@ -137,6 +114,8 @@ static crsf_parser_state_t parser_state = crsf_parser_state_t::unsynced;
  * parse the current crsf_frame buffer
  */
 static bool crsf_parse_buffer(uint16_t *values, uint16_t *num_values, uint16_t max_channels);
+static bool crsf_decode_frame(const crsf_frame_t &frame, uint16_t *values, uint16_t *num_values,
+			      uint16_t max_channels);
 
 uint8_t crsf_frame_CRC(const crsf_frame_t &frame);
 
@@ -167,6 +146,24 @@ bool crsf_parse(const uint64_t now, const uint8_t *frame, unsigned len, uint16_t
 	bool ret = false;
 	uint8_t *crsf_frame_ptr = (uint8_t *)&crsf_frame;
 
+	// A synced stream delivered in whole frames (UART idle-line or DMA framing) is decoded in place,
+	// only partial frames go through the frame buffer.
+	while (parser_state == crsf_parser_state_t::synced && current_frame_position == 0 && len >= 3) {
+		const crsf_frame_t *const whole_frame = (const crsf_frame_t *)frame;
+		const unsigned frame_length = whole_frame->header.length + sizeof(crsf_frame_header_t);
+
+		if (frame_length > sizeof(crsf_frame_t) || frame_length < 4 || frame_length > len) {
+			break;
+		}
+
+		if (crsf_decode_frame(*whole_frame, values, num_values, max_channels)) {
+			ret = true;
+		}
+
+		len -= frame_length;
+		frame += frame_length;
+	}
+
 	while (len > 0) {
 
 		// fill in the crsf_buffer, as much as we can
@@ -225,6 +222,39 @@ static uint16_t convert_channel_value(unsigned chan_value)
 	return (scale * chan_value) + offset;
 }
 
+static bool crsf_decode_frame(const crsf_frame_t &frame, uint16_t *values, uint16_t *num_values,
+			      uint16_t max_channels)
+{
+	if (frame.type == (uint8_t)crsf_frame_type_t::rc_channels_packed &&
+	    frame.header.length == (uint8_t)crsf_payload_size_t::rc_channels + 2) {
+		const uint8_t crc = frame.payload[frame.header.length - 2];
+
+		if (crc == crsf_frame_CRC(frame)) {
+			uint16_t raw_values[16];
+			rc_unpack_11bit_channels(frame.payload, raw_values, 16);
+			*num_values = MIN(max_channels, 16);
+
+			for (unsigned i = 0; i < *num_values; i++) {
+				values[i] = convert_channel_value(raw_values[i]);
+			}
+
+			CRSF_VERBOSE("Got Channels");
+
+			return true;
+
+		} else {
+			CRSF_DEBUG("CRC check failed");
+		}
+
+	} else {
+		CRSF_DEBUG("Got Non-RC frame (len=%i, type=%i)", frame.header.length + (int)sizeof(crsf_frame_header_t), frame.type);
+		// We could check the CRC here and reset the parser into unsynced state if it fails.
+		// But in practise it's robust even without that.
+	}
+
+	return false;
+}
+
 static bool crsf_parse_buffer(uint16_t *values, uint16_t *num_values, uint16_t max_channels)
 {
 	uint8_t *crsf_frame_ptr = (uint8_t *)&crsf_frame;
@@ -288,64 +318,9 @@ static bool crsf_parse_buffer(uint16_t *values, uint16_t *num_values, uint16_t m
 		return false;
 	}
 
-	bool ret = false;
-
 	// Now we have the full frame
 
-	if (crsf_frame.type == (uint8_t)crsf_frame_type_t::rc_channels_packed &&
-	    crsf_frame.header.length == (uint8_t)crsf_payload_size_t::rc_channels + 2) {
-		const uint8_t crc = crsf_frame.payload[crsf_frame.header.length - 2];
-
-		if (crc == crsf_frame_CRC(crsf_frame)) {
-			const crsf_payload_RC_channels_packed_t *const rc_channels =
-				(crsf_payload_RC_channels_packed_t *)&crsf_frame.payload;
-			*num_values = MIN(max_channels, 16);
-
-			if (max_channels > 0) { values[0] = convert_channel_value(rc_channels->chan0); }
-
-			if (max_channels > 1) { values[1] = convert_channel_value(rc_channels->chan1); }
-
-			if (max_channels > 2) { values[2] = convert_channel_value(rc_channels->chan2); }
-
-			if (max_channels > 3) { values[3] = convert_channel_value(rc_channels->chan3); }
-
-			if (max_channels > 4) { values[4] = convert_channel_value(rc_channels->chan4); }
-
-			if (max_channels > 5) { values[5] = convert_channel_value(rc_channels->chan5); }
-
-			if (max_channels > 6) { values[6] = convert_channel_value(rc_channels->chan6); }
-
-			if (max_channels > 7) { values[7] = convert_channel_value(rc_channels->chan7); }
-
-			if (max_channels > 8) { values[8] = convert_channel_value(rc_channels->chan8); }
-
-			if (max_channels > 9) { values[9] = convert_channel_value(rc_channels->chan9); }
-
-			if (max_channels > 10) { values[10] = convert_channel_value(rc_channels->chan10); }
-
-			if (max_channels > 11) { values[11] = convert_channel_value(rc_channels->chan11); }
-
-			if (max_channels > 12) { values[12] = convert_channel_value(rc_channels->chan12); }
-
-			if (max_channels > 13) { values[13] = convert_channel_value(rc_channels->chan13); }
-
-			if (max_channels > 14) { values[14] = convert_channel_value(rc_channels->chan14); }
-
-			if (max_channels > 15) { values[15] = convert_channel_value(rc_channels->chan15); }
-
-			CRSF_VERBOSE("Got Channels");
-
-			ret = true;
-
-		} else {
-			CRSF_DEBUG("CRC check failed");
-		}
-
-	} else {
-		CRSF_DEBUG("Got Non-RC frame (len=%i, type=%i)", current_frame_length, crsf_frame.type);
-		// We could check the CRC here and reset the parser into unsynced state if it fails.
-		// But in practise it's robust even without that.
-	}
+	const bool ret = crsf_decode_frame(crsf_frame, values, num_values, max_channels);
 
 	// Either reset or move the rest of the buffer
 	if (current_frame_position > current_frame_length) {
@@ -417,23 +392,23 @@ static inline void write_frame_crc(uint8_t *buf, int &offset, int buf_size)
 	//if (buf_size != offset) { PX4_ERR("frame size mismatch (%i != %i)", buf_size, offset); }
 }
 
-bool crsf_send_telemetry_battery(int uart_fd, uint16_t voltage, uint16_t current, int fuel, uint8_t remaining)
+int crsf_build_telemetry_battery(uint8_t *buf, uint16_t voltage, uint16_t current, int fuel, uint8_t remaining)
 {
-	uint8_t buf[(uint8_t)crsf_payload_size_t::battery_sensor + 4];
+	const int buf_size = (uint8_t)crsf_payload_size_t::battery_sensor + 4;
 	int offset = 0;
 	write_frame_header(buf, offset, crsf_frame_type_t::battery_sensor, (uint8_t)crsf_payload_size_t::battery_sensor);
 	write_uint16_t(buf, offset, voltage);
 	write_uint16_t(buf, offset, current);
 	write_uint24_t(buf, offset, fuel);
 	write_uint8_t(buf, offset, remaining);
-	write_frame_crc(buf, offset, sizeof(buf));
-	return write(uart_fd, buf, offset) == offset;
+	write_frame_crc(buf, offset, buf_size);
+	return offset;
 }
 
-bool crsf_send_telemetry_gps(int uart_fd, int32_t latitude, int32_t longitude, uint16_t groundspeed,
+int crsf_build_telemetry_gps(uint8_t *buf, int32_t latitude, int32_t longitude, uint16_t groundspeed,
 			     uint16_t gps_heading, uint16_t altitude, uint8_t num_satellites)
 {
-	uint8_t buf[(uint8_t)crsf_payload_size_t::gps + 4];
+	const int buf_size = (uint8_t)crsf_payload_size_t::gps + 4;
 	int offset = 0;
 	write_frame_header(buf, offset, crsf_frame_type_t::gps, (uint8_t)crsf_payload_size_t::gps);
 	write_int32_t(buf, offset, latitude);
@@ -442,37 +417,66 @@ bool crsf_send_telemetry_gps(int uart_fd, int32_t latitude, int32_t longitude, u
 	write_uint16_t(buf, offset, gps_heading);
 	write_uint16_t(buf, offset, altitude);
 	write_uint8_t(buf, offset, num_satellites);
-	write_frame_crc(buf, offset, sizeof(buf));
-	return write(uart_fd, buf, offset) == offset;
+	write_frame_crc(buf, offset, buf_size);
+	return offset;
 }
 
-bool crsf_send_telemetry_attitude(int uart_fd, int16_t pitch, int16_t roll, int16_t yaw)
+int crsf_build_telemetry_attitude(uint8_t *buf, int16_t pitch, int16_t roll, int16_t yaw)
 {
-	uint8_t buf[(uint8_t)crsf_payload_size_t::attitude + 4];
+	const int buf_size = (uint8_t)crsf_payload_size_t::attitude + 4;
 	int offset = 0;
 	write_frame_header(buf, offset, crsf_frame_type_t::attitude, (uint8_t)crsf_payload_size_t::attitude);
 	write_uint16_t(buf, offset, pitch);
 	write_uint16_t(buf, offset, roll);
 	write_uint16_t(buf, offset, yaw);
-	write_frame_crc(buf, offset, sizeof(buf));
-	return write(uart_fd, buf, offset) == offset;
+	write_frame_crc(buf, offset, buf_size);
+	return offset;
 }
 
-bool crsf_send_telemetry_flight_mode(int uart_fd, const char *flight_mode)
+int crsf_build_telemetry_flight_mode(uint8_t *buf, const char *flight_mode)
 {
-	const int max_length = 16;
+	const int max_length = CRSF_TELEMETRY_FRAME_SIZE_MAX - 4;
 	int length = strlen(flight_mode) + 1;
 
 	if (length > max_length) {
 		length = max_length;
 	}
 
-	uint8_t buf[max_length + 4];
 	int offset = 0;
 	write_frame_header(buf, offset, crsf_frame_type_t::flight_mode, length);
 	memcpy(buf + offset, flight_mode, length);
 	offset += length;
 	buf[offset - 1] = 0; // ensure null-terminated string
 	write_frame_crc(buf, offset, length + 4);
-	return write(uart_fd, buf, offset) == offset;
+	return offset;
+}
+
+bool crsf_send_telemetry_battery(int uart_fd, uint16_t voltage, uint16_t current, int fuel, uint8_t remaining)
+{
+	uint8_t buf[CRSF_TELEMETRY_FRAME_SIZE_MAX];
+	const int length = crsf_build_telemetry_battery(buf, voltage, current, fuel, remaining);
+	return write(uart_fd, buf, length) == length;
+}
+
+bool crsf_send_telemetry_gps(int uart_fd, int32_t latitude, int32_t longitude, uint16_t groundspeed,
+			     uint16_t gps_heading, uint16_t altitude, uint8_t num_satellites)
+{
+	uint8_t buf[CRSF_TELEMETRY_FRAME_SIZE_MAX];
+	const int length = crsf_build_telemetry_gps(buf, latitude, longitude, groundspeed, gps_heading, altitude,
+			   num_satellites);
+	return write(uart_fd, buf, length) == length;
+}
+
+bool crsf_send_telemetry_attitude(int uart_fd, int16_t pitch, int16_t roll, int16_t yaw)
+{
+	uint8_t buf[CRSF_TELEMETRY_FRAME_SIZE_MAX];
+	const int length = crsf_build_telemetry_attitude(buf, pitch, roll, yaw);
+	return write(uart_fd, buf, length) == length;
+}
+
+bool crsf_send_telemetry_flight_mode(int uart_fd, const char *flight_mode)
+{
+	uint8_t buf[CRSF_TELEMETRY_FRAME_SIZE_MAX];
+	const int length = crsf_build_telemetry_flight_mode(buf, flight_mode);
+	return write(uart_fd, buf, length) == length;
 }
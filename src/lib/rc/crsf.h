@@ -51,6 +51,7 @@ __BEGIN_DECLS
 
 #define CRSF_FRAME_SIZE_MAX 30 // the actual maximum length is 64, but we're only interested in RC channels and want to minimize buffer size
 #define CRSF_PAYLOAD_SIZE_MAX (CRSF_FRAME_SIZE_MAX-4)
+#define CRSF_TELEMETRY_FRAME_SIZE_MAX 20 // largest telemetry frame we send (flight mode)
 
 
 struct crsf_frame_header_t {
@@ -87,6 +88,43 @@ __EXPORT bool	crsf_parse(const uint64_t now, const uint8_t *frame, unsigned len,
 			   uint16_t *num_values, uint16_t max_channels);
 
 
+/**
+ * Build a telemetry battery frame
+ * @param buf frame buffer, at least CRSF_TELEMETRY_FRAME_SIZE_MAX bytes
+ * @param voltage Voltage [0.1V]
+ * @param current Current [0.1A]
+ * @param fuel drawn mAh
+ * @param remaining battery remaining [%]
+ * @return frame length
+ */
+__EXPORT int crsf_build_telemetry_battery(uint8_t *buf, uint16_t voltage, uint16_t current, int fuel,
+		uint8_t remaining);
+
+/**
+ * Build a telemetry GPS frame
+ * @param buf frame buffer, at least CRSF_TELEMETRY_FRAME_SIZE_MAX bytes
+ * @see crsf_send_telemetry_gps()
+ * @return frame length
+ */
+__EXPORT int crsf_build_telemetry_gps(uint8_t *buf, int32_t latitude, int32_t longitude, uint16_t groundspeed,
+				      uint16_t gps_heading, uint16_t altitude, uint8_t num_satellites);
+
+/**
+ * Build a telemetry Attitude frame
+ * @param buf frame buffer, at least CRSF_TELEMETRY_FRAME_SIZE_MAX bytes
+ * @see crsf_send_telemetry_attitude()
+ * @return frame length
+ */
+__EXPORT int crsf_build_telemetry_attitude(uint8_t *buf, int16_t pitch, int16_t roll, int16_t yaw);
+
+/**
+ * Build a telemetry Flight Mode frame
+ * @param buf frame buffer, at least CRSF_TELEMETRY_FRAME_SIZE_MAX bytes
+ * @param flight_mode Flight Mode string (max length = 15)
+ * @return frame length
+ */
+__EXPORT int crsf_build_telemetry_flight_mode(uint8_t *buf, const char *flight_mode);
+
 /**
  * Send telemetry battery information
  * @param uart_fd UART file descriptor
@@ -73,6 +73,8 @@
 #define GHST_ADDR_FC				(130U)
 #define GHST_MAX_NUM_CHANNELS			(16)
 
+static_assert(GHST_TELEMETRY_FRAME_SIZE == GHST_FRAME_PAYLOAD_SIZE_TELEMETRY + 4U, "address, frame length, type, crc");
+
 enum class ghst_parser_state_t : uint8_t {
 	unsynced = 0U,
 	synced
@@ -389,10 +391,9 @@ static inline void write_frame_crc(uint8_t *buf, int &offset, int buf_size)
 	write_uint8_t(buf, offset, crc8_dvb_s2_buf(buf + 2U, buf_size - 3));
 }
 
-bool ghst_send_telemetry_battery_status(int uart_fd, uint16_t voltage_in_10mV,
+int ghst_build_telemetry_battery_status(uint8_t *buf, uint16_t voltage_in_10mV,
 					uint16_t current_in_10mA, uint16_t fuel_in_10mAh)
 {
-	uint8_t buf[GHST_FRAME_PAYLOAD_SIZE_TELEMETRY + 4U]; // address, frame length, type, crc
 	int offset = 0;
 	write_frame_header(buf, offset, ghstTelemetryType::batteryPack, GHST_FRAME_PAYLOAD_SIZE_TELEMETRY);
 	write_uint16_t(buf, offset, voltage_in_10mV);
@@ -402,28 +403,26 @@ bool ghst_send_telemetry_battery_status(int uart_fd, uint16_t voltage_in_10mV,
 	write_uint8_t(buf, offset, 0x00U); // empty
 	write_uint8_t(buf, offset, 0x00U); // empty
 	write_uint8_t(buf, offset, 0x00U); // empty
-	write_frame_crc(buf, offset, sizeof(buf));
+	write_frame_crc(buf, offset, GHST_TELEMETRY_FRAME_SIZE);
 
-	return write(uart_fd, buf, offset) == offset;
+	return offset;
 }
 
-bool ghst_send_telemetry_gps1_status(int uart_fd, uint32_t latitude, uint32_t longitude, uint16_t altitude)
+int ghst_build_telemetry_gps1_status(uint8_t *buf, uint32_t latitude, uint32_t longitude, uint16_t altitude)
 {
-	uint8_t buf[GHST_FRAME_PAYLOAD_SIZE_TELEMETRY + 4U]; // address, frame length, type, crc
 	int offset = 0;
 	write_frame_header(buf, offset, ghstTelemetryType::gpsPrimary, GHST_FRAME_PAYLOAD_SIZE_TELEMETRY);
 	write_uint32_t(buf, offset, latitude);
 	write_uint32_t(buf, offset, longitude);
 	write_uint16_t(buf, offset, altitude);
-	write_frame_crc(buf, offset, sizeof(buf));
+	write_frame_crc(buf, offset, GHST_TELEMETRY_FRAME_SIZE);
 
-	return write(uart_fd, buf, offset) == offset;
+	return offset;
 }
 
-bool ghst_send_telemetry_gps2_status(int uart_fd, uint16_t ground_speed, uint16_t ground_course, uint8_t numSats,
+int ghst_build_telemetry_gps2_status(uint8_t *buf, uint16_t ground_speed, uint16_t ground_course, uint8_t numSats,
 				     uint16_t home_dist, uint16_t home_dir, uint8_t flags)
 {
-	uint8_t buf[GHST_FRAME_PAYLOAD_SIZE_TELEMETRY + 4U]; // address, frame length, type, crc
 	int offset = 0;
 	write_frame_header(buf, offset, ghstTelemetryType::gpsSecondary, GHST_FRAME_PAYLOAD_SIZE_TELEMETRY);
 	write_uint16_t(buf, offset, ground_speed);
@@ -432,7 +431,34 @@ bool ghst_send_telemetry_gps2_status(int uart_fd, uint16_t ground_speed, uint16_
 	write_uint16_t(buf, offset, home_dist);
 	write_uint16_t(buf, offset, home_dir);
 	write_uint8_t(buf, offset, flags);
-	write_frame_crc(buf, offset, sizeof(buf));
+	write_frame_crc(buf, offset, GHST_TELEMETRY_FRAME_SIZE);
+
+	return offset;
+}
+
+bool ghst_send_telemetry_battery_status(int uart_fd, uint16_t voltage_in_10mV,
+					uint16_t current_in_10mA, uint16_t fuel_in_10mAh)
+{
+	uint8_t buf[GHST_TELEMETRY_FRAME_SIZE];
+	const int length = ghst_build_telemetry_battery_status(buf, voltage_in_10mV, current_in_10mA, fuel_in_10mAh);
+
+	return write(uart_fd, buf, length) == length;
+}
+
+bool ghst_send_telemetry_gps1_status(int uart_fd, uint32_t latitude, uint32_t longitude, uint16_t altitude)
+{
+	uint8_t buf[GHST_TELEMETRY_FRAME_SIZE];
+	const int length = ghst_build_telemetry_gps1_status(buf, latitude, longitude, altitude);
+
+	return write(uart_fd, buf, length) == length;
+}
+
+bool ghst_send_telemetry_gps2_status(int uart_fd, uint16_t ground_speed, uint16_t ground_course, uint8_t numSats,
+				     uint16_t home_dist, uint16_t home_dir, uint8_t flags)
+{
+	uint8_t buf[GHST_TELEMETRY_FRAME_SIZE];
+	const int length = ghst_build_telemetry_gps2_status(buf, ground_speed, ground_course, numSats, home_dist, home_dir,
+			   flags);
 
-	return write(uart_fd, buf, offset) == offset;
+	return write(uart_fd, buf, length) == length;
 }
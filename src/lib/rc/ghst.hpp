@@ -49,6 +49,7 @@ __BEGIN_DECLS
 
 #define GHST_BAUDRATE		(420000u)
 #define GHST_PAYLOAD_MAX_SIZE	(14u)
+#define GHST_TELEMETRY_FRAME_SIZE	(14u)	// address, frame length, type, 10 bytes payload, crc
 
 enum class ghstAddress {
 	rxAddress = 0x89	// Rx address
@@ -137,6 +138,34 @@ __EXPORT bool ghst_parse(const uint64_t now, const uint8_t *frame, unsigned len,
 			 ghstLinkStatistics_t *link_stats, uint16_t *num_values, uint16_t max_channels);
 
 
+/**
+ * Build a telemetry battery frame
+ * @param buf frame buffer, at least GHST_TELEMETRY_FRAME_SIZE bytes
+ * @param voltage_in_10mV Voltage [10 mV]
+ * @param current_in_10mA Current [10 mA]
+ * @param fuel_in_10mAh Fuel [10 mAh]
+ * @return frame length
+ */
+__EXPORT int ghst_build_telemetry_battery_status(uint8_t *buf, uint16_t voltage_in_10mV,
+		uint16_t current_in_10mA, uint16_t fuel_in_10mAh);
+
+/**
+ * Build a primary GPS frame
+ * @param buf frame buffer, at least GHST_TELEMETRY_FRAME_SIZE bytes
+ * @see ghst_send_telemetry_gps1_status()
+ * @return frame length
+ */
+__EXPORT int ghst_build_telemetry_gps1_status(uint8_t *buf, uint32_t latitude, uint32_t longitude, uint16_t altitude);
+
+/**
+ * Build a secondary GPS frame
+ * @param buf frame buffer, at least GHST_TELEMETRY_FRAME_SIZE bytes
+ * @see ghst_send_telemetry_gps2_status()
+ * @return frame length
+ */
+__EXPORT int ghst_build_telemetry_gps2_status(uint8_t *buf, uint16_t ground_speed, uint16_t ground_course,
+		uint8_t num_sats, uint16_t home_dist, uint16_t home_dir, uint8_t flags);
+
 /**
  * Send telemetry battery information
  * @param uart_fd UART file descriptor
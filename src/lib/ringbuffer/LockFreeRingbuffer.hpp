@@ -0,0 +1,326 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file LockFreeRingbuffer.hpp
+ *
+ * Lock-free FIFO ringbuffers with a fixed capacity for passing data between threads.
+ *
+ * - SpscRingbuffer: a single producer and a single consumer thread
+ * - MpscRingbuffer: any number of producer threads and a single consumer thread
+ *
+ * Unlike Ringbuffer, all CAPACITY elements can be used. The element type needs to be
+ * trivially copyable, the capacity a power of 2. The head and tail indices are free running
+ * and kept on separate cache lines on POSIX, so producer and consumer don't invalidate
+ * each other's cache line on every access.
+ *
+ * The GCC atomic builtins are used (as for px4::atomic), all operations are wait-free
+ * except for MpscRingbuffer::push(), which retries if another producer pushed concurrently.
+ * The methods can also be used from an interrupt handler (for NuttX).
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <type_traits>
+
+namespace lockfree_ringbuffer
+{
+
+#if defined(__PX4_POSIX)
+static constexpr size_t CACHE_LINE_SIZE = 64;
+#endif
+
+// two indices owned by the same thread, padded to their own cache line (NuttX targets are single core)
+struct IndexPair {
+	size_t index{0};
+	size_t cached{0}; ///< last seen value of the other side's index
+
+#if defined(__PX4_POSIX)
+	uint8_t padding[CACHE_LINE_SIZE - 2 * sizeof(size_t)];
+#endif
+};
+
+template<typename T, size_t CAPACITY>
+struct Storage {
+	static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of 2");
+	static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+	static constexpr size_t MASK = CAPACITY - 1;
+
+	// copy count elements from items to the ring starting at position
+	void write(size_t position, const T *items, size_t count)
+	{
+		const size_t offset = position & MASK;
+		const size_t first = (count < CAPACITY - offset) ? count : CAPACITY - offset;
+
+		memcpy(&buffer[offset], items, first * sizeof(T));
+		memcpy(&buffer[0], items + first, (count - first) * sizeof(T));
+	}
+
+	// copy count elements from the ring starting at position to items
+	void read(size_t position, T *items, size_t count) const
+	{
+		const size_t offset = position & MASK;
+		const size_t first = (count < CAPACITY - offset) ? count : CAPACITY - offset;
+
+		memcpy(items, &buffer[offset], first * sizeof(T));
+		memcpy(items + first, &buffer[0], (count - first) * sizeof(T));
+	}
+
+	T buffer[CAPACITY];
+};
+
+} // namespace lockfree_ringbuffer
+
+/**
+ * Lock-free single producer, single consumer FIFO.
+ *
+ * push() must only be called from one thread, pop() from one (other) thread, or each
+ * side needs its own locking.
+ */
+template<typename T, size_t CAPACITY>
+class SpscRingbuffer
+{
+public:
+	SpscRingbuffer() = default;
+
+	// no copy, assignment, move, move assignment
+	SpscRingbuffer(const SpscRingbuffer &) = delete;
+	SpscRingbuffer &operator=(const SpscRingbuffer &) = delete;
+	SpscRingbuffer(SpscRingbuffer &&) = delete;
+	SpscRingbuffer &operator=(SpscRingbuffer &&) = delete;
+
+	static constexpr size_t capacity() { return CAPACITY; }
+
+	/**
+	 * @brief Push a single element (producer)
+	 *
+	 * @returns false if the buffer is full.
+	 */
+	bool push(const T &item) { return push(&item, 1) == 1; }
+
+	/**
+	 * @brief Push as many of the given elements as fit (producer)
+	 *
+	 * @returns number of elements pushed.
+	 */
+	size_t push(const T *items, size_t count)
+	{
+		const size_t head = __atomic_load_n(&_producer.index, __ATOMIC_RELAXED);
+
+		// only reload the consumer index if the cached one doesn't leave enough space
+		if (CAPACITY - (head - _producer.cached) < count) {
+			_producer.cached = __atomic_load_n(&_consumer.index, __ATOMIC_ACQUIRE);
+		}
+
+		const size_t available = CAPACITY - (head - _producer.cached);
+		const size_t n = (count < available) ? count : available;
+
+		if (n > 0) {
+			_storage.write(head, items, n);
+			__atomic_store_n(&_producer.index, head + n, __ATOMIC_RELEASE);
+		}
+
+		return n;
+	}
+
+	/**
+	 * @brief Pop the oldest element (consumer)
+	 *
+	 * @returns false if the buffer is empty.
+	 */
+	bool pop(T &item) { return pop(&item, 1) == 1; }
+
+	/**
+	 * @brief Pop up to max_count of the oldest elements (consumer)
+	 *
+	 * @returns number of elements popped, 0 if the buffer is empty.
+	 */
+	size_t pop(T *items, size_t max_count)
+	{
+		const size_t tail = __atomic_load_n(&_consumer.index, __ATOMIC_RELAXED);
+
+		if (_consumer.cached - tail < max_count) {
+			_consumer.cached = __atomic_load_n(&_producer.index, __ATOMIC_ACQUIRE);
+		}
+
+		const size_t used = _consumer.cached - tail;
+		const size_t n = (max_count < used) ? max_count : used;
+
+		if (n > 0) {
+			_storage.read(tail, items, n);
+			__atomic_store_n(&_consumer.index, tail + n, __ATOMIC_RELEASE);
+		}
+
+		return n;
+	}
+
+	/**
+	 * @brief Number of elements in the buffer, a snapshot if called concurrently
+	 */
+	size_t size() const
+	{
+		const size_t tail = __atomic_load_n(&_consumer.index, __ATOMIC_ACQUIRE);
+		return __atomic_load_n(&_producer.index, __ATOMIC_ACQUIRE) - tail;
+	}
+
+	bool empty() const { return size() == 0; }
+
+private:
+	lockfree_ringbuffer::IndexPair _producer{}; ///< head (next write position) and cached tail
+	lockfree_ringbuffer::IndexPair _consumer{}; ///< tail (next read position) and cached head
+	lockfree_ringbuffer::Storage<T, CAPACITY> _storage{};
+};
+
+/**
+ * Lock-free multi producer, single consumer FIFO.
+ *
+ * Producers reserve a range of slots with a compare and swap on the head and mark each slot
+ * as written with a per slot sequence number. The consumer stops at the first slot that is
+ * still being written, so the elements of a single push() are popped in order and contiguously,
+ * while the elements of different producers can interleave between push() calls.
+ */
+template<typename T, size_t CAPACITY>
+class MpscRingbuffer
+{
+public:
+	MpscRingbuffer() = default;
+
+	// no copy, assignment, move, move assignment
+	MpscRingbuffer(const MpscRingbuffer &) = delete;
+	MpscRingbuffer &operator=(const MpscRingbuffer &) = delete;
+	MpscRingbuffer(MpscRingbuffer &&) = delete;
+	MpscRingbuffer &operator=(MpscRingbuffer &&) = delete;
+
+	static constexpr size_t capacity() { return CAPACITY; }
+
+	/**
+	 * @brief Push a single element (any producer)
+	 *
+	 * @returns false if the buffer is full.
+	 */
+	bool push(const T &item) { return push(&item, 1) == 1; }
+
+	/**
+	 * @brief Push as many of the given elements as fit (any producer)
+	 *
+	 * @returns number of elements pushed.
+	 */
+	size_t push(const T *items, size_t count)
+	{
+		size_t head = __atomic_load_n(&_head.index, __ATOMIC_RELAXED);
+		size_t n = 0;
+
+		for (;;) {
+			const size_t used = head - __atomic_load_n(&_tail.index, __ATOMIC_ACQUIRE);
+
+			if (used > CAPACITY) {
+				// head is outdated, the consumer already popped past it
+				head = __atomic_load_n(&_head.index, __ATOMIC_RELAXED);
+				continue;
+			}
+
+			n = (count < CAPACITY - used) ? count : CAPACITY - used;
+
+			if (n == 0) {
+				return 0;
+			}
+
+			// on failure head is updated to the current value
+			if (__atomic_compare_exchange_n(&_head.index, &head, head + n, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				break;
+			}
+		}
+
+		_storage.write(head, items, n);
+
+		for (size_t i = 0; i < n; i++) {
+			__atomic_store_n(&_sequence[(head + i) & MASK], head + i + 1, __ATOMIC_RELEASE);
+		}
+
+		return n;
+	}
+
+	/**
+	 * @brief Pop the oldest element (consumer)
+	 *
+	 * @returns false if the buffer is empty or the oldest element is still being written.
+	 */
+	bool pop(T &item) { return pop(&item, 1) == 1; }
+
+	/**
+	 * @brief Pop up to max_count of the oldest completely written elements (consumer)
+	 *
+	 * @returns number of elements popped.
+	 */
+	size_t pop(T *items, size_t max_count)
+	{
+		const size_t tail = __atomic_load_n(&_tail.index, __ATOMIC_RELAXED);
+		size_t n = 0;
+
+		while (n < max_count && __atomic_load_n(&_sequence[(tail + n) & MASK], __ATOMIC_ACQUIRE) == tail + n + 1) {
+			n++;
+		}
+
+		if (n > 0) {
+			_storage.read(tail, items, n);
+			__atomic_store_n(&_tail.index, tail + n, __ATOMIC_RELEASE);
+		}
+
+		return n;
+	}
+
+	/**
+	 * @brief Number of reserved elements in the buffer, a snapshot if called concurrently
+	 */
+	size_t size() const
+	{
+		const size_t tail = __atomic_load_n(&_tail.index, __ATOMIC_ACQUIRE);
+		return __atomic_load_n(&_head.index, __ATOMIC_ACQUIRE) - tail;
+	}
+
+	bool empty() const { return size() == 0; }
+
+private:
+	static constexpr size_t MASK = CAPACITY - 1;
+
+	lockfree_ringbuffer::IndexPair _head{}; ///< next position to reserve, shared by the producers
+	lockfree_ringbuffer::IndexPair _tail{}; ///< next position to read, written by the consumer
+	lockfree_ringbuffer::Storage<T, CAPACITY> _storage{};
+
+	size_t _sequence[CAPACITY] {}; ///< position + 1 of the element last written to each slot
+};
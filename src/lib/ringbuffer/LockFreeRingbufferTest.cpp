@@ -0,0 +1,257 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+
+#include <thread>
+
+#include "LockFreeRingbuffer.hpp"
+
+static constexpr uint32_t STRESS_COUNT = 1000000;
+
+TEST(SpscRingbuffer, PushAndPopOne)
+{
+	SpscRingbuffer<uint32_t, 4> buf;
+	EXPECT_TRUE(buf.empty());
+	EXPECT_EQ(buf.capacity(), 4);
+
+	uint32_t out = 0;
+	EXPECT_FALSE(buf.pop(out));
+
+	EXPECT_TRUE(buf.push(42));
+	EXPECT_EQ(buf.size(), 1);
+	EXPECT_TRUE(buf.pop(out));
+	EXPECT_EQ(out, 42);
+	EXPECT_TRUE(buf.empty());
+}
+
+TEST(SpscRingbuffer, FillCompletely)
+{
+	SpscRingbuffer<uint32_t, 4> buf;
+
+	// unlike Ringbuffer all elements can be used
+	for (uint32_t i = 0; i < 4; i++) {
+		EXPECT_TRUE(buf.push(i));
+	}
+
+	EXPECT_FALSE(buf.push(4));
+	EXPECT_EQ(buf.size(), 4);
+
+	for (uint32_t i = 0; i < 4; i++) {
+		uint32_t out = 0;
+		EXPECT_TRUE(buf.pop(out));
+		EXPECT_EQ(out, i);
+	}
+
+	EXPECT_TRUE(buf.empty());
+}
+
+TEST(SpscRingbuffer, BulkWrapAround)
+{
+	SpscRingbuffer<uint8_t, 16> buf;
+	uint8_t in[16];
+	uint8_t out[16];
+	uint8_t value = 0;
+	uint8_t expected = 0;
+
+	for (int iteration = 0; iteration < 100; iteration++) {
+		// different lengths to hit all wrap around positions
+		const size_t len = 1 + iteration % 11;
+
+		for (size_t i = 0; i < len; i++) {
+			in[i] = value++;
+		}
+
+		ASSERT_EQ(buf.push(in, len), len);
+		ASSERT_EQ(buf.pop(out, sizeof(out)), len);
+
+		for (size_t i = 0; i < len; i++) {
+			EXPECT_EQ(out[i], expected++);
+		}
+	}
+}
+
+TEST(SpscRingbuffer, BulkPartial)
+{
+	SpscRingbuffer<uint8_t, 8> buf;
+	uint8_t in[12] {};
+	uint8_t out[12] {};
+
+	// only as much as fits is pushed, only as much as there is popped
+	EXPECT_EQ(buf.push(in, 5), 5);
+	EXPECT_EQ(buf.push(in, 5), 3);
+	EXPECT_EQ(buf.push(in, 5), 0);
+	EXPECT_EQ(buf.pop(out, 2), 2);
+	EXPECT_EQ(buf.pop(out, 12), 6);
+	EXPECT_EQ(buf.pop(out, 12), 0);
+}
+
+TEST(SpscRingbuffer, Stress)
+{
+	SpscRingbuffer<uint32_t, 64> buf;
+
+	std::thread producer([&buf]() {
+		uint32_t next = 0;
+		uint32_t chunk[7];
+
+		while (next < STRESS_COUNT) {
+			// alternate single and bulk pushes
+			const size_t len = (next % 3 == 0) ? 1 : 7;
+
+			for (size_t i = 0; i < len; i++) {
+				chunk[i] = next + i;
+			}
+
+			const size_t n = buf.push(chunk, (STRESS_COUNT - next < len) ? STRESS_COUNT - next : len);
+
+			if (n == 0) {
+				// full, let the consumer run (on a single core machine)
+				std::this_thread::yield();
+			}
+
+			next += n;
+		}
+	});
+
+	uint32_t expected = 0;
+	uint32_t chunk[5];
+
+	while (expected < STRESS_COUNT) {
+		const size_t n = buf.pop(chunk, 5);
+
+		if (n == 0) {
+			std::this_thread::yield();
+		}
+
+		for (size_t i = 0; i < n; i++) {
+			ASSERT_EQ(chunk[i], expected);
+			expected++;
+		}
+	}
+
+	producer.join();
+	EXPECT_TRUE(buf.empty());
+}
+
+TEST(MpscRingbuffer, PushAndPop)
+{
+	MpscRingbuffer<uint32_t, 8> buf;
+	uint32_t in[5] {1, 2, 3, 4, 5};
+	uint32_t out[8] {};
+
+	EXPECT_TRUE(buf.empty());
+	EXPECT_EQ(buf.pop(out, 8), 0);
+
+	EXPECT_EQ(buf.push(in, 5), 5);
+	EXPECT_EQ(buf.push(in, 5), 3);
+	EXPECT_FALSE(buf.push(6));
+	EXPECT_EQ(buf.size(), 8);
+
+	EXPECT_EQ(buf.pop(out, 6), 6);
+	EXPECT_EQ(out[0], 1);
+	EXPECT_EQ(out[4], 5);
+	EXPECT_EQ(out[5], 1);
+
+	// wrap around
+	EXPECT_EQ(buf.push(in, 5), 5);
+	EXPECT_EQ(buf.pop(out, 8), 7);
+	EXPECT_EQ(out[0], 2);
+	EXPECT_EQ(out[1], 3);
+	EXPECT_EQ(out[2], 1);
+	EXPECT_EQ(out[6], 5);
+	EXPECT_TRUE(buf.empty());
+}
+
+TEST(MpscRingbuffer, Stress)
+{
+	static constexpr uint32_t NUM_PRODUCERS = 4;
+	static constexpr uint32_t COUNT_PER_PRODUCER = STRESS_COUNT / NUM_PRODUCERS;
+
+	// producer index in the upper bits, sequence in the lower bits
+	MpscRingbuffer<uint32_t, 64> buf;
+	std::thread producers[NUM_PRODUCERS];
+
+	for (uint32_t p = 0; p < NUM_PRODUCERS; p++) {
+		producers[p] = std::thread([&buf, p]() {
+			uint32_t next = 0;
+			uint32_t chunk[3];
+
+			while (next < COUNT_PER_PRODUCER) {
+				const size_t len = (COUNT_PER_PRODUCER - next < 3) ? COUNT_PER_PRODUCER - next : 3;
+
+				for (size_t i = 0; i < len; i++) {
+					chunk[i] = (p << 24) | (next + i);
+				}
+
+				const size_t n = buf.push(chunk, len);
+
+				if (n == 0) {
+					std::this_thread::yield();
+				}
+
+				next += n;
+			}
+		});
+	}
+
+	uint32_t expected[NUM_PRODUCERS] {};
+	uint32_t received = 0;
+	uint32_t chunk[16];
+
+	while (received < NUM_PRODUCERS * COUNT_PER_PRODUCER) {
+		const size_t n = buf.pop(chunk, 16);
+
+		if (n == 0) {
+			std::this_thread::yield();
+		}
+
+		for (size_t i = 0; i < n; i++) {
+			const uint32_t p = chunk[i] >> 24;
+			ASSERT_LT(p, NUM_PRODUCERS);
+
+			// the order of each producer is kept
+			ASSERT_EQ(chunk[i] & 0xffffff, expected[p]);
+			expected[p]++;
+		}
+
+		received += n;
+	}
+
+	for (uint32_t p = 0; p < NUM_PRODUCERS; p++) {
+		producers[p].join();
+		EXPECT_EQ(expected[p], COUNT_PER_PRODUCER);
+	}
+
+	EXPECT_TRUE(buf.empty());
+}
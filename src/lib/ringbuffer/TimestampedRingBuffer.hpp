@@ -84,8 +84,52 @@ public:
 		return true;
 	}
 
+	/**
+	 * Change the buffer length keeping the newest samples in order,
+	 * the current buffer is left untouched if the allocation fails
+	 */
+	bool resize(uint8_t size)
+	{
+		if (!valid() || _first_write) {
+			return allocate(size);
+		}
+
+		if (size == _size) {
+			return true;
+		}
+
+		if (size == 0) {
+			return false;
+		}
+
+		data_type *buffer = new data_type[size] {};
+
+		if (buffer == nullptr) {
+			return false;
+		}
+
+		const uint8_t count = (_head + _size - _tail) % _size + 1;
+		const uint8_t keep = count < size ? count : size;
+
+		for (uint8_t i = 0; i < keep; i++) {
+			buffer[i] = _buffer[(_tail + count - keep + i) % _size];
+		}
+
+		delete[] _buffer;
+
+		_buffer = buffer;
+		_size = size;
+		_tail = 0;
+		_head = keep - 1;
+
+		return true;
+	}
+
 	bool valid() const { return (_buffer != nullptr) && (_size > 0); }
 
+	// true if the next push overwrites the oldest sample
+	bool full() const { return !_first_write && ((_head + 1) % _size == _tail); }
+
 	void push(const data_type &sample)
 	{
 		uint8_t head_new = _head;
@@ -114,6 +158,7 @@ public:
 	const data_type &get_oldest() const { return _buffer[_tail]; }
 
 	uint8_t get_oldest_index() const { return _tail; }
+	uint8_t get_newest_index() const { return _head; }
 
 	bool pop_first_older_than(const uint64_t &timestamp, data_type *sample)
 	{
@@ -158,3 +158,39 @@ TEST_F(TimestampedRingBufferTest, reallocateBuffer)
 	EXPECT_EQ(3, _buffer->get_length());
 
 }
+
+TEST_F(TimestampedRingBufferTest, resizeBuffer)
+{
+	ASSERT_EQ(true, _buffer->allocate(2));
+	_buffer->push(_x);
+	EXPECT_FALSE(_buffer->full());
+	_buffer->push(_y);
+	EXPECT_TRUE(_buffer->full());
+
+	// GIVEN: a full buffer
+	// WHEN: growing it
+	ASSERT_EQ(true, _buffer->resize(3));
+
+	// THEN: the samples are kept in order and there is space for a new one
+	EXPECT_EQ(3, _buffer->get_length());
+	EXPECT_FALSE(_buffer->full());
+	EXPECT_EQ(_x.time_us, _buffer->get_oldest().time_us);
+	EXPECT_EQ(_y.time_us, _buffer->get_newest().time_us);
+
+	_buffer->push(_z);
+	EXPECT_TRUE(_buffer->full());
+	EXPECT_EQ(_x.time_us, _buffer->get_oldest().time_us);
+
+	sample pop = {};
+	EXPECT_EQ(true, _buffer->pop_first_older_than(_y.time_us + 1, &pop));
+	EXPECT_EQ(_y.time_us, pop.time_us);
+
+	// WHEN: shrinking it
+	_buffer->push(_x);
+	ASSERT_EQ(true, _buffer->resize(1));
+
+	// THEN: only the newest sample is kept
+	EXPECT_EQ(1, _buffer->get_length());
+	EXPECT_EQ(_x.time_us, _buffer->get_oldest().time_us);
+	EXPECT_EQ(_x.time_us, _buffer->get_newest().time_us);
+}
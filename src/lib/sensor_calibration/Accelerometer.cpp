@@ -87,16 +87,16 @@ void Accelerometer::SensorCorrectionsUpdate(bool force)
 				if (corrections.accel_device_ids[i] == _device_id) {
 					switch (i) {
 					case 0:
-						_thermal_offset = Vector3f{corrections.accel_offset_0};
+						set_thermal_offset(Vector3f{corrections.accel_offset_0});
 						return;
 					case 1:
-						_thermal_offset = Vector3f{corrections.accel_offset_1};
+						set_thermal_offset(Vector3f{corrections.accel_offset_1});
 						return;
 					case 2:
-						_thermal_offset = Vector3f{corrections.accel_offset_2};
+						set_thermal_offset(Vector3f{corrections.accel_offset_2});
 						return;
 					case 3:
-						_thermal_offset = Vector3f{corrections.accel_offset_3};
+						set_thermal_offset(Vector3f{corrections.accel_offset_3});
 						return;
 					}
 				}
@@ -104,7 +104,7 @@ void Accelerometer::SensorCorrectionsUpdate(bool force)
 		}
 
 		// zero thermal offset if not found
-		_thermal_offset.zero();
+		set_thermal_offset(Vector3f{});
 	}
 }
 
@@ -114,6 +114,7 @@ bool Accelerometer::set_offset(const Vector3f &offset)
 		if (offset.isAllFinite()) {
 			_offset = offset;
 			_calibration_count++;
+			UpdateCorrection();
 			return true;
 		}
 	}
@@ -127,6 +128,7 @@ bool Accelerometer::set_scale(const Vector3f &scale)
 		if (scale.isAllFinite() && (scale(0) > 0.f) && (scale(1) > 0.f) && (scale(2) > 0.f)) {
 			_scale = scale;
 			_calibration_count++;
+			UpdateCorrection();
 			return true;
 		}
 	}
@@ -140,6 +142,20 @@ void Accelerometer::set_rotation(Rotation rotation)
 
 	// always apply board level adjustments
 	_rotation = Dcmf(GetSensorLevelAdjustment()) * get_rot_matrix(rotation);
+	UpdateCorrection();
+}
+
+void Accelerometer::set_thermal_offset(const Vector3f &thermal_offset)
+{
+	_thermal_offset = thermal_offset;
+	UpdateCorrection();
+}
+
+void Accelerometer::UpdateCorrection()
+{
+	// Correct(data) = R * diag(scale) * (data - thermal_offset - offset)
+	_correction_matrix = _rotation * diag(_scale);
+	_correction_offset = -(_correction_matrix * (_thermal_offset + _offset));
 }
 
 bool Accelerometer::set_calibration_index(int calibration_index)
@@ -231,6 +247,7 @@ void Accelerometer::Reset()
 	_scale = Vector3f{1.f, 1.f, 1.f};
 
 	_thermal_offset.zero();
+	UpdateCorrection();
 
 	_priority = _external ? DEFAULT_EXTERNAL_PRIORITY : DEFAULT_PRIORITY;
 
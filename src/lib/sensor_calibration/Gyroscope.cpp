@@ -87,16 +87,16 @@ void Gyroscope::SensorCorrectionsUpdate(bool force)
 				if (corrections.gyro_device_ids[i] == _device_id) {
 					switch (i) {
 					case 0:
-						_thermal_offset = Vector3f{corrections.gyro_offset_0};
+						set_thermal_offset(Vector3f{corrections.gyro_offset_0});
 						return;
 					case 1:
-						_thermal_offset = Vector3f{corrections.gyro_offset_1};
+						set_thermal_offset(Vector3f{corrections.gyro_offset_1});
 						return;
 					case 2:
-						_thermal_offset = Vector3f{corrections.gyro_offset_2};
+						set_thermal_offset(Vector3f{corrections.gyro_offset_2});
 						return;
 					case 3:
-						_thermal_offset = Vector3f{corrections.gyro_offset_3};
+						set_thermal_offset(Vector3f{corrections.gyro_offset_3});
 						return;
 					}
 				}
@@ -104,7 +104,7 @@ void Gyroscope::SensorCorrectionsUpdate(bool force)
 		}
 
 		// zero thermal offset if not found
-		_thermal_offset.zero();
+		set_thermal_offset(Vector3f{});
 	}
 }
 
@@ -114,6 +114,7 @@ bool Gyroscope::set_offset(const Vector3f &offset)
 		if (offset.isAllFinite()) {
 			_offset = offset;
 			_calibration_count++;
+			UpdateCorrection();
 			return true;
 		}
 	}
@@ -127,6 +128,20 @@ void Gyroscope::set_rotation(Rotation rotation)
 
 	// always apply board level adjustments
 	_rotation = Dcmf(GetSensorLevelAdjustment()) * get_rot_matrix(rotation);
+	UpdateCorrection();
+}
+
+void Gyroscope::set_thermal_offset(const Vector3f &thermal_offset)
+{
+	_thermal_offset = thermal_offset;
+	UpdateCorrection();
+}
+
+void Gyroscope::UpdateCorrection()
+{
+	// Correct(data) = R * (data - thermal_offset - offset)
+	_correction_matrix = _rotation;
+	_correction_offset = -(_correction_matrix * (_thermal_offset + _offset));
 }
 
 bool Gyroscope::set_calibration_index(int calibration_index)
@@ -214,6 +229,7 @@ void Gyroscope::Reset()
 	_offset.zero();
 
 	_thermal_offset.zero();
+	UpdateCorrection();
 
 	_priority = _external ? DEFAULT_EXTERNAL_PRIORITY : DEFAULT_PRIORITY;
 
@@ -80,7 +80,7 @@ public:
 	// rotate corrected measurements from sensor to body frame
 	inline matrix::Vector3f Correct(const matrix::Vector3f &data) const
 	{
-		return _rotation * matrix::Vector3f{data - _thermal_offset - _offset};
+		return _correction_matrix * data + _correction_offset;
 	}
 
 	inline matrix::Vector3f Uncorrect(const matrix::Vector3f &corrected_data) const
@@ -104,6 +104,9 @@ public:
 	void SensorCorrectionsUpdate(bool force = false);
 
 private:
+	void set_thermal_offset(const matrix::Vector3f &thermal_offset);
+	void UpdateCorrection();
+
 	uORB::Subscription _sensor_correction_sub{ORB_ID(sensor_correction)};
 
 	Rotation _rotation_enum{ROTATION_NONE};
@@ -112,6 +115,10 @@ private:
 	matrix::Vector3f _offset;
 	matrix::Vector3f _thermal_offset;
 
+	// Correct() as a single affine transform, updated whenever the calibration or thermal offset changes
+	matrix::Matrix3f _correction_matrix{matrix::eye<float, 3>()};
+	matrix::Vector3f _correction_offset;
+
 	int8_t _calibration_index{-1};
 	uint32_t _device_id{0};
 	int32_t _priority{-1};
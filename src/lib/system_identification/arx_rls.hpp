@@ -35,6 +35,10 @@
  * @file arx_rls.hpp
  * @brief Efficient recursive weighted least-squares algorithm without matrix inversion
  *
+ * The covariance matrix is propagated in square-root form (P = S * S') using Potter's
+ * algorithm, which keeps P symmetric and positive semi-definite by construction and
+ * roughly doubles the usable precision compared to propagating P directly.
+ *
  * Assumes an ARX (autoregressive) model:
  * A(q^-1)y(k) = q^-d * B(q^-1)u(k) + A(q^-1)e(k)
  *
@@ -51,6 +55,7 @@
  *
  * References:
  * - Identification de systemes dynamiques, D.Bonvin and A.Karimi, epfl, 2011
+ * - Fundamentals of Kalman Filtering: A Practical Approach, P.Zarchan and H.Musoff, 2009 (square-root filtering)
  *
  * @author Mathieu Bresciani <mathieu@auterion.com>
  */
@@ -80,17 +85,32 @@ public:
 	 * [a_1 .. a_n b_0 .. b_m]'
 	 */
 	const matrix::Vector < float, N + M + 1 > &getCoefficients() const { return _theta_hat; }
-	const matrix::Vector < float, N + M + 1 > getVariances() const { return _P.diag(); }
+	const matrix::Vector < float, N + M + 1 > getVariances() const
+	{
+		// diagonal of P = S * S'
+		matrix::Vector < float, N + M + 1 > variances;
+
+		for (size_t i = 0; i < (N + M + 1); i++) {
+			float sum = 0.f;
+
+			for (size_t j = 0; j < (N + M + 1); j++) {
+				sum += _S(i, j) * _S(i, j);
+			}
+
+			variances(i) = sum;
+		}
+
+		return variances;
+	}
 	float getInnovation() const { return _innovation; }
 	const matrix::Vector < float, N + M + 1 > &getDiffEstimate() const { return _diff_theta_hat; }
 
 	void reset(const matrix::Vector < float, N + M + 1 > &theta_init = {})
 	{
-		/* _P.uncorrelateCovarianceSetVariance<N + M + 1>(0, 10e3f); // does not work */
-		_P.setZero();
+		_S.setZero();
 
 		for (size_t i = 0; i < (N + M + 1); i++) {
-			_P(i, i) = 10e3f;
+			_S(i, i) = sqrtf(10e3f);
 		}
 
 		_diff_theta_hat.setZero();
@@ -109,33 +129,48 @@ public:
 		_innovation = 0.f;
 	}
 
-	void update(float u, float y)
+	void update(float u, float y) { update(&u, &y, 1); }
+
+	/*
+	 * Block update with count consecutive input-output samples,
+	 * equivalent to calling update() for each of them
+	 */
+	void update(const float u[], const float y[], size_t count)
 	{
 		const matrix::Vector < float, N + M + 1 > theta_prev = _theta_hat;
 
-		addInputOutput(u, y);
+		for (size_t k = 0; k < count; k++) {
+			addInputOutput(u[k], y[k]);
 
-		if (!isBufferFull()) {
-			// Do not start to update the RLS algorithm when the
-			// buffer still contains zeros
-			return;
-		}
-
-		const matrix::Vector < float, N + M + 1 > phi = constructDesignVector();
-		const matrix::Matrix < float, 1, N + M + 1 > phi_t = phi.transpose();
+			if (!isBufferFull()) {
+				// Do not start to update the RLS algorithm when the
+				// buffer still contains zeros
+				continue;
+			}
 
-		_P = (_P - _P * phi * phi_t * _P / (_lambda + (phi_t * _P * phi)(0, 0))) / _lambda;
-		_innovation = _y[N] - (phi_t * _theta_hat)(0, 0);
-		_theta_hat = _theta_hat + _P * phi * _innovation;
+			updateEstimate(constructDesignVector());
+		}
 
 		for (size_t i = 0; i < N + M + 1; i++) {
 			_diff_theta_hat(i) = fabsf(_theta_hat(i) - theta_prev(i));
 		}
-
-		/* fixCovarianceErrors(); // TODO: this could help against ill-conditioned matrix but needs more testing*/
 	}
 
 private:
+	void updateEstimate(const matrix::Vector < float, N + M + 1 > &phi)
+	{
+		// Potter's square-root update of P = (P - P * phi * phi' * P / (lambda + phi' * P * phi)) / lambda
+		const matrix::Vector < float, N + M + 1 > f = _S.transpose() * phi;
+		const float alpha = _lambda + f.dot(f);
+		const matrix::Matrix < float, N + M + 1, 1 > k = _S * f; // P * phi, the gain is k / alpha
+
+		_innovation = _y[N] - phi.dot(_theta_hat);
+		_theta_hat += k * (_innovation / alpha);
+
+		const float gamma = 1.f / (alpha + sqrtf(_lambda * alpha));
+		_S = (_S - k * (gamma * f).transpose()) / sqrtf(_lambda);
+	}
+
 	void addInputOutput(float u, float y)
 	{
 		shiftRegisters();
@@ -178,26 +213,7 @@ private:
 		return phi;
 	}
 
-	void fixCovarianceErrors()
-	{
-		float max_var = 0.f;
-
-		for (size_t i = 0; i < (N + M + 1); i++) {
-			if (_P(i, i) > max_var) {
-				max_var = _P(i, i);
-			}
-		}
-
-		const float min_var_allowed = max_var * 0.1f;
-
-		for (size_t i = 0; i < (N + M + 1); i++) {
-			if (_P(i, i) < min_var_allowed) {
-				_P(i, i) = min_var_allowed;
-			}
-		}
-	}
-
-	matrix::SquareMatrix < float, N + M + 1 > _P;
+	matrix::SquareMatrix < float, N + M + 1 > _S; ///< square root of the covariance matrix
 	matrix::Vector < float, N + M + 1 > _theta_hat;
 	matrix::Vector < float, N + M + 1 > _diff_theta_hat;
 	float _innovation{};
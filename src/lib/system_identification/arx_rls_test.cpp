@@ -114,3 +114,36 @@ TEST_F(ArxRlsTest, resetTest)
 	// THEN: the result should be exactly the same
 	EXPECT_TRUE((coefficients - _rls.getCoefficients()).abs().max() < 1e-8f);
 }
+
+TEST_F(ArxRlsTest, blockUpdateTest)
+{
+	ArxRls<2, 2, 1> rls_sample;
+	ArxRls<2, 2, 1> rls_block;
+	rls_sample.setForgettingFactor(0.99f);
+	rls_block.setForgettingFactor(0.99f);
+
+	float u[40];
+	float y[40];
+
+	for (int i = 0; i < 40; i++) {
+		u[i] = sinf(0.3f * i) + 0.2f * cosf(1.7f * i);
+		y[i] = (i > 0) ? 0.8f * y[i - 1] + 0.3f * u[i - 1] : 0.f;
+	}
+
+	// WHEN: updating sample by sample and in blocks of different sizes
+	for (int i = 0; i < 40; i++) {
+		rls_sample.update(u[i], y[i]);
+	}
+
+	rls_block.update(&u[0], &y[0], 3);
+	rls_block.update(&u[3], &y[3], 16);
+	rls_block.update(&u[19], &y[19], 21);
+
+	// THEN: the estimates are the same
+	EXPECT_TRUE((rls_sample.getCoefficients() - rls_block.getCoefficients()).abs().max() < 1e-5f);
+	EXPECT_TRUE((rls_sample.getVariances() - rls_block.getVariances()).abs().max() < 1e-5f);
+	EXPECT_FLOAT_EQ(rls_sample.getInnovation(), rls_block.getInnovation());
+
+	// AND: the variances stay positive
+	EXPECT_TRUE(rls_block.getVariances().min() > 0.f);
+}
@@ -0,0 +1,157 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file rate_loop_sample_collector.hpp
+ * @brief Buffered input/output stream of the rate loop for system identification
+ *
+ * Collects the torque setpoint and angular velocity of every rate loop iteration on the
+ * rate controller's work queue and buffers them in a lock-free FIFO. The consumer (e.g. an
+ * autotuner) gets scheduled for every batch of samples, so it can run on a lower priority work
+ * queue and process the data in blocks without perturbing the rate loop it's identifying.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <lib/perf/perf_counter.h>
+#include <lib/ringbuffer/LockFreeRingbuffer.hpp>
+#include <px4_platform_common/px4_work_queue/WorkItem.hpp>
+#include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/vehicle_angular_velocity.h>
+#include <uORB/topics/vehicle_torque_setpoint.h>
+
+class RateLoopSampleCollector final : public px4::WorkItem
+{
+public:
+	struct Sample {
+		hrt_abstime timestamp;
+		float torque_setpoint[3];
+		float angular_velocity[3];
+	};
+
+	static constexpr size_t QUEUE_SIZE = 128; ///< > 100ms at 1kHz
+
+	/**
+	 * @param name work item name
+	 * @param consumer work item processing the samples
+	 * @param torque_setpoint_instance vehicle_torque_setpoint instance of the rate loop
+	 * @param batch_size number of buffered samples before the consumer gets scheduled
+	 */
+	RateLoopSampleCollector(const char *name, px4::WorkItem &consumer, uint8_t torque_setpoint_instance,
+				size_t batch_size) :
+		WorkItem(name, px4::wq_configurations::hp_default),
+		_consumer(consumer),
+		_vehicle_torque_setpoint_sub(this, ORB_ID(vehicle_torque_setpoint), torque_setpoint_instance),
+		_batch_size(batch_size)
+	{
+	}
+
+	~RateLoopSampleCollector() override
+	{
+		perf_free(_dropped_perf);
+	}
+
+	bool registerCallback() { return _vehicle_torque_setpoint_sub.registerCallback(); }
+	void unregisterCallback() { _vehicle_torque_setpoint_sub.unregisterCallback(); }
+
+	/**
+	 * Pop the oldest samples (consumer)
+	 * @return number of samples popped
+	 */
+	size_t pop(Sample *samples, size_t max_count) { return _samples.pop(samples, max_count); }
+
+	/**
+	 * Stop collecting (consumer). As the collector runs on another work queue, the consumer needs
+	 * to wait for stopped() before deleting it, it gets scheduled again once stopped.
+	 */
+	void requestStop()
+	{
+		__atomic_store_n(&_stop_requested, true, __ATOMIC_RELEASE);
+		ScheduleNow();
+	}
+
+	bool stopped() const { return __atomic_load_n(&_stopped, __ATOMIC_ACQUIRE); }
+
+	void printStatus() const { perf_print_counter(_dropped_perf); }
+
+private:
+	void Run() override
+	{
+		if (__atomic_load_n(&_stop_requested, __ATOMIC_ACQUIRE)) {
+			_vehicle_torque_setpoint_sub.unregisterCallback();
+			__atomic_store_n(&_stopped, true, __ATOMIC_RELEASE);
+			_consumer.ScheduleNow();
+			return;
+		}
+
+		vehicle_torque_setpoint_s vehicle_torque_setpoint;
+		vehicle_angular_velocity_s angular_velocity;
+
+		if (!_vehicle_torque_setpoint_sub.update(&vehicle_torque_setpoint)
+		    || !_vehicle_angular_velocity_sub.copy(&angular_velocity)) {
+			return;
+		}
+
+		Sample sample;
+		sample.timestamp = vehicle_torque_setpoint.timestamp;
+
+		for (int i = 0; i < 3; i++) {
+			sample.torque_setpoint[i] = vehicle_torque_setpoint.xyz[i];
+			sample.angular_velocity[i] = angular_velocity.xyz[i];
+		}
+
+		if (!_samples.push(sample)) {
+			// the consumer doesn't keep up
+			perf_count(_dropped_perf);
+		}
+
+		if (_samples.size() >= _batch_size) {
+			_consumer.ScheduleNow();
+		}
+	}
+
+	px4::WorkItem &_consumer;
+
+	uORB::SubscriptionCallbackWorkItem _vehicle_torque_setpoint_sub;
+	uORB::Subscription _vehicle_angular_velocity_sub{ORB_ID(vehicle_angular_velocity)};
+
+	SpscRingbuffer<Sample, QUEUE_SIZE> _samples;
+	const size_t _batch_size;
+
+	bool _stop_requested{false};
+	bool _stopped{false};
+
+	perf_counter_t _dropped_perf{perf_alloc(PC_COUNT, "rate loop samples: dropped")};
+};
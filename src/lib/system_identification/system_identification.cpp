@@ -64,6 +64,16 @@ void SystemIdentification::update()
 	updateFitness();
 }
 
+void SystemIdentification::update(const float u[], const float y[], size_t count)
+{
+	if (count == 0) {
+		return;
+	}
+
+	_rls.update(u, y, count);
+	updateFitness(count);
+}
+
 void SystemIdentification::updateFilters(float u, float y)
 {
 	if (!_are_filters_initialized) {
@@ -86,7 +96,7 @@ void SystemIdentification::updateFilters(float u, float y)
 	_y_prev = y_lpf;
 }
 
-void SystemIdentification::updateFitness()
+void SystemIdentification::updateFitness(size_t count)
 {
 	const matrix::Vector<float, 5> &diff = _rls.getDiffEstimate();
 	float sum = 0.f;
@@ -95,7 +105,10 @@ void SystemIdentification::updateFitness()
 		sum += diff(i);
 	}
 
-	if (_dt > FLT_EPSILON) {
-		_fitness_lpf.update(sum / _dt);
+	// the estimate difference is over the whole block
+	const float dt = _dt * count;
+
+	if (dt > FLT_EPSILON) {
+		_fitness_lpf.update(sum / dt, dt);
 	}
 }
@@ -56,9 +56,10 @@ public:
 	void reset(const matrix::Vector<float, 5> &id_state_init = {});
 	void update(float u, float y); // update filters and model
 	void update(); // update model only (to be called after updateFilters)
+	void update(const float u[], const float y[], size_t count); // update model only with a block of filtered data
 	void updateFilters(float u, float y);
 	bool areFiltersInitialized() const { return _are_filters_initialized; }
-	void updateFitness();
+	void updateFitness(size_t count = 1);
 	const matrix::Vector<float, 5> &getCoefficients() const { return _rls.getCoefficients(); }
 	const matrix::Vector<float, 5> getVariances() const { return _rls.getVariances(); }
 	const matrix::Vector<float, 5> &getDiffEstimate() const { return _rls.getDiffEstimate(); }
@@ -42,6 +42,8 @@
 
 #include <px4_platform_common/defines.h>
 
+#include <string.h>
+
 #include "matrix/Matrix.hpp"
 #include "matrix/Vector2.hpp"
 #include <mathlib/math/Functions.hpp>
@@ -103,17 +105,8 @@ void TECSAirspeedFilter::update(const float dt, const Input &input, const Param
 	new_state_predicted(0) = _airspeed_state.speed + dt * _airspeed_state.speed_rate;
 	new_state_predicted(1) = _airspeed_state.speed_rate;
 
-	const float airspeed_noise_inv{1.0f / param.airspeed_measurement_std_dev};
-	const float airspeed_rate_noise_inv{1.0f / param.airspeed_rate_measurement_std_dev};
-	const float airspeed_rate_noise_inv_squared_process_noise{airspeed_rate_noise_inv *airspeed_rate_noise_inv * param.airspeed_rate_noise_std_dev};
-	const float denom{airspeed_noise_inv + airspeed_rate_noise_inv_squared_process_noise};
-	const float common_nom{std::sqrt(param.airspeed_rate_noise_std_dev * (2.0f * airspeed_noise_inv + airspeed_rate_noise_inv_squared_process_noise))};
-
-	matrix::Matrix<float, 2, 2> kalman_gain;
-	kalman_gain(0, 0) = airspeed_noise_inv * common_nom / denom;
-	kalman_gain(0, 1) = airspeed_rate_noise_inv_squared_process_noise / denom;
-	kalman_gain(1, 0) = airspeed_noise_inv * airspeed_noise_inv * param.airspeed_rate_noise_std_dev / denom;
-	kalman_gain(1, 1) = airspeed_rate_noise_inv_squared_process_noise * common_nom / denom;
+	_updateKalmanGain(param);
+	const matrix::Matrix<float, 2, 2> &kalman_gain = _kalman_gain;
 
 	const matrix::Vector2f innovation{(airspeed - new_state_predicted(0)), (airspeed_derivative - new_state_predicted(1))};
 	matrix::Vector2f new_state;
@@ -135,6 +128,29 @@ void TECSAirspeedFilter::update(const float dt, const Input &input, const Param
 	_airspeed_state.speed_rate = new_state(1);
 }
 
+void TECSAirspeedFilter::_updateKalmanGain(const Param &param)
+{
+	const float noise_param[3] {param.airspeed_measurement_std_dev, param.airspeed_rate_measurement_std_dev,
+				    param.airspeed_rate_noise_std_dev};
+
+	if (memcmp(noise_param, _kalman_gain_noise_param, sizeof(noise_param)) == 0) {
+		return;
+	}
+
+	memcpy(_kalman_gain_noise_param, noise_param, sizeof(noise_param));
+
+	const float airspeed_noise_inv{1.0f / param.airspeed_measurement_std_dev};
+	const float airspeed_rate_noise_inv{1.0f / param.airspeed_rate_measurement_std_dev};
+	const float airspeed_rate_noise_inv_squared_process_noise{airspeed_rate_noise_inv *airspeed_rate_noise_inv * param.airspeed_rate_noise_std_dev};
+	const float denom{airspeed_noise_inv + airspeed_rate_noise_inv_squared_process_noise};
+	const float common_nom{std::sqrt(param.airspeed_rate_noise_std_dev * (2.0f * airspeed_noise_inv + airspeed_rate_noise_inv_squared_process_noise))};
+
+	_kalman_gain(0, 0) = airspeed_noise_inv * common_nom / denom;
+	_kalman_gain(0, 1) = airspeed_rate_noise_inv_squared_process_noise / denom;
+	_kalman_gain(1, 0) = airspeed_noise_inv * airspeed_noise_inv * param.airspeed_rate_noise_std_dev / denom;
+	_kalman_gain(1, 1) = airspeed_rate_noise_inv_squared_process_noise * common_nom / denom;
+}
+
 TECSAirspeedFilter::AirspeedFilterState TECSAirspeedFilter::getState() const
 {
 	return _airspeed_state;
@@ -235,6 +251,8 @@ void TECSControl::initialize(const Setpoint &setpoint, const Input &input, Param
 {
 	resetIntegrals();
 
+	_ste_rate_limit = _calculateTotalEnergyRateLimit(param);
+
 	AltitudePitchControl control_setpoint;
 
 	control_setpoint.tas_setpoint = setpoint.tas_setpoint;
@@ -252,7 +270,7 @@ void TECSControl::initialize(const Setpoint &setpoint, const Input &input, Param
 
 	_pitch_setpoint = _calcPitchControlOutput(input, seb_rate, param, flag);
 
-	const STERateLimit limit{_calculateTotalEnergyRateLimit(param)};
+	const STERateLimit &limit = _ste_rate_limit;
 
 	_ste_rate_estimate_filter.reset(specific_energy_rate.spe_rate.estimate + specific_energy_rate.ske_rate.estimate);
 
@@ -280,6 +298,9 @@ void TECSControl::update(const float dt, const Setpoint &setpoint, const Input &
 		return;
 	}
 
+	// the limits only depend on parameters, compute them once for all the control loops
+	_ste_rate_limit = _calculateTotalEnergyRateLimit(param);
+
 	AltitudePitchControl control_setpoint;
 
 	control_setpoint.tas_setpoint = setpoint.tas_setpoint;
@@ -314,6 +335,7 @@ TECSControl::STERateLimit TECSControl::_calculateTotalEnergyRateLimit(const Para
 	// Calculate the specific total energy rate limits from the max throttle limits
 	limit.STE_rate_max = math::max(param.max_climb_rate, FLT_EPSILON) * CONSTANTS_ONE_G;
 	limit.STE_rate_min = - math::max(param.min_sink_rate, FLT_EPSILON) * CONSTANTS_ONE_G;
+	limit.STE_rate_to_throttle = 1.0f / (limit.STE_rate_max - limit.STE_rate_min);
 
 	return limit;
 }
@@ -323,17 +345,16 @@ float TECSControl::_calcAirspeedControlOutput(const Setpoint &setpoint, const In
 {
 	float airspeed_rate_output{0.0f};
 
-	const STERateLimit limit{_calculateTotalEnergyRateLimit(param)};
+	const STERateLimit &limit = _ste_rate_limit;
 
 	// calculate the demanded true airspeed rate of change based on first order response of true airspeed error
 	// if airspeed measurement is not enabled then always set the rate setpoint to zero in order to avoid constant rate setpoints
 	if (flag.airspeed_enabled) {
 		// Calculate limits for the demanded rate of change of speed based on physical performance limits
 		// with a 50% margin to allow the total energy controller to correct for errors. Increase it in case of fast descend
-		const float max_tas_rate_sp = (param.fast_descend * 0.5f + 0.5f) * limit.STE_rate_max / math::max(input.tas,
-					      FLT_EPSILON);
-		const float min_tas_rate_sp = (param.fast_descend * 0.5f + 0.5f) * limit.STE_rate_min / math::max(input.tas,
-					      FLT_EPSILON);
+		const float ste_rate_to_tas_rate = (param.fast_descend * 0.5f + 0.5f) / math::max(input.tas, FLT_EPSILON);
+		const float max_tas_rate_sp = limit.STE_rate_max * ste_rate_to_tas_rate;
+		const float min_tas_rate_sp = limit.STE_rate_min * ste_rate_to_tas_rate;
 		airspeed_rate_output = constrain((setpoint.tas_setpoint - input.tas) * param.airspeed_error_gain, min_tas_rate_sp,
 						 max_tas_rate_sp);
 	}
@@ -520,7 +541,7 @@ float TECSControl::_calcPitchControlOutput(const Input &input, const ControlValu
 void TECSControl::_calcThrottleControl(float dt, const SpecificEnergyRates &specific_energy_rates, const Param &param,
 				       const Flag &flag)
 {
-	const STERateLimit limit{_calculateTotalEnergyRateLimit(param)};
+	const STERateLimit &limit = _ste_rate_limit;
 
 	// Update STE rate estimate LP filter
 	const float STE_rate_estimate_raw = specific_energy_rates.spe_rate.estimate + specific_energy_rates.ske_rate.estimate;
@@ -576,8 +597,8 @@ TECSControl::ControlValues TECSControl::_calcThrottleControlSteRate(const STERat
 void TECSControl::_calcThrottleControlUpdate(float dt, const STERateLimit &limit, const ControlValues &ste_rate,
 		const Param &param, const Flag &flag)
 {
-	// Calculate gain scaler from specific energy rate error to throttle
-	const float STE_rate_to_throttle = 1.0f / (limit.STE_rate_max - limit.STE_rate_min);
+	// Gain scaler from specific energy rate error to throttle
+	const float STE_rate_to_throttle = limit.STE_rate_to_throttle;
 
 	// Integral handling
 	if (flag.airspeed_enabled) {
@@ -611,8 +632,8 @@ float TECSControl::_calcThrottleControlOutput(const STERateLimit &limit, const C
 		const Param &param,
 		const Flag &flag) const
 {
-	// Calculate gain scaler from specific energy rate error to throttle
-	const float STE_rate_to_throttle = 1.0f / (limit.STE_rate_max - limit.STE_rate_min);
+	// Gain scaler from specific energy rate error to throttle
+	const float STE_rate_to_throttle = limit.STE_rate_to_throttle;
 
 	// Calculate a predicted throttle from the demanded rate of change of energy, using the cruise throttle
 	// as the starting point. Assume:
@@ -114,8 +114,19 @@ public:
 	AirspeedFilterState getState() const;
 
 private:
+	/**
+	 * @brief Update the steady state Kalman gain if the noise parameters changed.
+	 *
+	 * @param[in] param are the filter parameters.
+	 */
+	void _updateKalmanGain(const Param &param);
+
 	// States
 	AirspeedFilterState _airspeed_state{.speed = 0.0f, .speed_rate = 0.0f};	///< Complimentary filter state
+
+	// The gain only depends on the noise parameters, it is recomputed when they change
+	matrix::Matrix<float, 2, 2> _kalman_gain{};	///< Continuous Kalman gain
+	float _kalman_gain_noise_param[3] {NAN, NAN, NAN};	///< Noise parameters _kalman_gain was computed for
 };
 
 class TECSAltitudeReferenceModel
@@ -340,6 +351,7 @@ private:
 	struct STERateLimit {
 		float STE_rate_max;	///< Maximum specific total energy rate limit [m²/s³].
 		float STE_rate_min;	///< Minimal specific total energy rate limit [m²/s³].
+		float STE_rate_to_throttle;	///< Gain scaler from specific energy rate error to throttle [s³/m²].
 	};
 
 	/**
@@ -534,6 +546,7 @@ private:
 private:
 	// State
 	AlphaFilter<float> _ste_rate_estimate_filter;		///< Low pass filter for the specific total energy rate.
+	STERateLimit _ste_rate_limit{};				///< Specific total energy rate limits of the current update.
 	float _pitch_integ_state{0.0f};				///< Pitch integrator state [rad].
 	float _throttle_integ_state{0.0f};			///< Throttle integrator state [-].
 
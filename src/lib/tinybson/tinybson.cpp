@@ -59,7 +59,8 @@ read_x(bson_decoder_t decoder, void *p, size_t s)
 {
 	CODER_CHECK(decoder);
 
-	if (decoder->fd > -1) {
+	/* bson file decoder (non-buffered) */
+	if (decoder->fd > -1 && decoder->buf == nullptr) {
 		int ret = ::read(decoder->fd, p, s);
 
 		if (ret == s) {
@@ -70,6 +71,39 @@ read_x(bson_decoder_t decoder, void *p, size_t s)
 		return -1;
 	}
 
+	/* bson buffered file decoder */
+	if (decoder->fd > -1) {
+		uint8_t *dst = (uint8_t *)p;
+
+		while (s > 0) {
+			if (decoder->bufpos >= decoder->buflen) {
+				// refill the buffer from disk
+				int ret = ::read(decoder->fd, decoder->buf, decoder->bufsize);
+
+				if (ret <= 0) {
+					return -1;
+				}
+
+				decoder->buflen = ret;
+				decoder->bufpos = 0;
+			}
+
+			size_t n = decoder->buflen - decoder->bufpos;
+
+			if (n > s) {
+				n = s;
+			}
+
+			memcpy(dst, decoder->buf + decoder->bufpos, n);
+			decoder->bufpos += n;
+			decoder->total_decoded_size += n;
+			dst += n;
+			s -= n;
+		}
+
+		return 0;
+	}
+
 	if (decoder->buf != nullptr) {
 		/* staged operations to avoid integer overflow for corrupt data */
 		if (s >= decoder->bufsize) {
@@ -133,6 +167,25 @@ bson_decoder_init_file(bson_decoder_t decoder, int fd, bson_decoder_callback cal
 	return 0;
 }
 
+int
+bson_decoder_init_buf_file(bson_decoder_t decoder, int fd, void *buf, unsigned bufsize, bson_decoder_callback callback)
+{
+	/* argument sanity */
+	if ((buf == nullptr) || (bufsize == 0) || (callback == nullptr)) {
+		return -1;
+	}
+
+	decoder->buf = (uint8_t *)buf;
+	decoder->bufsize = bufsize;
+	decoder->bufpos = 0;
+	decoder->buflen = 0;
+	decoder->dead = false;
+	decoder->pending = 0;
+	decoder->total_decoded_size = 0;
+
+	return bson_decoder_init_file(decoder, fd, callback);
+}
+
 int
 bson_decoder_init_buf(bson_decoder_t decoder, void *buf, unsigned bufsize, bson_decoder_callback callback)
 {
@@ -112,6 +112,9 @@ struct bson_decoder_s {
 	size_t			bufsize{0};
 	unsigned		bufpos{0};
 
+	/* buffered file reader state (valid bytes in buf) */
+	unsigned		buflen{0};
+
 	bool			dead{false};
 	bson_decoder_callback	callback;
 	unsigned		nesting{0};
@@ -139,6 +142,22 @@ struct bson_decoder_s {
  */
 __EXPORT int bson_decoder_init_file(bson_decoder_t decoder, int fd, bson_decoder_callback callback);
 
+/**
+ * Initialise the decoder to read from a file, using a buffer for block reads.
+ *
+ * The decoder reads ahead up to bufsize bytes, so the file position is
+ * undefined after decoding.
+ *
+ * @param decoder		Decoder state structure to be initialised.
+ * @param fd			File to read BSON data from.
+ * @param buf			Buffer pointer to use, can't be nullptr
+ * @param bufsize		Supplied buffer size
+ * @param callback		Callback to be invoked by bson_decoder_next
+ * @return			Zero on success.
+ */
+__EXPORT int bson_decoder_init_buf_file(bson_decoder_t decoder, int fd, void *buf, unsigned bufsize,
+					bson_decoder_callback callback);
+
 /**
  * Initialise the decoder to read from a buffer in memory.
  *
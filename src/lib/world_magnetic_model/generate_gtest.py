@@ -144,3 +144,26 @@ for latitude in range(SAMPLING_MIN_LAT, SAMPLING_MAX_LAT+1, SAMPLING_RES):
 
         print('\tEXPECT_NEAR(get_mag_strength_tesla({}, {}) * 1e9, {:.0f}, {:.0f} + {:.0f});'.format(p['latitude'], p['longitude'], p['totalintensity'], p['totalintensity_uncertainty'], p['totalintensity'] * error))
 print('}')
+
+print('''
+TEST(GeoLookupTest, field)
+{
+	MagFieldLookup lookup;
+
+	// slowly moving position, crossing grid cells and the date line
+	for (float latitude_deg = -89.f, longitude_deg = 170.f; latitude_deg < 89.f; latitude_deg += 0.37f) {
+		longitude_deg += 0.53f;
+		const float longitude_wrapped_deg = (longitude_deg > 180.f) ? longitude_deg - 360.f : longitude_deg;
+
+		const MagField field = get_mag_field(latitude_deg, longitude_wrapped_deg);
+		const MagField field_cached = lookup.get(latitude_deg, longitude_wrapped_deg);
+
+		EXPECT_FLOAT_EQ(field.declination_deg, get_mag_declination_degrees(latitude_deg, longitude_wrapped_deg));
+		EXPECT_FLOAT_EQ(field.inclination_deg, get_mag_inclination_degrees(latitude_deg, longitude_wrapped_deg));
+		EXPECT_FLOAT_EQ(field.strength_gauss, get_mag_strength_gauss(latitude_deg, longitude_wrapped_deg));
+
+		EXPECT_FLOAT_EQ(field_cached.declination_deg, field.declination_deg);
+		EXPECT_FLOAT_EQ(field_cached.inclination_deg, field.inclination_deg);
+		EXPECT_FLOAT_EQ(field_cached.strength_gauss, field.strength_gauss);
+	}
+}''')
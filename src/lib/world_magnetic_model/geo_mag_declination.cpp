@@ -66,7 +66,14 @@ static unsigned get_lookup_table_index(float *val, float min, float max)
 	return static_cast<unsigned>((-(min) + *val) / SAMPLING_RES);
 }
 
-static float get_table_data(float latitude_deg, float longitude_deg, const int16_t table[LAT_DIM][LON_DIM])
+struct TableCell {
+	unsigned lat_index;
+	unsigned lon_index;
+	float lat_scale;
+	float lon_scale;
+};
+
+static TableCell get_table_cell(float latitude_deg, float longitude_deg)
 {
 	latitude_deg = math::constrain(latitude_deg, SAMPLING_MIN_LAT, SAMPLING_MAX_LAT);
 
@@ -82,23 +89,52 @@ static float get_table_data(float latitude_deg, float longitude_deg, const int16
 	float min_lat = floorf(latitude_deg / SAMPLING_RES) * SAMPLING_RES;
 	float min_lon = floorf(longitude_deg / SAMPLING_RES) * SAMPLING_RES;
 
+	TableCell cell;
+
 	/* find index of nearest low sampling point */
-	unsigned min_lat_index = get_lookup_table_index(&min_lat, SAMPLING_MIN_LAT, SAMPLING_MAX_LAT);
-	unsigned min_lon_index = get_lookup_table_index(&min_lon, SAMPLING_MIN_LON, SAMPLING_MAX_LON);
+	cell.lat_index = get_lookup_table_index(&min_lat, SAMPLING_MIN_LAT, SAMPLING_MAX_LAT);
+	cell.lon_index = get_lookup_table_index(&min_lon, SAMPLING_MIN_LON, SAMPLING_MAX_LON);
+
+	/* scales of the bilinear interpolation on the four grid corners */
+	cell.lat_scale = constrain((latitude_deg - min_lat) / SAMPLING_RES, 0.f, 1.f);
+	cell.lon_scale = constrain((longitude_deg - min_lon) / SAMPLING_RES, 0.f, 1.f);
+
+	return cell;
+}
+
+static void get_table_corners(const TableCell &cell, const int16_t table[LAT_DIM][LON_DIM], float corners[4])
+{
+	corners[0] = table[cell.lat_index][cell.lon_index];         // sw
+	corners[1] = table[cell.lat_index][cell.lon_index + 1];     // se
+	corners[2] = table[cell.lat_index + 1][cell.lon_index + 1]; // ne
+	corners[3] = table[cell.lat_index + 1][cell.lon_index];     // nw
+}
+
+static float interpolate(const TableCell &cell, const float corners[4])
+{
+	const float data_min = cell.lon_scale * (corners[1] - corners[0]) + corners[0];
+	const float data_max = cell.lon_scale * (corners[2] - corners[3]) + corners[3];
 
-	const float data_sw = table[min_lat_index][min_lon_index];
-	const float data_se = table[min_lat_index][min_lon_index + 1];
-	const float data_ne = table[min_lat_index + 1][min_lon_index + 1];
-	const float data_nw = table[min_lat_index + 1][min_lon_index];
+	return cell.lat_scale * (data_max - data_min) + data_min;
+}
+
+static float get_table_data(float latitude_deg, float longitude_deg, const int16_t table[LAT_DIM][LON_DIM])
+{
+	const TableCell cell = get_table_cell(latitude_deg, longitude_deg);
 
-	/* perform bilinear interpolation on the four grid corners */
-	const float lat_scale = constrain((latitude_deg - min_lat) / SAMPLING_RES, 0.f, 1.f);
-	const float lon_scale = constrain((longitude_deg - min_lon) / SAMPLING_RES, 0.f, 1.f);
+	float corners[4];
+	get_table_corners(cell, table, corners);
 
-	const float data_min = lon_scale * (data_se - data_sw) + data_sw;
-	const float data_max = lon_scale * (data_ne - data_nw) + data_nw;
+	return interpolate(cell, corners);
+}
 
-	return lat_scale * (data_max - data_min) + data_min;
+static MagField interpolate_field(const TableCell &cell, const float corners[3][4])
+{
+	// tables stored as scaled degrees and scaled nanotesla, 1 Gauss = 1e-4 Tesla
+	return MagField{
+		interpolate(cell, corners[0]) * WMM_DECLINATION_SCALE_TO_DEGREES,
+		interpolate(cell, corners[1]) * WMM_INCLINATION_SCALE_TO_DEGREES,
+		interpolate(cell, corners[2]) * WMM_TOTALINTENSITY_SCALE_TO_NANOTESLA * 1e-9f * 1e4f};
 }
 
 float get_mag_declination_degrees(float latitude_deg, float longitude_deg)
@@ -125,3 +161,31 @@ float get_mag_strength_tesla(float latitude_deg, float longitude_deg)
 	return get_table_data(latitude_deg, longitude_deg, totalintensity_table)
 	       * WMM_TOTALINTENSITY_SCALE_TO_NANOTESLA * 1e-9f;
 }
+
+MagField get_mag_field(float latitude_deg, float longitude_deg)
+{
+	const TableCell cell = get_table_cell(latitude_deg, longitude_deg);
+
+	float corners[3][4];
+	get_table_corners(cell, declination_table, corners[0]);
+	get_table_corners(cell, inclination_table, corners[1]);
+	get_table_corners(cell, totalintensity_table, corners[2]);
+
+	return interpolate_field(cell, corners);
+}
+
+MagField MagFieldLookup::get(float latitude_deg, float longitude_deg)
+{
+	const TableCell cell = get_table_cell(latitude_deg, longitude_deg);
+
+	if ((cell.lat_index != _lat_index) || (cell.lon_index != _lon_index)) {
+		get_table_corners(cell, declination_table, _corners[0]);
+		get_table_corners(cell, inclination_table, _corners[1]);
+		get_table_corners(cell, totalintensity_table, _corners[2]);
+
+		_lat_index = cell.lat_index;
+		_lon_index = cell.lon_index;
+	}
+
+	return interpolate_field(cell, _corners);
+}
@@ -41,6 +41,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 // Return magnetic declination in degrees
 float get_mag_declination_degrees(float latitude_deg, float longitude_deg);
 
@@ -50,3 +52,33 @@ float get_mag_inclination_degrees(float latitude_deg, float longitude_deg);
 // return magnetic field strength in Gauss or Tesla
 float get_mag_strength_gauss(float latitude_deg, float longitude_deg);
 float get_mag_strength_tesla(float latitude_deg, float longitude_deg);
+
+struct MagField {
+	float declination_deg;
+	float inclination_deg;
+	float strength_gauss;
+};
+
+// Return magnetic declination, inclination and strength, sharing the table lookup
+MagField get_mag_field(float latitude_deg, float longitude_deg);
+
+/**
+ * Magnetic field lookup keeping the table values of the last grid cell,
+ * for callers that repeatedly query the field at a slowly changing position.
+ * The tables are only read again when the position moves to another cell.
+ * Each instance is meant to be used by a single caller (no locking).
+ */
+class MagFieldLookup
+{
+public:
+	MagField get(float latitude_deg, float longitude_deg);
+
+private:
+	static constexpr unsigned INVALID_INDEX = UINT16_MAX;
+
+	unsigned _lat_index{INVALID_INDEX};
+	unsigned _lon_index{INVALID_INDEX};
+
+	// sw, se, ne, nw corners of the declination, inclination and total intensity tables
+	float _corners[3][4] {};
+};
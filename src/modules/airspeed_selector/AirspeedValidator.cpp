@@ -47,12 +47,8 @@ AirspeedValidator::AirspeedValidator()
 void
 AirspeedValidator::update_airspeed_validator(const airspeed_validator_update_data &input_data)
 {
-	// get indicated airspeed from input data (raw airspeed)
-	_IAS = input_data.airspeed_indicated_raw;
-
 	update_CAS_scale_validated(input_data.gnss_valid, input_data.ground_velocity, input_data.airspeed_true_raw);
-	update_CAS_scale_applied();
-	update_CAS_TAS(input_data.air_pressure_pa, input_data.air_temperature_celsius);
+	update_airspeed_measurement(input_data);
 	update_wind_estimator(input_data.timestamp, input_data.airspeed_true_raw, input_data.gnss_valid,
 			      input_data.ground_velocity, input_data.lpos_evh, input_data.lpos_evv, input_data.q_att);
 	update_in_fixed_wing_flight(input_data.in_fixed_wing_flight);
@@ -65,6 +61,16 @@ AirspeedValidator::update_airspeed_validator(const airspeed_validator_update_dat
 	update_airspeed_valid_status(input_data.timestamp);
 }
 
+void
+AirspeedValidator::update_airspeed_measurement(const airspeed_validator_update_data &input_data)
+{
+	// get indicated airspeed from input data (raw airspeed)
+	_IAS = input_data.airspeed_indicated_raw;
+
+	update_CAS_scale_applied();
+	update_CAS_TAS(input_data.air_pressure_pa, input_data.air_temperature_celsius);
+}
+
 void
 AirspeedValidator::reset_airspeed_to_invalid(const uint64_t timestamp)
 {
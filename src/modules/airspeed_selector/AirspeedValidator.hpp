@@ -81,6 +81,12 @@ public:
 
 	void update_airspeed_validator(const airspeed_validator_update_data &input_data);
 
+	/**
+	 * Only convert the raw measurement to CAS/TAS, without running the wind and scale estimator or the checks.
+	 * Used for sensors that can't be selected, e.g. when switching between sensors is disabled.
+	 */
+	void update_airspeed_measurement(const airspeed_validator_update_data &input_data);
+
 	void reset_airspeed_to_invalid(const uint64_t timestamp);
 
 	float get_IAS() { return _IAS; }
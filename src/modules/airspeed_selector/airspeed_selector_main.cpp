@@ -227,6 +227,7 @@ private:
 	void update_ground_minus_wind_airspeed(); /**< update airspeed estimate based on groundspeed minus windspeed */
 	void select_airspeed_and_publish(); /**< select airspeed sensor (or groundspeed-windspeed) */
 	float get_synthetic_airspeed(float throttle);
+	bool airspeed_switching_allowed(); /**< true if another sensor can be selected when the current one becomes invalid */
 	void update_throttle_filter(hrt_abstime t_now);
 };
 
@@ -397,9 +398,15 @@ AirspeedModule::Run()
 		input_data.fixed_wing_throttle_filtered = _throttle_filtered.getState();
 		input_data.fixed_wing_tecs_throttle_trim = _tecs_status.throttle_trim;
 
+		const bool switching_allowed = airspeed_switching_allowed();
+
 		// iterate through all airspeed sensors, poll new data from them and update their validators
 		for (int i = 0; i < _number_of_airspeed_sensors; i++) {
 
+			// Only the selected sensor and the sensors that could be switched to need the wind/scale estimator
+			// and the checks, the others only convert their raw measurement.
+			const bool candidate = switching_allowed || static_cast<int>(_valid_airspeed_src) == i + 1;
+
 			// poll raw airspeed topic of the i-th sensor
 			airspeed_s airspeed_raw;
 
@@ -432,7 +439,12 @@ AirspeedModule::Run()
 				input_data.in_fixed_wing_flight = (in_air_fixed_wing && !_in_takeoff_situation);
 
 				// push input data into airspeed validator
-				_airspeed_validator[i].update_airspeed_validator(input_data);
+				if (candidate) {
+					_airspeed_validator[i].update_airspeed_validator(input_data);
+
+				} else {
+					_airspeed_validator[i].update_airspeed_measurement(input_data);
+				}
 
 				_time_last_airspeed_update[i] = _time_now_usec;
 
@@ -658,9 +670,7 @@ void AirspeedModule::select_airspeed_and_publish()
 		airspeed_sensor_switching_necessary = !_airspeed_validator[prev_airspeed_index - 1].get_airspeed_valid();
 	}
 
-	const bool airspeed_sensor_switching_allowed = _number_of_airspeed_sensors > 0 &&
-			_param_airspeed_primary_index.get() > static_cast<int>(AirspeedSource::GROUND_MINUS_WIND)
-			&& _param_airspeed_checks_on.get();
+	const bool airspeed_sensor_switching_allowed = _number_of_airspeed_sensors > 0 && airspeed_switching_allowed();
 
 	const bool airspeed_sensor_added = _prev_number_of_airspeed_sensors < _number_of_airspeed_sensors;
 
@@ -815,6 +825,12 @@ void AirspeedModule::select_airspeed_and_publish()
 
 }
 
+bool AirspeedModule::airspeed_switching_allowed()
+{
+	return _param_airspeed_primary_index.get() > static_cast<int>(AirspeedSource::GROUND_MINUS_WIND)
+	       && _param_airspeed_checks_on.get();
+}
+
 float AirspeedModule::get_synthetic_airspeed(float throttle)
 {
 	float synthetic_airspeed;
@@ -1950,6 +1950,12 @@ void Commander::run()
 				_status_changed = true;
 			}
 
+			if (pre_flight_checks_pass && !_armable_after_boot_reported) {
+				// boot-to-armable time, to track the system startup duration
+				PX4_INFO("armable %.2f s after boot", (double)now * 1e-6);
+				_armable_after_boot_reported = true;
+			}
+
 			perf_end(_preflight_check_perf);
 			checkAndInformReadyForTakeoff();
 		}
@@ -257,6 +257,7 @@ private:
 	hrt_abstime _high_latency_datalink_regained{0};
 
 	hrt_abstime _boot_timestamp{0};
+	bool _armable_after_boot_reported{false};
 	hrt_abstime _last_disarmed_timestamp{0};
 	hrt_abstime _overload_start{0};		///< time when CPU overload started
 
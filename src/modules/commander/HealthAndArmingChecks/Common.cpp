@@ -85,7 +85,7 @@ Report::EventBufferHeader *Report::addEventToBuffer(uint32_t event_id, const eve
 		uint32_t modes, unsigned args_size)
 {
 	unsigned total_size = sizeof(EventBufferHeader) + args_size;
-	EventBufferHeader *header = (EventBufferHeader *)(_event_buffer + _next_buffer_idx);
+	EventBufferHeader *header = (EventBufferHeader *)(eventBuffer() + _next_buffer_idx);
 	memcpy(&header->id, &event_id, sizeof(event_id)); // header might be unaligned
 	header->log_levels = ((uint8_t)log_levels.internal << 4) | (uint8_t)log_levels.external;
 	header->size = args_size;
@@ -106,13 +106,13 @@ bool Report::addExternalEvent(const event_s &event, NavModes modes)
 
 	unsigned total_size = sizeof(EventBufferHeader) + args_size;
 
-	if (total_size > sizeof(_event_buffer) - _next_buffer_idx) {
+	if (total_size > sizeof(_event_buffer[0]) - _next_buffer_idx) {
 		_buffer_overflowed = true;
 		return false;
 	}
 
 	events::LogLevels log_levels{events::externalLogLevel(event.log_levels), events::internalLogLevel((event.log_levels))};
-	memcpy(_event_buffer + _next_buffer_idx + sizeof(EventBufferHeader), &event.arguments, args_size);
+	memcpy(eventBuffer() + _next_buffer_idx + sizeof(EventBufferHeader), &event.arguments, args_size);
 	addEventToBuffer(event.id, log_levels, (uint32_t)modes, args_size);
 	return true;
 }
@@ -207,6 +207,56 @@ void Report::reset()
 	_results_changed = false;
 }
 
+void Report::Results::merge(const Results &other)
+{
+	health.is_present = health.is_present | other.health.is_present;
+	health.error = health.error | other.health.error;
+	health.warning = health.warning | other.health.warning;
+	arming_checks.error = arming_checks.error | other.arming_checks.error;
+	arming_checks.warning = arming_checks.warning | other.arming_checks.warning;
+	arming_checks.can_arm = arming_checks.can_arm & other.arming_checks.can_arm;
+	arming_checks.can_run = arming_checks.can_run & other.arming_checks.can_run;
+	num_events += other.num_events;
+	event_id_hash ^= other.event_id_hash;
+}
+
+void Report::beginCachedCheck(Results &accumulated_results)
+{
+	accumulated_results = _results[_current_result];
+	_results[_current_result].reset();
+	_cached_check_buffer_idx = _next_buffer_idx;
+}
+
+void Report::endCachedCheck(const Results &accumulated_results, CachedResults &cache)
+{
+	cache.results = _results[_current_result];
+	cache.event_buffer_idx = _cached_check_buffer_idx;
+	cache.event_buffer_size = _next_buffer_idx - _cached_check_buffer_idx;
+	cache.valid = true;
+
+	_results[_current_result] = accumulated_results;
+	_results[_current_result].merge(cache.results);
+}
+
+void Report::replayCachedCheck(CachedResults &cache)
+{
+	// the events of the last run are in the other buffer
+	const uint8_t *previous_buffer = _event_buffer[(_current_result + 1) % 2];
+
+	if (cache.event_buffer_size > (int)sizeof(_event_buffer[0]) - _next_buffer_idx) {
+		// the events are lost, run the check again next time
+		_buffer_overflowed = true;
+		cache.valid = false;
+
+	} else {
+		memcpy(eventBuffer() + _next_buffer_idx, previous_buffer + cache.event_buffer_idx, cache.event_buffer_size);
+		cache.event_buffer_idx = _next_buffer_idx;
+		_next_buffer_idx += cache.event_buffer_size;
+	}
+
+	_results[_current_result].merge(cache.results);
+}
+
 void Report::prepare(uint8_t vehicle_type)
 {
 	// Get mode requirements before running any checks (in particular the mode checks require them)
@@ -295,10 +345,10 @@ bool Report::report(bool force)
 	event_s event;
 
 	for (int i = 0; i < max_num_events && offset < _next_buffer_idx; ++i) {
-		EventBufferHeader *header = (EventBufferHeader *)(_event_buffer + offset);
+		EventBufferHeader *header = (EventBufferHeader *)(eventBuffer() + offset);
 		memcpy(&event.id, &header->id, sizeof(event.id));
 		event.log_levels = header->log_levels;
-		memcpy(event.arguments, _event_buffer + offset + sizeof(EventBufferHeader), header->size);
+		memcpy(event.arguments, eventBuffer() + offset + sizeof(EventBufferHeader), header->size);
 		memset(event.arguments + header->size, 0, sizeof(event.arguments) - header->size);
 		events::send(event);
 		offset += sizeof(EventBufferHeader) + header->size;
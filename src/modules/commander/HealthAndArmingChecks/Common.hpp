@@ -303,8 +303,26 @@ private:
 			return health != other.health || arming_checks != other.arming_checks ||
 			       num_events != other.num_events || event_id_hash != other.event_id_hash;
 		}
+
+		/**
+		 * Combine with the results of other checks (all the results only accumulate failures)
+		 */
+		void merge(const Results &other);
 	};
 
+public:
+	/**
+	 * Results of a single check from its last run, so it can be skipped while its inputs don't change
+	 */
+	struct CachedResults {
+		Results results;
+		int event_buffer_idx{0}; ///< start of the events of the check in the event buffer of the last run
+		int event_buffer_size{0};
+		bool valid{false};
+	};
+
+private:
+
 	struct __attribute__((__packed__)) EventBufferHeader {
 		uint8_t size; ///< arguments size
 		uint32_t id;
@@ -327,6 +345,20 @@ private:
 
 	NavModes getModeGroup(uint8_t nav_state) const;
 
+	uint8_t *eventBuffer() { return _event_buffer[_current_result]; }
+
+	/**
+	 * Run a check in isolation (so its results can be cached), by saving the results of the previous checks
+	 * to accumulated_results before, and merging them back after running it
+	 */
+	void beginCachedCheck(Results &accumulated_results);
+	void endCachedCheck(const Results &accumulated_results, CachedResults &cache);
+
+	/**
+	 * Add the results of a check from its last run instead of running it
+	 */
+	void replayCachedCheck(CachedResults &cache);
+
 	friend class HealthAndArmingChecks;
 	friend class ExternalChecks;
 	FRIEND_TEST(ReporterTest, basic_no_checks);
@@ -360,10 +392,11 @@ private:
 
 	const hrt_abstime _min_reporting_interval;
 
-	/// event buffer: stores current events + arguments.
+	/// event buffers: store current and previous events + arguments (same index as _results).
 	/// Since the amount of extra arguments varies, 4 bytes is used here as estimate
-	uint8_t _event_buffer[(event_s::ORB_QUEUE_LENGTH - 2) * (sizeof(EventBufferHeader) + 1 + 1 + 4)];
+	uint8_t _event_buffer[2][(event_s::ORB_QUEUE_LENGTH - 2) * (sizeof(EventBufferHeader) + 1 + 1 + 4)];
 	int _next_buffer_idx{0};
+	int _cached_check_buffer_idx{0}; ///< start of the events of the check run by beginCachedCheck()
 	bool _buffer_overflowed{false};
 
 	bool _already_reported{false};
@@ -403,12 +436,12 @@ bool Report::addEvent(uint32_t event_id, const events::LogLevels &log_levels, co
 	static_assert(args_size <= sizeof(event_s::arguments), "Too many arguments");
 	unsigned total_size = sizeof(EventBufferHeader) + args_size;
 
-	if (total_size > sizeof(_event_buffer) - _next_buffer_idx) {
+	if (total_size > sizeof(_event_buffer[0]) - _next_buffer_idx) {
 		_buffer_overflowed = true;
 		return false;
 	}
 
-	events::util::fillEventArguments(_event_buffer + _next_buffer_idx + sizeof(EventBufferHeader), modes, args...);
+	events::util::fillEventArguments(eventBuffer() + _next_buffer_idx + sizeof(EventBufferHeader), modes, args...);
 	// We split out the part of the code not requiring templating to reduce flash usage a bit
 	EventBufferHeader *header = addEventToBuffer(event_id, log_levels, modes, args_size);
 #ifdef CONSOLE_PRINT_ARMING_CHECK_EVENT
@@ -432,5 +465,42 @@ public:
 
 	virtual void checkAndReport(const Context &context, Report &reporter) = 0;
 
+	/**
+	 * Checks that only depend on topic updates, parameters, the vehicle status and the arming request
+	 * can be skipped while these don't change, reusing the results of their last run.
+	 * @return storage for the results of the last run, nullptr if the check needs to run every time
+	 */
+	virtual Report::CachedResults *cachedResults() { return nullptr; }
+
+	/**
+	 * @return true if a topic or other input (besides parameters, vehicle status and arming request)
+	 * of the check changed since its last run. Only used if cachedResults() is not nullptr.
+	 */
+	virtual bool inputsChanged(Report &reporter) { return true; }
+
 	void updateParams() override { ModuleParams::updateParams(); }
 };
+
+/**
+ * @class CachedHealthAndArmingCheckBase
+ * Base class for checks which are only run when their inputs change
+ */
+class CachedHealthAndArmingCheckBase : public HealthAndArmingCheckBase
+{
+public:
+	CachedHealthAndArmingCheckBase() = default;
+	~CachedHealthAndArmingCheckBase() = default;
+
+	Report::CachedResults *cachedResults() override { return &_cached_results; }
+
+	bool inputsChanged(Report &reporter) override = 0;
+
+	void updateParams() override
+	{
+		HealthAndArmingCheckBase::updateParams();
+		_cached_results.valid = false;
+	}
+
+private:
+	Report::CachedResults _cached_results{};
+};
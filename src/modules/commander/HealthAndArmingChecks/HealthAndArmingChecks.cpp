@@ -62,13 +62,13 @@ bool HealthAndArmingChecks::update(bool force_reporting, bool is_arming_request)
 
 	_context.setIsArmingRequest(is_arming_request);
 
-	for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
-		if (!_checks[i]) {
-			break;
-		}
+	// cached checks only need to run if their inputs changed, or anything in the vehicle status
+	vehicle_status_s status = _context.status();
+	status.timestamp = 0;
+	const bool status_changed = memcmp(&status, &_last_status, sizeof(status)) != 0;
+	_last_status = status;
 
-		_checks[i]->checkAndReport(_context, _reporter);
-	}
+	runChecks(force_reporting || is_arming_request || status_changed);
 
 	const bool results_changed = _reporter.finalize();
 	const bool reported = _reporter.report(force_reporting);
@@ -84,13 +84,7 @@ bool HealthAndArmingChecks::update(bool force_reporting, bool is_arming_request)
 
 		_reporter.prepare(vehicle_type);
 
-		for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
-			if (!_checks[i]) {
-				break;
-			}
-
-			_checks[i]->checkAndReport(_context, _reporter);
-		}
+		runChecks(true);
 
 		_reporter.finalize();
 		_reporter.report(false);
@@ -114,6 +108,30 @@ bool HealthAndArmingChecks::update(bool force_reporting, bool is_arming_request)
 	return reported;
 }
 
+void HealthAndArmingChecks::runChecks(bool run_all)
+{
+	for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
+		if (!_checks[i]) {
+			break;
+		}
+
+		Report::CachedResults *cache = _checks[i]->cachedResults();
+
+		if (cache == nullptr) {
+			_checks[i]->checkAndReport(_context, _reporter);
+
+		} else if (!run_all && cache->valid && !_checks[i]->inputsChanged(_reporter)) {
+			_reporter.replayCachedCheck(*cache);
+
+		} else {
+			Report::Results accumulated_results;
+			_reporter.beginCachedCheck(accumulated_results);
+			_checks[i]->checkAndReport(_context, _reporter);
+			_reporter.endCachedCheck(accumulated_results, *cache);
+		}
+	}
+}
+
 void HealthAndArmingChecks::updateParams()
 {
 	for (unsigned i = 0; i < sizeof(_checks) / sizeof(_checks[0]); ++i) {
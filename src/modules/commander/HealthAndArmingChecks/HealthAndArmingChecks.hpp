@@ -116,7 +116,13 @@ public:
 protected:
 	void updateParams() override;
 private:
+	/**
+	 * Run all checks, or reuse the last results of cached checks with unchanged inputs if run_all is false
+	 */
+	void runChecks(bool run_all);
+
 	failsafe_flags_s _failsafe_flags{};
+	vehicle_status_s _last_status{}; ///< to rerun cached checks on vehicle status changes
 
 	Context _context;
 	Report _reporter{_failsafe_flags};
@@ -98,6 +98,8 @@ void GeofenceChecks::checkAndReport(const Context &context, Report &reporter)
 		}
 	}
 
+	_home_position_invalid = reporter.failsafeFlags().home_position_invalid;
+
 	if (geofence_result.geofence_action == geofence_result_s::GF_ACTION_RTL
 	    && reporter.failsafeFlags().home_position_invalid) {
 		/* EVENT
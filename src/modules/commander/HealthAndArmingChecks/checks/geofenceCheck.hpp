@@ -38,7 +38,7 @@
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/geofence_result.h>
 
-class GeofenceChecks : public HealthAndArmingCheckBase
+class GeofenceChecks : public CachedHealthAndArmingCheckBase
 {
 public:
 	GeofenceChecks() = default;
@@ -46,6 +46,13 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsChanged(Report &reporter) override
+	{
+		return _geofence_result_sub.updated() || (reporter.failsafeFlags().home_position_invalid != _home_position_invalid);
+	}
+
 private:
 	uORB::Subscription _geofence_result_sub{ORB_ID(geofence_result)};
+
+	bool _home_position_invalid{true}; ///< home_position_invalid flag of the last run
 };
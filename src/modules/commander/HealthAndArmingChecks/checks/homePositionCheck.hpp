@@ -38,7 +38,7 @@
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/home_position.h>
 
-class HomePositionChecks : public HealthAndArmingCheckBase
+class HomePositionChecks : public CachedHealthAndArmingCheckBase
 {
 public:
 	HomePositionChecks() = default;
@@ -46,6 +46,8 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsChanged(Report &reporter) override { return _home_position_sub.updated(); }
+
 private:
 	uORB::Subscription _home_position_sub{ORB_ID(home_position)};
 };
@@ -38,7 +38,7 @@
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/sensors_status_imu.h>
 
-class ImuConsistencyChecks : public HealthAndArmingCheckBase
+class ImuConsistencyChecks : public CachedHealthAndArmingCheckBase
 {
 public:
 	ImuConsistencyChecks() = default;
@@ -46,10 +46,12 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsChanged(Report &reporter) override { return _sensors_status_imu_sub.updated(); }
+
 private:
 	uORB::Subscription _sensors_status_imu_sub{ORB_ID(sensors_status_imu)};
 
-	DEFINE_PARAMETERS_CUSTOM_PARENT(HealthAndArmingCheckBase,
+	DEFINE_PARAMETERS_CUSTOM_PARENT(CachedHealthAndArmingCheckBase,
 					(ParamFloat<px4::params::COM_ARM_IMU_ACC>) _param_com_arm_imu_acc,
 					(ParamFloat<px4::params::COM_ARM_IMU_GYR>) _param_com_arm_imu_gyr
 				       )
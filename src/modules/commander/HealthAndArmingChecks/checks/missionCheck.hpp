@@ -38,7 +38,7 @@
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/mission_result.h>
 
-class MissionChecks : public HealthAndArmingCheckBase
+class MissionChecks : public CachedHealthAndArmingCheckBase
 {
 public:
 	MissionChecks() = default;
@@ -46,6 +46,8 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsChanged(Report &reporter) override { return _mission_result_sub.updated(); }
+
 private:
 	uORB::Subscription _mission_result_sub{ORB_ID(mission_result)};
 };
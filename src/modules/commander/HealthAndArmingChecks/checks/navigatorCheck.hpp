@@ -38,7 +38,7 @@
 #include <uORB/topics/navigator_status.h>
 
 
-class NavigatorChecks : public HealthAndArmingCheckBase
+class NavigatorChecks : public CachedHealthAndArmingCheckBase
 {
 public:
 	NavigatorChecks() = default;
@@ -46,6 +46,8 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsChanged(Report &reporter) override { return _navigator_status_sub.updated(); }
+
 private:
 	uORB::Subscription _navigator_status_sub{ORB_ID(navigator_status)};
 };
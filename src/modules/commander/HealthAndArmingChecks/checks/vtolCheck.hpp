@@ -38,7 +38,7 @@
 #include <uORB/Subscription.hpp>
 #include <uORB/topics/vtol_vehicle_status.h>
 
-class VtolChecks : public HealthAndArmingCheckBase
+class VtolChecks : public CachedHealthAndArmingCheckBase
 {
 public:
 	VtolChecks() = default;
@@ -46,6 +46,8 @@ public:
 
 	void checkAndReport(const Context &context, Report &reporter) override;
 
+	bool inputsChanged(Report &reporter) override { return _vtol_vehicle_status_sub.updated(); }
+
 private:
 	uORB::Subscription _vtol_vehicle_status_sub{ORB_ID(vtol_vehicle_status)};
 };
@@ -89,6 +89,17 @@ int param_get(param_t param, void *val)
 	return -1;
 }
 
+uint32_t param_generation()
+{
+	return 0;
+}
+
+bool param_changed_since(param_t param, uint32_t generation)
+{
+	// values are modified directly in set_param_value(), always read them
+	return true;
+}
+
 void param_set_used(param_t param)
 {
 	std::map<param_t, Param> &used_params = failsafe_instance.params();
@@ -203,59 +203,61 @@ void FailureDetector::updateEscsStatus(const vehicle_status_s &vehicle_status, c
 
 void FailureDetector::updateImbalancedPropStatus()
 {
-
 	if (_sensor_selection_sub.updated()) {
 		sensor_selection_s selection;
 
-		if (_sensor_selection_sub.copy(&selection)) {
+		if (_sensor_selection_sub.copy(&selection) && (selection.accel_device_id != _selected_accel_device_id)) {
 			_selected_accel_device_id = selection.accel_device_id;
+			_imu_status_instance_found = false;
 		}
 	}
 
-	const bool updated = _vehicle_imu_status_sub.updated(); // save before doing a copy
-
-	// Find the imu_status instance corresponding to the selected accelerometer
-	vehicle_imu_status_s imu_status{};
-	_vehicle_imu_status_sub.copy(&imu_status);
+	if (_selected_accel_device_id == 0) {
+		return;
+	}
 
-	if (imu_status.accel_device_id != _selected_accel_device_id) {
+	vehicle_imu_status_s imu_status;
 
+	// Find the imu_status instance corresponding to the selected accelerometer, only after a selection change
+	if (!_imu_status_instance_found) {
 		for (unsigned i = 0; i < ORB_MULTI_MAX_INSTANCES; i++) {
-			if (!_vehicle_imu_status_sub.ChangeInstance(i)) {
-				continue;
-			}
-
-			if (_vehicle_imu_status_sub.copy(&imu_status)
+			if (_vehicle_imu_status_sub.ChangeInstance(i)
+			    && _vehicle_imu_status_sub.copy(&imu_status)
 			    && (imu_status.accel_device_id == _selected_accel_device_id)) {
-				// instance found
+				_imu_status_instance_found = true;
 				break;
 			}
 		}
+
+		if (!_imu_status_instance_found) {
+			return;
+		}
 	}
 
-	if (updated) {
+	// vehicle_imu_status already contains the accel variance over the publication interval,
+	// so only new publications need to be processed
+	if (_vehicle_imu_status_sub.update(&imu_status)) {
 
-		if (_vehicle_imu_status_sub.copy(&imu_status)) {
+		if (imu_status.accel_device_id != _selected_accel_device_id) {
+			_imu_status_instance_found = false;
+			return;
+		}
 
-			if ((imu_status.accel_device_id != 0)
-			    && (imu_status.accel_device_id == _selected_accel_device_id)) {
-				const float dt = math::constrain((imu_status.timestamp - _imu_status_timestamp_prev) * 1e-6f, 0.01f, 1.f);
-				_imu_status_timestamp_prev = imu_status.timestamp;
+		const float dt = math::constrain((imu_status.timestamp - _imu_status_timestamp_prev) * 1e-6f, 0.01f, 1.f);
+		_imu_status_timestamp_prev = imu_status.timestamp;
 
-				_imbalanced_prop_lpf.setParameters(dt, _imbalanced_prop_lpf_time_constant);
+		_imbalanced_prop_lpf.setParameters(dt, _imbalanced_prop_lpf_time_constant);
 
-				const float std_x = sqrtf(math::max(imu_status.var_accel[0], 0.f));
-				const float std_y = sqrtf(math::max(imu_status.var_accel[1], 0.f));
-				const float std_z = sqrtf(math::max(imu_status.var_accel[2], 0.f));
+		const float std_x = sqrtf(math::max(imu_status.var_accel[0], 0.f));
+		const float std_y = sqrtf(math::max(imu_status.var_accel[1], 0.f));
+		const float std_z = sqrtf(math::max(imu_status.var_accel[2], 0.f));
 
-				// Note: the metric is done using standard deviations instead of variances to be linear
-				const float metric = (std_x + std_y) / 2.f - std_z;
-				const float metric_lpf = _imbalanced_prop_lpf.update(metric);
+		// Note: the metric is done using standard deviations instead of variances to be linear
+		const float metric = (std_x + std_y) / 2.f - std_z;
+		const float metric_lpf = _imbalanced_prop_lpf.update(metric);
 
-				const bool is_imbalanced = metric_lpf > _param_fd_imb_prop_thr.get();
-				_failure_detector_status.flags.imbalanced_prop = is_imbalanced;
-			}
-		}
+		const bool is_imbalanced = metric_lpf > _param_fd_imb_prop_thr.get();
+		_failure_detector_status.flags.imbalanced_prop = is_imbalanced;
 	}
 }
 
@@ -108,6 +108,7 @@ private:
 	static constexpr float _imbalanced_prop_lpf_time_constant{5.f};
 	AlphaFilter<float> _imbalanced_prop_lpf{};
 	uint32_t _selected_accel_device_id{0};
+	bool _imu_status_instance_found{false};
 	hrt_abstime _imu_status_timestamp_prev{0};
 
 	// Motor failure check
@@ -50,7 +50,7 @@ void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 	float fit1 = 0.f;
 	float fit2 = 0.f;
 
-	matrix::SquareMatrix<float, 4> JTJ;
+	matrix::SymmetricMatrix<float, 4> JTJ_sym;
 	float JTFI[4] {};
 	float residual = 0.0f;
 
@@ -75,12 +75,10 @@ void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 		sphere_jacob[3] = 1.0f * (((params.offdiag(1) * A) + (params.offdiag(2) * B) + (params.diag(2)    * C)) / length);
 		residual = params.radius - length;
 
-		for (uint8_t i = 0; i < 4; i++) {
-			// compute JTJ
-			for (uint8_t j = 0; j < 4; j++) {
-				JTJ(i, j) += sphere_jacob[i] * sphere_jacob[j];
-			}
+		// compute JTJ, only the upper triangle of the symmetric matrix
+		JTJ_sym.rankOneUpdate(matrix::Vector<float, 4>(sphere_jacob));
 
+		for (uint8_t i = 0; i < 4; i++) {
 			JTFI[i] += sphere_jacob[i] * residual;
 		}
 	}
@@ -91,7 +89,7 @@ void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 	float fit1_params[4] = {params.radius, params.offset(0), params.offset(1), params.offset(2)};
 	float fit2_params[4];
 	memcpy(fit2_params, fit1_params, sizeof(fit1_params));
-	JTJ = (JTJ + JTJ.transpose()) * 0.5f; // fix numerical issues
+	matrix::SquareMatrix<float, 4> JTJ = JTJ_sym.full();
 	matrix::SquareMatrix<float, 4> JTJ2 = JTJ;
 
 	for (uint8_t i = 0; i < 4; i++) {
@@ -99,22 +97,20 @@ void lm_sphere_fit_iteration(const float x[], const float y[], const float z[],
 		JTJ2(i, i) += result.gradient_damping / lma_damping;
 	}
 
-	if (!JTJ.I(JTJ)) {
+	// JTJ is symmetric positive definite, solve JTJ * delta = JTFI with an LDLT decomposition instead of inverting it
+	if (!matrix::ldlt(JTJ) || !matrix::ldlt(JTJ2)) {
 		result.result = iteration_result::STATUS::FAILURE;
 		return;
 	}
 
-	if (!JTJ2.I(JTJ2)) {
-		result.result = iteration_result::STATUS::FAILURE;
-		return;
-
-	}
+	matrix::Vector<float, 4> delta1(JTFI);
+	matrix::Vector<float, 4> delta2(JTFI);
+	matrix::ldltSolve(JTJ, delta1);
+	matrix::ldltSolve(JTJ2, delta2);
 
 	for (uint8_t row = 0; row < 4; row++) {
-		for (uint8_t col = 0; col < 4; col++) {
-			fit1_params[row] -= JTFI[col] * JTJ(row, col);
-			fit2_params[row] -= JTFI[col] * JTJ2(row, col);
-		}
+		fit1_params[row] -= delta1(row);
+		fit2_params[row] -= delta2(row);
 	}
 
 	// Calculate mean squared residuals
@@ -182,7 +178,7 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 	float fit1 = 0.0f;
 	float fit2 = 0.0f;
 
-	matrix::SquareMatrix<float, 9> JTJ;
+	matrix::SymmetricMatrix<float, 9> JTJ_sym;
 	float JTFI[9] {};
 	float residual = 0.0f;
 	float ellipsoid_jacob[9];
@@ -213,12 +209,10 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 		ellipsoid_jacob[7] = -1.0f * (((z[k] - params.offset(2)) * A) + ((x[k] - params.offset(0)) * C)) / length;
 		ellipsoid_jacob[8] = -1.0f * (((z[k] - params.offset(2)) * B) + ((y[k] - params.offset(1)) * C)) / length;
 
-		for (uint8_t i = 0; i < 9; i++) {
-			// compute JTJ
-			for (uint8_t j = 0; j < 9; j++) {
-				JTJ(i, j) += ellipsoid_jacob[i] * ellipsoid_jacob[j];
-			}
+		// compute JTJ, only the upper triangle of the symmetric matrix
+		JTJ_sym.rankOneUpdate(matrix::Vector<float, 9>(ellipsoid_jacob));
 
+		for (uint8_t i = 0; i < 9; i++) {
 			JTFI[i] += ellipsoid_jacob[i] * residual;
 		}
 	}
@@ -229,6 +223,7 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 	float fit1_params[9] = {params.offset(0), params.offset(1), params.offset(2), params.diag(0), params.diag(1), params.diag(2), params.offdiag(0), params.offdiag(1), params.offdiag(2)};
 	float fit2_params[9];
 	memcpy(fit2_params, fit1_params, sizeof(fit1_params));
+	matrix::SquareMatrix<float, 9> JTJ = JTJ_sym.full();
 	matrix::SquareMatrix<float, 9> JTJ2 = JTJ;
 
 	for (uint8_t i = 0; i < 9; i++) {
@@ -237,21 +232,20 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 	}
 
 
-	if (!JTJ.I(JTJ)) {
+	// JTJ is symmetric positive definite, solve JTJ * delta = JTFI with an LDLT decomposition instead of inverting it
+	if (!matrix::ldlt(JTJ) || !matrix::ldlt(JTJ2)) {
 		result.result = iteration_result::STATUS::FAILURE;
 		return;
 	}
 
-	if (!JTJ2.I(JTJ2)) {
-		result.result = iteration_result::STATUS::FAILURE;
-		return;
-	}
+	matrix::Vector<float, 9> delta1(JTFI);
+	matrix::Vector<float, 9> delta2(JTFI);
+	matrix::ldltSolve(JTJ, delta1);
+	matrix::ldltSolve(JTJ2, delta2);
 
 	for (uint8_t row = 0; row < 9; row++) {
-		for (uint8_t col = 0; col < 9; col++) {
-			fit1_params[row] -= JTFI[col] * JTJ(row, col);
-			fit2_params[row] -= JTFI[col] * JTJ2(row, col);
-		}
+		fit1_params[row] -= delta1(row);
+		fit2_params[row] -= delta2(row);
 	}
 
 	// Calculate mean squared residuals
@@ -313,6 +307,51 @@ void lm_ellipsoid_fit_iteration(const float x[], const float y[], const float z[
 
 
 
+void SphereFitAccumulator::reset()
+{
+	_ATA.setZero();
+	_ATb.setZero();
+	_count = 0;
+}
+
+void SphereFitAccumulator::addPoint(float x, float y, float z)
+{
+	const float a[4] {2.f * x, 2.f * y, 2.f * z, 1.f};
+	const matrix::Vector<float, 4> row(a);
+
+	// only the upper triangle of the symmetric matrix
+	_ATA.rankOneUpdate(row);
+	_ATb += row * (x * x + y * y + z * z);
+	_count++;
+}
+
+bool SphereFitAccumulator::solve(sphere_params &params) const
+{
+	if (_count < 4) {
+		return false;
+	}
+
+	matrix::SquareMatrix<float, 4> ATA = _ATA.full();
+
+	if (!matrix::ldlt(ATA)) {
+		return false;
+	}
+
+	matrix::Vector<float, 4> solution(_ATb);
+	matrix::ldltSolve(ATA, solution);
+
+	const matrix::Vector3f offset(solution(0), solution(1), solution(2));
+	const float radius_sq = solution(3) + offset.norm_squared();
+
+	if (!solution.isAllFinite() || radius_sq <= 0.f) {
+		return false;
+	}
+
+	params.offset = offset;
+	params.radius = sqrtf(radius_sq);
+	return true;
+}
+
 int lm_mag_fit(const float x[], const float y[], const float z[], unsigned int samples_collected, sphere_params &params,
 	       bool full_ellipsoid)
 {
@@ -43,6 +43,41 @@ struct sphere_params {
 	float radius{0.2f};
 };
 
+/**
+ * Incremental algebraic least-squares fit of a sphere.
+ *
+ * The sphere equation |p - offset|^2 = radius^2 is linear in (offset, radius^2 - |offset|^2):
+ * 2 * p^T * offset + (radius^2 - |offset|^2) = |p|^2
+ * Its normal equations are accumulated with every new point, so that the fit only requires a 4x4 solve
+ * independent of the number of points. The result is used as initial guess for lm_mag_fit.
+ */
+class SphereFitAccumulator
+{
+public:
+	void reset();
+
+	/**
+	 * Add a point on the sphere surface.
+	 */
+	void addPoint(float x, float y, float z);
+
+	/**
+	 * Solve for the sphere offset and radius of the points added so far.
+	 *
+	 * @param params offset and radius are set on success, the other values are left unchanged
+	 *
+	 * @return true on success, false if the points don't constrain the sphere
+	 */
+	bool solve(sphere_params &params) const;
+
+	unsigned int count() const { return _count; }
+
+private:
+	matrix::SymmetricMatrix<float, 4> _ATA{};
+	matrix::Vector<float, 4> _ATb{};
+	unsigned int _count{0};
+};
+
 
 /**
  * Least-squares fit of a sphere to a set of points.
@@ -94,6 +94,8 @@ struct mag_worker_data_t {
 	float		*y[MAX_MAGS];
 	float		*z[MAX_MAGS];
 
+	SphereFitAccumulator sphere_fit[MAX_MAGS]; ///< Incremental sphere fit of the collected points, initial guess of the LM fit
+
 	calibration::Magnetometer calibration[MAX_MAGS] {};
 };
 
@@ -386,6 +388,8 @@ static calibrate_return mag_calibration_worker(detect_orientation_return orienta
 						worker_data->z[cur_mag][worker_data->calibration_counter_total[cur_mag]] = new_samples[cur_mag](2);
 
 						worker_data->calibration_counter_total[cur_mag]++;
+
+						worker_data->sphere_fit[cur_mag].addPoint(new_samples[cur_mag](0), new_samples[cur_mag](1), new_samples[cur_mag](2));
 					}
 				}
 
@@ -616,6 +620,10 @@ calibrate_return mag_calibrate_all(orb_advert_t *mavlink_log_pub, int32_t cal_ma
 				sphere_data.diag = matrix::Vector3f(diag[cur_mag](0), diag[cur_mag](1), diag[cur_mag](2));
 				sphere_data.offdiag = matrix::Vector3f(offdiag[cur_mag](0), offdiag[cur_mag](1), offdiag[cur_mag](2));
 
+				// start the LM fit from the sphere accumulated during the data collection, which only needs a small solve
+				// and saves LM iterations over all the points
+				worker_data.sphere_fit[cur_mag].solve(sphere_data);
+
 				bool sphere_fit_success = false;
 				bool ellipsoid_fit_success = false;
 				int ret = lm_mag_fit(worker_data.x[cur_mag], worker_data.y[cur_mag], worker_data.z[cur_mag],
@@ -1023,9 +1031,10 @@ int do_mag_calibration_quick(orb_advert_t *mavlink_log_pub, float heading_radian
 
 	} else {
 		// magnetic field data returned by the geo library using the current GPS position
-		const float declination_rad = math::radians(get_mag_declination_degrees(latitude_deg, longitude_deg));
-		const float inclination_rad = math::radians(get_mag_inclination_degrees(latitude_deg, longitude_deg));
-		const float field_strength_gauss = get_mag_strength_gauss(latitude_deg, longitude_deg);
+		const MagField field = get_mag_field(latitude_deg, longitude_deg);
+		const float declination_rad = math::radians(field.declination_deg);
+		const float inclination_rad = math::radians(field.inclination_deg);
+		const float field_strength_gauss = field.strength_gauss;
 
 		const Vector3f mag_earth_pred = Dcmf(Eulerf(0, -inclination_rad, declination_rad))
 						* Vector3f(field_strength_gauss, 0, 0);
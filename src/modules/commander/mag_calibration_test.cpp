@@ -195,6 +195,48 @@ TEST_F(MagCalTest, sphereRegularlySpaced)
 	EXPECT_NEAR(sphere.diag(2), scale_true(2), 0.001f) << "scale Z: " << scale_true(2);
 }
 
+TEST_F(MagCalTest, sphereFitAccumulator)
+{
+	// GIVEN: a dataset of regularly spaced points
+	// on a perfect sphere but not centered on the origin
+	static constexpr unsigned int N_SAMPLES = 240;
+
+	const float mag_str_true = 0.4f;
+	const Vector3f offset_true = {-1.07f, 0.35f, -0.78f};
+	const Vector3f scale_true = {1.f, 1.f, 1.f};
+
+	float x[N_SAMPLES];
+	float y[N_SAMPLES];
+	float z[N_SAMPLES];
+	generateRegularData(x, y, z, N_SAMPLES, mag_str_true);
+	modifyOffsetScale(x, y, z, N_SAMPLES, offset_true, scale_true);
+
+	// WHEN: accumulating the points one by one
+	SphereFitAccumulator accumulator;
+	sphere_params sphere;
+	EXPECT_FALSE(accumulator.solve(sphere));
+
+	for (unsigned int k = 0; k < N_SAMPLES; k++) {
+		accumulator.addPoint(x[k], y[k], z[k]);
+	}
+
+	// THEN: the algebraic fit finds the sphere without iterating over the points again
+	EXPECT_EQ(accumulator.count(), N_SAMPLES);
+	EXPECT_TRUE(accumulator.solve(sphere));
+	EXPECT_NEAR(sphere.radius, mag_str_true, 0.001f) << "radius: " << sphere.radius;
+	EXPECT_NEAR(sphere.offset(0), offset_true(0), 0.001f) << "offset X: " << sphere.offset(0);
+	EXPECT_NEAR(sphere.offset(1), offset_true(1), 0.001f) << "offset Y: " << sphere.offset(1);
+	EXPECT_NEAR(sphere.offset(2), offset_true(2), 0.001f) << "offset Z: " << sphere.offset(2);
+
+	// AND: the LM fit started from it converges
+	EXPECT_EQ(lm_mag_fit(x, y, z, N_SAMPLES, sphere, false), PX4_OK);
+	EXPECT_NEAR(sphere.radius, mag_str_true, 0.001f) << "radius: " << sphere.radius;
+
+	// AND: after a reset, there is nothing to solve
+	accumulator.reset();
+	EXPECT_FALSE(accumulator.solve(sphere));
+}
+
 TEST_F(MagCalTest, replayTestData)
 {
 	// GIVEN: a real test dataset with large offsets
@@ -186,6 +186,10 @@ ControlAllocator::update_allocation_method(bool force)
 				_control_allocation[i] = new ControlAllocationSequentialDesaturation();
 				break;
 
+			case AllocationMethod::ACTIVE_SET:
+				_control_allocation[i] = new ControlAllocationActiveSet();
+				break;
+
 			default:
 				PX4_ERR("Unknown allocation method");
 				break;
@@ -691,14 +695,14 @@ ControlAllocator::publish_actuator_controls()
 		return;
 	}
 
-	actuator_motors_s actuator_motors;
-	actuator_motors.timestamp = hrt_absolute_time();
+	// Fill the messages in place in the topic queue if possible (all fields must be written, the slot contains stale data)
+	actuator_motors_s actuator_motors_buffer;
+	actuator_motors_s *actuator_motors_loan = _actuator_motors_pub.loan();
+	actuator_motors_s &actuator_motors = (actuator_motors_loan != nullptr) ? *actuator_motors_loan : actuator_motors_buffer;
+	const hrt_abstime now = hrt_absolute_time();
+	actuator_motors.timestamp = now;
 	actuator_motors.timestamp_sample = _timestamp_sample;
 
-	actuator_servos_s actuator_servos;
-	actuator_servos.timestamp = actuator_motors.timestamp;
-	actuator_servos.timestamp_sample = _timestamp_sample;
-
 	actuator_motors.reversible_flags = _param_r_rev.get();
 
 	int actuator_idx = 0;
@@ -712,7 +716,7 @@ ControlAllocator::publish_actuator_controls()
 
 	const bool any_stopped_motor_failed = 0 != (stopped_motors_due_to_effectiveness & (_handled_motor_failure_bitmask | _motor_stop_mask));
 
-	const float ice_shedding_output = get_ice_shedding_output(actuator_motors.timestamp, any_stopped_motor_failed);
+	const float ice_shedding_output = get_ice_shedding_output(now, any_stopped_motor_failed);
 
 	// motors
 	int motors_idx;
@@ -738,10 +742,21 @@ ControlAllocator::publish_actuator_controls()
 		actuator_motors.control[i] = NAN;
 	}
 
-	_actuator_motors_pub.publish(actuator_motors);
+	if (actuator_motors_loan != nullptr) {
+		_actuator_motors_pub.commit();
+
+	} else {
+		_actuator_motors_pub.publish(actuator_motors);
+	}
 
 	// servos
 	if (_num_actuators[1] > 0) {
+		actuator_servos_s actuator_servos_buffer;
+		actuator_servos_s *actuator_servos_loan = _actuator_servos_pub.loan();
+		actuator_servos_s &actuator_servos = (actuator_servos_loan != nullptr) ? *actuator_servos_loan : actuator_servos_buffer;
+		actuator_servos.timestamp = now;
+		actuator_servos.timestamp_sample = _timestamp_sample;
+
 		int servos_idx;
 
 		for (servos_idx = 0; servos_idx < _num_actuators[1] && servos_idx < actuator_servos_s::NUM_CONTROLS; servos_idx++) {
@@ -756,7 +771,12 @@ ControlAllocator::publish_actuator_controls()
 			actuator_servos.control[i] = NAN;
 		}
 
-		_actuator_servos_pub.publish(actuator_servos);
+		if (actuator_servos_loan != nullptr) {
+			_actuator_servos_pub.commit();
+
+		} else {
+			_actuator_servos_pub.publish(actuator_servos);
+		}
 	}
 }
 
@@ -856,6 +876,10 @@ int ControlAllocator::print_status()
 		PX4_INFO("Method: Sequential desaturation");
 		break;
 
+	case AllocationMethod::ACTIVE_SET:
+		PX4_INFO("Method: Active-set");
+		break;
+
 	case AllocationMethod::AUTO:
 		PX4_INFO("Method: Auto");
 		break;
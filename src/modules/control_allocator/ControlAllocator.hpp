@@ -56,6 +56,7 @@
 #include <ActuatorEffectivenessSpacecraft.hpp>
 
 #include <ControlAllocation.hpp>
+#include <ControlAllocationActiveSet.hpp>
 #include <ControlAllocationPseudoInverse.hpp>
 #include <ControlAllocationSequentialDesaturation.hpp>
 
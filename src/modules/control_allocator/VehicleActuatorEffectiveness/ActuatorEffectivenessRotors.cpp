@@ -123,7 +123,13 @@ void ActuatorEffectivenessRotors::updateParams()
 		} else {
 			_geometry.rotors[i].tilt_index = -1;
 		}
+
+		_axis_terms[i] = AxisTerms::fromRotor(_geometry.rotors[i]);
+		_tilt_terms_direction[i] = NAN;
 	}
+
+	// the tilted axes get reapplied on the next updateAxisFromTilts()
+	_tilted_rotors = 0;
 }
 
 bool
@@ -134,13 +140,57 @@ ActuatorEffectivenessRotors::addActuators(Configuration &configuration)
 		return false;
 	}
 
-	int num_actuators = computeEffectivenessMatrix(_geometry,
-			    configuration.effectiveness_matrices[configuration.selected_matrix],
-			    configuration.num_actuators_matrix[configuration.selected_matrix]);
+	EffectivenessMatrix &effectiveness = configuration.effectiveness_matrices[configuration.selected_matrix];
+	const int actuator_start_index = configuration.num_actuators_matrix[configuration.selected_matrix];
+	int num_actuators = 0;
+
+	// same as computeEffectivenessMatrix(), but with the cached geometry terms
+	for (int i = 0; i < _geometry.num_rotors; i++) {
+		if (i + actuator_start_index >= NUM_ACTUATORS) {
+			break;
+		}
+
+		++num_actuators;
+
+		if (_tilted_rotors & (1u << i)) {
+			computeRotorColumn(_geometry, i, AxisTerms::fromTilt(_tilt_terms[i], _tilt_angle[i]), effectiveness,
+					   i + actuator_start_index);
+
+		} else {
+			computeRotorColumn(_geometry, i, _axis_terms[i], effectiveness, i + actuator_start_index);
+		}
+	}
+
 	configuration.actuatorsAdded(ActuatorType::MOTORS, num_actuators);
 	return true;
 }
 
+ActuatorEffectivenessRotors::AxisTerms
+ActuatorEffectivenessRotors::AxisTerms::fromRotor(const RotorGeometry &rotor)
+{
+	AxisTerms terms{};
+	const float axis_norm = rotor.axis.norm();
+
+	if (axis_norm > FLT_EPSILON) {
+		terms.axis = rotor.axis / axis_norm;
+		terms.position_cross_axis = rotor.position.cross(terms.axis);
+	}
+
+	return terms;
+}
+
+ActuatorEffectivenessRotors::AxisTerms
+ActuatorEffectivenessRotors::AxisTerms::fromTilt(const AxisTerms tilt_terms[2], float tilt_angle)
+{
+	const float cos_tilt = cosf(tilt_angle);
+	const float sin_tilt = sinf(tilt_angle);
+
+	AxisTerms terms;
+	terms.axis = cos_tilt * tilt_terms[0].axis + sin_tilt * tilt_terms[1].axis;
+	terms.position_cross_axis = cos_tilt * tilt_terms[0].position_cross_axis + sin_tilt * tilt_terms[1].position_cross_axis;
+	return terms;
+}
+
 int
 ActuatorEffectivenessRotors::computeEffectivenessMatrix(const Geometry &geometry,
 		EffectivenessMatrix &effectiveness, int actuator_start_index)
@@ -155,73 +205,70 @@ ActuatorEffectivenessRotors::computeEffectivenessMatrix(const Geometry &geometry
 
 		++num_actuators;
 
-		// Get rotor axis
-		Vector3f axis = geometry.rotors[i].axis;
-
-		// Normalize axis
-		float axis_norm = axis.norm();
+		computeRotorColumn(geometry, i, AxisTerms::fromRotor(geometry.rotors[i]), effectiveness, i + actuator_start_index);
+	}
 
-		if (axis_norm > FLT_EPSILON) {
-			axis /= axis_norm;
+	return num_actuators;
+}
 
-		} else {
-			// Bad axis definition, ignore this rotor
-			continue;
-		}
+void
+ActuatorEffectivenessRotors::computeRotorColumn(const Geometry &geometry, int rotor, const AxisTerms &terms,
+		EffectivenessMatrix &effectiveness, int column)
+{
+	const Vector3f &axis = terms.axis;
 
-		// Get rotor position
-		const Vector3f &position = geometry.rotors[i].position;
+	if (axis.norm_squared() < FLT_EPSILON) {
+		// Bad axis definition, ignore this rotor
+		return;
+	}
 
-		// Get coefficients
-		float ct = geometry.rotors[i].thrust_coef;
-		float km = geometry.rotors[i].moment_ratio;
+	// Get coefficients
+	float ct = geometry.rotors[rotor].thrust_coef;
+	float km = geometry.rotors[rotor].moment_ratio;
 
-		if (geometry.propeller_torque_disabled) {
-			km = 0.f;
-		}
+	if (geometry.propeller_torque_disabled) {
+		km = 0.f;
+	}
 
-		if (geometry.propeller_torque_disabled_non_upwards) {
-			bool upwards = fabsf(axis(0)) < 0.1f && fabsf(axis(1)) < 0.1f && axis(2) < -0.5f;
+	if (geometry.propeller_torque_disabled_non_upwards) {
+		bool upwards = fabsf(axis(0)) < 0.1f && fabsf(axis(1)) < 0.1f && axis(2) < -0.5f;
 
-			if (!upwards) {
-				km = 0.f;
-			}
+		if (!upwards) {
+			km = 0.f;
 		}
+	}
 
-		if (fabsf(ct) < FLT_EPSILON) {
-			continue;
-		}
+	if (fabsf(ct) < FLT_EPSILON) {
+		return;
+	}
 
-		// Compute thrust generated by this rotor
-		matrix::Vector3f thrust = ct * axis;
+	// Compute thrust generated by this rotor
+	matrix::Vector3f thrust = ct * axis;
 
-		// Compute moment generated by this rotor
-		matrix::Vector3f moment = ct * position.cross(axis) - ct * km * axis;
+	// Compute moment generated by this rotor
+	matrix::Vector3f moment = ct * terms.position_cross_axis - ct * km * axis;
 
-		// Fill corresponding items in effectiveness matrix
-		for (size_t j = 0; j < 3; j++) {
-			effectiveness(j, i + actuator_start_index) = moment(j);
-			effectiveness(j + 3, i + actuator_start_index) = thrust(j);
-		}
+	// Fill corresponding items in effectiveness matrix
+	for (size_t j = 0; j < 3; j++) {
+		effectiveness(j, column) = moment(j);
+		effectiveness(j + 3, column) = thrust(j);
+	}
 
-		if (geometry.yaw_by_differential_thrust_disabled) {
-			// set yaw effectiveness to 0 if yaw is controlled by other means (e.g. tilts)
-			effectiveness(2, i + actuator_start_index) = 0.f;
-		}
+	if (geometry.yaw_by_differential_thrust_disabled) {
+		// set yaw effectiveness to 0 if yaw is controlled by other means (e.g. tilts)
+		effectiveness(2, column) = 0.f;
+	}
 
-		if (geometry.three_dimensional_thrust_disabled) {
-			// Special case tiltrotor: instead of passing a 3D thrust vector (that would mostly have a x-component in FW, and z in MC),
-			// pass the vector magnitude as z-component, plus the collective tilt. Passing 3D thrust plus tilt is not feasible as they
-			// can't be allocated independently, and with the current controller it's not possible to have collective tilt calculated
-			// by the allocator directly.
+	if (geometry.three_dimensional_thrust_disabled) {
+		// Special case tiltrotor: instead of passing a 3D thrust vector (that would mostly have a x-component in FW, and z in MC),
+		// pass the vector magnitude as z-component, plus the collective tilt. Passing 3D thrust plus tilt is not feasible as they
+		// can't be allocated independently, and with the current controller it's not possible to have collective tilt calculated
+		// by the allocator directly.
 
-			effectiveness(0 + 3, i + actuator_start_index) = 0.f;
-			effectiveness(1 + 3, i + actuator_start_index) = 0.f;
-			effectiveness(2 + 3, i + actuator_start_index) = -ct;
-		}
+		effectiveness(0 + 3, column) = 0.f;
+		effectiveness(1 + 3, column) = 0.f;
+		effectiveness(2 + 3, column) = -ct;
 	}
-
-	return num_actuators;
 }
 
 uint32_t ActuatorEffectivenessRotors::updateAxisFromTilts(const ActuatorEffectivenessTilts &tilts,
@@ -244,7 +291,20 @@ uint32_t ActuatorEffectivenessRotors::updateAxisFromTilts(const ActuatorEffectiv
 		const ActuatorEffectivenessTilts::Params &tilt = tilts.config(tilt_index);
 		const float tilt_angle = math::lerp(tilt.min_angle, tilt.max_angle, (collective_tilt_control + 1.f) / 2.f);
 		const float tilt_direction = math::radians((float)tilt.tilt_direction);
-		_geometry.rotors[i].axis = tiltedAxis(tilt_angle, tilt_direction);
+
+		// the geometry only needs to be recomputed if the tilt direction changes (or the rotor parameters)
+		if (!(tilt_direction == _tilt_terms_direction[i])) {
+			RotorGeometry rotor = _geometry.rotors[i];
+			rotor.axis = tiltedAxis(0.f, tilt_direction);
+			_tilt_terms[i][0] = AxisTerms::fromRotor(rotor);
+			rotor.axis = tiltedAxis(M_PI_2_F, tilt_direction);
+			_tilt_terms[i][1] = AxisTerms::fromRotor(rotor);
+			_tilt_terms_direction[i] = tilt_direction;
+		}
+
+		_tilt_angle[i] = tilt_angle;
+		_tilted_rotors |= 1u << i;
+		_geometry.rotors[i].axis = AxisTerms::fromTilt(_tilt_terms[i], tilt_angle).axis;
 	}
 
 	return nontilted_motors;
@@ -95,9 +95,33 @@ public:
 		normalize[0] = true;
 	}
 
+	/**
+	 * The terms of a rotor's effectiveness column that only depend on the rotor position and axis
+	 */
+	struct AxisTerms {
+		matrix::Vector3f axis; ///< normalized
+		matrix::Vector3f position_cross_axis;
+
+		static AxisTerms fromRotor(const RotorGeometry &rotor);
+
+		/**
+		 * The axis of a tilted rotor is a linear combination of its axis at a tilt of 0 and 90 degrees, so are
+		 * the other terms. This avoids recomputing the geometry when only the tilt angle changes.
+		 * @param tilt_terms terms at a tilt angle of 0 and 90 degrees
+		 */
+		static AxisTerms fromTilt(const AxisTerms tilt_terms[2], float tilt_angle);
+	};
+
 	static int computeEffectivenessMatrix(const Geometry &geometry,
 					      EffectivenessMatrix &effectiveness, int actuator_start_index = 0);
 
+	/**
+	 * Fill the effectiveness column of a single rotor
+	 * @param terms geometry terms of the rotor (axis with a norm of 0 for an invalid axis)
+	 */
+	static void computeRotorColumn(const Geometry &geometry, int rotor, const AxisTerms &terms,
+				       EffectivenessMatrix &effectiveness, int column);
+
 	bool addActuators(Configuration &configuration);
 
 	const char *name() const override { return "Rotors"; }
@@ -150,6 +174,13 @@ private:
 
 	Geometry _geometry{};
 
+	// cached geometry terms: for rotors with a fixed axis, and for tilted rotors at a tilt of 0 and 90 degrees
+	AxisTerms _axis_terms[NUM_ROTORS_MAX] {};
+	AxisTerms _tilt_terms[NUM_ROTORS_MAX][2] {};
+	float _tilt_terms_direction[NUM_ROTORS_MAX] {}; ///< tilt direction of _tilt_terms, NAN if not computed yet
+	float _tilt_angle[NUM_ROTORS_MAX] {};
+	uint32_t _tilted_rotors{0}; ///< bitset of the rotors with the axis from updateAxisFromTilts()
+
 	DEFINE_PARAMETERS(
 		(ParamInt<px4::params::CA_ROTOR_COUNT>) _param_ca_rotor_count
 	)
@@ -166,3 +166,36 @@ TEST(ActuatorEffectivenessRotors, Tilt)
 	axis = ActuatorEffectivenessRotors::tiltedAxis(-M_PI_F / 2.f, M_PI_F / 2.f);
 	EXPECT_EQ(axis, axis_expected);
 }
+
+TEST(ActuatorEffectivenessRotors, TiltedAxisTerms)
+{
+	// the effectiveness from the precomputed tilt terms matches the one computed from the tilted axis
+	ActuatorEffectivenessRotors::Geometry geometry = {};
+	geometry.rotors[0].position = {0.3f, -0.4f, 0.05f};
+	geometry.rotors[0].thrust_coef = 6.5f;
+	geometry.rotors[0].moment_ratio = 0.05f;
+	geometry.num_rotors = 1;
+	geometry.propeller_torque_disabled_non_upwards = true;
+
+	for (float tilt_direction = 0.f; tilt_direction < 2.f * M_PI_F; tilt_direction += M_PI_F / 3.f) {
+		ActuatorEffectivenessRotors::AxisTerms tilt_terms[2];
+		ActuatorEffectivenessRotors::RotorGeometry rotor = geometry.rotors[0];
+		rotor.axis = ActuatorEffectivenessRotors::tiltedAxis(0.f, tilt_direction);
+		tilt_terms[0] = ActuatorEffectivenessRotors::AxisTerms::fromRotor(rotor);
+		rotor.axis = ActuatorEffectivenessRotors::tiltedAxis(M_PI_F / 2.f, tilt_direction);
+		tilt_terms[1] = ActuatorEffectivenessRotors::AxisTerms::fromRotor(rotor);
+
+		for (float tilt_angle = -0.2f; tilt_angle < M_PI_F / 2.f; tilt_angle += 0.1f) {
+			geometry.rotors[0].axis = ActuatorEffectivenessRotors::tiltedAxis(tilt_angle, tilt_direction);
+			ActuatorEffectiveness::EffectivenessMatrix effectiveness_expected;
+			ActuatorEffectivenessRotors::computeEffectivenessMatrix(geometry, effectiveness_expected);
+
+			ActuatorEffectiveness::EffectivenessMatrix effectiveness;
+			ActuatorEffectivenessRotors::computeRotorColumn(geometry, 0,
+					ActuatorEffectivenessRotors::AxisTerms::fromTilt(tilt_terms, tilt_angle), effectiveness, 0);
+
+			EXPECT_TRUE(isEqual(effectiveness, effectiveness_expected, 1e-5f))
+					<< "tilt angle " << tilt_angle << " direction " << tilt_direction;
+		}
+	}
+}
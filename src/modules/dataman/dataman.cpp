@@ -59,6 +59,11 @@
 
 #include "dataman.h"
 
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 __BEGIN_DECLS
 __EXPORT int dataman_main(int argc, char *argv[]);
 __END_DECLS
@@ -78,6 +83,10 @@ static int _file_initialize(unsigned max_offset);
 static void _file_shutdown();
 #endif
 
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+static void _file_flush();
+#endif
+
 /* Private Ram based Operations */
 static ssize_t _ram_write(dm_item_t item, unsigned index, const void *buf, size_t count);
 static ssize_t _ram_read(dm_item_t item, unsigned index, void *buf, size_t count);
@@ -120,6 +129,12 @@ static struct {
 	union {
 		struct {
 			int fd;
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+			uint8_t *map;		/**< file contents if memory-mapped, otherwise nullptr */
+			size_t map_size;
+			bool map_dirty;		/**< map has changes not yet synced to the file */
+			hrt_abstime map_flush_time;
+#endif
 		} file;
 		struct {
 			uint8_t *data;
@@ -161,6 +176,22 @@ static perf_counter_t _dm_write_perf{nullptr};
 /* The data manager store file handle and file name */
 static const char *default_device_path = PX4_STORAGEDIR "/dataman";
 static char *k_data_manager_device_path = nullptr;
+
+#if CONFIG_DATAMAN_FILE_CACHE_ITEMS > 0
+/* Read-through cache of the most recently used items of the file backend */
+struct dm_cache_entry_t {
+	uint32_t last_used;
+	uint32_t index;
+	uint8_t item;	/* DM_KEY_NUM_KEYS if unused */
+	uint8_t length;
+	uint8_t data[sizeof(dataman_response_s::data)];
+};
+
+static dm_cache_entry_t *g_cache{nullptr};
+static uint32_t g_cache_use_counter{0};
+static unsigned g_cache_hits{0};
+static unsigned g_cache_misses{0};
+#endif
 #endif
 
 static enum {
@@ -211,6 +242,75 @@ calculate_offset(dm_item_t item, unsigned index)
  * The total size must not exceed g_per_item_max_index[item]
  */
 
+#if defined(CONFIG_DATAMAN_PERSISTENT_STORAGE) && CONFIG_DATAMAN_FILE_CACHE_ITEMS > 0
+static dm_cache_entry_t *_cache_find(dm_item_t item, unsigned index)
+{
+	if (g_cache == nullptr) {
+		return nullptr;
+	}
+
+	for (int i = 0; i < CONFIG_DATAMAN_FILE_CACHE_ITEMS; i++) {
+		if (g_cache[i].item == item && g_cache[i].index == index) {
+			g_cache[i].last_used = ++g_cache_use_counter;
+			return &g_cache[i];
+		}
+	}
+
+	return nullptr;
+}
+
+static void _cache_store(dm_item_t item, unsigned index, const void *buf, size_t count)
+{
+	if (g_cache == nullptr || count > sizeof(dm_cache_entry_t::data)) {
+		return;
+	}
+
+	dm_cache_entry_t *entry = _cache_find(item, index);
+
+	if (entry == nullptr) {
+		/* replace the least recently used entry (unused ones have last_used 0) */
+		entry = &g_cache[0];
+
+		for (int i = 1; i < CONFIG_DATAMAN_FILE_CACHE_ITEMS; i++) {
+			if (g_cache[i].last_used < entry->last_used) {
+				entry = &g_cache[i];
+			}
+		}
+
+		entry->item = item;
+		entry->index = index;
+		entry->last_used = ++g_cache_use_counter;
+	}
+
+	entry->length = count;
+	memcpy(entry->data, buf, count);
+}
+
+static void _cache_invalidate(dm_item_t item, unsigned index)
+{
+	dm_cache_entry_t *entry = _cache_find(item, index);
+
+	if (entry != nullptr) {
+		entry->item = DM_KEY_NUM_KEYS;
+		entry->last_used = 0;
+	}
+}
+
+static void _cache_clear(dm_item_t item)
+{
+	if (g_cache == nullptr) {
+		return;
+	}
+
+	for (int i = 0; i < CONFIG_DATAMAN_FILE_CACHE_ITEMS; i++) {
+		if (g_cache[i].item == item) {
+			g_cache[i].item = DM_KEY_NUM_KEYS;
+			g_cache[i].last_used = 0;
+		}
+	}
+}
+#endif
+
 /* write to the data manager RAM buffer  */
 static ssize_t _ram_write(dm_item_t item, unsigned index, const void *buf, size_t count)
 {
@@ -287,6 +387,17 @@ _file_write(dm_item_t item, unsigned index, const void *buf, size_t count)
 
 	count += DM_SECTOR_HDR_SIZE;
 
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+	if (dm_operations_data.file.map != nullptr) {
+		/* synced to the file by _file_flush() */
+		memcpy(&dm_operations_data.file.map[offset], buffer, count);
+		dm_operations_data.file.map_dirty = true;
+		return count - DM_SECTOR_HDR_SIZE;
+	}
+
+#endif
+
 	bool write_success = false;
 
 	for (int i = 0; i < 2; i++) {
@@ -320,12 +431,20 @@ _file_write(dm_item_t item, unsigned index, const void *buf, size_t count)
 	}
 
 	if (!write_success) {
+#if CONFIG_DATAMAN_FILE_CACHE_ITEMS > 0
+		/* the content on the file is unknown now */
+		_cache_invalidate(item, index);
+#endif
 		return -1;
 	}
 
 	/* Make sure data is written to physical media */
 	fsync(dm_operations_data.file.fd);
 
+#if CONFIG_DATAMAN_FILE_CACHE_ITEMS > 0
+	_cache_store(item, index, buffer + DM_SECTOR_HDR_SIZE, count - DM_SECTOR_HDR_SIZE);
+#endif
+
 	/* All is well... return the number of user data written */
 	return count - DM_SECTOR_HDR_SIZE;
 }
@@ -398,6 +517,50 @@ _file_read(dm_item_t item, unsigned index, void *buf, size_t count)
 		return -E2BIG;
 	}
 
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+	if (dm_operations_data.file.map != nullptr) {
+		const uint8_t *data = &dm_operations_data.file.map[offset];
+
+		if (data[0] > count) {
+			return -1;
+		}
+
+		if (data[0] > 0) {
+			memcpy(buf, data + DM_SECTOR_HDR_SIZE, data[0]);
+
+		} else {
+			memset(buf, 0, count);
+		}
+
+		return data[0];
+	}
+
+#endif
+
+#if CONFIG_DATAMAN_FILE_CACHE_ITEMS > 0
+	const dm_cache_entry_t *entry = _cache_find(item, index);
+
+	if (entry != nullptr) {
+		g_cache_hits++;
+
+		if (entry->length > count) {
+			return -1;
+		}
+
+		if (entry->length > 0) {
+			memcpy(buf, entry->data, entry->length);
+
+		} else {
+			memset(buf, 0, count);
+		}
+
+		return entry->length;
+	}
+
+	g_cache_misses++;
+#endif
+
 	int len = -1;
 	bool read_success = false;
 
@@ -452,6 +615,10 @@ _file_read(dm_item_t item, unsigned index, void *buf, size_t count)
 		memset(buf, 0, count);
 	}
 
+#if CONFIG_DATAMAN_FILE_CACHE_ITEMS > 0
+	_cache_store(item, index, buffer + DM_SECTOR_HDR_SIZE, buffer[0]);
+#endif
+
 	/* Return the number of bytes of caller data read */
 	return buffer[0];
 }
@@ -507,6 +674,28 @@ _file_clear(dm_item_t item)
 
 	int result = 0;
 
+#if CONFIG_DATAMAN_FILE_CACHE_ITEMS > 0
+	_cache_clear(item);
+#endif
+
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+	if (dm_operations_data.file.map != nullptr) {
+		for (unsigned i = 0; i < g_per_item_max_index[item]; i++) {
+			/* Avoid SD flash wear by only doing writes where necessary */
+			if (dm_operations_data.file.map[offset]) {
+				dm_operations_data.file.map[offset] = 0;
+				dm_operations_data.file.map_dirty = true;
+			}
+
+			offset += g_per_item_size_with_hdr[item];
+		}
+
+		return result;
+	}
+
+#endif
+
 	/* Clear all items of this type */
 	for (int i = 0; (unsigned)i < g_per_item_max_index[item]; i++) {
 		char buf[1];
@@ -567,6 +756,54 @@ _file_initialize(unsigned max_offset)
 		return -1;
 	}
 
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+	dm_operations_data.file.map = nullptr;
+	dm_operations_data.file.map_size = max_offset;
+	dm_operations_data.file.map_dirty = false;
+	dm_operations_data.file.map_flush_time = hrt_absolute_time();
+
+	struct stat file_stat;
+
+	/* the whole file must exist to be mapped, missing parts read as empty items */
+	if ((fstat(dm_operations_data.file.fd, &file_stat) == 0)
+	    && ((size_t)file_stat.st_size >= max_offset || ftruncate(dm_operations_data.file.fd, max_offset) == 0)) {
+
+		void *map = mmap(nullptr, max_offset, PROT_READ | PROT_WRITE, MAP_SHARED, dm_operations_data.file.fd, 0);
+
+		if (map != MAP_FAILED) {
+			dm_operations_data.file.map = (uint8_t *)map;
+		}
+	}
+
+	if (dm_operations_data.file.map == nullptr) {
+		PX4_WARN("Could not map data manager file, using file access (%d)", errno);
+	}
+
+#endif
+
+#if CONFIG_DATAMAN_FILE_CACHE_ITEMS > 0
+	bool use_cache = true;
+
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+	/* a mapped file is already in RAM */
+	use_cache = (dm_operations_data.file.map == nullptr);
+#endif
+
+	g_cache = use_cache ? (dm_cache_entry_t *)malloc(CONFIG_DATAMAN_FILE_CACHE_ITEMS * sizeof(dm_cache_entry_t)) : nullptr;
+
+	if (g_cache != nullptr) {
+		for (int i = 0; i < CONFIG_DATAMAN_FILE_CACHE_ITEMS; i++) {
+			g_cache[i].item = DM_KEY_NUM_KEYS;
+			g_cache[i].last_used = 0;
+		}
+
+	} else if (use_cache) {
+		PX4_WARN("Could not allocate the item cache");
+	}
+
+	g_cache_use_counter = 0;
+#endif
+
 	dataman_compat_s compat_state{};
 
 	dm_operations_data.silence = true;
@@ -636,8 +873,43 @@ _ram_initialize(unsigned max_offset)
 static void
 _file_shutdown()
 {
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+	if (dm_operations_data.file.map != nullptr) {
+		msync(dm_operations_data.file.map, dm_operations_data.file.map_size, MS_SYNC);
+		munmap(dm_operations_data.file.map, dm_operations_data.file.map_size);
+		dm_operations_data.file.map = nullptr;
+	}
+
+#endif
+
 	close(dm_operations_data.file.fd);
 	dm_operations_data.running = false;
+
+#if CONFIG_DATAMAN_FILE_CACHE_ITEMS > 0
+	free(g_cache);
+	g_cache = nullptr;
+#endif
+}
+#endif
+
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+/* Write the changes of the mapped file to the storage, at most once per second */
+static void
+_file_flush()
+{
+	using namespace time_literals;
+
+	if ((dm_operations_data.file.map != nullptr) && dm_operations_data.file.map_dirty
+	    && (hrt_elapsed_time(&dm_operations_data.file.map_flush_time) > 1_s)) {
+
+		if (msync(dm_operations_data.file.map, dm_operations_data.file.map_size, MS_SYNC) != 0) {
+			PX4_ERR("file sync failed %d", errno);
+		}
+
+		dm_operations_data.file.map_dirty = false;
+		dm_operations_data.file.map_flush_time = hrt_absolute_time();
+	}
 }
 #endif
 
@@ -824,6 +1096,14 @@ task_main(int argc, char *argv[])
 			}
 		}
 
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+		if (backend == BACKEND_FILE) {
+			_file_flush();
+		}
+
+#endif
+
 		/* time to go???? */
 		if (g_task_should_exit) {
 			break;
@@ -879,6 +1159,22 @@ status()
 	PX4_INFO("Reads    %u", g_func_counts[DM_READ]);
 	PX4_INFO("Clears   %u", g_func_counts[DM_CLEAR]);
 
+#if defined(CONFIG_DATAMAN_FILE_MMAP)
+
+	if ((backend == BACKEND_FILE) && (dm_operations_data.file.map != nullptr)) {
+		PX4_INFO("File     memory-mapped, %s", dm_operations_data.file.map_dirty ? "sync pending" : "synced");
+	}
+
+#endif
+
+#if defined(CONFIG_DATAMAN_PERSISTENT_STORAGE) && CONFIG_DATAMAN_FILE_CACHE_ITEMS > 0
+
+	if (g_cache != nullptr) {
+		PX4_INFO("Cache    %u hits, %u misses", g_cache_hits, g_cache_misses);
+	}
+
+#endif
+
 	perf_print_counter(_dm_read_perf);
 	perf_print_counter(_dm_write_perf);
 }
@@ -906,6 +1202,7 @@ Each type has a specific type and a fixed maximum amount of storage items, so th
 
 ### Implementation
 Reading and writing a single item is always atomic.
+With the file backend the most recently used items are cached in RAM, writes go through to the file.
 
 )DESCR_STR");
 
@@ -219,7 +219,9 @@ void Ekf::fuseAirspeed(const airspeedSample &airspeed_sample, estimator_aid_sour
 
 	_fault_status.flags.bad_airspeed = false;
 
-	const VectorState H = sym::ComputeAirspeedH(_state.vector(), FLT_EPSILON);
+	// the airspeed only depends on the velocity and wind states
+	const matrix::SparseVectorf<State::size, State::vel.idx, State::vel.idx + 1, State::vel.idx + 2,
+	      State::wind_vel.idx, State::wind_vel.idx + 1> H(sym::ComputeAirspeedH(_state.vector(), FLT_EPSILON));
 	VectorState K = P * H / aid_src.innovation_variance;
 
 	if (update_wind_only) {
@@ -40,9 +40,7 @@
  */
 
 #include "ekf.h"
-#include <ekf_derivation/generated/compute_gravity_xyz_innov_var_and_hx.h>
-#include <ekf_derivation/generated/compute_gravity_y_innov_var_and_h.h>
-#include <ekf_derivation/generated/compute_gravity_z_innov_var_and_h.h>
+#include <ekf_derivation/generated/compute_gravity_xyz_innov_var_and_h.h>
 
 #include <mathlib/mathlib.h>
 
@@ -68,8 +66,8 @@ void Ekf::controlGravityFusion(const imuSample &imu)
 	Vector3f innovation = _state.quat_nominal.rotateVectorInverse(Vector3f(0.f, 0.f, -1.f)) - measurement;
 	Vector3f innovation_variance;
 	const auto state_vector = _state.vector();
-	VectorState H;
-	sym::ComputeGravityXyzInnovVarAndHx(state_vector, P, measurement_var, &innovation_variance, &H);
+	VectorState H[3];
+	sym::ComputeGravityXyzInnovVarAndH(state_vector, P, measurement_var, &innovation_variance, &H[0], &H[1], &H[2]);
 
 	// fill estimator aid source status
 	updateAidSourceStatus(_aid_src_gravity,
@@ -84,33 +82,25 @@ void Ekf::controlGravityFusion(const imuSample &imu)
 	bool fused[3] {};
 
 	for (uint8_t index = 0; index <= 2; index++) {
-		// Calculate Kalman gains and observation jacobians
-		if (index == 0) {
-			// everything was already computed above
+		// the gravity direction only depends on the attitude
+		const matrix::SparseVectorf<State::size, State::quat_nominal.idx, State::quat_nominal.idx + 1,
+		      State::quat_nominal.idx + 2> H_att(H[index]);
 
-		} else if (index == 1) {
+		if (index > 0) {
 			// recalculate innovation variance because state covariances have changed due to previous fusion (linearise using the same initial state for all axes)
-			sym::ComputeGravityYInnovVarAndH(state_vector, P, measurement_var, &_aid_src_gravity.innovation_variance[index], &H);
-
-			// recalculate innovation using the updated state
-			_aid_src_gravity.innovation[index] = _state.quat_nominal.rotateVectorInverse(Vector3f(0.f, 0.f,
-							     -1.f))(index) - measurement(index);
-
-		} else if (index == 2) {
-			// recalculate innovation variance because state covariances have changed due to previous fusion (linearise using the same initial state for all axes)
-			sym::ComputeGravityZInnovVarAndH(state_vector, P, measurement_var, &_aid_src_gravity.innovation_variance[index], &H);
+			_aid_src_gravity.innovation_variance[index] = matrix::quadraticForm(P, H_att) + measurement_var;
 
 			// recalculate innovation using the updated state
 			_aid_src_gravity.innovation[index] = _state.quat_nominal.rotateVectorInverse(Vector3f(0.f, 0.f,
 							     -1.f))(index) - measurement(index);
 		}
 
-		VectorState K = P * H / _aid_src_gravity.innovation_variance[index];
+		VectorState K = P * H_att / _aid_src_gravity.innovation_variance[index];
 
 		const bool accel_clipping = imu.delta_vel_clipping[0] || imu.delta_vel_clipping[1] || imu.delta_vel_clipping[2];
 
 		if (_control_status.flags.gravity_vector && !_aid_src_gravity.innovation_rejected && !accel_clipping) {
-			fused[index] = measurementUpdate(K, H,
+			fused[index] = measurementUpdate(K, H_att,
 							 _aid_src_gravity.observation_variance[index], _aid_src_gravity.innovation[index]);
 		}
 	}
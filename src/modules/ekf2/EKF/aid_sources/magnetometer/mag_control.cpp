@@ -41,7 +41,7 @@
 
 #include <lib/world_magnetic_model/geo_mag_declination.h>
 
-#include <ekf_derivation/generated/compute_mag_innov_innov_var_and_hx.h>
+#include <ekf_derivation/generated/compute_mag_innov_innov_var_and_h.h>
 
 void Ekf::controlMagFusion(const imuSample &imu_sample)
 {
@@ -138,8 +138,9 @@ void Ekf::controlMagFusion(const imuSample &imu_sample)
 		Vector3f innov_var;
 
 		// Observation jacobian and Kalman gain vectors
-		VectorState H;
-		sym::ComputeMagInnovInnovVarAndHx(_state.vector(), P, mag_sample.mag, R_MAG, FLT_EPSILON, &mag_innov, &innov_var, &H);
+		VectorState H[3];
+		sym::ComputeMagInnovInnovVarAndH(_state.vector(), P, mag_sample.mag, R_MAG, FLT_EPSILON, &mag_innov, &innov_var,
+						 &H[0], &H[1], &H[2]);
 
 		updateAidSourceStatus(aid_src,
 				      mag_sample.time_us,                      // sample timestamp
@@ -629,9 +630,10 @@ float Ekf::getMagDeclination()
 bool Ekf::updateWorldMagneticModel(const double latitude_deg, const double longitude_deg)
 {
 	// set the magnetic field data returned by the geo library using the current GPS position
-	const float declination_rad = math::radians(get_mag_declination_degrees(latitude_deg, longitude_deg));
-	const float inclination_rad = math::radians(get_mag_inclination_degrees(latitude_deg, longitude_deg));
-	const float strength_gauss = get_mag_strength_gauss(latitude_deg, longitude_deg);
+	const MagField field = _wmm_lookup.get(latitude_deg, longitude_deg);
+	const float declination_rad = math::radians(field.declination_deg);
+	const float inclination_rad = math::radians(field.inclination_deg);
+	const float strength_gauss = field.strength_gauss;
 
 	if (PX4_ISFINITE(declination_rad) && PX4_ISFINITE(inclination_rad) && PX4_ISFINITE(strength_gauss)) {
 
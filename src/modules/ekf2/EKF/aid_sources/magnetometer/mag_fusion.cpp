@@ -43,14 +43,27 @@
 
 #include "ekf.h"
 
-#include <ekf_derivation/generated/compute_mag_y_innov_var_and_h.h>
-#include <ekf_derivation/generated/compute_mag_z_innov_var_and_h.h>
-
 #include <ekf_derivation/generated/compute_mag_declination_pred_innov_var_and_h.h>
 
 #include <mathlib/mathlib.h>
 
-bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estimator_aid_source3d_s &aid_src,
+namespace
+{
+// H * P * H^T + R of a single mag axis, the observation jacobian is only non-zero for
+// the attitude, the earth field and the body field bias of that axis
+template<unsigned axis>
+float magAxisInnovVar(const Ekf::SquareMatrixState &P, const Ekf::VectorState &H, const float R)
+{
+	const matrix::SparseVectorf<State::size,
+	      State::quat_nominal.idx, State::quat_nominal.idx + 1, State::quat_nominal.idx + 2,
+	      State::mag_I.idx, State::mag_I.idx + 1, State::mag_I.idx + 2,
+	      State::mag_B.idx + axis> H_mag(H);
+
+	return matrix::quadraticForm(P, H_mag) + R;
+}
+}
+
+bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, const VectorState (&H)[3], estimator_aid_source3d_s &aid_src,
 		  bool update_all_states, bool update_tilt)
 {
 	// if any axis failed, abort the mag fusion
@@ -58,8 +71,6 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 		return false;
 	}
 
-	const auto state_vector = _state.vector();
-
 	// update the states and covariance using sequential fusion of the magnetometer components
 	for (uint8_t index = 0; index <= 2; index++) {
 		// Calculate Kalman gains and observation jacobians
@@ -68,7 +79,7 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 
 		} else if (index == 1) {
 			// recalculate innovation variance because state covariances have changed due to previous fusion (linearise using the same initial state for all axes)
-			sym::ComputeMagYInnovVarAndH(state_vector, P, R_MAG, FLT_EPSILON, &aid_src.innovation_variance[index], &H);
+			aid_src.innovation_variance[index] = magAxisInnovVar<1>(P, H[index], R_MAG);
 
 			// recalculate innovation using the updated state
 			aid_src.innovation[index] = _state.quat_nominal.rotateVectorInverse(_state.mag_I)(index) + _state.mag_B(index) - mag(
@@ -81,7 +92,7 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 			}
 
 			// recalculate innovation variance because state covariances have changed due to previous fusion (linearise using the same initial state for all axes)
-			sym::ComputeMagZInnovVarAndH(state_vector, P, R_MAG, FLT_EPSILON, &aid_src.innovation_variance[index], &H);
+			aid_src.innovation_variance[index] = magAxisInnovVar<2>(P, H[index], R_MAG);
 
 			// recalculate innovation using the updated state
 			aid_src.innovation[index] = _state.quat_nominal.rotateVectorInverse(_state.mag_I)(index) + _state.mag_B(index) - mag(
@@ -102,7 +113,7 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 			return false;
 		}
 
-		VectorState Kfusion = P * H / aid_src.innovation_variance[index];
+		VectorState Kfusion = P * H[index] / aid_src.innovation_variance[index];
 
 		if (update_all_states) {
 			if (!update_tilt) {
@@ -127,7 +138,7 @@ bool Ekf::fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estima
 			Kfusion.slice<State::mag_B.dof, 1>(State::mag_B.idx, 0) = K_mag_B;
 		}
 
-		measurementUpdate(Kfusion, H, aid_src.observation_variance[index], aid_src.innovation[index]);
+		measurementUpdate(Kfusion, H[index], aid_src.observation_variance[index], aid_src.innovation[index]);
 	}
 
 	_fault_status.flags.bad_mag_x = false;
@@ -93,6 +93,7 @@ bool Ekf::fuseOptFlow(VectorState &H, const bool update_terrain)
 
 		measurementUpdate(Kfusion, H, _aid_src_optical_flow.observation_variance[index],
 				  _aid_src_optical_flow.innovation[index]);
+		decoupleTerrain();
 	}
 
 	_fault_status.flags.bad_optflow_X = false;
@@ -305,6 +305,7 @@ void Ekf::resetTerrainToRng(estimator_aid_source1d_s &aid_src)
 	K(State::terrain.idx) = 1.f; // innovation is forced into the terrain state to create a "reset"
 
 	measurementUpdate(K, H, aid_src.observation_variance, aid_src.innovation);
+	decoupleTerrain();
 
 	// record the state change
 	const float delta_terrain = _state.terrain - old_terrain;
@@ -40,9 +40,31 @@ bool Ekf::fuseHaglRng(estimator_aid_source1d_s &aid_src, bool update_height, boo
 		return false;
 	}
 
-	VectorState H;
+	if (isTerrainDecoupled() && update_terrain && !update_height) {
+		// terrain only scalar update, the height is considered as a known parameter
+		// whose uncertainty is already included in the innovation variance
+		const float k_terrain = P(State::terrain.idx, State::terrain.idx) / aid_src.innovation_variance;
 
-	sym::ComputeHaglH(&H);
+		P.uncorrelateCovarianceSetVariance<State::terrain.dof>(State::terrain.idx,
+				(1.f - k_terrain) * P(State::terrain.idx, State::terrain.idx));
+		_state.terrain -= k_terrain * aid_src.innovation;
+
+		constrainStateVariances();
+
+		aid_src.time_last_fuse = _time_delayed_us;
+		aid_src.fused = true;
+
+		_time_last_terrain_fuse = _time_delayed_us;
+
+		return true;
+	}
+
+	VectorState H_dense;
+
+	sym::ComputeHaglH(&H_dense);
+
+	// the height above ground only depends on the vertical position and terrain states
+	const matrix::SparseVectorf<State::size, State::pos.idx + 2, State::terrain.idx> H(H_dense);
 
 	// calculate the Kalman gain
 	VectorState K = P * H / aid_src.innovation_variance;
@@ -58,6 +80,7 @@ bool Ekf::fuseHaglRng(estimator_aid_source1d_s &aid_src, bool update_height, boo
 	}
 
 	measurementUpdate(K, H, aid_src.observation_variance, aid_src.innovation);
+	decoupleTerrain();
 
 	aid_src.time_last_fuse = _time_delayed_us;
 	aid_src.fused = true;
@@ -408,6 +408,7 @@ struct parameters {
 	float ekf2_terr_noise{5.0f};            ///< process noise for terrain offset (m/sec)
 	float ekf2_terr_grad{0.5f};             ///< gradient of terrain used to estimate process noise due to changing position (m/m)
 	const float terrain_timeout{10.f};      ///< maximum time for invalid bottom distance measurements before resetting terrain estimate (s)
+	int32_t ekf2_terr_dcpl{0};              ///< estimate the terrain independently from the other states (1-state sub-filter)
 #endif // CONFIG_EKF2_TERRAIN
 
 #if defined(CONFIG_EKF2_TERRAIN) || defined(CONFIG_EKF2_OPTICAL_FLOW) || defined(CONFIG_EKF2_RANGE_FINDER)
@@ -103,55 +103,69 @@ void Ekf::controlFusionModes(const imuSample &imu_delayed)
 		}
 	}
 
+	_timing.lap(EstimatorTiming::Section::OTHER);
+
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 	// control use of observations for aiding
 	controlMagFusion(imu_delayed);
+	_timing.lap(EstimatorTiming::Section::MAG);
 #endif // CONFIG_EKF2_MAGNETOMETER
 
 #if defined(CONFIG_EKF2_OPTICAL_FLOW)
 	controlOpticalFlowFusion(imu_delayed);
+	_timing.lap(EstimatorTiming::Section::OPTICAL_FLOW);
 #endif // CONFIG_EKF2_OPTICAL_FLOW
 
 #if defined(CONFIG_EKF2_GNSS)
 	controlGpsFusion(imu_delayed);
+	_timing.lap(EstimatorTiming::Section::GNSS);
 #endif // CONFIG_EKF2_GNSS
 
 #if defined(CONFIG_EKF2_AUX_GLOBAL_POSITION) && defined(MODULE_NAME)
 	_aux_global_position.update(*this, imu_delayed);
 	_control_status.flags.aux_gpos = _aux_global_position.anySourceFusing();
+	_timing.lap(EstimatorTiming::Section::AUX_GLOBAL_POSITION);
 #endif // CONFIG_EKF2_AUX_GLOBAL_POSITION
 
 #if defined(CONFIG_EKF2_AIRSPEED)
 	controlAirDataFusion(imu_delayed);
+	_timing.lap(EstimatorTiming::Section::AIRSPEED);
 #endif // CONFIG_EKF2_AIRSPEED
 
 #if defined(CONFIG_EKF2_SIDESLIP)
 	controlBetaFusion(imu_delayed);
+	_timing.lap(EstimatorTiming::Section::SIDESLIP);
 #endif // CONFIG_EKF2_SIDESLIP
 
 #if defined(CONFIG_EKF2_DRAG_FUSION)
 	controlDragFusion(imu_delayed);
+	_timing.lap(EstimatorTiming::Section::DRAG);
 #endif // CONFIG_EKF2_DRAG_FUSION
 
 	controlHeightFusion(imu_delayed);
+	_timing.lap(EstimatorTiming::Section::HEIGHT);
 
 #if defined(CONFIG_EKF2_GRAVITY_FUSION)
 	controlGravityFusion(imu_delayed);
+	_timing.lap(EstimatorTiming::Section::GRAVITY);
 #endif // CONFIG_EKF2_GRAVITY_FUSION
 
 #if defined(CONFIG_EKF2_EXTERNAL_VISION)
 	// Additional data odometry data from an external estimator can be fused.
 	controlExternalVisionFusion(imu_delayed);
+	_timing.lap(EstimatorTiming::Section::EXTERNAL_VISION);
 #endif // CONFIG_EKF2_EXTERNAL_VISION
 
 #if defined(CONFIG_EKF2_AUXVEL)
 	// Additional horizontal velocity data from an auxiliary sensor can be fused
 	controlAuxVelFusion(imu_delayed);
+	_timing.lap(EstimatorTiming::Section::AUXVEL);
 #endif // CONFIG_EKF2_AUXVEL
 
 #if defined(CONFIG_EKF2_TERRAIN)
 	controlTerrainFakeFusion();
 	updateTerrainValidity();
+	_timing.lap(EstimatorTiming::Section::TERRAIN);
 #endif // CONFIG_EKF2_TERRAIN
 
 	controlZeroInnovationHeadingUpdate();
@@ -168,4 +182,5 @@ void Ekf::controlFusionModes(const imuSample &imu_delayed)
 
 	// check if we are no longer fusing measurements that directly constrain velocity drift
 	updateDeadReckoningStatus();
+	_timing.lap(EstimatorTiming::Section::OTHER);
 }
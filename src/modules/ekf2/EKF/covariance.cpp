@@ -42,7 +42,7 @@
  */
 
 #include "ekf.h"
-#include <ekf_derivation/generated/predict_covariance.h>
+#include "covariance_prediction.h"
 
 #include <math.h>
 #include <mathlib/mathlib.h>
@@ -133,11 +133,8 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 		}
 	}
 
-	// calculate variances and upper diagonal covariances for quaternion, velocity, position and gyro bias states
-	P = sym::PredictCovariance(_state.vector(), P,
-				   imu_delayed.delta_vel / imu_delayed.delta_vel_dt, accel_var,
-				   imu_delayed.delta_ang / imu_delayed.delta_ang_dt, gyro_var,
-				   dt);
+	// predict the kinematic states covariances and their correlations with the other states (in place)
+	predictCovarianceSparse(_state, P, imu_delayed.delta_vel / imu_delayed.delta_vel_dt, accel_var, gyro_var, dt);
 
 	// Construct the process noise variance diagonal for those states with a stationary process model
 	// These are kinematic states and their error growth is controlled separately by the IMU noise variances
@@ -231,13 +228,7 @@ void Ekf::predictCovariance(const imuSample &imu_delayed)
 
 #endif // CONFIG_EKF2_TERRAIN
 
-	// covariance matrix is symmetrical, so copy upper half to lower half
-	for (unsigned row = 0; row < State::size; row++) {
-		for (unsigned column = 0; column < row; column++) {
-			P(row, column) = P(column, row);
-		}
-	}
-
+	// only the diagonal was modified after the prediction, the covariance matrix is still symmetrical
 	constrainStateVariances();
 }
 
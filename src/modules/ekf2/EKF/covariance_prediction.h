@@ -0,0 +1,230 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file covariance_prediction.h
+ * In-place covariance prediction P = F * P * F^T + Q exploiting the structure of the
+ * state transition matrix F. This computes the same result as sym::PredictCovariance
+ * (see predict_covariance() in python/ekf_derivation/derivation.py) which is kept as
+ * the reference implementation for the unit tests.
+ *
+ * Only the kinematic states (attitude, velocity, position, gyro and accel biases) have
+ * a non-identity transition; all the states after them (mag, wind, terrain) have an
+ * identity transition and no IMU driven process noise. Their covariance block is
+ * therefore left untouched and their correlations with the kinematic states are
+ * skipped entirely while the state is uncorrelated (e.g.: inhibited or not yet active).
+ */
+
+#pragma once
+
+#include "common.h"
+
+#include <ekf_derivation/generated/state.h>
+
+namespace estimator
+{
+
+/**
+ * Non-zero elements of the kinematic block of the state transition matrix
+ *
+ * theta: [s*I 0 0 Fab 0]
+ * v:     [Fva I 0 0 Fvb]
+ * p:     [0 dt*I I 0 0]
+ * biases: identity
+ */
+struct KinematicTransition {
+	float s;        ///< attitude error scaling (squared norm of the quaternion)
+	float Fab[3][3]; ///< attitude error w.r.t. gyro bias
+	float Fva[3][3]; ///< velocity w.r.t. attitude error (skew symmetric, zero diagonal)
+	float Fvb[3][3]; ///< velocity w.r.t. accel bias
+	float dt;
+
+	/**
+	 * Apply x = F * x in place on the kinematic part of a column (or row) of P
+	 * strided by stride elements.
+	 */
+	inline void apply(float *x, const unsigned stride) const
+	{
+		constexpr unsigned th = State::quat_nominal.idx;
+		constexpr unsigned v = State::vel.idx;
+		constexpr unsigned p = State::pos.idx;
+		constexpr unsigned bg = State::gyro_bias.idx;
+		constexpr unsigned ba = State::accel_bias.idx;
+
+		const float x_th[3] {x[(th + 0) * stride], x[(th + 1) * stride], x[(th + 2) * stride]};
+		const float x_v[3] {x[(v + 0) * stride], x[(v + 1) * stride], x[(v + 2) * stride]};
+		const float x_bg[3] {x[(bg + 0) * stride], x[(bg + 1) * stride], x[(bg + 2) * stride]};
+		const float x_ba[3] {x[(ba + 0) * stride], x[(ba + 1) * stride], x[(ba + 2) * stride]};
+
+		for (unsigned i = 0; i < 3; i++) {
+			x[(th + i) * stride] = s * x_th[i] + Fab[i][0] * x_bg[0] + Fab[i][1] * x_bg[1] + Fab[i][2] * x_bg[2];
+			x[(v + i) * stride] = x_v[i] + Fva[i][0] * x_th[0] + Fva[i][1] * x_th[1] + Fva[i][2] * x_th[2]
+					      + Fvb[i][0] * x_ba[0] + Fvb[i][1] * x_ba[1] + Fvb[i][2] * x_ba[2];
+			x[(p + i) * stride] += dt * x_v[i];
+		}
+	}
+};
+
+/**
+ * Predict the state covariance in place
+ *
+ * @param state the current state (only the attitude and accel bias are used)
+ * @param P state covariance matrix, must be symmetric
+ * @param accel accelerometer measurement (m/s^2)
+ * @param accel_var accelerometer noise variance per axis ((m/s^2)^2)
+ * @param gyro_var gyro noise variance ((rad/s)^2)
+ * @param dt time step (s)
+ */
+inline void predictCovarianceSparse(const StateSample &state, matrix::SquareMatrix<float, State::size> &P,
+				    const matrix::Vector3f &accel, const matrix::Vector3f &accel_var,
+				    const float gyro_var, const float dt)
+{
+	static_assert(State::quat_nominal.idx == 0 && State::vel.idx == 3 && State::pos.idx == 6
+		      && State::gyro_bias.idx == 9 && State::accel_bias.idx == 12,
+		      "unexpected kinematic state layout");
+
+	constexpr unsigned N = State::size;
+	constexpr unsigned K = State::accel_bias.idx + State::accel_bias.dof; // number of kinematic states
+
+	const float q0 = state.quat_nominal(0);
+	const float q1 = state.quat_nominal(1);
+	const float q2 = state.quat_nominal(2);
+	const float q3 = state.quat_nominal(3);
+
+	const float q0q0 = q0 * q0;
+	const float q1q1 = q1 * q1;
+	const float q2q2 = q2 * q2;
+	const float q3q3 = q3 * q3;
+	const float q0q1 = q0 * q1;
+	const float q0q2 = q0 * q2;
+	const float q0q3 = q0 * q3;
+	const float q1q2 = q1 * q2;
+	const float q1q3 = q1 * q3;
+	const float q2q3 = q2 * q3;
+
+	// body to earth rotation, the derivation uses the homogeneous form everywhere except
+	// for the diagonal of the velocity w.r.t. accel bias block
+	const float R[3][3] {
+		{q0q0 + q1q1 - q2q2 - q3q3, 2.f * (q1q2 - q0q3), 2.f * (q1q3 + q0q2)},
+		{2.f * (q1q2 + q0q3), q0q0 - q1q1 + q2q2 - q3q3, 2.f * (q2q3 - q0q1)},
+		{2.f * (q1q3 - q0q2), 2.f * (q2q3 + q0q1), q0q0 - q1q1 - q2q2 + q3q3}
+	};
+
+	const float a[3] {accel(0) - state.accel_bias(0), accel(1) - state.accel_bias(1), accel(2) - state.accel_bias(2)};
+	const float a_earth[3] {
+		R[0][0] * a[0] + R[0][1] * a[1] + R[0][2] * a[2],
+		R[1][0] * a[0] + R[1][1] * a[1] + R[1][2] * a[2],
+		R[2][0] * a[0] + R[2][1] * a[1] + R[2][2] * a[2]
+	};
+
+	KinematicTransition F;
+	F.s = q0q0 + q1q1 + q2q2 + q3q3;
+	F.dt = dt;
+
+	for (unsigned i = 0; i < 3; i++) {
+		for (unsigned j = 0; j < 3; j++) {
+			F.Fab[i][j] = -R[i][j] * dt;
+			F.Fvb[i][j] = -R[i][j] * dt;
+		}
+	}
+
+	F.Fvb[0][0] = -(1.f - 2.f * (q2q2 + q3q3)) * dt;
+	F.Fvb[1][1] = -(1.f - 2.f * (q1q1 + q3q3)) * dt;
+	F.Fvb[2][2] = -(1.f - 2.f * (q1q1 + q2q2)) * dt;
+
+	// -[R * a]x * dt
+	F.Fva[0][0] = 0.f;
+	F.Fva[0][1] = a_earth[2] * dt;
+	F.Fva[0][2] = -a_earth[1] * dt;
+	F.Fva[1][0] = -a_earth[2] * dt;
+	F.Fva[1][1] = 0.f;
+	F.Fva[1][2] = a_earth[0] * dt;
+	F.Fva[2][0] = a_earth[1] * dt;
+	F.Fva[2][1] = -a_earth[0] * dt;
+	F.Fva[2][2] = 0.f;
+
+	float *data = &P(0, 0);
+
+	// F * P, the rows of the non-kinematic states are unchanged
+	for (unsigned col = 0; col < N; col++) {
+		if (col >= K) {
+			bool correlated = false;
+
+			for (unsigned row = 0; row < K; row++) {
+				if (P(row, col) != 0.f) {
+					correlated = true;
+					break;
+				}
+			}
+
+			if (!correlated) {
+				continue;
+			}
+		}
+
+		F.apply(data + col, N);
+	}
+
+	// (F * P) * F^T, only the kinematic columns change. Using the symmetry of the result,
+	// the correlations with the other states are already known from the previous step.
+	for (unsigned row = 0; row < K; row++) {
+		F.apply(data + row * N, 1);
+	}
+
+	// IMU process noise: Q = Fab * diag(gyro_var) * Fab^T + Fvb * diag(accel_var) * Fvb^T
+	for (unsigned i = 0; i < 3; i++) {
+		for (unsigned j = i; j < 3; j++) {
+			float q_ang = 0.f;
+			float q_vel = 0.f;
+
+			for (unsigned k = 0; k < 3; k++) {
+				q_ang += F.Fab[i][k] * F.Fab[j][k];
+				q_vel += F.Fvb[i][k] * F.Fvb[j][k] * accel_var(k);
+			}
+
+			P(State::quat_nominal.idx + i, State::quat_nominal.idx + j) += gyro_var * q_ang;
+			P(State::vel.idx + i, State::vel.idx + j) += q_vel;
+		}
+	}
+
+	// the result is symmetric, copy the upper half of the kinematic columns to the lower half
+	for (unsigned row = 1; row < N; row++) {
+		const unsigned cols = row < K ? row : K;
+
+		for (unsigned col = 0; col < cols; col++) {
+			P(row, col) = P(col, row);
+		}
+	}
+}
+
+} // namespace estimator
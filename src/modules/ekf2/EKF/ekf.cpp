@@ -178,15 +178,23 @@ bool Ekf::update()
 
 		updateIMUBiasInhibit(imu_sample_delayed);
 
+		_timing.begin();
+
 		// perform state and covariance prediction for the main filter
 		predictCovariance(imu_sample_delayed);
+		_timing.lap(EstimatorTiming::Section::PREDICT_COVARIANCE);
+
 		predictState(imu_sample_delayed);
+		_timing.lap(EstimatorTiming::Section::PREDICT_STATE);
 
 		// control fusion of observation data
 		controlFusionModes(imu_sample_delayed);
 
 		_output_predictor.correctOutputStates(imu_sample_delayed.time_us, _state.quat_nominal, _state.vel, _gpos,
 						      _state.gyro_bias, _state.accel_bias);
+		_timing.lap(EstimatorTiming::Section::OUTPUT_PREDICTOR);
+
+		_timing.end();
 
 		return true;
 	}
@@ -229,9 +237,9 @@ bool Ekf::initialiseTilt()
 
 void Ekf::predictState(const imuSample &imu_delayed)
 {
-	if (std::fabs(_gpos.latitude_rad() - _earth_rate_lat_ref_rad) > math::radians(1.0)) {
-		_earth_rate_lat_ref_rad = _gpos.latitude_rad();
-		_earth_rate_NED = calcEarthRateNED((float)_earth_rate_lat_ref_rad);
+	if (fabsf(_gpos.origin_latitude_rad() - _earth_rate_lat_ref_rad) > math::radians(1.f)) {
+		_earth_rate_lat_ref_rad = _gpos.origin_latitude_rad();
+		_earth_rate_NED = calcEarthRateNED(_earth_rate_lat_ref_rad);
 	}
 
 	// apply imu bias corrections
@@ -275,6 +283,28 @@ void Ekf::predictState(const imuSample &imu_delayed)
 	_accel_horiz_lpf.update(corrected_delta_vel_ef.xy() / imu_delayed.delta_vel_dt, imu_delayed.delta_vel_dt);
 }
 
+void Ekf::resetAttitudeToExternalObservation(const Quatf &quat, const float attitude_accuracy)
+{
+	const Quatf quat_before_reset = _state.quat_nominal;
+
+	_state.quat_nominal = quat.normalized();
+	_R_to_earth = Dcmf(_state.quat_nominal);
+
+	resetQuatCov(Vector3f(sq(attitude_accuracy), sq(attitude_accuracy), sq(attitude_accuracy)));
+
+	_time_last_heading_fuse = _time_delayed_us;
+
+	propagateQuatReset(quat_before_reset);
+
+	// rotate horizontal velocity by the yaw change
+	const float yaw_diff = wrap_pi(getEulerYaw(_state.quat_nominal) - getEulerYaw(quat_before_reset));
+	resetHorizontalVelocityToMatchYaw(yaw_diff);
+
+	// no need to wait for the tilt variance to converge
+	_control_status.flags.tilt_align = true;
+	_control_status.flags.yaw_align = true;
+}
+
 bool Ekf::resetGlobalPosToExternalObservation(const double latitude, const double longitude, const float altitude,
 		const float eph,
 		const float epv, uint64_t timestamp_observation)
@@ -383,7 +413,7 @@ bool Ekf::resetGlobalPosToExternalObservation(const double latitude, const doubl
 
 			// Reset the positon of the output predictor to avoid a transient that would disturb the
 			// position controller
-			_output_predictor.resetLatLonTo(_gpos.latitude_deg(), _gpos.longitude_deg());
+			_output_predictor.resetLatLonTo(_gpos);
 
 			_time_last_hor_pos_fuse = _time_delayed_us;
 			_last_known_gpos.setLatLon(gpos_corrected);
@@ -54,6 +54,8 @@
 #include "bias_estimator/height_bias_estimator.hpp"
 #include "bias_estimator/position_bias_estimator.hpp"
 
+#include "estimator_timing.h"
+
 #include <ekf_derivation/generated/state.h>
 
 #include <uORB/topics/estimator_aid_source1d.h>
@@ -67,6 +69,10 @@
 # include "aid_sources/aux_global_position/aux_global_position.hpp"
 #endif // CONFIG_EKF2_AUX_GLOBAL_POSITION
 
+#if defined(CONFIG_EKF2_MAGNETOMETER)
+# include <lib/world_magnetic_model/geo_mag_declination.h>
+#endif // CONFIG_EKF2_MAGNETOMETER
+
 enum class Likelihood { LOW, MEDIUM, HIGH };
 class ExternalVisionVel;
 
@@ -179,6 +185,9 @@ public:
 	// get the diagonal elements of the covariance matrix
 	matrix::Vector<float, State::size> covariances_diagonal() const { return P.diag(); }
 
+	// execution time of the filter update sections (only measured with CONFIG_EKF2_TIMING)
+	EstimatorTiming &timing() { return _timing; }
+
 	matrix::Vector3f getRotVarBody() const;
 	matrix::Vector3f getRotVarNed() const;
 	float getYawVar() const;
@@ -263,6 +272,69 @@ public:
 
 	bool measurementUpdate(VectorState &K, const VectorState &H, const float R, const float innovation);
 
+	// same as above for an observation Jacobian with only a few non-zero elements, P * H is only computed over those
+	template <size_t ...Idxs>
+	bool measurementUpdate(VectorState &K, const matrix::SparseVector<float, State::size, Idxs...> &H, const float R,
+			       const float innovation)
+	{
+		clearInhibitedStateKalmanGains(K);
+
+		// Joseph stabilized covariance update, see the dense version for the details
+		// Step 1: conventional update
+		// P is symmetric, so PH == H.T * P. Taking the rows is faster as matrices are row-major
+		VectorState PH;
+
+		for (size_t k = 0; k < H.non_zeros(); k++) {
+			const float h = H.atCompressedIndex(k);
+			const unsigned row = H.index(k);
+
+			for (unsigned j = 0; j < State::size; j++) {
+				PH(j) += h * P(row, j);
+			}
+		}
+
+		uint8_t idx[State::size];
+		const unsigned n = getCovarianceUpdateIndices(K, PH, idx);
+
+		for (unsigned a = 0; a < n; a++) {
+			const unsigned i = idx[a];
+
+			if (K(i) != 0.f) {
+				for (unsigned b = 0; b < n; b++) {
+					P(i, idx[b]) -= K(i) * PH(idx[b]); // P is now not symmetrical if K is not optimal (e.g.: some gains have been zeroed)
+				}
+			}
+		}
+
+		// Step 2: stabilized update
+		// P (or "P_temp") is not symmetric so we must take the columns
+		for (unsigned a = 0; a < n; a++) {
+			float accum = 0.f;
+
+			for (size_t k = 0; k < H.non_zeros(); k++) {
+				accum += P(idx[a], H.index(k)) * H.atCompressedIndex(k);
+			}
+
+			PH(idx[a]) = accum;
+		}
+
+		for (unsigned a = 0; a < n; a++) {
+			const unsigned i = idx[a];
+
+			for (unsigned b = 0; b <= a; b++) {
+				const unsigned j = idx[b];
+				P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
+				P(j, i) = P(i, j);
+			}
+		}
+
+		constrainStateVariances();
+
+		// apply the state corrections
+		fuse(K, innovation);
+		return true;
+	}
+
 	// gyro bias
 	const Vector3f &getGyroBias() const { return _state.gyro_bias; } // get the gyroscope bias in rad/s
 	Vector3f getGyroBiasVariance() const { return getStateVariance<State::gyro_bias>(); } // get the gyroscope bias variance in rad/s
@@ -432,6 +504,9 @@ public:
 		_control_status.flags.yaw_manual = true;
 	}
 
+	// align the complete attitude to an external reference (e.g. the ground truth in simulation)
+	void resetAttitudeToExternalObservation(const Quatf &quat, float attitude_accuracy);
+
 	void updateParameters();
 
 	friend class AuxGlobalPosition;
@@ -487,7 +562,7 @@ private:
 
 	StateSample _state{};		///< state struct of the ekf running at the delayed time horizon
 
-	LatLonAlt _gpos{0.0, 0.0, 0.f};
+	SplitLatLonAlt _gpos{0.0, 0.0, 0.f};
 
 	bool _filter_initialised{false};	///< true when the EKF sttes and covariances been initialised
 
@@ -502,10 +577,10 @@ private:
 	uint64_t _time_last_heading_fuse{0};
 	uint64_t _time_last_terrain_fuse{0};
 
-	LatLonAlt _last_known_gpos{};
+	SplitLatLonAlt _last_known_gpos{};
 
 	Vector3f _earth_rate_NED{}; ///< earth rotation vector (NED) in rad/s
-	double _earth_rate_lat_ref_rad{0.0}; ///< latitude at which the earth rate was evaluated (radians)
+	float _earth_rate_lat_ref_rad{0.f}; ///< latitude at which the earth rate was evaluated (radians)
 
 	Dcmf _R_to_earth{};	///< transformation matrix from body frame to earth frame from last EKF prediction
 
@@ -519,6 +594,8 @@ private:
 
 	SquareMatrixState P{};	///< state covariance matrix
 
+	EstimatorTiming _timing{};
+
 #if defined(CONFIG_EKF2_DRAG_FUSION)
 	estimator_aid_source2d_s _aid_src_drag {};
 #endif // CONFIG_EKF2_DRAG_FUSION
@@ -627,6 +704,8 @@ private:
 	// Variables used to control activation of post takeoff functionality
 	uint64_t _flt_mag_align_start_time{0};	///< time that inflight magnetic field alignment started (uSec)
 	uint64_t _time_last_mag_check_failing{0};
+
+	MagFieldLookup _wmm_lookup{}; ///< world magnetic model lookup, caching the grid cell of the last position
 #endif // CONFIG_EKF2_MAGNETOMETER
 
 	// variables used to inhibit accel bias learning
@@ -673,7 +752,7 @@ private:
 
 #if defined(CONFIG_EKF2_MAGNETOMETER)
 	// ekf sequential fusion of magnetometer measurements
-	bool fuseMag(const Vector3f &mag, const float R_MAG, VectorState &H, estimator_aid_source3d_s &aid_src,
+	bool fuseMag(const Vector3f &mag, const float R_MAG, const VectorState (&H)[3], estimator_aid_source3d_s &aid_src,
 		     bool update_all_states = false, bool update_tilt = false);
 
 	// fuse magnetometer declination measurement
@@ -765,6 +844,11 @@ private:
 	void updateTerrainValidity();
 	void updateTerrainResetStatus(const float delta_z);
 
+	// remove the correlations between the terrain and the other states when the terrain is
+	// estimated as a separate 1-state filter (EKF2_TERR_DCPL)
+	void decoupleTerrain();
+	bool isTerrainDecoupled() const { return _params.ekf2_terr_dcpl != 0; }
+
 # if defined(CONFIG_EKF2_RANGE_FINDER)
 	// update the terrain vertical position estimate using a height above ground measurement from the range finder
 	bool fuseHaglRng(estimator_aid_source1d_s &aid_src, bool update_height, bool update_terrain);
@@ -817,6 +901,23 @@ private:
 
 	void clearInhibitedStateKalmanGains(VectorState &K) const;
 
+	// Get the indices (in ascending order) of the states modified by a covariance update with
+	// the Kalman gain K and PH = P * H. A state with a zero gain that is uncorrelated with the
+	// observation (e.g.: disabled, inhibited or not yet active) keeps its row and column of P
+	// unchanged, so the update cost only scales with the number of active states.
+	static unsigned getCovarianceUpdateIndices(const VectorState &K, const VectorState &PH, uint8_t (&idx)[State::size])
+	{
+		unsigned n = 0;
+
+		for (unsigned i = 0; i < State::size; i++) {
+			if ((K(i) != 0.f) || (PH(i) != 0.f)) {
+				idx[n++] = i;
+			}
+		}
+
+		return n;
+	}
+
 	// limit the diagonal of the covariance matrix
 	void constrainStateVariances();
 
@@ -1061,9 +1061,17 @@ void Ekf::fuseDirectStateMeasurement(const float innov, const float innov_var, c
 	// P is symmetric, so PH == H.T * P.T == H.T * P. Taking the row is faster as matrices are row-major
 	VectorState PH = P.row(state_index);
 
-	for (unsigned i = 0; i < State::size; i++) {
-		for (unsigned j = 0; j < State::size; j++) {
-			P(i, j) -= K(i) * PH(j); // P is now not symmetric if K is not optimal (e.g.: some gains have been zeroed)
+	// only the rows and columns of the states affected by the observation are updated
+	uint8_t idx[State::size];
+	const unsigned n = getCovarianceUpdateIndices(K, PH, idx);
+
+	for (unsigned a = 0; a < n; a++) {
+		const unsigned i = idx[a];
+
+		if (K(i) != 0.f) {
+			for (unsigned b = 0; b < n; b++) {
+				P(i, idx[b]) -= K(i) * PH(idx[b]); // P is now not symmetric if K is not optimal (e.g.: some gains have been zeroed)
+			}
 		}
 	}
 
@@ -1071,8 +1079,11 @@ void Ekf::fuseDirectStateMeasurement(const float innov, const float innov_var, c
 	// P (or "P_temp") is not symmetric so we must take the column
 	PH = P.col(state_index);
 
-	for (unsigned i = 0; i < State::size; i++) {
-		for (unsigned j = 0; j <= i; j++) {
+	for (unsigned a = 0; a < n; a++) {
+		const unsigned i = idx[a];
+
+		for (unsigned b = 0; b <= a; b++) {
+			const unsigned j = idx[b];
 			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
 			P(j, i) = P(i, j);
 		}
@@ -1112,17 +1123,37 @@ bool Ekf::measurementUpdate(VectorState &K, const VectorState &H, const float R,
 	// P is symmetric, so PH == H.T * P.T == H.T * P. Taking the row is faster as matrices are row-major
 	VectorState PH = P * H; // H is stored as a column vector. H is in fact H.T
 
-	for (unsigned i = 0; i < State::size; i++) {
-		for (unsigned j = 0; j < State::size; j++) {
-			P(i, j) -= K(i) * PH(j); // P is now not symmetrical if K is not optimal (e.g.: some gains have been zeroed)
+	// only the rows and columns of the states affected by the observation are updated
+	uint8_t idx[State::size];
+	const unsigned n = getCovarianceUpdateIndices(K, PH, idx);
+
+	for (unsigned a = 0; a < n; a++) {
+		const unsigned i = idx[a];
+
+		if (K(i) != 0.f) {
+			for (unsigned b = 0; b < n; b++) {
+				P(i, idx[b]) -= K(i) * PH(idx[b]); // P is now not symmetrical if K is not optimal (e.g.: some gains have been zeroed)
+			}
 		}
 	}
 
 	// Step 2: stabilized update
-	PH = P * H; // H is stored as a column vector. H is in fact H.T
+	for (unsigned a = 0; a < n; a++) {
+		const unsigned i = idx[a];
+		float accum = 0.f;
+
+		for (unsigned k = 0; k < State::size; k++) {
+			accum += P(i, k) * H(k);
+		}
+
+		PH(i) = accum;
+	}
+
+	for (unsigned a = 0; a < n; a++) {
+		const unsigned i = idx[a];
 
-	for (unsigned i = 0; i < State::size; i++) {
-		for (unsigned j = 0; j <= i; j++) {
+		for (unsigned b = 0; b <= a; b++) {
+			const unsigned j = idx[b];
 			P(i, j) = P(i, j) - PH(i) * K(j) + K(i) * R * K(j);
 			P(j, i) = P(i, j);
 		}
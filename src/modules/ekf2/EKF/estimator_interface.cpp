@@ -128,7 +128,7 @@ void EstimatorInterface::setMagData(const magSample &mag_sample)
 
 	// Allocate the required buffer size if not previously done
 	if (_mag_buffer == nullptr) {
-		_mag_buffer = new TimestampedRingBuffer<magSample>(_obs_buffer_length);
+		_mag_buffer = new TimestampedRingBuffer<magSample>(math::min(kObsBufferLengthInitial, _obs_buffer_length));
 
 		if (_mag_buffer == nullptr || !_mag_buffer->valid()) {
 			delete _mag_buffer;
@@ -148,7 +148,7 @@ void EstimatorInterface::setMagData(const magSample &mag_sample)
 		magSample mag_sample_new{mag_sample};
 		mag_sample_new.time_us = time_us;
 
-		_mag_buffer->push(mag_sample_new);
+		pushObservation(*_mag_buffer, mag_sample_new, _obs_buffer_length);
 		_time_last_mag_buffer_push = _time_latest_us;
 
 	} else {
@@ -167,7 +167,7 @@ void EstimatorInterface::setGpsData(const gnssSample &gnss_sample, const bool pp
 
 	// Allocate the required buffer size if not previously done
 	if (_gps_buffer == nullptr) {
-		_gps_buffer = new TimestampedRingBuffer<gnssSample>(_obs_buffer_length);
+		_gps_buffer = new TimestampedRingBuffer<gnssSample>(math::min(kObsBufferLengthInitial, _obs_buffer_length));
 
 		if (_gps_buffer == nullptr || !_gps_buffer->valid()) {
 			delete _gps_buffer;
@@ -189,7 +189,7 @@ void EstimatorInterface::setGpsData(const gnssSample &gnss_sample, const bool pp
 
 		gnss_sample_new.time_us = time_us;
 
-		_gps_buffer->push(gnss_sample_new);
+		pushObservation(*_gps_buffer, gnss_sample_new, _obs_buffer_length);
 		_time_last_gps_buffer_push = _time_latest_us;
 
 #if defined(CONFIG_EKF2_GNSS_YAW)
@@ -216,7 +216,7 @@ void EstimatorInterface::setBaroData(const baroSample &baro_sample)
 
 	// Allocate the required buffer size if not previously done
 	if (_baro_buffer == nullptr) {
-		_baro_buffer = new TimestampedRingBuffer<baroSample>(_obs_buffer_length);
+		_baro_buffer = new TimestampedRingBuffer<baroSample>(math::min(kObsBufferLengthInitial, _obs_buffer_length));
 
 		if (_baro_buffer == nullptr || !_baro_buffer->valid()) {
 			delete _baro_buffer;
@@ -236,7 +236,7 @@ void EstimatorInterface::setBaroData(const baroSample &baro_sample)
 		baroSample baro_sample_new{baro_sample};
 		baro_sample_new.time_us = time_us;
 
-		_baro_buffer->push(baro_sample_new);
+		pushObservation(*_baro_buffer, baro_sample_new, _obs_buffer_length);
 		_time_last_baro_buffer_push = _time_latest_us;
 
 	} else {
@@ -255,7 +255,7 @@ void EstimatorInterface::setAirspeedData(const airspeedSample &airspeed_sample)
 
 	// Allocate the required buffer size if not previously done
 	if (_airspeed_buffer == nullptr) {
-		_airspeed_buffer = new TimestampedRingBuffer<airspeedSample>(_obs_buffer_length);
+		_airspeed_buffer = new TimestampedRingBuffer<airspeedSample>(math::min(kObsBufferLengthInitial, _obs_buffer_length));
 
 		if (_airspeed_buffer == nullptr || !_airspeed_buffer->valid()) {
 			delete _airspeed_buffer;
@@ -275,7 +275,7 @@ void EstimatorInterface::setAirspeedData(const airspeedSample &airspeed_sample)
 		airspeedSample airspeed_sample_new{airspeed_sample};
 		airspeed_sample_new.time_us = time_us;
 
-		_airspeed_buffer->push(airspeed_sample_new);
+		pushObservation(*_airspeed_buffer, airspeed_sample_new, _obs_buffer_length);
 
 	} else {
 		ECL_WARN("airspeed data too fast %" PRIi64 " < %" PRIu64 " + %d", time_us, _airspeed_buffer->get_newest().time_us,
@@ -293,7 +293,7 @@ void EstimatorInterface::setRangeData(const sensor::rangeSample &range_sample)
 
 	// Allocate the required buffer size if not previously done
 	if (_range_buffer == nullptr) {
-		_range_buffer = new TimestampedRingBuffer<sensor::rangeSample>(_obs_buffer_length);
+		_range_buffer = new TimestampedRingBuffer<sensor::rangeSample>(math::min(kObsBufferLengthInitial, _obs_buffer_length));
 
 		if (_range_buffer == nullptr || !_range_buffer->valid()) {
 			delete _range_buffer;
@@ -313,7 +313,7 @@ void EstimatorInterface::setRangeData(const sensor::rangeSample &range_sample)
 		sensor::rangeSample range_sample_new{range_sample};
 		range_sample_new.time_us = time_us;
 
-		_range_buffer->push(range_sample_new);
+		pushObservation(*_range_buffer, range_sample_new, _obs_buffer_length);
 		_time_last_range_buffer_push = _time_latest_us;
 
 	} else {
@@ -332,7 +332,7 @@ void EstimatorInterface::setOpticalFlowData(const flowSample &flow)
 
 	// Allocate the required buffer size if not previously done
 	if (_flow_buffer == nullptr) {
-		_flow_buffer = new TimestampedRingBuffer<flowSample>(_imu_buffer_length);
+		_flow_buffer = new TimestampedRingBuffer<flowSample>(math::min(kObsBufferLengthInitial, _imu_buffer_length));
 
 		if (_flow_buffer == nullptr || !_flow_buffer->valid()) {
 			delete _flow_buffer;
@@ -352,7 +352,7 @@ void EstimatorInterface::setOpticalFlowData(const flowSample &flow)
 		flowSample optflow_sample_new{flow};
 		optflow_sample_new.time_us = time_us;
 
-		_flow_buffer->push(optflow_sample_new);
+		pushObservation(*_flow_buffer, optflow_sample_new, _imu_buffer_length);
 
 	} else {
 		ECL_WARN("optical flow data too fast %" PRIi64 " < %" PRIu64 " + %d", time_us, _flow_buffer->get_newest().time_us,
@@ -370,7 +370,7 @@ void EstimatorInterface::setExtVisionData(const extVisionSample &evdata)
 
 	// Allocate the required buffer size if not previously done
 	if (_ext_vision_buffer == nullptr) {
-		_ext_vision_buffer = new TimestampedRingBuffer<extVisionSample>(_obs_buffer_length);
+		_ext_vision_buffer = new TimestampedRingBuffer<extVisionSample>(math::min(kObsBufferLengthInitial, _obs_buffer_length));
 
 		if (_ext_vision_buffer == nullptr || !_ext_vision_buffer->valid()) {
 			delete _ext_vision_buffer;
@@ -391,7 +391,7 @@ void EstimatorInterface::setExtVisionData(const extVisionSample &evdata)
 		extVisionSample ev_sample_new{evdata};
 		ev_sample_new.time_us = time_us;
 
-		_ext_vision_buffer->push(ev_sample_new);
+		pushObservation(*_ext_vision_buffer, ev_sample_new, _obs_buffer_length);
 		_time_last_ext_vision_buffer_push = _time_latest_us;
 
 	} else {
@@ -410,7 +410,7 @@ void EstimatorInterface::setAuxVelData(const auxVelSample &auxvel_sample)
 
 	// Allocate the required buffer size if not previously done
 	if (_auxvel_buffer == nullptr) {
-		_auxvel_buffer = new TimestampedRingBuffer<auxVelSample>(_obs_buffer_length);
+		_auxvel_buffer = new TimestampedRingBuffer<auxVelSample>(math::min(kObsBufferLengthInitial, _obs_buffer_length));
 
 		if (_auxvel_buffer == nullptr || !_auxvel_buffer->valid()) {
 			delete _auxvel_buffer;
@@ -430,7 +430,7 @@ void EstimatorInterface::setAuxVelData(const auxVelSample &auxvel_sample)
 		auxVelSample auxvel_sample_new{auxvel_sample};
 		auxvel_sample_new.time_us = time_us;
 
-		_auxvel_buffer->push(auxvel_sample_new);
+		pushObservation(*_auxvel_buffer, auxvel_sample_new, _obs_buffer_length);
 
 	} else {
 		ECL_WARN("aux velocity data too fast %" PRIi64 " < %" PRIu64 " + %d", time_us, _auxvel_buffer->get_newest().time_us,
@@ -447,7 +447,7 @@ void EstimatorInterface::setSystemFlagData(const systemFlagUpdate &system_flags)
 
 	// Allocate the required buffer size if not previously done
 	if (_system_flag_buffer == nullptr) {
-		_system_flag_buffer = new TimestampedRingBuffer<systemFlagUpdate>(_obs_buffer_length);
+		_system_flag_buffer = new TimestampedRingBuffer<systemFlagUpdate>(math::min(kObsBufferLengthInitial, _obs_buffer_length));
 
 		if (_system_flag_buffer == nullptr || !_system_flag_buffer->valid()) {
 			delete _system_flag_buffer;
@@ -466,7 +466,7 @@ void EstimatorInterface::setSystemFlagData(const systemFlagUpdate &system_flags)
 		systemFlagUpdate system_flags_new{system_flags};
 		system_flags_new.time_us = time_us;
 
-		_system_flag_buffer->push(system_flags_new);
+		pushObservation(*_system_flag_buffer, system_flags_new, _obs_buffer_length);
 
 	} else {
 		ECL_DEBUG("system flag update too fast %" PRIi64 " < %" PRIu64 " + %d", time_us,
@@ -483,7 +483,7 @@ void EstimatorInterface::setDragData(const imuSample &imu)
 
 		// Allocate the required buffer size if not previously done
 		if (_drag_buffer == nullptr) {
-			_drag_buffer = new TimestampedRingBuffer<dragSample>(_obs_buffer_length);
+			_drag_buffer = new TimestampedRingBuffer<dragSample>(math::min(kObsBufferLengthInitial, _obs_buffer_length));
 
 			if (_drag_buffer == nullptr || !_drag_buffer->valid()) {
 				delete _drag_buffer;
@@ -526,7 +526,7 @@ void EstimatorInterface::setDragData(const imuSample &imu)
 			_drag_down_sampled.time_us /= _drag_sample_count;
 
 			// write to buffer
-			_drag_buffer->push(_drag_down_sampled);
+			pushObservation(*_drag_buffer, _drag_down_sampled, _obs_buffer_length);
 
 			// reset accumulators
 			_drag_sample_count = 0;
@@ -339,6 +339,7 @@ protected:
 	 arrive too soon after the previous measurement will not be processed.
 	 max freq (Hz) = (OBS_BUFFER_LENGTH - 1) / (IMU_BUFFER_LENGTH * FILTER_UPDATE_PERIOD_S)
 	 This can be adjusted to match the max sensor data rate plus some margin for jitter.
+	 This is the maximum length, each observation buffer only grows up to the length required by its data rate.
 	*/
 	uint8_t _obs_buffer_length{0};
 
@@ -503,6 +504,23 @@ protected:
 
 	void printBufferAllocationFailed(const char *buffer_name);
 
+	// the observation buffers start short and grow with the measured data rate and delay
+	static constexpr uint8_t kObsBufferLengthInitial = 4;
+	static constexpr uint8_t kObsBufferLengthStep = 4;
+
+	template<typename T>
+	void pushObservation(TimestampedRingBuffer<T> &buffer, const T &sample, const uint8_t max_length)
+	{
+		// only grow if the sample about to be overwritten could still be retrieved at the fusion time horizon
+		if (buffer.full() && (buffer.get_length() < max_length)
+		    && (buffer.get_oldest().time_us + (uint64_t)1e5 > _time_delayed_us)) {
+
+			buffer.resize(math::min((int)max_length, buffer.get_length() + kObsBufferLengthStep));
+		}
+
+		buffer.push(sample);
+	}
+
 	ImuDownSampler _imu_down_sampler{_params.ekf2_predict_us};
 };
 #endif // !EKF_ESTIMATOR_INTERFACE_H
@@ -0,0 +1,159 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * @file estimator_timing.h
+ * Optional execution time measurement of the filter update sections (CONFIG_EKF2_TIMING).
+ *
+ * The time source is provided by the user (e.g. hrt_absolute_time() in the module or a
+ * wall clock in the unit tests), nothing is measured until it is set.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+class EstimatorTiming
+{
+public:
+	// must match the SECTION_* constants of the estimator_timing message
+	enum class Section : uint8_t {
+		PREDICT_COVARIANCE = 0,
+		PREDICT_STATE,
+		MAG,
+		OPTICAL_FLOW,
+		GNSS,
+		AUX_GLOBAL_POSITION,
+		AIRSPEED,
+		SIDESLIP,
+		DRAG,
+		HEIGHT,
+		GRAVITY,
+		EXTERNAL_VISION,
+		AUXVEL,
+		TERRAIN,
+		OTHER,
+		OUTPUT_PREDICTOR,
+
+		COUNT
+	};
+
+	static constexpr unsigned SECTION_COUNT = static_cast<unsigned>(Section::COUNT);
+
+#if defined(CONFIG_EKF2_TIMING)
+	typedef uint64_t (*TimeSource)();
+
+	struct Stats {
+		uint64_t total_us; ///< accumulated time of all the updates
+		uint32_t max_us;   ///< maximum time in a single update
+	};
+
+	void setTimeSource(TimeSource time_source) { _time_source = time_source; }
+
+	// mark the start of a filter update
+	void begin()
+	{
+		if (_time_source) {
+			_update_start_us = _lap_start_us = _time_source();
+		}
+	}
+
+	// attribute the time elapsed since the previous lap to a section
+	void lap(Section section)
+	{
+		if (_time_source) {
+			const uint64_t now = _time_source();
+			_current_us[static_cast<unsigned>(section)] += static_cast<uint32_t>(now - _lap_start_us);
+			_lap_start_us = now;
+		}
+	}
+
+	// mark the end of a filter update
+	void end()
+	{
+		if (!_time_source) {
+			return;
+		}
+
+		for (unsigned i = 0; i < SECTION_COUNT; i++) {
+			accumulate(_sections[i], _current_us[i]);
+			_current_us[i] = 0;
+		}
+
+		accumulate(_update, static_cast<uint32_t>(_time_source() - _update_start_us));
+		_updates++;
+	}
+
+	// clear the accumulated statistics, e.g. after publishing them
+	void reset()
+	{
+		for (unsigned i = 0; i < SECTION_COUNT; i++) {
+			_sections[i] = {};
+		}
+
+		_update = {};
+		_updates = 0;
+	}
+
+	uint32_t updates() const { return _updates; }
+	const Stats &update() const { return _update; }
+	const Stats &section(unsigned index) const { return _sections[index]; }
+
+private:
+	static void accumulate(Stats &stats, uint32_t elapsed_us)
+	{
+		stats.total_us += elapsed_us;
+
+		if (elapsed_us > stats.max_us) {
+			stats.max_us = elapsed_us;
+		}
+	}
+
+	TimeSource _time_source{nullptr};
+
+	uint64_t _update_start_us{0};
+	uint64_t _lap_start_us{0};
+
+	uint32_t _current_us[SECTION_COUNT] {};
+
+	Stats _sections[SECTION_COUNT] {};
+	Stats _update{};
+	uint32_t _updates{0};
+#else
+	// compiled out
+	void begin() {}
+	void lap(Section) {}
+	void end() {}
+#endif // CONFIG_EKF2_TIMING
+};
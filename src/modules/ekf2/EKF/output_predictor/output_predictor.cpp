@@ -45,7 +45,8 @@ void OutputPredictor::print_status()
 	printf("[output predictor] IMU dt: %.6f, EKF dt: %.6f\n",
 	       (double)_dt_update_states_avg, (double)_dt_correct_states_avg);
 
-	const matrix::Quatf q_att = _output_buffer.get_newest().quat_nominal;
+	const outputSample output_newest = correctedSample(_output_buffer.get_newest());
+	const matrix::Quatf q_att = output_newest.quat_nominal;
 	const matrix::Eulerf euler = q_att;
 
 	printf("[output predictor] orientation: [%.4f, %.4f, %.4f, %.4f] (Euler [%.3f, %.3f, %.3f])\n",
@@ -53,12 +54,10 @@ void OutputPredictor::print_status()
 	       (double)euler.phi(), (double)euler.theta(), (double)euler.psi());
 
 	printf("[output predictor] velocity: [%.3f, %.3f, %.3f]\n",
-	       (double)_output_buffer.get_newest().vel(0), (double)_output_buffer.get_newest().vel(1),
-	       (double)_output_buffer.get_newest().vel(2));
+	       (double)output_newest.vel(0), (double)output_newest.vel(1), (double)output_newest.vel(2));
 
 	printf("[output predictor] position: [%.3f, %.3f, %.3f]\n",
-	       (double)_output_buffer.get_newest().pos(0), (double)_output_buffer.get_newest().pos(1),
-	       (double)_output_buffer.get_newest().pos(2));
+	       (double)output_newest.pos(0), (double)output_newest.pos(1), (double)output_newest.pos(2));
 
 	printf("[output predictor] tracking error, angular: %.6f rad, velocity: %.4f m/s, position: %.4f m\n",
 	       (double)_output_tracking_error(0), (double)_output_tracking_error(1), (double)_output_tracking_error(2));
@@ -70,9 +69,10 @@ void OutputPredictor::print_status()
 	       _output_vert_buffer.entries(), _output_vert_buffer.get_length(), _output_vert_buffer.get_total_size());
 }
 
-void OutputPredictor::alignOutputFilter(const Quatf &quat_state, const Vector3f &vel_state, const LatLonAlt &gpos_state)
+void OutputPredictor::alignOutputFilter(const Quatf &quat_state, const Vector3f &vel_state,
+		const SplitLatLonAlt &gpos_state)
 {
-	const outputSample &output_delayed = _output_buffer.get_oldest();
+	const outputSample output_delayed = correctedSample(_output_buffer.get_oldest());
 
 	// calculate the quaternion rotation delta from the EKF to output observer states at the EKF fusion time horizon
 	Quatf q_delta{quat_state * output_delayed.quat_nominal.inversed()};
@@ -89,11 +89,12 @@ void OutputPredictor::alignOutputFilter(const Quatf &quat_state, const Vector3f
 	for (uint8_t i = 0; i < _output_buffer.get_length(); i++) {
 		_output_buffer[i].quat_nominal = q_delta * _output_buffer[i].quat_nominal;
 		_output_buffer[i].quat_nominal.normalize();
-		_output_buffer[i].vel += vel_delta;
-		_output_buffer[i].pos += pos_delta;
 	}
 
-	_output_new = _output_buffer.get_newest();
+	_output_vel_offset += vel_delta;
+	_output_pos_offset += pos_delta;
+
+	_output_new = correctedSample(_output_buffer.get_newest());
 }
 
 void OutputPredictor::reset()
@@ -123,6 +124,13 @@ void OutputPredictor::reset()
 
 	_output_tracking_error.setZero();
 
+	_output_vel_offset.setZero();
+	_output_pos_offset.setZero();
+	_output_vert_vel_offset = 0.f;
+
+	_vert_vel_integ_incr_sum = 0.f;
+	_vert_dt_sum = 0.f;
+
 	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
 		_output_buffer[index] = {};
 	}
@@ -146,19 +154,15 @@ void OutputPredictor::resetQuaternion(const Quatf &quat_change)
 
 void OutputPredictor::resetHorizontalVelocityTo(const Vector2f &delta_horz_vel)
 {
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
-		_output_buffer[index].vel.xy() += delta_horz_vel;
-	}
+	_output_vel_offset.xy() += delta_horz_vel;
 
 	_output_new.vel.xy() += delta_horz_vel;
 }
 
 void OutputPredictor::resetVerticalVelocityTo(float delta_vert_vel)
 {
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
-		_output_buffer[index].vel(2) += delta_vert_vel;
-		_output_vert_buffer[index].vert_vel += delta_vert_vel;
-	}
+	_output_vel_offset(2) += delta_vert_vel;
+	_output_vert_vel_offset += delta_vert_vel;
 
 	_output_new.vel(2) += delta_vert_vel;
 	_output_vert_new.vert_vel += delta_vert_vel;
@@ -166,8 +170,12 @@ void OutputPredictor::resetVerticalVelocityTo(float delta_vert_vel)
 
 void OutputPredictor::resetLatLonTo(const double &new_latitude, const double &new_longitude)
 {
-	_global_ref.setLatitudeDeg(new_latitude);
-	_global_ref.setLongitudeDeg(new_longitude);
+	_global_ref.setLatLonDeg(new_latitude, new_longitude);
+}
+
+void OutputPredictor::resetLatLonTo(const SplitLatLonAlt &new_gpos)
+{
+	_global_ref.setLatLon(new_gpos);
 }
 
 void OutputPredictor::resetAltitudeTo(const float new_altitude, const float vert_pos_change)
@@ -265,7 +273,7 @@ void OutputPredictor::calculateOutputStates(const uint64_t time_us, const Vector
 }
 
 void OutputPredictor::correctOutputStates(const uint64_t time_delayed_us,
-		const Quatf &quat_state, const Vector3f &vel_state, const LatLonAlt &gpos_state, const matrix::Vector3f &gyro_bias,
+		const Quatf &quat_state, const Vector3f &vel_state, const SplitLatLonAlt &gpos_state, const matrix::Vector3f &gyro_bias,
 		const matrix::Vector3f &accel_bias)
 {
 	// calculate an average filter update time
@@ -281,14 +289,13 @@ void OutputPredictor::correctOutputStates(const uint64_t time_delayed_us,
 	_accel_bias = accel_bias;
 
 	// store the INS states in a ring buffer with the same length and time coordinates as the IMU data buffer
-	_output_buffer.push(_output_new);
-	_output_vert_buffer.push(_output_vert_new);
+	pushOutputStates();
 
 	// get the oldest INS state data from the ring buffer
 	// this data will be at the EKF fusion time horizon
 	// TODO: there is no guarantee that data is at delayed fusion horizon
 	//       Shouldnt we use pop_first_older_than?
-	const outputSample &output_delayed = _output_buffer.get_oldest();
+	const outputSample output_delayed = correctedSample(_output_buffer.get_oldest());
 	const outputVert &output_vert_delayed = _output_vert_buffer.get_oldest();
 
 	// calculate the quaternion delta between the INS and EKF quaternions at the EKF fusion time horizon
@@ -324,7 +331,7 @@ void OutputPredictor::correctOutputStates(const uint64_t time_delayed_us,
 	const Vector3f pos_state = gpos_state - _global_ref;
 
 	// calculate down velocity and position tracking errors
-	const float vert_vel_err = (vel_state(2) - output_vert_delayed.vert_vel);
+	const float vert_vel_err = (vel_state(2) - (output_vert_delayed.vert_vel + _output_vert_vel_offset));
 	const float vert_vel_integ_err = (pos_state(2) - output_vert_delayed.vert_vel_integ);
 
 	// calculate a velocity correction that will be applied to the output state history
@@ -355,36 +362,98 @@ void OutputPredictor::correctOutputStates(const uint64_t time_delayed_us,
 	_global_ref = gpos_state;
 }
 
-void OutputPredictor::applyCorrectionToVerticalOutputBuffer(const float vert_vel_correction, const float pos_ref_change)
+void OutputPredictor::pushOutputStates()
 {
-	// loop through the vertical output filter state history starting at the oldest and apply the corrections to the
-	// vert_vel states and propagate vert_vel_integ forward using the corrected vert_vel
-	uint8_t index = _output_vert_buffer.get_oldest_index();
+	outputSample output{_output_new};
+	output.vel -= _output_vel_offset;
+	output.pos -= _output_pos_offset;
+	_output_buffer.push(output);
 
-	const uint8_t size = _output_vert_buffer.get_length();
+	outputVert output_vert{_output_vert_new};
+	output_vert.vert_vel -= _output_vert_vel_offset;
+	output_vert.vert_vel_integ_incr = (_output_vert_buffer.get_newest().vert_vel + output_vert.vert_vel) * 0.5f * output_vert.dt;
+
+	const bool vert_buffer_full = _output_vert_buffer.full();
+	_output_vert_buffer.push(output_vert);
 
-	for (uint8_t counter = 0; counter < (size - 1); counter++) {
-		const uint8_t index_next = (index + 1) % size;
-		outputVert &current_state = _output_vert_buffer[index];
-		outputVert &next_state = _output_vert_buffer[index_next];
+	if (_output_vert_buffer.get_newest_index() == _output_vert_buffer.get_oldest_index()) {
+		// first sample, nothing after the oldest one
+		_vert_vel_integ_incr_sum = 0.f;
+		_vert_dt_sum = 0.f;
 
-		// correct the velocity
-		if (counter == 0) {
-			current_state.vert_vel += vert_vel_correction;
+	} else {
+		if (vert_buffer_full) {
+			// the previous second oldest entry is now the oldest one
+			_vert_vel_integ_incr_sum -= _output_vert_buffer.get_oldest().vert_vel_integ_incr;
+			_vert_dt_sum -= _output_vert_buffer.get_oldest().dt;
 		}
 
-		next_state.vert_vel += vert_vel_correction;
+		_vert_vel_integ_incr_sum += output_vert.vert_vel_integ_incr;
+		_vert_dt_sum += output_vert.dt;
+	}
 
-		// position is propagated forward using the corrected velocity and a trapezoidal integrator
-		next_state.vert_vel_integ = current_state.vert_vel_integ + (current_state.vert_vel + next_state.vert_vel) * 0.5f *
-					    next_state.dt - pos_ref_change;
+	// once per buffer cycle, keep the offsets small and remove the rounding errors of the running sums
+	if (_output_buffer.get_newest_index() == 0) {
+		applyOffsetsToOutputBuffers();
+	}
+}
 
-		// advance the index
-		index = (index + 1) % size;
+void OutputPredictor::applyOffsetsToOutputBuffers()
+{
+	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
+		_output_buffer[index].vel += _output_vel_offset;
+		_output_buffer[index].pos += _output_pos_offset;
+	}
+
+	_output_vel_offset.setZero();
+	_output_pos_offset.setZero();
+
+	_vert_vel_integ_incr_sum = 0.f;
+	_vert_dt_sum = 0.f;
+
+	const uint8_t oldest_index = _output_vert_buffer.get_oldest_index();
+
+	for (uint8_t index = 0; index < _output_vert_buffer.get_length(); index++) {
+		outputVert &output_vert = _output_vert_buffer[index];
+		output_vert.vert_vel += _output_vert_vel_offset;
+		output_vert.vert_vel_integ_incr += _output_vert_vel_offset * output_vert.dt;
+
+		if (index != oldest_index) {
+			_vert_vel_integ_incr_sum += output_vert.vert_vel_integ_incr;
+			_vert_dt_sum += output_vert.dt;
+		}
+	}
+
+	_output_vert_vel_offset = 0.f;
+}
+
+void OutputPredictor::applyCorrectionToVerticalOutputBuffer(const float vert_vel_correction, const float pos_ref_change)
+{
+	// the velocity correction is applied to all the vert_vel states
+	_output_vert_vel_offset += vert_vel_correction;
+
+	// vert_vel_integ is propagated forward from the oldest state using the corrected vert_vel and a trapezoidal integrator:
+	// vert_vel_integ(k) = vert_vel_integ(0) + sum(vert_vel_integ_incr(i) + offset * dt(i) - pos_ref_change) for i = 1..k
+	const uint8_t size = _output_vert_buffer.get_length();
+	const uint8_t oldest_index = _output_vert_buffer.get_oldest_index();
+	const uint8_t newest_index = _output_vert_buffer.get_newest_index();
+	const uint8_t newest_count = (newest_index + size - oldest_index) % size;
+
+	if (newest_count > 0) {
+		const float vert_vel_integ_oldest = _output_vert_buffer[oldest_index].vert_vel_integ;
+
+		// the next state becomes the oldest one after the next push
+		outputVert &next_state = _output_vert_buffer[(oldest_index + 1) % size];
+		next_state.vert_vel_integ = vert_vel_integ_oldest + next_state.vert_vel_integ_incr
+					    + _output_vert_vel_offset * next_state.dt - pos_ref_change;
+
+		_output_vert_buffer[newest_index].vert_vel_integ = vert_vel_integ_oldest + _vert_vel_integ_incr_sum
+				+ _output_vert_vel_offset * _vert_dt_sum - newest_count * pos_ref_change;
 	}
 
 	// update output state to corrected values
 	_output_vert_new = _output_vert_buffer.get_newest();
+	_output_vert_new.vert_vel += _output_vert_vel_offset;
 
 	// reset time delta to zero for the next accumulation of full rate IMU data
 	_output_vert_new.dt = 0.0f;
@@ -392,17 +461,12 @@ void OutputPredictor::applyCorrectionToVerticalOutputBuffer(const float vert_vel
 
 void OutputPredictor::applyCorrectionToOutputBuffer(const Vector3f &vel_correction, const Vector3f &pos_correction)
 {
-	// loop through the output filter state history and apply the corrections to the velocity and position states
-	for (uint8_t index = 0; index < _output_buffer.get_length(); index++) {
-		// a constant velocity correction is applied
-		_output_buffer[index].vel += vel_correction;
-
-		// a constant position correction is applied
-		_output_buffer[index].pos += pos_correction;
-	}
+	// a constant velocity and position correction is applied to the output filter state history
+	_output_vel_offset += vel_correction;
+	_output_pos_offset += pos_correction;
 
 	// update output state to corrected values
-	_output_new = _output_buffer.get_newest();
+	_output_new = correctedSample(_output_buffer.get_newest());
 }
 
 matrix::Vector3f OutputPredictor::getVelocityDerivative() const
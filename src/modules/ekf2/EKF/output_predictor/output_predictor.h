@@ -40,6 +40,7 @@
 
 #include <lib/geo/geo.h>
 #include <lib/lat_lon_alt/lat_lon_alt.hpp>
+#include <lib/lat_lon_alt/split_lat_lon_alt.hpp>
 
 class OutputPredictor
 {
@@ -53,7 +54,7 @@ public:
 
 	// modify output filter to match the the EKF state at the fusion time horizon
 	void alignOutputFilter(const matrix::Quatf &quat_state, const matrix::Vector3f &vel_state,
-			       const LatLonAlt &gpos_state);
+			       const SplitLatLonAlt &gpos_state);
 	/*
 	* Implement a strapdown INS algorithm using the latest IMU data at the current time horizon.
 	* Buffer the INS states and calculate the difference with the EKF states at the delayed fusion time horizon.
@@ -68,7 +69,7 @@ public:
 				   const matrix::Vector3f &delta_velocity, const float delta_velocity_dt);
 
 	void correctOutputStates(const uint64_t time_delayed_us,
-				 const matrix::Quatf &quat_state, const matrix::Vector3f &vel_state, const LatLonAlt &gpos_state,
+				 const matrix::Quatf &quat_state, const matrix::Vector3f &vel_state, const SplitLatLonAlt &gpos_state,
 				 const matrix::Vector3f &gyro_bias, const matrix::Vector3f &accel_bias);
 
 	void resetQuaternion(const matrix::Quatf &quat_change);
@@ -77,6 +78,7 @@ public:
 	void resetVerticalVelocityTo(float delta_vert_vel);
 
 	void resetLatLonTo(const double &new_latitude, const double &new_longitude);
+	void resetLatLonTo(const SplitLatLonAlt &new_gpos);
 	void resetAltitudeTo(float new_altitude, float vert_pos_change);
 
 	void print_status();
@@ -116,7 +118,7 @@ public:
 		// rotate the position of the IMU relative to the boy origin into earth frame
 		const matrix::Vector3f pos_offset_earth{_R_to_earth_now * _imu_pos_body};
 		// subtract from the EKF position (which is at the IMU) to get position at the body origin
-		return _global_ref + (_output_new.pos - pos_offset_earth);
+		return (_global_ref + (_output_new.pos - pos_offset_earth)).toLatLonAlt();
 	}
 
 	// return an array containing the output predictor angular, velocity and position tracking
@@ -129,6 +131,27 @@ public:
 
 private:
 
+
+	// return the square of two floating point numbers - used in auto coded sections
+	static constexpr float sq(float var) { return var * var; }
+
+	// in the output buffer, vel and pos exclude _output_vel_offset and _output_pos_offset
+	struct outputSample {
+		uint64_t         time_us{0};                       ///< timestamp of the measurement (uSec)
+		matrix::Quatf    quat_nominal{1.f, 0.f, 0.f, 0.f}; ///< nominal quaternion describing vehicle attitude
+		matrix::Vector3f vel{0.f, 0.f, 0.f};               ///< NED velocity estimate in earth frame (m/sec)
+		matrix::Vector3f pos{0.f, 0.f, 0.f};               ///< NED position estimate in earth frame (m/sec)
+	};
+
+	// in the output vert buffer, vert_vel excludes _output_vert_vel_offset
+	struct outputVert {
+		uint64_t time_us{0};               ///< timestamp of the measurement (uSec)
+		float    vert_vel{0.f};            ///< Vertical velocity calculated using alternative algorithm (m/sec)
+		float    vert_vel_integ{0.f};      ///< Integral of vertical velocity (m)
+		float    vert_vel_integ_incr{0.f}; ///< Trapezoidal integral of vert_vel since the previous entry (m)
+		float    dt{0.f};                  ///< delta time (sec)
+	};
+
 	/*
 	* Calculate a correction to be applied to vert_vel that casues vert_vel_integ to track the EKF
 	* down position state at the fusion time horizon using an alternative algorithm to what
@@ -136,6 +159,7 @@ private:
 	* state history and propagates vert_vel_integ forward in time using the corrected vert_vel history.
 	* This provides an alternative vertical velocity output that is closer to the first derivative
 	* of the position but does degrade tracking relative to the EKF state.
+	* Only vert_vel_integ of the entries read later on (the next oldest and the newest) are computed.
 	*/
 	void applyCorrectionToVerticalOutputBuffer(float vert_vel_correction, const float pos_ref_change);
 
@@ -143,31 +167,39 @@ private:
 	* Calculate corrections to be applied to vel and pos output state history.
 	* The vel and pos state history are corrected individually so they track the EKF states at
 	* the fusion time horizon. This option provides the most accurate tracking of EKF states.
+	* The corrections are the same for all the entries and are accumulated in offsets instead.
 	*/
 	void applyCorrectionToOutputBuffer(const matrix::Vector3f &vel_correction, const matrix::Vector3f &pos_correction);
 
-	// return the square of two floating point numbers - used in auto coded sections
-	static constexpr float sq(float var) { return var * var; }
+	// store the output states at the current time horizon in the output buffers
+	void pushOutputStates();
 
-	struct outputSample {
-		uint64_t         time_us{0};                       ///< timestamp of the measurement (uSec)
-		matrix::Quatf    quat_nominal{1.f, 0.f, 0.f, 0.f}; ///< nominal quaternion describing vehicle attitude
-		matrix::Vector3f vel{0.f, 0.f, 0.f};               ///< NED velocity estimate in earth frame (m/sec)
-		matrix::Vector3f pos{0.f, 0.f, 0.f};               ///< NED position estimate in earth frame (m/sec)
-	};
+	// write the accumulated offsets back into the output buffers to keep them small
+	void applyOffsetsToOutputBuffers();
 
-	struct outputVert {
-		uint64_t time_us{0};          ///< timestamp of the measurement (uSec)
-		float    vert_vel{0.f};       ///< Vertical velocity calculated using alternative algorithm (m/sec)
-		float    vert_vel_integ{0.f}; ///< Integral of vertical velocity (m)
-		float    dt{0.f};             ///< delta time (sec)
-	};
+	// output sample including the accumulated corrections
+	outputSample correctedSample(const outputSample &sample) const
+	{
+		outputSample corrected{sample};
+		corrected.vel += _output_vel_offset;
+		corrected.pos += _output_pos_offset;
+		return corrected;
+	}
 
-	LatLonAlt _global_ref{0.0, 0.0, 0.f};
+	SplitLatLonAlt _global_ref{0.0, 0.0, 0.f};
 
 	TimestampedRingBuffer<outputSample> _output_buffer{12};
 	TimestampedRingBuffer<outputVert> _output_vert_buffer{12};
 
+	// corrections applied to all the output buffer entries
+	matrix::Vector3f _output_vel_offset{};
+	matrix::Vector3f _output_pos_offset{};
+	float _output_vert_vel_offset{0.f};
+
+	// sums over the output vert buffer entries after the oldest one
+	float _vert_vel_integ_incr_sum{0.f};
+	float _vert_dt_sum{0.f};
+
 	matrix::Vector3f _accel_bias{};
 	matrix::Vector3f _gyro_bias{};
 
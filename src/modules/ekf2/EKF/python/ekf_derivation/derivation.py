@@ -420,13 +420,13 @@ def predict_mag_body(state) -> sf.V3:
     mag_body = state["quat_nominal"].inverse() * mag_field_earth + mag_bias_body
     return mag_body
 
-def compute_mag_innov_innov_var_and_hx(
+def compute_mag_innov_innov_var_and_h(
         state: VState,
         P: MTangent,
         meas: sf.V3,
         R: sf.Scalar,
         epsilon: sf.Scalar
-) -> (sf.V3, sf.V3, VTangent):
+) -> (sf.V3, sf.V3, VTangent, VTangent, VTangent):
 
     state = vstate_to_state(state)
     meas_pred = predict_mag_body(state);
@@ -441,37 +441,7 @@ def compute_mag_innov_innov_var_and_hx(
     Hz = jacobian_chain_rule(meas_pred[2], state)
     innov_var[2] = (Hz * P * Hz.T + R)[0,0]
 
-    return (innov, innov_var, Hx.T)
-
-def compute_mag_y_innov_var_and_h(
-        state: VState,
-        P: MTangent,
-        R: sf.Scalar,
-        epsilon: sf.Scalar
-) -> (sf.Scalar, VTangent):
-
-    state = vstate_to_state(state)
-    meas_pred = predict_mag_body(state);
-
-    H = jacobian_chain_rule(meas_pred[1], state)
-    innov_var = (H * P * H.T + R)[0,0]
-
-    return (innov_var, H.T)
-
-def compute_mag_z_innov_var_and_h(
-        state: VState,
-        P: MTangent,
-        R: sf.Scalar,
-        epsilon: sf.Scalar
-) -> (sf.Scalar, VTangent):
-
-    state = vstate_to_state(state)
-    meas_pred = predict_mag_body(state);
-
-    H = jacobian_chain_rule(meas_pred[2], state)
-    innov_var = (H * P * H.T + R)[0,0]
-
-    return (innov_var, H.T)
+    return (innov, innov_var, Hx.T, Hy.T, Hz.T)
 
 def compute_yaw_innov_var_and_h(
         state: VState,
@@ -670,11 +640,11 @@ def predict_gravity_direction(state: State):
     #  and predicted (body frame), assuming no body acceleration
     return R_to_body * sf.Matrix([0,0,-1])
 
-def compute_gravity_xyz_innov_var_and_hx(
+def compute_gravity_xyz_innov_var_and_h(
         state: VState,
         P: MTangent,
         R: sf.Scalar
-) -> (sf.V3, VTangent):
+) -> (sf.V3, VTangent, VTangent, VTangent):
 
     state = vstate_to_state(state)
     meas_pred = predict_gravity_direction(state)
@@ -689,46 +659,14 @@ def compute_gravity_xyz_innov_var_and_hx(
         H[i] = jacobian_chain_rule(meas_pred[i], state)
         innov_var[i] = (H[i] * P * H[i].T + R)[0,0]
 
-    return (innov_var, H[0].T)
-
-def compute_gravity_y_innov_var_and_h(
-        state: VState,
-        P: MTangent,
-        R: sf.Scalar
-) -> (sf.V3, VTangent, VTangent, VTangent):
-
-    state = vstate_to_state(state)
-    meas_pred = predict_gravity_direction(state)
-
-    # calculate observation jacobian (H), kalman gain (K), and innovation variance (S)
-    H = jacobian_chain_rule(meas_pred[1], state)
-    innov_var = (H * P * H.T + R)[0,0]
-
-    return (innov_var, H.T)
-
-def compute_gravity_z_innov_var_and_h(
-        state: VState,
-        P: MTangent,
-        R: sf.Scalar
-) -> (sf.V3, VTangent, VTangent, VTangent):
-
-    state = vstate_to_state(state)
-    meas_pred = predict_gravity_direction(state)
-
-    # calculate observation jacobian (H), kalman gain (K), and innovation variance (S)
-    H = jacobian_chain_rule(meas_pred[2], state)
-    innov_var = (H * P * H.T + R)[0,0]
-
-    return (innov_var, H.T)
+    return (innov_var, H[0].T, H[1].T, H[2].T)
 
 print("Derive EKF2 equations...")
 generate_px4_function(predict_covariance, output_names=None)
 
 if not args.disable_mag:
     generate_px4_function(compute_mag_declination_pred_innov_var_and_h, output_names=["pred", "innov_var", "H"])
-    generate_px4_function(compute_mag_innov_innov_var_and_hx, output_names=["innov", "innov_var", "Hx"])
-    generate_px4_function(compute_mag_y_innov_var_and_h, output_names=["innov_var", "H"])
-    generate_px4_function(compute_mag_z_innov_var_and_h, output_names=["innov_var", "H"])
+    generate_px4_function(compute_mag_innov_innov_var_and_h, output_names=["innov", "innov_var", "Hx", "Hy", "Hz"])
 
 if not args.disable_wind:
     generate_px4_function(compute_airspeed_h, output_names=None)
@@ -746,9 +684,7 @@ generate_px4_function(compute_flow_y_innov_var_and_h, output_names=["innov_var",
 generate_px4_function(compute_hagl_innov_var, output_names=["innov_var"])
 generate_px4_function(compute_hagl_h, output_names=["H"])
 generate_px4_function(compute_gnss_yaw_pred_innov_var_and_h, output_names=["meas_pred", "innov_var", "H"])
-generate_px4_function(compute_gravity_xyz_innov_var_and_hx, output_names=["innov_var", "Hx"])
-generate_px4_function(compute_gravity_y_innov_var_and_h, output_names=["innov_var", "Hy"])
-generate_px4_function(compute_gravity_z_innov_var_and_h, output_names=["innov_var", "Hz"])
+generate_px4_function(compute_gravity_xyz_innov_var_and_h, output_names=["innov_var", "Hx", "Hy", "Hz"])
 generate_px4_function(compute_body_vel_innov_var_h, output_names=["innov_var", "Hx", "Hy", "Hz"])
 generate_px4_function(compute_body_vel_y_innov_var, output_names=["innov_var"])
 generate_px4_function(compute_body_vel_z_innov_var, output_names=["innov_var"])
@@ -13,7 +13,7 @@ namespace sym {
 /**
  * This function was autogenerated from a symbolic function. Do not modify by hand.
  *
- * Symbolic function: compute_gravity_xyz_innov_var_and_hx
+ * Symbolic function: compute_gravity_xyz_innov_var_and_h
  *
  * Args:
  *     state: Matrix25_1
@@ -23,12 +23,16 @@ namespace sym {
  * Outputs:
  *     innov_var: Matrix31
  *     Hx: Matrix24_1
+ *     Hy: Matrix24_1
+ *     Hz: Matrix24_1
  */
 template <typename Scalar>
-void ComputeGravityXyzInnovVarAndHx(const matrix::Matrix<Scalar, 25, 1>& state,
-                                    const matrix::Matrix<Scalar, 24, 24>& P, const Scalar R,
-                                    matrix::Matrix<Scalar, 3, 1>* const innov_var = nullptr,
-                                    matrix::Matrix<Scalar, 24, 1>* const Hx = nullptr) {
+void ComputeGravityXyzInnovVarAndH(const matrix::Matrix<Scalar, 25, 1>& state,
+                                   const matrix::Matrix<Scalar, 24, 24>& P, const Scalar R,
+                                   matrix::Matrix<Scalar, 3, 1>* const innov_var = nullptr,
+                                   matrix::Matrix<Scalar, 24, 1>* const Hx = nullptr,
+                                   matrix::Matrix<Scalar, 24, 1>* const Hy = nullptr,
+                                   matrix::Matrix<Scalar, 24, 1>* const Hz = nullptr) {
   // Total ops: 53
 
   // Input arrays
@@ -48,7 +52,7 @@ void ComputeGravityXyzInnovVarAndHx(const matrix::Matrix<Scalar, 25, 1>& state,
   const Scalar _tmp11 = _tmp0 * state(1, 0) - _tmp2 * state(3, 0);
   const Scalar _tmp12 = _tmp2 * state(0, 0) + 2 * state(1, 0) * state(3, 0);
 
-  // Output terms (2)
+  // Output terms (4)
   if (innov_var != nullptr) {
     matrix::Matrix<Scalar, 3, 1>& _innov_var = (*innov_var);
 
@@ -68,6 +72,24 @@ void ComputeGravityXyzInnovVarAndHx(const matrix::Matrix<Scalar, 25, 1>& state,
     _hx(0, 0) = _tmp4;
     _hx(1, 0) = _tmp8;
   }
+
+  if (Hy != nullptr) {
+    matrix::Matrix<Scalar, 24, 1>& _hy = (*Hy);
+
+    _hy.setZero();
+
+    _hy(0, 0) = _tmp10;
+    _hy(1, 0) = _tmp9;
+  }
+
+  if (Hz != nullptr) {
+    matrix::Matrix<Scalar, 24, 1>& _hz = (*Hz);
+
+    _hz.setZero();
+
+    _hz(0, 0) = _tmp11;
+    _hz(1, 0) = _tmp12;
+  }
 }  // NOLINT(readability/fn_size)
 
 // NOLINTNEXTLINE(readability/fn_size)
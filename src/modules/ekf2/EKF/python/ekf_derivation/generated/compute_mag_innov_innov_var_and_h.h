@@ -13,7 +13,7 @@ namespace sym {
 /**
  * This function was autogenerated from a symbolic function. Do not modify by hand.
  *
- * Symbolic function: compute_mag_innov_innov_var_and_hx
+ * Symbolic function: compute_mag_innov_innov_var_and_h
  *
  * Args:
  *     state: Matrix25_1
@@ -26,15 +26,19 @@ namespace sym {
  *     innov: Matrix31
  *     innov_var: Matrix31
  *     Hx: Matrix24_1
+ *     Hy: Matrix24_1
+ *     Hz: Matrix24_1
  */
 template <typename Scalar>
-void ComputeMagInnovInnovVarAndHx(const matrix::Matrix<Scalar, 25, 1>& state,
-                                  const matrix::Matrix<Scalar, 24, 24>& P,
-                                  const matrix::Matrix<Scalar, 3, 1>& meas, const Scalar R,
-                                  const Scalar epsilon,
-                                  matrix::Matrix<Scalar, 3, 1>* const innov = nullptr,
-                                  matrix::Matrix<Scalar, 3, 1>* const innov_var = nullptr,
-                                  matrix::Matrix<Scalar, 24, 1>* const Hx = nullptr) {
+void ComputeMagInnovInnovVarAndH(const matrix::Matrix<Scalar, 25, 1>& state,
+                                 const matrix::Matrix<Scalar, 24, 24>& P,
+                                 const matrix::Matrix<Scalar, 3, 1>& meas, const Scalar R,
+                                 const Scalar epsilon,
+                                 matrix::Matrix<Scalar, 3, 1>* const innov = nullptr,
+                                 matrix::Matrix<Scalar, 3, 1>* const innov_var = nullptr,
+                                 matrix::Matrix<Scalar, 24, 1>* const Hx = nullptr,
+                                 matrix::Matrix<Scalar, 24, 1>* const Hy = nullptr,
+                                 matrix::Matrix<Scalar, 24, 1>* const Hz = nullptr) {
   // Total ops: 461
 
   // Unused inputs
@@ -122,7 +126,7 @@ void ComputeMagInnovInnovVarAndHx(const matrix::Matrix<Scalar, 25, 1>& state,
   const Scalar _tmp67 =
       -_tmp24 * _tmp58 - _tmp61 * state(1, 0) + _tmp63 * state(3, 0) + _tmp65 * state(0, 0);
 
-  // Output terms (3)
+  // Output terms (5)
   if (innov != nullptr) {
     matrix::Matrix<Scalar, 3, 1>& _innov = (*innov);
 
@@ -197,6 +201,34 @@ void ComputeMagInnovInnovVarAndHx(const matrix::Matrix<Scalar, 25, 1>& state,
     _hx(17, 0) = _tmp11;
     _hx(18, 0) = 1;
   }
+
+  if (Hy != nullptr) {
+    matrix::Matrix<Scalar, 24, 1>& _hy = (*Hy);
+
+    _hy.setZero();
+
+    _hy(0, 0) = _tmp55;
+    _hy(1, 0) = _tmp57;
+    _hy(2, 0) = _tmp56;
+    _hy(15, 0) = _tmp17;
+    _hy(16, 0) = _tmp13;
+    _hy(17, 0) = _tmp16;
+    _hy(19, 0) = 1;
+  }
+
+  if (Hz != nullptr) {
+    matrix::Matrix<Scalar, 24, 1>& _hz = (*Hz);
+
+    _hz.setZero();
+
+    _hz(0, 0) = _tmp66;
+    _hz(1, 0) = _tmp67;
+    _hz(2, 0) = _tmp64;
+    _hz(15, 0) = _tmp20;
+    _hz(16, 0) = _tmp19;
+    _hz(17, 0) = _tmp18;
+    _hz(20, 0) = 1;
+  }
 }  // NOLINT(readability/fn_size)
 
 // NOLINTNEXTLINE(readability/fn_size)
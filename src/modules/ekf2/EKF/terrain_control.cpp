@@ -49,6 +49,16 @@ void Ekf::initTerrain()
 	P.uncorrelateCovarianceSetVariance<State::terrain.dof>(State::terrain.idx, sq(_params.ekf2_min_rng));
 }
 
+void Ekf::decoupleTerrain()
+{
+	if (isTerrainDecoupled()) {
+		// keep the terrain variance only, the covariance prediction then skips the terrain
+		// column entirely (see predictCovarianceSparse) and the terrain behaves as an
+		// independent 1-state filter driven by the range finder and optical flow
+		P.uncorrelateCovariance<State::terrain.dof>(State::terrain.idx);
+	}
+}
+
 void Ekf::controlTerrainFakeFusion()
 {
 	// If we are on ground, store the local position and time to use as a reference
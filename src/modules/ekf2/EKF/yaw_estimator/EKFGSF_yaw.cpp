@@ -99,8 +99,24 @@ void EKFGSF_yaw::predict(const matrix::Vector3f &delta_ang, const float delta_an
 		}
 	}
 
+	PredictionStep step;
+	step.delta_ang = delta_ang;
+	step.delta_ang_dt = delta_ang_dt;
+	step.delta_vel = delta_vel;
+	step.delta_vel_dt = delta_vel_dt;
+	step.ang_rate = delta_ang / fmaxf(delta_ang_dt, 0.001f);
+	step.ahrs_accel_norm = _ahrs_accel.norm();
+	step.ahrs_accel_fusion_gain = ahrsCalcAccelGain(step.ahrs_accel_norm);
+
+	// delta velocity process noise double if we're not in air
+	const float accel_noise = in_air ? _accel_noise : 2.f * _accel_noise;
+	step.d_vel_var = sq(accel_noise * delta_vel_dt);
+
+	// Use fixed values for delta angle process noise variances
+	step.d_ang_var = sq(_gyro_noise * delta_ang_dt);
+
 	for (uint8_t model_index = 0; model_index < N_MODELS_EKFGSF; model_index ++) {
-		predictEKF(model_index, delta_ang, delta_ang_dt, delta_vel, delta_vel_dt, in_air);
+		predictEKF(model_index, step);
 	}
 }
 
@@ -174,23 +190,18 @@ void EKFGSF_yaw::fuseVelocity(const Vector2f &vel_NE, const float vel_accuracy,
 	}
 }
 
-void EKFGSF_yaw::ahrsPredict(const uint8_t model_index, const Vector3f &delta_ang, const float delta_ang_dt)
+void EKFGSF_yaw::ahrsPredict(const uint8_t model_index, const PredictionStep &step)
 {
 	// generate attitude solution using simple complementary filter for the selected model
-	const Vector3f ang_rate = delta_ang / fmaxf(delta_ang_dt, 0.001f) - _ahrs_ekf_gsf[model_index].gyro_bias;
+	const Vector3f ang_rate = step.ang_rate - _ahrs_ekf_gsf[model_index].gyro_bias;
 
 	const Vector3f gravity_direction_bf = _ahrs_ekf_gsf[model_index].q.inversed().dcm_z();
 
-	const float ahrs_accel_norm = _ahrs_accel.norm();
-
-	// gain from accel vector tilt error to rate gyro correction used by AHRS calculation
-	const float ahrs_accel_fusion_gain = ahrsCalcAccelGain();
-
 	// Perform angular rate correction using accel data and reduce correction as accel magnitude moves away from 1 g (reduces drift when vehicle picked up and moved).
 	// During fixed wing flight, compensate for centripetal acceleration assuming coordinated turns and X axis forward
 	Vector3f tilt_correction{};
 
-	if (ahrs_accel_fusion_gain > 0.f) {
+	if (step.ahrs_accel_fusion_gain > 0.f) {
 
 		Vector3f accel = _ahrs_accel;
 
@@ -203,7 +214,7 @@ void EKFGSF_yaw::ahrsPredict(const uint8_t model_index, const Vector3f &delta_an
 			accel -= centripetal_accel_bf;
 		}
 
-		tilt_correction = (gravity_direction_bf % accel) * ahrs_accel_fusion_gain / ahrs_accel_norm;
+		tilt_correction = (gravity_direction_bf % accel) * step.ahrs_accel_fusion_gain / step.ahrs_accel_norm;
 	}
 
 	// Gyro bias estimation
@@ -211,14 +222,14 @@ void EKFGSF_yaw::ahrsPredict(const uint8_t model_index, const Vector3f &delta_an
 	const float spin_rate = ang_rate.length();
 
 	if (spin_rate < math::radians(10.f)) {
-		_ahrs_ekf_gsf[model_index].gyro_bias -= tilt_correction * (_gyro_bias_gain * delta_ang_dt);
+		_ahrs_ekf_gsf[model_index].gyro_bias -= tilt_correction * (_gyro_bias_gain * step.delta_ang_dt);
 		_ahrs_ekf_gsf[model_index].gyro_bias = matrix::constrain(_ahrs_ekf_gsf[model_index].gyro_bias,
 						       -ekf2_gyr_b_limit, ekf2_gyr_b_limit);
 	}
 
 	// delta angle from previous to current frame
-	const Vector3f delta_angle_corrected = delta_ang
-					       + (tilt_correction - _ahrs_ekf_gsf[model_index].gyro_bias) * delta_ang_dt;
+	const Vector3f delta_angle_corrected = step.delta_ang
+					       + (tilt_correction - _ahrs_ekf_gsf[model_index].gyro_bias) * step.delta_ang_dt;
 
 	// Apply delta angle to attitude
 	const Quatf dq(AxisAnglef{delta_angle_corrected});
@@ -250,11 +261,10 @@ void EKFGSF_yaw::ahrsAlignYaw()
 	}
 }
 
-void EKFGSF_yaw::predictEKF(const uint8_t model_index, const Vector3f &delta_ang, const float delta_ang_dt,
-			    const Vector3f &delta_vel, const float delta_vel_dt, bool in_air)
+void EKFGSF_yaw::predictEKF(const uint8_t model_index, const PredictionStep &step)
 {
 	// generate an attitude reference using IMU data
-	ahrsPredict(model_index, delta_ang, delta_ang_dt);
+	ahrsPredict(model_index, step);
 
 	// we don't start running the EKF part of the algorithm until there are regular velocity observations
 	if (!_ekf_gsf_vel_fuse_started) {
@@ -267,22 +277,16 @@ void EKFGSF_yaw::predictEKF(const uint8_t model_index, const Vector3f &delta_ang
 	_ekf_gsf[model_index].X(2) = getEulerYaw(R);
 
 	// calculate delta velocity in a horizontal front-right frame
-	const Vector3f del_vel_NED = R * delta_vel;
+	const Vector3f del_vel_NED = R * step.delta_vel;
 	const float cos_yaw = cosf(_ekf_gsf[model_index].X(2));
 	const float sin_yaw = sinf(_ekf_gsf[model_index].X(2));
 	const float dvx =   del_vel_NED(0) * cos_yaw + del_vel_NED(1) * sin_yaw;
 	const float dvy = - del_vel_NED(0) * sin_yaw + del_vel_NED(1) * cos_yaw;
-	const float daz = Vector3f(R * delta_ang)(2);
-
-	// delta velocity process noise double if we're not in air
-	const float accel_noise = in_air ? _accel_noise : 2.f * _accel_noise;
-	const float d_vel_var = sq(accel_noise * delta_vel_dt);
-
-	// Use fixed values for delta angle process noise variances
-	const float d_ang_var = sq(_gyro_noise * delta_ang_dt);
+	// only the down component of the earth frame delta angle is needed
+	const float daz = R(2, 0) * step.delta_ang(0) + R(2, 1) * step.delta_ang(1) + R(2, 2) * step.delta_ang(2);
 
 	_ekf_gsf[model_index].P = sym::YawEstPredictCovariance(_ekf_gsf[model_index].X, _ekf_gsf[model_index].P, Vector2f(dvx,
-				  dvy), d_vel_var, daz, d_ang_var);
+				  dvy), step.d_vel_var, daz, step.d_ang_var);
 
 	// covariance matrix is symmetrical, so copy upper half to lower half
 	_ekf_gsf[model_index].P(1, 0) = _ekf_gsf[model_index].P(0, 1);
@@ -413,7 +417,7 @@ bool EKFGSF_yaw::getLogData(float *yaw_composite, float *yaw_variance, float yaw
 	return false;
 }
 
-float EKFGSF_yaw::ahrsCalcAccelGain() const
+float EKFGSF_yaw::ahrsCalcAccelGain(const float ahrs_accel_norm) const
 {
 	// Calculate the acceleration fusion gain using a continuous function that is unity at 1g and zero
 	// at the min and max g value. Allow for more acceleration when flying as a fixed wing vehicle using centripetal
@@ -424,8 +428,6 @@ float EKFGSF_yaw::ahrsCalcAccelGain() const
 	float attenuation = 2.f;
 	const bool centripetal_accel_compensation_enabled = PX4_ISFINITE(_true_airspeed) && (_true_airspeed > FLT_EPSILON);
 
-	const float ahrs_accel_norm = _ahrs_accel.norm();
-
 	if (centripetal_accel_compensation_enabled && (ahrs_accel_norm > CONSTANTS_ONE_G)) {
 		attenuation = 1.f;
 	}
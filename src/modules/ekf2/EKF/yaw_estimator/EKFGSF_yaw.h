@@ -101,11 +101,24 @@ private:
 	bool _ahrs_ekf_gsf_tilt_aligned{false};  // true the initial tilt alignment has been calculated
 	matrix::Vector3f _ahrs_accel{0.f, 0.f, 0.f};     // low pass filtered body frame specific force vector used by AHRS calculation (m/s/s)
 
+	// IMU derived quantities common to all the models, computed once per prediction step
+	struct PredictionStep {
+		matrix::Vector3f delta_ang{};   // delta angle (rad)
+		float delta_ang_dt{};           // delta angle integration period (s)
+		matrix::Vector3f delta_vel{};   // delta velocity (m/s)
+		float delta_vel_dt{};           // delta velocity integration period (s)
+		matrix::Vector3f ang_rate{};    // angular rate, not corrected for the gyro bias (rad/s)
+		float ahrs_accel_norm{};        // length of the filtered specific force vector (m/s/s)
+		float ahrs_accel_fusion_gain{}; // gain from gravity vector misalignment to tilt correction
+		float d_vel_var{};              // delta velocity process noise variance ((m/s)**2)
+		float d_ang_var{};              // delta angle process noise variance (rad**2)
+	};
+
 	// calculate the gain from gravity vector misalingment to tilt correction to be used by all AHRS filters
-	float ahrsCalcAccelGain() const;
+	float ahrsCalcAccelGain(const float ahrs_accel_norm) const;
 
 	// update specified AHRS rotation matrix using IMU and optionally true airspeed data
-	void ahrsPredict(const uint8_t model_index, const matrix::Vector3f &delta_ang, const float delta_ang_dt);
+	void ahrsPredict(const uint8_t model_index, const PredictionStep &step);
 
 	// align all AHRS roll and pitch orientations using IMU delta velocity vector
 	void ahrsAlignTilt(const matrix::Vector3f &delta_vel);
@@ -129,8 +142,7 @@ private:
 	void initialiseEKFGSF(const matrix::Vector2f &vel_NE, const float vel_accuracy);
 
 	// predict state and covariance for the specified EKF using inertial data
-	void predictEKF(const uint8_t model_index, const matrix::Vector3f &delta_ang, const float delta_ang_dt,
-			const matrix::Vector3f &delta_vel, const float delta_vel_dt, bool in_air = false);
+	void predictEKF(const uint8_t model_index, const PredictionStep &step);
 
 	// update state and covariance for the specified EKF using a NE velocity measurement
 	// return false if update failed
@@ -98,7 +98,10 @@ bool Ekf::fuseYaw(estimator_aid_source1d_s &aid_src_status, const VectorState &H
 		}
 	}
 
-	measurementUpdate(Kfusion, H_YAW, aid_src_status.observation_variance, aid_src_status.innovation);
+	// the yaw only depends on the attitude
+	const matrix::SparseVectorf<State::size, State::quat_nominal.idx, State::quat_nominal.idx + 1,
+	      State::quat_nominal.idx + 2> H_att(H_YAW);
+	measurementUpdate(Kfusion, H_att, aid_src_status.observation_variance, aid_src_status.innovation);
 
 	_time_last_heading_fuse = _time_delayed_us;
 
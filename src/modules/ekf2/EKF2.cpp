@@ -151,6 +151,7 @@ EKF2::EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode):
 #if defined(CONFIG_EKF2_TERRAIN)
 	_param_ekf2_terr_noise(_params->ekf2_terr_noise),
 	_param_ekf2_terr_grad(_params->ekf2_terr_grad),
+	_param_ekf2_terr_dcpl(_params->ekf2_terr_dcpl),
 #endif // CONFIG_EKF2_TERRAIN
 #if defined(CONFIG_EKF2_RANGE_FINDER)
 	_param_ekf2_rng_ctrl(_params->ekf2_rng_ctrl),
@@ -216,6 +217,10 @@ EKF2::EKF2(bool multi_mode, const px4::wq_config_t &config, bool replay_mode):
 	_param_ekf2_abl_tau(_params->ekf2_abl_tau),
 	_param_ekf2_gyr_b_lim(_params->ekf2_gyr_b_lim)
 {
+#if defined(CONFIG_EKF2_TIMING)
+	_ekf.timing().setTimeSource(hrt_absolute_time);
+#endif // CONFIG_EKF2_TIMING
+
 	AdvertiseTopics();
 }
 
@@ -449,13 +454,20 @@ void EKF2::Run()
 		// update parameters from storage
 		updateParams();
 
+		// keep the adapted filter update period within [EKF2_PREDICT_US, EKF2_PREDICT_MAX]
+		_predict_us_nominal = _param_ekf2_predict_us.get();
+		_predict_us = math::constrain(_predict_us, _predict_us_nominal,
+					      math::max(_param_ekf2_predict_max.get(), _predict_us_nominal));
+		_params->ekf2_predict_us = _predict_us;
+
 		VerifyParams();
 
 		// force advertise topics immediately for logging (EKF2_LOG_VERBOSE, per aid source control)
 		AdvertiseTopics();
 
 #if defined(CONFIG_EKF2_GNSS)
-		_ekf.set_min_required_gps_health_time(_param_ekf2_req_gps_h.get() * 1_s);
+		// the ground truth alignment replaces the startup dwell time
+		_ekf.set_min_required_gps_health_time(_groundtruth_init_done ? 0 : _param_ekf2_req_gps_h.get() * 1_s);
 #endif // CONFIG_EKF2_GNSS
 
 		const matrix::Vector3f imu_pos_body(_param_ekf2_imu_pos_x.get(),
@@ -614,6 +626,7 @@ void EKF2::Run()
 
 		if (imu_updated && (_vehicle_imu_sub.get_last_generation() != last_generation + 1)) {
 			perf_count(_msg_missed_imu_perf);
+			_predict_window_imu_missed++;
 		}
 
 		if (imu_updated) {
@@ -675,6 +688,7 @@ void EKF2::Run()
 
 		if (imu_updated && (_sensor_combined_sub.get_last_generation() != last_generation + 1)) {
 			perf_count(_msg_missed_imu_perf);
+			_predict_window_imu_missed++;
 		}
 
 		if (imu_updated) {
@@ -744,6 +758,7 @@ void EKF2::Run()
 
 	if (imu_updated) {
 		const hrt_abstime now = imu_sample_new.time_us;
+		const hrt_abstime imu_processing_start = hrt_absolute_time();
 
 		// push imu data into estimator
 		_ekf.setIMUData(imu_sample_new);
@@ -802,6 +817,10 @@ void EKF2::Run()
 		if (_ekf.update()) {
 			perf_set_elapsed(_ekf_update_perf, hrt_elapsed_time(&ekf_update_start));
 
+			if (_param_ekf2_gt_init.get() && !_groundtruth_init_done) {
+				UpdateGroundTruthInit();
+			}
+
 			PublishLocalPosition(now);
 			PublishOdometry(now, imu_sample_new);
 			PublishGlobalPosition(now);
@@ -816,6 +835,10 @@ void EKF2::Run()
 			PublishStatus(now);
 			PublishStatusFlags(now);
 
+#if defined(CONFIG_EKF2_TIMING)
+			PublishTiming(now);
+#endif // CONFIG_EKF2_TIMING
+
 			if (_param_ekf2_log_verbose.get()) {
 				PublishAidSourceStatus(now);
 				PublishInnovations(now);
@@ -858,12 +881,107 @@ void EKF2::Run()
 
 		// publish ekf2_timestamps
 		_ekf2_timestamps_pub.publish(ekf2_timestamps);
+
+		UpdatePredictionPeriod(now, imu_sample_new, hrt_elapsed_time(&imu_processing_start));
 	}
 
 	// re-schedule as backup timeout
 	ScheduleDelayed(100_ms);
 }
 
+void EKF2::UpdateGroundTruthInit()
+{
+	vehicle_attitude_s attitude_groundtruth;
+	vehicle_global_position_s global_position_groundtruth;
+
+	// the vehicle is expected to be at rest, so the time offset of the ground truth doesn't matter
+	if (_vehicle_attitude_groundtruth_sub.copy(&attitude_groundtruth)
+	    && _vehicle_global_position_groundtruth_sub.copy(&global_position_groundtruth)
+	    && (hrt_elapsed_time(&attitude_groundtruth.timestamp) < 1_s)
+	    && (hrt_elapsed_time(&global_position_groundtruth.timestamp) < 1_s)) {
+
+		_ekf.resetAttitudeToExternalObservation(Quatf(attitude_groundtruth.q), math::radians(1.f));
+
+		if (!_ekf.resetGlobalPosToExternalObservation(global_position_groundtruth.lat, global_position_groundtruth.lon,
+				global_position_groundtruth.alt, 0.1f, 0.1f, global_position_groundtruth.timestamp)) {
+			PX4_WARN("%d - ground truth position rejected", _instance);
+		}
+
+#if defined(CONFIG_EKF2_GNSS)
+		_ekf.set_min_required_gps_health_time(0);
+#endif // CONFIG_EKF2_GNSS
+
+		PX4_INFO("%d - initialized to ground truth", _instance);
+		_groundtruth_init_done = true;
+	}
+}
+
+void EKF2::UpdatePredictionPeriod(const hrt_abstime &timestamp, const imuSample &imu_sample, uint32_t run_time_us)
+{
+	const int32_t predict_us_min = _predict_us_nominal;
+	const int32_t predict_us_max = _param_ekf2_predict_max.get();
+
+	if (predict_us_max <= predict_us_min) {
+		// adaptation disabled
+		return;
+	}
+
+	_predict_window_run_us += run_time_us;
+
+	if (imu_sample.delta_ang_dt > FLT_EPSILON) {
+		_predict_window_rate_max = math::max(_predict_window_rate_max,
+						     imu_sample.delta_ang.norm() / imu_sample.delta_ang_dt);
+	}
+
+	if (_predict_window_start == 0) {
+		_predict_window_start = timestamp;
+		_predict_last_change = timestamp;
+	}
+
+	if (timestamp < _predict_window_start + 1_s) {
+		return;
+	}
+
+	static constexpr float kLoadHigh = 0.5f; // fraction of the time spent processing IMU data
+	static constexpr float kLoadLow = 0.25f;
+	static constexpr float kRateHigh = math::radians(90.f);
+
+	const float load = (float)_predict_window_run_us / (float)(timestamp - _predict_window_start);
+	const bool overloaded = (_predict_window_imu_missed > 0) || (load > kLoadHigh);
+	const bool headroom = (_predict_window_imu_missed == 0) && (load < kLoadLow);
+	const bool high_dynamics = _predict_window_rate_max > kRateHigh;
+
+	// steps of the IMU sample interval, as the filter update is always an integer multiple of it
+	const int32_t step_us = math::max((int32_t)roundf(imu_sample.delta_ang_dt * 1e6f), (int32_t)1000);
+
+	int32_t predict_us = _predict_us;
+
+	if (overloaded && !high_dynamics) {
+		predict_us = math::min(_predict_us + step_us, predict_us_max);
+
+	} else if ((_predict_window_imu_missed == 0) && (high_dynamics
+			|| (headroom && (timestamp > _predict_last_change + 10_s)))) {
+		predict_us = math::max(_predict_us - step_us, predict_us_min);
+	}
+
+	if (predict_us != _predict_us) {
+		PX4_INFO("%d - filter update period %" PRId32 " -> %" PRId32 " us (load %.2f, %" PRIu32 " IMU missed, %.0f deg/s)",
+			 _instance, _predict_us, predict_us, (double)load, _predict_window_imu_missed,
+			 (double)math::degrees(_predict_window_rate_max));
+
+		_predict_us = predict_us;
+		_predict_last_change = timestamp;
+
+		// the IMU down sampler and the filter follow the new period from the next prediction
+		_params->ekf2_predict_us = predict_us;
+	}
+
+	_predict_window_start = timestamp;
+	_predict_window_run_us = 0;
+	_predict_window_imu_missed = 0;
+	_predict_window_rate_max = 0.f;
+}
+
 void EKF2::VerifyParams()
 {
 #if defined(CONFIG_EKF2_MAGNETOMETER)
@@ -1993,6 +2111,36 @@ void EKF2::PublishYawEstimatorStatus(const hrt_abstime &timestamp)
 }
 #endif // CONFIG_EKF2_GNSS
 
+#if defined(CONFIG_EKF2_TIMING)
+void EKF2::PublishTiming(const hrt_abstime &timestamp)
+{
+	EstimatorTiming &timing = _ekf.timing();
+
+	if ((timing.updates() == 0) || (timestamp < _last_timing_publish + 1_s)) {
+		return;
+	}
+
+	static_assert(EstimatorTiming::SECTION_COUNT == estimator_timing_s::SECTION_COUNT, "estimator_timing size mismatch");
+
+	estimator_timing_s estimator_timing{};
+	estimator_timing.timestamp_sample = _ekf.time_delayed_us();
+	estimator_timing.updates = timing.updates();
+	estimator_timing.update_mean_us = static_cast<float>(timing.update().total_us) / timing.updates();
+	estimator_timing.update_max_us = timing.update().max_us;
+
+	for (unsigned i = 0; i < EstimatorTiming::SECTION_COUNT; i++) {
+		estimator_timing.section_mean_us[i] = static_cast<float>(timing.section(i).total_us) / timing.updates();
+		estimator_timing.section_max_us[i] = timing.section(i).max_us;
+	}
+
+	estimator_timing.timestamp = _replay_mode ? timestamp : hrt_absolute_time();
+	_estimator_timing_pub.publish(estimator_timing);
+
+	_last_timing_publish = timestamp;
+	timing.reset();
+}
+#endif // CONFIG_EKF2_TIMING
+
 #if defined(CONFIG_EKF2_WIND)
 void EKF2::PublishWindEstimate(const hrt_abstime &timestamp)
 {
@@ -2874,7 +3022,14 @@ int EKF2::task_spawn(int argc, char *argv[])
 					if ((vehicle_mag_sub.advertised() || mag == 0) && (vehicle_imu_sub.advertised())) {
 
 						if (!ekf2_instance_created[imu][mag]) {
-							EKF2 *ekf2_inst = new EKF2(true, px4::ins_instance_to_wq(imu), false);
+#if defined(CONFIG_EKF2_MULTI_INSTANCE_WQ_SPREAD)
+							// one work queue per instance so that they can run in parallel
+							const px4::wq_config_t &wq_config = px4::ins_instance_to_wq(multi_instances_allocated % MAX_NUM_IMUS);
+#else
+							// the instances of an IMU run one after the other on its work queue
+							const px4::wq_config_t &wq_config = px4::ins_instance_to_wq(imu);
+#endif // CONFIG_EKF2_MULTI_INSTANCE_WQ_SPREAD
+							EKF2 *ekf2_inst = new EKF2(true, wq_config, false);
 
 							if (ekf2_inst && ekf2_inst->multi_init(imu, mag)) {
 								int actual_instance = ekf2_inst->instance(); // match uORB instance numbering
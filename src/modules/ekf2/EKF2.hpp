@@ -123,6 +123,10 @@
 # include <uORB/topics/wind.h>
 #endif // CONFIG_EKF2_WIND
 
+#if defined(CONFIG_EKF2_TIMING)
+# include <uORB/topics/estimator_timing.h>
+#endif // CONFIG_EKF2_TIMING
+
 extern pthread_mutex_t ekf2_module_mutex;
 
 class EKF2 final : public ModuleParams, public px4::ScheduledWorkItem
@@ -194,6 +198,9 @@ private:
 	void PublishStates(const hrt_abstime &timestamp);
 	void PublishStatus(const hrt_abstime &timestamp);
 	void PublishStatusFlags(const hrt_abstime &timestamp);
+#if defined(CONFIG_EKF2_TIMING)
+	void PublishTiming(const hrt_abstime &timestamp);
+#endif // CONFIG_EKF2_TIMING
 #if defined(CONFIG_EKF2_WIND)
 	void PublishWindEstimate(const hrt_abstime &timestamp);
 #endif // CONFIG_EKF2_WIND
@@ -232,6 +239,12 @@ private:
 
 	void UpdateSystemFlagsSample(ekf2_timestamps_s &ekf2_timestamps);
 
+	// align the attitude and position to the simulation ground truth once after the filter initialisation (EKF2_GT_INIT)
+	void UpdateGroundTruthInit();
+
+	// adapt the filter update period to the CPU load and vehicle dynamics
+	void UpdatePredictionPeriod(const hrt_abstime &timestamp, const imuSample &imu_sample, uint32_t run_time_us);
+
 	// Used to check, save and use learned accel/gyro/mag biases
 	struct InFlightCalibration {
 		hrt_abstime last_us{0};         ///< last time the EKF was operating a mode that estimates accelerometer biases (uSec)
@@ -281,6 +294,15 @@ private:
 	perf_counter_t _ekf_update_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": EKF update")};
 	perf_counter_t _msg_missed_imu_perf{perf_alloc(PC_COUNT, MODULE_NAME": IMU message missed")};
 
+	// filter update period adaptation (EKF2_PREDICT_MAX)
+	int32_t _predict_us_nominal{0};         ///< EKF2_PREDICT_US (uSec)
+	int32_t _predict_us{0};                 ///< filter update period in use (uSec)
+	hrt_abstime _predict_window_start{0};   ///< start of the current load measurement window
+	hrt_abstime _predict_last_change{0};    ///< last time the filter update period was changed
+	uint64_t _predict_window_run_us{0};     ///< time spent processing IMU samples in the current window (uSec)
+	uint32_t _predict_window_imu_missed{0}; ///< number of IMU messages missed in the current window
+	float _predict_window_rate_max{0.f};    ///< maximum angular rate in the current window (rad/s)
+
 	InFlightCalibration _accel_cal{};
 	InFlightCalibration _gyro_cal{};
 
@@ -391,6 +413,10 @@ private:
 	uORB::Subscription _vehicle_land_detected_sub{ORB_ID(vehicle_land_detected)};
 	uORB::Subscription _launch_detection_status_sub{ORB_ID(launch_detection_status)};
 
+	uORB::Subscription _vehicle_attitude_groundtruth_sub{ORB_ID(vehicle_attitude_groundtruth)};
+	uORB::Subscription _vehicle_global_position_groundtruth_sub{ORB_ID(vehicle_global_position_groundtruth)};
+	bool _groundtruth_init_done{false};
+
 	uORB::Subscription _vehicle_command_sub{ORB_ID(vehicle_command)};
 	uORB::Publication<vehicle_command_ack_s> _vehicle_command_ack_pub{ORB_ID(vehicle_command_ack)};
 
@@ -442,6 +468,11 @@ private:
 	uORB::PublicationMulti<wind_s>              _wind_pub;
 #endif // CONFIG_EKF2_WIND
 
+#if defined(CONFIG_EKF2_TIMING)
+	uORB::PublicationMulti<estimator_timing_s> _estimator_timing_pub{ORB_ID(estimator_timing)};
+	hrt_abstime _last_timing_publish{0};
+#endif // CONFIG_EKF2_TIMING
+
 #if defined(CONFIG_EKF2_GNSS)
 
 	uint64_t _last_geoid_height_update_us{0};
@@ -484,10 +515,12 @@ private:
 	DEFINE_PARAMETERS(
 		(ParamBool<px4::params::EKF2_LOG_VERBOSE>) _param_ekf2_log_verbose,
 		(ParamExtInt<px4::params::EKF2_PREDICT_US>) _param_ekf2_predict_us,
+		(ParamInt<px4::params::EKF2_PREDICT_MAX>) _param_ekf2_predict_max,
 		(ParamExtFloat<px4::params::EKF2_DELAY_MAX>) _param_ekf2_delay_max,
 		(ParamExtInt<px4::params::EKF2_IMU_CTRL>) _param_ekf2_imu_ctrl,
 		(ParamExtFloat<px4::params::EKF2_VEL_LIM>) _param_ekf2_vel_lim,
 		(ParamBool<px4::params::EKF2_ENGINE_WRM>) _param_ekf2_engine_wrm,
+		(ParamBool<px4::params::EKF2_GT_INIT>) _param_ekf2_gt_init,
 
 #if defined(CONFIG_EKF2_AUXVEL)
 		(ParamExtFloat<px4::params::EKF2_AVEL_DELAY>)
@@ -609,6 +642,7 @@ private:
 #if defined(CONFIG_EKF2_TERRAIN)
 		(ParamExtFloat<px4::params::EKF2_TERR_NOISE>) _param_ekf2_terr_noise,
 		(ParamExtFloat<px4::params::EKF2_TERR_GRAD>) _param_ekf2_terr_grad,
+		(ParamExtInt<px4::params::EKF2_TERR_DCPL>) _param_ekf2_terr_dcpl,
 #endif // CONFIG_EKF2_TERRAIN
 #if defined(CONFIG_EKF2_RANGE_FINDER)
 		// range finder fusion
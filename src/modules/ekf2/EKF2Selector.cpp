@@ -364,7 +364,7 @@ bool EKF2Selector::UpdateErrorScores()
 void EKF2Selector::PublishVehicleAttitude()
 {
 	// selected estimator_attitude -> vehicle_attitude
-	vehicle_attitude_s attitude;
+	vehicle_attitude_s &attitude = _vehicle_attitude_pub.get();
 
 	if (_instance[_selected_instance].estimator_attitude_sub.update(&attitude)) {
 		bool instance_change = false;
@@ -410,7 +410,7 @@ void EKF2Selector::PublishVehicleAttitude()
 			_delta_q_reset.copyTo(attitude.delta_q_reset);
 
 			attitude.timestamp = hrt_absolute_time();
-			_vehicle_attitude_pub.publish(attitude);
+			_vehicle_attitude_pub.publish();
 		}
 	}
 }
@@ -418,7 +418,7 @@ void EKF2Selector::PublishVehicleAttitude()
 void EKF2Selector::PublishVehicleLocalPosition()
 {
 	// selected estimator_local_position -> vehicle_local_position
-	vehicle_local_position_s local_position;
+	vehicle_local_position_s &local_position = _vehicle_local_position_pub.get();
 
 	if (_instance[_selected_instance].estimator_local_position_sub.update(&local_position)) {
 		bool instance_change = false;
@@ -536,7 +536,7 @@ void EKF2Selector::PublishVehicleLocalPosition()
 			local_position.delta_heading = _delta_heading_reset;
 
 			local_position.timestamp = hrt_absolute_time();
-			_vehicle_local_position_pub.publish(local_position);
+			_vehicle_local_position_pub.publish();
 		}
 	}
 }
@@ -544,7 +544,7 @@ void EKF2Selector::PublishVehicleLocalPosition()
 void EKF2Selector::PublishVehicleOdometry()
 {
 	// selected estimator_odometry -> vehicle_odometry
-	vehicle_odometry_s odometry;
+	vehicle_odometry_s &odometry = _vehicle_odometry_pub.get();
 
 	if (_instance[_selected_instance].estimator_odometry_sub.update(&odometry)) {
 
@@ -583,7 +583,7 @@ void EKF2Selector::PublishVehicleOdometry()
 			odometry.reset_counter = _odometry_reset_counter;
 
 			odometry.timestamp = hrt_absolute_time();
-			_vehicle_odometry_pub.publish(odometry);
+			_vehicle_odometry_pub.publish();
 		}
 	}
 }
@@ -591,7 +591,7 @@ void EKF2Selector::PublishVehicleOdometry()
 void EKF2Selector::PublishVehicleGlobalPosition()
 {
 	// selected estimator_global_position -> vehicle_global_position
-	vehicle_global_position_s global_position;
+	vehicle_global_position_s &global_position = _vehicle_global_position_pub.get();
 
 	if (_instance[_selected_instance].estimator_global_position_sub.update(&global_position)) {
 		bool instance_change = false;
@@ -664,7 +664,7 @@ void EKF2Selector::PublishVehicleGlobalPosition()
 			global_position.delta_alt = _delta_alt_reset;
 
 			global_position.timestamp = hrt_absolute_time();
-			_vehicle_global_position_pub.publish(global_position);
+			_vehicle_global_position_pub.publish();
 		}
 	}
 }
@@ -672,7 +672,7 @@ void EKF2Selector::PublishVehicleGlobalPosition()
 void EKF2Selector::PublishWindEstimate()
 {
 	// selected estimator_wind -> wind
-	wind_s wind;
+	wind_s &wind = _wind_pub.get();
 
 	if (_instance[_selected_instance].estimator_wind_sub.update(&wind)) {
 		bool publish = true;
@@ -692,7 +692,7 @@ void EKF2Selector::PublishWindEstimate()
 		if (publish) {
 			// republish with current timestamp
 			wind.timestamp = hrt_absolute_time();
-			_wind_pub.publish(wind);
+			_wind_pub.publish();
 		}
 	}
 }
@@ -709,8 +709,17 @@ void EKF2Selector::Run()
 		updateParams();
 	}
 
-	// update combined test ratio for all estimators
-	const bool updated = UpdateErrorScores();
+	// update combined test ratio for all estimators, event driven by the selected instance status
+	// (the other instances are only compared against it) with a low rate backup to detect timeouts
+	bool updated = false;
+
+	if ((_selected_instance == INVALID_INSTANCE)
+	    || _instance[_selected_instance].estimator_status_sub.updated()
+	    || (hrt_elapsed_time(&_last_error_scores_update) >= INSTANCE_CHECK_PERIOD)) {
+
+		updated = UpdateErrorScores();
+		_last_error_scores_update = hrt_absolute_time();
+	}
 
 	// if no valid instance then force select first instance with valid IMU
 	if (_selected_instance == INVALID_INSTANCE) {
@@ -79,6 +79,7 @@ public:
 private:
 	static constexpr uint8_t INVALID_INSTANCE{UINT8_MAX};
 	static constexpr uint64_t FILTER_UPDATE_PERIOD{10_ms};
+	static constexpr uint64_t INSTANCE_CHECK_PERIOD{20_ms}; // backup check of all instances if the selected one doesn't update
 
 	void Run() override;
 
@@ -96,6 +97,45 @@ private:
 	// Update the error scores for all available instances
 	bool UpdateErrorScores();
 
+	/**
+	 * Output topic republishing the selected instance data without an intermediate copy: the
+	 * estimator message is read straight into a loaned slot of the output topic and committed
+	 * in place. Falls back to a regular publication if the topic can't be loaned.
+	 */
+	template<typename T>
+	class RepublishedTopic
+	{
+	public:
+		explicit RepublishedTopic(const orb_metadata *meta) : _pub(meta) {}
+
+		void advertise() { _pub.advertise(); }
+
+		// message to fill, stays valid until the next publish()
+		T &get()
+		{
+			if (_loaned == nullptr) {
+				_loaned = _pub.loan();
+			}
+
+			return (_loaned != nullptr) ? *_loaned : _buffer;
+		}
+
+		bool publish()
+		{
+			if (_loaned != nullptr) {
+				_loaned = nullptr;
+				return _pub.commit();
+			}
+
+			return _pub.publish(_buffer);
+		}
+
+	private:
+		uORB::Publication<T> _pub;
+		T *_loaned{nullptr};
+		T _buffer{};
+	};
+
 	// Subscriptions (per estimator instance)
 	struct EstimatorInstance {
 
@@ -188,6 +228,7 @@ private:
 	hrt_abstime _last_instance_change{0};
 
 	hrt_abstime _last_status_publish{0};
+	hrt_abstime _last_error_scores_update{0};
 	bool _selector_status_publish{false};
 
 	// vehicle_attitude: reset counters
@@ -240,11 +281,11 @@ private:
 	// Publications
 	uORB::Publication<estimator_selector_status_s> _estimator_selector_status_pub{ORB_ID(estimator_selector_status)};
 	uORB::Publication<sensor_selection_s>          _sensor_selection_pub{ORB_ID(sensor_selection)};
-	uORB::Publication<vehicle_attitude_s>          _vehicle_attitude_pub{ORB_ID(vehicle_attitude)};
-	uORB::Publication<vehicle_global_position_s>   _vehicle_global_position_pub{ORB_ID(vehicle_global_position)};
-	uORB::Publication<vehicle_local_position_s>    _vehicle_local_position_pub{ORB_ID(vehicle_local_position)};
-	uORB::Publication<vehicle_odometry_s>          _vehicle_odometry_pub{ORB_ID(vehicle_odometry)};
-	uORB::Publication<wind_s>             _wind_pub{ORB_ID(wind)};
+	RepublishedTopic<vehicle_attitude_s>           _vehicle_attitude_pub{ORB_ID(vehicle_attitude)};
+	RepublishedTopic<vehicle_global_position_s>    _vehicle_global_position_pub{ORB_ID(vehicle_global_position)};
+	RepublishedTopic<vehicle_local_position_s>     _vehicle_local_position_pub{ORB_ID(vehicle_local_position)};
+	RepublishedTopic<vehicle_odometry_s>           _vehicle_odometry_pub{ORB_ID(vehicle_odometry)};
+	RepublishedTopic<wind_s>                       _wind_pub{ORB_ID(wind)};
 
 	DEFINE_PARAMETERS(
 		(ParamFloat<px4::params::EKF2_SEL_ERR_RED>) _param_ekf2_sel_err_red,
@@ -270,6 +270,11 @@ bool EkfWrapper::isIntendingTerrainFlowFusion() const
 	return _ekf->control_status_flags().opt_flow_terrain;
 }
 
+void EkfWrapper::enableTerrainDecoupling()
+{
+	_ekf_params->ekf2_terr_dcpl = 1;
+}
+
 Eulerf EkfWrapper::getEulerAngles() const
 {
 	return Eulerf(_ekf->getQuaternion());
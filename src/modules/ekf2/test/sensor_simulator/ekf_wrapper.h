@@ -118,6 +118,8 @@ public:
 
 	bool isIntendingTerrainFlowFusion() const;
 
+	void enableTerrainDecoupling();
+
 	Eulerf getEulerAngles() const;
 	float getYawAngle() const;
 	int getQuaternionResetCounter() const;
@@ -118,6 +118,7 @@ public:
 	void setOrientation(const Dcmf &orientation) { _R_body_to_world = orientation; }
 
 	void loadSensorDataFromFile(std::string filename);
+	uint64_t getReplayEndTime() const { return _replay_data.empty() ? 0 : _replay_data.back().timestamp; }
 
 	Airspeed    _airspeed;
 	Baro        _baro;
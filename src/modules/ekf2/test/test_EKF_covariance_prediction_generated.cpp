@@ -0,0 +1,110 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "EKF/ekf.h"
+#include "EKF/covariance_prediction.h"
+#include "test_helper/comparison_helper.h"
+
+#include "../EKF/python/ekf_derivation/generated/predict_covariance.h"
+
+using namespace matrix;
+
+static void expectCovarianceNear(const SquareMatrixState &P_ref, const SquareMatrixState &P)
+{
+	for (unsigned row = 0; row < State::size; row++) {
+		for (unsigned col = 0; col < State::size; col++) {
+			// the generated function only computes the upper half
+			const float expected = (col >= row) ? P_ref(row, col) : P_ref(col, row);
+			EXPECT_NEAR(P(row, col), expected, 1e-5f * fmaxf(1.f, fabsf(expected))) << "row " << row << " col " << col;
+		}
+	}
+}
+
+TEST(CovariancePredictionGenerated, SparseMatchesGenerated)
+{
+	StateSample state{};
+	state.quat_nominal = Quatf(Eulerf(0.3f, -0.8f, 2.1f));
+	state.accel_bias = Vector3f(0.05f, -0.1f, 0.2f);
+
+	const Vector3f accel(0.4f, -1.2f, -9.5f);
+	const Vector3f accel_var(0.1f, 0.2f, 0.3f);
+	const Vector3f gyro(0.1f, 0.2f, -0.3f);
+	const float gyro_var = 0.01f;
+	const float dt = 0.01f;
+
+	for (int i = 0; i < 10; i++) {
+		SquareMatrixState P = createRandomCovarianceMatrix();
+		const SquareMatrixState P_ref = sym::PredictCovariance(state.vector(), P, accel, accel_var, gyro, gyro_var, dt);
+
+		predictCovarianceSparse(state, P, accel, accel_var, gyro_var, dt);
+		expectCovarianceNear(P_ref, P);
+	}
+}
+
+TEST(CovariancePredictionGenerated, SparseUncorrelatedStates)
+{
+	// GIVEN: states that are uncorrelated with the kinematic states
+	StateSample state{};
+	state.quat_nominal = Quatf(Eulerf(-0.2f, 0.1f, -1.f));
+
+	const Vector3f accel(0.f, 0.f, -CONSTANTS_ONE_G);
+	const Vector3f accel_var(0.1f, 0.1f, 0.1f);
+	const float gyro_var = 0.01f;
+	const float dt = 0.005f;
+
+	SquareMatrixState P = createRandomCovarianceMatrix();
+
+	for (unsigned i = State::accel_bias.idx + State::accel_bias.dof; i < State::size; i++) {
+		P.uncorrelateCovarianceSetVariance<1>(i, 1.f);
+	}
+
+	const SquareMatrixState P_ref = sym::PredictCovariance(state.vector(), P, accel, accel_var, Vector3f(), gyro_var,
+					dt);
+
+	// WHEN: predicting the covariance
+	predictCovarianceSparse(state, P, accel, accel_var, gyro_var, dt);
+
+	// THEN: they stay uncorrelated and the result matches the full prediction
+	expectCovarianceNear(P_ref, P);
+
+	for (unsigned i = State::accel_bias.idx + State::accel_bias.dof; i < State::size; i++) {
+		for (unsigned j = 0; j < State::size; j++) {
+			if (i != j) {
+				EXPECT_EQ(P(i, j), 0.f);
+				EXPECT_EQ(P(j, i), 0.f);
+			}
+		}
+	}
+}
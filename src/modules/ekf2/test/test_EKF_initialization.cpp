@@ -420,3 +420,27 @@ TEST_F(EkfInitializationTest, initializeWithRoll90)
 	_sensor_simulator.runSeconds(1.f);
 	learningCorrectAccelBias();
 }
+
+TEST_F(EkfInitializationTest, initializeToExternalAttitude)
+{
+	const float pitch = math::radians(20.0f);
+	const float roll = math::radians(-10.0f);
+	const float yaw = math::radians(135.0f);
+	const Eulerf euler_angles_sim(roll, pitch, yaw);
+	const Quatf quat_sim(euler_angles_sim);
+
+	// only run until the filter is initialised, before the tilt alignment completes
+	_sensor_simulator.simulateOrientation(quat_sim);
+	_sensor_simulator.runSeconds(0.2f);
+
+	_ekf->resetAttitudeToExternalObservation(quat_sim, math::radians(1.f));
+
+	EXPECT_TRUE(_ekf->control_status_flags().tilt_align);
+	EXPECT_TRUE(_ekf->control_status_flags().yaw_align);
+	initializedOrienationIsMatchingGroundTruth(quat_sim);
+
+	_sensor_simulator.runSeconds(1.f);
+
+	initializedOrienationIsMatchingGroundTruth(quat_sim);
+	velocityAndPositionCloseToZero();
+}
@@ -0,0 +1,132 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+/**
+ * Replay benchmark feeding recorded sensor data to the filter as fast as possible.
+ *
+ * By default the log in replay_data is used, any flight log can be benchmarked by
+ * converting it first with sensor_simulator/convertULogToSensorData.py and passing the
+ * resulting file in the EKF2_REPLAY_FILE environment variable:
+ *
+ *   python3 convertULogToSensorData.py log.ulg && EKF2_REPLAY_FILE=log.csv ./unit-test_EKF_replay_benchmark
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include "EKF/ekf.h"
+#include "sensor_simulator/sensor_simulator.h"
+#include "sensor_simulator/ekf_wrapper.h"
+
+static uint64_t wallTimeSource()
+{
+	using namespace std::chrono;
+	return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static const char *section_names[EstimatorTiming::SECTION_COUNT] {
+	"predict covariance",
+	"predict state",
+	"mag",
+	"optical flow",
+	"gnss",
+	"aux global position",
+	"airspeed",
+	"sideslip",
+	"drag",
+	"height",
+	"gravity",
+	"external vision",
+	"auxvel",
+	"terrain",
+	"other",
+	"output predictor",
+};
+
+class EkfReplayBenchmark : public ::testing::Test
+{
+public:
+	EkfReplayBenchmark(): ::testing::Test(),
+		_ekf{std::make_shared<Ekf>()},
+		_sensor_simulator(_ekf),
+		_ekf_wrapper(_ekf) {};
+
+	std::shared_ptr<Ekf> _ekf;
+	SensorSimulator _sensor_simulator;
+	EkfWrapper _ekf_wrapper;
+};
+
+TEST_F(EkfReplayBenchmark, replay)
+{
+	// GIVEN: a replay log and the wall clock as time source
+	const char *replay_file = getenv("EKF2_REPLAY_FILE");
+	const std::string file_name = replay_file ? replay_file : TEST_DATA_PATH"/replay_data/iris_gps.csv";
+
+	_sensor_simulator.loadSensorDataFromFile(file_name);
+	const uint64_t replay_duration_us = _sensor_simulator.getReplayEndTime();
+	ASSERT_GT(replay_duration_us, 0u) << "no replay data in " << file_name;
+
+	_sensor_simulator.startGps();
+	_ekf_wrapper.enableGpsFusion();
+	_ekf->timing().setTimeSource(wallTimeSource);
+
+	// WHEN: running the filter through the whole log
+	const uint64_t start_us = wallTimeSource();
+	_sensor_simulator.runReplayMicroseconds(replay_duration_us);
+	const uint64_t elapsed_us = wallTimeSource() - start_us;
+
+	// THEN: report the execution time of the filter and the replay throughput
+	const EstimatorTiming &timing = _ekf->timing();
+	const uint32_t updates = timing.updates();
+	ASSERT_GT(updates, 0u);
+	ASSERT_GT(elapsed_us, 0u);
+
+	printf("%s\n", file_name.c_str());
+	printf("%.1f s replayed in %.3f s (%.0fx realtime), %.0f filter updates/s\n",
+	       replay_duration_us * 1e-6, elapsed_us * 1e-6, (double)replay_duration_us / elapsed_us,
+	       updates * 1e6 / elapsed_us);
+	printf("%u filter updates, mean %.2f us, max %u us\n", (unsigned)updates,
+	       (double)timing.update().total_us / updates, (unsigned)timing.update().max_us);
+
+	for (unsigned i = 0; i < EstimatorTiming::SECTION_COUNT; i++) {
+		printf("  %-20s mean %8.2f us  max %6u us\n", section_names[i],
+		       (double)timing.section(i).total_us / updates, (unsigned)timing.section(i).max_us);
+	}
+
+	// the replay must still be faster than realtime on any host running the tests
+	EXPECT_LT(elapsed_us, replay_duration_us);
+}
@@ -244,3 +244,59 @@ TEST_F(EkfTerrainTest, testRngStartInAir)
 					     State::terrain.idx) / sqrtf(_ekf->getAccelBiasVariance()(2) * var_terrain);
 	EXPECT_NEAR(corr_terrain_abias_z, -0.3f, 0.03f);
 }
+
+TEST_F(EkfTerrainTest, testDecoupledRngForTerrainFusion)
+{
+	// GIVEN: rng for terrain estimated by the decoupled terrain filter
+	_ekf_wrapper.enableTerrainDecoupling();
+	_ekf_wrapper.disableFlowFusion();
+	_ekf_wrapper.enableRangeHeightFusion();
+
+	const float rng_height = 18;
+	const float flow_height = 1.f;
+	runFlowAndRngScenario(rng_height, flow_height);
+
+	// THEN: the terrain converges to the range finder measurement
+	EXPECT_TRUE(_ekf_wrapper.isIntendingTerrainRngFusion());
+	EXPECT_TRUE(_ekf->isTerrainEstimateValid());
+	EXPECT_NEAR(rng_height, _ekf->getHagl(), 2e-2f);
+
+	// AND: the terrain is not correlated with any other state
+	auto P = _ekf->covariances();
+
+	for (unsigned i = 0; i < State::size; i++) {
+		if (i != State::terrain.idx) {
+			EXPECT_EQ(P(i, State::terrain.idx), 0.f);
+			EXPECT_EQ(P(State::terrain.idx, i), 0.f);
+		}
+	}
+
+	EXPECT_GT(_ekf->getTerrainVariance(), 0.f);
+}
+
+TEST_F(EkfTerrainTest, testDecoupledFlowForTerrainFusion)
+{
+	// GIVEN: flow for terrain estimated by the decoupled terrain filter
+	_ekf_wrapper.enableTerrainDecoupling();
+	_ekf_wrapper.enableFlowFusion();
+	_ekf_wrapper.disableRangeHeightFusion();
+
+	const float rng_height = 1.f;
+	const float flow_height = 8.f;
+	runFlowAndRngScenario(rng_height, flow_height);
+
+	// THEN: the estimated terrain height converges to the simulated height, slightly slower than
+	// with the coupled filter as the terrain can't benefit from the velocity correlations
+	EXPECT_TRUE(_ekf_wrapper.isIntendingTerrainFlowFusion());
+	EXPECT_TRUE(_ekf->isTerrainEstimateValid());
+	EXPECT_NEAR(_ekf->getHagl(), flow_height, 1.5f);
+
+	// AND: the terrain is not correlated with any other state
+	auto P = _ekf->covariances();
+
+	for (unsigned i = 0; i < State::size; i++) {
+		if (i != State::terrain.idx) {
+			EXPECT_EQ(P(i, State::terrain.idx), 0.f);
+		}
+	}
+}
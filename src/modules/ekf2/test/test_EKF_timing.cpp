@@ -0,0 +1,165 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2025 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include "EKF/ekf.h"
+#include "sensor_simulator/sensor_simulator.h"
+#include "sensor_simulator/ekf_wrapper.h"
+
+static uint64_t fake_time_us = 0;
+
+// advances by 1 us every time it's read
+static uint64_t fakeTimeSource()
+{
+	return fake_time_us++;
+}
+
+static uint64_t wallTimeSource()
+{
+	using namespace std::chrono;
+	return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static const char *section_names[EstimatorTiming::SECTION_COUNT] {
+	"predict covariance",
+	"predict state",
+	"mag",
+	"optical flow",
+	"gnss",
+	"aux global position",
+	"airspeed",
+	"sideslip",
+	"drag",
+	"height",
+	"gravity",
+	"external vision",
+	"auxvel",
+	"terrain",
+	"other",
+	"output predictor",
+};
+
+class EkfTimingTest : public ::testing::Test
+{
+public:
+	EkfTimingTest(): ::testing::Test(),
+		_ekf{std::make_shared<Ekf>()},
+		_sensor_simulator(_ekf),
+		_ekf_wrapper(_ekf) {};
+
+	std::shared_ptr<Ekf> _ekf;
+	SensorSimulator _sensor_simulator;
+	EkfWrapper _ekf_wrapper;
+};
+
+TEST_F(EkfTimingTest, noTimeSource)
+{
+	// GIVEN: no time source
+	_sensor_simulator.runSeconds(2);
+
+	// THEN: nothing is measured
+	EXPECT_EQ(_ekf->timing().updates(), 0u);
+}
+
+TEST_F(EkfTimingTest, sectionAttribution)
+{
+	// GIVEN: a time source advancing at each measurement
+	_sensor_simulator.runSeconds(2);
+	_ekf->timing().setTimeSource(fakeTimeSource);
+
+	// WHEN: running the filter
+	_sensor_simulator.runSeconds(2);
+
+	// THEN: every filter update is measured
+	const EstimatorTiming &timing = _ekf->timing();
+	const uint32_t updates = timing.updates();
+	ASSERT_GT(updates, 0u);
+
+	// each section gets exactly one tick per lap
+	const EstimatorTiming::Stats &predict_cov =
+		timing.section(static_cast<unsigned>(EstimatorTiming::Section::PREDICT_COVARIANCE));
+	EXPECT_EQ(predict_cov.total_us, updates);
+	EXPECT_EQ(predict_cov.max_us, 1u);
+
+	const EstimatorTiming::Stats &other = timing.section(static_cast<unsigned>(EstimatorTiming::Section::OTHER));
+	EXPECT_EQ(other.total_us, 2u * updates);
+	EXPECT_EQ(other.max_us, 2u);
+
+	// and the total update time covers all the sections
+	uint64_t sections_total_us = 0;
+
+	for (unsigned i = 0; i < EstimatorTiming::SECTION_COUNT; i++) {
+		sections_total_us += timing.section(i).total_us;
+	}
+
+	EXPECT_EQ(timing.update().total_us, sections_total_us + updates);
+
+	// WHEN: resetting the statistics
+	_ekf->timing().reset();
+
+	// THEN: they start from scratch
+	EXPECT_EQ(timing.updates(), 0u);
+	EXPECT_EQ(timing.update().total_us, 0u);
+	EXPECT_EQ(timing.section(0).max_us, 0u);
+}
+
+TEST_F(EkfTimingTest, replayBudget)
+{
+	// GIVEN: a replay log and the wall clock as time source
+	_sensor_simulator.loadSensorDataFromFile(TEST_DATA_PATH"/replay_data/iris_gps.csv");
+	_sensor_simulator.startGps();
+	_ekf_wrapper.enableGpsFusion();
+	_ekf->timing().setTimeSource(wallTimeSource);
+
+	// WHEN: running the filter
+	_sensor_simulator.runReplaySeconds(30);
+
+	// THEN: report the execution time budget of this configuration
+	const EstimatorTiming &timing = _ekf->timing();
+	const uint32_t updates = timing.updates();
+	ASSERT_GT(updates, 0u);
+
+	printf("%u filter updates, mean %.2f us, max %u us\n", (unsigned)updates,
+	       (double)timing.update().total_us / updates, (unsigned)timing.update().max_us);
+
+	for (unsigned i = 0; i < EstimatorTiming::SECTION_COUNT; i++) {
+		printf("  %-20s mean %8.2f us  max %6u us\n", section_names[i],
+		       (double)timing.section(i).total_us / updates, (unsigned)timing.section(i).max_us);
+
+		EXPECT_LE(timing.section(i).max_us, timing.update().max_us);
+	}
+}
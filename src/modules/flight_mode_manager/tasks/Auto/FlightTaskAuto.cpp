@@ -90,7 +90,6 @@ bool FlightTaskAuto::updateInitialize()
 {
 	bool ret = FlightTask::updateInitialize();
 
-	_sub_home_position.update();
 	_sub_vehicle_status.update();
 	_position_setpoint_triplet_sub.update();
 
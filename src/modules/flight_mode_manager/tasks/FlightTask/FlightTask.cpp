@@ -44,7 +44,15 @@ bool FlightTask::updateInitialize()
 	_sub_vehicle_local_position.update();
 	_sub_home_position.update();
 
-	_evaluateVehicleLocalPosition();
+	// only re-evaluate the local position if there is a new sample or the current one timed out
+	const hrt_abstime local_position_timestamp = _sub_vehicle_local_position.get().timestamp;
+
+	if ((local_position_timestamp != _time_stamp_local_position_evaluated)
+	    || ((_time_stamp_current - local_position_timestamp) >= _timeout)) {
+		_evaluateVehicleLocalPosition();
+		_time_stamp_local_position_evaluated = local_position_timestamp;
+	}
+
 	_evaluateVehicleLocalPositionSetpoint();
 	_evaluateDistanceToGround();
 	return true;
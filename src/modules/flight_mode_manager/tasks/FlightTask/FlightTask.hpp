@@ -197,6 +197,7 @@ protected:
 	hrt_abstime _time_stamp_activate{}; /**< time stamp when task was activated */
 	hrt_abstime _time_stamp_current{}; /**< time stamp at the beginning of the current task update */
 	hrt_abstime _time_stamp_last{}; /**< time stamp when task was last updated */
+	hrt_abstime _time_stamp_local_position_evaluated{}; /**< time stamp of the local position sample last evaluated */
 
 	/* Current vehicle state */
 	matrix::Vector3f _position; /**< current vehicle position */
@@ -162,8 +162,11 @@ float FlightTaskManualAccelerationSlow::getInputFromSanitizedAuxParameterIndex(i
 
 bool FlightTaskManualAccelerationSlow::haveTakenOff()
 {
-	takeoff_status_s takeoff_status{};
-	_takeoff_status_sub.copy(&takeoff_status);
+	takeoff_status_s takeoff_status;
 
-	return takeoff_status.takeoff_state == takeoff_status_s::TAKEOFF_STATE_FLIGHT;
+	if (_takeoff_status_sub.update(&takeoff_status)) {
+		_taken_off = (takeoff_status.takeoff_state == takeoff_status_s::TAKEOFF_STATE_FLIGHT);
+	}
+
+	return _taken_off;
 }
@@ -75,6 +75,7 @@ private:
 	velocity_limits_s _velocity_limits{};
 
 	uORB::Subscription _takeoff_status_sub{ORB_ID(takeoff_status)};
+	bool _taken_off{false};
 	bool haveTakenOff();
 
 	DEFINE_PARAMETERS_CUSTOM_PARENT(FlightTaskManualAcceleration,
@@ -79,6 +79,7 @@ private:
 	void lockPosition(const matrix::Vector3f &pos, const matrix::Vector2f &vel_sp_feedback, const float dt);
 
 	uORB::Subscription _takeoff_status_sub{ORB_ID(takeoff_status)};
+	float _acceleration_tilt_max{0.f}; ///< acceleration limit from the takeoff tilt limit, only recomputed on takeoff_status updates
 
 	SlewRate<float> _acceleration_slew_rate_x;
 	SlewRate<float> _acceleration_slew_rate_y;
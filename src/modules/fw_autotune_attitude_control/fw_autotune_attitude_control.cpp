@@ -45,8 +45,8 @@ ModuleBase::Descriptor FwAutotuneAttitudeControl::desc{task_spawn, custom_comman
 
 FwAutotuneAttitudeControl::FwAutotuneAttitudeControl(bool is_vtol) :
 	ModuleParams(nullptr),
-	WorkItem(MODULE_NAME, px4::wq_configurations::hp_default),
-	_vehicle_torque_setpoint_sub(this, ORB_ID(vehicle_torque_setpoint), is_vtol ? 1 : 0),
+	WorkItem(MODULE_NAME, px4::wq_configurations::lp_default),
+	_sample_collector(MODULE_NAME"_samples", *this, is_vtol ? 1 : 0, 4),
 	_actuator_controls_status_sub(is_vtol ? ORB_ID(actuator_controls_status_1) : ORB_ID(actuator_controls_status_0))
 {
 	_autotune_attitude_control_status_pub.advertise();
@@ -66,7 +66,7 @@ bool FwAutotuneAttitudeControl::init()
 
 	_signal_filter.setParameters(_publishing_dt_s, .2f); // runs in the slow publishing loop
 
-	if (!_vehicle_torque_setpoint_sub.registerCallback()) {
+	if (!_sample_collector.registerCallback()) {
 		PX4_ERR("callback registration failed");
 		return false;
 	}
@@ -77,8 +77,13 @@ bool FwAutotuneAttitudeControl::init()
 void FwAutotuneAttitudeControl::Run()
 {
 	if (should_exit()) {
+		if (!_sample_collector.stopped()) {
+			// the collector runs on the rate loop's work queue, it schedules this again once stopped
+			_sample_collector.requestStop();
+			return;
+		}
+
 		_parameter_update_sub.unregisterCallback();
-		_vehicle_torque_setpoint_sub.unregisterCallback();
 		exit_and_cleanup(desc);
 		return;
 	}
@@ -118,9 +123,11 @@ void FwAutotuneAttitudeControl::Run()
 	_aux_switch_en = isAuxEnableSwitchEnabled();
 	_want_start_autotune = _vehicle_cmd_start_autotune || _aux_switch_en;
 
-	// new control data needed every iteration
-	if ((_state == state::idle && !_want_start_autotune)
-	    || !_vehicle_torque_setpoint_sub.updated()) {
+	if (_state == state::idle && !_want_start_autotune) {
+		// discard the samples collected while idle
+		RateLoopSampleCollector::Sample samples[16];
+
+		while (_sample_collector.pop(samples, 16) > 0) {}
 
 		return;
 	}
@@ -133,55 +140,12 @@ void FwAutotuneAttitudeControl::Run()
 		}
 	}
 
-
-	if (_vehicle_angular_velocity_sub.updated()) {
-		vehicle_angular_velocity_s vehicle_angular_velocity;
-
-		if (_vehicle_angular_velocity_sub.copy(&vehicle_angular_velocity)) {
-			_angular_velocity = Vector3f(vehicle_angular_velocity.xyz);
-		}
-	}
-
-	vehicle_torque_setpoint_s vehicle_torque_setpoint;
-
-	if (!_vehicle_torque_setpoint_sub.copy(&vehicle_torque_setpoint)) {
-		return;
-	}
-
 	perf_begin(_cycle_perf);
 
-	const hrt_abstime timestamp_sample = vehicle_torque_setpoint.timestamp;
-
-	// collect sample interval average for filters
-	if (_last_run > 0) {
-		// Guard against too small (< 0.125ms) and too large (> 20ms) dt's.
-		const float dt = math::constrain(((timestamp_sample - _last_run) * 1e-6f), 0.000125f, 0.02f);
-		_interval_sum += dt;
-		_interval_count++;
-
-	} else {
-		_interval_sum = 0.f;
-		_interval_count = 0.f;
-	}
-
-	_last_run = timestamp_sample;
-
-	checkFilters();
-
-	if (_state == state::roll || _state == state::roll_amp_detection) {
-		_sys_id.update(_input_scale * vehicle_torque_setpoint.xyz[0],
-			       _angular_velocity(0));
-
-	} else if (_state == state::pitch || _state == state::pitch_amp_detection) {
-		_sys_id.update(_input_scale * vehicle_torque_setpoint.xyz[1],
-			       _angular_velocity(1));
-
-	} else if (_state == state::yaw || _state == state::yaw_amp_detection) {
-		_sys_id.update(_input_scale * vehicle_torque_setpoint.xyz[2],
-			       _angular_velocity(2));
-	}
+	// new control data needed every iteration
+	const bool updated = processSamples();
 
-	if (hrt_elapsed_time(&_last_publish) > _publishing_dt_hrt || _last_publish == 0) {
+	if (updated && (hrt_elapsed_time(&_last_publish) > _publishing_dt_hrt || _last_publish == 0)) {
 		const hrt_abstime now = hrt_absolute_time();
 		updateStateMachine(now);
 
@@ -239,6 +203,70 @@ void FwAutotuneAttitudeControl::Run()
 	perf_end(_cycle_perf);
 }
 
+bool FwAutotuneAttitudeControl::processSamples()
+{
+	static constexpr size_t max_count = 16;
+	RateLoopSampleCollector::Sample samples[max_count];
+
+	// filtered data, the model gets updated once per block
+	float u_model[max_count];
+	float y_model[max_count];
+
+	bool updated = false;
+	size_t count;
+
+	while ((count = _sample_collector.pop(samples, max_count)) > 0) {
+		size_t model_count = 0;
+
+		for (size_t i = 0; i < count; i++) {
+			const RateLoopSampleCollector::Sample &sample = samples[i];
+			const hrt_abstime timestamp_sample = sample.timestamp;
+
+			_angular_velocity = Vector3f(sample.angular_velocity);
+
+			// collect sample interval average for filters
+			if (_last_run > 0) {
+				// Guard against too small (< 0.125ms) and too large (> 20ms) dt's.
+				const float dt = math::constrain(((timestamp_sample - _last_run) * 1e-6f), 0.000125f, 0.02f);
+				_interval_sum += dt;
+				_interval_count++;
+
+			} else {
+				_interval_sum = 0.f;
+				_interval_count = 0.f;
+			}
+
+			_last_run = timestamp_sample;
+
+			checkFilters();
+
+			int axis = -1;
+
+			if (_state == state::roll || _state == state::roll_amp_detection) {
+				axis = 0;
+
+			} else if (_state == state::pitch || _state == state::pitch_amp_detection) {
+				axis = 1;
+
+			} else if (_state == state::yaw || _state == state::yaw_amp_detection) {
+				axis = 2;
+			}
+
+			if (axis >= 0) {
+				_sys_id.updateFilters(_input_scale * sample.torque_setpoint[axis], sample.angular_velocity[axis]);
+				u_model[model_count] = _sys_id.getFilteredInputData();
+				y_model[model_count] = _sys_id.getFilteredOutputData();
+				model_count++;
+			}
+		}
+
+		_sys_id.update(u_model, y_model, model_count);
+		updated = true;
+	}
+
+	return updated;
+}
+
 void FwAutotuneAttitudeControl::checkFilters()
 {
 	if (_interval_count > 1000) {
@@ -934,6 +962,7 @@ int FwAutotuneAttitudeControl::custom_command(int argc, char *argv[])
 int FwAutotuneAttitudeControl::print_status()
 {
 	perf_print_counter(_cycle_perf);
+	_sample_collector.printStatus();
 
 	return 0;
 }
@@ -43,6 +43,7 @@
 #include <lib/mathlib/math/filter/AlphaFilter.hpp>
 #include <lib/perf/perf_counter.h>
 #include <lib/pid_design/pid_design.hpp>
+#include <lib/system_identification/rate_loop_sample_collector.hpp>
 #include <lib/system_identification/system_identification.hpp>
 #include <lib/system_identification/signal_generator.hpp>
 #include <px4_platform_common/defines.h>
@@ -57,10 +58,8 @@
 #include <uORB/topics/manual_control_setpoint.h>
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/autotune_attitude_control_status.h>
-#include <uORB/topics/vehicle_angular_velocity.h>
 #include <uORB/topics/vehicle_command.h>
 #include <uORB/topics/vehicle_status.h>
-#include <uORB/topics/vehicle_torque_setpoint.h>
 #include <mathlib/mathlib.h>
 #include <lib/systemlib/mavlink_log.h>
 
@@ -105,6 +104,7 @@ private:
 	void Run() override;
 
 	void checkFilters();
+	bool processSamples(); // returns true if new samples were processed
 
 	void updateStateMachine(hrt_abstime now);
 	void updateAmplitudeDetectionState(hrt_abstime now, float rate, float target_rate);
@@ -120,12 +120,13 @@ private:
 	const matrix::Vector3f scaleInputSignal(const float signal);
 
 
-	uORB::SubscriptionCallbackWorkItem _vehicle_torque_setpoint_sub;
 	uORB::SubscriptionCallbackWorkItem _parameter_update_sub{this, ORB_ID(parameter_update)};
 
+	// the identification runs in blocks on lp_default, fed by the samples collected on the rate loop
+	RateLoopSampleCollector _sample_collector;
+
 	uORB::Subscription _actuator_controls_status_sub;
 	uORB::Subscription _manual_control_setpoint_sub{ORB_ID(manual_control_setpoint)};
-	uORB::Subscription _vehicle_angular_velocity_sub{ORB_ID(vehicle_angular_velocity)};
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
 	uORB::Subscription _vehicle_command_sub{ORB_ID(vehicle_command)};
 
@@ -68,8 +68,27 @@ void OutputRC::update(const ControlData &control_data, bool new_setpoints, uint8
 	gimbal_controls.control[gimbal_controls_s::INDEX_ROLL] = anglesMappedToOutput(gimbal_controls_s::INDEX_ROLL);
 	gimbal_controls.control[gimbal_controls_s::INDEX_PITCH] = anglesMappedToOutput(gimbal_controls_s::INDEX_PITCH);
 	gimbal_controls.control[gimbal_controls_s::INDEX_YAW] = anglesMappedToOutput(gimbal_controls_s::INDEX_YAW);
-	gimbal_controls.timestamp = hrt_absolute_time();
-	_gimbal_controls_pub.publish(gimbal_controls);
+
+	// only publish if the controls changed, or as keepalive for the consumers
+	bool controls_changed = false;
+
+	for (int i = 0; i < 3; ++i) {
+		// negated comparison to also catch NAN
+		if (!(fabsf(gimbal_controls.control[i] - _last_published_controls[i]) <= CONTROLS_CHANGE_THRESHOLD)) {
+			controls_changed = true;
+		}
+	}
+
+	if (controls_changed || (now > _last_controls_publish + PUBLISH_INTERVAL_MAX)) {
+		gimbal_controls.timestamp = hrt_absolute_time();
+		_gimbal_controls_pub.publish(gimbal_controls);
+
+		for (int i = 0; i < 3; ++i) {
+			_last_published_controls[i] = gimbal_controls.control[i];
+		}
+
+		_last_controls_publish = now;
+	}
 
 	_last_update = now;
 }
@@ -177,7 +196,17 @@ void OutputRC::_stream_device_attitude_status()
 	// If the output is RC, then we signal this by referring to compid 1.
 	attitude_status.gimbal_device_id = 1;
 
-	_attitude_status_pub.publish(attitude_status);
+	// only publish if the reported attitude changed, or as keepalive for the consumers
+	const bool status_changed = (attitude_status.device_flags != _last_published_device_flags)
+				    || !(fabsf(q.dot(_last_published_q)) >= ATTITUDE_CHANGE_THRESHOLD);
+
+	if (status_changed || (attitude_status.timestamp > _last_attitude_status_publish + PUBLISH_INTERVAL_MAX)) {
+		_attitude_status_pub.publish(attitude_status);
+
+		_last_published_device_flags = attitude_status.device_flags;
+		_last_published_q = q;
+		_last_attitude_status_publish = attitude_status.timestamp;
+	}
 }
 
 } /* namespace gimbal */
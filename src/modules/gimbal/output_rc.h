@@ -36,6 +36,7 @@
 
 #include "output.h"
 
+#include <matrix/matrix/math.hpp>
 #include <uORB/Publication.hpp>
 #include <uORB/topics/gimbal_controls.h>
 #include <uORB/topics/gimbal_device_attitude_status.h>
@@ -57,6 +58,17 @@ private:
 	void _stream_device_attitude_status();
 	float anglesMappedToOutput(const uint8_t index);
 
+	static constexpr hrt_abstime PUBLISH_INTERVAL_MAX{500'000}; ///< keepalive interval if nothing changed
+	static constexpr float CONTROLS_CHANGE_THRESHOLD{1e-3f}; ///< minimum change of a normalized control to publish
+	static constexpr float ATTITUDE_CHANGE_THRESHOLD{1.f - 1e-6f}; ///< |q1.q2| below this counts as attitude change
+
+	float _last_published_controls[3] {NAN, NAN, NAN};
+	hrt_abstime _last_controls_publish{0};
+
+	matrix::Quatf _last_published_q{NAN, NAN, NAN, NAN};
+	uint16_t _last_published_device_flags{0};
+	hrt_abstime _last_attitude_status_publish{0};
+
 	uORB::Publication <gimbal_controls_s>	_gimbal_controls_pub{ORB_ID(gimbal_controls)};
 	uORB::Publication <gimbal_device_attitude_status_s>	_attitude_status_pub{ORB_ID(gimbal_device_attitude_status)};
 };
@@ -163,7 +163,7 @@ void GyroCalibration::Run()
 			}
 		}
 
-		if ((_gyro_last_update[gyro] != 0) && (hrt_elapsed_time(&_gyro_last_update[gyro]) > 100_ms)) {
+		if ((_gyro_last_update[gyro] != 0) && (hrt_elapsed_time(&_gyro_last_update[gyro]) > SENSOR_TIMEOUT_US)) {
 			// remove sensor and reset on any timeout
 			_gyro_calibration[gyro].set_device_id(0);
 			_gyro_calibration[gyro].Reset();
@@ -218,7 +218,7 @@ void GyroCalibration::Run()
 		for (int gyro = 0; gyro < _sensor_gyro_subs.size(); gyro++) {
 
 			if ((_gyro_calibration[gyro].device_id() != 0)
-			    && _gyro_mean[gyro].valid() && (_gyro_mean[gyro].count() > 100)
+			    && _gyro_mean[gyro].valid() && (_gyro_mean[gyro].count() > MIN_SAMPLES)
 			   ) {
 
 				const Vector3f old_offset{_gyro_calibration[gyro].offset()};
@@ -74,7 +74,10 @@ public:
 	int print_status() override;
 
 private:
-	static constexpr hrt_abstime INTERVAL_US = 20000_us;
+	// sensor_gyro is already the average of a FIFO block, a low check cadence is enough for a still vehicle
+	static constexpr hrt_abstime INTERVAL_US = 100_ms;
+	static constexpr hrt_abstime SENSOR_TIMEOUT_US = 500_ms;
+	static constexpr unsigned MIN_SAMPLES = 40; // 4 s of samples at INTERVAL_US
 	static constexpr int MAX_SENSORS = 4;
 
 	void Run() override;
@@ -69,6 +69,10 @@ GyroFFT::~GyroFFT()
 	delete[] _fft_input_buffer;
 	delete[] _fft_outupt_buffer;
 	delete[] _peak_magnitudes_all;
+
+	for (int axis = 0; axis < 3; axis++) {
+		delete[] _sdft_history[axis];
+	}
 }
 
 bool GyroFFT::init()
@@ -142,6 +146,7 @@ bool GyroFFT::init()
 
 	if (buffers_allocated) {
 		_imu_gyro_fft_len = _param_imu_gyro_fft_len.get();
+		_peak_tracking = _param_imu_gyro_fft_trk.get();
 
 		// init Hanning window
 		for (int n = 0; n < _imu_gyro_fft_len; n++) {
@@ -164,6 +169,11 @@ bool GyroFFT::init()
 	delete[] _fft_input_buffer;
 	delete[] _fft_outupt_buffer;
 
+	for (int axis = 0; axis < 3; axis++) {
+		delete[] _sdft_history[axis];
+		_sdft_history[axis] = nullptr;
+	}
+
 	return false;
 }
 
@@ -275,30 +285,33 @@ float GyroFFT::EstimatePeakFrequencyBin(q15_t fft[], int peak_index)
 		float real[3] { (float)fft[peak_index - 2], (float)fft[peak_index], (float)fft[peak_index + 2]     };
 		float imag[3] { (float)fft[peak_index - 2 + 1], (float)fft[peak_index + 1], (float)fft[peak_index + 2 + 1] };
 
-		static constexpr int k = 1;
+		// k’ = k + d
+		return peak_index + 2.f * EstimatePeakOffset(real, imag);
+	}
 
-		const float divider = (real[k] * real[k] + imag[k] * imag[k]);
+	return NAN;
+}
 
-		// ap = (X[k + 1].r * X[k].r + X[k+1].i * X[k].i) / (X[k].r * X[k].r + X[k].i * X[k].i)
-		float ap = (real[k + 1] * real[k] + imag[k + 1] * imag[k]) / divider;
+float GyroFFT::EstimatePeakOffset(const float real[3], const float imag[3])
+{
+	static constexpr int k = 1;
 
-		// dp = -ap / (1 – ap)
-		float dp = -ap  / (1.f - ap);
+	const float divider = (real[k] * real[k] + imag[k] * imag[k]);
 
-		// am = (X[k - 1].r * X[k].r + X[k – 1].i * X[k].i) / (X[k].r * X[k].r + X[k].i * X[k].i)
-		float am = (real[k - 1] * real[k] + imag[k - 1] * imag[k]) / divider;
+	// ap = (X[k + 1].r * X[k].r + X[k+1].i * X[k].i) / (X[k].r * X[k].r + X[k].i * X[k].i)
+	float ap = (real[k + 1] * real[k] + imag[k + 1] * imag[k]) / divider;
 
-		// dm = am / (1 – am)
-		float dm = am / (1.f - am);
+	// dp = -ap / (1 – ap)
+	float dp = -ap  / (1.f - ap);
 
-		// d = (dp + dm) / 2 + tau(dp * dp) – tau(dm * dm)
-		float d = (dp + dm) / 2.f + tau(dp * dp) - tau(dm * dm);
+	// am = (X[k - 1].r * X[k].r + X[k – 1].i * X[k].i) / (X[k].r * X[k].r + X[k].i * X[k].i)
+	float am = (real[k - 1] * real[k] + imag[k - 1] * imag[k]) / divider;
 
-		// k’ = k + d
-		return peak_index + 2.f * d;
-	}
+	// dm = am / (1 – am)
+	float dm = am / (1.f - am);
 
-	return NAN;
+	// d = (dp + dm) / 2 + tau(dp * dp) – tau(dm * dm)
+	return (dp + dm) / 2.f + tau(dp * dp) - tau(dm * dm);
 }
 
 void GyroFFT::Run()
@@ -333,14 +346,29 @@ void GyroFFT::Run()
 
 	if (_gyro_fifo) {
 		// run on sensor gyro fifo updates
-		sensor_gyro_fifo_s sensor_gyro_fifo;
+		sensor_gyro_fifo_s sensor_gyro_fifo_copy;
+
+		for (;;) {
+			// read the samples in place from the topic queue (zero-copy) if available
+			const sensor_gyro_fifo_s *sensor_gyro_fifo_ptr = static_cast<const sensor_gyro_fifo_s *>(_sensor_gyro_fifo_sub.peek());
+			const bool peeked = (sensor_gyro_fifo_ptr != nullptr);
+
+			if (!peeked) {
+				if (!_sensor_gyro_fifo_sub.update(&sensor_gyro_fifo_copy)) {
+					break;
+				}
+
+				sensor_gyro_fifo_ptr = &sensor_gyro_fifo_copy;
+			}
+
+			const sensor_gyro_fifo_s &sensor_gyro_fifo = *sensor_gyro_fifo_ptr;
 
-		while (_sensor_gyro_fifo_sub.update(&sensor_gyro_fifo)) {
 			if (_sensor_gyro_fifo_sub.get_last_generation() != _gyro_last_generation + 1) {
 				// force reset if we've missed a sample
 				_fft_buffer_index[0] = 0;
 				_fft_buffer_index[1] = 0;
 				_fft_buffer_index[2] = 0;
+				ResetPeakTracking();
 
 				perf_count(_gyro_fifo_generation_gap_perf);
 			}
@@ -352,12 +380,21 @@ void GyroFFT::Run()
 				_fft_buffer_index[0] = 0;
 				_fft_buffer_index[1] = 0;
 				_fft_buffer_index[2] = 0;
+				ResetPeakTracking();
 
 				_fifo_last_scale = sensor_gyro_fifo.scale;
 			}
 
-			int16_t *input[] {sensor_gyro_fifo.x, sensor_gyro_fifo.y, sensor_gyro_fifo.z};
+			const int16_t *input[] {sensor_gyro_fifo.x, sensor_gyro_fifo.y, sensor_gyro_fifo.z};
 			Update(sensor_gyro_fifo.timestamp_sample, input, sensor_gyro_fifo.samples);
+
+			if (peeked && !_sensor_gyro_fifo_sub.release()) {
+				// the driver overwrote the samples while in use, restart
+				_fft_buffer_index[0] = 0;
+				_fft_buffer_index[1] = 0;
+				_fft_buffer_index[2] = 0;
+				ResetPeakTracking();
+			}
 		}
 
 	} else {
@@ -370,6 +407,7 @@ void GyroFFT::Run()
 				_fft_buffer_index[0] = 0;
 				_fft_buffer_index[1] = 0;
 				_fft_buffer_index[2] = 0;
+				ResetPeakTracking();
 
 				perf_count(_gyro_generation_gap_perf);
 			}
@@ -381,7 +419,7 @@ void GyroFFT::Run()
 			int16_t gyro_y[1] {(int16_t)roundf(sensor_gyro.y * gyro_scale)};
 			int16_t gyro_z[1] {(int16_t)roundf(sensor_gyro.z * gyro_scale)};
 
-			int16_t *input[] {gyro_x, gyro_y, gyro_z};
+			const int16_t *input[] {gyro_x, gyro_y, gyro_z};
 			Update(sensor_gyro.timestamp_sample, input, 1);
 		}
 	}
@@ -394,7 +432,7 @@ void GyroFFT::Run()
 	perf_end(_cycle_perf);
 }
 
-void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N)
+void GyroFFT::Update(const hrt_abstime &timestamp_sample, const int16_t *input[], uint8_t N)
 {
 	q15_t *gyro_data_buffer[] {_gyro_data_buffer_x, _gyro_data_buffer_y, _gyro_data_buffer_z};
 
@@ -402,6 +440,10 @@ void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint
 		int &buffer_index = _fft_buffer_index[axis];
 
 		for (int n = 0; n < N; n++) {
+			if (_peak_tracking) {
+				UpdatePeakTrackers(axis, input[axis][n] / 2);
+			}
+
 			if (buffer_index < _imu_gyro_fft_len) {
 				// convert int16_t -> q15_t (scaling isn't relevant)
 				gyro_data_buffer[axis][buffer_index] = input[axis][n] / 2;
@@ -420,14 +462,186 @@ void GyroFFT::Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint
 				FindPeaks(timestamp_sample, axis, _fft_outupt_buffer);
 
 				// reset
-				// shift buffer (3/4 overlap)
-				const int overlap_start = _imu_gyro_fft_len / 4;
-				memmove(&gyro_data_buffer[axis][0], &gyro_data_buffer[axis][overlap_start], sizeof(q15_t) * overlap_start * 3);
-				buffer_index = overlap_start * 3;
+				if (_peak_tracking) {
+					// the peaks are tracked in between FFT updates, no overlap needed
+					AssignPeakTrackers(axis);
+					buffer_index = 0;
+
+				} else {
+					// shift buffer (3/4 overlap)
+					const int overlap_start = _imu_gyro_fft_len / 4;
+					memmove(&gyro_data_buffer[axis][0], &gyro_data_buffer[axis][overlap_start], sizeof(q15_t) * overlap_start * 3);
+					buffer_index = overlap_start * 3;
+				}
 
 				perf_end(_fft_perf);
 			}
 		}
+
+		if (_peak_tracking) {
+			TrackPeaks(timestamp_sample, axis);
+		}
+	}
+}
+
+void GyroFFT::ResetPeakTracking()
+{
+	for (int axis = 0; axis < 3; axis++) {
+		if (_sdft_history[axis]) {
+			memset(_sdft_history[axis], 0, sizeof(q15_t) * _imu_gyro_fft_len);
+		}
+
+		_sdft_history_index[axis] = 0;
+		_sdft_history_count[axis] = 0;
+
+		for (auto &tracker : _peak_tracker[axis]) {
+			tracker.bin = 0;
+		}
+	}
+}
+
+void GyroFFT::UpdatePeakTrackers(int axis, q15_t sample)
+{
+	// X[k] = (X[k] + x[n] - x[n - N]) * e^(j 2 pi k / N)
+	int &index = _sdft_history_index[axis];
+	const float delta = (float)sample - (float)_sdft_history[axis][index];
+
+	_sdft_history[axis][index] = sample;
+	index = (index + 1) & (_imu_gyro_fft_len - 1); // FFT length is a power of 2
+
+	if (_sdft_history_count[axis] < _imu_gyro_fft_len) {
+		_sdft_history_count[axis]++;
+	}
+
+	for (auto &tracker : _peak_tracker[axis]) {
+		if (tracker.bin > 0) {
+			for (int i = 0; i < 3; i++) {
+				const float real = tracker.real[i] + delta;
+				const float imag = tracker.imag[i];
+				tracker.real[i] = real * tracker.twiddle_real[i] - imag * tracker.twiddle_imag[i];
+				tracker.imag[i] = real * tracker.twiddle_imag[i] + imag * tracker.twiddle_real[i];
+			}
+
+			tracker.samples++;
+		}
+	}
+}
+
+void GyroFFT::InitPeakTracker(int axis, PeakTracker &tracker, int bin)
+{
+	tracker.bin = 0;
+
+	if ((_sdft_history_count[axis] < _imu_gyro_fft_len) || (bin < 2) || (bin >= _imu_gyro_fft_len / 2 - 1)) {
+		return;
+	}
+
+	// exact DFT of the bins around the peak over the sample history (oldest sample first)
+	for (int i = 0; i < 3; i++) {
+		const float w = 2.f * M_PI_F * (bin - 1 + i) / _imu_gyro_fft_len;
+		const float cos_w = cosf(w);
+		const float sin_w = sinf(w);
+
+		float real = 0.f;
+		float imag = 0.f;
+
+		// e^(-j w m)
+		float c = 1.f;
+		float s = 0.f;
+
+		for (int m = 0; m < _imu_gyro_fft_len; m++) {
+			const float x = _sdft_history[axis][(_sdft_history_index[axis] + m) & (_imu_gyro_fft_len - 1)];
+			real += x * c;
+			imag += x * s;
+
+			const float c_next = c * cos_w + s * sin_w;
+			s = s * cos_w - c * sin_w;
+			c = c_next;
+		}
+
+		tracker.real[i] = real;
+		tracker.imag[i] = imag;
+		tracker.twiddle_real[i] = cos_w;
+		tracker.twiddle_imag[i] = sin_w;
+	}
+
+	tracker.bin = bin;
+	tracker.samples = 0;
+}
+
+void GyroFFT::AssignPeakTrackers(int axis)
+{
+	const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+	const float *peak_frequencies_publish[] { _sensor_gyro_fft.peak_frequencies_x, _sensor_gyro_fft.peak_frequencies_y, _sensor_gyro_fft.peak_frequencies_z };
+
+	for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+		PeakTracker &tracker = _peak_tracker[axis][peak];
+
+		if (PX4_ISFINITE(peak_frequencies_publish[axis][peak])) {
+			const int bin = (int)roundf(peak_frequencies_publish[axis][peak] / resolution_hz);
+
+			if (bin != tracker.bin) {
+				InitPeakTracker(axis, tracker, bin);
+			}
+
+			if (tracker.bin > 0) {
+				tracker.power_ref = tracker.real[1] * tracker.real[1] + tracker.imag[1] * tracker.imag[1];
+			}
+
+		} else {
+			tracker.bin = 0;
+		}
+	}
+}
+
+void GyroFFT::TrackPeaks(const hrt_abstime &timestamp_sample, int axis)
+{
+	// recompute the DFT regularly to bound the accumulated rounding error of the sliding DFT
+	const int resync_samples = 16 * _imu_gyro_fft_len;
+
+	// stop tracking once the peak power dropped by 10 dB, the next FFT update decides
+	static constexpr float MIN_POWER_RATIO = 0.1f;
+
+	const float resolution_hz = _gyro_sample_rate_hz / _imu_gyro_fft_len;
+	float *peak_frequencies_publish[] { _sensor_gyro_fft.peak_frequencies_x, _sensor_gyro_fft.peak_frequencies_y, _sensor_gyro_fft.peak_frequencies_z };
+
+	for (int peak = 0; peak < MAX_NUM_PEAKS; peak++) {
+		PeakTracker &tracker = _peak_tracker[axis][peak];
+
+		if (tracker.bin == 0) {
+			continue;
+		}
+
+		if (tracker.samples >= resync_samples) {
+			InitPeakTracker(axis, tracker, tracker.bin);
+		}
+
+		const float power = tracker.real[1] * tracker.real[1] + tracker.imag[1] * tracker.imag[1];
+
+		if (power < MIN_POWER_RATIO * tracker.power_ref) {
+			tracker.bin = 0;
+			continue;
+		}
+
+		const float d = EstimatePeakOffset(tracker.real, tracker.imag);
+
+		if (!PX4_ISFINITE(d) || (fabsf(d) > 1.f)) {
+			continue;
+		}
+
+		const float freq_adjusted = resolution_hz * (tracker.bin + d);
+
+		if ((freq_adjusted >= _param_imu_gyro_fft_min.get()) && (freq_adjusted <= _param_imu_gyro_fft_max.get())) {
+			peak_frequencies_publish[axis][peak] = freq_adjusted;
+
+			_last_update[axis][peak] = timestamp_sample;
+			_sensor_gyro_fft.timestamp_sample = timestamp_sample;
+			_publish = true;
+		}
+
+		if (fabsf(d) > 0.5f) {
+			// follow the peak to the neighbouring bin
+			InitPeakTracker(axis, tracker, tracker.bin + ((d > 0.f) ? 1 : -1));
+		}
 	}
 }
 
@@ -89,13 +89,31 @@ private:
 	void Run() override;
 	inline void FindPeaks(const hrt_abstime &timestamp_sample, int axis, q15_t *fft_outupt_buffer);
 	inline float EstimatePeakFrequencyBin(q15_t fft[], int peak_index);
+	static inline float EstimatePeakOffset(const float real[3], const float imag[3]);
 	inline void Publish();
 	bool SensorSelectionUpdate(bool force = false);
-	void Update(const hrt_abstime &timestamp_sample, int16_t *input[], uint8_t N);
+	void Update(const hrt_abstime &timestamp_sample, const int16_t *input[], uint8_t N);
 	inline void UpdateOutput(const hrt_abstime &timestamp_sample, int axis, float peak_frequencies[MAX_NUM_PEAKS],
 				 float peak_snr[MAX_NUM_PEAKS], int num_peaks_found);
 	void VehicleIMUStatusUpdate(bool force = false);
 
+	// sliding DFT tracking of the bins around each peak in between FFT updates (IMU_GYRO_FFT_TRK)
+	struct PeakTracker {
+		float real[3] {};      // sliding DFT of bins (bin - 1, bin, bin + 1)
+		float imag[3] {};
+		float twiddle_real[3] {};
+		float twiddle_imag[3] {};
+		float power_ref{0.f};  // center bin power when the peak was detected by the FFT
+		int bin{0};            // tracked center bin, 0 if not tracking
+		int samples{0};        // samples since the last exact DFT computation
+	};
+
+	void ResetPeakTracking();
+	inline void UpdatePeakTrackers(int axis, q15_t sample);
+	void InitPeakTracker(int axis, PeakTracker &tracker, int bin);
+	void AssignPeakTrackers(int axis);
+	void TrackPeaks(const hrt_abstime &timestamp_sample, int axis);
+
 	template<size_t N>
 	bool AllocateBuffers()
 	{
@@ -108,6 +126,16 @@ private:
 
 		_peak_magnitudes_all = new float[N];
 
+		if (_param_imu_gyro_fft_trk.get()) {
+			for (int axis = 0; axis < 3; axis++) {
+				_sdft_history[axis] = new q15_t[N] {};
+
+				if (_sdft_history[axis] == nullptr) {
+					return false;
+				}
+			}
+		}
+
 		return (_gyro_data_buffer_x && _gyro_data_buffer_y && _gyro_data_buffer_z
 			&& _hanning_window
 			&& _fft_input_buffer
@@ -145,6 +173,14 @@ private:
 
 	float *_peak_magnitudes_all{nullptr};
 
+	q15_t *_sdft_history[3] {}; // circular buffers holding the last FFT length samples
+	int _sdft_history_index[3] {};
+	int _sdft_history_count[3] {};
+
+	PeakTracker _peak_tracker[3][MAX_NUM_PEAKS] {};
+
+	bool _peak_tracking{false};
+
 	float _gyro_sample_rate_hz{8000}; // 8 kHz default
 
 	float _fifo_last_scale{0};
@@ -168,7 +204,8 @@ private:
 		(ParamInt<px4::params::IMU_GYRO_FFT_LEN>) _param_imu_gyro_fft_len,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MIN>) _param_imu_gyro_fft_min,
 		(ParamFloat<px4::params::IMU_GYRO_FFT_MAX>) _param_imu_gyro_fft_max,
-		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr
+		(ParamFloat<px4::params::IMU_GYRO_FFT_SNR>) _param_imu_gyro_fft_snr,
+		(ParamBool<px4::params::IMU_GYRO_FFT_TRK>) _param_imu_gyro_fft_trk
 	)
 };
 
@@ -83,3 +83,16 @@ PARAM_DEFINE_INT32(IMU_GYRO_FFT_LEN, 512);
 * @group Sensors
 */
 PARAM_DEFINE_FLOAT(IMU_GYRO_FFT_SNR, 10.f);
+
+/**
+* IMU gyro FFT peak tracking.
+*
+* Track the frequency of the detected peaks in between FFT updates with a sliding DFT
+* of the bins around each peak. The peak frequencies are then updated at the gyro
+* update rate and the FFT only runs once per window (no overlap) to search for new peaks.
+*
+* @boolean
+* @reboot_required true
+* @group Sensors
+*/
+PARAM_DEFINE_INT32(IMU_GYRO_FFT_TRK, 0);
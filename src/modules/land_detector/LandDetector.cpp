@@ -71,14 +71,14 @@ LandDetector::~LandDetector()
 
 void LandDetector::start()
 {
-	ScheduleDelayed(50_ms);
+	ScheduleDelayed(BACKUP_SCHEDULE_INTERVAL);
 	_vehicle_local_position_sub.registerCallback();
 }
 
 void LandDetector::Run()
 {
 	// push backup schedule
-	ScheduleDelayed(50_ms);
+	ScheduleDelayed(_airborne_schedule ? AIRBORNE_UPDATE_INTERVAL + BACKUP_SCHEDULE_INTERVAL : BACKUP_SCHEDULE_INTERVAL);
 
 	perf_begin(_cycle_perf);
 
@@ -189,6 +189,8 @@ void LandDetector::Run()
 
 	_previous_armed_state = _armed;
 
+	UpdateSchedule();
+
 	perf_end(_cycle_perf);
 
 	if (should_exit()) {
@@ -197,6 +199,28 @@ void LandDetector::Run()
 	}
 }
 
+void LandDetector::UpdateSchedule()
+{
+	bool airborne_at_altitude = false;
+
+	if ((_param_lnd_airb_alt.get() > FLT_EPSILON) && _armed
+	    && !_land_detected.landed && !_land_detected.maybe_landed && !_land_detected.ground_contact
+	    && !_land_detected.freefall && _vehicle_local_position.dist_bottom_valid
+	    && PX4_ISFINITE(_vehicle_local_position.dist_bottom) && PX4_ISFINITE(_vehicle_local_position.vz)) {
+
+		// consider the descent rate, so the full rate is back before a descent gets close to the ground
+		const float dist_bottom_predicted = _vehicle_local_position.dist_bottom
+						    - math::max(_vehicle_local_position.vz, 0.f) * DESCENT_LOOKAHEAD_TIME;
+
+		airborne_at_altitude = dist_bottom_predicted > _param_lnd_airb_alt.get();
+	}
+
+	if (airborne_at_altitude != _airborne_schedule) {
+		_airborne_schedule = airborne_at_altitude;
+		_vehicle_local_position_sub.set_interval_us(_airborne_schedule ? AIRBORNE_UPDATE_INTERVAL : 0);
+	}
+}
+
 void LandDetector::UpdateVehicleAtRest()
 {
 	if (_sensor_selection_sub.updated()) {
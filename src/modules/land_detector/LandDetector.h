@@ -163,6 +163,16 @@ private:
 
 	void UpdateVehicleAtRest();
 
+	/**
+	 * Lower the update rate while clearly airborne far above the ground, raise it again
+	 * when getting close to the ground or descending towards it.
+	 */
+	void UpdateSchedule();
+
+	static constexpr hrt_abstime BACKUP_SCHEDULE_INTERVAL{50_ms};
+	static constexpr hrt_abstime AIRBORNE_UPDATE_INTERVAL{100_ms};	///< update interval while airborne at altitude
+	static constexpr float DESCENT_LOOKAHEAD_TIME{3.f};	///< time used to predict the height above ground [s]
+
 	vehicle_land_detected_s _land_detected{};
 	hrt_abstime _takeoff_time{0};
 	hrt_abstime _total_flight_time{0};	///< total vehicle flight time in microseconds
@@ -187,11 +197,13 @@ private:
 	uint32_t _device_id_gyro{0};
 
 	bool _at_rest{true};
+	bool _airborne_schedule{false};	///< running at the lower airborne update rate
 
 	DEFINE_PARAMETERS_CUSTOM_PARENT(
 		ModuleParams,
 		(ParamInt<px4::params::LND_FLIGHT_T_HI>) _param_total_flight_time_high,
-		(ParamInt<px4::params::LND_FLIGHT_T_LO>) _param_total_flight_time_low
+		(ParamInt<px4::params::LND_FLIGHT_T_LO>) _param_total_flight_time_low,
+		(ParamFloat<px4::params::LND_AIRB_ALT>) _param_lnd_airb_alt
 	);
 };
 
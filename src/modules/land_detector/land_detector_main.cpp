@@ -106,6 +106,8 @@ int LandDetector::task_spawn(int argc, char *argv[])
 int LandDetector::print_status()
 {
 	PX4_INFO("running (%s)", _currentMode);
+	PX4_INFO("update rate: %s", _airborne_schedule ? "airborne (reduced)" : "full");
+	perf_print_counter(_cycle_perf);
 	return 0;
 }
 int LandDetector::print_usage(const char *reason)
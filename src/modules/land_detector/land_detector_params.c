@@ -58,3 +58,20 @@ PARAM_DEFINE_INT32(LND_FLIGHT_T_HI, 0);
  *
  */
 PARAM_DEFINE_INT32(LND_FLIGHT_T_LO, 0);
+
+/**
+ * Height above ground for the reduced land detector rate
+ *
+ * While armed, airborne and more than this height above ground (predicted a few seconds
+ * ahead with the current descent rate), the land detector runs at a reduced rate of 10 Hz.
+ * Closer to the ground it runs at the rate of the local position estimate.
+ * Requires a valid distance to the ground. Set to 0 to always run at the full rate.
+ *
+ * @unit m
+ * @min 0
+ * @decimal 1
+ * @increment 1
+ * @group Land Detector
+ *
+ */
+PARAM_DEFINE_FLOAT(LND_AIRB_ALT, 10.f);
@@ -82,7 +82,7 @@ void KalmanFilter::predict(float dt, float acc, float acc_unc)
 
 	matrix::Matrix<float, 2, 2> process_noise = G * G.transpose() * acc_unc;
 
-	_covariance = A * _covariance * A.transpose() + process_noise;
+	_covariance = matrix::transformCovariance(A, _covariance, process_noise);
 }
 
 bool KalmanFilter::update(float meas, float measUnc)
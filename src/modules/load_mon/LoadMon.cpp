@@ -103,6 +103,8 @@ void LoadMon::Run()
 
 	cpuload();
 
+	perf_snapshot();
+
 #if defined(__PX4_NUTTX)
 
 	if (_param_sys_stck_en.get()) {
@@ -111,6 +113,14 @@ void LoadMon::Run()
 
 #endif
 
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+	work_item_status();
+#endif
+
+#if defined(CONFIG_PLATFORM_HEAP_TRACKING)
+	task_memory();
+#endif
+
 	if (should_exit()) {
 		ScheduleClear();
 #if defined (__PX4_LINUX)
@@ -249,6 +259,246 @@ void LoadMon::cpuload()
 #endif
 }
 
+void LoadMon::perf_snapshot_match(perf_counter_t handle, void *user)
+{
+	LoadMon *self = static_cast<LoadMon *>(user);
+
+	perf_counter_stats stats;
+	perf_get_stats(handle, &stats);
+
+	if (stats.name == nullptr || !perf_snapshot_selected(stats.name)) {
+		return;
+	}
+
+	// find the entry of this counter, or reuse one not matched in this cycle
+	PerfSnapshotEntry *entry = nullptr;
+
+	for (auto &e : self->_perf_snapshot_entries) {
+		if (e.handle == handle) {
+			entry = &e;
+			break;
+		}
+	}
+
+	if (entry == nullptr) {
+		for (auto &e : self->_perf_snapshot_entries) {
+			if (!e.matched) {
+				entry = &e;
+				*entry = PerfSnapshotEntry{};
+				entry->handle = handle;
+				break;
+			}
+		}
+	}
+
+	if (entry == nullptr || entry->matched) {
+		return;
+	}
+
+	entry->matched = true;
+
+	const hrt_abstime now = self->_perf_snapshot_now;
+
+	if ((entry->timestamp != 0) && (stats.event_count >= entry->event_count)
+	    && (self->_perf_snapshot_count < MAX_PERF_SNAPSHOT_COUNTERS)) {
+
+		const uint64_t event_count_delta = stats.event_count - entry->event_count;
+		const uint64_t elapsed_delta_ns = stats.elapsed_total_ns - entry->elapsed_total_ns;
+		const hrt_abstime interval = now - entry->timestamp;
+
+		perf_snapshot_s &snapshot = self->_perf_snapshots[self->_perf_snapshot_count++];
+		snapshot = perf_snapshot_s{};
+		snapshot.type = perf_snapshot_s::TYPE_PERF_COUNTER;
+		strncpy(snapshot.name, stats.name, sizeof(snapshot.name) - 1);
+		snapshot.interval = interval;
+		snapshot.event_count_delta = event_count_delta;
+
+		if (event_count_delta > 0) {
+			snapshot.elapsed_mean = 1e-3f * elapsed_delta_ns / event_count_delta;
+		}
+
+		snapshot.elapsed_max = 1e-3f * stats.elapsed_max_ns;
+
+		if (interval > 0) {
+			snapshot.cpu_load = 1e-3f * elapsed_delta_ns / interval;
+		}
+
+		snapshot.timestamp = now;
+	}
+
+	// first sample or counter reset only store the reference
+	entry->event_count = stats.event_count;
+	entry->elapsed_total_ns = stats.elapsed_total_ns;
+	entry->timestamp = now;
+}
+
+bool LoadMon::perf_snapshot_selected(const char *name)
+{
+	// comma separated list of name prefixes
+	const char *prefix = CONFIG_MODULES_LOAD_MON_PERF_SNAPSHOT;
+
+	while (*prefix != '\0') {
+		const char *end = strchr(prefix, ',');
+		const size_t len = end ? (size_t)(end - prefix) : strlen(prefix);
+
+		if (len > 0 && strncmp(name, prefix, len) == 0) {
+			return true;
+		}
+
+		if (end == nullptr) {
+			break;
+		}
+
+		prefix = end + 1;
+	}
+
+	return false;
+}
+
+void LoadMon::perf_snapshot()
+{
+	// Counters are looked up on every cycle while the perf list is locked, as they can be freed any time
+	// (e.g. a module being stopped). The entries keep the previous values to compute the interval deltas.
+	for (auto &e : _perf_snapshot_entries) {
+		e.matched = false;
+	}
+
+	_perf_snapshot_count = 0;
+	_perf_snapshot_now = hrt_absolute_time();
+
+	perf_iterate_all(perf_snapshot_match, this);
+
+	for (auto &e : _perf_snapshot_entries) {
+		if (!e.matched) {
+			e = PerfSnapshotEntry{};
+		}
+	}
+
+	for (int i = 0; i < _perf_snapshot_count; i++) {
+		_perf_snapshot_pub.publish(_perf_snapshots[i]);
+	}
+
+#if defined(__PX4_NUTTX)
+	const hrt_abstime now = _perf_snapshot_now;
+
+	// a few tasks per cycle, leaving the rest of the queue for the perf counters
+	for (int n = 0; n < PERF_SNAPSHOT_TASKS_PER_CYCLE; n++) {
+		const int index = _perf_snapshot_task_index;
+		_perf_snapshot_task_index = (_perf_snapshot_task_index + 1) % CONFIG_FS_PROCFS_MAX_TASKS;
+
+		PerfSnapshotTask &task = _perf_snapshot_tasks[index];
+		perf_snapshot_s snapshot{};
+		bool valid = false;
+		pid_t pid = -1;
+		hrt_abstime total_runtime = 0;
+
+		sched_lock();
+
+		if (system_load.tasks[index].valid && system_load.tasks[index].tcb) {
+			valid = true;
+			pid = system_load.tasks[index].tcb->pid;
+			total_runtime = system_load.tasks[index].total_runtime;
+			strncpy(snapshot.name, system_load.tasks[index].tcb->name, sizeof(snapshot.name) - 1);
+		}
+
+		sched_unlock();
+
+		if (!valid) {
+			task.pid = -1;
+			continue;
+		}
+
+		if ((task.pid == pid) && (total_runtime >= task.total_runtime) && (now > task.timestamp)) {
+			snapshot.type = perf_snapshot_s::TYPE_TASK;
+			snapshot.interval = now - task.timestamp;
+			snapshot.cpu_load = (float)(total_runtime - task.total_runtime) / snapshot.interval;
+			snapshot.timestamp = now;
+			_perf_snapshot_pub.publish(snapshot);
+		}
+
+		task.pid = pid;
+		task.total_runtime = total_runtime;
+		task.timestamp = now;
+	}
+
+#endif
+}
+
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+void LoadMon::work_item_status()
+{
+	// a few items per cycle, within the queue length of work_item_status
+	for (int i = 0; i < work_item_status_s::ORB_QUEUE_LENGTH; i++) {
+		px4::work_item_statistics_t statistics;
+
+		if (!px4::WorkQueueManagerItemStatistics(_work_item_index, statistics)) {
+			// start over with the first item in the next cycle
+			_work_item_index = 0;
+			break;
+		}
+
+		_work_item_index++;
+
+		work_item_status_s status{};
+		status.run_time_total = statistics.run_time_total_us;
+		status.run_time_max = statistics.run_time_max_us;
+		status.run_count = statistics.run_count;
+		status.overruns = statistics.overruns;
+		strncpy(status.item_name, statistics.item_name, sizeof(status.item_name) - 1);
+		strncpy(status.wq_name, statistics.wq_name, sizeof(status.wq_name) - 1);
+		status.timestamp = hrt_absolute_time();
+
+		_work_item_status_pub.publish(status);
+	}
+}
+#endif
+
+#if defined(CONFIG_PLATFORM_HEAP_TRACKING)
+void LoadMon::task_memory()
+{
+	// a few threads per cycle, within the queue length of task_memory
+	for (int i = 0; i < task_memory_s::ORB_QUEUE_LENGTH; i++) {
+		px4::heap_tracking::owner_usage_t usage;
+
+		if (!px4::heap_tracking::get_owner_usage(_task_memory_index, usage)) {
+			// start over with the first thread in the next cycle
+			_task_memory_index = 0;
+			break;
+		}
+
+		_task_memory_index++;
+
+		task_memory_s status{};
+		status.heap_used = usage.used;
+		status.heap_peak = usage.peak;
+		status.heap_allocations = usage.allocations;
+		strncpy(status.task_name, usage.name, sizeof(status.task_name) - 1);
+
+#if defined(__PX4_NUTTX)
+
+		if (usage.thread != 0) {
+			sched_lock();
+
+			// pthread_t is the pid, skip it if it was reused by another task
+			struct tcb_s *tcb = nxsched_get_tcb((pid_t)usage.thread);
+
+			if (tcb && (strncmp(tcb->name, usage.name, sizeof(usage.name)) == 0)) {
+				status.stack_size = tcb->adj_stack_size;
+				status.stack_free = up_check_tcbstack_remain(tcb);
+			}
+
+			sched_unlock();
+		}
+
+#endif // __PX4_NUTTX
+
+		status.timestamp = hrt_absolute_time();
+
+		_task_memory_pub.publish(status);
+	}
+}
+#endif
+
 #if defined(__PX4_NUTTX)
 void LoadMon::stack_usage()
 {
@@ -317,8 +567,14 @@ int LoadMon::print_usage(const char *reason)
 Background process running periodically on the low priority work queue to calculate the CPU load and RAM
 usage and publish the `cpuload` topic.
 
+It also publishes the `perf_snapshot` topic with the interval statistics of the perf counters selected with
+`CONFIG_MODULES_LOAD_MON_PERF_SNAPSHOT` (and on NuttX the CPU load of each task), so they end up in the log.
+
 On NuttX it also checks the stack usage of each process and if it falls below 300 bytes, a warning is output,
 which will also appear in the log file.
+
+With `CONFIG_PLATFORM_HEAP_TRACKING` the heap usage and high watermark of each thread (and on NuttX its stack
+usage) is published as `task_memory`.
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("load_mon", "system");
@@ -40,13 +40,17 @@
 #include <lib/perf/perf_counter.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/defines.h>
+#include <px4_platform_common/heap_tracking.h>
 #include <px4_platform_common/module.h>
 #include <px4_platform_common/module_params.h>
 #include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
 #include <px4_platform/cpuload.h>
 #include <uORB/Publication.hpp>
 #include <uORB/topics/cpuload.h>
+#include <uORB/topics/perf_snapshot.h>
+#include <uORB/topics/task_memory.h>
 #include <uORB/topics/task_stack_info.h>
+#include <uORB/topics/work_item_status.h>
 
 #if defined(__PX4_LINUX)
 #include <sys/times.h>
@@ -94,6 +98,62 @@ private:
 #endif
 	uORB::Publication<cpuload_s> _cpuload_pub {ORB_ID(cpuload)};
 
+	/* Publish the interval statistics of the selected perf counters (and tasks on NuttX) */
+	void perf_snapshot();
+
+	static void perf_snapshot_match(perf_counter_t handle, void *user);
+	static bool perf_snapshot_selected(const char *name);
+
+	static constexpr int MAX_PERF_SNAPSHOT_COUNTERS = 8;
+
+	struct PerfSnapshotEntry {
+		perf_counter_t handle{nullptr};
+		uint64_t event_count{0};
+		uint64_t elapsed_total_ns{0};
+		hrt_abstime timestamp{0};
+		bool matched{false};
+	};
+
+	PerfSnapshotEntry _perf_snapshot_entries[MAX_PERF_SNAPSHOT_COUNTERS] {};
+
+	// collected while iterating the counters (under the perf lock), published afterwards
+	perf_snapshot_s _perf_snapshots[MAX_PERF_SNAPSHOT_COUNTERS] {};
+	int _perf_snapshot_count{0};
+	hrt_abstime _perf_snapshot_now{0};
+
+#if defined(__PX4_NUTTX)
+	static constexpr int PERF_SNAPSHOT_TASKS_PER_CYCLE = 4;
+
+	struct PerfSnapshotTask {
+		pid_t pid{-1};
+		hrt_abstime total_runtime{0};
+		hrt_abstime timestamp{0};
+	};
+
+	PerfSnapshotTask _perf_snapshot_tasks[CONFIG_FS_PROCFS_MAX_TASKS] {};
+	int _perf_snapshot_task_index{0};
+#endif
+
+	uORB::Publication<perf_snapshot_s> _perf_snapshot_pub{ORB_ID(perf_snapshot)};
+
+#if defined(CONFIG_WQ_ITEM_STATISTICS)
+	/* Publish the run time statistics of the next WorkItems */
+	void work_item_status();
+
+	unsigned _work_item_index{0};
+
+	uORB::Publication<work_item_status_s> _work_item_status_pub{ORB_ID(work_item_status)};
+#endif
+
+#if defined(CONFIG_PLATFORM_HEAP_TRACKING)
+	/* Publish the heap (and on NuttX stack) usage of the next threads */
+	void task_memory();
+
+	int _task_memory_index{0};
+
+	uORB::Publication<task_memory_s> _task_memory_pub{ORB_ID(task_memory)};
+#endif
+
 #if defined(__PX4_LINUX)
 	FILE *_proc_fd = nullptr;
 	/* calculate usage directly from clock ticks on Linux */
@@ -68,7 +68,7 @@ void BlockLocalPositionEstimator::baroCorrect()
 
 	// residual
 	Matrix<float, n_y_baro, n_y_baro> S_I =
-		inv<float, n_y_baro>((C * m_P * C.transpose()) + R);
+		inv<float, n_y_baro>(transformCovariance(C, m_P, R));
 	Vector<float, n_y_baro> r = y - (C * _x);
 
 	// fault detection
@@ -167,7 +167,7 @@ void BlockLocalPositionEstimator::flowCorrect()
 	Vector<float, 2> r = y - C * _x;
 
 	// residual covariance
-	Matrix<float, n_y_flow, n_y_flow> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_flow, n_y_flow> S = transformCovariance(C, m_P, R);
 
 	// publish innovations
 	_pub_innov.get().flow[0] = r(0);
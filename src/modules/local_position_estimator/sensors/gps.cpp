@@ -186,7 +186,7 @@ void BlockLocalPositionEstimator::gpsCorrect()
 	Vector<float, n_y_gps> r = y - C * x0;
 
 	// residual covariance
-	Matrix<float, n_y_gps, n_y_gps> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_gps, n_y_gps> S = transformCovariance(C, m_P, R);
 
 	// publish innovations
 	_pub_innov.get().gps_hpos[0] = r(0);
@@ -89,7 +89,7 @@ void BlockLocalPositionEstimator::lidarCorrect()
 	// residual
 	Vector<float, n_y_lidar> r = y - C * _x;
 	// residual covariance
-	Matrix<float, n_y_lidar, n_y_lidar> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_lidar, n_y_lidar> S = transformCovariance(C, m_P, R);
 
 	// publish innovations
 	_pub_innov.get().hagl = r(0);
@@ -139,7 +139,7 @@ void BlockLocalPositionEstimator::mocapCorrect()
 	// residual
 	Vector<float, n_y_mocap> r = y - C * _x;
 	// residual covariance
-	Matrix<float, n_y_mocap, n_y_mocap> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_mocap, n_y_mocap> S = transformCovariance(C, m_P, R);
 
 	// publish innovations
 	_pub_innov.get().ev_hpos[0] = r(0);
@@ -109,7 +109,7 @@ void BlockLocalPositionEstimator::sonarCorrect()
 	// residual
 	Vector<float, n_y_sonar> r = y - C * _x;
 	// residual covariance
-	Matrix<float, n_y_sonar, n_y_sonar> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_sonar, n_y_sonar> S = transformCovariance(C, m_P, R);
 
 	// publish innovations
 	_pub_innov.get().hagl = r(0);
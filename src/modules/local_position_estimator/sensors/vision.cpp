@@ -156,7 +156,7 @@ void BlockLocalPositionEstimator::visionCorrect()
 	// residual
 	Matrix<float, n_y_vision, 1> r = y - C * x0;
 	// residual covariance
-	Matrix<float, n_y_vision, n_y_vision> S = C * m_P * C.transpose() + R;
+	Matrix<float, n_y_vision, n_y_vision> S = transformCovariance(C, m_P, R);
 
 	// publish innovations
 	_pub_innov.get().ev_hpos[0] = r(0, 0);
@@ -0,0 +1,155 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <cstring>
+
+#include "log_compressor.h"
+
+#define HEATSHRINK_DYNAMIC_ALLOC 0
+#include <lib/heatshrink/heatshrink/heatshrink_decoder.h>
+
+using namespace px4::logger;
+
+static bool poll(heatshrink_decoder &hsd, uint8_t *out, size_t out_size, size_t &output_size)
+{
+	HSD_poll_res poll_res;
+
+	do {
+		size_t count = 0;
+		poll_res = heatshrink_decoder_poll(&hsd, out + output_size, out_size - output_size, &count);
+		output_size += count;
+	} while (poll_res == HSDR_POLL_MORE && output_size < out_size);
+
+	return poll_res == HSDR_POLL_EMPTY;
+}
+
+static size_t decompress(const uint8_t *frame, size_t frame_size, uint8_t *out, size_t out_size)
+{
+	ulog_compressed_frame_header_s frame_header;
+	memcpy(&frame_header, frame, sizeof(frame_header));
+	EXPECT_EQ(frame_header.compressed_size + sizeof(frame_header), frame_size);
+
+	heatshrink_decoder hsd;
+	heatshrink_decoder_reset(&hsd);
+
+	const uint8_t *in = frame + sizeof(frame_header);
+	size_t input_size = 0;
+	size_t output_size = 0;
+
+	while (input_size < frame_header.compressed_size) {
+		size_t count = 0;
+
+		if (heatshrink_decoder_sink(&hsd, const_cast<uint8_t *>(in + input_size), frame_header.compressed_size - input_size,
+					    &count) < 0 || !poll(hsd, out, out_size, output_size)) {
+			return 0;
+		}
+
+		input_size += count;
+	}
+
+	while (heatshrink_decoder_finish(&hsd) == HSDR_FINISH_MORE) {
+		if (!poll(hsd, out, out_size, output_size)) {
+			return 0;
+		}
+	}
+
+	EXPECT_EQ(frame_header.uncompressed_size, output_size);
+	return output_size;
+}
+
+TEST(LogCompressor, FileHeader)
+{
+	EXPECT_EQ(sizeof(ulog_compressed_header_s), 8u);
+	EXPECT_EQ(sizeof(ulog_compressed_frame_header_s), 4u);
+
+	const ulog_compressed_header_s header = LogCompressor::file_header();
+	EXPECT_EQ(memcmp(header.magic, "ULgz", 4), 0);
+	EXPECT_EQ(header.hdr_ver, 1);
+	EXPECT_EQ(header.window_bits, HEATSHRINK_STATIC_WINDOW_BITS);
+	EXPECT_EQ(header.lookahead_bits, HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+}
+
+TEST(LogCompressor, InvalidSize)
+{
+	LogCompressor compressor;
+	uint8_t data[LogCompressor::max_frame_input_size + 1] {};
+
+	EXPECT_EQ(compressor.compress(data, 0), -1);
+	EXPECT_EQ(compressor.compress(data, sizeof(data)), -1);
+}
+
+TEST(LogCompressor, RoundTripRepetitive)
+{
+	// log data is mostly repetitive: similar messages with slowly changing timestamps
+	uint8_t data[LogCompressor::max_frame_input_size];
+
+	for (size_t i = 0; i < sizeof(data); ++i) {
+		data[i] = (i % 16 == 0) ? (uint8_t)(i / 16) : (uint8_t)(i % 16);
+	}
+
+	LogCompressor compressor;
+	const ssize_t frame_size = compressor.compress(data, sizeof(data));
+	ASSERT_GT(frame_size, 0);
+	EXPECT_LT((size_t)frame_size, sizeof(data) / 2);
+
+	uint8_t out[sizeof(data)];
+	ASSERT_EQ(decompress(compressor.frame(), frame_size, out, sizeof(out)), sizeof(data));
+	EXPECT_EQ(memcmp(data, out, sizeof(data)), 0);
+}
+
+TEST(LogCompressor, RoundTripIncompressible)
+{
+	uint8_t data[LogCompressor::max_frame_input_size];
+	uint32_t state = 1;
+
+	for (size_t i = 0; i < sizeof(data); ++i) {
+		// xorshift
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		data[i] = (uint8_t)state;
+	}
+
+	LogCompressor compressor;
+
+	// compress twice to check that frames are independent
+	for (int k = 0; k < 2; ++k) {
+		const ssize_t frame_size = compressor.compress(data, sizeof(data));
+		ASSERT_GT(frame_size, 0);
+
+		uint8_t out[sizeof(data)];
+		ASSERT_EQ(decompress(compressor.frame(), frame_size, out, sizeof(out)), sizeof(data));
+		EXPECT_EQ(memcmp(data, out, sizeof(data)), 0);
+	}
+}
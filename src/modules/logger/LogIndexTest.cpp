@@ -0,0 +1,102 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "log_index.h"
+
+using namespace px4::logger;
+
+TEST(LogIndex, Interval)
+{
+	LogIndex index;
+	index.reset();
+
+	// 0.5s updates with the initial 1s interval: every other one is added
+	for (int i = 0; i < 10; ++i) {
+		index.update(i * 500000, i * 100);
+	}
+
+	ASSERT_EQ(index.count(), 5);
+
+	for (int i = 0; i < index.count(); ++i) {
+		EXPECT_EQ(index.timestamp(i), (uint64_t)i * 1000000);
+		EXPECT_EQ(index.offset(i), (uint64_t)i * 200);
+	}
+}
+
+TEST(LogIndex, Decimation)
+{
+	LogIndex index;
+	index.reset();
+
+	const hrt_abstime initial_interval = index.interval();
+	const int num_updates = LogIndex::MAX_ENTRIES * 4;
+
+	for (int i = 0; i < num_updates; ++i) {
+		index.update(i * initial_interval, i);
+	}
+
+	EXPECT_LE(index.count(), LogIndex::MAX_ENTRIES);
+	EXPECT_GE(index.count(), LogIndex::MAX_ENTRIES / 2);
+	EXPECT_EQ(index.interval(), initial_interval * 4);
+
+	// the entries are equidistant and cover the whole log
+	EXPECT_EQ(index.timestamp(0), 0u);
+	EXPECT_EQ(index.offset(0), 0u);
+
+	for (int i = 1; i < index.count(); ++i) {
+		EXPECT_EQ(index.timestamp(i) - index.timestamp(i - 1), index.interval());
+		EXPECT_EQ(index.offset(i), index.timestamp(i) / initial_interval);
+	}
+
+	EXPECT_GT(index.timestamp(index.count() - 1), (num_updates - 1 - 4) * initial_interval);
+}
+
+TEST(LogIndex, Reset)
+{
+	LogIndex index;
+	index.reset();
+
+	for (int i = 0; i < LogIndex::MAX_ENTRIES * 2; ++i) {
+		index.update(i * 1000000ull, i);
+	}
+
+	index.reset();
+	EXPECT_EQ(index.count(), 0);
+
+	index.update(5000000, 42);
+	ASSERT_EQ(index.count(), 1);
+	EXPECT_EQ(index.timestamp(0), 5000000u);
+	EXPECT_EQ(index.offset(0), 42u);
+}
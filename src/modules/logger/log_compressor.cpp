@@ -0,0 +1,130 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2018 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "log_compressor.h"
+
+#include <string.h>
+
+namespace px4
+{
+namespace logger
+{
+
+constexpr size_t LogCompressor::max_frame_input_size;
+constexpr size_t LogCompressor::max_frame_size;
+
+ulog_compressed_header_s LogCompressor::file_header()
+{
+	ulog_compressed_header_s header{};
+	header.magic[0] = 'U';
+	header.magic[1] = 'L';
+	header.magic[2] = 'g';
+	header.magic[3] = 'z';
+	header.hdr_ver = 1;
+	header.window_bits = HEATSHRINK_STATIC_WINDOW_BITS;
+	header.lookahead_bits = HEATSHRINK_STATIC_LOOKAHEAD_BITS;
+	return header;
+}
+
+ssize_t LogCompressor::compress(const uint8_t *data, size_t size)
+{
+	if (size == 0 || size > max_frame_input_size) {
+		return -1;
+	}
+
+	heatshrink_encoder_reset(&_hse);
+
+	size_t output_size = sizeof(ulog_compressed_frame_header_s);
+	size_t input_size = 0;
+
+	while (input_size < size) {
+		size_t sunk = 0;
+
+		// the encoder does not modify the input
+		if (heatshrink_encoder_sink(&_hse, const_cast<uint8_t *>(data + input_size), size - input_size, &sunk) < 0) {
+			return -1;
+		}
+
+		input_size += sunk;
+
+		if (!poll(output_size)) {
+			return -1;
+		}
+	}
+
+	HSE_finish_res finish_res;
+
+	while ((finish_res = heatshrink_encoder_finish(&_hse)) == HSER_FINISH_MORE) {
+		if (!poll(output_size)) {
+			return -1;
+		}
+	}
+
+	if (finish_res != HSER_FINISH_DONE) {
+		return -1;
+	}
+
+	ulog_compressed_frame_header_s frame_header;
+	frame_header.compressed_size = output_size - sizeof(frame_header);
+	frame_header.uncompressed_size = size;
+	memcpy(_buffer, &frame_header, sizeof(frame_header));
+
+	return output_size;
+}
+
+bool LogCompressor::poll(size_t &output_size)
+{
+	HSE_poll_res poll_res;
+
+	do {
+		size_t n = 0;
+		poll_res = heatshrink_encoder_poll(&_hse, &_buffer[output_size], max_frame_size - output_size, &n);
+
+		if (poll_res < 0) {
+			return false;
+		}
+
+		output_size += n;
+
+		// cannot happen, the buffer is sized for the worst case
+		if (poll_res == HSER_POLL_MORE && output_size >= max_frame_size) {
+			return false;
+		}
+
+	} while (poll_res == HSER_POLL_MORE);
+
+	return true;
+}
+
+} // namespace logger
+} // namespace px4
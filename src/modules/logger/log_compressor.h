@@ -0,0 +1,93 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2018 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#define HEATSHRINK_DYNAMIC_ALLOC 0
+#include <lib/heatshrink/heatshrink/heatshrink_encoder.h>
+
+#include "messages.h"
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class LogCompressor
+ * Compresses log data with heatshrink into independent frames (see ulog_compressed_frame_header_s).
+ * Every frame can be decompressed on its own, so a truncated log file is readable up to the last complete frame.
+ */
+class LogCompressor
+{
+public:
+	/** maximum number of input bytes per frame */
+	static constexpr size_t max_frame_input_size = 4096;
+
+	LogCompressor() = default;
+	~LogCompressor() = default;
+
+	/**
+	 * Get the file header, to be written to the beginning of the file
+	 */
+	static ulog_compressed_header_s file_header();
+
+	/**
+	 * Compress a frame into the internal buffer
+	 * @param data input data
+	 * @param size input size, at most max_frame_input_size
+	 * @return size of the frame including its header (@see frame()), or -1 on error
+	 */
+	ssize_t compress(const uint8_t *data, size_t size);
+
+	/**
+	 * The last compressed frame
+	 */
+	const uint8_t *frame() const { return _buffer; }
+
+private:
+	bool poll(size_t &output_size);
+
+	/* worst case: every byte is a literal (9 bits) */
+	static constexpr size_t max_frame_size = sizeof(ulog_compressed_frame_header_s) + (max_frame_input_size * 9 + 7) / 8;
+
+	heatshrink_encoder _hse;
+	uint8_t _buffer[max_frame_size];
+};
+
+} // namespace logger
+} // namespace px4
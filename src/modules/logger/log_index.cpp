@@ -0,0 +1,77 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2018 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "log_index.h"
+
+namespace px4
+{
+namespace logger
+{
+
+void LogIndex::reset()
+{
+	_count = 0;
+	_interval = INITIAL_INTERVAL;
+	_next_timestamp = 0;
+}
+
+void LogIndex::update(hrt_abstime timestamp, uint64_t offset)
+{
+	if (timestamp < _next_timestamp) {
+		return;
+	}
+
+	if (_count == MAX_ENTRIES) {
+		// keep every other entry (including the first one), and reduce the rate accordingly
+		for (int i = 1; i < MAX_ENTRIES / 2; ++i) {
+			_timestamps[i] = _timestamps[2 * i];
+			_offsets[i] = _offsets[2 * i];
+		}
+
+		_count = MAX_ENTRIES / 2;
+		_interval *= 2;
+
+		if (timestamp < _timestamps[_count - 1] + _interval) {
+			_next_timestamp = _timestamps[_count - 1] + _interval;
+			return;
+		}
+	}
+
+	_timestamps[_count] = timestamp;
+	_offsets[_count] = offset;
+	++_count;
+	_next_timestamp = timestamp + _interval;
+}
+
+} // namespace logger
+} // namespace px4
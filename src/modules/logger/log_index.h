@@ -0,0 +1,85 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2018 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <drivers/drv_hrt.h>
+
+namespace px4
+{
+namespace logger
+{
+
+/**
+ * @class LogIndex
+ * Time to ULog stream offset index of a log file, written as appendix when the log is closed (@see
+ * Logger::write_index_appendix()), so that readers can seek to a time without parsing the whole log.
+ * The index has a fixed size: when it is full, every other entry is dropped and the interval doubled.
+ */
+class LogIndex
+{
+public:
+	static constexpr int MAX_ENTRIES = 128;
+
+	LogIndex() = default;
+	~LogIndex() = default;
+
+	void reset();
+
+	/**
+	 * Add an entry if the interval since the last entry has passed.
+	 * @param timestamp current time
+	 * @param offset ULog stream offset of a message start (e.g. a sync message) written at timestamp
+	 */
+	void update(hrt_abstime timestamp, uint64_t offset);
+
+	int count() const { return _count; }
+	uint64_t timestamp(int i) const { return _timestamps[i]; }
+	uint64_t offset(int i) const { return _offsets[i]; }
+
+	hrt_abstime interval() const { return _interval; }
+
+private:
+	static constexpr hrt_abstime INITIAL_INTERVAL = 1000000; ///< [us]
+
+	uint64_t _timestamps[MAX_ENTRIES];
+	uint64_t _offsets[MAX_ENTRIES];
+	int _count{0};
+	hrt_abstime _interval{INITIAL_INTERVAL};
+	hrt_abstime _next_timestamp{0};
+};
+
+} // namespace logger
+} // namespace px4
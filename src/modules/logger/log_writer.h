@@ -86,7 +86,7 @@ public:
 	bool is_started(LogType type, Backend query_backend) const;
 
 	/**
-	 * Write a single ulog message (including header). The caller must call lock() before calling this.
+	 * Write a single ulog message (including header).
 	 * @param dropout_start timestamp when lastest dropout occured. 0 if no dropout at the moment.
 	 * @return 0 on success (or if no logging started),
 	 *         -1 if not enough space in the buffer left (file backend), -2 mavlink backend failed
@@ -95,25 +95,53 @@ public:
 	int write_message(LogType type, void *ptr, size_t size, uint64_t dropout_start = 0);
 
 	/**
-	 * Select a backend, so that future calls to write_message() only write to the selected
-	 * sel_backend, until unselect_write_backend() is called.
-	 * @param backend
+	 * Whether data messages can be written with separate header and payload (see write_data_message()), which is
+	 * the case if only the file backend is selected and no reliable transfer is needed.
 	 */
-	void select_write_backend(Backend sel_backend);
-	void unselect_write_backend() { select_write_backend(BackendAll); }
+	bool data_message_zero_copy() const
+	{
+		return _log_writer_file_for_write && !_log_writer_mavlink_for_write
+		       && !_log_writer_file_for_write->need_reliable_transfer();
+	}
 
-	/* file logging methods */
+	/**
+	 * Write a ulog message with separate header and payload to the file backend, copying the payload directly
+	 * from its source into the log buffer. Only valid if data_message_zero_copy() is true.
+	 * Must be followed by commit_last_data_message() or discard_last_data_message().
+	 * @return 0 on success (or if no logging started), -1 if not enough space in the buffer left
+	 */
+	int write_data_message(LogType type, const void *header, size_t header_size, const void *data, size_t data_size,
+			       uint64_t dropout_start = 0)
+	{
+		return _log_writer_file_for_write->write_message(type, header, header_size, data, data_size, dropout_start);
+	}
 
-	void lock()
+	/**
+	 * Hand the last message written with write_data_message() to the writer thread.
+	 */
+	void commit_last_data_message(LogType type)
 	{
-		if (_log_writer_file) { _log_writer_file->lock(); }
+		_log_writer_file_for_write->commit_last_message(type);
 	}
 
-	void unlock()
+	/**
+	 * Remove the last message written with write_data_message() again.
+	 */
+	void discard_last_data_message(LogType type)
 	{
-		if (_log_writer_file) { _log_writer_file->unlock(); }
+		_log_writer_file_for_write->discard_last_message(type);
 	}
 
+	/**
+	 * Select a backend, so that future calls to write_message() only write to the selected
+	 * sel_backend, until unselect_write_backend() is called.
+	 * @param backend
+	 */
+	void select_write_backend(Backend sel_backend);
+	void unselect_write_backend() { select_write_backend(BackendAll); }
+
+	/* file logging methods */
+
 	void notify()
 	{
 		if (_log_writer_file) { _log_writer_file->notify(); }
@@ -126,6 +154,18 @@ public:
 		return 0;
 	}
 
+	uint64_t get_stream_offset_file(LogType type) const
+	{
+		if (_log_writer_file) { return _log_writer_file->get_stream_offset(type); }
+
+		return 0;
+	}
+
+	void set_appended_data_offset_file(LogType type, uint64_t offset)
+	{
+		if (_log_writer_file) { _log_writer_file->set_appended_data_offset(type, offset); }
+	}
+
 	size_t get_buffer_size_file(LogType type) const
 	{
 		if (_log_writer_file) { return _log_writer_file->get_buffer_size(type); }
@@ -168,6 +208,18 @@ public:
 		return false;
 	}
 
+	void set_file_preallocation(LogType type, size_t size)
+	{
+		if (_log_writer_file) { _log_writer_file->set_preallocation(type, size); }
+	}
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	void set_file_compression(bool enable)
+	{
+		if (_log_writer_file) { _log_writer_file->set_compression(enable); }
+	}
+#endif // CONFIG_LOGGER_COMPRESSION
+
 #if defined(PX4_CRYPTO)
 	void set_encryption_parameters(px4_crypto_algorithm_t algorithm, uint8_t key_idx,  uint8_t exchange_key_idx)
 	{
@@ -35,6 +35,7 @@
 #include "messages.h"
 
 #include <fcntl.h>
+#include <stddef.h>
 #include <string.h>
 #include <errno.h>
 
@@ -59,19 +60,23 @@ namespace px4
 namespace logger
 {
 constexpr size_t LogWriterFile::_min_write_chunk;
+constexpr size_t LogWriterFile::_min_available[(int)LogType::Count];
 
 LogWriterFile::LogWriterFile(size_t buffer_size)
 	: _buffers{
 	//We always write larger chunks (orb messages) to the buffer, so the buffer
-	//needs to be larger than the minimum write chunk (300 is somewhat arbitrary)
+	//needs to be larger than the minimum write chunk (300 is somewhat arbitrary).
+	//File writes are aligned to the write chunk (FAT cluster)
 	{
 		buffer_size,
 		_min_write_chunk + 300,
+		_min_write_chunk,
 		perf_alloc(PC_ELAPSED, "logger_sd_write"), perf_alloc(PC_ELAPSED, "logger_sd_fsync")},
 
 	{
 		300, // buffer size for the mission log (can be kept fairly small)
 		1,
+		1,
 		perf_alloc(PC_ELAPSED, "logger_sd_write_mission"), perf_alloc(PC_ELAPSED, "logger_sd_fsync_mission")}
 }
 {
@@ -88,7 +93,41 @@ LogWriterFile::~LogWriterFile()
 {
 	pthread_mutex_destroy(&_mtx);
 	pthread_cond_destroy(&_cv);
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	delete _compressor;
+#endif // CONFIG_LOGGER_COMPRESSION
+}
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+bool LogWriterFile::init_logfile_compression()
+{
+	if (_compressor == nullptr) {
+		_compressor = new LogCompressor();
+
+		if (_compressor == nullptr) {
+			PX4_ERR("alloc failed");
+			return false;
+		}
+	}
+
+	int fd = _buffers[(int)LogType::Full].fd();
+
+	if (fd < 0) {
+		return false;
+	}
+
+	// write the container header to the beginning of the log file
+	const ulog_compressed_header_s header = LogCompressor::file_header();
+
+	if (::write(fd, &header, sizeof(header)) != (ssize_t)sizeof(header)) {
+		PX4_ERR("Writing the compression header failed (%i)", errno);
+		return false;
+	}
+
+	return true;
 }
+#endif // CONFIG_LOGGER_COMPRESSION
 
 #if defined(PX4_CRYPTO)
 bool LogWriterFile::init_logfile_encryption(const LogType type)
@@ -217,7 +256,33 @@ bool LogWriterFile::start_log(LogType type, const char *filename)
 		}
 	}
 
-	if (_buffers[(int)type].start_log(filename)) {
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	// the writer thread does not access the full log state while the file is closed
+	if (type == LogType::Full) {
+		_compress = _compression_enabled;
+	}
+
+#endif // CONFIG_LOGGER_COMPRESSION
+
+	lock();
+	const bool started = _buffers[(int)type].start_log(filename, _preallocate_size[(int)type]);
+	unlock();
+
+	if (started) {
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+		if (type == LogType::Full && _compress && !init_logfile_compression()) {
+			PX4_ERR("Failed to start compressed logging");
+			lock();
+			_buffers[(int)type]._should_run.store(false);
+			_buffers[(int)type].close_file();
+			_buffers[(int)type].reset();
+			unlock();
+			return false;
+		}
+
+#endif // CONFIG_LOGGER_COMPRESSION
 
 #if PX4_CRYPTO
 		bool enc_init = init_logfile_encryption(type);
@@ -225,9 +290,11 @@ bool LogWriterFile::start_log(LogType type, const char *filename)
 		if (!enc_init) {
 			PX4_ERR("Failed to start encrypted logging");
 			_crypto.close();
-			_buffers[(int)type]._should_run = false;
+			lock();
+			_buffers[(int)type]._should_run.store(false);
 			_buffers[(int)type].close_file();
 			_buffers[(int)type].reset();
+			unlock();
 			return false;
 		}
 
@@ -273,16 +340,53 @@ int LogWriterFile::hardfault_store_filename(const char *log_file)
 	return 0;
 }
 
+void LogWriterFile::set_appended_data_offset(LogType type, uint64_t offset)
+{
+	// file offsets only match the ULog stream offsets for plain files
+#if defined(PX4_CRYPTO)
+
+	if (_algorithm != CRYPTO_NONE) {
+		return;
+	}
+
+#endif // PX4_CRYPTO
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (type == LogType::Full && _compress) {
+		return;
+	}
+
+#endif // CONFIG_LOGGER_COMPRESSION
+
+	_buffers[(int)type].set_appended_data_offset(offset);
+}
+
 void LogWriterFile::stop_log(LogType type)
 {
 	lock();
-	_buffers[(int)type]._should_run = false;
+	_buffers[(int)type]._should_run.store(false);
 	unlock();
 	notify();
 }
 
 int LogWriterFile::thread_start()
 {
+#if defined(CONFIG_LOGGER_PARALLEL_WRITERS) && !defined(PX4_CRYPTO)
+	// one thread per log type (the crypto session cannot be shared between threads)
+	_num_threads = (int)LogType::Count;
+
+	for (int i = 0; i < _num_threads; ++i) {
+		_threads[i].first_type = i;
+		_threads[i].last_type = i;
+	}
+
+#else
+	_num_threads = 1;
+	_threads[0].first_type = 0;
+	_threads[0].last_type = (int)LogType::Count - 1;
+#endif
+
 	pthread_attr_t thr_attr;
 	pthread_attr_init(&thr_attr);
 
@@ -297,9 +401,24 @@ int LogWriterFile::thread_start()
 	pthread_attr_setstacksize(&thr_attr, PX4_STACK_ADJUSTED(1170));
 #endif
 
-	int ret = pthread_create(&_thread, &thr_attr, &LogWriterFile::run_helper, this);
+	int ret = 0;
+
+	for (int i = 0; i < _num_threads && ret == 0; ++i) {
+		_threads[i].writer = this;
+		ret = pthread_create(&_threads[i].thread, &thr_attr, &LogWriterFile::run_helper, &_threads[i]);
+
+		if (ret != 0) {
+			// only join the threads that got started
+			_num_threads = i;
+		}
+	}
+
 	pthread_attr_destroy(&thr_attr);
 
+	if (ret != 0 && _num_threads > 0) {
+		thread_stop();
+	}
+
 	return ret;
 }
 
@@ -308,28 +427,37 @@ void LogWriterFile::thread_stop()
 	// this will terminate the main loop of the writer thread
 	lock();
 	_exit_thread.store(true);
-	_buffers[0]._should_run = _buffers[1]._should_run = false;
+	_buffers[0]._should_run.store(false);
+	_buffers[1]._should_run.store(false);
 	unlock();
 
 	notify();
 
-	// wait for thread to complete
-	int ret = pthread_join(_thread, nullptr);
+	// wait for the threads to complete
+	for (int i = 0; i < _num_threads; ++i) {
+		int ret = pthread_join(_threads[i].thread, nullptr);
 
-	if (ret) {
-		PX4_WARN("join failed: %d", ret);
+		if (ret) {
+			PX4_WARN("join failed: %d", ret);
+		}
 	}
+
+	_num_threads = 0;
 }
 
 void *LogWriterFile::run_helper(void *context)
 {
-	px4_prctl(PR_SET_NAME, "log_writer_file", px4_getpid());
+	WriterThread *thread = static_cast<WriterThread *>(context);
+
+	// a separate mission log thread only exists with CONFIG_LOGGER_PARALLEL_WRITERS
+	const bool mission_only = thread->first_type == (int)LogType::Mission && thread->last_type == (int)LogType::Mission;
+	px4_prctl(PR_SET_NAME, mission_only ? "log_writer_mis" : "log_writer_file", px4_getpid());
 
-	static_cast<LogWriterFile *>(context)->run();
+	thread->writer->run(thread->first_type, thread->last_type);
 	return nullptr;
 }
 
-void LogWriterFile::run()
+void LogWriterFile::run(int first_type, int last_type)
 {
 	while (!_exit_thread.load()) {
 		// Outer endless loop
@@ -338,7 +466,11 @@ void LogWriterFile::run()
 			bool start = false;
 			pthread_mutex_lock(&_mtx);
 			pthread_cond_wait(&_cv, &_mtx);
-			start = _buffers[0]._should_run || _buffers[1]._should_run;
+
+			for (int i = first_type; i <= last_type; ++i) {
+				start = start || _buffers[i]._should_run.load();
+			}
+
 			pthread_mutex_unlock(&_mtx);
 
 			if (start) {
@@ -368,18 +500,21 @@ void LogWriterFile::run()
 				poll_count = 0;
 			}
 
-			constexpr size_t min_available[(int)LogType::Count] = {
-				_min_write_chunk,
-				1 // For the mission log, write as soon as there is data available
-			};
-
 			/* Check all buffers for available data. Mission log is first to avoid drops */
-			int i = (int)LogType::Count - 1;
+			int i = last_type;
 
-			while (i >= 0) {
+			while (i >= first_type) {
 				void *read_ptr;
 				bool is_part;
 				LogFileBuffer &buffer = _buffers[i];
+
+				if (buffer.fd() < 0) {
+					// closed, remaining data is dropped when the next log is started
+					--i;
+					continue;
+				}
+
+				const bool should_run = buffer._should_run.load();
 				size_t available = buffer.get_read_ptr(&read_ptr, &is_part);
 
 #if defined(PX4_CRYPTO)
@@ -387,8 +522,22 @@ void LogWriterFile::run()
 				available = (available / _min_blocksize) * _min_blocksize;
 #endif // PX4_CRYPTO
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+				if (i == (int)LogType::Full && _compress) {
+					// one compressed frame per write
+					available = math::min(available, LogCompressor::max_frame_input_size);
+				}
+
+#endif // CONFIG_LOGGER_COMPRESSION
+
+				if (should_run) {
+					// keep the file offset aligned, the remainder is written with the next chunk
+					available = buffer.aligned_write_size(available);
+				}
+
 				/* if sufficient data available or partial read or terminating, write data */
-				if (available >= min_available[i] || is_part || (!buffer._should_run && available > 0)) {
+				if (available >= _min_available[i] || is_part || (!should_run && available > 0)) {
 					pthread_mutex_unlock(&_mtx);
 
 #if defined(PX4_CRYPTO)
@@ -417,13 +566,13 @@ void LogWriterFile::run()
 
 #endif // PX4_CRYPTO
 
-					int written = buffer.write_to_file(read_ptr, available, call_fsync);
+					int written = write_chunk((LogType)i, read_ptr, available, call_fsync);
 
 					if (written < 0) {
 						// retry once
 						PX4_ERR("write failed errno:%i (%s), retrying", errno, strerror(errno));
 						px4_usleep(10000); // 10 milliseconds
-						written = buffer.write_to_file(read_ptr, available, call_fsync);
+						written = write_chunk((LogType)i, read_ptr, available, call_fsync);
 					}
 
 					/* buffer.mark_read() requires _mtx to be locked */
@@ -433,7 +582,7 @@ void LogWriterFile::run()
 						/* subtract bytes written from number in buffer (count -= written) */
 						buffer.mark_read(written);
 
-						if (!buffer._should_run && written == static_cast<int>(available) && !is_part) {
+						if (!should_run && written == static_cast<int>(available) && !is_part) {
 							/* Stop only when all data written */
 							pthread_mutex_unlock(&_mtx);
 							buffer.close_file();
@@ -444,19 +593,19 @@ void LogWriterFile::run()
 					} else {
 						PX4_ERR("write failed (%i)", errno);
 						buffer._had_write_error.store(true);
-						buffer._should_run = false;
+						buffer._should_run.store(false);
 						pthread_mutex_unlock(&_mtx);
 						buffer.close_file();
 						pthread_mutex_lock(&_mtx);
 						buffer.reset();
 					}
 
-				} else if (call_fsync && buffer._should_run) {
+				} else if (call_fsync && should_run) {
 					pthread_mutex_unlock(&_mtx);
 					buffer.fsync();
 					pthread_mutex_lock(&_mtx);
 
-				} else if (available == 0 && !buffer._should_run) {
+				} else if (available == 0 && !should_run) {
 					pthread_mutex_unlock(&_mtx);
 					buffer.close_file();
 					pthread_mutex_lock(&_mtx);
@@ -470,8 +619,16 @@ void LogWriterFile::run()
 			}
 
 
-			if (_buffers[0].fd() < 0 && _buffers[1].fd() < 0) {
-				// stop when both files are closed
+			bool all_closed = true;
+			bool any_running = false;
+
+			for (int type = first_type; type <= last_type; ++type) {
+				all_closed = all_closed && _buffers[type].fd() < 0;
+				any_running = any_running || _buffers[type]._should_run.load();
+			}
+
+			if (all_closed) {
+				// stop when all files are closed
 #if defined(PX4_CRYPTO)
 				/* close the crypto session */
 
@@ -481,14 +638,11 @@ void LogWriterFile::run()
 				break;
 			}
 
-			/* Wait for a call to notify(), which indicates new data is available.
-			 * Note that at this point there could already be new data available (because of a longer write),
-			 * and calling pthread_cond_wait() will still wait for the next notify(). But this is generally
-			 * not an issue because notify() is called regularly.
+			/* Wait until there is enough data to write (the logger wakes us up when crossing the threshold).
 			 * If the logger was switched off in the meantime, do not wait for data, instead run this loop
 			 * once more to write remaining data and close the file. */
-			if (_buffers[0]._should_run || _buffers[1]._should_run) {
-				pthread_cond_wait(&_cv, &_mtx);
+			if (any_running) {
+				wait_for_data(first_type, last_type);
 			}
 		}
 
@@ -497,6 +651,39 @@ void LogWriterFile::run()
 	}
 }
 
+int LogWriterFile::write_chunk(LogType type, void *ptr, size_t size, bool call_fsync)
+{
+	LogFileBuffer &buffer = _buffers[(int)type];
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+
+	if (type == LogType::Full && _compress) {
+		const ssize_t frame_size = _compressor->compress(static_cast<const uint8_t *>(ptr), size);
+
+		if (frame_size < 0) {
+			PX4_ERR("log compression failed");
+			return -1;
+		}
+
+		const ssize_t written = buffer.write_to_file(_compressor->frame(), frame_size, call_fsync);
+
+		if (written != frame_size) {
+			// frames are only valid as a whole: drop a partially written frame, so it can be written again
+			if (written > 0) {
+				lseek(buffer.fd(), -written, SEEK_CUR);
+			}
+
+			return -1;
+		}
+
+		return size;
+	}
+
+#endif // CONFIG_LOGGER_COMPRESSION
+
+	return buffer.write_to_file(ptr, size, call_fsync);
+}
+
 int LogWriterFile::write_message(LogType type, void *ptr, size_t size, uint64_t dropout_start)
 {
 	if (_need_reliable_transfer) {
@@ -505,10 +692,8 @@ int LogWriterFile::write_message(LogType type, void *ptr, size_t size, uint64_t
 		// if there's a dropout, write it first (because we might split the message)
 		if (dropout_start) {
 			while ((ret = write(type, ptr, 0, dropout_start)) == -1) {
-				unlock();
 				notify();
 				px4_usleep(3000);
-				lock();
 			}
 		}
 
@@ -519,10 +704,8 @@ int LogWriterFile::write_message(LogType type, void *ptr, size_t size, uint64_t
 			size_t write_size = math::min(size, _buffers[(int)type].buffer_size());
 
 			while ((ret = write(type, uptr, write_size, 0)) == -1) {
-				unlock();
 				notify();
 				px4_usleep(3000);
-				lock();
 			}
 
 			uptr += write_size;
@@ -535,7 +718,26 @@ int LogWriterFile::write_message(LogType type, void *ptr, size_t size, uint64_t
 	return write(type, ptr, size, dropout_start);
 }
 
-int LogWriterFile::write(LogType type, void *ptr, size_t size, uint64_t dropout_start)
+int LogWriterFile::write_message(LogType type, const void *header, size_t header_size, const void *data,
+				 size_t data_size, uint64_t dropout_start)
+{
+	return write(type, header, header_size, dropout_start, data, data_size, false);
+}
+
+void LogWriterFile::commit_last_message(LogType type)
+{
+	if (_buffers[(int)type].commit(_min_available[(int)type])) {
+		notify();
+	}
+}
+
+void LogWriterFile::discard_last_message(LogType type)
+{
+	_buffers[(int)type].discard();
+}
+
+int LogWriterFile::write(LogType type, const void *ptr, size_t size, uint64_t dropout_start,
+			 const void *data, size_t data_size, bool commit)
 {
 	if (!is_started(type)) {
 		return 0;
@@ -549,22 +751,66 @@ int LogWriterFile::write(LogType type, void *ptr, size_t size, uint64_t dropout_
 		dropout_size = sizeof(ulog_message_dropout_s);
 	}
 
-	if (size + dropout_size > available) {
+	if (size + data_size + dropout_size > available) {
 		// buffer overflow
 		return -1;
 	}
 
+	LogFileBuffer &buffer = _buffers[(int)type];
+	bool wakeup = false;
+
 	if (dropout_start) {
-		//write dropout msg
+		//write dropout msg (committed right away, it must be kept even if the message is discarded)
 		ulog_message_dropout_s dropout_msg;
 		dropout_msg.duration = (uint16_t)(hrt_elapsed_time(&dropout_start) / 1000);
-		_buffers[(int)type].write_no_check(&dropout_msg, sizeof(dropout_msg));
+		buffer.write_no_check(&dropout_msg, sizeof(dropout_msg));
+		wakeup = buffer.commit(_min_available[(int)type]);
+	}
+
+	buffer.write_no_check(ptr, size);
+
+	if (data_size > 0) {
+		buffer.write_no_check(data, data_size);
+	}
+
+	if (commit && buffer.commit(_min_available[(int)type])) {
+		wakeup = true;
+	}
+
+	if (wakeup) {
+		notify();
 	}
 
-	_buffers[(int)type].write_no_check(ptr, size);
 	return 0;
 }
 
+void LogWriterFile::wait_for_data(int first_type, int last_type)
+{
+	// do not wait if there is already enough data, e.g. written during a longer write while we were not waiting
+	for (int i = first_type; i <= last_type; ++i) {
+		size_t min_available = _min_available[i];
+#if defined(PX4_CRYPTO)
+		// only full blocks are written
+		min_available = math::max(min_available, (size_t)_min_blocksize);
+#endif // PX4_CRYPTO
+
+		if (_buffers[i].fd() >= 0 && _buffers[i].count() >= min_available) {
+			return;
+		}
+	}
+
+	// wait at most _max_wait_us, so fsync is called regularly
+	struct timespec ts;
+	px4_clock_gettime(CLOCK_REALTIME, &ts);
+	uint64_t nsecs = ts.tv_nsec + (_max_wait_us * 1000ull);
+	static constexpr unsigned billion = (1000 * 1000 * 1000);
+	ts.tv_sec += nsecs / billion;
+	nsecs -= (nsecs / billion) * billion;
+	ts.tv_nsec = nsecs;
+
+	px4_pthread_cond_timedwait(&_cv, &_mtx, &ts);
+}
+
 const char *log_type_str(LogType type)
 {
 	switch (type) {
@@ -579,9 +825,10 @@ const char *log_type_str(LogType type)
 }
 
 LogWriterFile::LogFileBuffer::LogFileBuffer(size_t log_buffer_desired_size, size_t log_buffer_min_size,
-		perf_counter_t perf_write, perf_counter_t perf_fsync) :
+		size_t write_alignment, perf_counter_t perf_write, perf_counter_t perf_fsync) :
 	_buffer_size(log_buffer_desired_size),
 	_buffer_size_min(log_buffer_min_size),
+	_write_alignment(write_alignment),
 	_perf_write(perf_write),
 	_perf_fsync(perf_fsync)
 {
@@ -599,11 +846,11 @@ LogWriterFile::LogFileBuffer::~LogFileBuffer()
 	perf_free(_perf_fsync);
 }
 
-void LogWriterFile::LogFileBuffer::write_no_check(void *ptr, size_t size)
+void LogWriterFile::LogFileBuffer::write_no_check(const void *ptr, size_t size)
 {
 	size_t n = _buffer_size - _head;	// bytes to end of the buffer
 
-	uint8_t *buffer_c = static_cast<uint8_t *>(ptr);
+	const uint8_t *buffer_c = static_cast<const uint8_t *>(ptr);
 
 	if (size > n) {
 		// Message goes over the end of the buffer
@@ -619,37 +866,49 @@ void LogWriterFile::LogFileBuffer::write_no_check(void *ptr, size_t size)
 
 	memcpy(&(_buffer[_head]), &(buffer_c[n]), p);
 	_head = (_head + p) % _buffer_size;
-	_count += size;
+	_pending += size;
 }
 
 size_t LogWriterFile::LogFileBuffer::get_read_ptr(void **ptr, bool *is_part)
 {
 	// bytes available to read
-	int read_ptr = _head - _count;
+	const size_t count = _count.load();
+	*ptr = &_buffer[_tail];
 
-	if (read_ptr < 0) {
-		read_ptr += _buffer_size;
-		*ptr = &_buffer[read_ptr];
+	if (_tail + count > _buffer_size) {
 		*is_part = true;
-		return _buffer_size - read_ptr;
+		return _buffer_size - _tail;
 
 	} else {
-		*ptr = &_buffer[read_ptr];
 		*is_part = false;
-		return _count;
+		return count;
 	}
 }
 
-bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
+bool LogWriterFile::LogFileBuffer::start_log(const char *filename, size_t preallocate_size)
 {
 	_fd = ::open(filename, O_CREAT | O_WRONLY, PX4_O_MODE_666);
 	_had_write_error.store(false);
+	_preallocated = false;
 
 	if (_fd < 0) {
 		PX4_ERR("Can't open log file %s, errno: %d", filename, errno);
 		return false;
 	}
 
+	if (preallocate_size > 0) {
+#if defined(__PX4_LINUX)
+		// reserve the extents without changing the file size, unused space is released in close_file()
+		if (fallocate(_fd, FALLOC_FL_KEEP_SIZE, 0, preallocate_size) == 0) {
+			_preallocated = true;
+
+		} else {
+			PX4_DEBUG("log file preallocation failed (%i)", errno);
+		}
+
+#endif // __PX4_LINUX
+	}
+
 	if (_buffer == nullptr) {
 		_buffer_size = math::max(_buffer_size, _buffer_size_min);
 
@@ -670,6 +929,9 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 
 #endif // __PX4_NUTTX
 
+		// a multiple of the write alignment, so that the wrap around keeps file writes aligned
+		_buffer_size = math::max(_buffer_size / _write_alignment, (size_t)2) * _write_alignment;
+
 		_buffer = (uint8_t *) px4_cache_aligned_alloc(_buffer_size);
 
 		if (_buffer == nullptr) {
@@ -682,10 +944,14 @@ bool LogWriterFile::LogFileBuffer::start_log(const char *filename)
 
 	// Clear buffer and counters
 	_head = 0;
-	_count = 0;
-	_total_written = 0;
+	_pending = 0;
+	_stream_offset = 0;
+	_appended_data_offset = 0;
+	_tail = 0;
+	_count.store(0);
+	_total_written.store(0);
 
-	_should_run = true;
+	_should_run.store(true);
 
 	return true;
 }
@@ -710,24 +976,61 @@ ssize_t LogWriterFile::LogFileBuffer::write_to_file(const void *buffer, size_t s
 	return ret;
 }
 
+void LogWriterFile::LogFileBuffer::mark_appended_data()
+{
+	// same as the hardfault handler, which can append more data later on (using the next free offset)
+	static constexpr off_t flags_offset = sizeof(ulog_file_header_s) + offsetof(ulog_message_flag_bits_s, incompat_flags);
+	static constexpr off_t appended_offsets_offset = sizeof(ulog_file_header_s) + offsetof(ulog_message_flag_bits_s,
+			appended_offsets);
+
+	uint8_t incompat_flags0;
+	const uint64_t appended_offset = _appended_data_offset;
+
+	if (pread(_fd, &incompat_flags0, sizeof(incompat_flags0), flags_offset) != sizeof(incompat_flags0)) {
+		PX4_WARN("reading flag bits failed (%i)", errno);
+		return;
+	}
+
+	incompat_flags0 |= ULOG_INCOMPAT_FLAG0_DATA_APPENDED_MASK;
+
+	if (pwrite(_fd, &incompat_flags0, sizeof(incompat_flags0), flags_offset) != sizeof(incompat_flags0) ||
+	    pwrite(_fd, &appended_offset, sizeof(appended_offset), appended_offsets_offset) != sizeof(appended_offset)) {
+		PX4_WARN("writing flag bits failed (%i)", errno);
+	}
+}
+
 void LogWriterFile::LogFileBuffer::close_file()
 {
 	if (_fd >= 0) {
+		if (_appended_data_offset > 0 && !_had_write_error.load()) {
+			mark_appended_data();
+		}
+		if (_preallocated) {
+			// release the reserved but unused extents (the file size differs from the buffer data size
+			// with a file header or compression)
+			const off_t file_size = lseek(_fd, 0, SEEK_CUR);
+
+			if (file_size < 0 || ftruncate(_fd, file_size) != 0) {
+				PX4_WARN("log file trim failed (%i)", errno);
+			}
+
+			_preallocated = false;
+		}
+
 		int res = close(_fd);
 
 		if (res) {
 			PX4_WARN("closing log file failed (%i)", errno);
 
 		} else {
-			PX4_INFO("closed logfile, bytes written: %zu", _total_written);
+			PX4_INFO("closed logfile, bytes written: %zu", _total_written.load());
 		}
 	}
 }
 
 void LogWriterFile::LogFileBuffer::reset()
 {
-	_head = 0;
-	_count = 0;
+	// the logger thread might still be writing, the buffer content is cleared in start_log()
 	_fd = -1;
 }
 
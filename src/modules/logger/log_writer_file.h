@@ -44,6 +44,10 @@
 # include <px4_platform_common/crypto.h>
 #endif // PX4_CRYPTO
 
+#if defined(CONFIG_LOGGER_COMPRESSION)
+# include "log_compressor.h"
+#endif // CONFIG_LOGGER_COMPRESSION
+
 namespace px4
 {
 namespace logger
@@ -65,6 +69,13 @@ const char *log_type_str(LogType type);
 /**
  * @class LogWriterFile
  * Writes logging data to a file
+ *
+ * The logger thread writes into a lock-free single-producer/single-consumer ring buffer per log type, the
+ * writer thread drains it to the file. The writer is only woken up when the buffer fill level crosses the write
+ * threshold, so the logger never waits for file I/O (e.g. SD card stalls). _mtx only protects the start/stop state.
+ *
+ * With CONFIG_LOGGER_PARALLEL_WRITERS every log type has its own writer thread (and file), so that the file
+ * writes of the different logs do not limit each other. Otherwise a single thread writes all files.
  */
 class LogWriterFile
 {
@@ -75,7 +86,7 @@ public:
 	bool init();
 
 	/**
-	 * start the thread
+	 * start the writer thread(s)
 	 * @return 0 on success, error number otherwise (@see pthread_create)
 	 */
 	int thread_start();
@@ -84,26 +95,55 @@ public:
 
 	bool start_log(LogType type, const char *filename);
 
+	/**
+	 * Set the size to preallocate for the next log file of a type (where supported), 0 to disable.
+	 * Reserving the file extents upfront avoids allocation stalls while logging.
+	 */
+	void set_preallocation(LogType type, size_t size) { _preallocate_size[(int)type] = size; }
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	/**
+	 * Enable compression for the next full log file. The data is compressed by the writer thread.
+	 */
+	void set_compression(bool enable) { _compression_enabled = enable; }
+#endif // CONFIG_LOGGER_COMPRESSION
+
 	void stop_log(LogType type);
 
-	bool is_started(LogType type) const { return _buffers[(int)type]._should_run; }
+	bool is_started(LogType type) const { return _buffers[(int)type]._should_run.load(); }
 
 	/** @see LogWriter::write_message() */
 	int write_message(LogType type, void *ptr, size_t size, uint64_t dropout_start = 0);
 
-	void lock()
-	{
-		pthread_mutex_lock(&_mtx);
-	}
+	/**
+	 * Write a ulog message given as separate header and payload, so the payload can be copied into the buffer
+	 * directly from its source (e.g. a uORB queue slot). Never blocks, so it must not be used while a reliable
+	 * transfer is needed.
+	 * The message is not handed to the writer thread until commit_last_message() is called.
+	 * @return 0 on success (or if logging is not started), -1 if not enough space in the buffer left
+	 */
+	int write_message(LogType type, const void *header, size_t header_size, const void *data, size_t data_size,
+			  uint64_t dropout_start = 0);
 
-	void unlock()
-	{
-		pthread_mutex_unlock(&_mtx);
-	}
+	/**
+	 * Hand the message of the last write_message() call with separate payload to the writer thread.
+	 */
+	void commit_last_message(LogType type);
 
+	/**
+	 * Remove the message of the last write_message() call with separate payload from the buffer again,
+	 * e.g. because the payload source was overwritten while copying.
+	 */
+	void discard_last_message(LogType type);
+
+	/**
+	 * Wake up the writer thread, e.g. after a state change. Data writes wake it up by themselves when needed.
+	 */
 	void notify()
 	{
+		pthread_mutex_lock(&_mtx);
 		pthread_cond_broadcast(&_cv);
+		pthread_mutex_unlock(&_mtx);
 	}
 
 	size_t get_total_written(LogType type) const
@@ -111,6 +151,22 @@ public:
 		return _buffers[(int)type].total_written();
 	}
 
+	/**
+	 * Get the number of bytes written to the log so far, which is the offset of the next message in the ULog
+	 * stream (called by the logger thread only)
+	 */
+	uint64_t get_stream_offset(LogType type) const
+	{
+		return _buffers[(int)type].stream_offset();
+	}
+
+	/**
+	 * Set the ULog stream offset of data appended at the end of the log. When the file is closed, the offset is
+	 * stored in the ULog flag bits message and the appended data flag is set (only for plain files, i.e. not
+	 * encrypted or compressed). Must be called before stop_log().
+	 */
+	void set_appended_data_offset(LogType type, uint64_t offset);
+
 	size_t get_buffer_size(LogType type) const
 	{
 		return _buffers[(int)type].buffer_size();
@@ -137,7 +193,8 @@ public:
 
 	bool had_write_error() const { return _buffers[(int)LogType::Full]._had_write_error.load(); }
 
-	pthread_t thread_id() const { return _thread; }
+	/** the thread writing the full log */
+	pthread_t thread_id() const { return _threads[0].thread; }
 
 #if defined(PX4_CRYPTO)
 	void set_encryption_parameters(px4_crypto_algorithm_t algorithm, uint8_t key_idx,  uint8_t exchange_key_idx)
@@ -151,7 +208,20 @@ public:
 private:
 	static void *run_helper(void *);
 
-	void run();
+	void lock()
+	{
+		pthread_mutex_lock(&_mtx);
+	}
+
+	void unlock()
+	{
+		pthread_mutex_unlock(&_mtx);
+	}
+
+	/**
+	 * Writer thread main loop, writing the buffers of log types [first_type, last_type]
+	 */
+	void run(int first_type, int last_type);
 
 	/**
 	 * permanently store the ulog file name for the hardfault crash handler, so that it can
@@ -161,36 +231,101 @@ private:
 	 */
 	int hardfault_store_filename(const char *log_file);
 
+	/**
+	 * Write a chunk of buffer data to the file (called by the writer thread only)
+	 * @return number of bytes consumed from ptr, <0 on error
+	 */
+	int write_chunk(LogType type, void *ptr, size_t size, bool call_fsync);
+
 	/**
 	 * write w/o waiting/blocking
 	 */
-	int write(LogType type, void *ptr, size_t size, uint64_t dropout_start);
+	int write(LogType type, const void *ptr, size_t size, uint64_t dropout_start,
+		  const void *data = nullptr, size_t data_size = 0, bool commit = true);
+
+	/**
+	 * Wait for a notify() or until there is enough data to write in one of the buffers of log types
+	 * [first_type, last_type]. Requires _mtx to be locked.
+	 */
+	void wait_for_data(int first_type, int last_type);
 
 	/* 512 didn't seem to work properly, 4096 should match the FAT cluster size */
 	static constexpr size_t	_min_write_chunk = 4096;
 
+	/* fill level at which the writer thread writes to the file (and gets woken up) */
+	static constexpr size_t _min_available[(int)LogType::Count] = {
+		_min_write_chunk,
+		1 // For the mission log, write as soon as there is data available
+	};
+
+	/* the writer thread wakes up at least this often (e.g. for fsync) even without enough data */
+	static constexpr uint32_t _max_wait_us = 500000;
+
 	class LogFileBuffer
 	{
 	public:
-		LogFileBuffer(size_t log_buffer_desired_size, size_t log_buffer_min_size,
+		LogFileBuffer(size_t log_buffer_desired_size, size_t log_buffer_min_size, size_t write_alignment,
 			      perf_counter_t perf_write, perf_counter_t perf_fsync);
 
 		~LogFileBuffer();
 
-		bool start_log(const char *filename);
+		/**
+		 * @param preallocate_size file size to reserve, 0 to disable
+		 */
+		bool start_log(const char *filename, size_t preallocate_size);
 
 		void close_file();
 
+		/**
+		 * Store _appended_data_offset in the ULog flag bits message of the file
+		 */
+		void mark_appended_data();
+
 		void reset();
 
+		/**
+		 * Get the data to write to the file (called by the writer thread only)
+		 */
 		size_t get_read_ptr(void **ptr, bool *is_part);
 
 		/**
-		 * Write to the buffer but assuming there is enough space
+		 * Reduce the number of bytes to write, so that the file offset after the write is aligned to the write
+		 * alignment (called by the writer thread only)
+		 */
+		size_t aligned_write_size(size_t available) const
+		{
+			return available - (_total_written.load() + available) % _write_alignment;
+		}
+
+		/**
+		 * Write to the buffer but assuming there is enough space. The data is not readable
+		 * by the writer thread until commit() is called (called by the logger thread only).
+		 */
+		inline void write_no_check(const void *ptr, size_t size);
+
+		/**
+		 * Make all written data available to the writer thread
+		 * @return true if the fill level crossed the given threshold
+		 */
+		bool commit(size_t threshold)
+		{
+			if (_pending == 0) {
+				return false;
+			}
+
+			const size_t count = _count.fetch_add(_pending);
+			const size_t count_new = count + _pending;
+			_stream_offset += _pending;
+			_pending = 0;
+			return count < threshold && count_new >= threshold;
+		}
+
+		/**
+		 * Remove the data written since the last commit() again
 		 */
-		inline void write_no_check(void *ptr, size_t size);
+		void discard() { _head = (_head + _buffer_size - _pending) % _buffer_size; _pending = 0; }
 
-		size_t available() const { return _buffer_size - _count; }
+		size_t available() const { return _buffer_size - _count.load() - _pending; }
 
 		int fd() const { return _fd; }
 
@@ -198,34 +333,69 @@ private:
 
 		inline void fsync() const;
 
-		void mark_read(size_t n) { _count -= n; _total_written += n; }
+		/**
+		 * Release data written to the file to the logger thread (called by the writer thread only)
+		 */
+		void mark_read(size_t n)
+		{
+			_tail = (_tail + n) % _buffer_size;
+			_total_written.store(_total_written.load() + n);
+			_count.fetch_sub(n);
+		}
+
+		size_t total_written() const { return _total_written.load(); }
+		uint64_t stream_offset() const { return _stream_offset; }
 
-		size_t total_written() const { return _total_written; }
+		/** @see LogWriterFile::set_appended_data_offset() */
+		void set_appended_data_offset(uint64_t offset) { _appended_data_offset = offset; }
 		size_t buffer_size() const { return _buffer_size; }
-		size_t count() const { return _count; }
+		size_t count() const { return _count.load(); }
 
-		bool _should_run = false;
+		px4::atomic_bool _should_run{false};
 		px4::atomic_bool _had_write_error{false};
 	private:
 		size_t _buffer_size;
 		const size_t _buffer_size_min;
+		const size_t _write_alignment; ///< file writes end at multiples of this (the buffer size is a multiple as well)
 		int	_fd = -1;
+		bool _preallocated{false};
 		uint8_t *_buffer = nullptr;
-		size_t _head = 0; ///< next position to write to
-		size_t _count = 0; ///< number of bytes in _buffer to be written
-		size_t _total_written = 0;
+		size_t _head = 0; ///< next position to write to (logger thread)
+		size_t _pending = 0; ///< number of bytes written but not committed yet (logger thread)
+		uint64_t _stream_offset = 0; ///< number of committed bytes since the start of the log (logger thread)
+		uint64_t _appended_data_offset = 0; ///< stream offset of appended data (0 = none)
+		size_t _tail = 0; ///< next position to read from (writer thread)
+		px4::atomic<size_t> _count{0}; ///< number of committed bytes in _buffer to be written
+		px4::atomic<size_t> _total_written{0};
 		perf_counter_t _perf_write;
 		perf_counter_t _perf_fsync;
 	};
 
 	LogFileBuffer _buffers[(int)LogType::Count];
+	size_t _preallocate_size[(int)LogType::Count] {};
 
 	px4::atomic_bool	_exit_thread{false};
 	bool			_need_reliable_transfer{false};
 	px4::atomic_bool	_want_fsync{false};
 	pthread_mutex_t		_mtx;
 	pthread_cond_t		_cv;
-	pthread_t _thread = 0;
+
+	struct WriterThread {
+		LogWriterFile *writer{nullptr};
+		int first_type{0}; ///< range of log types written by this thread
+		int last_type{0};
+		pthread_t thread{0};
+	};
+
+	WriterThread _threads[(int)LogType::Count] {};
+	int _num_threads{0};
+
+#if defined(CONFIG_LOGGER_COMPRESSION)
+	bool init_logfile_compression();
+	LogCompressor *_compressor{nullptr};
+	bool _compression_enabled{false};
+	bool _compress{false}; ///< the current full log is compressed
+#endif // CONFIG_LOGGER_COMPRESSION
 
 #if defined(PX4_CRYPTO)
 	bool init_logfile_encryption(const LogType type);
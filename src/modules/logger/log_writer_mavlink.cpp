@@ -68,10 +68,15 @@ void LogWriterMavlink::start_log()
 		_ulog_stream_ack_sub = orb_subscribe(ORB_ID(ulog_stream_ack));
 	}
 
-	// make sure we don't get any stale ack's by doing an orb_copy
-	ulog_stream_ack_s ack;
-	orb_copy(ORB_ID(ulog_stream_ack), _ulog_stream_ack_sub, &ack);
+	// make sure we don't get any stale ack's by reading all queued ones
+	bool updated = false;
 
+	while (orb_check(_ulog_stream_ack_sub, &updated) == 0 && updated) {
+		ulog_stream_ack_s ack;
+		orb_copy(ORB_ID(ulog_stream_ack), _ulog_stream_ack_sub, &ack);
+	}
+
+	_num_unacked = 0;
 	_ulog_stream_data.msg_sequence = 0;
 	_ulog_stream_data.length = 0;
 	_ulog_stream_data.first_message_offset = 0;
@@ -122,6 +127,11 @@ void LogWriterMavlink::set_need_reliable_transfer(bool need_reliable)
 			// make sure to send previous data using reliable transfer
 			publish_message();
 		}
+
+		// the reliable data is completely transferred only once all of it is acked
+		if (is_started()) {
+			wait_for_acks(0);
+		}
 	}
 
 	_need_reliable_transfer = need_reliable;
@@ -134,53 +144,77 @@ int LogWriterMavlink::publish_message()
 
 	if (_need_reliable_transfer) {
 		_ulog_stream_data.flags = _ulog_stream_data.FLAGS_NEED_ACK;
+
+		// we need to wait until there is room in the ack window. Note that this blocks the main logger thread, so if
+		// a file logging is already running, it will miss samples.
+		if (wait_for_acks(ulog_stream_ack_s::WINDOW_SIZE - 1)) {
+			return -2;
+		}
+
+		_unacked_sequences[_num_unacked++] = _ulog_stream_data.msg_sequence;
 	}
 
 	_ulog_stream_pub.publish(_ulog_stream_data);
 
-	if (_need_reliable_transfer) {
-		// we need to wait for an ack. Note that this blocks the main logger thread, so if a file logging
-		// is already running, it will miss samples.
-		px4_pollfd_struct_t fds[1];
-		fds[0].fd = _ulog_stream_ack_sub;
-		fds[0].events = POLLIN;
-		bool got_ack = false;
-		const int timeout_ms = ulog_stream_ack_s::ACK_TIMEOUT * ulog_stream_ack_s::ACK_MAX_TRIES;
+	_ulog_stream_data.msg_sequence++;
+	_ulog_stream_data.length = 0;
+	_ulog_stream_data.first_message_offset = 255;
+	return 0;
+}
 
-		hrt_abstime started = hrt_absolute_time();
+void LogWriterMavlink::check_acks()
+{
+	bool updated = false;
 
-		do {
-			int ret = px4_poll(fds, sizeof(fds) / sizeof(fds[0]), timeout_ms);
+	while (orb_check(_ulog_stream_ack_sub, &updated) == 0 && updated) {
+		ulog_stream_ack_s ack;
+		orb_copy(ORB_ID(ulog_stream_ack), _ulog_stream_ack_sub, &ack);
 
-			if (ret <= 0) {
+		// acks can arrive in any order (retransmissions), unknown sequences are ignored
+		for (int i = 0; i < _num_unacked; ++i) {
+			if (_unacked_sequences[i] == ack.msg_sequence) {
+				_unacked_sequences[i] = _unacked_sequences[--_num_unacked];
 				break;
 			}
+		}
+	}
+}
 
-			if (fds[0].revents & POLLIN) {
-				ulog_stream_ack_s ack;
-				orb_copy(ORB_ID(ulog_stream_ack), _ulog_stream_ack_sub, &ack);
+int LogWriterMavlink::wait_for_acks(int max_unacked)
+{
+	check_acks();
 
-				if (ack.msg_sequence == _ulog_stream_data.msg_sequence) {
-					got_ack = true;
-				}
+	if (_num_unacked <= max_unacked) {
+		return 0;
+	}
 
-			} else {
-				break;
-			}
-		} while (!got_ack && hrt_elapsed_time(&started) / 1000 < timeout_ms);
+	px4_pollfd_struct_t fds[1];
+	fds[0].fd = _ulog_stream_ack_sub;
+	fds[0].events = POLLIN;
+	const int timeout_ms = ulog_stream_ack_s::ACK_TIMEOUT * ulog_stream_ack_s::ACK_MAX_TRIES;
 
-		if (!got_ack) {
+	hrt_abstime started = hrt_absolute_time();
+
+	while (_num_unacked > max_unacked) {
+		const int remaining_ms = timeout_ms - (int)(hrt_elapsed_time(&started) / 1000);
+
+		if (remaining_ms <= 0 || px4_poll(fds, sizeof(fds) / sizeof(fds[0]), remaining_ms) <= 0
+		    || !(fds[0].revents & POLLIN)) {
 			PX4_ERR("Ack timeout. Stopping mavlink log");
 			stop_log();
 			return -2;
 		}
 
-		PX4_DEBUG("got ack in %i ms", (int)(hrt_elapsed_time(&started) / 1000));
+		const int num_unacked = _num_unacked;
+		check_acks();
+
+		if (_num_unacked < num_unacked) {
+			// progress: restart the timeout
+			PX4_DEBUG("got ack in %i ms", (int)(hrt_elapsed_time(&started) / 1000));
+			started = hrt_absolute_time();
+		}
 	}
 
-	_ulog_stream_data.msg_sequence++;
-	_ulog_stream_data.length = 0;
-	_ulog_stream_data.first_message_offset = 255;
 	return 0;
 }
 
@@ -73,12 +73,23 @@ public:
 
 private:
 
-	/** publish message, wait for ack if needed & reset message */
+	/** publish message, wait for room in the ack window if needed & reset message */
 	int publish_message();
 
+	/**
+	 * Wait until at most max_unacked published messages are not acked yet. Stops the log on timeout.
+	 * @return 0 on success, -2 on timeout
+	 */
+	int wait_for_acks(int max_unacked);
+
+	/** handle received acks (non-blocking) */
+	void check_acks();
+
 	ulog_stream_s _ulog_stream_data{};
 	uORB::Publication<ulog_stream_s> _ulog_stream_pub{ORB_ID(ulog_stream)};
 	int _ulog_stream_ack_sub{-1};
+	uint16_t _unacked_sequences[ulog_stream_ack_s::WINDOW_SIZE] {};
+	int _num_unacked{0};
 	bool _need_reliable_transfer{false};
 	bool _is_started{false};
 };
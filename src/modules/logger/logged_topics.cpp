@@ -43,6 +43,71 @@
 
 using namespace px4::logger;
 
+struct TopicPriorityEntry {
+	const char *name; ///< topic name, or a name prefix if ending with '*'
+	TopicPriority priority;
+};
+
+/**
+ * Priority classes of logged topics, all others are TopicPriority::Normal.
+ * Control and estimator topics are kept intact under buffer backpressure, high-rate raw sensor and
+ * debug topics are decimated first.
+ */
+static constexpr TopicPriorityEntry topic_priorities[] = {
+	{"actuator_armed", TopicPriority::High},
+	{"actuator_motors", TopicPriority::High},
+	{"actuator_outputs", TopicPriority::High},
+	{"actuator_servos", TopicPriority::High},
+	{"ekf2_timestamps", TopicPriority::High},
+	{"estimator_*", TopicPriority::High},
+	{"failsafe_flags", TopicPriority::High},
+	{"rate_ctrl_status", TopicPriority::High},
+	{"trajectory_setpoint", TopicPriority::High},
+	{"vehicle_angular_velocity", TopicPriority::High},
+	{"vehicle_attitude", TopicPriority::High},
+	{"vehicle_attitude_setpoint", TopicPriority::High},
+	{"vehicle_control_mode", TopicPriority::High},
+	{"vehicle_global_position", TopicPriority::High},
+	{"vehicle_land_detected", TopicPriority::High},
+	{"vehicle_local_position", TopicPriority::High},
+	{"vehicle_local_position_setpoint", TopicPriority::High},
+	{"vehicle_rates_setpoint", TopicPriority::High},
+	{"vehicle_status", TopicPriority::High},
+	{"vehicle_thrust_setpoint", TopicPriority::High},
+	{"vehicle_torque_setpoint", TopicPriority::High},
+
+	{"debug_*", TopicPriority::Low},
+	{"esc_status", TopicPriority::Low},
+	{"mavlink_tunnel", TopicPriority::Low},
+	{"sensor_accel", TopicPriority::Low},
+	{"sensor_accel_fifo", TopicPriority::Low},
+	{"sensor_baro", TopicPriority::Low},
+	{"sensor_gyro", TopicPriority::Low},
+	{"sensor_gyro_fft", TopicPriority::Low},
+	{"sensor_gyro_fifo", TopicPriority::Low},
+	{"sensor_mag", TopicPriority::Low},
+	{"vehicle_imu", TopicPriority::Low},
+	{"vehicle_imu_status", TopicPriority::Low},
+};
+
+TopicPriority LoggedTopics::topic_priority(const char *name)
+{
+	for (const TopicPriorityEntry &entry : topic_priorities) {
+		const size_t len = strlen(entry.name);
+
+		if (entry.name[len - 1] == '*') {
+			if (strncmp(name, entry.name, len - 1) == 0) {
+				return entry.priority;
+			}
+
+		} else if (strcmp(name, entry.name) == 0) {
+			return entry.priority;
+		}
+	}
+
+	return TopicPriority::Normal;
+}
+
 void LoggedTopics::add_default_topics()
 {
 	add_topic("action_request");
@@ -57,6 +122,7 @@ void LoggedTopics::add_default_topics()
 	add_topic("cellular_status", 200);
 	add_topic("commander_state");
 	add_topic("config_overrides");
+	add_optional_topic_multi("control_latency");
 	add_topic("cpuload");
 	add_topic("distance_sensor_mode_change_request");
 	add_topic("device_information", 900);
@@ -101,6 +167,7 @@ void LoggedTopics::add_default_topics()
 	add_topic("offboard_control_mode", 100);
 	add_topic("onboard_computer_status", 10);
 	add_topic("parameter_update");
+	add_optional_topic("perf_snapshot");
 	add_topic("position_controller_status", 500);
 	add_topic("position_controller_landing_status", 100);
 	add_optional_topic("pure_pursuit_status", 100);
@@ -128,9 +195,11 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic("spoilers_setpoint", 1000);
 	add_topic("system_power", 500);
 	add_optional_topic("takeoff_status", 1000);
+	add_optional_topic("task_memory");
 	add_optional_topic("tecs_status", 200);
 	add_optional_topic("tiltrotor_extra_controls", 100);
 	add_topic("trajectory_setpoint", 200);
+	add_optional_topic("trajectory_setpoint_buffer", 200);
 	add_topic("transponder_report");
 	add_topic("vehicle_acceleration", 50);
 	add_topic("vehicle_air_data", 200);
@@ -153,6 +222,7 @@ void LoggedTopics::add_default_topics()
 	add_topic("vtx");
 	add_optional_topic("vtol_vehicle_status", 200);
 	add_topic("wind", 1000);
+	add_optional_topic("work_item_status");
 	add_topic("fixed_wing_lateral_setpoint");
 	add_topic("fixed_wing_longitudinal_setpoint");
 	add_topic("longitudinal_control_configuration");
@@ -192,6 +262,7 @@ void LoggedTopics::add_default_topics()
 	add_optional_topic_multi("estimator_sensor_bias", 1000);
 	add_optional_topic_multi("estimator_status", 200);
 	add_optional_topic_multi("estimator_status_flags", 10);
+	add_optional_topic_multi("estimator_timing", 1000);
 	add_optional_topic_multi("yaw_estimator_status", 1000);
 
 	// log all raw sensors at minimal rate (at least 1 Hz)
@@ -199,10 +270,12 @@ void LoggedTopics::add_default_topics()
 	add_topic_multi("differential_pressure", 1000, 2);
 	add_topic_multi("distance_sensor", 1000, 2);
 	add_optional_topic_multi("sensor_accel", 1000, 4);
+	add_optional_topic_multi("sensor_accel_timing", 1000, 4);
 	add_topic_multi("sensor_baro", 1000, 4);
 	add_topic_multi("sensor_gps", 1000, 2);
 	add_topic_multi("sensor_gnss_relative", 1000, 1);
 	add_optional_topic_multi("sensor_gyro", 1000, 4);
+	add_optional_topic_multi("sensor_gyro_timing", 1000, 4);
 	add_topic_multi("sensor_mag", 1000, 4);
 	add_topic_multi("sensor_optical_flow", 1000, 2);
 
@@ -477,6 +550,7 @@ bool LoggedTopics::add_topic(const orb_metadata *topic, uint16_t interval_ms, ui
 	RequestedSubscription &sub = _subscriptions.sub[_subscriptions.count++];
 	sub.interval_ms = interval_ms;
 	sub.instance = instance;
+	sub.priority = topic_priority(topic->o_name);
 	sub.id = static_cast<ORB_ID>(topic->o_id);
 	return true;
 }
@@ -64,6 +64,19 @@ enum class MissionLogType : int32_t {
 	Geotagging =             2
 };
 
+/**
+ * @enum TopicPriority
+ * Priority class of a logged topic. Under buffer backpressure lower priority topics are decimated first,
+ * while high priority topics (control and estimation) are always logged at their configured rate.
+ */
+enum class TopicPriority : uint8_t {
+	High = 0,
+	Normal,
+	Low,
+
+	Count
+};
+
 inline bool operator&(SDLogProfileMask a, SDLogProfileMask b)
 {
 	return static_cast<int32_t>(a) & static_cast<int32_t>(b);
@@ -83,6 +96,7 @@ public:
 	struct RequestedSubscription {
 		uint16_t interval_ms;
 		uint8_t instance;
+		TopicPriority priority{TopicPriority::Normal};
 		ORB_ID id{ORB_ID::INVALID};
 	};
 	struct RequestedSubscriptionArray {
@@ -178,6 +192,11 @@ private:
 	void add_mavlink_tunnel();
 	void add_high_rate_sensors_topics();
 
+	/**
+	 * Get the priority class of a topic (@see topic_priorities in logged_topics.cpp)
+	 */
+	static TopicPriority topic_priority(const char *name);
+
 	/**
 	 * add a logged topic (called by add_topic() above).
 	 * @return true on success
@@ -426,6 +426,8 @@ Logger::~Logger()
 
 	delete[](_msg_buffer);
 	delete[](_subscriptions);
+	delete[](_subscription_order);
+	delete[](_subscription_groups);
 }
 
 void Logger::update_params()
@@ -461,7 +463,7 @@ bool Logger::copy_if_updated(int sub_idx, void *buffer, bool try_to_subscribe)
 		if (sub.get_interval_us() == 0) {
 			// record gaps in full rate (no interval) messages
 			const unsigned last_generation = sub.get_last_generation();
-			updated = sub.update(buffer);
+			updated = sub.update_due(buffer);
 
 			if (updated && (sub.get_last_generation() != last_generation + 1)) {
 				// error, missed a message
@@ -469,7 +471,7 @@ bool Logger::copy_if_updated(int sub_idx, void *buffer, bool try_to_subscribe)
 			}
 
 		} else {
-			updated = sub.update(buffer);
+			updated = sub.update_due(buffer);
 		}
 
 	} else if (try_to_subscribe) {
@@ -488,6 +490,233 @@ bool Logger::copy_if_updated(int sub_idx, void *buffer, bool try_to_subscribe)
 	return updated;
 }
 
+bool Logger::write_if_updated_zero_copy(int sub_idx, hrt_abstime loop_time, uint32_t &total_bytes)
+{
+	LoggerSubscription &sub = _subscriptions[sub_idx];
+
+	const unsigned last_generation = sub.get_last_generation();
+	const void *data = sub.peek_due();
+
+	if (data == nullptr) {
+		return false;
+	}
+
+	if ((sub.get_interval_us() == 0) && (sub.get_last_generation() != last_generation + 1)) {
+		// error, missed a message
+		_message_gaps++;
+	}
+
+	const size_t data_size = sub.get_topic()->o_size_no_padding;
+	const uint16_t write_msg_size = static_cast<uint16_t>(sizeof(ulog_message_data_s) + data_size - ULOG_MSG_HEADER_LEN);
+	const uint16_t write_msg_id = sub.msg_id;
+
+	//write one byte after another (necessary because of alignment)
+	uint8_t header[sizeof(ulog_message_data_s)];
+	header[0] = (uint8_t)write_msg_size;
+	header[1] = (uint8_t)(write_msg_size >> 8);
+	header[2] = static_cast<uint8_t>(ULogMessageType::DATA);
+	header[3] = (uint8_t)write_msg_id;
+	header[4] = (uint8_t)(write_msg_id >> 8);
+
+#if defined(CONFIG_LOGGER_INDEX)
+	const uint64_t offset = _writer.get_stream_offset_file(LogType::Full);
+#endif // CONFIG_LOGGER_INDEX
+
+	const bool full_written = !decimated(sub) && write_message(LogType::Full, header, sizeof(header), data, data_size);
+	const bool mission_written = mission_log_due(sub_idx, loop_time)
+				     && write_message(LogType::Mission, header, sizeof(header), data, data_size);
+
+	if (!sub.release()) {
+		// overwritten by a publisher while copying, drop the message (the newer one is logged next)
+		if (full_written) {
+			_writer.discard_last_data_message(LogType::Full);
+		}
+
+		if (mission_written) {
+			_writer.discard_last_data_message(LogType::Mission);
+		}
+
+		_message_gaps++;
+		return false;
+	}
+
+	if (full_written) {
+		_writer.commit_last_data_message(LogType::Full);
+#if defined(CONFIG_LOGGER_INDEX)
+		index_topic(sub, offset);
+#endif // CONFIG_LOGGER_INDEX
+	}
+
+	if (mission_written) {
+		_writer.commit_last_data_message(LogType::Mission);
+	}
+
+#ifdef DBGPRINT
+
+	if (full_written) {
+		total_bytes += sizeof(header) + data_size;
+	}
+
+#endif /* DBGPRINT */
+
+	return true;
+}
+
+/* Full log buffer fill level [%] from which a decimation level is used */
+static constexpr uint8_t backpressure_fill_percent[] = {0, 50, 75};
+static constexpr int backpressure_num_levels = sizeof(backpressure_fill_percent) / sizeof(backpressure_fill_percent[0]);
+
+/* Topic decimation factor per level and priority class (powers of 2, so the uint8_t update counter can wrap) */
+static constexpr uint8_t backpressure_decimation[backpressure_num_levels][(int)TopicPriority::Count] = {
+	// High, Normal, Low
+	{1, 1, 1},
+	{1, 1, 4},
+	{1, 2, 16},
+};
+
+/* the level is only reduced after the buffer fill stayed below its threshold for this time */
+static constexpr hrt_abstime backpressure_hold_time = 1_s;
+
+void Logger::update_backpressure(hrt_abstime now)
+{
+	const size_t buffer_size = _writer.get_buffer_size_file(LogType::Full);
+
+	if (buffer_size == 0) {
+		return;
+	}
+
+	const size_t fill_percent = _writer.get_buffer_fill_count_file(LogType::Full) * 100 / buffer_size;
+	int level = 0;
+
+	while (level + 1 < backpressure_num_levels && fill_percent >= backpressure_fill_percent[level + 1]) {
+		++level;
+	}
+
+	if (level >= _decimation_level) {
+		_decimation_level_time = now;
+
+		if (level == _decimation_level) {
+			return;
+		}
+
+	} else if (now - _decimation_level_time < backpressure_hold_time) {
+		return;
+
+	} else {
+		// step down one level at a time
+		level = _decimation_level - 1;
+		_decimation_level_time = now;
+	}
+
+	_decimation_level = level;
+
+	char message[64];
+	snprintf(message, sizeof(message), "[logger] buffer at %i%%, decimation level %i", (int)fill_percent, level);
+	write_logging_message(LogType::Full, level > 0 ? 4 : 6, now, message); // warning or info
+	PX4_DEBUG("%s", message);
+}
+
+bool Logger::decimated(LoggerSubscription &sub)
+{
+	const uint8_t factor = backpressure_decimation[_decimation_level][(int)sub.priority];
+
+	if (factor <= 1) {
+		return false;
+	}
+
+	return (sub.decimation_count++ % factor) != 0;
+}
+
+void Logger::write_logging_message(LogType type, uint8_t log_level, hrt_abstime timestamp, const char *message)
+{
+	const int message_len = strnlen(message, sizeof(ulog_message_logging_s::message));
+
+	if (message_len == 0) {
+		return;
+	}
+
+	uint16_t write_msg_size = sizeof(ulog_message_logging_s) - sizeof(ulog_message_logging_s::message)
+				  - ULOG_MSG_HEADER_LEN + message_len;
+	_msg_buffer[0] = (uint8_t)write_msg_size;
+	_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
+	_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::LOGGING);
+	_msg_buffer[3] = log_level + '0';
+	memcpy(_msg_buffer + 4, &timestamp, sizeof(ulog_message_logging_s::timestamp));
+	memcpy(_msg_buffer + 12, message, message_len);
+
+	write_message(type, _msg_buffer, write_msg_size + ULOG_MSG_HEADER_LEN);
+}
+
+void Logger::write_if_updated(int sub_idx, hrt_abstime loop_time, bool zero_copy, bool try_to_subscribe,
+			      uint32_t &total_bytes)
+{
+	LoggerSubscription &sub = _subscriptions[sub_idx];
+
+	if (zero_copy && sub.valid()) {
+		// serialize straight from the uORB queue into the log buffer
+		write_if_updated_zero_copy(sub_idx, loop_time, total_bytes);
+		return;
+	}
+
+	/* if this topic has been updated, copy the new data into the message buffer
+	 * and write a message to the log
+	 */
+	if (copy_if_updated(sub_idx, _msg_buffer + sizeof(ulog_message_data_s), try_to_subscribe)) {
+		// each message consists of a header followed by an orb data object
+		const size_t msg_size = sizeof(ulog_message_data_s) + sub.get_topic()->o_size_no_padding;
+		const uint16_t write_msg_size = static_cast<uint16_t>(msg_size - ULOG_MSG_HEADER_LEN);
+		const uint16_t write_msg_id = sub.msg_id;
+
+		//write one byte after another (necessary because of alignment)
+		_msg_buffer[0] = (uint8_t)write_msg_size;
+		_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
+		_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::DATA);
+		_msg_buffer[3] = (uint8_t)write_msg_id;
+		_msg_buffer[4] = (uint8_t)(write_msg_id >> 8);
+
+		// PX4_INFO("topic: %s, size = %zu, out_size = %zu", sub.get_topic()->o_name, sub.get_topic()->o_size, msg_size);
+
+		// full log
+#if defined(CONFIG_LOGGER_INDEX)
+		const uint64_t offset = _writer.get_stream_offset_file(LogType::Full);
+#endif // CONFIG_LOGGER_INDEX
+
+		if (!decimated(sub) && write_message(LogType::Full, _msg_buffer, msg_size)) {
+#if defined(CONFIG_LOGGER_INDEX)
+			index_topic(sub, offset);
+#endif // CONFIG_LOGGER_INDEX
+
+#ifdef DBGPRINT
+			total_bytes += msg_size;
+#endif /* DBGPRINT */
+		}
+
+		// mission log
+		if (mission_log_due(sub_idx, loop_time)) {
+			write_message(LogType::Mission, _msg_buffer, msg_size);
+		}
+	}
+}
+
+bool Logger::mission_log_due(int sub_idx, hrt_abstime loop_time)
+{
+	if (sub_idx >= _num_mission_subs || !_writer.is_started(LogType::Mission)) {
+		return false;
+	}
+
+	if (_mission_subscriptions[sub_idx].next_write_time < (loop_time / 100000)) {
+		unsigned delta_time = _mission_subscriptions[sub_idx].min_delta_ms;
+
+		if (delta_time > 0) {
+			_mission_subscriptions[sub_idx].next_write_time = (loop_time / 100000) + delta_time / 100;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
 const char *Logger::configured_backend_mode() const
 {
 	switch (_writer.backend()) {
@@ -571,14 +800,73 @@ bool Logger::initialize_topics()
 		for (int i = 0; i < logged_topics.subscriptions().count; ++i) {
 			const LoggedTopics::RequestedSubscription &sub = logged_topics.subscriptions().sub[i];
 			_subscriptions[i] = LoggerSubscription(sub.id, sub.interval_ms, sub.instance);
+			_subscriptions[i].priority = sub.priority;
 			_subscriptions[i].subscribe();
 		}
 	}
 
 	_num_subscriptions = logged_topics.subscriptions().count;
+	return init_subscription_groups();
+}
+
+bool Logger::init_subscription_groups()
+{
+	delete[](_subscription_order);
+	_subscription_order = nullptr;
+	delete[](_subscription_groups);
+	_subscription_groups = nullptr;
+	_num_subscription_groups = 0;
+
+	if (_num_subscriptions == 0) {
+		return true;
+	}
+
+	_subscription_order = new uint8_t[_num_subscriptions];
+	_subscription_groups = new SubscriptionGroup[_num_subscriptions];
+
+	if (!_subscription_order || !_subscription_groups) {
+		PX4_ERR("alloc failed");
+		return false;
+	}
+
+	// stable insertion sort by interval (keeps the mission subscriptions in front within a group)
+	for (int i = 0; i < _num_subscriptions; ++i) {
+		int j = i;
+
+		for (; j > 0 && _subscriptions[_subscription_order[j - 1]].get_interval_us() > _subscriptions[i].get_interval_us(); --j) {
+			_subscription_order[j] = _subscription_order[j - 1];
+		}
+
+		_subscription_order[j] = i;
+	}
+
+	for (int i = 0; i < _num_subscriptions; ++i) {
+		const uint32_t interval_us = _subscriptions[_subscription_order[i]].get_interval_us();
+
+		if (_num_subscription_groups == 0 || _subscription_groups[_num_subscription_groups - 1].interval_us != interval_us) {
+			SubscriptionGroup &group = _subscription_groups[_num_subscription_groups++];
+			group.interval_us = interval_us;
+			group.first = i;
+			group.count = 0;
+			group.next_due = 0;
+		}
+
+		++_subscription_groups[_num_subscription_groups - 1].count;
+	}
+
 	return true;
 }
 
+void Logger::set_subscription_group_due(uint32_t interval_us)
+{
+	for (int i = 0; i < _num_subscription_groups; ++i) {
+		if (_subscription_groups[i].interval_us == interval_us) {
+			_subscription_groups[i].next_due = 0;
+			return;
+		}
+	}
+}
+
 void Logger::run()
 {
 	PX4_INFO("logger started (mode=%s)", configured_backend_mode());
@@ -756,53 +1044,45 @@ void Logger::run()
 				}
 			}
 
-			/* wait for lock on log buffer */
-			_writer.lock();
+			const bool zero_copy = _writer.data_message_zero_copy();
+
+			update_backpressure(loop_time);
 
-			for (int sub_idx = 0; sub_idx < _num_subscriptions; ++sub_idx) {
-				LoggerSubscription &sub = _subscriptions[sub_idx];
-				/* if this topic has been updated, copy the new data into the message buffer
-				 * and write a message to the log
-				 */
-				const bool try_to_subscribe = (sub_idx == next_subscribe_topic_index);
+			// only check the groups of subscriptions that can be due (e.g. 1 Hz topics once per second)
+			for (int group_idx = 0; group_idx < _num_subscription_groups; ++group_idx) {
+				SubscriptionGroup &group = _subscription_groups[group_idx];
 
-				if (copy_if_updated(sub_idx, _msg_buffer + sizeof(ulog_message_data_s), try_to_subscribe)) {
-					// each message consists of a header followed by an orb data object
-					const size_t msg_size = sizeof(ulog_message_data_s) + sub.get_topic()->o_size_no_padding;
-					const uint16_t write_msg_size = static_cast<uint16_t>(msg_size - ULOG_MSG_HEADER_LEN);
-					const uint16_t write_msg_id = sub.msg_id;
+				if (loop_time < group.next_due) {
+					continue;
+				}
 
-					//write one byte after another (necessary because of alignment)
-					_msg_buffer[0] = (uint8_t)write_msg_size;
-					_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
-					_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::DATA);
-					_msg_buffer[3] = (uint8_t)write_msg_id;
-					_msg_buffer[4] = (uint8_t)(write_msg_id >> 8);
+				hrt_abstime next_due = UINT64_MAX;
 
-					// PX4_INFO("topic: %s, size = %zu, out_size = %zu", sub.get_topic()->o_name, sub.get_topic()->o_size, msg_size);
+				for (int i = group.first; i < group.first + group.count; ++i) {
+					const int sub_idx = _subscription_order[i];
+					LoggerSubscription &sub = _subscriptions[sub_idx];
 
-					// full log
-					if (write_message(LogType::Full, _msg_buffer, msg_size)) {
+					if (!sub.valid()) {
+						continue; // handled by the subscription update below
+					}
 
-#ifdef DBGPRINT
-						total_bytes += msg_size;
-#endif /* DBGPRINT */
+					if (sub.due(loop_time)) {
+						write_if_updated(sub_idx, loop_time, zero_copy, false, total_bytes);
 					}
 
-					// mission log
-					if (sub_idx < _num_mission_subs) {
-						if (_writer.is_started(LogType::Mission)) {
-							if (_mission_subscriptions[sub_idx].next_write_time < (loop_time / 100000)) {
-								unsigned delta_time = _mission_subscriptions[sub_idx].min_delta_ms;
+					// not updated subscriptions stay due, so the group is checked again in the next iteration
+					next_due = math::min(next_due, sub.next_due());
+				}
 
-								if (delta_time > 0) {
-									_mission_subscriptions[sub_idx].next_write_time = (loop_time / 100000) + delta_time / 100;
-								}
+				group.next_due = next_due;
+			}
 
-								write_message(LogType::Mission, _msg_buffer, msg_size);
-							}
-						}
-					}
+			// try to subscribe to one topic per iteration
+			if (next_subscribe_topic_index != -1 && !_subscriptions[next_subscribe_topic_index].valid()) {
+				write_if_updated(next_subscribe_topic_index, loop_time, zero_copy, true, total_bytes);
+
+				if (_subscriptions[next_subscribe_topic_index].valid()) {
+					set_subscription_group_due(_subscriptions[next_subscribe_topic_index].get_interval_us());
 				}
 			}
 
@@ -813,25 +1093,16 @@ void Logger::run()
 			log_message_s log_message;
 
 			if (_log_message_sub.update(&log_message)) {
-				const char *message = (const char *)log_message.text;
-				int message_len = strlen(message);
-
-				if (message_len > 0) {
-					uint16_t write_msg_size = sizeof(ulog_message_logging_s) - sizeof(ulog_message_logging_s::message)
-								  - ULOG_MSG_HEADER_LEN + message_len;
-					_msg_buffer[0] = (uint8_t)write_msg_size;
-					_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
-					_msg_buffer[2] = static_cast<uint8_t>(ULogMessageType::LOGGING);
-					_msg_buffer[3] = log_message.severity + '0';
-					memcpy(_msg_buffer + 4, &log_message.timestamp, sizeof(ulog_message_logging_s::timestamp));
-					strncpy((char *)(_msg_buffer + 12), message, sizeof(ulog_message_logging_s::message));
-
-					write_message(LogType::Full, _msg_buffer, write_msg_size + ULOG_MSG_HEADER_LEN);
-				}
+				write_logging_message(LogType::Full, log_message.severity, log_message.timestamp, (const char *)log_message.text);
 			}
 
 			// Add sync magic
 			if (loop_time - _last_sync_time > 500_ms) {
+#if defined(CONFIG_LOGGER_INDEX)
+				// sync messages are the index entries
+				_log_index.update(loop_time, _writer.get_stream_offset_file(LogType::Full));
+#endif // CONFIG_LOGGER_INDEX
+
 				uint16_t write_msg_size = static_cast<uint16_t>(sizeof(ulog_message_sync_s) - ULOG_MSG_HEADER_LEN);
 				_msg_buffer[0] = (uint8_t)write_msg_size;
 				_msg_buffer[1] = (uint8_t)(write_msg_size >> 8);
@@ -860,12 +1131,6 @@ void Logger::run()
 
 			publish_logger_status();
 
-			/* release the log buffer */
-			_writer.unlock();
-
-			/* notify the writer thread */
-			_writer.notify();
-
 			/* subscription update */
 			if (next_subscribe_topic_index != -1) {
 				if (++next_subscribe_topic_index >= _num_subscriptions) {
@@ -1069,6 +1334,7 @@ void Logger::publish_logger_status()
 				status.message_gaps = _message_gaps;
 				status.buffer_used_bytes = buffer_fill_count_file;
 				status.buffer_size_bytes = _writer.get_buffer_size_file(log_type);
+				status.decimation_level = (log_type == LogType::Full) ? _decimation_level : 0;
 			}
 
 			_logger_status_pub[i].publish(status);
@@ -1096,6 +1362,10 @@ void Logger::adjust_subscription_updates()
 			++j;
 		}
 	}
+
+	for (int i = 0; i < _num_subscription_groups; ++i) {
+		_subscription_groups[i].next_due = 0;
+	}
 }
 
 bool Logger::get_disable_boot_logging()
@@ -1209,10 +1479,23 @@ void Logger::handle_vehicle_command_update()
 }
 
 bool Logger::write_message(LogType type, void *ptr, size_t size)
+{
+	const Statistics &stats = _statistics[(int)type];
+	return handle_write_result(type, _writer.write_message(type, ptr, size, stats.dropout_start) != -1);
+}
+
+bool Logger::write_message(LogType type, const void *header, size_t header_size, const void *data, size_t data_size)
+{
+	const Statistics &stats = _statistics[(int)type];
+	return handle_write_result(type,
+				   _writer.write_data_message(type, header, header_size, data, data_size, stats.dropout_start) != -1);
+}
+
+bool Logger::handle_write_result(LogType type, bool write_succeeded)
 {
 	Statistics &stats = _statistics[(int)type];
 
-	if (_writer.write_message(type, ptr, size, stats.dropout_start) != -1) {
+	if (write_succeeded) {
 
 		if (stats.dropout_start) {
 			float dropout_duration = (float)(hrt_elapsed_time(&stats.dropout_start) / 1000) / 1.e3f;
@@ -1313,15 +1596,19 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 		replay_suffix = "_replayed";
 	}
 
-	const char *crypto_suffix = "";
+	const char *file_suffix = "";
 #if defined(PX4_CRYPTO)
 
 	if (_param_sdlog_crypto_algorithm.get() != 0) {
-		crypto_suffix = "e";
+		file_suffix = "e";
 	}
 
 #endif // PX4_CRYPTO
 
+	if (log_file_compressed(type)) {
+		file_suffix = "z";
+	}
+
 	char *log_file_name = _file_name[(int)type].log_file_name;
 
 	if (time_ok) {
@@ -1334,7 +1621,7 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 		char log_file_name_time[16] = "";
 		strftime(log_file_name_time, sizeof(log_file_name_time), "%H_%M_%S", &tt);
 		snprintf(log_file_name, sizeof(LogFileName::log_file_name), "%s%s.ulg%s", log_file_name_time, replay_suffix,
-			 crypto_suffix);
+			 file_suffix);
 		snprintf(file_name + n, file_name_size - n, "/%s", log_file_name);
 
 		if (notify) {
@@ -1365,7 +1652,7 @@ int Logger::get_log_file_name(LogType type, char *file_name, size_t file_name_si
 		while (file_number <= MAX_NO_LOGFILE) {
 			/* format log file path: e.g. /fs/microsd/log/sess001/log001.ulg */
 			snprintf(log_file_name, sizeof(LogFileName::log_file_name), "log%03" PRIu16 "%s.ulg%s", file_number, replay_suffix,
-				 crypto_suffix);
+				 file_suffix);
 			snprintf(file_name + n, file_name_size - n, "/%s", log_file_name);
 
 			if (!util::file_exist(file_name)) {
@@ -1403,6 +1690,23 @@ void Logger::setReplayFile(const char *file_name)
 	_replay_file_name = strdup(file_name);
 }
 
+bool Logger::log_file_compressed(LogType type) const
+{
+#if defined(CONFIG_LOGGER_COMPRESSION)
+#if defined(PX4_CRYPTO)
+
+	if (_param_sdlog_crypto_algorithm.get() != 0) {
+		return false;
+	}
+
+#endif // PX4_CRYPTO
+
+	return type == LogType::Full && _param_sdlog_compress.get();
+#else
+	return false;
+#endif // CONFIG_LOGGER_COMPRESSION
+}
+
 void Logger::start_log_file(LogType type)
 {
 	if (_writer.is_started(type, LogWriter::BackendFile) || (_writer.backend() & LogWriter::BackendFile) == 0) {
@@ -1417,6 +1721,19 @@ void Logger::start_log_file(LogType type)
 	PX4_INFO("Start file log (type: %s)", log_type_str(type));
 	_statistics[(int) type].start_time_file = 0;
 
+	if (type == LogType::Full) {
+		_decimation_level = 0;
+
+#if defined(CONFIG_LOGGER_INDEX)
+		_log_index.reset();
+
+		for (int i = 0; i < _num_subscriptions; ++i) {
+			_subscriptions[i].first_offset = 0;
+		}
+
+#endif // CONFIG_LOGGER_INDEX
+	}
+
 	char file_name[LOG_DIR_LEN] = "";
 
 	if (get_log_file_name(type, file_name, sizeof(file_name), type == LogType::Full)) {
@@ -1424,6 +1741,13 @@ void Logger::start_log_file(LogType type)
 		return;
 	}
 
+	if (type == LogType::Full) {
+		_writer.set_file_preallocation(type, (size_t)_param_sdlog_prealloc.get() * 1024 * 1024);
+#if defined(CONFIG_LOGGER_COMPRESSION)
+		_writer.set_file_compression(log_file_compressed(type));
+#endif // CONFIG_LOGGER_COMPRESSION
+	}
+
 #if defined(PX4_CRYPTO)
 	_writer.set_encryption_parameters(
 		(px4_crypto_algorithm_t)_param_sdlog_crypto_algorithm.get(),
@@ -1472,6 +1796,9 @@ void Logger::stop_log_file(LogType type)
 	if (type == LogType::Full) {
 		_writer.set_need_reliable_transfer(true);
 		write_perf_data(PrintLoadReason::Postflight);
+#if defined(CONFIG_LOGGER_INDEX)
+		write_index_appendix();
+#endif // CONFIG_LOGGER_INDEX
 		_writer.set_need_reliable_transfer(false);
 	}
 
@@ -1696,8 +2023,6 @@ void Logger::write_console_output()
 
 void Logger::write_formats(LogType type)
 {
-	_writer.lock();
-
 	// This is large and thus we need to be careful in terms of stack size requirements
 	ulog_message_format_s msg;
 
@@ -1822,14 +2147,10 @@ void Logger::write_formats(LogType type)
 		// Getting here is a bug. Maybe the ordering of nested formats is not as expected?
 		PX4_ERR("Not all formats written");
 	}
-
-	_writer.unlock();
 }
 
 void Logger::write_all_add_logged_msg(LogType type)
 {
-	_writer.lock();
-
 	int sub_count = _num_subscriptions;
 
 	if (type == LogType::Mission) {
@@ -1849,8 +2170,6 @@ void Logger::write_all_add_logged_msg(LogType type)
 
 	write_add_logged_msg(type, _event_subscription); // always add, even if not valid
 
-	_writer.unlock();
-
 	if (!added_subscriptions) {
 		PX4_ERR("No subscriptions added"); // this results in invalid log files
 	}
@@ -1888,7 +2207,6 @@ void Logger::write_add_logged_msg(LogType type, LoggerSubscription &subscription
 
 void Logger::write_info(LogType type, const char *name, const char *value)
 {
-	_writer.lock();
 	ulog_message_info_s msg = {};
 	uint8_t *buffer = reinterpret_cast<uint8_t *>(&msg);
 	msg.msg_type = static_cast<uint8_t>(ULogMessageType::INFO);
@@ -1907,13 +2225,10 @@ void Logger::write_info(LogType type, const char *name, const char *value)
 
 		write_message(type, buffer, msg_size);
 	}
-
-	_writer.unlock();
 }
 
 void Logger::write_info_multiple(LogType type, const char *name, const char *value, bool is_continued)
 {
-	_writer.lock();
 	ulog_message_info_multiple_s msg;
 	uint8_t *buffer = reinterpret_cast<uint8_t *>(&msg);
 	msg.msg_type = static_cast<uint8_t>(ULogMessageType::INFO_MULTIPLE);
@@ -1936,8 +2251,6 @@ void Logger::write_info_multiple(LogType type, const char *name, const char *val
 	} else {
 		PX4_ERR("info_multiple str too long (%" PRIu8 "), key=%s", msg.key_len, msg.key_value_str);
 	}
-
-	_writer.unlock();
 }
 
 void Logger::write_info_multiple(LogType type, const char *name, int fd)
@@ -1961,8 +2274,6 @@ void Logger::write_info_multiple(LogType type, const char *name, int fd)
 	int file_offset = 0;
 
 	while (file_offset < file_size) {
-		_writer.lock();
-
 		const int max_format_length = 16; // accounts for "uint8_t[x] "
 		int read_length = math::min(file_size - file_offset, (off_t)sizeof(msg.key_value_str) - name_len - max_format_length);
 
@@ -1985,11 +2296,64 @@ void Logger::write_info_multiple(LogType type, const char *name, int fd)
 		}
 
 		msg.is_continued = true;
-		_writer.unlock();
 		_writer.notify();
 	}
 }
 
+template<typename F>
+void Logger::write_info_multiple_uint64(LogType type, const char *name, int count, F value)
+{
+	static constexpr int max_values_per_message = 128;
+
+	ulog_message_info_multiple_s msg;
+	uint8_t *buffer = reinterpret_cast<uint8_t *>(&msg);
+	msg.msg_type = static_cast<uint8_t>(ULogMessageType::INFO_MULTIPLE);
+	msg.is_continued = false;
+
+	for (int i = 0; i < count; i += max_values_per_message) {
+		const int num_values = math::min(count - i, max_values_per_message);
+
+		/* construct format key (type and name) */
+		msg.key_len = snprintf(msg.key_value_str, sizeof(msg.key_value_str), "uint64_t[%i] %s", num_values, name);
+		size_t msg_size = sizeof(msg) - sizeof(msg.key_value_str) + msg.key_len;
+
+		for (int k = 0; k < num_values; ++k) {
+			const uint64_t v = value(i + k);
+			memcpy(&buffer[msg_size], &v, sizeof(v));
+			msg_size += sizeof(v);
+		}
+
+		msg.msg_size = msg_size - ULOG_MSG_HEADER_LEN;
+		write_message(type, buffer, msg_size);
+		msg.is_continued = true;
+	}
+}
+
+#if defined(CONFIG_LOGGER_INDEX)
+void Logger::write_index_appendix()
+{
+	const uint64_t appended_offset = _writer.get_stream_offset_file(LogType::Full);
+
+	write_info_multiple_uint64(LogType::Full, "ulog_index_timestamp", _log_index.count(),
+				   [this](int i) { return _log_index.timestamp(i); });
+	write_info_multiple_uint64(LogType::Full, "ulog_index_offset", _log_index.count(),
+				   [this](int i) { return _log_index.offset(i); });
+
+	// indexed by msg_id, 0 if the topic has not been logged
+	write_info_multiple_uint64(LogType::Full, "ulog_index_topic_offset", _next_topic_id, [this](int msg_id) {
+		for (int i = 0; i < _num_subscriptions; ++i) {
+			if (_subscriptions[i].msg_id == msg_id) {
+				return _subscriptions[i].first_offset;
+			}
+		}
+
+		return (uint64_t)0;
+	});
+
+	_writer.set_appended_data_offset_file(LogType::Full, appended_offset);
+}
+#endif // CONFIG_LOGGER_INDEX
+
 void Logger::write_info(LogType type, const char *name, int32_t value)
 {
 	write_info_template<int32_t>(type, name, value, "int32_t");
@@ -2009,7 +2373,6 @@ void Logger::write_info(LogType type, const char *name, uint64_t value)
 template<typename T>
 void Logger::write_info_template(LogType type, const char *name, T value, const char *type_str)
 {
-	_writer.lock();
 	ulog_message_info_s msg = {};
 	uint8_t *buffer = reinterpret_cast<uint8_t *>(&msg);
 	msg.msg_type = static_cast<uint8_t>(ULogMessageType::INFO);
@@ -2025,8 +2388,6 @@ void Logger::write_info_template(LogType type, const char *name, T value, const
 	msg.msg_size = msg_size - ULOG_MSG_HEADER_LEN;
 
 	write_message(type, buffer, msg_size);
-
-	_writer.unlock();
 }
 
 void Logger::write_excluded_optional_topics(LogType type)
@@ -2052,7 +2413,6 @@ void Logger::write_header(LogType type)
 	header.magic[6] = 0x35;
 	header.magic[7] = 0x01; //file version 1
 	header.timestamp = hrt_absolute_time();
-	_writer.lock();
 	write_message(type, &header, sizeof(header));
 
 	// write the Flags message: this MUST be written right after the ulog header
@@ -2064,8 +2424,6 @@ void Logger::write_header(LogType type)
 	flag_bits.msg_type = static_cast<uint8_t>(ULogMessageType::FLAG_BITS);
 
 	write_message(type, &flag_bits, sizeof(flag_bits));
-
-	_writer.unlock();
 }
 
 void Logger::write_version(LogType type)
@@ -2154,7 +2512,6 @@ void Logger::write_version(LogType type)
 
 void Logger::write_parameter_defaults(LogType type)
 {
-	_writer.lock();
 	ulog_message_parameter_default_s msg = {};
 	uint8_t *buffer = reinterpret_cast<uint8_t *>(&msg);
 
@@ -2242,13 +2599,11 @@ void Logger::write_parameter_defaults(LogType type)
 		}
 	} while ((param != PARAM_INVALID) && (param_idx < (int) param_count()));
 
-	_writer.unlock();
 	_writer.notify();
 }
 
 void Logger::write_parameters(LogType type)
 {
-	_writer.lock();
 	ulog_message_parameter_s msg = {};
 	uint8_t *buffer = reinterpret_cast<uint8_t *>(&msg);
 
@@ -2311,13 +2666,11 @@ void Logger::write_parameters(LogType type)
 		}
 	} while ((param != PARAM_INVALID) && (param_idx < (int) param_count()));
 
-	_writer.unlock();
 	_writer.notify();
 }
 
 void Logger::write_changed_parameters(LogType type)
 {
-	_writer.lock();
 	ulog_message_parameter_s msg = {};
 	uint8_t *buffer = reinterpret_cast<uint8_t *>(&msg);
 
@@ -2382,7 +2735,6 @@ void Logger::write_changed_parameters(LogType type)
 		}
 	} while ((param != PARAM_INVALID) && (param_idx < (int) param_count()));
 
-	_writer.unlock();
 	_writer.notify();
 }
 
@@ -2446,10 +2798,13 @@ The normal log is always a superset of the mission log.
 The implementation uses two threads:
 - The main thread, running at a fixed rate (or polling on a topic if started with -p) and checking for
   data updates
-- The writer thread, writing data to the file
+- The writer thread, writing data to the file (with CONFIG_LOGGER_PARALLEL_WRITERS there is one writer thread
+  per log file, so the full and mission log are written independently)
 
 In between there is a write buffer with configurable size (and another fixed-size buffer for
-the mission log). It should be large to avoid dropouts.
+the mission log). It should be large to avoid dropouts. When the write buffer fills up, low priority
+high-rate topics (e.g. raw sensor data) are decimated first, while control and estimator topics are kept
+at their configured rate. The priority classes are defined in logged_topics.cpp.
 
 ### Examples
 Typical usage to start logging immediately:
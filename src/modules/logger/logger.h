@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include "log_index.h"
 #include "log_writer.h"
 #include "logged_topics.h"
 #include "messages.h"
@@ -78,7 +79,47 @@ struct LoggerSubscription : public uORB::SubscriptionInterval {
 		uORB::SubscriptionInterval(id, interval_ms * 1000, instance)
 	{}
 
+	/**
+	 * Check the update interval against the logger loop time (avoids reading the clock for every subscription).
+	 */
+	bool due(hrt_abstime now) const { return now >= next_due(); }
+
+	/** earliest time for the next update */
+	hrt_abstime next_due() const { return _last_update + _interval_us; }
+
+	/**
+	 * Copy the struct if updated, for a subscription that is due(). Skips the separate advertised and interval checks.
+	 */
+	bool update_due(void *dst)
+	{
+		if (_subscription.updated() && _subscription.copy(dst)) {
+			advance_last_update();
+			return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Zero-copy access to the next message if updated, for a subscription that is due() (@see peek()).
+	 */
+	const void *peek_due()
+	{
+		const void *data = _subscription.updated() ? _subscription.peek() : nullptr;
+
+		if (data) {
+			advance_last_update();
+		}
+
+		return data;
+	}
+
 	uint8_t msg_id{MSG_ID_INVALID};
+	TopicPriority priority{TopicPriority::Normal};
+	uint8_t decimation_count{0}; ///< counts updates for decimation under backpressure
+#if defined(CONFIG_LOGGER_INDEX)
+	uint64_t first_offset{0}; ///< ULog stream offset of the first data message in the full log (0 = none yet)
+#endif // CONFIG_LOGGER_INDEX
 };
 
 class Logger : public ModuleBase, public ModuleParams
@@ -199,7 +240,6 @@ private:
 
 	/**
 	 * Write an ADD_LOGGED_MSG to the log for a given subscription and instance.
-	 * _writer.lock() must be held when calling this.
 	 */
 	void write_add_logged_msg(LogType type, LoggerSubscription &subscription);
 
@@ -218,6 +258,9 @@ private:
 	 */
 	int get_log_file_name(LogType type, char *file_name, size_t file_name_size, bool notify);
 
+	/** check if a log file of the given type is written compressed (not combined with encryption) */
+	bool log_file_compressed(LogType type) const;
+
 	void start_log_file(LogType type);
 
 	void stop_log_file(LogType type);
@@ -284,15 +327,98 @@ private:
 	void write_changed_parameters(LogType type);
 	void write_events_file(LogType type);
 
+	/**
+	 * Write an info multiple message with an array of uint64_t values, split into several messages if needed.
+	 * @param value function returning the i-th value
+	 */
+	template<typename F>
+	void write_info_multiple_uint64(LogType type, const char *name, int count, F value);
+
+#if defined(CONFIG_LOGGER_INDEX)
+	/**
+	 * Remember the stream offset of the first data message of a subscription in the full log.
+	 * @param offset stream offset before writing the message
+	 */
+	void index_topic(LoggerSubscription &sub, uint64_t offset)
+	{
+		if (sub.first_offset == 0) {
+			sub.first_offset = offset;
+		}
+	}
+
+	/**
+	 * Write the time index and the first offset of each topic as appended data at the end of the full log.
+	 */
+	void write_index_appendix();
+#endif // CONFIG_LOGGER_INDEX
+
 	inline bool copy_if_updated(int sub_idx, void *buffer, bool try_to_subscribe);
 
+	/**
+	 * Write a data message for a subscription to the full and mission log if updated (and subscribe if
+	 * try_to_subscribe is set and the subscription is not valid yet).
+	 * @param total_bytes incremented by the bytes written to the full log (DBGPRINT only)
+	 */
+	void write_if_updated(int sub_idx, hrt_abstime loop_time, bool zero_copy, bool try_to_subscribe, uint32_t &total_bytes);
+
+	/**
+	 * Group the subscriptions by interval, so that groups which are not due can be skipped as a whole.
+	 * @return false on allocation failure
+	 */
+	bool init_subscription_groups();
+
+	/**
+	 * Check all the subscriptions of a group in the next loop iteration.
+	 */
+	void set_subscription_group_due(uint32_t interval_us);
+
 	/**
 	 * Write exactly one ulog message to the logger and handle dropouts.
-	 * Must be called with _writer.lock() held.
 	 * @return true if data written, false otherwise (on overflow)
 	 */
 	bool write_message(LogType type, void *ptr, size_t size);
 
+	/**
+	 * Write a ulog data message with separate header and payload (see LogWriter::write_data_message()) and
+	 * handle dropouts. Must be followed by _writer.commit_last_data_message() or discard_last_data_message().
+	 * @return true if data written, false otherwise (on overflow)
+	 */
+	bool write_message(LogType type, const void *header, size_t header_size, const void *data, size_t data_size);
+
+	/**
+	 * Update the dropout statistics after a write.
+	 * @return write_succeeded
+	 */
+	bool handle_write_result(LogType type, bool write_succeeded);
+
+	/**
+	 * Log a subscription directly from the uORB queue (zero-copy), if updated.
+	 * Only valid if _writer.data_message_zero_copy() is true.
+	 * @param total_bytes incremented by the bytes written to the full log (DBGPRINT only)
+	 * @return true if a message was logged
+	 */
+	bool write_if_updated_zero_copy(int sub_idx, hrt_abstime loop_time, uint32_t &total_bytes);
+
+	/**
+	 * Check if the subscription is due to be written to the mission log and advance its next write time.
+	 */
+	bool mission_log_due(int sub_idx, hrt_abstime loop_time);
+
+	/**
+	 * Update the decimation level from the full log buffer fill level. Changes are recorded in the log.
+	 */
+	void update_backpressure(hrt_abstime now);
+
+	/**
+	 * Check if an update of a subscription is dropped from the full log due to backpressure decimation.
+	 */
+	bool decimated(LoggerSubscription &sub);
+
+	/**
+	 * Write a ulog logging message (text with log level).
+	 */
+	void write_logging_message(LogType type, uint8_t log_level, hrt_abstime timestamp, const char *message);
+
 	/**
 	 * Add topic subscriptions from SD file if it exists, otherwise add topics based on the configured profile.
 	 * This must be called before start_log() (because it does not write an ADD_LOGGED_MSG message).
@@ -360,6 +486,18 @@ private:
 
 	LoggerSubscription	 			*_subscriptions{nullptr}; ///< all subscriptions for full & mission log (in front)
 	int						_num_subscriptions{0};
+
+	/** subscriptions with the same interval, checked together */
+	struct SubscriptionGroup {
+		uint32_t interval_us;
+		uint8_t first; ///< index into _subscription_order
+		uint8_t count;
+		hrt_abstime next_due; ///< earliest time any (valid) subscription of the group is due
+	};
+
+	uint8_t						*_subscription_order{nullptr}; ///< subscription indexes, sorted by interval (at most MAX_TOPICS_NUM)
+	SubscriptionGroup				*_subscription_groups{nullptr};
+	int						_num_subscription_groups{0};
 	MissionSubscription 				_mission_subscriptions[MAX_MISSION_TOPICS_NUM] {}; ///< additional data for mission subscriptions
 	int						_num_mission_subs{0};
 	LoggerSubscription				_event_subscription; ///< Subscription for the event topic (handled separately)
@@ -389,6 +527,13 @@ private:
 
 	uint32_t					_message_gaps{0};
 
+#if defined(CONFIG_LOGGER_INDEX)
+	LogIndex					_log_index;
+#endif // CONFIG_LOGGER_INDEX
+
+	uint8_t						_decimation_level{0}; ///< current backpressure level (0 = no decimation)
+	hrt_abstime					_decimation_level_time{0}; ///< last time the buffer fill required the current level
+
 	timer_callback_data_s				_timer_callback_data{};
 
 	uORB::Subscription				_manual_control_setpoint_sub{ORB_ID(manual_control_setpoint)};
@@ -403,12 +548,16 @@ private:
 		(ParamInt<px4::params::SDLOG_PROFILE>) _param_sdlog_profile,
 		(ParamInt<px4::params::SDLOG_MISSION>) _param_sdlog_mission,
 		(ParamBool<px4::params::SDLOG_BOOT_BAT>) _param_sdlog_boot_bat,
-		(ParamBool<px4::params::SDLOG_UUID>) _param_sdlog_uuid
+		(ParamBool<px4::params::SDLOG_UUID>) _param_sdlog_uuid,
+		(ParamInt<px4::params::SDLOG_PREALLOC>) _param_sdlog_prealloc
 #if defined(PX4_CRYPTO)
 		, (ParamInt<px4::params::SDLOG_ALGORITHM>) _param_sdlog_crypto_algorithm,
 		(ParamInt<px4::params::SDLOG_KEY>) _param_sdlog_crypto_key,
 		(ParamInt<px4::params::SDLOG_EXCH_KEY>) _param_sdlog_crypto_exchange_key
 #endif // PX4_CRYPTO
+#if defined(CONFIG_LOGGER_COMPRESSION)
+		, (ParamBool<px4::params::SDLOG_COMPRESS>) _param_sdlog_compress
+#endif // CONFIG_LOGGER_COMPRESSION
 	)
 };
 
@@ -88,6 +88,27 @@ struct ulog_key_header_s {
 	uint8_t	data[0];
 };
 
+/** first bytes of a compressed log file (decompress with Tools/ulog_decompress.py) */
+struct ulog_compressed_header_s {
+	/* magic identifying the file content */
+	uint8_t magic[4];
+
+	/* version of the container format */
+	uint8_t hdr_ver;
+
+	/* heatshrink parameters */
+	uint8_t window_bits;
+	uint8_t lookahead_bits;
+
+	uint8_t reserved;
+};
+
+/** header of each independently compressed frame of a compressed log file */
+struct ulog_compressed_frame_header_s {
+	uint16_t compressed_size; ///< Size of the compressed data following the header
+	uint16_t uncompressed_size; ///< Size of the data after decompression
+};
+
 
 /**
  * @brief Message Header for the ULog
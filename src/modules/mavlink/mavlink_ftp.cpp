@@ -34,7 +34,6 @@
 /// @file mavlink_ftp.cpp
 ///	@author px4dev, Don Gagne <don@thegagnes.com>
 
-#include <crc32.h>
 #include <unistd.h>
 #include <stdio.h>
 #include <fcntl.h>
@@ -42,6 +41,12 @@
 #include <errno.h>
 #include <cstring>
 
+extern "C" {
+#include <lib/crc/crc.h>
+}
+
+#include <lib/mathlib/mathlib.h>
+
 #include "mavlink_ftp.h"
 #include "mavlink_tests/mavlink_ftp_test.h"
 
@@ -50,6 +55,8 @@
 using namespace time_literals;
 
 constexpr const char MavlinkFTP::_root_dir[];
+constexpr const char MavlinkFTP::_param_snapshot_name[];
+constexpr const char MavlinkFTP::_param_snapshot_file[];
 
 MavlinkFTP::MavlinkFTP(Mavlink &mavlink) :
 	_mavlink(mavlink)
@@ -62,6 +69,11 @@ MavlinkFTP::~MavlinkFTP()
 {
 	delete[] _work_buffer1;
 	delete[] _work_buffer2;
+	delete[] _burst_buffer;
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+	delete _burst_encoder;
+	delete[] _burst_compress_input;
+#endif
 }
 
 unsigned
@@ -219,10 +231,18 @@ MavlinkFTP::_process_request(
 		break;
 
 	case kCmdBurstReadFile:
-		errorCode = _workBurst(payload, target_system_id, target_comp_id);
+		errorCode = _workBurst(payload, target_system_id, target_comp_id, false);
 		stream_send = true;
 		break;
 
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+
+	case kCmdBurstReadFileCompressed:
+		errorCode = _workBurst(payload, target_system_id, target_comp_id, true);
+		stream_send = true;
+		break;
+#endif
+
 	case kCmdWriteFile:
 		errorCode = _workWrite(payload);
 		break;
@@ -508,7 +528,25 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 		return kErrNoSessionsAvailable;
 	}
 
-	_constructPath(_work_buffer1, _work_buffer1_len, _data_as_cstring(payload));
+	const char *path = _data_as_cstring(payload);
+	bool param_snapshot = false;
+
+	if (path[0] == '/') {
+		path++;
+	}
+
+	if (oflag == O_RDONLY && strcmp(path, _param_snapshot_name) == 0) {
+		if (!_paramSnapshotCreate()) {
+			return kErrFailErrno;
+		}
+
+		strncpy(_work_buffer1, _param_snapshot_file, _work_buffer1_len);
+		_work_buffer1[_work_buffer1_len - 1] = '\0';
+		param_snapshot = true;
+
+	} else {
+		_constructPath(_work_buffer1, _work_buffer1_len, _data_as_cstring(payload));
+	}
 
 	PX4_DEBUG("FTP: open '%s'", _work_buffer1);
 
@@ -538,12 +576,18 @@ MavlinkFTP::_workOpen(PayloadHeader *payload, int oflag)
 	if (fd < 0) {
 		_our_errno = errno;
 		PX4_ERR("open failed: %s", strerror(_our_errno));
+
+		if (param_snapshot) {
+			unlink(_param_snapshot_file);
+		}
+
 		return kErrFailErrno;
 	}
 
 	_session_info.fd = fd;
 	_session_info.file_size = fileSize;
 	_session_info.stream_download = false;
+	_session_param_snapshot = param_snapshot;
 
 	payload->session = 0;
 	payload->size = sizeof(uint32_t);
@@ -592,7 +636,8 @@ MavlinkFTP::_workRead(PayloadHeader *payload)
 
 /// @brief Responds to a Stream command
 MavlinkFTP::ErrorCode
-MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t target_component_id)
+MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t target_component_id,
+		       bool compressed)
 {
 	if (payload->session != 0 && _session_info.fd < 0) {
 		PX4_DEBUG("_workBurst: no session or no fd");
@@ -600,8 +645,47 @@ MavlinkFTP::_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t
 	}
 
 	PX4_DEBUG("FTP: burst offset:%" PRIu32, payload->offset);
+
+	if (!_burst_buffer) {
+		// if the allocation fails the file is read chunk by chunk
+		_burst_buffer = new uint8_t[_burst_buffer_len];
+	}
+
+	// the file might have been written since the last burst
+	_burst_buffer_fill = 0;
+
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+
+	if (compressed) {
+		if (!_burst_encoder) {
+			_burst_encoder = new heatshrink_encoder;
+		}
+
+		if (!_burst_compress_input) {
+			_burst_compress_input = new uint8_t[_burst_compress_input_max];
+		}
+
+		if (_session_info.stream_compress_input_size == 0) {
+			_session_info.stream_compress_input_size = 2 * kMaxDataLength;
+		}
+
+		if (!_burst_encoder || !_burst_compress_input) {
+			_our_errno = ENOMEM;
+			return kErrFailErrno;
+		}
+	}
+
+#endif
+
+	int32_t burst_window = 0;
+
+	if (param_get(param_find("MAV_FTP_BURST"), &burst_window) == PX4_OK && burst_window > 0) {
+		_burst_window = burst_window;
+	}
+
 	// Setup for streaming sends
 	_session_info.stream_download = true;
+	_session_info.stream_compressed = compressed;
 	_session_info.stream_offset = payload->offset;
 	_session_info.stream_chunk_transmitted = 0;
 	_session_info.stream_seq_number = payload->seq_number + 1;
@@ -631,6 +715,7 @@ MavlinkFTP::_workWrite(PayloadHeader *payload)
 	}
 
 	PX4_DEBUG("write %d bytes", payload->size);
+	_burst_buffer_fill = 0;
 	int bytes_written = ::write(_session_info.fd, &payload->data[0], payload->size);
 
 	if (bytes_written < 0) {
@@ -798,6 +883,8 @@ MavlinkFTP::_workTerminate(PayloadHeader *payload)
 	::close(_session_info.fd);
 	_session_info.fd = -1;
 	_session_info.stream_download = false;
+	_burstBufferFree();
+	_paramSnapshotRemove();
 
 	payload->size = 0;
 
@@ -816,6 +903,9 @@ MavlinkFTP::_workReset(PayloadHeader *payload)
 		_session_info.stream_download = false;
 	}
 
+	_burstBufferFree();
+	_paramSnapshotRemove();
+
 	payload->size = 0;
 
 	return kErrNone;
@@ -923,7 +1013,7 @@ MavlinkFTP::_workCalcFileCRC32(PayloadHeader *payload)
 			return kErrFailErrno;
 		}
 
-		checksum = crc32part((uint8_t *)_work_buffer2, bytes_read, checksum);
+		checksum = crc32_signature(checksum, bytes_read, (uint8_t *)_work_buffer2);
 	} while (bytes_read == _work_buffer2_len);
 
 	::close(fd);
@@ -1034,6 +1124,8 @@ void MavlinkFTP::send()
 			_session_info.fd = -1;
 			_session_info.stream_download = false;
 			_last_reply_valid = false;
+			_burstBufferFree();
+			_paramSnapshotRemove();
 			PX4_WARN("Session was closed without activity");
 		}
 	}
@@ -1069,7 +1161,7 @@ void MavlinkFTP::send()
 		payload->seq_number = _session_info.stream_seq_number;
 		payload->session = 0;
 		payload->opcode = kRspAck;
-		payload->req_opcode = kCmdBurstReadFile;
+		payload->req_opcode = _session_info.stream_compressed ? kCmdBurstReadFileCompressed : kCmdBurstReadFile;
 		payload->offset = _session_info.stream_offset;
 		_session_info.stream_seq_number++;
 
@@ -1082,14 +1174,20 @@ void MavlinkFTP::send()
 		}
 
 		if (error_code == kErrNone) {
-			if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-				error_code = kErrFailErrno;
-				PX4_WARN("stream download: seek fail");
-			}
-		}
+			int bytes_read;
+			unsigned file_bytes_read = 0;
 
-		if (error_code == kErrNone) {
-			int bytes_read = ::read(_session_info.fd, &payload->data[0], kMaxDataLength);
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+
+			if (_session_info.stream_compressed) {
+				bytes_read = _burstReadCompressed(payload->offset, &payload->data[0], file_bytes_read);
+
+			} else
+#endif
+			{
+				bytes_read = _burstRead(payload->offset, &payload->data[0], kMaxDataLength);
+				file_bytes_read = bytes_read;
+			}
 
 			if (bytes_read < 0) {
 				// Negative return indicates error other than eof
@@ -1098,7 +1196,7 @@ void MavlinkFTP::send()
 
 			} else {
 				payload->size = bytes_read;
-				_session_info.stream_offset += bytes_read;
+				_session_info.stream_offset += file_bytes_read;
 				_session_info.stream_chunk_transmitted += bytes_read;
 			}
 		}
@@ -1122,8 +1220,8 @@ void MavlinkFTP::send()
 			if (max_bytes_to_send < (get_size() * 2)) {
 				more_data = false;
 
-				/* perform transfers in 35K chunks - this is determined empirical */
-				if (_session_info.stream_chunk_transmitted > 35000) {
+				/* perform transfers in chunks of the burst window (35K by default, determined empirical) */
+				if (_session_info.stream_chunk_transmitted > _burst_window) {
 					payload->burst_complete = true;
 					_session_info.stream_download = false;
 					_session_info.stream_chunk_transmitted = 0;
@@ -1147,6 +1245,190 @@ void MavlinkFTP::send()
 	} while (more_data);
 }
 
+int MavlinkFTP::_burstRead(uint32_t offset, uint8_t *dst, unsigned len)
+{
+	if (!_burst_buffer) {
+		if (lseek(_session_info.fd, offset, SEEK_SET) < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		const int bytes_read = ::read(_session_info.fd, dst, len);
+
+		if (bytes_read < 0) {
+			_our_errno = errno;
+		}
+
+		return bytes_read;
+	}
+
+	if ((offset < _burst_buffer_offset) || (offset >= _burst_buffer_offset + _burst_buffer_fill)) {
+		// refill the read-ahead buffer starting at the requested offset
+		_burst_buffer_fill = 0;
+
+		if (lseek(_session_info.fd, offset, SEEK_SET) < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		const int bytes_read = ::read(_session_info.fd, _burst_buffer, _burst_buffer_len);
+
+		if (bytes_read < 0) {
+			_our_errno = errno;
+			return -1;
+		}
+
+		_burst_buffer_offset = offset;
+		_burst_buffer_fill = bytes_read;
+	}
+
+	const unsigned available = _burst_buffer_offset + _burst_buffer_fill - offset;
+	const unsigned bytes = (len < available) ? len : available;
+	memcpy(dst, &_burst_buffer[offset - _burst_buffer_offset], bytes);
+	return bytes;
+}
+
+void MavlinkFTP::_burstBufferFree()
+{
+	delete[] _burst_buffer;
+	_burst_buffer = nullptr;
+	_burst_buffer_fill = 0;
+
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+	delete _burst_encoder;
+	_burst_encoder = nullptr;
+	delete[] _burst_compress_input;
+	_burst_compress_input = nullptr;
+#endif
+}
+
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+/**
+ * Compress a buffer with heatshrink
+ * @return compressed size, or -1 if it does not fit into dst
+ */
+static int heatshrink_compress(heatshrink_encoder *hse, const uint8_t *src, unsigned src_len, uint8_t *dst,
+			       unsigned dst_len)
+{
+	heatshrink_encoder_reset(hse);
+
+	unsigned input_size = 0;
+	unsigned output_size = 0;
+
+	while (true) {
+		if (input_size < src_len) {
+			size_t sunk = 0;
+
+			// the encoder does not modify the input
+			if (heatshrink_encoder_sink(hse, const_cast<uint8_t *>(src + input_size), src_len - input_size, &sunk) < 0) {
+				return -1;
+			}
+
+			input_size += sunk;
+
+		} else if (heatshrink_encoder_finish(hse) == HSER_FINISH_DONE) {
+			return output_size;
+		}
+
+		HSE_poll_res poll_res;
+
+		do {
+			size_t n = 0;
+			poll_res = heatshrink_encoder_poll(hse, dst + output_size, dst_len - output_size, &n);
+			output_size += n;
+
+			if (poll_res < 0 || (poll_res == HSER_POLL_MORE && output_size >= dst_len)) {
+				return -1;
+			}
+
+		} while (poll_res == HSER_POLL_MORE);
+	}
+}
+
+int MavlinkFTP::_burstReadCompressed(uint32_t offset, uint8_t *dst, unsigned &uncompressed_len)
+{
+	unsigned input_size = _session_info.stream_compress_input_size;
+
+	// _burstRead() stops at the end of the read-ahead buffer
+	unsigned bytes_read = 0;
+
+	while (bytes_read < input_size) {
+		const int ret = _burstRead(offset + bytes_read, _burst_compress_input + bytes_read, input_size - bytes_read);
+
+		if (ret < 0) {
+			return -1;
+
+		} else if (ret == 0) {
+			break;
+		}
+
+		bytes_read += ret;
+	}
+
+	input_size = bytes_read;
+	bool retried = false;
+	int compressed_size;
+
+	// the compressed size is not known upfront: reduce the input until the chunk fits into the packet
+	while ((compressed_size = heatshrink_compress(_burst_encoder, _burst_compress_input, input_size,
+				  dst + _burst_compress_header_len, kMaxDataLength - _burst_compress_header_len)) < 0) {
+
+		if (input_size <= _burst_compress_input_min) {
+			// cannot happen, the minimum input size always fits
+			_our_errno = EIO;
+			return -1;
+		}
+
+		input_size = math::max(input_size * 3 / 4, _burst_compress_input_min);
+		_session_info.stream_compress_input_size = input_size;
+		retried = true;
+	}
+
+	if (!retried && input_size == _session_info.stream_compress_input_size) {
+		// it fit at the first try, try a bit more data for the next packet
+		_session_info.stream_compress_input_size = math::min(input_size + input_size / 8, _burst_compress_input_max);
+	}
+
+	dst[0] = input_size & 0xff;
+	dst[1] = (input_size >> 8) & 0xff;
+	dst[2] = (HEATSHRINK_STATIC_WINDOW_BITS << 4) | HEATSHRINK_STATIC_LOOKAHEAD_BITS;
+
+	uncompressed_len = input_size;
+	return _burst_compress_header_len + compressed_size;
+}
+#endif // CONFIG_MAVLINK_FTP_COMPRESSION
+
+bool MavlinkFTP::_paramSnapshotCreate()
+{
+	// create the file upfront: param_export() falls back to the flash storage if it can't open it
+	int fd = ::open(_param_snapshot_file, O_CREAT | O_TRUNC | O_WRONLY, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		_our_errno = errno;
+		PX4_ERR("param snapshot open failed: %s", strerror(_our_errno));
+		return false;
+	}
+
+	::close(fd);
+
+	if (param_export(_param_snapshot_file, nullptr) != PX4_OK) {
+		_our_errno = EIO;
+		PX4_ERR("param snapshot export failed");
+		unlink(_param_snapshot_file);
+		return false;
+	}
+
+	return true;
+}
+
+void MavlinkFTP::_paramSnapshotRemove()
+{
+	if (_session_param_snapshot) {
+		unlink(_param_snapshot_file);
+		_session_param_snapshot = false;
+	}
+}
+
 bool MavlinkFTP::_validatePathIsWritable(const char *path)
 {
 #ifdef __PX4_NUTTX
@@ -45,6 +45,11 @@
 
 #include "mavlink_bridge_header.h"
 
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+#define HEATSHRINK_DYNAMIC_ALLOC 0
+#include <lib/heatshrink/heatshrink/heatshrink_encoder.h>
+#endif
+
 class MavlinkFtpTest;
 class Mavlink;
 
@@ -104,6 +109,7 @@ public:
 		kCmdRename,		///< Rename <path1> to <path2>
 		kCmdCalcFileCRC32,	///< Calculate CRC32 for file at <path>
 		kCmdBurstReadFile,	///< Burst download session file
+		kCmdBurstReadFileCompressed,	///< Burst download session file, heatshrink compressed (PX4 extension)
 
 		kRspAck = 128,		///< Ack response
 		kRspNak			///< Nak response
@@ -136,7 +142,8 @@ private:
 	ErrorCode	_workList(PayloadHeader *payload);
 	ErrorCode	_workOpen(PayloadHeader *payload, int oflag);
 	ErrorCode	_workRead(PayloadHeader *payload);
-	ErrorCode	_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t target_component_id);
+	ErrorCode	_workBurst(PayloadHeader *payload, uint8_t target_system_id, uint8_t target_component_id,
+				   bool compressed);
 	ErrorCode	_workWrite(PayloadHeader *payload);
 	ErrorCode	_workTerminate(PayloadHeader *payload);
 	ErrorCode	_workReset(PayloadHeader *payload);
@@ -164,6 +171,40 @@ private:
 	 */
 	bool _ensure_buffers_exist();
 
+	/**
+	 * Read file data of the current session for a burst download through the read-ahead buffer.
+	 * @return number of bytes copied to dst, or -1 on error (errno in _our_errno)
+	 */
+	int _burstRead(uint32_t offset, uint8_t *dst, unsigned len);
+
+	/**
+	 * Free the read-ahead buffer, called when the session is closed
+	 */
+	void _burstBufferFree();
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+	/**
+	 * Read and compress the next chunk of a compressed burst download, so that it fits into one packet.
+	 * The data starts with the uncompressed length (uint16) and the heatshrink window and lookahead bits
+	 * (4 bits each), followed by the independently compressed chunk.
+	 * @param offset file offset of the chunk
+	 * @param dst packet data
+	 * @param uncompressed_len [out] number of file bytes in the chunk
+	 * @return number of bytes written to dst, or -1 on error (_our_errno is set)
+	 */
+	int _burstReadCompressed(uint32_t offset, uint8_t *dst, unsigned &uncompressed_len);
+#endif
+
+	/**
+	 * Export the changed parameters to _param_snapshot_file (BSON, same format as the parameter file)
+	 * @return true on success
+	 */
+	bool _paramSnapshotCreate();
+
+	/**
+	 * Remove the parameter snapshot file if the current session was opened on it
+	 */
+	void _paramSnapshotRemove();
+
 	static const char	kDirentFile = 'F';	///< Identifies File returned from List command
 	static const char	kDirentDir = 'D';	///< Identifies Directory returned from List command
 	static const char	kDirentSkip = 'S';	///< Identifies Skipped entry from List command
@@ -180,6 +221,8 @@ private:
 		uint8_t		stream_target_system_id;
 		uint8_t         stream_target_component_id;
 		unsigned	stream_chunk_transmitted;
+		bool		stream_compressed;
+		unsigned	stream_compress_input_size;	///< number of file bytes compressed into the next packet
 	};
 	struct SessionInfo _session_info {};	///< Session info, fd=-1 for no active session
 
@@ -199,6 +242,32 @@ private:
 	static constexpr int _work_buffer2_len = 256;
 	hrt_abstime _last_work_buffer_access{0}; ///< timestamp when the buffers were last accessed
 
+	/* read-ahead buffer for burst downloads, allocated with the first burst of a session */
+	uint8_t *_burst_buffer{nullptr};
+#if defined(__PX4_NUTTX)
+	static constexpr unsigned _burst_buffer_len = 2048;
+#else
+	static constexpr unsigned _burst_buffer_len = 16384;
+#endif
+	uint32_t _burst_buffer_offset{0}; ///< file offset of the first byte in _burst_buffer
+	unsigned _burst_buffer_fill{0}; ///< number of valid bytes in _burst_buffer
+	uint32_t _burst_window{35000}; ///< number of bytes sent per burst (MAV_FTP_BURST)
+
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+	/* encoder for compressed burst downloads, allocated with the first compressed burst of a session */
+	heatshrink_encoder *_burst_encoder{nullptr};
+	uint8_t *_burst_compress_input{nullptr};
+	static constexpr unsigned _burst_compress_header_len = 3;
+	static constexpr unsigned _burst_compress_input_max = 1024;
+	/* worst case: every byte is a literal (9 bits), so this input size always fits into a packet */
+	static constexpr unsigned _burst_compress_input_min = (kMaxDataLength - _burst_compress_header_len - 1) * 8 / 9;
+#endif
+
+	/* virtual file to download all changed parameters in one transfer, generated when it's opened */
+	static constexpr const char _param_snapshot_name[] = "@PARAM/param.pck";
+	static constexpr const char _param_snapshot_file[] = PX4_STORAGEDIR "/.mavftp_param.pck";
+	bool _session_param_snapshot{false}; ///< true if the current session reads _param_snapshot_file
+
 	// prepend a root directory to each file/dir access to avoid enumerating the full FS tree (e.g. on Linux).
 	// Note that requests can still fall outside of the root dir by using ../..
 #ifdef MAVLINK_FTP_UNIT_TEST
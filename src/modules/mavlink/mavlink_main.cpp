@@ -452,6 +452,20 @@ Mavlink::component_was_seen(int system_id, int component_id, Mavlink &self)
 void
 Mavlink::forward_message(const mavlink_message_t *msg, Mavlink *self)
 {
+	// Avoid the message lookup, locking and iteration when there is no instance to forward to.
+	if (mavlink_instance_count.load() <= 1) {
+		return;
+	}
+
+	// We don't forward heartbeats unless it's specifically enabled.
+	if (msg->msgid == MAVLINK_MSG_ID_HEARTBEAT && !self->forward_heartbeats_enabled()) {
+		return;
+	}
+
+	if (self->get_mode() == MAVLINK_MODE_LOW_BANDWIDTH && msg->msgid == MAVLINK_MSG_ID_ONBOARD_COMPUTER_STATUS) {
+		return;
+	}
+
 	const mavlink_msg_entry_t *meta = mavlink_get_msg_entry(msg->msgid);
 
 	int target_system_id = 0;
@@ -469,25 +483,11 @@ Mavlink::forward_message(const mavlink_message_t *msg, Mavlink *self)
 		}
 	}
 
-	// Avoid locking/iteration when there is no instance to forward to.
-	if (mavlink_instance_count.load() <= 1) {
-		return;
-	}
-
 	// If it's a message only for us, we keep it
 	if (target_system_id == self->get_system_id() && target_component_id == self->get_component_id()) {
 		return;
 	}
 
-	// We don't forward heartbeats unless it's specifically enabled.
-	if (msg->msgid == MAVLINK_MSG_ID_HEARTBEAT && !self->forward_heartbeats_enabled()) {
-		return;
-	}
-
-	if (self->get_mode() == MAVLINK_MODE_LOW_BANDWIDTH && msg->msgid == MAVLINK_MSG_ID_ONBOARD_COMPUTER_STATUS) {
-		return;
-	}
-
 	LockGuard lg{mavlink_module_mutex};
 
 	for (Mavlink *inst : mavlink_module_instances) {
@@ -769,6 +769,27 @@ void Mavlink::send_finish()
 		return;
 	}
 
+	_bytes_tx_total.fetch_add(_buf_fill);
+
+#if defined(MAVLINK_UDP_TX_BATCH)
+
+	if (get_protocol() == Protocol::UDP) {
+		// queue the packet, the queue is sent at the end of the main loop iteration or once it is full
+		memcpy(_udp_tx_batch[_udp_tx_batch_count], _buf, _buf_fill);
+		_udp_tx_batch_len[_udp_tx_batch_count] = _buf_fill;
+		_udp_tx_batch_count++;
+		_buf_fill = 0;
+
+		if (_udp_tx_batch_count >= UDP_TX_BATCH_SIZE) {
+			udp_send_batch();
+		}
+
+		pthread_mutex_unlock(&_send_mutex);
+		return;
+	}
+
+#endif // MAVLINK_UDP_TX_BATCH
+
 	int ret = -1;
 
 	// send message to UART
@@ -843,6 +864,87 @@ void Mavlink::send_bytes(const uint8_t *buf, unsigned packet_len)
 	}
 }
 
+#if defined(MAVLINK_UDP_TX_BATCH)
+void Mavlink::udp_send_batch()
+{
+	const unsigned count = _udp_tx_batch_count;
+
+	if (count == 0) {
+		return;
+	}
+
+	iovec iov[UDP_TX_BATCH_SIZE];
+	mmsghdr msgs[UDP_TX_BATCH_SIZE] {};
+
+	for (unsigned i = 0; i < count; i++) {
+		iov[i].iov_base = _udp_tx_batch[i];
+		iov[i].iov_len = _udp_tx_batch_len[i];
+		msgs[i].msg_hdr.msg_iov = &iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	// returns the number of packets sent
+	auto send_to = [&](sockaddr_in & addr) {
+		for (unsigned i = 0; i < count; i++) {
+			msgs[i].msg_hdr.msg_name = &addr;
+			msgs[i].msg_hdr.msg_namelen = sizeof(addr);
+		}
+
+		unsigned sent = 0;
+
+		while (sent < count) {
+			const int ret = sendmmsg(_socket_fd, &msgs[sent], count - sent, 0);
+
+			if (ret <= 0) {
+				break;
+			}
+
+			sent += ret;
+		}
+
+		return sent;
+	};
+
+	const unsigned sent = send_to(_src_addr);
+
+	for (unsigned i = 0; i < count; i++) {
+		if (i < sent) {
+			_tstatus.tx_message_count++;
+			count_txbytes(_udp_tx_batch_len[i]);
+
+		} else {
+			count_txerrbytes(_udp_tx_batch_len[i]);
+		}
+	}
+
+	if (sent > 0) {
+		_last_write_success_time = _last_write_try_time;
+	}
+
+	if ((_mode != MAVLINK_MODE_ONBOARD) && broadcast_enabled() &&
+	    (!get_client_source_initialized() || !is_gcs_connected())) {
+
+		if (!_broadcast_address_found) {
+			find_broadcast_address();
+		}
+
+		if (_broadcast_address_found) {
+			if (send_to(_bcast_addr) == 0) {
+				if (!_broadcast_failed_warned) {
+					PX4_ERR("sending broadcast failed, errno: %d: %s", errno, strerror(errno));
+					_broadcast_failed_warned = true;
+				}
+
+			} else {
+				_broadcast_failed_warned = false;
+			}
+		}
+	}
+
+	_udp_tx_batch_count = 0;
+}
+#endif // MAVLINK_UDP_TX_BATCH
+
 #ifdef MAVLINK_UDP
 void Mavlink::find_broadcast_address()
 {
@@ -1012,6 +1114,15 @@ void Mavlink::init_udp()
 		return;
 	}
 
+#if defined(MAVLINK_UDP_RX_TIMESTAMP)
+	int timestamp_opt = 1;
+
+	if (setsockopt(_socket_fd, SOL_SOCKET, SO_TIMESTAMPNS, &timestamp_opt, sizeof(timestamp_opt)) < 0) {
+		PX4_WARN("enabling receive timestamps failed");
+	}
+
+#endif // MAVLINK_UDP_RX_TIMESTAMP
+
 	/* set default target address, but not for onboard mode (will be set on first received packet) */
 	if (!_src_addr_initialized) {
 		_src_addr.sin_family = AF_INET;
@@ -1294,18 +1405,27 @@ void
 Mavlink::update_rate_mult()
 {
 	float const_rate = 0.0f;
-	float rate = 0.0f;
+	float rate_essential = 0.0f;
+	float rate_bulk = 0.0f;
 
 	/* scale down rates if their theoretical bandwidth is exceeding the link bandwidth */
 	for (const auto &stream : _streams) {
+		const int interval = stream->get_interval();
+		const float stream_rate = (interval > 0) ? stream->get_size_avg() * 1000000.0f / interval : 0.f;
+
 		if (stream->const_rate()) {
-			const_rate += (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+			const_rate += stream_rate;
+
+		} else if (stream->essential()) {
+			rate_essential += stream_rate;
 
 		} else {
-			rate += (stream->get_interval() > 0) ? stream->get_size_avg() * 1000000.0f / stream->get_interval() : 0;
+			rate_bulk += stream_rate;
 		}
 	}
 
+	const float rate = rate_essential + rate_bulk;
+
 	float mavlink_ulog_streaming_rate_inv = 1.0f;
 
 	if (_mavlink_ulog) {
@@ -1356,11 +1476,41 @@ Mavlink::update_rate_mult()
 		PX4_ERR("instance %d: RADIO_STATUS timeout", _instance_id);
 	}
 
+	const float rate_mult_essential_prev = _rate_mult_essential;
+	const float rate_mult_bulk_prev = _rate_mult_bulk;
+
 	/* pick the minimum from bandwidth mult and hardware mult as limit */
 	_rate_mult = fminf(bandwidth_mult, hardware_mult);
 
 	/* ensure the rate multiplier never drops below 5% so that something is always sent */
 	_rate_mult = math::constrain(_rate_mult, 0.05f, 1.0f);
+
+	/* distribute the available bandwidth, the bulk streams back off first down to the minimum multiplier */
+	static constexpr float RATE_MULT_MIN = 0.05f;
+	const float rate_available = _rate_mult * rate;
+
+	if ((rate_bulk > 0.f) && (rate_available - rate_essential >= RATE_MULT_MIN * rate_bulk)) {
+		_rate_mult_essential = 1.f;
+		_rate_mult_bulk = (rate_available - rate_essential) / rate_bulk;
+
+	} else if (rate_essential > 0.f) {
+		_rate_mult_essential = (rate_available - RATE_MULT_MIN * rate_bulk) / rate_essential;
+		_rate_mult_bulk = RATE_MULT_MIN;
+
+	} else {
+		_rate_mult_essential = _rate_mult;
+		_rate_mult_bulk = _rate_mult;
+	}
+
+	_rate_mult_essential = math::constrain(_rate_mult_essential, RATE_MULT_MIN, 1.0f);
+	_rate_mult_bulk = math::constrain(_rate_mult_bulk, RATE_MULT_MIN, 1.0f);
+
+	/* the streams cache their next update time, which is too late if the rates got faster */
+	if ((_rate_mult_essential > rate_mult_essential_prev) || (_rate_mult_bulk > rate_mult_bulk_prev)) {
+		for (const auto &stream : _streams) {
+			stream->reset_next_update();
+		}
+	}
 }
 
 void
@@ -2383,6 +2533,16 @@ Mavlink::task_main(int argc, char *argv[])
 			handleStatus();
 			handleCommands();
 			handleAndGetCurrentCommandAck();
+
+#if defined(MAVLINK_UDP_TX_BATCH)
+
+			if (get_protocol() == Protocol::UDP) {
+				pthread_mutex_lock(&_send_mutex);
+				udp_send_batch();
+				pthread_mutex_unlock(&_send_mutex);
+			}
+
+#endif // MAVLINK_UDP_TX_BATCH
 			continue;
 		}
 
@@ -2412,9 +2572,11 @@ Mavlink::task_main(int argc, char *argv[])
 
 		check_requested_subscriptions();
 
-		/* update streams */
+		/* update streams, skipping the ones that are not due yet */
 		for (const auto &stream : _streams) {
-			stream->update(t);
+			if (stream->update_due(t)) {
+				stream->update(t);
+			}
 
 			if (!_first_heartbeat_sent) {
 				if (_mode == MAVLINK_MODE_IRIDIUM) {
@@ -2491,6 +2653,16 @@ Mavlink::task_main(int argc, char *argv[])
 			}
 		}
 
+#if defined(MAVLINK_UDP_TX_BATCH)
+
+		if (get_protocol() == Protocol::UDP) {
+			pthread_mutex_lock(&_send_mutex);
+			udp_send_batch();
+			pthread_mutex_unlock(&_send_mutex);
+		}
+
+#endif // MAVLINK_UDP_TX_BATCH
+
 		/* update TX/RX rates*/
 		if (t > _bytes_timestamp + 1_s) {
 			if (_bytes_timestamp != 0) {
@@ -3042,7 +3214,8 @@ Mavlink::display_status()
 	printf("\trates:\n");
 	printf("\t  tx: %.1f B/s\n", (double)_tstatus.tx_rate_avg);
 	printf("\t  txerr: %.1f B/s\n", (double)_tstatus.tx_error_rate_avg);
-	printf("\t  tx rate mult: %.3f\n", (double)_rate_mult);
+	printf("\t  tx rate mult: %.3f (essential %.3f, other %.3f)\n", (double)_rate_mult, (double)_rate_mult_essential,
+	       (double)_rate_mult_bulk);
 	printf("\t  tx rate max: %i B/s\n", _datarate);
 	printf("\t  rx: %.1f B/s\n", (double)_tstatus.rx_rate_avg);
 	printf("\t  rx loss: %.1f%%\n", (double)_tstatus.rx_message_lost_rate);
@@ -3109,9 +3282,8 @@ Mavlink::display_status()
 void
 Mavlink::display_status_streams()
 {
-	printf("\t%-20s%-16s %s\n", "Name", "Rate Config (current) [Hz]", "Message Size (if active) [B]");
-
-	const float rate_mult = _rate_mult;
+	printf("\t%-30s%-26s %8s %10s %10s %s\n", "Name", "Rate Config (current) [Hz]", "Size [B]", "Sent [B]",
+	       "send() [us]", "(max)");
 
 	for (const auto &stream : _streams) {
 		const int interval = stream->get_interval();
@@ -3125,18 +3297,15 @@ Mavlink::display_status_streams()
 			float rate = 1000000.0f / (float)interval;
 			// Note that the actual current rate can be lower if the associated uORB topic updates at a
 			// lower rate.
-			float rate_current = stream->const_rate() ? rate : rate * rate_mult;
+			float rate_current = stream->const_rate() ? rate : rate * get_rate_mult(stream->essential());
 			snprintf(rate_str, sizeof(rate_str), "%6.2f (%.3f)", (double)rate, (double)rate_current);
 		}
 
-		printf("\t%-30s%-16s", stream->get_name(), rate_str);
+		const uint32_t send_count = stream->send_count();
+		const unsigned send_time_avg = send_count > 0 ? stream->send_time_total() / send_count : 0;
 
-		if (size > 0) {
-			printf(" %3u\n", size);
-
-		} else {
-			printf("\n");
-		}
+		printf("\t%-30s%-26s %8u %10" PRIu32 " %10u %" PRIu32 "\n", stream->get_name(), rate_str, size,
+		       stream->bytes_sent(), send_time_avg, stream->send_time_max());
 	}
 }
 
@@ -96,6 +96,14 @@
 # define DEFAULT_REMOTE_PORT_UDP 14550 ///< GCS port per MAVLink spec
 #endif // CONFIG_NET || __PX4_POSIX
 
+#if defined(MAVLINK_UDP) && defined(__PX4_LINUX)
+# define MAVLINK_UDP_TX_BATCH ///< UDP packets are collected per main loop iteration and sent with sendmmsg()
+#endif // MAVLINK_UDP && __PX4_LINUX
+
+#if defined(MAVLINK_UDP) && defined(__PX4_LINUX) && !defined(ENABLE_LOCKSTEP_SCHEDULER)
+# define MAVLINK_UDP_RX_TIMESTAMP ///< UDP datagrams are timestamped by the kernel on reception (SO_TIMESTAMPNS)
+#endif // MAVLINK_UDP && __PX4_LINUX && !ENABLE_LOCKSTEP_SCHEDULER
+
 enum class Protocol {
 	SERIAL = 0,
 #if defined(MAVLINK_UDP)
@@ -380,6 +388,11 @@ public:
 
 	float			get_rate_mult() const { return _rate_mult; }
 
+	/**
+	 * @return rate multiplier of the (non constant rate) essential or bulk streams
+	 */
+	float			get_rate_mult(bool essential) const { return essential ? _rate_mult_essential : _rate_mult_bulk; }
+
 	float			get_baudrate() { return _baudrate; }
 
 	/* Functions for waiting to start transmission until message received. */
@@ -394,6 +407,11 @@ public:
 	 */
 	void			count_txbytes(unsigned n) { _bytes_tx += n; };
 
+	/**
+	 * @return total number of bytes handed to the link since start (wraps around), used for the stream accounting
+	 */
+	uint32_t		get_tx_bytes_total() const { return _bytes_tx_total.load(); }
+
 	/**
 	 * Count bytes not transmitted because of errors
 	 */
@@ -555,7 +573,9 @@ private:
 
 	int			_baudrate{57600};
 	int			_datarate{1000};		///< data rate for normal streams (attitude, position, etc.)
-	float			_rate_mult{1.0f};
+	float			_rate_mult{1.0f};		///< fraction of the requested non constant rate bandwidth that fits the link
+	float			_rate_mult_essential{1.0f};
+	float			_rate_mult_bulk{1.0f};
 	float			_high_latency_freq{0.015f};	///< frequency of HIGH_LATENCY2 stream
 
 	bool			_radio_status_available{false};
@@ -582,6 +602,7 @@ private:
 
 	unsigned		_bytes_tx{0};
 	unsigned		_bytes_txerr{0};
+	px4::atomic<uint32_t>	_bytes_tx_total{0};
 	unsigned		_bytes_rx{0};
 	hrt_abstime		_bytes_timestamp{0};
 
@@ -604,6 +625,14 @@ private:
 	uint8_t			_buf[MAVLINK_MAX_PACKET_LEN] {};
 	unsigned		_buf_fill{0};
 
+#if defined(MAVLINK_UDP_TX_BATCH)
+	static constexpr unsigned UDP_TX_BATCH_SIZE{32};
+
+	uint8_t			_udp_tx_batch[UDP_TX_BATCH_SIZE][MAVLINK_MAX_PACKET_LEN] {};
+	unsigned		_udp_tx_batch_len[UDP_TX_BATCH_SIZE] {};
+	unsigned		_udp_tx_batch_count{0};
+#endif // MAVLINK_UDP_TX_BATCH
+
 	bool			_tx_buffer_low{false};
 
 	const char 		*_interface_name{nullptr};
@@ -704,6 +733,13 @@ private:
 	void init_udp();
 #endif // MAVLINK_UDP
 
+#if defined(MAVLINK_UDP_TX_BATCH)
+	/**
+	 * Send all the queued UDP packets with as few syscalls as possible, must be called with _send_mutex held.
+	 */
+	void udp_send_batch();
+#endif // MAVLINK_UDP_TX_BATCH
+
 
 	bool set_channel();
 
@@ -154,6 +154,7 @@
 # include "streams/ODOMETRY.hpp"
 # include "streams/SCALED_PRESSURE2.hpp"
 # include "streams/SCALED_PRESSURE3.hpp"
+# include "streams/TELEMETRY_BUNDLE.hpp"
 # include "streams/UAVIONIX_ADSB_OUT_CFG.hpp"
 # include "streams/UAVIONIX_ADSB_OUT_DYNAMIC.hpp"
 #endif // !CONSTRAINED_FLASH
@@ -433,6 +434,9 @@ static const StreamListItem streams_list[] = {
 #if defined(HIGH_LATENCY2_HPP)
 	create_stream_list_item<MavlinkStreamHighLatency2>(),
 #endif // HIGH_LATENCY2_HPP
+#if defined(TELEMETRY_BUNDLE_HPP)
+	create_stream_list_item<MavlinkStreamTelemetryBundle>(),
+#endif // TELEMETRY_BUNDLE_HPP
 #if defined(HIL_STATE_QUATERNION_HPP)
 	create_stream_list_item<MavlinkStreamHILStateQuaternion>(),
 #endif // HIL_STATE_QUATERNION_HPP
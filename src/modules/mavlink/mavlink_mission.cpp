@@ -1139,6 +1139,13 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 
 			_transfer_current_crc32 = crc32_for_mission_item(wp, _transfer_current_crc32);
 
+			// Request the next item before writing this one to storage, so that the round trip to the
+			// GCS overlaps with the (potentially slow) dataman write. Messages are handled sequentially,
+			// so the next item is only processed once this one is written.
+			if (wp.seq + 1 < _transfer_count) {
+				send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, wp.seq + 1);
+			}
+
 			bool write_failed = false;
 			bool check_failed = false;
 
@@ -1307,10 +1314,6 @@ MavlinkMissionManager::handle_mission_item_both(const mavlink_message_t *msg)
 				}
 
 				_transfer_in_progress = false;
-
-			} else {
-				/* request next item */
-				send_mission_request(_transfer_partner_sysid, _transfer_partner_compid, _transfer_seq);
 			}
 
 		} else {
@@ -154,3 +154,43 @@ PARAM_DEFINE_INT32(MAV_HB_FORW_EN, 1);
  * @max 250
  */
 PARAM_DEFINE_INT32(MAV_RADIO_TOUT, 5);
+
+/**
+ * MAVLink FTP burst window
+ *
+ * Number of bytes sent in a single burst of a MAVLink FTP file download,
+ * before the ground station has to request the next one. A bigger window
+ * reduces the number of round trips on fast links (USB, Ethernet).
+ *
+ * @group MAVLink
+ * @unit B
+ * @min 1000
+ * @max 1000000
+ */
+PARAM_DEFINE_INT32(MAV_FTP_BURST, 35000);
+
+/**
+ * Topics of the TELEMETRY_BUNDLE stream
+ *
+ * Topics that are delta-encoded and packed into TUNNEL messages by the
+ * TELEMETRY_BUNDLE stream for high latency links. The stream is not enabled
+ * by default, use e.g. 'mavlink stream -d <device> -s TELEMETRY_BUNDLE -r 1'.
+ *
+ * @min 0
+ * @max 4095
+ * @bit 0 vehicle_global_position
+ * @bit 1 vehicle_attitude
+ * @bit 2 vehicle_status
+ * @bit 3 vehicle_air_data
+ * @bit 4 airspeed_validated
+ * @bit 5 wind
+ * @bit 6 home_position
+ * @bit 7 failsafe_flags
+ * @bit 8 mission_result
+ * @bit 9 vehicle_land_detected
+ * @bit 10 geofence_result
+ * @bit 11 cpuload
+ * @reboot_required true
+ * @group MAVLink
+ */
+PARAM_DEFINE_INT32(MAV_BUNDLE_TOPICS, 335);
@@ -3154,6 +3154,57 @@ void MavlinkReceiver::handle_message_open_drone_id_system(
 
 	_open_drone_id_system_pub.publish(odid_system);
 }
+#if defined(MAVLINK_UDP_RX_TIMESTAMP)
+ssize_t
+MavlinkReceiver::receive_timestamped(uint8_t *buf, size_t len, struct sockaddr_in &srcaddr)
+{
+	struct iovec iov {};
+	iov.iov_base = buf;
+	iov.iov_len = len;
+
+	union {
+		char buf[CMSG_SPACE(sizeof(struct timespec))];
+		struct cmsghdr align;
+	} control {};
+
+	struct msghdr msg {};
+	msg.msg_name = &srcaddr;
+	msg.msg_namelen = sizeof(srcaddr);
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control.buf;
+	msg.msg_controllen = sizeof(control.buf);
+
+	const ssize_t nread = recvmsg(_mavlink.get_socket_fd(), &msg, 0);
+
+	hrt_abstime receive_time = 0;
+
+	for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); nread > 0 && cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+			struct timespec kernel_ts;
+			memcpy(&kernel_ts, CMSG_DATA(cmsg), sizeof(kernel_ts));
+
+			// the kernel timestamp is in CLOCK_REALTIME, convert it using the time elapsed since reception
+			struct timespec now_ts;
+			clock_gettime(CLOCK_REALTIME, &now_ts);
+			const hrt_abstime now = hrt_absolute_time();
+
+			const int64_t age = (int64_t)(now_ts.tv_sec - kernel_ts.tv_sec) * 1000000
+					    + (now_ts.tv_nsec - kernel_ts.tv_nsec) / 1000;
+
+			if (age >= 0 && age < (int64_t)1_s && (hrt_abstime)age < now) {
+				receive_time = now - age;
+			}
+		}
+	}
+
+	// used by the timesync to remove the scheduling latency of this thread from the round trip
+	_mavlink_timesync.set_receive_time(receive_time);
+
+	return nread;
+}
+#endif // MAVLINK_UDP_RX_TIMESTAMP
+
 void
 MavlinkReceiver::run()
 {
@@ -3188,7 +3239,9 @@ MavlinkReceiver::run()
 
 #if defined(MAVLINK_UDP)
 	struct sockaddr_in srcaddr = {};
+#if !defined(MAVLINK_UDP_RX_TIMESTAMP)
 	socklen_t addrlen = sizeof(srcaddr);
+#endif // !MAVLINK_UDP_RX_TIMESTAMP
 
 	if (_mavlink.get_protocol() == Protocol::UDP) {
 		fds[0].fd = _mavlink.get_socket_fd();
@@ -3228,7 +3281,11 @@ MavlinkReceiver::run()
 
 			else if (_mavlink.get_protocol() == Protocol::UDP) {
 				if (fds[0].revents & POLLIN) {
+#if defined(MAVLINK_UDP_RX_TIMESTAMP)
+					nread = receive_timestamped(buf, sizeof(buf), srcaddr);
+#else
 					nread = recvfrom(_mavlink.get_socket_fd(), buf, sizeof(buf), 0, (struct sockaddr *)&srcaddr, &addrlen);
+#endif // MAVLINK_UDP_RX_TIMESTAMP
 				}
 
 				struct sockaddr_in &srcaddr_last = _mavlink.get_client_source_address();
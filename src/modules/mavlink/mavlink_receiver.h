@@ -143,6 +143,13 @@ private:
 	static void *start_trampoline(void *context);
 	void run();
 
+#if defined(MAVLINK_UDP_RX_TIMESTAMP)
+	/**
+	 * recvfrom() replacement that also passes the kernel receive timestamp of the datagram to the timesync
+	 */
+	ssize_t receive_timestamped(uint8_t *buf, size_t len, struct sockaddr_in &srcaddr);
+#endif // MAVLINK_UDP_RX_TIMESTAMP
+
 	void acknowledge(uint8_t sysid, uint8_t compid, uint16_t command, uint8_t result, uint8_t progress = 0);
 
 	/**
@@ -44,12 +44,49 @@
 #include "mavlink_stream.h"
 #include "mavlink_main.h"
 
+#include <px4_platform_common/memory_pool.h>
+
+static px4::PoolAllocator stream_allocator{"mavlink_streams"};
+
+void *MavlinkStream::operator new (size_t size) noexcept
+{
+	return stream_allocator.allocate(size);
+}
+
+void MavlinkStream::operator delete (void *ptr)
+{
+	px4::PoolAllocator::deallocate(ptr);
+}
+
 MavlinkStream::MavlinkStream(Mavlink *mavlink) :
 	_mavlink(mavlink)
 {
 	_last_sent = hrt_absolute_time();
 }
 
+bool
+MavlinkStream::send_accounted()
+{
+	const uint32_t bytes_before = _mavlink->get_tx_bytes_total();
+	const hrt_abstime start = hrt_absolute_time();
+
+	const bool sent = send();
+
+	const uint32_t elapsed = hrt_elapsed_time(&start);
+	_send_count++;
+	_send_time_total += elapsed;
+
+	if (elapsed > _send_time_max) {
+		_send_time_max = elapsed;
+	}
+
+	// this includes bytes sent concurrently by the receiver thread (parameters, mission, ftp, ...),
+	// which is negligible compared to the stream traffic
+	_bytes_sent += _mavlink->get_tx_bytes_total() - bytes_before;
+
+	return sent;
+}
+
 /**
  * Update subscriptions and send message if necessary
  */
@@ -64,7 +101,7 @@ MavlinkStream::update(const hrt_abstime &t)
 		// this will give different messages on the same run a different
 		// initial timestamp which will help spacing them out
 		// on the link scheduling
-		if (send()) {
+		if (send_accounted()) {
 			_last_sent = hrt_absolute_time();
 
 			if (!_first_message_sent) {
@@ -75,24 +112,30 @@ MavlinkStream::update(const hrt_abstime &t)
 		return 0;
 	}
 
-	// One of the previous iterations sent the update
-	// already before the deadline
-	if (_last_sent > t) {
-		return -1;
-	}
-
-	int64_t dt = t - _last_sent;
 	int interval = _interval;
 
 	if (!const_rate()) {
-		interval /= _mavlink->get_rate_mult();
+		interval /= _mavlink->get_rate_mult(essential());
 	}
 
 	// We don't need to send anything if the inverval is 0. send() will be called manually.
 	if (interval == 0) {
+		schedule_next_update(UINT64_MAX);
 		return 0;
 	}
 
+	// messages are sent early by up to 30% of the main loop delay (see below)
+	const int64_t early = (_mavlink->get_main_loop_delay() / 10) * 3;
+
+	// One of the previous iterations sent the update
+	// already before the deadline
+	if (_last_sent > t) {
+		schedule_next_update(_last_sent + interval - early + 1);
+		return -1;
+	}
+
+	int64_t dt = t - _last_sent;
+
 	const bool unlimited_rate = interval < 0;
 
 	// Send the message if it is due or
@@ -105,26 +148,33 @@ MavlinkStream::update(const hrt_abstime &t)
 	// This method is not theoretically optimal but a suitable
 	// stopgap as it hits its deadlines well (0.5 Hz, 50 Hz and 250 Hz)
 
-	if (unlimited_rate || (dt > (interval - (_mavlink->get_main_loop_delay() / 10) * 3))) {
+	if (unlimited_rate || (dt > (interval - early))) {
 		// interval expired, send message
 
 		// If the interval is non-zero and dt is smaller than 1.5 times the interval
 		// do not use the actual time but increment at a fixed rate, so that processing delays do not
 		// distort the average rate. The check of the maximum interval is done to ensure that after a
 		// long time not sending anything, sending multiple messages in a short time is avoided.
-		if (send()) {
+		if (send_accounted()) {
 			_last_sent = ((interval > 0) && ((int64_t)(1.5f * interval) > dt)) ? _last_sent + interval : t;
 
 			if (!_first_message_sent) {
 				_first_message_sent = true;
 			}
 
+			if (!unlimited_rate) {
+				schedule_next_update(_last_sent + interval - early + 1);
+			}
+
 			return 0;
 
 		} else {
+			// nothing new to send, keep trying at every iteration
 			return -1;
 		}
 	}
 
+	schedule_next_update(_last_sent + interval - early + 1);
+
 	return -1;
 }
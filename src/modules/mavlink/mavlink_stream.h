@@ -61,12 +61,16 @@ public:
 	MavlinkStream(MavlinkStream &&) = delete;
 	MavlinkStream &operator=(MavlinkStream &&) = delete;
 
+	// streams are created and deleted on every reconfiguration, allocate them from a pool
+	static void *operator new (size_t size) noexcept;
+	static void operator delete (void *ptr);
+
 	/**
 	 * Get the interval
 	 *
 	 * @param interval the interval in microseconds (us) between messages
 	 */
-	void set_interval(const int interval) { _interval = interval; }
+	void set_interval(const int interval) { _interval = interval; _next_update = 0; }
 
 	/**
 	 * Get the interval
@@ -79,6 +83,17 @@ public:
 	 * @return 0 if updated / sent, -1 if unchanged
 	 */
 	int update(const hrt_abstime &t);
+
+	/**
+	 * @return true if update() has anything to do at time t, streams that are not due yet can be skipped
+	 */
+	bool update_due(const hrt_abstime &t) const { return t >= _next_update; }
+
+	/**
+	 * Forget the cached time of the next update, e.g. after the rate multiplier increased.
+	 */
+	void reset_next_update() { _next_update = 0; }
+
 	virtual const char *get_name() const = 0;
 	virtual uint16_t get_id() = 0;
 
@@ -87,6 +102,12 @@ public:
 	 */
 	virtual bool const_rate() { return false; }
 
+	/**
+	 * @return true if the stream is essential telemetry, which is only slowed down once all
+	 * the other streams are at their minimum rate
+	 */
+	virtual bool essential() { return false; }
+
 	/**
 	 * Get maximal total messages size on update
 	 */
@@ -120,7 +141,15 @@ public:
 	 * Reset the time of last sent to 0. Can be used if a message over this
 	 * stream needs to be sent immediately.
 	 */
-	void reset_last_sent() { _last_sent = 0; }
+	void reset_last_sent() { _last_sent = 0; _next_update = 0; }
+
+	/**
+	 * Accounting of the send() calls, reported by 'mavlink status streams'
+	 */
+	uint32_t send_count() const { return _send_count; }
+	uint64_t send_time_total() const { return _send_time_total; }	///< time spent in send() [us]
+	uint32_t send_time_max() const { return _send_time_max; }	///< longest send() call [us]
+	uint32_t bytes_sent() const { return _bytes_sent; }		///< bytes handed to the link by send()
 
 protected:
 	Mavlink      *const _mavlink;
@@ -132,13 +161,29 @@ protected:
 	 * Function to collect/update data for the streams at a high rate independent of
 	 * actual stream rate.
 	 *
-	 * This function is called at every iteration of the mavlink module.
+	 * This function is called at every iteration of the mavlink module if _update_data_every_iteration
+	 * is set, otherwise only when the stream is due.
 	 */
 	virtual void update_data() { }
 
+	bool _update_data_every_iteration{false};	///< set by streams overriding update_data()
+
 private:
+	void schedule_next_update(const hrt_abstime &next) { _next_update = _update_data_every_iteration ? 0 : next; }
+
+	/**
+	 * Call send() and update the time and byte accounting
+	 */
+	bool send_accounted();
+
 	hrt_abstime _last_sent{0};
+	hrt_abstime _next_update{0};	///< update() has nothing to do before this time
 	bool _first_message_sent{false};
+
+	uint32_t _send_count{0};
+	uint32_t _send_time_max{0};
+	uint64_t _send_time_total{0};
+	uint32_t _bytes_sent{0};
 };
 
 
@@ -42,6 +42,10 @@
 #include "mavlink_ftp_test.h"
 #include "../mavlink_ftp.h"
 
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+#include <lib/heatshrink/heatshrink/heatshrink_decoder.h>
+#endif
+
 #ifdef __PX4_NUTTX
 #define PX4_MAVLINK_TEST_DATA_DIR CONFIG_BOARD_ROOT_PATH "/ftp_unit_test_data"
 #else
@@ -644,6 +648,91 @@ bool MavlinkFtpTest::_burst_test()
 	return true;
 }
 
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+/// @brief Tests that a compressed burst download decompresses to the file contents.
+bool MavlinkFtpTest::_burst_compressed_test()
+{
+	MavlinkFTP::PayloadHeader		payload {};
+	const MavlinkFTP::PayloadHeader		*reply;
+	CompressedBurstInfo			burst_info{};
+
+	for (size_t i = 0; i < sizeof(_rgDownloadTestCases) / sizeof(_rgDownloadTestCases[0]); i++) {
+		struct stat st;
+		const DownloadTestCase *test = &_rgDownloadTestCases[i];
+
+		// Read in the file so we can compare it to what we get back
+		ut_compare("stat failed", stat(test->file, &st), 0);
+		uint8_t *bytes = new uint8_t[st.st_size];
+		uint8_t *received_bytes = new uint8_t[st.st_size];
+		ut_assert("new failed", bytes != nullptr && received_bytes != nullptr);
+		int fd = ::open(test->file, O_RDONLY);
+		ut_assert("open failed", fd != -1);
+		int bytes_read = ::read(fd, bytes, st.st_size);
+		ut_compare("read failed", bytes_read, st.st_size);
+		::close(fd);
+
+		payload.opcode = MavlinkFTP::kCmdOpenFileRO;
+		payload.offset = 0;
+		payload.size = strlen(test->file) + 1;
+
+		bool success = _send_receive_msg(&payload, (uint8_t *)test->file, payload.size, &reply);
+
+		if (!success) {
+			delete[] bytes;
+			delete[] received_bytes;
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+
+		// Setup for compressed burst response handler
+		burst_info.ftp_test_class = this;
+		burst_info.complete = false;
+		burst_info.file_size = st.st_size;
+		burst_info.file_bytes = received_bytes;
+		burst_info.bytes_received = 0;
+		_ftp_server->set_unittest_worker(MavlinkFtpTest::receive_message_handler_burst_compressed, &burst_info);
+
+		payload.opcode = MavlinkFTP::kCmdBurstReadFileCompressed;
+		payload.session = reply->session;
+		payload.offset = 0;
+		payload.size = MAX_DATA_LEN;
+
+		mavlink_message_t msg;
+		_setup_ftp_msg(&payload, nullptr, 0, &msg);
+		_ftp_server->handle_message(&msg);
+
+		// First packet is sent using stream mechanism, so we need to force it out ourselves
+		_ftp_server->send();
+
+		ut_assert("Burst not completed", burst_info.complete);
+		ut_compare("Incorrect number of bytes", burst_info.bytes_received, st.st_size);
+		ut_compare("File contents differ", memcmp(received_bytes, bytes, st.st_size), 0);
+
+		// Put back generic message handler
+		_ftp_server->set_unittest_worker(MavlinkFtpTest::receive_message_handler_generic, this);
+
+		// Terminate session
+		payload.opcode = MavlinkFTP::kCmdTerminateSession;
+		payload.session = reply->session;
+		payload.size = 0;
+
+		success = _send_receive_msg(&payload, nullptr, 0, &reply);
+
+		delete[] bytes;
+		delete[] received_bytes;
+
+		if (!success) {
+			return false;
+		}
+
+		ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+	}
+
+	return true;
+}
+#endif
+
 /// @brief Tests for correct reponse to a Read command on an invalid session.
 bool MavlinkFtpTest::_read_badsession_test()
 {
@@ -929,6 +1018,72 @@ bool MavlinkFtpTest::_receive_message_handler_burst(const mavlink_file_transfer_
 	return true;
 }
 
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+void MavlinkFtpTest::receive_message_handler_burst_compressed(const mavlink_file_transfer_protocol_t *ftp_req,
+		void *worker_data)
+{
+	CompressedBurstInfo *burst_info = (CompressedBurstInfo *)worker_data;
+	burst_info->ftp_test_class->_receive_message_handler_burst_compressed(ftp_req, burst_info);
+}
+
+bool MavlinkFtpTest::_receive_message_handler_burst_compressed(const mavlink_file_transfer_protocol_t *ftp_msg,
+		CompressedBurstInfo *burst_info)
+{
+	const MavlinkFTP::PayloadHeader *reply{nullptr};
+
+	_decode_message(ftp_msg, &reply);
+
+	ut_compare("Request opcode incorrect", reply->req_opcode, MavlinkFTP::kCmdBurstReadFileCompressed);
+
+	if (reply->opcode == MavlinkFTP::kRspNak) {
+		ut_compare("Expected EOF", reply->data[0], MavlinkFTP::kErrEOF);
+		burst_info->complete = true;
+		return true;
+	}
+
+	ut_compare("Didn't get Ack back", reply->opcode, MavlinkFTP::kRspAck);
+	ut_compare("Offset incorrect", reply->offset, burst_info->bytes_received);
+	ut_assert("Payload too small", reply->size > 3);
+
+	const uint32_t uncompressed_size = reply->data[0] | (reply->data[1] << 8);
+	ut_compare("Heatshrink parameters incorrect", reply->data[2],
+		   (HEATSHRINK_STATIC_WINDOW_BITS << 4) | HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+	ut_assert("Chunk exceeds file", reply->offset + uncompressed_size <= burst_info->file_size);
+
+	// every chunk is compressed independently
+	heatshrink_decoder hsd;
+	heatshrink_decoder_reset(&hsd);
+	size_t input_size = 0;
+	size_t output_size = 0;
+	uint8_t *out = burst_info->file_bytes + reply->offset;
+
+	while (input_size < reply->size - 3u) {
+		size_t sunk = 0;
+		ut_assert("sink failed", heatshrink_decoder_sink(&hsd, const_cast<uint8_t *>(&reply->data[3 + input_size]),
+				reply->size - 3 - input_size, &sunk) >= 0);
+		input_size += sunk;
+
+		HSD_poll_res poll_res;
+
+		do {
+			size_t n = 0;
+			poll_res = heatshrink_decoder_poll(&hsd, out + output_size, uncompressed_size - output_size, &n);
+			output_size += n;
+			ut_assert("poll failed", poll_res >= 0 && !(poll_res == HSDR_POLL_MORE && output_size >= uncompressed_size));
+		} while (poll_res == HSDR_POLL_MORE);
+	}
+
+	ut_compare("Decompressed size incorrect", output_size, uncompressed_size);
+
+	burst_info->bytes_received += uncompressed_size;
+
+	ut_assert("Remaining stream packets missing", _ftp_server->get_size());
+	_ftp_server->send();
+
+	return true;
+}
+#endif
+
 /// @brief Decode and validate the incoming message
 bool MavlinkFtpTest::_decode_message(const mavlink_file_transfer_protocol_t	*ftp_msg,	///< Incoming FTP message
 				     const MavlinkFTP::PayloadHeader		**payload)	///< Payload inside FTP message response
@@ -1017,6 +1172,9 @@ bool MavlinkFtpTest::run_tests()
 	ut_run_test(_read_test);
 	ut_run_test(_read_badsession_test);
 	ut_run_test(_burst_test);
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+	ut_run_test(_burst_compressed_test);
+#endif
 	ut_run_test(_removedirectory_test);
 	ut_run_test(_createdirectory_test);
 	ut_run_test(_removefile_test);
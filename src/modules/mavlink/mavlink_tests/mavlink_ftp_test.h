@@ -62,6 +62,20 @@ public:
 
 	static void receive_message_handler_burst(const mavlink_file_transfer_protocol_t *ftp_req, void *worker_data);
 
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+	/// Worker data for compressed stream handler
+	struct CompressedBurstInfo {
+		MavlinkFtpTest		*ftp_test_class;
+		bool			complete;
+		uint32_t		file_size;
+		uint8_t		*file_bytes; ///< decompressed file
+		uint32_t		bytes_received;
+	};
+
+	static void receive_message_handler_burst_compressed(const mavlink_file_transfer_protocol_t *ftp_req,
+			void *worker_data);
+#endif
+
 	static const uint8_t serverSystemId = 50;	///< System ID for server
 	static const uint8_t serverComponentId = 1;	///< Component ID for server
 	static const uint8_t serverChannel = 0;		///< Channel to send to
@@ -90,6 +104,9 @@ private:
 	bool _read_test(void);
 	bool _read_badsession_test(void);
 	bool _burst_test(void);
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+	bool _burst_compressed_test(void);
+#endif
 	bool _removedirectory_test(void);
 	bool _createdirectory_test(void);
 	bool _removefile_test(void);
@@ -125,6 +142,10 @@ private:
 	};
 
 	bool _receive_message_handler_burst(const mavlink_file_transfer_protocol_t *ftp_req, BurstInfo *burst_info);
+#if defined(CONFIG_MAVLINK_FTP_COMPRESSION)
+	bool _receive_message_handler_burst_compressed(const mavlink_file_transfer_protocol_t *ftp_req,
+			CompressedBurstInfo *burst_info);
+#endif
 
 	MavlinkFTP	*_ftp_server;
 	Mavlink _mavlink;
@@ -74,7 +74,8 @@ MavlinkTimesync::handle_message(const mavlink_message_t *msg)
 
 			} else if (tsync.tc1 > 0) {		// Message originating from this system, compute time offset from it
 
-				_timesync.update(now, tsync.tc1, tsync.ts1);
+				// the receive time excludes the latency of the receiver thread from the round trip
+				_timesync.update(_receive_time != 0 ? _receive_time : now, tsync.tc1, tsync.ts1);
 			}
 
 			break;
@@ -54,6 +54,12 @@ public:
 
 	void handle_message(const mavlink_message_t *msg);
 
+	/**
+	 * Set the time the messages handled next were received (e.g. a kernel timestamp of the UDP datagram),
+	 * 0 to use the current time
+	 */
+	void set_receive_time(hrt_abstime receive_time) { _receive_time = receive_time; }
+
 	/**
 	 * Convert remote timestamp to local hrt time (usec)
 	 * Use synchronised time if available, monotonic boot time otherwise
@@ -63,4 +69,6 @@ public:
 private:
 	Mavlink &_mavlink;
 	Timesync _timesync{};
+
+	hrt_abstime _receive_time{0};
 };
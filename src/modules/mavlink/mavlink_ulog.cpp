@@ -61,8 +61,8 @@ MavlinkULog::MavlinkULog(int datarate, float max_rate_factor, uint8_t target_sys
 	}
 
 	_waiting_for_initial_ack = true;
-	_last_sent_time = hrt_absolute_time(); //(ab)use this timestamp during initialization
-	_next_rate_check = _last_sent_time + _rate_calculation_delta_t;
+	_start_time = hrt_absolute_time();
+	_next_rate_check = _start_time + _rate_calculation_delta_t;
 }
 
 MavlinkULog::~MavlinkULog()
@@ -73,7 +73,6 @@ MavlinkULog::~MavlinkULog()
 void MavlinkULog::start_ack_received()
 {
 	if (_waiting_for_initial_ack) {
-		_last_sent_time = 0;
 		_waiting_for_initial_ack = false;
 		PX4_DEBUG("got logger ack");
 	}
@@ -87,7 +86,7 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 		      "Invalid uorb ulog_stream.data length");
 
 	if (_waiting_for_initial_ack) {
-		if (hrt_elapsed_time(&_last_sent_time) > 3e5) {
+		if (hrt_elapsed_time(&_start_time) > 3e5) {
 			PX4_WARN("no ack from logger (is it running?)");
 			return -1;
 		}
@@ -95,43 +94,24 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 		return 0;
 	}
 
-	// check if we're waiting for an ACK
-	if (_last_sent_time) {
-		bool check_for_updates = false;
-
-		if (_ack_received) {
-			_last_sent_time = 0;
-			check_for_updates = true;
-
-		} else {
-
-			if (hrt_elapsed_time(&_last_sent_time) > ulog_stream_ack_s::ACK_TIMEOUT * 1000) {
-				if (++_sent_tries > ulog_stream_ack_s::ACK_MAX_TRIES) {
-					return -ETIMEDOUT;
-
-				} else {
-					PX4_DEBUG("re-sending ulog mavlink message (try=%i)", _sent_tries);
-					_last_sent_time = hrt_absolute_time();
-
-					const ulog_stream_s &ulog_data = _ulog_stream_sub.get();
+	// selectively re-send the unacked messages that timed out
+	lock();
 
-					mavlink_logging_data_acked_t msg;
-					msg.sequence = ulog_data.msg_sequence;
-					msg.length = ulog_data.length;
-					msg.first_message_offset = ulog_data.first_message_offset;
-					msg.target_system = _target_system;
-					msg.target_component = _target_component;
-					memcpy(msg.data, ulog_data.data, sizeof(msg.data));
-					mavlink_msg_logging_data_acked_send_struct(channel, &msg);
-				}
+	for (AckedMessage &acked_message : _acked_messages) {
+		if (acked_message.in_use && hrt_elapsed_time(&acked_message.last_sent_time) > ulog_stream_ack_s::ACK_TIMEOUT * 1000) {
+			if (++acked_message.sent_tries > ulog_stream_ack_s::ACK_MAX_TRIES) {
+				unlock();
+				return -ETIMEDOUT;
 			}
-		}
 
-		if (!check_for_updates) {
-			return 0;
+			PX4_DEBUG("re-sending ulog mavlink message %i (try=%i)", acked_message.data.msg_sequence, acked_message.sent_tries);
+			acked_message.last_sent_time = hrt_absolute_time();
+			send_acked(channel, acked_message.data);
+			++_current_num_msgs;
 		}
 	}
 
+	unlock();
 
 	while ((_current_num_msgs < _max_num_messages) && _ulog_stream_sub.updated()) {
 		const unsigned last_generation = _ulog_stream_sub.get_last_generation();
@@ -145,21 +125,29 @@ int MavlinkULog::handle_update(mavlink_channel_t channel)
 
 		if (ulog_data.timestamp > 0) {
 			if (ulog_data.flags & ulog_stream_s::FLAGS_NEED_ACK) {
-				_sent_tries = 1;
-				_last_sent_time = hrt_absolute_time();
+				// the logger keeps at most WINDOW_SIZE messages unacked, so there is always a free slot
+				// (otherwise the oldest one is replaced)
 				lock();
-				_wait_for_ack_sequence = ulog_data.msg_sequence;
-				_ack_received = false;
+				AckedMessage *slot = &_acked_messages[0];
+
+				for (AckedMessage &acked_message : _acked_messages) {
+					if (!acked_message.in_use) {
+						slot = &acked_message;
+						break;
+					}
+
+					if (acked_message.last_sent_time < slot->last_sent_time) {
+						slot = &acked_message;
+					}
+				}
+
+				slot->data = ulog_data;
+				slot->sent_tries = 1;
+				slot->last_sent_time = hrt_absolute_time();
+				slot->in_use = true;
 				unlock();
 
-				mavlink_logging_data_acked_t msg;
-				msg.sequence = ulog_data.msg_sequence;
-				msg.length = ulog_data.length;
-				msg.first_message_offset = ulog_data.first_message_offset;
-				msg.target_system = _target_system;
-				msg.target_component = _target_component;
-				memcpy(msg.data, ulog_data.data, sizeof(msg.data));
-				mavlink_msg_logging_data_acked_send_struct(channel, &msg);
+				send_acked(channel, ulog_data);
 
 			} else {
 				mavlink_logging_data_t msg;
@@ -247,15 +235,31 @@ void MavlinkULog::handle_ack(mavlink_logging_ack_t ack)
 	lock();
 
 	if (_instance) { // make sure stop() was not called right before
-		if (_wait_for_ack_sequence == ack.sequence) {
-			_ack_received = true;
-			publish_ack(ack.sequence);
+		for (AckedMessage &acked_message : _acked_messages) {
+			if (acked_message.in_use && acked_message.data.msg_sequence == ack.sequence) {
+				// duplicate acks (e.g. for retransmissions) are only published once
+				acked_message.in_use = false;
+				publish_ack(ack.sequence);
+				break;
+			}
 		}
 	}
 
 	unlock();
 }
 
+void MavlinkULog::send_acked(mavlink_channel_t channel, const ulog_stream_s &ulog_data)
+{
+	mavlink_logging_data_acked_t msg;
+	msg.sequence = ulog_data.msg_sequence;
+	msg.length = ulog_data.length;
+	msg.first_message_offset = ulog_data.first_message_offset;
+	msg.target_system = _target_system;
+	msg.target_component = _target_component;
+	memcpy(msg.data, ulog_data.data, sizeof(msg.data));
+	mavlink_msg_logging_data_acked_send_struct(channel, &msg);
+}
+
 void MavlinkULog::publish_ack(uint16_t sequence)
 {
 	ulog_stream_ack_s ack;
@@ -119,6 +119,17 @@ private:
 
 	void publish_ack(uint16_t sequence);
 
+	/** send a LOGGING_DATA_ACKED message */
+	void send_acked(mavlink_channel_t channel, const ulog_stream_s &ulog_data);
+
+	/** a sent message that requires an ack, kept for retransmission */
+	struct AckedMessage {
+		ulog_stream_s data;
+		hrt_abstime last_sent_time{0};
+		uint8_t sent_tries{0};
+		bool in_use{false};
+	};
+
 	static px4_sem_t _lock;
 	static bool _init;
 	static MavlinkULog *_instance;
@@ -126,10 +137,8 @@ private:
 
 	uORB::SubscriptionData<ulog_stream_s> _ulog_stream_sub{ORB_ID(ulog_stream)};
 	uORB::Publication<ulog_stream_ack_s> _ulog_stream_ack_pub{ORB_ID(ulog_stream_ack)};
-	uint16_t _wait_for_ack_sequence;
-	uint8_t _sent_tries = 0;
-	volatile bool _ack_received = false; ///< set to true if a matching ack received
-	hrt_abstime _last_sent_time = 0; ///< last time we sent a message that requires an ack
+	AckedMessage _acked_messages[ulog_stream_ack_s::WINDOW_SIZE] {}; ///< unacked messages, protected by _lock
+	hrt_abstime _start_time = 0; ///< used to time out waiting for the initial logger ack
 	bool _waiting_for_initial_ack = false;
 	const uint8_t _target_system;
 	const uint8_t _target_component;
@@ -66,7 +66,10 @@ private:
 	static constexpr int MAX_NUM_EXTERNAL_MODES = vehicle_status_s::NAVIGATION_STATE_EXTERNAL8 -
 			vehicle_status_s::NAVIGATION_STATE_EXTERNAL1 + 1;
 
-	explicit MavlinkStreamAvailableModes(Mavlink *mavlink) : MavlinkStream(mavlink) {}
+	explicit MavlinkStreamAvailableModes(Mavlink *mavlink) : MavlinkStream(mavlink)
+	{
+		_update_data_every_iteration = true;
+	}
 
 	struct ExternalModeName {
 		char name[sizeof(register_ext_component_reply_s::name)] {};
@@ -92,6 +92,7 @@ private:
 		_throttle(SimpleAnalyzer::AVERAGE),
 		_windspeed(SimpleAnalyzer::AVERAGE)
 	{
+		_update_data_every_iteration = true;
 		reset_last_sent();
 	}
 
@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file TELEMETRY_BUNDLE.hpp
+ *
+ * Aggregate telemetry for high latency / low bandwidth links: the updated samples of a set of
+ * topics (selected with MAV_BUNDLE_TOPICS) are delta-encoded (uORB::DeltaEncoder) and packed
+ * into TUNNEL messages. See Tools/mavlink_telemetry_bundle.py for a decoder.
+ *
+ * TUNNEL payload:
+ *   uint8 frame sequence
+ *   repeated: uint8 topic index (bit in MAV_BUNDLE_TOPICS), uint8 length, encoded sample
+ */
+
+#ifndef TELEMETRY_BUNDLE_HPP
+#define TELEMETRY_BUNDLE_HPP
+
+#include <uORB/Subscription.hpp>
+#include <uORB/uORBDeltaCodec.hpp>
+#include <uORB/topics/airspeed_validated.h>
+#include <uORB/topics/cpuload.h>
+#include <uORB/topics/failsafe_flags.h>
+#include <uORB/topics/geofence_result.h>
+#include <uORB/topics/home_position.h>
+#include <uORB/topics/mission_result.h>
+#include <uORB/topics/vehicle_air_data.h>
+#include <uORB/topics/vehicle_attitude.h>
+#include <uORB/topics/vehicle_global_position.h>
+#include <uORB/topics/vehicle_land_detected.h>
+#include <uORB/topics/vehicle_status.h>
+#include <uORB/topics/wind.h>
+
+class MavlinkStreamTelemetryBundle : public MavlinkStream
+{
+public:
+	static MavlinkStream *new_instance(Mavlink *mavlink) { return new MavlinkStreamTelemetryBundle(mavlink); }
+
+	static constexpr const char *get_name_static() { return "TELEMETRY_BUNDLE"; }
+	static constexpr uint16_t get_id_static() { return MAVLINK_MSG_ID_TUNNEL; }
+
+	const char *get_name() const override { return get_name_static(); }
+	uint16_t get_id() override { return get_id_static(); }
+
+	unsigned get_size() override
+	{
+		return _num_topics > 0 ? MAVLINK_MSG_ID_TUNNEL_LEN + MAVLINK_NUM_NON_PAYLOAD_BYTES : 0;
+	}
+
+	// TUNNEL payload type in the range for local experiments (> 32767)
+	static constexpr uint16_t PAYLOAD_TYPE = 32900;
+
+private:
+	static constexpr int NUM_TOPICS = 12;
+	static constexpr unsigned FRAME_HEADER_SIZE = 1;
+	static constexpr unsigned ENTRY_HEADER_SIZE = 2;
+	static constexpr unsigned KEYFRAME_INTERVAL = 10;
+
+	explicit MavlinkStreamTelemetryBundle(Mavlink *mavlink) : MavlinkStream(mavlink)
+	{
+		int32_t topics = 0;
+		param_get(param_find("MAV_BUNDLE_TOPICS"), &topics);
+
+		for (int i = 0; i < NUM_TOPICS; i++) {
+			const orb_metadata *meta = _subscriptions[i].get_topic();
+
+			if (!(topics & (1 << i))) {
+				continue;
+			}
+
+			// a keyframe needs to fit into a single TUNNEL message
+			const unsigned keyframe_size = FRAME_HEADER_SIZE + ENTRY_HEADER_SIZE + sizeof(uORB::DeltaHeader) + meta->o_size;
+
+			if (keyframe_size > sizeof(mavlink_tunnel_t::payload) || meta->o_size > sizeof(_sample)) {
+				PX4_ERR("bundle: %s too large", meta->o_name);
+				continue;
+			}
+
+			if (_encoders[i].init(meta, KEYFRAME_INTERVAL)) {
+				_enabled[i] = true;
+				++_num_topics;
+			}
+		}
+	}
+
+	uORB::Subscription _subscriptions[NUM_TOPICS] {
+		{ORB_ID(vehicle_global_position)},
+		{ORB_ID(vehicle_attitude)},
+		{ORB_ID(vehicle_status)},
+		{ORB_ID(vehicle_air_data)},
+		{ORB_ID(airspeed_validated)},
+		{ORB_ID(wind)},
+		{ORB_ID(home_position)},
+		{ORB_ID(failsafe_flags)},
+		{ORB_ID(mission_result)},
+		{ORB_ID(vehicle_land_detected)},
+		{ORB_ID(geofence_result)},
+		{ORB_ID(cpuload)},
+	};
+
+	uORB::DeltaEncoder _encoders[NUM_TOPICS] {};
+	bool _enabled[NUM_TOPICS] {};
+	int _num_topics{0};
+
+	alignas(8) uint8_t _sample[128];
+	uint8_t _frame_sequence{0};
+
+	void send_frame(mavlink_tunnel_t &msg, unsigned length)
+	{
+		msg.payload[0] = _frame_sequence++;
+		msg.payload_length = length;
+		mavlink_msg_tunnel_send_struct(_mavlink->get_channel(), &msg);
+	}
+
+	bool send() override
+	{
+		mavlink_tunnel_t msg{};
+		msg.payload_type = PAYLOAD_TYPE;
+		unsigned length = FRAME_HEADER_SIZE;
+		bool sent = false;
+
+		for (int i = 0; i < NUM_TOPICS; i++) {
+			if (!_enabled[i] || !_subscriptions[i].update(static_cast<void *>(_sample))) {
+				continue;
+			}
+
+			// start a new frame if the worst case (keyframe) does not fit
+			if (length + ENTRY_HEADER_SIZE + _encoders[i].maxEncodedSize() > sizeof(msg.payload)) {
+				send_frame(msg, length);
+				length = FRAME_HEADER_SIZE;
+				sent = true;
+			}
+
+			const int encoded = _encoders[i].encode(_sample, &msg.payload[length + ENTRY_HEADER_SIZE],
+							       sizeof(msg.payload) - length - ENTRY_HEADER_SIZE);
+
+			if (encoded > 0) {
+				msg.payload[length] = i;
+				msg.payload[length + 1] = encoded;
+				length += ENTRY_HEADER_SIZE + encoded;
+			}
+		}
+
+		if (length > FRAME_HEADER_SIZE) {
+			send_frame(msg, length);
+			sent = true;
+		}
+
+		return sent;
+	}
+};
+
+#endif // TELEMETRY_BUNDLE_HPP
@@ -48,6 +48,7 @@
 #include <uORB/topics/parameter_update.h>
 #include <uORB/topics/autotune_attitude_control_status.h>
 #include <uORB/topics/hover_thrust_estimate.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
 #include <uORB/topics/vehicle_attitude.h>
 #include <uORB/topics/vehicle_attitude_setpoint.h>
 #include <uORB/topics/vehicle_control_mode.h>
@@ -69,7 +70,7 @@ class MulticopterAttitudeControl : public ModuleBase, public ModuleParams,
 public:
 	static Descriptor desc;
 
-	MulticopterAttitudeControl(bool vtol = false);
+	MulticopterAttitudeControl(bool vtol = false, bool gyro_rate = false);
 	~MulticopterAttitudeControl() override;
 
 	/** @see ModuleBase */
@@ -98,6 +99,12 @@ private:
 	 */
 	void generate_attitude_setpoint(const matrix::Quatf &q, float dt);
 
+	/**
+	 * Get the latest attitude estimate, propagated with the body rates to the latest gyro sample (MC_ATT_GYRO_RATE)
+	 * @return true on a new gyro sample
+	 */
+	bool predict_attitude(vehicle_attitude_s &v_att);
+
 	AttitudeControl _attitude_control; /**< class for attitude control calculations */
 	StickYaw _stick_yaw{this};
 
@@ -113,11 +120,13 @@ private:
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
 
 	uORB::SubscriptionCallbackWorkItem _vehicle_attitude_sub{this, ORB_ID(vehicle_attitude)};
+	uORB::SubscriptionCallbackWorkItem _vehicle_angular_velocity_sub{this, ORB_ID(vehicle_angular_velocity)};
 
 	uORB::Publication<vehicle_rates_setpoint_s>     _vehicle_rates_setpoint_pub{ORB_ID(vehicle_rates_setpoint)};    /**< rate setpoint publication */
 	uORB::Publication<vehicle_attitude_setpoint_s>  _vehicle_attitude_setpoint_pub;
 
 	manual_control_setpoint_s       _manual_control_setpoint {};    /**< manual control setpoint */
+	vehicle_attitude_s              _vehicle_attitude {};           /**< latest attitude estimate (gyro rate mode) */
 	vehicle_control_mode_s          _vehicle_control_mode {};       /**< vehicle control mode */
 
 	perf_counter_t  _loop_perf;             /**< loop duration performance counter */
@@ -145,6 +154,7 @@ private:
 	bool _vtol{false};
 	bool _vtol_tailsitter{false};
 	bool _vtol_in_transition_mode{false};
+	const bool _gyro_rate; ///< run on the rate controller WorkQueue at gyro rate
 
 	uint8_t _quat_reset_counter{0};
 
@@ -55,12 +55,13 @@ using namespace matrix;
 
 ModuleBase::Descriptor MulticopterAttitudeControl::desc{task_spawn, custom_command, print_usage};
 
-MulticopterAttitudeControl::MulticopterAttitudeControl(bool vtol) :
+MulticopterAttitudeControl::MulticopterAttitudeControl(bool vtol, bool gyro_rate) :
 	ModuleParams(nullptr),
-	WorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers),
+	WorkItem(MODULE_NAME, gyro_rate ? px4::wq_configurations::rate_ctrl : px4::wq_configurations::nav_and_controllers),
 	_vehicle_attitude_setpoint_pub(vtol ? ORB_ID(mc_virtual_attitude_setpoint) : ORB_ID(vehicle_attitude_setpoint)),
 	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")),
-	_vtol(vtol)
+	_vtol(vtol),
+	_gyro_rate(gyro_rate)
 {
 	parameters_updated();
 	// Rate of change 5% per second -> 1.6 seconds to ramp to default 8% MPC_MANTHR_MIN
@@ -79,7 +80,10 @@ MulticopterAttitudeControl::~MulticopterAttitudeControl()
 bool
 MulticopterAttitudeControl::init()
 {
-	if (!_vehicle_attitude_sub.registerCallback()) {
+	// in gyro rate mode the attitude is only polled and propagated with the angular velocity
+	uORB::SubscriptionCallbackWorkItem &trigger = _gyro_rate ? _vehicle_angular_velocity_sub : _vehicle_attitude_sub;
+
+	if (!trigger.registerCallback()) {
 		PX4_ERR("callback registration failed");
 		return false;
 	}
@@ -87,6 +91,31 @@ MulticopterAttitudeControl::init()
 	return true;
 }
 
+bool
+MulticopterAttitudeControl::predict_attitude(vehicle_attitude_s &v_att)
+{
+	_vehicle_attitude_sub.update(&_vehicle_attitude);
+
+	vehicle_angular_velocity_s angular_velocity;
+
+	if (!_vehicle_angular_velocity_sub.update(&angular_velocity) || (_vehicle_attitude.timestamp_sample == 0)) {
+		return false;
+	}
+
+	v_att = _vehicle_attitude;
+
+	if (angular_velocity.timestamp_sample > v_att.timestamp_sample) {
+		// integrate the body rates from the estimate to the gyro sample (bounded in case the estimator stops)
+		const float dt = math::min((angular_velocity.timestamp_sample - v_att.timestamp_sample) * 1e-6f, 0.02f);
+		Quatf q = Quatf(v_att.q) * Quatf(AxisAnglef(Vector3f(angular_velocity.xyz) * dt));
+		q.normalize();
+		q.copyTo(v_att.q);
+		v_att.timestamp_sample = angular_velocity.timestamp_sample;
+	}
+
+	return true;
+}
+
 void
 MulticopterAttitudeControl::parameters_updated()
 {
@@ -209,6 +238,7 @@ MulticopterAttitudeControl::Run()
 {
 	if (should_exit()) {
 		_vehicle_attitude_sub.unregisterCallback();
+		_vehicle_angular_velocity_sub.unregisterCallback();
 		exit_and_cleanup(desc);
 		return;
 	}
@@ -240,13 +270,13 @@ MulticopterAttitudeControl::Run()
 		}
 	}
 
-	// run controller on attitude updates
+	// run controller on attitude updates (or gyro updates in gyro rate mode)
 	vehicle_attitude_s v_att;
 
-	if (_vehicle_attitude_sub.update(&v_att)) {
+	if (_gyro_rate ? predict_attitude(v_att) : _vehicle_attitude_sub.update(&v_att)) {
 
-		// Guard against too small (< 0.2ms) and too large (> 20ms) dt's.
-		const float dt = math::constrain(((v_att.timestamp_sample - _last_run) * 1e-6f), 0.0002f, 0.02f);
+		// Guard against too small (< 0.125ms) and too large (> 20ms) dt's.
+		const float dt = math::constrain(((v_att.timestamp_sample - _last_run) * 1e-6f), 0.000125f, 0.02f);
 		_last_run = v_att.timestamp_sample;
 
 		const Quatf q{v_att.q};
@@ -405,7 +435,10 @@ int MulticopterAttitudeControl::task_spawn(int argc, char *argv[])
 		}
 	}
 
-	MulticopterAttitudeControl *instance = new MulticopterAttitudeControl(vtol);
+	int32_t gyro_rate = 0;
+	param_get(param_find("MC_ATT_GYRO_RATE"), &gyro_rate);
+
+	MulticopterAttitudeControl *instance = new MulticopterAttitudeControl(vtol, gyro_rate != 0);
 
 	if (instance) {
 		desc.object.store(instance);
@@ -445,6 +478,9 @@ setpoints (`vehicle_attitude_setpoint`) as inputs and outputs a rate setpoint.
 
 The controller has a P loop for angular error
 
+With MC_ATT_GYRO_RATE enabled the controller runs on the same WorkQueue as the rate controller
+at gyro rate, using the attitude estimate propagated with the angular velocity.
+
 Publication documenting the implemented Quaternion Attitude Control:
 Nonlinear Quadrocopter Attitude Control (2013)
 by Dario Brescianini, Markus Hehn and Raffaello D'Andrea
@@ -158,3 +158,17 @@ PARAM_DEFINE_FLOAT(MC_YAWRATE_MAX, 200.0f);
  * @group Multicopter Position Control
  */
 PARAM_DEFINE_FLOAT(MC_MAN_TILT_TAU, 0.0f);
+
+/**
+ * Run the attitude controller at gyro rate
+ *
+ * If enabled, the attitude controller runs on the rate controller WorkQueue on every
+ * angular velocity update, with the latest attitude estimate propagated to the gyro
+ * sample using the body rates. This reduces the rate setpoint latency for aggressive
+ * flight (e.g. racing), at the cost of a higher CPU load.
+ *
+ * @boolean
+ * @reboot_required true
+ * @group Multicopter Attitude Control
+ */
+PARAM_DEFINE_INT32(MC_ATT_GYRO_RATE, 0);
@@ -45,7 +45,7 @@ ModuleBase::Descriptor McAutotuneAttitudeControl::desc{task_spawn, custom_comman
 
 McAutotuneAttitudeControl::McAutotuneAttitudeControl() :
 	ModuleParams(nullptr),
-	WorkItem(MODULE_NAME, px4::wq_configurations::hp_default)
+	WorkItem(MODULE_NAME, px4::wq_configurations::lp_default)
 {
 	_autotune_attitude_control_status_pub.advertise();
 }
@@ -57,8 +57,7 @@ McAutotuneAttitudeControl::~McAutotuneAttitudeControl()
 
 bool McAutotuneAttitudeControl::init()
 {
-
-	if (!_vehicle_torque_setpoint_sub.registerCallback()) {
+	if (!_sample_collector.registerCallback()) {
 		PX4_ERR("callback registration failed");
 		return false;
 	}
@@ -71,8 +70,13 @@ bool McAutotuneAttitudeControl::init()
 void McAutotuneAttitudeControl::Run()
 {
 	if (should_exit()) {
+		if (!_sample_collector.stopped()) {
+			// the collector runs on the rate loop's work queue, it schedules this again once stopped
+			_sample_collector.requestStop();
+			return;
+		}
+
 		_parameter_update_sub.unregisterCallback();
-		_vehicle_torque_setpoint_sub.unregisterCallback();
 		exit_and_cleanup(desc);
 		return;
 	}
@@ -117,67 +121,21 @@ void McAutotuneAttitudeControl::Run()
 		}
 	}
 
-	// new control data needed every iteration
-	if ((_state == state::idle && !_vehicle_cmd_start_autotune)
-	    || !_vehicle_torque_setpoint_sub.updated()) {
-		return;
-	}
+	if (_state == state::idle && !_vehicle_cmd_start_autotune) {
+		// discard the samples collected while idle
+		RateLoopSampleCollector::Sample samples[16];
 
-	vehicle_torque_setpoint_s vehicle_torque_setpoint;
-	vehicle_angular_velocity_s angular_velocity;
+		while (_sample_collector.pop(samples, 16) > 0) {}
 
-	if (!_vehicle_torque_setpoint_sub.copy(&vehicle_torque_setpoint)
-	    || !_vehicle_angular_velocity_sub.copy(&angular_velocity)) {
 		return;
 	}
 
 	perf_begin(_cycle_perf);
 
-	const hrt_abstime timestamp_sample = vehicle_torque_setpoint.timestamp;
-
-	// collect sample interval average for filters
-	if (_last_run > 0) {
-		// Guard against too small (< 0.125ms) and too large (> 20ms) dt's.
-		const float dt = math::constrain(((timestamp_sample - _last_run) * 1e-6f), 0.000125f, 0.02f);
-		_interval_sum += dt;
-		_interval_count++;
-
-	} else {
-		_interval_sum = 0.f;
-		_interval_count = 0.f;
-	}
-
-	_last_run = timestamp_sample;
-
-	checkFilters();
-
-	// Send data to the filters at maximum frequency
-	if (_state == state::roll) {
-		_sys_id.updateFilters(_input_scale * vehicle_torque_setpoint.xyz[0],
-				      angular_velocity.xyz[0]);
-
-	} else if (_state == state::pitch) {
-		_sys_id.updateFilters(_input_scale * vehicle_torque_setpoint.xyz[1],
-				      angular_velocity.xyz[1]);
-
-	} else if (_state == state::yaw) {
-		_sys_id.updateFilters(_input_scale * vehicle_torque_setpoint.xyz[2],
-				      angular_velocity.xyz[2]);
-	}
-
-	// Update the model at a lower frequency
-	_model_update_counter++;
-
-	if (_model_update_counter >= _model_update_scaler) {
-		if ((_state == state::roll) || (_state == state::pitch) || (_state == state::yaw)) {
-			_sys_id.update();
-			_last_model_update = hrt_absolute_time();
-		}
-
-		_model_update_counter = 0;
-	}
+	// new control data needed every iteration
+	const bool updated = processSamples();
 
-	if (hrt_elapsed_time(&_last_publish) > _publishing_dt_hrt || _last_publish == 0) {
+	if (updated && (hrt_elapsed_time(&_last_publish) > _publishing_dt_hrt || _last_publish == 0)) {
 		const hrt_abstime now = hrt_absolute_time();
 		updateStateMachine(now);
 
@@ -234,6 +192,80 @@ void McAutotuneAttitudeControl::Run()
 	perf_end(_cycle_perf);
 }
 
+bool McAutotuneAttitudeControl::processSamples()
+{
+	static constexpr size_t max_count = 16;
+	RateLoopSampleCollector::Sample samples[max_count];
+
+	// filtered data at the model rate, the model gets updated once per block
+	float u_model[max_count];
+	float y_model[max_count];
+
+	bool updated = false;
+	size_t count;
+
+	while ((count = _sample_collector.pop(samples, max_count)) > 0) {
+		size_t model_count = 0;
+
+		for (size_t i = 0; i < count; i++) {
+			const RateLoopSampleCollector::Sample &sample = samples[i];
+			const hrt_abstime timestamp_sample = sample.timestamp;
+
+			// collect sample interval average for filters
+			if (_last_run > 0) {
+				// Guard against too small (< 0.125ms) and too large (> 20ms) dt's.
+				const float dt = math::constrain(((timestamp_sample - _last_run) * 1e-6f), 0.000125f, 0.02f);
+				_interval_sum += dt;
+				_interval_count++;
+
+			} else {
+				_interval_sum = 0.f;
+				_interval_count = 0.f;
+			}
+
+			_last_run = timestamp_sample;
+
+			checkFilters();
+
+			// Send data to the filters at maximum frequency
+			if (_state == state::roll) {
+				_sys_id.updateFilters(_input_scale * sample.torque_setpoint[0],
+						      sample.angular_velocity[0]);
+
+			} else if (_state == state::pitch) {
+				_sys_id.updateFilters(_input_scale * sample.torque_setpoint[1],
+						      sample.angular_velocity[1]);
+
+			} else if (_state == state::yaw) {
+				_sys_id.updateFilters(_input_scale * sample.torque_setpoint[2],
+						      sample.angular_velocity[2]);
+			}
+
+			// Update the model at a lower frequency
+			_model_update_counter++;
+
+			if (_model_update_counter >= _model_update_scaler) {
+				if ((_state == state::roll) || (_state == state::pitch) || (_state == state::yaw)) {
+					u_model[model_count] = _sys_id.getFilteredInputData();
+					y_model[model_count] = _sys_id.getFilteredOutputData();
+					model_count++;
+				}
+
+				_model_update_counter = 0;
+			}
+		}
+
+		if (model_count > 0) {
+			_sys_id.update(u_model, y_model, model_count);
+			_last_model_update = hrt_absolute_time();
+		}
+
+		updated = true;
+	}
+
+	return updated;
+}
+
 void McAutotuneAttitudeControl::checkFilters()
 {
 	if (_interval_count > 1000) {
@@ -516,7 +548,7 @@ void McAutotuneAttitudeControl::revertParamGains()
 
 bool McAutotuneAttitudeControl::registerActuatorControlsCallback()
 {
-	if (!_vehicle_torque_setpoint_sub.registerCallback()) {
+	if (!_sample_collector.registerCallback()) {
 		PX4_ERR("callback registration failed");
 		return false;
 	}
@@ -598,7 +630,7 @@ void McAutotuneAttitudeControl::saveGainsToParams()
 void McAutotuneAttitudeControl::stopAutotune()
 {
 	_vehicle_cmd_start_autotune = false;
-	_vehicle_torque_setpoint_sub.unregisterCallback();
+	_sample_collector.unregisterCallback();
 }
 
 const Vector3f McAutotuneAttitudeControl::getIdentificationSignal()
@@ -673,6 +705,7 @@ int McAutotuneAttitudeControl::custom_command(int argc, char *argv[])
 int McAutotuneAttitudeControl::print_status()
 {
 	perf_print_counter(_cycle_perf);
+	_sample_collector.printStatus();
 
 	return 0;
 }
@@ -49,8 +49,9 @@ ModuleBase::Descriptor MulticopterNeuralNetworkControl::desc{task_spawn, custom_
 
 namespace
 {
-// This number should be the number of operations in the model, like tanh and fully connected
-using NNControlOpResolver = tflite::MicroMutableOpResolver<3>;
+// This number should be the number of operations in the model, like tanh and fully connected.
+// Quantize and dequantize are only used by int8 models with float inputs or outputs.
+using NNControlOpResolver = tflite::MicroMutableOpResolver<5>;
 
 TfLiteStatus RegisterOps(NNControlOpResolver &op_resolver)
 {
@@ -58,6 +59,8 @@ TfLiteStatus RegisterOps(NNControlOpResolver &op_resolver)
 	TF_LITE_ENSURE_STATUS(op_resolver.AddFullyConnected());
 	TF_LITE_ENSURE_STATUS(op_resolver.AddRelu());
 	TF_LITE_ENSURE_STATUS(op_resolver.AddAdd());
+	TF_LITE_ENSURE_STATUS(op_resolver.AddQuantize());
+	TF_LITE_ENSURE_STATUS(op_resolver.AddDequantize());
 	return kTfLiteOk;
 }
 }  // namespace
@@ -65,7 +68,8 @@ TfLiteStatus RegisterOps(NNControlOpResolver &op_resolver)
 MulticopterNeuralNetworkControl::MulticopterNeuralNetworkControl() :
 	ModuleParams(nullptr),
 	WorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers),
-	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle"))
+	_loop_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")),
+	_inference_perf(perf_alloc(PC_ELAPSED, MODULE_NAME": inference"))
 {
 
 }
@@ -73,6 +77,7 @@ MulticopterNeuralNetworkControl::MulticopterNeuralNetworkControl() :
 MulticopterNeuralNetworkControl::~MulticopterNeuralNetworkControl()
 {
 	perf_free(_loop_perf);
+	perf_free(_inference_perf);
 }
 
 
@@ -99,7 +104,7 @@ int MulticopterNeuralNetworkControl::InitializeNetwork()
 		return -1;
 	}
 
-	constexpr int kTensorArenaSize = 10 * 1024;
+	constexpr int kTensorArenaSize = CONFIG_MC_NN_CONTROL_TENSOR_ARENA_SIZE;
 	static uint8_t tensor_arena[kTensorArenaSize];
 	_interpreter = new tflite::MicroInterpreter(control_model, resolver, tensor_arena, kTensorArenaSize);
 
@@ -111,10 +116,22 @@ int MulticopterNeuralNetworkControl::InitializeNetwork()
 		return -1;
 	}
 
+	// Report the actual usage, so the arena can be sized to the model
+	_arena_used_bytes = _interpreter->arena_used_bytes();
+	PX4_INFO("tensor arena: %zu of %d bytes used", _arena_used_bytes, kTensorArenaSize);
+
 	_input_tensor = _interpreter->input(0);
+	_output_tensor = _interpreter->output(0);
+
+	if (_input_tensor == nullptr || _output_tensor == nullptr) {
+		PX4_ERR("Input or output tensor is null");
+		return -1;
+	}
 
-	if (_input_tensor == nullptr) {
-		PX4_ERR("Input tensor is null");
+	// Float models and fully int8 quantized models are supported
+	if ((_input_tensor->type != kTfLiteFloat32 && _input_tensor->type != kTfLiteInt8)
+	    || (_output_tensor->type != kTfLiteFloat32 && _output_tensor->type != kTfLiteInt8)) {
+		PX4_ERR("Unsupported tensor type (input: %d, output: %d)", _input_tensor->type, _output_tensor->type);
 		return -1;
 	}
 
@@ -331,26 +348,53 @@ void MulticopterNeuralNetworkControl::PopulateInputTensor()
 					     _angular_velocity.xyz[2]);
 	angular_vel_local = frame_transf * angular_vel_local;
 
-	_input_tensor->data.f[0] = trajectory_setpoint_local(0) - position_local(0);
-	_input_tensor->data.f[1] = trajectory_setpoint_local(1) - position_local(1);
-	_input_tensor->data.f[2] = trajectory_setpoint_local(2) - position_local(2);
-	_input_tensor->data.f[3] = _attitude_local_mat(0, 0);
-	_input_tensor->data.f[4] = _attitude_local_mat(0, 1);
-	_input_tensor->data.f[5] = _attitude_local_mat(0, 2);
-	_input_tensor->data.f[6] = _attitude_local_mat(1, 0);
-	_input_tensor->data.f[7] = _attitude_local_mat(1, 1);
-	_input_tensor->data.f[8] = _attitude_local_mat(1, 2);
-	_input_tensor->data.f[9] = linear_velocity_local(0);
-	_input_tensor->data.f[10] = linear_velocity_local(1);
-	_input_tensor->data.f[11] = linear_velocity_local(2);
-	_input_tensor->data.f[12] = angular_vel_local(0);
-	_input_tensor->data.f[13] = angular_vel_local(1);
-	_input_tensor->data.f[14] = angular_vel_local(2);
-
-	for (int i = 0; i < 15; i++) {
-		_input_data[i] = _input_tensor->data.f[i];
+	_input_data[0] = trajectory_setpoint_local(0) - position_local(0);
+	_input_data[1] = trajectory_setpoint_local(1) - position_local(1);
+	_input_data[2] = trajectory_setpoint_local(2) - position_local(2);
+	_input_data[3] = _attitude_local_mat(0, 0);
+	_input_data[4] = _attitude_local_mat(0, 1);
+	_input_data[5] = _attitude_local_mat(0, 2);
+	_input_data[6] = _attitude_local_mat(1, 0);
+	_input_data[7] = _attitude_local_mat(1, 1);
+	_input_data[8] = _attitude_local_mat(1, 2);
+	_input_data[9] = linear_velocity_local(0);
+	_input_data[10] = linear_velocity_local(1);
+	_input_data[11] = linear_velocity_local(2);
+	_input_data[12] = angular_vel_local(0);
+	_input_data[13] = angular_vel_local(1);
+	_input_data[14] = angular_vel_local(2);
+
+	if (_input_tensor->type == kTfLiteInt8) {
+		const float scale = _input_tensor->params.scale;
+		const int32_t zero_point = _input_tensor->params.zero_point;
+
+		for (int i = 0; i < 15; i++) {
+			const int32_t value = static_cast<int32_t>(roundf(_input_data[i] / scale)) + zero_point;
+			_input_tensor->data.int8[i] = static_cast<int8_t>(math::constrain(value, (int32_t)INT8_MIN, (int32_t)INT8_MAX));
+		}
+
+	} else {
+		for (int i = 0; i < 15; i++) {
+			_input_tensor->data.f[i] = _input_data[i];
+		}
 	}
+}
 
+void MulticopterNeuralNetworkControl::ReadOutputTensor()
+{
+	if (_output_tensor->type == kTfLiteInt8) {
+		const float scale = _output_tensor->params.scale;
+		const int32_t zero_point = _output_tensor->params.zero_point;
+
+		for (int i = 0; i < 4; i++) {
+			_output_data[i] = (_output_tensor->data.int8[i] - zero_point) * scale;
+		}
+
+	} else {
+		for (int i = 0; i < 4; i++) {
+			_output_data[i] = _output_tensor->data.f[i];
+		}
+	}
 }
 
 void MulticopterNeuralNetworkControl::PublishOutput(float *command_actions)
@@ -390,20 +434,20 @@ inline void MulticopterNeuralNetworkControl::RescaleActions()
 
 	for (int i = 0; i < 4; i++) {
 
-		if (_output_tensor->data.f[i] < -1.0f) {
-			_output_tensor->data.f[i] = -1.0f;
+		if (_output_data[i] < -1.0f) {
+			_output_data[i] = -1.0f;
 
-		} else if (_output_tensor->data.f[i] > 1.0f) {
-			_output_tensor->data.f[i] = 1.0f;
+		} else if (_output_data[i] > 1.0f) {
+			_output_data[i] = 1.0f;
 		}
 
-		_output_tensor->data.f[i] = _output_tensor->data.f[i] + 1.0f;
-		float rps = _output_tensor->data.f[i] / thrust_coeff;
+		_output_data[i] = _output_data[i] + 1.0f;
+		float rps = _output_data[i] / thrust_coeff;
 		rps = sqrt(rps);
 		float rpm = rps * 60.0f;
-		_output_tensor->data.f[i] = (rpm * 2.0f - max_rpm - min_rpm) / (max_rpm - min_rpm);
-		_output_tensor->data.f[i] = a * (((_output_tensor->data.f[i] + 1.0f) / 2.0f + tmp1) * ((
-				_output_tensor->data.f[i] + 1.0f) / 2.0f + tmp1) - tmp2);
+		_output_data[i] = (rpm * 2.0f - max_rpm - min_rpm) / (max_rpm - min_rpm);
+		_output_data[i] = a * (((_output_data[i] + 1.0f) / 2.0f + tmp1) * ((
+				_output_data[i] + 1.0f) / 2.0f + tmp1) - tmp2);
 	}
 }
 
@@ -448,6 +492,11 @@ void MulticopterNeuralNetworkControl::Run()
 		return;
 	}
 
+	// Run a requested benchmark here, so the interpreter is only ever used from the work queue
+	if (!_use_neural && !_armed && _benchmark_iterations.load() > 0) {
+		RunBenchmark(_benchmark_iterations.fetch_and(0));
+	}
+
 	// Register the flight mode with the commander
 	if (!_sent_mode_registration) {
 		RegisterNeuralFlightMode();
@@ -476,6 +525,7 @@ void MulticopterNeuralNetworkControl::Run()
 	if (_vehicle_status_sub.updated()) {
 		_vehicle_status_sub.copy(&vehicle_status);
 		_use_neural = vehicle_status.nav_state == _mode_id;
+		_armed = vehicle_status.arming_state == vehicle_status_s::ARMING_STATE_ARMED;
 	}
 
 	if (_parameter_update_sub.updated()) {
@@ -539,25 +589,23 @@ void MulticopterNeuralNetworkControl::Run()
 		PopulateInputTensor();
 
 		int32_t start_time2 = GetTime();
+		perf_begin(_inference_perf);
 		TfLiteStatus invoke_status = _interpreter->Invoke();
+		perf_end(_inference_perf);
 		int32_t inference_time = GetTime() - start_time2;
 
 		if (invoke_status != kTfLiteOk) {
 			PX4_ERR("Invoke() failed");
+			perf_end(_loop_perf);
 			return;
 		}
 
-		_output_tensor = _interpreter->output(0);
-
-		if (_output_tensor == nullptr) {
-			PX4_ERR("Output tensor is null");
-			return;
-		}
+		ReadOutputTensor();
 
 		// Convert the output tensor to actuator values
 		RescaleActions();
 
-		PublishOutput(_output_tensor->data.f);
+		PublishOutput(_output_data);
 
 		int32_t full_controller_time = GetTime() - start_time1;
 
@@ -571,18 +619,67 @@ void MulticopterNeuralNetworkControl::Run()
 			neural_control.observation[i] = _input_data[i];
 		}
 
-		neural_control.network_output[0] = _output_tensor->data.f[0];
-		neural_control.network_output[1] = _output_tensor->data.f[1];
-		neural_control.network_output[2] = _output_tensor->data.f[2];
-		neural_control.network_output[3] = _output_tensor->data.f[3];
+		neural_control.network_output[0] = _output_data[0];
+		neural_control.network_output[1] = _output_data[1];
+		neural_control.network_output[2] = _output_data[2];
+		neural_control.network_output[3] = _output_data[3];
 		_neural_control_pub.publish(neural_control);
 	}
 
 	perf_end(_loop_perf);
 }
 
+void MulticopterNeuralNetworkControl::RunBenchmark(int iterations)
+{
+	// Zero inputs, the inference time of a fully connected network does not depend on the values
+	if (_input_tensor->type == kTfLiteInt8) {
+		memset(_input_tensor->data.int8, 0, 15 * sizeof(int8_t));
+
+	} else {
+		memset(_input_tensor->data.f, 0, 15 * sizeof(float));
+	}
+
+	int32_t total_time = 0;
+	int32_t max_time = 0;
+
+	for (int i = 0; i < iterations; i++) {
+		const int32_t start_time = GetTime();
+
+		if (_interpreter->Invoke() != kTfLiteOk) {
+			PX4_ERR("Invoke() failed");
+			return;
+		}
+
+		const int32_t inference_time = GetTime() - start_time;
+		total_time += inference_time;
+		max_time = math::max(max_time, inference_time);
+	}
+
+	PX4_INFO("inference (%s model, %d runs): mean %.1f us, max %" PRId32 " us",
+		 _input_tensor->type == kTfLiteInt8 ? "int8" : "float", iterations,
+		 (double)total_time / iterations, max_time);
+}
+
 int MulticopterNeuralNetworkControl::custom_command(int argc, char *argv[])
 {
+	if (!is_running(desc)) {
+		print_usage("mc_nn_control not running");
+		return 1;
+	}
+
+	if (!strcmp(argv[0], "benchmark")) {
+		MulticopterNeuralNetworkControl *instance = get_instance<MulticopterNeuralNetworkControl>(desc);
+
+		if (instance->_use_neural || instance->_armed) {
+			PX4_ERR("not possible while armed or in neural control mode");
+			return 1;
+		}
+
+		const int iterations = (argc > 1) ? math::constrain(atoi(argv[1]), 1, 10000) : 1000;
+		instance->_benchmark_iterations.store(iterations);
+		return 0;
+	}
+
 	return print_usage("unknown command");
 }
 
@@ -596,6 +693,10 @@ int MulticopterNeuralNetworkControl::print_status()
 		PX4_INFO("Neural control flight mode: Registered, mode id: %d, arming check id: %d", _mode_id, _arming_check_id);
 	}
 
+	PX4_INFO("Tensor arena: %zu of %d bytes used", _arena_used_bytes, CONFIG_MC_NN_CONTROL_TENSOR_ARENA_SIZE);
+	perf_print_counter(_loop_perf);
+	perf_print_counter(_inference_perf);
+
 	return 0;
 }
 
@@ -613,10 +714,16 @@ This module is an end-to-end neural network control system for multicopters.
 It takes in 15 input values and outputs 4 control actions.
 Inputs: [pos_err(3), att(6), vel(3), ang_vel(3)]
 Outputs: [Actuator motors(4)]
+
+Float and int8 quantized models are supported.
+The `benchmark` command measures the inference time on the board (only while disarmed),
+the result is printed from the module's work queue.
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("mc_nn_control", "controller");
 	PRINT_MODULE_USAGE_COMMAND("start");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("benchmark", "Measure the network inference time");
+	PRINT_MODULE_USAGE_ARG("<iterations>", "Number of inferences (default 1000)", true);
 	PRINT_MODULE_USAGE_DEFAULT_COMMANDS();
 
 	return 0;
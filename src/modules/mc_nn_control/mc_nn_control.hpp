@@ -41,6 +41,7 @@
 #pragma once
 
 #include <perf/perf_counter.h>
+#include <px4_platform_common/atomic.h>
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/defines.h>
 #include <px4_platform_common/log.h>
@@ -109,10 +110,12 @@ private:
 
 	// Functions
 	void PopulateInputTensor();
+	void ReadOutputTensor();
 	void PublishOutput(float *command_actions);
 	void RescaleActions();
 	int InitializeNetwork();
 	int32_t GetTime();
+	void RunBenchmark(int iterations);
 	void RegisterNeuralFlightMode();
 	void UnregisterNeuralFlightMode(int8 arming_check_id, int8 mode_id);
 	void ConfigureNeuralFlightMode(int8 mode_id);
@@ -143,8 +146,11 @@ private:
 
 	// Variables
 	bool _use_neural{false};
+	bool _armed{false};
 	bool _sent_mode_registration{false};
 	perf_counter_t _loop_perf; /**< loop duration performance counter */
+	perf_counter_t _inference_perf; /**< network inference duration performance counter */
+	px4::atomic_int _benchmark_iterations{0}; /**< requested benchmark iterations, run from the work queue */
 	hrt_abstime _last_run{0};
 	uint8 _mode_request_id{231}; //Random value
 	int8 _arming_check_id{-1};
@@ -153,6 +159,8 @@ private:
 	TfLiteTensor *_input_tensor;
 	TfLiteTensor *_output_tensor;
 	float _input_data[15];
+	float _output_data[4]; /**< network output, dequantized for int8 models */
+	size_t _arena_used_bytes{0};
 	trajectory_setpoint_s _trajectory_setpoint;
 	vehicle_angular_velocity_s _angular_velocity;
 	vehicle_local_position_s _position;
@@ -411,6 +411,7 @@ void MulticopterPositionControl::Run()
 					// clear existing setpoint when controller is no longer active
 					_setpoint = PositionControl::empty_trajectory_setpoint;
 					_control.setInputSetpoint(_setpoint);
+					_trajectory_buffer.clear();
 				}
 			}
 		}
@@ -432,16 +433,32 @@ void MulticopterPositionControl::Run()
 		// If a goto setpoint is available this publishes a trajectory setpoint to go there
 		// If trajectory_setpoint is published elsewhere, do not use the goto setpoint
 		const bool goto_setpoint_enable = _vehicle_control_mode.flag_multicopter_position_control_enabled
-						  && !_trajectory_setpoint_sub.updated();
+						  && !_trajectory_setpoint_sub.updated() && !_trajectory_setpoint_buffer_sub.updated();
 
 		if (_goto_control.checkForSetpoint(vehicle_local_position.timestamp_sample, goto_setpoint_enable)) {
 			_goto_control.update(dt, states.position, states.velocity, states.acceleration, states.yaw);
 		}
 
-		_trajectory_setpoint_sub.update(&_setpoint);
+		if (_trajectory_setpoint_buffer_sub.updated()) {
+			trajectory_setpoint_buffer_s trajectory_setpoint_buffer;
+
+			if (_trajectory_setpoint_buffer_sub.copy(&trajectory_setpoint_buffer)) {
+				_trajectory_buffer.update(trajectory_setpoint_buffer);
+			}
+		}
+
+		if (_trajectory_setpoint_sub.update(&_setpoint) && (_setpoint.timestamp >= _trajectory_buffer.getTimestamp())) {
+			// a newer single setpoint replaces the buffered trajectory
+			_trajectory_buffer.clear();
+		}
 
 		adjustSetpointForEKFResets(vehicle_local_position, _setpoint);
 
+		if (_trajectory_buffer.getTimestamp() >= _time_position_control_enabled) {
+			// interpolate the buffered trajectory at the controller rate
+			_trajectory_buffer.sample(vehicle_local_position.timestamp_sample, _setpoint);
+		}
+
 		if (_vehicle_control_mode.flag_multicopter_position_control_enabled) {
 			// set failsafe setpoint if there hasn't been a new
 			// trajectory setpoint since position control started
@@ -714,6 +731,34 @@ void MulticopterPositionControl::adjustSetpointForEKFResets(const vehicle_local_
 		}
 	}
 
+	if (!_trajectory_buffer.isEmpty() && (_trajectory_buffer.getTimestamp() < vehicle_local_position.timestamp)) {
+		Vector3f delta_position{};
+		Vector3f delta_velocity{};
+		float delta_heading = 0.f;
+
+		if (vehicle_local_position.vxy_reset_counter != _vxy_reset_counter) {
+			delta_velocity.xy() = Vector2f(vehicle_local_position.delta_vxy);
+		}
+
+		if (vehicle_local_position.vz_reset_counter != _vz_reset_counter) {
+			delta_velocity(2) = vehicle_local_position.delta_vz;
+		}
+
+		if (vehicle_local_position.xy_reset_counter != _xy_reset_counter) {
+			delta_position.xy() = Vector2f(vehicle_local_position.delta_xy);
+		}
+
+		if (vehicle_local_position.z_reset_counter != _z_reset_counter) {
+			delta_position(2) = vehicle_local_position.delta_z;
+		}
+
+		if (vehicle_local_position.heading_reset_counter != _heading_reset_counter) {
+			delta_heading = vehicle_local_position.delta_heading;
+		}
+
+		_trajectory_buffer.applyReset(delta_position, delta_velocity, delta_heading);
+	}
+
 	if (vehicle_local_position.vxy_reset_counter != _vxy_reset_counter) {
 		_vel_xy_lp_filter.reset(_vel_xy_lp_filter.getState() + Vector2f(vehicle_local_position.delta_vxy));
 		_vel_xy_notch_filter.reset();
@@ -0,0 +1,111 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include "TrajectoryBuffer.hpp"
+
+#include <mathlib/mathlib.h>
+
+using matrix::Vector3f;
+using matrix::wrap_pi;
+
+static Vector3f interpolate(const float(&from)[3], const float(&to)[3], const float s)
+{
+	return Vector3f(from) + (Vector3f(to) - Vector3f(from)) * s;
+}
+
+void TrajectoryBuffer::applyReset(const Vector3f &delta_position, const Vector3f &delta_velocity,
+				  const float delta_heading)
+{
+	for (trajectory_setpoint_s &sample : _buffer.samples) {
+		Vector3f(Vector3f(sample.position) + delta_position).copyTo(sample.position);
+		Vector3f(Vector3f(sample.velocity) + delta_velocity).copyTo(sample.velocity);
+		sample.yaw = wrap_pi(sample.yaw + delta_heading);
+	}
+}
+
+bool TrajectoryBuffer::sample(const hrt_abstime now, trajectory_setpoint_s &setpoint) const
+{
+	const int num_samples = math::min(static_cast<int>(_buffer.num_samples),
+					  static_cast<int>(trajectory_setpoint_buffer_s::MAX_SAMPLES));
+
+	if (num_samples == 0) {
+		return false;
+	}
+
+	// find the last sample at or before now
+	int index = 0;
+
+	while ((index + 1 < num_samples) && (_buffer.samples[index + 1].timestamp <= now)) {
+		index++;
+	}
+
+	const trajectory_setpoint_s &previous = _buffer.samples[index];
+
+	if ((index + 1 == num_samples) || (now <= previous.timestamp)) {
+		setpoint = previous;
+		setpoint.timestamp = now;
+		return true;
+	}
+
+	const trajectory_setpoint_s &next = _buffer.samples[index + 1];
+	const float dt = (next.timestamp - previous.timestamp) * 1e-6f;
+	const float s = (now - previous.timestamp) * 1e-6f / dt;
+
+	const Vector3f position0(previous.position);
+	const Vector3f position1(next.position);
+	const Vector3f velocity0(previous.velocity);
+	const Vector3f velocity1(next.velocity);
+
+	Vector3f position = interpolate(previous.position, next.position, s);
+
+	for (int i = 0; i < 3; i++) {
+		if (PX4_ISFINITE(position(i)) && PX4_ISFINITE(velocity0(i)) && PX4_ISFINITE(velocity1(i))) {
+			// cubic Hermite spline, matching position and velocity of both samples
+			const float s2 = s * s;
+			const float s3 = s2 * s;
+			position(i) = (2.f * s3 - 3.f * s2 + 1.f) * position0(i) + (s3 - 2.f * s2 + s) * dt * velocity0(i)
+				      + (-2.f * s3 + 3.f * s2) * position1(i) + (s3 - s2) * dt * velocity1(i);
+		}
+	}
+
+	position.copyTo(setpoint.position);
+	interpolate(previous.velocity, next.velocity, s).copyTo(setpoint.velocity);
+	interpolate(previous.acceleration, next.acceleration, s).copyTo(setpoint.acceleration);
+	interpolate(previous.jerk, next.jerk, s).copyTo(setpoint.jerk);
+
+	setpoint.yaw = wrap_pi(previous.yaw + wrap_pi(next.yaw - previous.yaw) * s);
+	setpoint.yawspeed = previous.yawspeed + (next.yawspeed - previous.yawspeed) * s;
+	setpoint.timestamp = now;
+
+	return true;
+}
@@ -0,0 +1,92 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file TrajectoryBuffer.hpp
+ *
+ * Sampling of a buffered trajectory (sequence of timestamped trajectory setpoints)
+ * at the rate of the position controller.
+ */
+
+#pragma once
+
+#include <drivers/drv_hrt.h>
+#include <matrix/matrix/math.hpp>
+#include <uORB/topics/trajectory_setpoint.h>
+#include <uORB/topics/trajectory_setpoint_buffer.h>
+
+class TrajectoryBuffer
+{
+public:
+	TrajectoryBuffer() = default;
+	~TrajectoryBuffer() = default;
+
+	/**
+	 * Replace the buffered trajectory
+	 */
+	void update(const trajectory_setpoint_buffer_s &buffer) { _buffer = buffer; }
+
+	/**
+	 * Drop the buffered trajectory, e.g. when a newer single setpoint was received
+	 */
+	void clear() { _buffer.num_samples = 0; }
+
+	bool isEmpty() const { return _buffer.num_samples == 0; }
+
+	/**
+	 * @return time at which the buffered trajectory was received
+	 */
+	hrt_abstime getTimestamp() const { return _buffer.timestamp; }
+
+	/**
+	 * Shift all buffered samples by an estimator reset
+	 * @param delta_position position reset [m]
+	 * @param delta_velocity velocity reset [m/s]
+	 * @param delta_heading heading reset [rad]
+	 */
+	void applyReset(const matrix::Vector3f &delta_position, const matrix::Vector3f &delta_velocity,
+			const float delta_heading);
+
+	/**
+	 * Interpolate the buffered trajectory at the given time.
+	 * Before the first and after the last sample the respective sample is held.
+	 * Setpoint values that are NAN in one of the two surrounding samples are not controlled (NAN).
+	 * @param now time to sample the trajectory at
+	 * @param setpoint interpolated setpoint, with timestamp now
+	 * @return false if there is no buffered trajectory
+	 */
+	bool sample(const hrt_abstime now, trajectory_setpoint_s &setpoint) const;
+
+private:
+	trajectory_setpoint_buffer_s _buffer{};
+};
@@ -0,0 +1,125 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <TrajectoryBuffer.hpp>
+#include <matrix/matrix/math.hpp>
+
+using namespace matrix;
+using namespace time_literals;
+
+static trajectory_setpoint_buffer_s constantVelocityBuffer(const Vector3f &velocity, const hrt_abstime start,
+		const hrt_abstime interval)
+{
+	trajectory_setpoint_buffer_s buffer{};
+	buffer.timestamp = start;
+	buffer.num_samples = trajectory_setpoint_buffer_s::MAX_SAMPLES;
+
+	for (int i = 0; i < buffer.num_samples; i++) {
+		trajectory_setpoint_s &sample = buffer.samples[i];
+		sample.timestamp = start + i * interval;
+		Vector3f(velocity * (i * interval * 1e-6f)).copyTo(sample.position);
+		velocity.copyTo(sample.velocity);
+		Vector3f().copyTo(sample.acceleration);
+		Vector3f(NAN, NAN, NAN).copyTo(sample.jerk);
+		sample.yaw = 3.f;
+		sample.yawspeed = NAN;
+	}
+
+	return buffer;
+}
+
+TEST(TrajectoryBufferTest, Empty)
+{
+	TrajectoryBuffer trajectory_buffer;
+	trajectory_setpoint_s setpoint{};
+	EXPECT_TRUE(trajectory_buffer.isEmpty());
+	EXPECT_FALSE(trajectory_buffer.sample(1_s, setpoint));
+}
+
+TEST(TrajectoryBufferTest, InterpolateConstantVelocity)
+{
+	const Vector3f velocity(1.f, -2.f, 0.5f);
+	TrajectoryBuffer trajectory_buffer;
+	trajectory_buffer.update(constantVelocityBuffer(velocity, 1_s, 100_ms));
+	EXPECT_FALSE(trajectory_buffer.isEmpty());
+
+	trajectory_setpoint_s setpoint{};
+
+	for (hrt_abstime now = 1_s; now <= 1700_ms; now += 4_ms) {
+		EXPECT_TRUE(trajectory_buffer.sample(now, setpoint));
+		EXPECT_EQ(setpoint.timestamp, now);
+		EXPECT_EQ(Vector3f(setpoint.position), Vector3f(velocity * ((now - 1_s) * 1e-6f)));
+		EXPECT_EQ(Vector3f(setpoint.velocity), velocity);
+		EXPECT_EQ(Vector3f(setpoint.acceleration), Vector3f());
+		EXPECT_FALSE(Vector3f(setpoint.jerk).isAllFinite());
+		EXPECT_FLOAT_EQ(setpoint.yaw, 3.f);
+		EXPECT_FALSE(PX4_ISFINITE(setpoint.yawspeed));
+	}
+
+	// the last sample is held after the end of the buffer
+	EXPECT_TRUE(trajectory_buffer.sample(5_s, setpoint));
+	EXPECT_EQ(Vector3f(setpoint.position), Vector3f(velocity * 0.7f));
+
+	trajectory_buffer.clear();
+	EXPECT_TRUE(trajectory_buffer.isEmpty());
+}
+
+TEST(TrajectoryBufferTest, InterpolateAcrossSamples)
+{
+	trajectory_setpoint_buffer_s buffer{};
+	buffer.num_samples = 2;
+	buffer.samples[0].timestamp = 1_s;
+	buffer.samples[1].timestamp = 2_s;
+	// position only in xy, velocity only in z
+	Vector3f(0.f, 0.f, NAN).copyTo(buffer.samples[0].position);
+	Vector3f(2.f, 4.f, NAN).copyTo(buffer.samples[1].position);
+	Vector3f(NAN, NAN, 0.f).copyTo(buffer.samples[0].velocity);
+	Vector3f(NAN, NAN, -1.f).copyTo(buffer.samples[1].velocity);
+	buffer.samples[0].yaw = 3.f;
+	buffer.samples[1].yaw = -3.f;
+
+	TrajectoryBuffer trajectory_buffer;
+	trajectory_buffer.update(buffer);
+
+	trajectory_setpoint_s setpoint{};
+	EXPECT_TRUE(trajectory_buffer.sample(1500_ms, setpoint));
+	EXPECT_FLOAT_EQ(setpoint.position[0], 1.f);
+	EXPECT_FLOAT_EQ(setpoint.position[1], 2.f);
+	EXPECT_FALSE(PX4_ISFINITE(setpoint.position[2]));
+	EXPECT_FALSE(PX4_ISFINITE(setpoint.velocity[0]));
+	EXPECT_FLOAT_EQ(setpoint.velocity[2], -0.5f);
+
+	// yaw is interpolated the short way, across +-pi
+	EXPECT_NEAR(fabsf(setpoint.yaw), M_PI_F, 1e-5f);
+}
@@ -58,6 +58,8 @@ Raptor::~Raptor()
 {
 	perf_free(_loop_perf);
 	perf_free(_loop_interval_perf);
+	perf_free(_loop_interval_policy_perf);
+	perf_free(_policy_perf);
 }
 
 #ifdef MC_RAPTOR_EMBED_POLICY
@@ -818,8 +820,15 @@ void Raptor::Run()
 	rl_tools::inference::applications::l2f::Action<EXECUTOR_SPEC> action;
 	observe(observation);
 	hrt_abstime nanoseconds = current_time * 1000;
+	const hrt_abstime control_start = hrt_absolute_time();
 	auto executor_status = rl_tools::control(device, executor, nanoseconds, policy, observation, action, rng);
 
+	if (executor_status.source == decltype(executor_status.source)::CONTROL) {
+		// only steps that evaluated the policy, the others just buffer the observation
+		perf_set_elapsed(_policy_perf, hrt_elapsed_time(&control_start));
+		perf_count(_loop_interval_policy_perf);
+	}
+
 	if (!executor_status.OK) {
 		if (executor_status.TIMESTAMP_INVALID) {
 			PX4_ERR("RLtools executor error: Timestamp invalid");
@@ -995,6 +1004,7 @@ int Raptor::print_status()
 	perf_print_counter(_loop_perf);
 	perf_print_counter(_loop_interval_perf);
 	perf_print_counter(_loop_interval_policy_perf);
+	perf_print_counter(_policy_perf);
 	PX4_INFO_RAW("Checkpoint: %s\n", checkpoint_name);
 	return 0;
 }
@@ -165,6 +165,7 @@ private:
 	perf_counter_t	_loop_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": cycle")};
 	perf_counter_t	_loop_interval_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": interval")};
 	perf_counter_t	_loop_interval_policy_perf{perf_alloc(PC_INTERVAL, MODULE_NAME": interval_policy")};
+	perf_counter_t	_policy_perf{perf_alloc(PC_ELAPSED, MODULE_NAME": policy")}; ///< duration of the steps that run the policy
 
 	struct EXECUTOR_CONFIG {
 		static constexpr TI ACTION_HISTORY_LENGTH = 1;
@@ -45,6 +45,15 @@ bool mUORB::Aggregator::NewRecordOverflows(const char *messageName, int32_t leng
 	return ((bufferWriteIndex + newMessageRecordTotalLength) > bufferSize);
 }
 
+bool mUORB::Aggregator::isPriority(const char *name)
+{
+	for (const char *priority_topic : priorityTopics) {
+		if (strcmp(name, priority_topic) == 0) { return true; }
+	}
+
+	return false;
+}
+
 void mUORB::Aggregator::MoveToNextBuffer()
 {
 	bufferWriteIndex = 0;
@@ -56,6 +65,8 @@ void mUORB::Aggregator::AddRecordToBuffer(const char *messageName, int32_t lengt
 {
 	if (! messageName) { return; }
 
+	if (bufferWriteIndex == 0) { _first_record_time = hrt_absolute_time(); }
+
 	uint32_t messageNameLength = strlen(messageName);
 	memcpy(&buffer[bufferId][bufferWriteIndex], (uint8_t *) &syncFlag, syncFlagSize);
 	bufferWriteIndex += syncFlagSize;
@@ -99,6 +110,11 @@ int16_t mUORB::Aggregator::ProcessTransmitTopic(const char *topic, const uint8_t
 
 			AddRecordToBuffer(topic, length_in_bytes, data);
 
+			// Records are kept in order, so everything batched so far goes out with it
+			if (topic && isPriority(topic)) {
+				rc = SendData();
+			}
+
 		} else if (topic) {
 			rc = sendFunc(topic, data, length_in_bytes);
 		}
@@ -58,6 +58,9 @@ public:
 
 	hrt_abstime GetLastSendTime() { return _last_send_time; }
 
+	// True if the oldest buffered record has been waiting longer than deadline
+	bool DeadlineExpired(hrt_abstime deadline) { return bufferWriteIndex && (hrt_elapsed_time(&_first_record_time) > deadline); }
+
 private:
 	static const bool debugFlag;
 
@@ -84,6 +87,19 @@ private:
 
 	hrt_abstime _last_send_time;
 
+	// Time the oldest record in the current buffer was added
+	hrt_abstime _first_record_time;
+
+	// Control topics that flush the buffer immediately instead of waiting for the deadline
+	static constexpr const char *priorityTopics[] = {
+		"vehicle_command",
+		"vehicle_command_ack",
+		"actuator_motors",
+		"actuator_servos",
+	};
+
+	bool isPriority(const char *name);
+
 	bool isAggregate(const char *name) { return (strcmp(name, topicName.c_str()) == 0); }
 
 	bool NewRecordOverflows(const char *messageName, int32_t length);
@@ -99,13 +99,14 @@ static void aggregator_thread_func(void *ptr)
 
 	uORB::ProtobufChannel *muorb = uORB::ProtobufChannel::GetInstance();
 
-	const uint64_t SEND_TIMEOUT = 3000; // 3 ms
+	const uint64_t SEND_TIMEOUT = CONFIG_MUORB_SLPI_AGGREGATION_DEADLINE_US;
 
 	while (true) {
 		// Check for timeout. Send buffer if timeout happened.
 		muorb->SendAggregateData(SEND_TIMEOUT);
 
-		qurt_timer_sleep(SEND_TIMEOUT);
+		// Check twice per deadline to bound the latency of a buffered record
+		qurt_timer_sleep(SEND_TIMEOUT / 2);
 	}
 
 	qurt_thread_exit(QURT_EOK);
@@ -303,12 +304,11 @@ void uORB::ProtobufChannel::PrintStatus()
 
 void uORB::ProtobufChannel::SendAggregateData(hrt_abstime timeout)
 {
-	const hrt_abstime last = _Aggregator.GetLastSendTime();
-
-	// The aggregator buffer will get sent out whenever it fills up. If that
-	// hasn't happened for awhile then just send what we have now to avoid
-	// large periods of time with no topic data
-	if (hrt_elapsed_time(&last) > timeout) {
+	// The aggregator buffer will get sent out whenever it fills up or a
+	// priority topic is added. If the oldest buffered record has been
+	// waiting longer than the timeout then just send what we have now to
+	// bound the latency of topic data
+	if (_Aggregator.DeadlineExpired(timeout)) {
 		pthread_mutex_lock(&_tx_mutex);
 		_Aggregator.SendData();
 		pthread_mutex_unlock(&_tx_mutex);
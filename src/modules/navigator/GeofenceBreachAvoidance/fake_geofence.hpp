@@ -75,6 +75,32 @@ public:
 		}
 	}
 
+	float getPathBreachFraction(double lat_start, double lon_start, double lat_end, double lon_end,
+				    float altitude) override
+	{
+		if (isInsidePolygonOrCircle(lat_end, lon_end, altitude)) {
+			return -1.f;
+		}
+
+		// bisection over the probe function, the fake fences have no boundaries to intersect with
+		float fraction_min = 0.f;
+		float fraction_max = 1.f;
+
+		for (int i = 0; i < 16; i++) {
+			const float fraction = (fraction_min + fraction_max) * 0.5f;
+
+			if (isInsidePolygonOrCircle(lat_start + fraction * (lat_end - lat_start), lon_start + fraction * (lon_end - lon_start),
+						    altitude)) {
+				fraction_min = fraction;
+
+			} else {
+				fraction_max = fraction;
+			}
+		}
+
+		return fraction_max;
+	}
+
 	enum class ProbeFunction {
 		ALL_POINTS_OUTSIDE = 0,
 		LEFT_INSIDE_RIGHT_OUTSIDE,
@@ -88,6 +88,8 @@ Geofence::~Geofence()
 	if (_polygons) {
 		delete[](_polygons);
 	}
+
+	delete[] _vertices;
 }
 
 void Geofence::run()
@@ -212,6 +214,14 @@ void Geofence::_updateFence()
 	_num_polygons = 0;
 	int current_seq = 0;
 
+	delete[] _vertices;
+	_vertices = new Vertex[_dataman_cache.size()];
+
+	if (_vertices == nullptr) {
+		PX4_ERR("alloc failed");
+		return;
+	}
+
 	while (current_seq < _dataman_cache.size()) {
 
 		bool success = _dataman_cache.loadWait(static_cast<dm_item_t>(_stats.dataman_id), current_seq,
@@ -275,6 +285,11 @@ void Geofence::_updateFence()
 					current_seq += mission_fence_point.vertex_count;
 				}
 
+				if (!loadVertices(polygon)) {
+					PX4_ERR("Failed loading fence points, seq: %i", polygon.dataman_index);
+					break;
+				}
+
 				// check if requiremetns for Home location are met
 				const bool home_check_okay = checkHomeRequirementsForGeofence(polygon);
 
@@ -296,6 +311,58 @@ void Geofence::_updateFence()
 			break;
 		}
 	}
+
+	// the vertices are in RAM now, release the dataman cache until the next update
+	_dataman_cache.invalidate();
+	_dataman_cache.resize(0);
+}
+
+bool Geofence::loadVertices(PolygonInfo &polygon)
+{
+	const bool is_circle = (polygon.fence_type == NAV_CMD_FENCE_CIRCLE_INCLUSION)
+			       || (polygon.fence_type == NAV_CMD_FENCE_CIRCLE_EXCLUSION);
+	const int vertex_count = is_circle ? 1 : polygon.vertex_count;
+
+	if (polygon.dataman_index + vertex_count > _dataman_cache.size()) {
+		return false;
+	}
+
+	polygon.frame_supported = true;
+	polygon.lat_min = polygon.lon_min = INFINITY;
+	polygon.lat_max = polygon.lon_max = -INFINITY;
+
+	for (int i = polygon.dataman_index; i < polygon.dataman_index + vertex_count; ++i) {
+		mission_fence_point_s vertex;
+
+		if (!_dataman_cache.loadWait(static_cast<dm_item_t>(_stats.dataman_id), i, reinterpret_cast<uint8_t *>(&vertex),
+					     sizeof(mission_fence_point_s))) {
+			return false;
+		}
+
+		switch (vertex.frame) {
+		case NAV_FRAME_GLOBAL:
+		case NAV_FRAME_GLOBAL_INT:
+		case NAV_FRAME_GLOBAL_RELATIVE_ALT:
+		case NAV_FRAME_GLOBAL_RELATIVE_ALT_INT:
+			break;
+
+		default:
+			// TODO: handle different frames
+			PX4_ERR("Frame type %i not supported", (int)vertex.frame);
+			polygon.frame_supported = false;
+			break;
+		}
+
+		_vertices[i].lat = vertex.lat;
+		_vertices[i].lon = vertex.lon;
+
+		polygon.lat_min = math::min(polygon.lat_min, vertex.lat);
+		polygon.lat_max = math::max(polygon.lat_max, vertex.lat);
+		polygon.lon_min = math::min(polygon.lon_min, vertex.lon);
+		polygon.lon_max = math::max(polygon.lon_max, vertex.lon);
+	}
+
+	return true;
 }
 
 bool Geofence::checkHomeRequirementsForGeofence(const PolygonInfo &polygon)
@@ -437,86 +504,161 @@ bool Geofence::insidePolygon(const PolygonInfo &polygon, double lat, double lon,
 	 * Only supports non-complex polygons (not self intersecting)
 	 */
 
-	mission_fence_point_s temp_vertex_i{};
-	mission_fence_point_s temp_vertex_j{};
+	if (!polygon.frame_supported) {
+		return false;
+	}
+
+	// the test below can't be true outside of the bounding box
+	if (lat < polygon.lat_min || lat > polygon.lat_max || lon < polygon.lon_min || lon > polygon.lon_max) {
+		return false;
+	}
+
+	const Vertex *vertices = &_vertices[polygon.dataman_index];
 	bool c = false;
 
 	for (unsigned i = 0, j = polygon.vertex_count - 1; i < polygon.vertex_count; j = i++) {
 
-		dm_item_t fence_dataman_id{static_cast<dm_item_t>(_stats.dataman_id)};
-		bool success = _dataman_cache.loadWait(fence_dataman_id, polygon.dataman_index + i,
-						       reinterpret_cast<uint8_t *>(&temp_vertex_i), sizeof(mission_fence_point_s));
+		const Vertex &vertex_i = vertices[i];
+		const Vertex &vertex_j = vertices[j];
 
-		if (!success) {
-			break;
+		if ((vertex_i.lon >= lon) != (vertex_j.lon >= lon) &&
+		    (lat <= (vertex_j.lat - vertex_i.lat) * (lon - vertex_i.lon) / (vertex_j.lon - vertex_i.lon) + vertex_i.lat)) {
+			c = !c;
 		}
+	}
 
-		success = _dataman_cache.loadWait(fence_dataman_id, polygon.dataman_index + j,
-						  reinterpret_cast<uint8_t *>(&temp_vertex_j), sizeof(mission_fence_point_s));
+	return c;
+}
 
-		if (!success) {
-			break;
-		}
+bool Geofence::insideCircle(const PolygonInfo &polygon, double lat, double lon, float altitude)
+{
+	if (!polygon.frame_supported) {
+		return false;
+	}
 
-		switch (temp_vertex_i.frame) {
-		case NAV_FRAME_GLOBAL:
-		case NAV_FRAME_GLOBAL_INT:
-		case NAV_FRAME_GLOBAL_RELATIVE_ALT:
-		case NAV_FRAME_GLOBAL_RELATIVE_ALT_INT:
-			break;
+	const Vertex &center = _vertices[polygon.dataman_index];
 
-		default:
-			// TODO: handle different frames
-			PX4_ERR("Frame type %i not supported", (int)temp_vertex_i.frame);
-			return c;
+	if (!_projection_reference.isInitialized()) {
+		_projection_reference.initReference(lat, lon, hrt_absolute_time());
+	}
 
-		}
+	float x1, y1, x2, y2;
+	_projection_reference.projectFast(lat, lon, x1, y1);
+	_projection_reference.projectFast(center.lat, center.lon, x2, y2);
+	float dx = x1 - x2, dy = y1 - y2;
+	return dx * dx + dy * dy < polygon.circle_radius * polygon.circle_radius;
+}
 
-		if (((double)temp_vertex_i.lon >= lon) != ((double)temp_vertex_j.lon >= lon) &&
-		    (lat <= (double)(temp_vertex_j.lat - temp_vertex_i.lat) * (lon - (double)temp_vertex_i.lon) /
-		     (double)(temp_vertex_j.lon - temp_vertex_i.lon) + (double)temp_vertex_i.lat)) {
-			c = !c;
-		}
+float Geofence::getPathBreachFraction(double lat_start, double lon_start, double lat_end, double lon_end,
+				      float altitude)
+{
+	if (!isInsidePolygonOrCircle(lat_start, lon_start, altitude)) {
+		return 0.f;
 	}
 
-	return c;
+	// every fence is satisfied at the start, so the first boundary crossing of any of them is the first breach
+	float fraction = 2.f;
+
+	for (int polygon_index = 0; polygon_index < _num_polygons; ++polygon_index) {
+		firstBoundaryCrossing(_polygons[polygon_index], lat_start, lon_start, lat_end, lon_end, fraction);
+	}
+
+	if (fraction <= 1.f) {
+		return fraction;
+	}
+
+	// paths that only touch a vertex or run along an edge have no crossing
+	return isInsidePolygonOrCircle(lat_end, lon_end, altitude) ? -1.f : 1.f;
 }
 
-bool Geofence::insideCircle(const PolygonInfo &polygon, double lat, double lon, float altitude)
+void Geofence::firstBoundaryCrossing(const PolygonInfo &polygon, double lat_start, double lon_start, double lat_end,
+				     double lon_end, float &fraction)
 {
+	if (!polygon.frame_supported) {
+		return;
+	}
 
-	mission_fence_point_s circle_point{};
-	bool success = _dataman_cache.loadWait(static_cast<dm_item_t>(_stats.dataman_id), polygon.dataman_index,
-					       reinterpret_cast<uint8_t *>(&circle_point), sizeof(mission_fence_point_s));
+	if (polygon.fence_type == NAV_CMD_FENCE_CIRCLE_INCLUSION || polygon.fence_type == NAV_CMD_FENCE_CIRCLE_EXCLUSION) {
+		const Vertex &center = _vertices[polygon.dataman_index];
 
-	if (!success) {
-		PX4_ERR("dm_read failed");
-		return false;
-	}
+		if (!_projection_reference.isInitialized()) {
+			_projection_reference.initReference(lat_start, lon_start, hrt_absolute_time());
+		}
 
-	switch (circle_point.frame) {
-	case NAV_FRAME_GLOBAL:
-	case NAV_FRAME_GLOBAL_INT:
-	case NAV_FRAME_GLOBAL_RELATIVE_ALT:
-	case NAV_FRAME_GLOBAL_RELATIVE_ALT_INT:
-		break;
+		float x_start, y_start, x_end, y_end, x_center, y_center;
+		_projection_reference.projectFast(lat_start, lon_start, x_start, y_start);
+		_projection_reference.projectFast(lat_end, lon_end, x_end, y_end);
+		_projection_reference.projectFast(center.lat, center.lon, x_center, y_center);
+
+		// solve |start + t * (end - start) - center| = radius for t
+		const float dx = x_end - x_start, dy = y_end - y_start;
+		const float fx = x_start - x_center, fy = y_start - y_center;
+		const float a = dx * dx + dy * dy;
+		const float b = 2.f * (fx * dx + fy * dy);
+		const float c = fx * fx + fy * fy - polygon.circle_radius * polygon.circle_radius;
+		const float discriminant = b * b - 4.f * a * c;
+
+		if (a < FLT_EPSILON || discriminant < 0.f) {
+			return;
+		}
 
-	default:
-		// TODO: handle different frames
-		PX4_ERR("Frame type %i not supported", (int)circle_point.frame);
-		return false;
+		const float root = sqrtf(discriminant);
+		const float t_first = (-b - root) / (2.f * a);
+		const float t_second = (-b + root) / (2.f * a);
+		const float t = t_first >= 0.f ? t_first : t_second;
 
+		if (t >= 0.f && t < fraction) {
+			fraction = t;
+		}
+
+		return;
 	}
 
-	if (!_projection_reference.isInitialized()) {
-		_projection_reference.initReference(lat, lon, hrt_absolute_time());
+	if (polygon.fence_type != NAV_CMD_FENCE_POLYGON_VERTEX_INCLUSION
+	    && polygon.fence_type != NAV_CMD_FENCE_POLYGON_VERTEX_EXCLUSION) {
+		return;
 	}
 
-	float x1, y1, x2, y2;
-	_projection_reference.project(lat, lon, x1, y1);
-	_projection_reference.project(circle_point.lat, circle_point.lon, x2, y2);
-	float dx = x1 - x2, dy = y1 - y2;
-	return dx * dx + dy * dy < circle_point.circle_radius * circle_point.circle_radius;
+	// no edge can be crossed if the path is outside of the bounding box
+	if (math::max(lat_start, lat_end) < polygon.lat_min || math::min(lat_start, lat_end) > polygon.lat_max
+	    || math::max(lon_start, lon_end) < polygon.lon_min || math::min(lon_start, lon_end) > polygon.lon_max) {
+		return;
+	}
+
+	// segment intersection in the same (lat, lon) plane as insidePolygon()
+	const Vertex *vertices = &_vertices[polygon.dataman_index];
+	const double d_lat = lat_end - lat_start;
+	const double d_lon = lon_end - lon_start;
+
+	for (unsigned i = 0, j = polygon.vertex_count - 1; i < polygon.vertex_count; j = i++) {
+
+		const Vertex &vertex_i = vertices[i];
+		const Vertex &vertex_j = vertices[j];
+
+		const double e_lat = vertex_i.lat - vertex_j.lat;
+		const double e_lon = vertex_i.lon - vertex_j.lon;
+		const double s_lat = vertex_j.lat - lat_start;
+		const double s_lon = vertex_j.lon - lon_start;
+
+		// path fraction t = t_num / denom, edge fraction u = u_num / denom
+		double denom = d_lat * e_lon - d_lon * e_lat;
+		double t_num = s_lat * e_lon - s_lon * e_lat;
+		double u_num = s_lat * d_lon - s_lon * d_lat;
+
+		if (denom < 0.0) {
+			denom = -denom;
+			t_num = -t_num;
+			u_num = -u_num;
+		}
+
+		if (denom > 0.0 && t_num >= 0.0 && t_num <= denom && u_num >= 0.0 && u_num <= denom) {
+			const float t = static_cast<float>(t_num / denom);
+
+			if (t < fraction) {
+				fraction = t;
+			}
+		}
+	}
 }
 
 bool
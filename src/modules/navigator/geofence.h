@@ -109,6 +109,15 @@ public:
 
 	virtual bool isInsidePolygonOrCircle(double lat, double lon, float altitude);
 
+	/**
+	 * @brief check the straight path between two points against the polygon and circle fences
+	 *
+	 * The path is intersected with the fence boundaries, so a single call covers all the points along it.
+	 *
+	 * @return fraction [0, 1] of the path before the first fence breach, or a negative value if the whole path is inside
+	 */
+	virtual float getPathBreachFraction(double lat_start, double lon_start, double lat_end, double lon_end, float altitude);
+
 	bool valid();
 
 	/**
@@ -159,15 +168,28 @@ private:
 
 	struct PolygonInfo {
 		uint16_t fence_type; ///< one of MAV_CMD_NAV_FENCE_* (can also be a circular region)
-		uint16_t dataman_index;
+		uint16_t dataman_index; ///< index of the first vertex, in dataman and in _vertices
 		union {
 			uint16_t vertex_count;
 			float circle_radius;
 		};
+		bool frame_supported;
+
+		// bounding box of a polygon, points outside of it can't be inside of the polygon
+		double lat_min;
+		double lat_max;
+		double lon_min;
+		double lon_max;
+	};
+
+	struct Vertex {
+		double lat;
+		double lon;
 	};
 
 	Navigator   *_navigator{nullptr};
 	PolygonInfo *_polygons{nullptr};
+	Vertex      *_vertices{nullptr}; ///< all fence points, so the checks don't need to go through dataman
 
 	mission_stats_entry_s _stats;
 	DatamanState _dataman_state{DatamanState::UpdateRequestWait};
@@ -193,6 +215,12 @@ private:
 	 */
 	void _updateFence();
 
+	/**
+	 * Copy the vertices of a polygon or circle to _vertices and compute its bounding box.
+	 * @return false if the vertices could not be loaded
+	 */
+	bool loadVertices(PolygonInfo &polygon);
+
 
 	/**
 	 * Check if a single point is within a polygon
@@ -207,6 +235,13 @@ private:
 	 */
 	bool insideCircle(const PolygonInfo &polygon, double lat, double lon, float altitude);
 
+	/**
+	 * Find the first crossing of a polygon edge or circle boundary by the path from start to end
+	 * @param fraction lowered to the path fraction of the crossing, if one is found before it
+	 */
+	void firstBoundaryCrossing(const PolygonInfo &polygon, double lat_start, double lon_start, double lat_end,
+				   double lon_end, float &fraction);
+
 	/**
 	 * Check if a single point is within a polygon or circle
 	 * @return true if within polygon or circle
@@ -78,6 +78,9 @@ Mission::on_inactive()
 	}
 
 	MissionBase::on_inactive();
+
+	// prefetch the items from the current index, so they are available without storage access when the mission starts
+	updateDatamanCache();
 }
 
 void
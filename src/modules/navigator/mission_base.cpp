@@ -74,8 +74,9 @@ MissionBase::updateDatamanCache()
 	if ((_mission.count > 0) && (_mission.current_seq != _load_mission_index)) {
 
 		const int32_t start_index = math::constrain(_mission.current_seq, INT32_C(0), int32_t(_mission.count) - 1);
-		const int32_t end_index = math::constrain(start_index + _dataman_cache_size_signed, INT32_C(0),
-					  int32_t(_mission.count) - 1);
+		// end_index is excluded, so it may be one past the first/last item
+		const int32_t end_index = math::constrain(start_index + _dataman_cache_size_signed, INT32_C(-1),
+					  int32_t(_mission.count));
 
 		for (int32_t index = start_index; index != end_index; index += math::signNoZero(_dataman_cache_size_signed)) {
 
@@ -323,6 +323,12 @@ protected:
 	 */
 	void setMissionIndex(int32_t index);
 
+	/**
+	 * @brief Update Dataman cache
+	 *
+	 */
+	virtual void updateDatamanCache();
+
 
 	bool _is_current_planned_mission_item_valid{false};	/**< Flag indicating if the currently loaded mission item is valid*/
 	bool _mission_has_been_activated{false};		/**< Flag indicating if the mission has been activated*/
@@ -352,11 +358,6 @@ private:
 	 *
 	 */
 	static constexpr uint16_t MAX_JUMP_ITERATION{10u};
-	/**
-	 * @brief Update Dataman cache
-	 *
-	 */
-	virtual void updateDatamanCache();
 	/**
 	 * @brief Update mission subscription
 	 *
@@ -74,8 +74,10 @@ MissionFeasibilityChecker::checkMissionFeasible(const mission_s &mission)
 	}
 
 	bool failed = false;
+	bool geofence_passed = checkGeofenceRequirements(home_valid);
 
-	for (size_t i = 0; i < mission.count; i++) {
+	// a single pass over the mission, every item is read from dataman only once for all checks
+	for (size_t i = 0; i < mission.count && (!failed || geofence_passed); i++) {
 		struct mission_item_s missionitem = {};
 
 		bool success = _dataman_client.readSync((dm_item_t)mission.mission_dataman_id, i,
@@ -88,16 +90,18 @@ MissionFeasibilityChecker::checkMissionFeasible(const mission_s &mission)
 			return false;
 		}
 
-		if (!_feasibility_checker.processNextItem(missionitem, i, mission.count)) {
-			failed = true;
-			break;
+		if (geofence_passed) {
+			geofence_passed = checkItemAgainstGeofence(missionitem, i, _navigator->get_home_position()->alt, home_valid);
 		}
 
+		if (!failed && !_feasibility_checker.processNextItem(missionitem, i, mission.count)) {
+			failed = true;
+		}
 	}
 
 	failed |= _feasibility_checker.someCheckFailed();
 
-	failed |= !checkMissionAgainstGeofence(mission, _navigator->get_home_position()->alt, home_valid);
+	failed |= !geofence_passed;
 
 	_navigator->get_mission_result()->warning = failed;
 
@@ -105,7 +109,7 @@ MissionFeasibilityChecker::checkMissionFeasible(const mission_s &mission)
 }
 
 bool
-MissionFeasibilityChecker::checkMissionAgainstGeofence(const mission_s &mission, float home_alt, bool home_valid)
+MissionFeasibilityChecker::checkGeofenceRequirements(bool home_valid)
 {
 	if (_navigator->get_geofence().isHomeRequired() && !home_valid) {
 		mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence requires valid home position\t");
@@ -114,40 +118,36 @@ MissionFeasibilityChecker::checkMissionAgainstGeofence(const mission_s &mission,
 		return false;
 	}
 
-	/* Check if all mission items are inside the geofence (if we have a valid geofence) */
-	if (_navigator->get_geofence().valid()) {
-		for (size_t i = 0; i < mission.count; i++) {
-			struct mission_item_s missionitem = {};
-
-			bool success = _dataman_client.readSync((dm_item_t)mission.mission_dataman_id, i,
-								reinterpret_cast<uint8_t *>(&missionitem),
-								sizeof(mission_item_s));
-
-			if (!success) {
-				/* not supposed to happen unless the datamanager can't access the SD card, etc. */
-				return false;
-			}
-
-			if (missionitem.altitude_is_relative && !home_valid) {
-				mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence requires valid home position\t");
-				events::send(events::ID("navigator_mis_geofence_no_home2"), {events::Log::Error, events::LogInternal::Info},
-					     "Geofence requires a valid home position");
-				return false;
-			}
-
-			// Geofence function checks against home altitude amsl
-			missionitem.altitude = missionitem.altitude_is_relative ? missionitem.altitude + home_alt : missionitem.altitude;
-
-			if (MissionBlock::item_contains_position(missionitem) && !_navigator->get_geofence().checkPointAgainstAllGeofences(
-				    missionitem.lat, missionitem.lon, missionitem.altitude)) {
-
-				mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence violation for waypoint %zu\t", i + 1);
-				events::send<int16_t>(events::ID("navigator_mis_geofence_violation"), {events::Log::Error, events::LogInternal::Info},
-						      "Geofence violation for waypoint {1}",
-						      i + 1);
-				return false;
-			}
-		}
+	return true;
+}
+
+bool
+MissionFeasibilityChecker::checkItemAgainstGeofence(const mission_item_s &missionitem, size_t index, float home_alt,
+		bool home_valid)
+{
+	/* Check if the mission item is inside the geofence (if we have a valid geofence) */
+	if (!_navigator->get_geofence().valid()) {
+		return true;
+	}
+
+	if (missionitem.altitude_is_relative && !home_valid) {
+		mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence requires valid home position\t");
+		events::send(events::ID("navigator_mis_geofence_no_home2"), {events::Log::Error, events::LogInternal::Info},
+			     "Geofence requires a valid home position");
+		return false;
+	}
+
+	// Geofence function checks against home altitude amsl
+	const float altitude = missionitem.altitude_is_relative ? missionitem.altitude + home_alt : missionitem.altitude;
+
+	if (MissionBlock::item_contains_position(missionitem)
+	    && !_navigator->get_geofence().checkPointAgainstAllGeofences(missionitem.lat, missionitem.lon, altitude)) {
+
+		mavlink_log_critical(_navigator->get_mavlink_log_pub(), "Geofence violation for waypoint %zu\t", index + 1);
+		events::send<int16_t>(events::ID("navigator_mis_geofence_violation"), {events::Log::Error, events::LogInternal::Info},
+				      "Geofence violation for waypoint {1}",
+				      index + 1);
+		return false;
 	}
 
 	return true;
@@ -56,7 +56,8 @@ private:
 	DatamanClient &_dataman_client;
 	FeasibilityChecker _feasibility_checker;
 
-	bool checkMissionAgainstGeofence(const mission_s &mission, float home_alt, bool home_valid);
+	bool checkGeofenceRequirements(bool home_valid);
+	bool checkItemAgainstGeofence(const mission_item_s &missionitem, size_t index, float home_alt, bool home_valid);
 
 public:
 	MissionFeasibilityChecker(Navigator *navigator, DatamanClient &dataman_client) :
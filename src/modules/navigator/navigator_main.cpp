@@ -1012,20 +1012,21 @@ void Navigator::geofence_breach_check()
 			test_point_altitude = current_altitude + vertical_test_point_distance;
 		}
 
+		// the custom fences are checked along the whole path to the test point, not only at its end
 		if (_time_loitering_after_gf_breach > 0) {
 			// if we are in the loitering state after breaching a GF, only allow new ones to be set, but not unset
 			_geofence_result.geofence_max_dist_triggered |= !_geofence.isCloserThanMaxDistToHome(test_point_latitude,
 					test_point_longitude, test_point_altitude);
 			_geofence_result.geofence_max_alt_triggered |= !_geofence.isBelowMaxAltitude(test_point_altitude);
-			_geofence_result.geofence_custom_fence_triggered |= !_geofence.isInsidePolygonOrCircle(test_point_latitude,
-					test_point_longitude, test_point_altitude);
+			_geofence_result.geofence_custom_fence_triggered |= _geofence.getPathBreachFraction(current_latitude,
+					current_longitude, test_point_latitude, test_point_longitude, test_point_altitude) >= 0.f;
 
 		} else {
 			_geofence_result.geofence_max_dist_triggered = !_geofence.isCloserThanMaxDistToHome(test_point_latitude,
 					test_point_longitude, test_point_altitude);
 			_geofence_result.geofence_max_alt_triggered = !_geofence.isBelowMaxAltitude(test_point_altitude);
-			_geofence_result.geofence_custom_fence_triggered = !_geofence.isInsidePolygonOrCircle(test_point_latitude,
-					test_point_longitude, test_point_altitude);
+			_geofence_result.geofence_custom_fence_triggered = _geofence.getPathBreachFraction(current_latitude,
+					current_longitude, test_point_latitude, test_point_longitude, test_point_altitude) >= 0.f;
 		}
 
 		_last_geofence_check = hrt_absolute_time();
@@ -1289,24 +1290,25 @@ void Navigator::run_fake_traffic()
 
 void Navigator::check_traffic()
 {
-	if (_traffic_sub.updated()) {
-		_traffic_sub.copy(&_adsb_conflict._transponder_report);
+	transponder_report_s transponder_report;
+
+	// read the whole queue, with dense traffic there are several reports per iteration
+	while (_traffic_sub.update(&transponder_report)) {
 
 		uint16_t required_flags = transponder_report_s::PX4_ADSB_FLAGS_VALID_COORDS |
 					  transponder_report_s::PX4_ADSB_FLAGS_VALID_HEADING |
 					  transponder_report_s::PX4_ADSB_FLAGS_VALID_VELOCITY | transponder_report_s::PX4_ADSB_FLAGS_VALID_ALTITUDE;
 
-		if ((_adsb_conflict._transponder_report.flags & required_flags) == required_flags) {
-
-			_adsb_conflict.detect_traffic_conflict(get_global_position()->lat, get_global_position()->lon,
-							       get_global_position()->alt, _local_pos.vx, _local_pos.vy, _local_pos.vz);
-
-			if (_adsb_conflict.handle_traffic_conflict()) {
-				take_traffic_conflict_action();
-			}
+		if ((transponder_report.flags & required_flags) == required_flags) {
+			_adsb_conflict.update_traffic(transponder_report);
 		}
 	}
 
+	if (_adsb_conflict.check_traffic_table(get_global_position()->lat, get_global_position()->lon,
+					       get_global_position()->alt, _local_pos.vx, _local_pos.vy, _local_pos.vz)) {
+		take_traffic_conflict_action();
+	}
+
 	_adsb_conflict.remove_expired_conflicts();
 }
 #endif // CONFIG_NAVIGATOR_ADSB
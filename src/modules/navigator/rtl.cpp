@@ -62,6 +62,11 @@ RTL::RTL(Navigator *navigator) :
 	_rtl_direct.initialize();
 }
 
+RTL::~RTL()
+{
+	delete[] _safe_point_cache;
+}
+
 void RTL::updateDatamanCache()
 {
 	bool success;
@@ -104,6 +109,7 @@ void RTL::updateDatamanCache()
 
 				_opaque_id = _stats.opaque_id;
 				_safe_points_updated = false;
+				_safe_point_cache_valid = false;
 
 				_dataman_cache_safepoint.invalidate();
 
@@ -427,39 +433,23 @@ PositionYawSetpoint RTL::findClosestSafePoint(float min_dist, uint8_t &safe_poin
 	PositionYawSetpoint safe_point{(double)NAN, (double)NAN, NAN, NAN};
 
 	if (_safe_points_updated) {
+		updateSafePointCache();
 		_one_rally_point_has_land_approach = false;
 
-		for (int current_seq = 0; current_seq < _dataman_cache_safepoint.size(); ++current_seq) {
-			mission_item_s mission_safe_point;
-
-			const bool success = _dataman_cache_safepoint.loadWait(static_cast<dm_item_t>(_stats.dataman_id), current_seq,
-					     reinterpret_cast<uint8_t *>(&mission_safe_point),
-					     sizeof(mission_item_s), 500_ms);
-
-			if (!success) {
-				PX4_ERR("dm_read failed");
-				continue;
-			}
+		for (int i = 0; i < _safe_point_cache_size; ++i) {
+			const SafePointCacheEntry &entry = _safe_point_cache[i];
 
 			// Ignore safepoints which are too close to the homepoint (only if home is an option to return to)
-			const bool far_from_home = get_distance_to_next_waypoint(_home_pos_sub.get().lat, _home_pos_sub.get().lon,
-						   mission_safe_point.lat, mission_safe_point.lon) > MAX_DIST_FROM_HOME_FOR_LAND_APPROACHES;
-
-			if (mission_safe_point.nav_cmd == NAV_CMD_RALLY_POINT && (far_from_home || (_param_rtl_type.get() == 5))) {
-				const float dist{get_distance_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon, mission_safe_point.lat, mission_safe_point.lon)};
+			if (entry.far_from_home || (_param_rtl_type.get() == 5)) {
+				const float dist{get_distance_to_next_waypoint(_global_pos_sub.get().lat, _global_pos_sub.get().lon, entry.position.lat, entry.position.lon)};
 
-				PositionYawSetpoint safepoint_position;
-				setSafepointAsDestination(safepoint_position, mission_safe_point);
-
-				const bool current_safe_point_has_approaches{hasVtolLandApproach(safepoint_position)};
-
-				_one_rally_point_has_land_approach |= current_safe_point_has_approaches;
+				_one_rally_point_has_land_approach |= entry.has_land_approach;
 
 				if (((dist + MIN_DIST_THRESHOLD) < min_dist)
-				    && (!vtol_in_fw_mode || (_param_rtl_appr_force.get() == 0) || current_safe_point_has_approaches)) {
+				    && (!vtol_in_fw_mode || (_param_rtl_appr_force.get() == 0) || entry.has_land_approach)) {
 					min_dist = dist;
-					safe_point = safepoint_position;
-					safe_point_index = current_seq;
+					safe_point = entry.position;
+					safe_point_index = entry.index;
 				}
 			}
 		}
@@ -468,6 +458,51 @@ PositionYawSetpoint RTL::findClosestSafePoint(float min_dist, uint8_t &safe_poin
 	return safe_point;
 }
 
+void RTL::updateSafePointCache()
+{
+	if (_safe_point_cache_valid && (_safe_point_cache_home_update_count == _home_pos_sub.get().update_count)) {
+		return;
+	}
+
+	delete[] _safe_point_cache;
+	_safe_point_cache = nullptr;
+	_safe_point_cache_size = 0;
+
+	if (_dataman_cache_safepoint.size() > 0) {
+		_safe_point_cache = new SafePointCacheEntry[_dataman_cache_safepoint.size()];
+
+		if (_safe_point_cache == nullptr) {
+			PX4_ERR("safe point cache alloc failed");
+			return;
+		}
+	}
+
+	for (int current_seq = 0; current_seq < _dataman_cache_safepoint.size(); ++current_seq) {
+		mission_item_s mission_safe_point;
+
+		const bool success = _dataman_cache_safepoint.loadWait(static_cast<dm_item_t>(_stats.dataman_id), current_seq,
+				     reinterpret_cast<uint8_t *>(&mission_safe_point),
+				     sizeof(mission_item_s), 500_ms);
+
+		if (!success) {
+			PX4_ERR("dm_read failed");
+			continue;
+		}
+
+		if (mission_safe_point.nav_cmd == NAV_CMD_RALLY_POINT) {
+			SafePointCacheEntry &entry = _safe_point_cache[_safe_point_cache_size++];
+			setSafepointAsDestination(entry.position, mission_safe_point);
+			entry.index = current_seq;
+			entry.far_from_home = get_distance_to_next_waypoint(_home_pos_sub.get().lat, _home_pos_sub.get().lon,
+					      mission_safe_point.lat, mission_safe_point.lon) > MAX_DIST_FROM_HOME_FOR_LAND_APPROACHES;
+			entry.has_land_approach = hasVtolLandApproach(entry.position);
+		}
+	}
+
+	_safe_point_cache_valid = true;
+	_safe_point_cache_home_update_count = _home_pos_sub.get().update_count;
+}
+
 void RTL::findRtlDestination(DestinationType &destination_type, PositionYawSetpoint &destination, uint8_t &safe_point_index)
 {
 	const bool vtol_in_rw_mode = _vehicle_status_sub.get().is_vtol
@@ -70,7 +70,7 @@ class RTL : public NavigatorMode, public ModuleParams
 public:
 	RTL(Navigator *navigator);
 
-	~RTL() = default;
+	~RTL();
 
 	enum class RtlType {
 		NONE = rtl_status_s::RTL_STATUS_TYPE_NONE,
@@ -141,6 +141,12 @@ private:
 	 */
 	PositionYawSetpoint findClosestSafePoint(float min_dist, uint8_t &safe_point_index);
 
+	/**
+	 * @brief Rebuild the safe point cache if the safe points or the home position changed
+	 *
+	 */
+	void updateSafePointCache();
+
 	/**
 	 * @brief Set the position of the land start marker in the planned mission as destination.
 	 *
@@ -233,6 +239,18 @@ private:
 
 	mission_stats_entry_s _stats;
 
+	struct SafePointCacheEntry {
+		PositionYawSetpoint position;
+		uint8_t index;
+		bool far_from_home;
+		bool has_land_approach;
+	};
+
+	SafePointCacheEntry *_safe_point_cache{nullptr}; ///< rally points with everything that does not depend on the vehicle position
+	int _safe_point_cache_size{0};
+	bool _safe_point_cache_valid{false};
+	uint32_t _safe_point_cache_home_update_count{0};
+
 	RtlDirect _rtl_direct;
 
 	bool _enforce_rtl_alt{false};
@@ -239,7 +239,7 @@ Replay::readDynamicParams(const char *filename)
 }
 
 bool
-Replay::readFileHeader(std::ifstream &file)
+Replay::readFileHeader(std::istream &file)
 {
 	file.seekg(0);
 	ulog_file_header_s msg_header;
@@ -263,7 +263,7 @@ Replay::readFileHeader(std::ifstream &file)
 }
 
 bool
-Replay::readFileDefinitions(std::ifstream &file)
+Replay::readFileDefinitions(std::istream &file)
 {
 	PX4_INFO("Applying params from ULog file...");
 
@@ -321,7 +321,7 @@ Replay::readFileDefinitions(std::ifstream &file)
 }
 
 bool
-Replay::readFlagBits(std::ifstream &file, uint16_t msg_size)
+Replay::readFlagBits(std::istream &file, uint16_t msg_size)
 {
 	if (msg_size != 40) {
 		PX4_ERR("unsupported message length for FLAG_BITS message (%i)", msg_size);
@@ -368,7 +368,7 @@ Replay::readFlagBits(std::ifstream &file, uint16_t msg_size)
 }
 
 bool
-Replay::readFormat(std::ifstream &file, uint16_t msg_size)
+Replay::readFormat(std::istream &file, uint16_t msg_size)
 {
 	_read_buffer.reserve(msg_size + 1);
 	char *format = (char *)_read_buffer.data();
@@ -421,7 +421,7 @@ string Replay::getOrbFields(const orb_metadata *meta)
 }
 
 Replay::ReadAndAndAddSubResult
-Replay::readAndAddSubscription(std::ifstream &file, uint16_t msg_size)
+Replay::readAndAddSubscription(std::istream &file, uint16_t msg_size)
 {
 	_read_buffer.reserve(msg_size + 1);
 	uint8_t *message = _read_buffer.data();
@@ -609,7 +609,7 @@ Replay::findFieldOffset(const string &format, const string &field_name, int &off
 }
 
 bool
-Replay::readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_position)
+Replay::readAndHandleAdditionalMessages(std::istream &file, std::streampos end_position)
 {
 	ulog_message_header_s message_header;
 
@@ -642,7 +642,7 @@ Replay::readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_
 }
 
 bool
-Replay::readAndApplyParameter(std::ifstream &file, uint16_t msg_size)
+Replay::readAndApplyParameter(std::istream &file, uint16_t msg_size)
 {
 	_read_buffer.reserve(msg_size);
 	uint8_t *message = (uint8_t *)_read_buffer.data();
@@ -685,7 +685,7 @@ Replay::readAndApplyParameter(std::ifstream &file, uint16_t msg_size)
 }
 
 bool
-Replay::readDropout(std::ifstream &file, uint16_t msg_size)
+Replay::readDropout(std::istream &file, uint16_t msg_size)
 {
 	uint16_t duration;
 	file.read((char *)&duration, sizeof(duration));
@@ -695,7 +695,7 @@ Replay::readDropout(std::ifstream &file, uint16_t msg_size)
 }
 
 bool
-Replay::nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id)
+Replay::nextDataMessage(std::istream &file, Subscription &subscription, int msg_id)
 {
 	ulog_message_header_s message_header;
 	file.seekg(subscription.next_read_pos);
@@ -851,7 +851,7 @@ Replay::sizeOfFullType(const std::string &type_name_full)
 }
 
 bool
-Replay::readDefinitionsAndApplyParams(std::ifstream &file)
+Replay::readDefinitionsAndApplyParams(std::istream &file)
 {
 	// log reader currently assumes little endian
 	int num = 1;
@@ -861,7 +861,7 @@ Replay::readDefinitionsAndApplyParams(std::ifstream &file)
 		return false;
 	}
 
-	if (!file.is_open()) {
+	if (!file) {
 		PX4_ERR("Failed to open replay file");
 		return false;
 	}
@@ -885,7 +885,7 @@ Replay::readDefinitionsAndApplyParams(std::ifstream &file)
 void
 Replay::run()
 {
-	ifstream replay_file(_replay_file, ios::in | ios::binary);
+	ReplayFile replay_file(_replay_file);
 
 	if (!readDefinitionsAndApplyParams(replay_file)) {
 		return;
@@ -1041,7 +1041,7 @@ Replay::run()
 }
 
 void
-Replay::readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_file)
+Replay::readTopicDataToBuffer(const Subscription &sub, std::istream &replay_file)
 {
 	const size_t msg_read_size = sub.orb_meta->o_size_no_padding;
 	const size_t msg_write_size = sub.orb_meta->o_size;
@@ -1051,7 +1051,7 @@ Replay::readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_fil
 }
 
 bool
-Replay::handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file)
+Replay::handleTopicUpdate(Subscription &sub, void *data, std::istream &replay_file)
 {
 	return publishTopic(sub, data);
 }
@@ -1206,7 +1206,7 @@ Replay::applyParams(bool quiet)
 		return -ENOMEM;
 	}
 
-	ifstream replay_file(_replay_file, ios::in | ios::binary);
+	ReplayFile replay_file(_replay_file);
 
 	if (!r->readDefinitionsAndApplyParams(replay_file)) {
 		ret = -1;
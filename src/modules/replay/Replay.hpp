@@ -41,6 +41,7 @@
 #include <string>
 
 #include "definitions.hpp"
+#include "ReplayFile.hpp"
 
 #include <px4_platform_common/module.h>
 #include <uORB/topics/uORBTopics.hpp>
@@ -196,12 +197,12 @@ protected:
 	 * handle the publication of a topic update
 	 * @return true if published, false otherwise
 	 */
-	virtual bool handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file);
+	virtual bool handleTopicUpdate(Subscription &sub, void *data, std::istream &replay_file);
 
 	/**
 	 * read a topic from the file (offset given by the subscription) into _read_buffer
 	 */
-	void readTopicDataToBuffer(const Subscription &sub, std::ifstream &replay_file);
+	void readTopicDataToBuffer(const Subscription &sub, std::istream &replay_file);
 
 	/**
 	 * Find next data message for this subscription, starting with the stored file offset.
@@ -210,7 +211,7 @@ protected:
 	 * File seek position is arbitrary after this call.
 	 * @return false on file error
 	 */
-	bool nextDataMessage(std::ifstream &file, Subscription &subscription, int msg_id);
+	bool nextDataMessage(std::istream &file, Subscription &subscription, int msg_id);
 
 	virtual uint64_t getTimestampOffset()
 	{
@@ -256,28 +257,28 @@ private:
 
 	float _accumulated_delay{0.f};
 
-	bool readFileHeader(std::ifstream &file);
+	bool readFileHeader(std::istream &file);
 
 	/**
 	 * Read definitions section: check formats, apply parameters and store
 	 * the start of the data section.
 	 * @return true on success
 	 */
-	bool readFileDefinitions(std::ifstream &file);
+	bool readFileDefinitions(std::istream &file);
 
 	///file parsing methods. They return false, when further parsing should be aborted.
-	bool readFormat(std::ifstream &file, uint16_t msg_size);
+	bool readFormat(std::istream &file, uint16_t msg_size);
 
 	enum class ReadAndAndAddSubResult : uint8_t { kSuccess, kIgnoringMsg, kFailure };
-	ReadAndAndAddSubResult readAndAddSubscription(std::ifstream &file, uint16_t msg_size);
-	bool readFlagBits(std::ifstream &file, uint16_t msg_size);
+	ReadAndAndAddSubResult readAndAddSubscription(std::istream &file, uint16_t msg_size);
+	bool readFlagBits(std::istream &file, uint16_t msg_size);
 
 	/**
 	 * Read the file header and definitions sections. Apply the parameters from this section
 	 * and apply user-defined overridden parameters.
 	 * @return true on success
 	 */
-	bool readDefinitionsAndApplyParams(std::ifstream &file);
+	bool readDefinitionsAndApplyParams(std::istream &file);
 
 	/**
 	 * Read and handle additional messages starting at current file position, while position < end_position.
@@ -285,9 +286,9 @@ private:
 	 * We need to handle these separately, because they have no timestamp. We look at the file position instead.
 	 * @return false on file error
 	 */
-	bool readAndHandleAdditionalMessages(std::ifstream &file, std::streampos end_position);
-	bool readDropout(std::ifstream &file, uint16_t msg_size);
-	bool readAndApplyParameter(std::ifstream &file, uint16_t msg_size);
+	bool readAndHandleAdditionalMessages(std::istream &file, std::streampos end_position);
+	bool readDropout(std::istream &file, uint16_t msg_size);
+	bool readAndApplyParameter(std::istream &file, uint16_t msg_size);
 
 	static const orb_metadata *findTopic(const std::string &name);
 
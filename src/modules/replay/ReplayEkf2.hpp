@@ -60,7 +60,7 @@ protected:
 	 * @param replay_file file currently replayed (file seek position should be considered arbitrary after this call)
 	 * @return true if published, false otherwise
 	 */
-	bool handleTopicUpdate(Subscription &sub, void *data, std::ifstream &replay_file) override;
+	bool handleTopicUpdate(Subscription &sub, void *data, std::istream &replay_file) override;
 
 	void onSubscriptionAdded(Subscription &sub, uint16_t msg_id) override;
 
@@ -71,9 +71,9 @@ protected:
 	}
 private:
 
-	bool publishEkf2Topics(const ekf2_timestamps_s &ekf2_timestamps, std::ifstream &replay_file);
+	bool publishEkf2Topics(const ekf2_timestamps_s &ekf2_timestamps, std::istream &replay_file);
 
-	bool publishEkf2Topics(sensor_combined_s &sensors_combined, std::ifstream &replay_file);
+	bool publishEkf2Topics(sensor_combined_s &sensors_combined, std::istream &replay_file);
 
 	/**
 	 * find the next message for a subscription that matches a given timestamp and publish it
@@ -82,7 +82,7 @@ private:
 	 * @param replay_file file currently replayed (file seek position should be considered arbitrary after this call)
 	 * @return true if timestamp found and published
 	 */
-	bool findTimestampAndPublish(uint64_t timestamp, uint16_t msg_id, std::ifstream &replay_file);
+	bool findTimestampAndPublish(uint64_t timestamp, uint16_t msg_id, std::istream &replay_file);
 
 	static constexpr uint16_t msg_id_invalid = 0xffff;
 
@@ -0,0 +1,178 @@
+/****************************************************************************
+ *
+ *   Copyright (c) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <fstream>
+#include <istream>
+#include <streambuf>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace px4
+{
+
+/**
+ * @class MappedFileBuffer
+ * Read-only stream buffer over a memory-mapped file. The whole file is a single get area, so
+ * seeking is just setting the read pointer and reading is a memcpy, while the kernel takes care
+ * of the read-ahead. Replay seeks back and forth between the positions of all subscriptions,
+ * which with a std::filebuf means a system call and a buffer refill on every seek.
+ */
+class MappedFileBuffer : public std::streambuf
+{
+public:
+	MappedFileBuffer() = default;
+	~MappedFileBuffer() { close(); }
+
+	// no copy, assignment, move, move assignment
+	MappedFileBuffer(const MappedFileBuffer &) = delete;
+	MappedFileBuffer &operator=(const MappedFileBuffer &) = delete;
+	MappedFileBuffer(MappedFileBuffer &&) = delete;
+	MappedFileBuffer &operator=(MappedFileBuffer &&) = delete;
+
+	bool open(const char *file_name)
+	{
+		close();
+
+		const int fd = ::open(file_name, O_RDONLY);
+
+		if (fd < 0) {
+			return false;
+		}
+
+		struct stat st;
+
+		if (fstat(fd, &st) == 0 && st.st_size > 0) {
+			void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+			if (data != MAP_FAILED) {
+				// mostly read forward, with the read positions of all subscriptions close to each other
+				madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+				_data = static_cast<char *>(data);
+				_size = st.st_size;
+				setg(_data, _data, _data + _size);
+			}
+		}
+
+		// the mapping stays valid after closing the file descriptor
+		::close(fd);
+		return _data != nullptr;
+	}
+
+	void close()
+	{
+		if (_data) {
+			munmap(_data, _size);
+			_data = nullptr;
+			_size = 0;
+			setg(nullptr, nullptr, nullptr);
+		}
+	}
+
+protected:
+	pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+	{
+		off_type base = 0;
+
+		if (dir == std::ios_base::cur) {
+			base = gptr() - eback();
+
+		} else if (dir == std::ios_base::end) {
+			base = _size;
+		}
+
+		return seekpos(pos_type(base + off), which);
+	}
+
+	pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+	{
+		const off_type offset = off_type(pos);
+
+		if (!(which & std::ios_base::in) || offset < 0) {
+			return pos_type(off_type(-1));
+		}
+
+		// positions past the end are clamped to the end, so the next read fails with eof (as for a file)
+		const off_type clamped = (offset > off_type(_size)) ? off_type(_size) : offset;
+		setg(eback(), eback() + clamped, egptr());
+		return pos_type(clamped);
+	}
+
+	std::streamsize showmanyc() override
+	{
+		return egptr() - gptr();
+	}
+
+private:
+	char *_data{nullptr};
+	size_t _size{0};
+};
+
+/**
+ * @class ReplayFile
+ * Input stream for the replayed ULog file, memory-mapped if possible, otherwise a regular file stream.
+ */
+class ReplayFile : public std::istream
+{
+public:
+	explicit ReplayFile(const char *file_name) : std::istream(nullptr)
+	{
+		if (_mapped_buffer.open(file_name)) {
+			rdbuf(&_mapped_buffer);
+
+		} else if (_file_buffer.open(file_name, std::ios::in | std::ios::binary)) {
+			rdbuf(&_file_buffer);
+
+		} else {
+			setstate(std::ios::failbit);
+		}
+	}
+
+	void close()
+	{
+		_mapped_buffer.close();
+		_file_buffer.close();
+		rdbuf(nullptr);
+	}
+
+private:
+	MappedFileBuffer _mapped_buffer;
+	std::filebuf _file_buffer;
+};
+
+} // namespace px4
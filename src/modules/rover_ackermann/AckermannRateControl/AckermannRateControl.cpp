@@ -56,14 +56,19 @@ void AckermannRateControl::updateParams()
 	_adjusted_yaw_rate_setpoint.setSlewRate(_param_ro_yaw_accel_limit.get() * M_DEG_TO_RAD_F);
 }
 
-void AckermannRateControl::updateRateControl()
+float AckermannRateControl::updateRateControl(const vehicle_angular_velocity_s &vehicle_angular_velocity, bool publish)
 {
+	_vehicle_yaw_rate = fabsf(vehicle_angular_velocity.xyz[2]) > _param_ro_yaw_rate_th.get() * M_DEG_TO_RAD_F ?
+			    vehicle_angular_velocity.xyz[2] : 0.f;
+
 	updateSubscriptions();
 
 	hrt_abstime timestamp_prev = _timestamp;
 	_timestamp = hrt_absolute_time();
 	const float dt = math::constrain(_timestamp - timestamp_prev, 1_ms, 10_ms) * 1e-6f;
 
+	float normalized_steering_setpoint{NAN};
+
 	if (PX4_ISFINITE(_yaw_rate_setpoint)) {
 		if (fabsf(_estimated_speed) > FLT_EPSILON) {
 			// Set up feasible yaw rate setpoint
@@ -95,41 +100,37 @@ void AckermannRateControl::updateRateControl()
 				steering_setpoint += _pid_yaw_rate.update(_vehicle_yaw_rate, dt);
 			}
 
-			rover_steering_setpoint_s rover_steering_setpoint{};
-			rover_steering_setpoint.timestamp = _timestamp;
-			rover_steering_setpoint.normalized_steering_setpoint = math::interpolate<float>(steering_setpoint,
-					-_param_ra_max_str_ang.get(), _param_ra_max_str_ang.get(), -1.f, 1.f); // Normalize steering setpoint
-			_rover_steering_setpoint_pub.publish(rover_steering_setpoint);
+			normalized_steering_setpoint = math::interpolate<float>(steering_setpoint,
+						       -_param_ra_max_str_ang.get(), _param_ra_max_str_ang.get(), -1.f, 1.f); // Normalize steering setpoint
 
 		} else {
 			_pid_yaw_rate.resetIntegral();
+			normalized_steering_setpoint = 0.f;
+		}
+
+		if (publish) {
 			rover_steering_setpoint_s rover_steering_setpoint{};
 			rover_steering_setpoint.timestamp = _timestamp;
-			rover_steering_setpoint.normalized_steering_setpoint = 0.f;
+			rover_steering_setpoint.normalized_steering_setpoint = normalized_steering_setpoint;
 			_rover_steering_setpoint_pub.publish(rover_steering_setpoint);
 		}
 	}
 
+	if (publish) {
+		// Publish rate controller status (logging only)
+		rover_rate_status_s rover_rate_status;
+		rover_rate_status.timestamp = _timestamp;
+		rover_rate_status.measured_yaw_rate = _vehicle_yaw_rate;
+		rover_rate_status.adjusted_yaw_rate_setpoint = _adjusted_yaw_rate_setpoint.getState();
+		rover_rate_status.pid_yaw_rate_integral = _pid_yaw_rate.getIntegral();
+		_rover_rate_status_pub.publish(rover_rate_status);
+	}
 
-	// Publish rate controller status (logging only)
-	rover_rate_status_s rover_rate_status;
-	rover_rate_status.timestamp = _timestamp;
-	rover_rate_status.measured_yaw_rate = _vehicle_yaw_rate;
-	rover_rate_status.adjusted_yaw_rate_setpoint = _adjusted_yaw_rate_setpoint.getState();
-	rover_rate_status.pid_yaw_rate_integral = _pid_yaw_rate.getIntegral();
-	_rover_rate_status_pub.publish(rover_rate_status);
-
+	return normalized_steering_setpoint;
 }
 
 void AckermannRateControl::updateSubscriptions()
 {
-	if (_vehicle_angular_velocity_sub.updated()) {
-		vehicle_angular_velocity_s vehicle_angular_velocity{};
-		_vehicle_angular_velocity_sub.copy(&vehicle_angular_velocity);
-		_vehicle_yaw_rate = fabsf(vehicle_angular_velocity.xyz[2]) > _param_ro_yaw_rate_th.get() * M_DEG_TO_RAD_F ?
-				    vehicle_angular_velocity.xyz[2] : 0.f;
-	}
-
 	// Estimate forward speed based on throttle
 	if (_actuator_motors_sub.updated()) {
 		actuator_motors_s actuator_motors;
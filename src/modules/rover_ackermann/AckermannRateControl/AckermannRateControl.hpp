@@ -66,9 +66,12 @@ public:
 	~AckermannRateControl() = default;
 
 	/**
-	 * @brief Generate and publish roverSteeringSetpoint from roverRateSetpoint.
+	 * @brief Generate roverSteeringSetpoint from roverRateSetpoint.
+	 * @param vehicle_angular_velocity Latest angular velocity sample.
+	 * @param publish Publish roverSteeringSetpoint and the controller status.
+	 * @return Normalized steering setpoint [-1, 1], NAN if there is no yaw rate setpoint.
 	 */
-	void updateRateControl();
+	float updateRateControl(const vehicle_angular_velocity_s &vehicle_angular_velocity, bool publish);
 
 	/**
 	 * @brief Check if the necessary parameters are set.
@@ -95,7 +98,6 @@ private:
 
 	// uORB subscriptions
 	uORB::Subscription _rover_rate_setpoint_sub{ORB_ID(rover_rate_setpoint)};
-	uORB::Subscription _vehicle_angular_velocity_sub{ORB_ID(vehicle_angular_velocity)};
 	uORB::Subscription _actuator_motors_sub{ORB_ID(actuator_motors)};
 
 	// uORB publications
@@ -46,7 +46,13 @@ RoverAckermann::RoverAckermann() :
 
 bool RoverAckermann::init()
 {
-	ScheduleOnInterval(10_ms); // 100 Hz
+	if (!_vehicle_angular_velocity_sub.registerCallback()) {
+		PX4_ERR("callback registration failed");
+		return false;
+	}
+
+	_vehicle_angular_velocity_sub.set_interval_us(INNER_LOOP_INTERVAL_MIN);
+
 	return true;
 }
 
@@ -57,6 +63,16 @@ void RoverAckermann::updateParams()
 
 void RoverAckermann::Run()
 {
+	_vehicle_angular_velocity_sub.update(&_vehicle_angular_velocity);
+
+	// tolerate the jitter of the angular velocity samples
+	const hrt_abstime now = hrt_absolute_time();
+	const bool outer_loop = (now - _outer_loop_timestamp) >= OUTER_LOOP_INTERVAL - INNER_LOOP_INTERVAL_MIN / 2;
+
+	if (outer_loop) {
+		_outer_loop_timestamp = now;
+	}
+
 	if (_parameter_update_sub.updated()) {
 		parameter_update_s param_update{};
 		_parameter_update_sub.copy(&param_update);
@@ -85,8 +101,12 @@ void RoverAckermann::Run()
 
 	if (_vehicle_control_mode.flag_armed && _sanity_checks_passed) {
 		_was_armed = true;
-		generateSetpoints();
-		updateControllers();
+
+		if (outer_loop) {
+			generateSetpoints();
+		}
+
+		updateControllers(outer_loop);
 
 	} else if (_was_armed) { // Reset all controllers and stop the vehicle
 		reset();
@@ -134,25 +154,34 @@ void RoverAckermann::generateSetpoints()
 
 }
 
-void RoverAckermann::updateControllers()
+void RoverAckermann::updateControllers(bool outer_loop)
 {
-	if (_vehicle_control_mode.flag_control_position_enabled) {
-		_ackermann_pos_control.updatePosControl();
-	}
+	if (outer_loop) {
+		if (_vehicle_control_mode.flag_control_position_enabled) {
+			_ackermann_pos_control.updatePosControl();
+		}
 
-	if (_vehicle_control_mode.flag_control_velocity_enabled) {
-		_ackermann_speed_control.updateSpeedControl();
-	}
+		if (_vehicle_control_mode.flag_control_velocity_enabled) {
+			_ackermann_speed_control.updateSpeedControl();
+		}
 
-	if (_vehicle_control_mode.flag_control_attitude_enabled) {
-		_ackermann_att_control.updateAttControl();
+		if (_vehicle_control_mode.flag_control_attitude_enabled) {
+			_ackermann_att_control.updateAttControl();
+		}
 	}
 
+	// the steering setpoint is passed to the actuator control directly, its publication is rate limited
 	if (_vehicle_control_mode.flag_control_rates_enabled) {
-		_ackermann_rate_control.updateRateControl();
+		const float steering_setpoint = _ackermann_rate_control.updateRateControl(_vehicle_angular_velocity, outer_loop);
+
+		if (PX4_ISFINITE(steering_setpoint)) {
+			_ackermann_act_control.setSteeringSetpoint(steering_setpoint);
+		}
 	}
 
-	if (_vehicle_control_mode.flag_control_allocation_enabled) {
+	// without rate control the actuator setpoints only change with the outer loops
+	if (_vehicle_control_mode.flag_control_allocation_enabled
+	    && (outer_loop || _vehicle_control_mode.flag_control_rates_enabled)) {
 		_ackermann_act_control.updateActControl();
 	}
 }
@@ -229,6 +258,10 @@ int RoverAckermann::print_usage(const char *reason)
 		R"DESCR_STR(
 ### Description
 Rover ackermann module.
+
+The rate and actuator control run on every vehicle_angular_velocity sample (limited to 400 Hz), with the
+steering setpoint passed on directly. The drive modes and the position, attitude and speed control run at 100 Hz,
+as do the publications of the intermediate setpoints and controller status for logging.
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("rover_ackermann", "controller");
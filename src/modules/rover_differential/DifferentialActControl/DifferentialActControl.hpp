@@ -67,6 +67,12 @@ public:
 	 */
 	void updateActControl();
 
+	/**
+	 * @brief Set the steering setpoint from the rate controller of the same cycle.
+	 * @param normalized_steering_setpoint Normalized steering setpoint [-1, 1].
+	 */
+	void setSteeringSetpoint(float normalized_steering_setpoint) { _speed_diff_setpoint = normalized_steering_setpoint; }
+
 	/**
 	 * @brief Stop the vehicle by sending 0 commands to motors and servos.
 	 */
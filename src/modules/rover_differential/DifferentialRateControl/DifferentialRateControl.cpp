@@ -55,18 +55,14 @@ void DifferentialRateControl::updateParams()
 	_adjusted_yaw_rate_setpoint.setSlewRate(_param_ro_yaw_accel_limit.get() * M_DEG_TO_RAD_F);
 }
 
-void DifferentialRateControl::updateRateControl()
+float DifferentialRateControl::updateRateControl(const vehicle_angular_velocity_s &vehicle_angular_velocity, bool publish)
 {
 	hrt_abstime timestamp_prev = _timestamp;
 	_timestamp = hrt_absolute_time();
 	const float dt = math::constrain(_timestamp - timestamp_prev, 1_ms, 10_ms) * 1e-6f;
 
-	if (_vehicle_angular_velocity_sub.updated()) {
-		vehicle_angular_velocity_s vehicle_angular_velocity{};
-		_vehicle_angular_velocity_sub.copy(&vehicle_angular_velocity);
-		_vehicle_yaw_rate = fabsf(vehicle_angular_velocity.xyz[2]) > _param_ro_yaw_rate_th.get() * M_DEG_TO_RAD_F ?
-				    vehicle_angular_velocity.xyz[2] : 0.f;
-	}
+	_vehicle_yaw_rate = fabsf(vehicle_angular_velocity.xyz[2]) > _param_ro_yaw_rate_th.get() * M_DEG_TO_RAD_F ?
+			    vehicle_angular_velocity.xyz[2] : 0.f;
 
 	if (_rover_rate_setpoint_sub.updated()) {
 		rover_rate_setpoint_s rover_rate_setpoint{};
@@ -74,30 +70,38 @@ void DifferentialRateControl::updateRateControl()
 		_yaw_rate_setpoint = rover_rate_setpoint.yaw_rate_setpoint;
 	}
 
+	float speed_diff_normalized{NAN};
+
 	if (PX4_ISFINITE(_yaw_rate_setpoint)) {
 		const float yaw_rate_setpoint = fabsf(_yaw_rate_setpoint) > _param_ro_yaw_rate_th.get() * M_DEG_TO_RAD_F ?
 						_yaw_rate_setpoint : 0.f;
-		const float speed_diff_normalized = RoverControl::rateControl(_adjusted_yaw_rate_setpoint, _pid_yaw_rate,
+		speed_diff_normalized = RoverControl::rateControl(_adjusted_yaw_rate_setpoint, _pid_yaw_rate,
 						    yaw_rate_setpoint, _vehicle_yaw_rate, _param_ro_max_thr_speed.get(), _param_ro_yaw_rate_corr.get(),
 						    _param_ro_yaw_accel_limit.get() * M_DEG_TO_RAD_F,
 						    _param_ro_yaw_decel_limit.get() * M_DEG_TO_RAD_F, _param_rd_wheel_track.get(), dt);
-		rover_steering_setpoint_s rover_steering_setpoint{};
-		rover_steering_setpoint.timestamp = _timestamp;
-		rover_steering_setpoint.normalized_steering_setpoint = speed_diff_normalized;
-		_rover_steering_setpoint_pub.publish(rover_steering_setpoint);
+
+		if (publish) {
+			rover_steering_setpoint_s rover_steering_setpoint{};
+			rover_steering_setpoint.timestamp = _timestamp;
+			rover_steering_setpoint.normalized_steering_setpoint = speed_diff_normalized;
+			_rover_steering_setpoint_pub.publish(rover_steering_setpoint);
+		}
 
 	} else {
 		_pid_yaw_rate.resetIntegral();
 	}
 
-	// Publish rate controller status (logging only)
-	rover_rate_status_s rover_rate_status;
-	rover_rate_status.timestamp = _timestamp;
-	rover_rate_status.measured_yaw_rate = _vehicle_yaw_rate;
-	rover_rate_status.adjusted_yaw_rate_setpoint = _adjusted_yaw_rate_setpoint.getState();
-	rover_rate_status.pid_yaw_rate_integral = _pid_yaw_rate.getIntegral();
-	_rover_rate_status_pub.publish(rover_rate_status);
+	if (publish) {
+		// Publish rate controller status (logging only)
+		rover_rate_status_s rover_rate_status;
+		rover_rate_status.timestamp = _timestamp;
+		rover_rate_status.measured_yaw_rate = _vehicle_yaw_rate;
+		rover_rate_status.adjusted_yaw_rate_setpoint = _adjusted_yaw_rate_setpoint.getState();
+		rover_rate_status.pid_yaw_rate_integral = _pid_yaw_rate.getIntegral();
+		_rover_rate_status_pub.publish(rover_rate_status);
+	}
 
+	return speed_diff_normalized;
 }
 
 bool DifferentialRateControl::runSanityChecks()
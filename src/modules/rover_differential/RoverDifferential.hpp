@@ -45,7 +45,9 @@
 
 // uORB includes
 #include <uORB/Subscription.hpp>
+#include <uORB/SubscriptionCallback.hpp>
 #include <uORB/topics/parameter_update.h>
+#include <uORB/topics/vehicle_angular_velocity.h>
 #include <uORB/topics/vehicle_control_mode.h>
 #include <uORB/topics/vehicle_status.h>
 
@@ -97,9 +99,10 @@ private:
 	void generateSetpoints();
 
 	/**
-	 * @brief Update the controllers
+	 * @brief Update the active controllers
+	 * @param outer_loop true to also run the position, attitude and speed controllers
 	 */
-	void updateControllers();
+	void updateControllers(bool outer_loop);
 
 	/**
 	 * @brief Check proper parameter setup for the controllers
@@ -115,11 +118,18 @@ private:
 	 */
 	void reset();
 
+	// Inner loops (rate control and actuator control) run on every angular velocity sample, limited to 400 Hz.
+	// The outer loops and the setpoint generation of the drive modes run at 100 Hz.
+	static constexpr hrt_abstime INNER_LOOP_INTERVAL_MIN{2500}; // [us]
+	static constexpr hrt_abstime OUTER_LOOP_INTERVAL{10000}; // [us]
+
 	// uORB subscriptions
+	uORB::SubscriptionCallbackWorkItem _vehicle_angular_velocity_sub{this, ORB_ID(vehicle_angular_velocity)};
 	uORB::Subscription _parameter_update_sub{ORB_ID(parameter_update)};
 	uORB::Subscription _vehicle_status_sub{ORB_ID(vehicle_status)};
 	uORB::Subscription _vehicle_control_mode_sub{ORB_ID(vehicle_control_mode)};
 	vehicle_control_mode_s _vehicle_control_mode{};
+	vehicle_angular_velocity_s _vehicle_angular_velocity{};
 
 	// Class instances
 	DifferentialActControl   _differential_act_control{this};
@@ -134,4 +144,5 @@ private:
 	// Variables
 	bool _sanity_checks_passed{true}; // True if checks for all active controllers pass
 	bool _was_armed{false}; // True if the vehicle was armed before the last reset
+	hrt_abstime _outer_loop_timestamp{0};
 };
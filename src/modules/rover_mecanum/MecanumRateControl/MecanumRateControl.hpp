@@ -65,9 +65,12 @@ public:
 	~MecanumRateControl() = default;
 
 	/**
-	 * @brief Generate and publish roverSteeringSetpoint from roverRateSetpoint.
+	 * @brief Generate roverSteeringSetpoint from roverRateSetpoint.
+	 * @param vehicle_angular_velocity Latest angular velocity sample.
+	 * @param publish Publish roverSteeringSetpoint and the controller status.
+	 * @return Normalized steering setpoint [-1, 1], NAN if there is no yaw rate setpoint.
 	 */
-	void updateRateControl();
+	float updateRateControl(const vehicle_angular_velocity_s &vehicle_angular_velocity, bool publish);
 
 	/**
 	 * @brief Check if the necessary parameters are set.
@@ -90,7 +93,6 @@ private:
 
 	// uORB subscriptions
 	uORB::Subscription _rover_rate_setpoint_sub{ORB_ID(rover_rate_setpoint)};
-	uORB::Subscription _vehicle_angular_velocity_sub{ORB_ID(vehicle_angular_velocity)};
 
 	// uORB publications
 	uORB::Publication<rover_steering_setpoint_s> _rover_steering_setpoint_pub{ORB_ID(rover_steering_setpoint)};
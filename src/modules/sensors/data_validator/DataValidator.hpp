@@ -124,7 +124,7 @@ public:
 	 * Get the RMS values of this validator
 	 * @return		the stored RMS
 	 */
-	float *rms() { return _rms; }
+	float *rms();
 
 	/**
 	 * Print the validator value
@@ -179,7 +179,7 @@ private:
 	float _mean[dimensions] {}; /**< mean of value */
 	float _lp[dimensions] {};   /**< low pass value */
 	float _M2[dimensions] {};   /**< RMS component value */
-	float _rms[dimensions] {};  /**< root mean square error */
+	float _rms[dimensions] {};  /**< root mean square error, computed on demand by rms() */
 	float _value[dimensions] {}; /**< last value */
 
 	unsigned _value_equal_count{0}; /**< equal values in a row */
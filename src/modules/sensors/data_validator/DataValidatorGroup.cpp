@@ -177,7 +177,8 @@ float *DataValidatorGroup::get_best(uint64_t timestamp, int *index)
 	next = _first;
 
 	while (next != nullptr) {
-		float confidence = next->confidence(timestamp);
+		// the confidence of the current best sensor was already evaluated above
+		const float confidence = (i == pre_check_best) ? pre_check_confidence : next->confidence(timestamp);
 
 		/*
 		 * Switch if:
@@ -245,6 +245,20 @@ PARAM_DEFINE_INT32(SENS_EXT_I2C_PRB, 1);
  */
 PARAM_DEFINE_INT32(SENS_IMU_MODE, 1);
 
+/**
+ * IMU driver timing statistics
+ *
+ * Publish FIFO fill level, read to publish latency and sample timestamp jitter
+ * statistics of all accelerometer and gyroscope drivers at 1 Hz
+ * (sensor_accel_timing, sensor_gyro_timing) to diagnose scheduling problems.
+ *
+ * @boolean
+ * @category system
+ * @reboot_required true
+ * @group Sensors
+ */
+PARAM_DEFINE_INT32(SENS_IMU_TIMING, 0);
+
 /**
  * Enable internal barometers
  *
@@ -104,6 +104,23 @@ PARAM_DEFINE_INT32(SENS_MAG_AUTOROT, 1);
  */
 PARAM_DEFINE_FLOAT(SENS_MAG_RATE, 15.0f);
 
+/**
+ * Magnetometer spike rejection threshold.
+ *
+ * Isolated magnetometer samples differing from the previous accepted sample by more
+ * than this threshold are excluded from the averaged vehicle_magnetometer output.
+ * A persistent change is accepted with the following sample.
+ * Set to 0 to disable.
+ *
+ * @min 0
+ * @max 2
+ * @decimal 2
+ * @increment 0.01
+ * @unit gauss
+ * @group Sensors
+ */
+PARAM_DEFINE_FLOAT(SENS_MAG_SPIKE, 0.0f);
+
 /**
  * Sensors hub mag mode
  *
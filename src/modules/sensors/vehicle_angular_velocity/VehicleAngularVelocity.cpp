@@ -722,8 +722,21 @@ void VehicleAngularVelocity::UpdateDynamicNotchFFT(const hrt_abstime &time_now_u
 #endif // !CONSTRAINED_FLASH
 }
 
-float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int N)
+float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int N, const int16_t raw[], float raw_scale)
 {
+	// the first filter of the chain converts the raw samples (if any) into data, the following ones filter in place
+	bool convert_raw = (raw != nullptr);
+
+	auto apply_filter = [&](auto & filter) {
+		if (convert_raw) {
+			filter.applyArray(raw, raw_scale, data, N);
+			convert_raw = false;
+
+		} else {
+			filter.applyArray(data, N);
+		}
+	};
+
 #if !defined(CONSTRAINED_FLASH)
 
 	// Apply dynamic notch filter from ESC RPM
@@ -732,7 +745,7 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 			if (_esc_available[esc]) {
 				for (int harmonic = 0; harmonic < _esc_rpm_harmonics; harmonic++) {
 					if (_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].getNotchFreq() > 0.f) {
-						_dynamic_notch_filter_esc_rpm[harmonic][axis][esc].applyArray(data, N);
+						apply_filter(_dynamic_notch_filter_esc_rpm[harmonic][axis][esc]);
 					}
 				}
 			}
@@ -743,7 +756,7 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 	if (_dynamic_notch_fft_available) {
 		for (int peak = MAX_NUM_FFT_PEAKS - 1; peak >= 0; peak--) {
 			if (_dynamic_notch_filter_fft[axis][peak].getNotchFreq() > 0.f) {
-				_dynamic_notch_filter_fft[axis][peak].applyArray(data, N);
+				apply_filter(_dynamic_notch_filter_fft[axis][peak]);
 			}
 		}
 	}
@@ -752,16 +765,16 @@ float VehicleAngularVelocity::FilterAngularVelocity(int axis, float data[], int
 
 	// Apply general notch filter 0 (IMU_GYRO_NF0_FRQ)
 	if (_notch_filter0_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter0_velocity[axis].applyArray(data, N);
+		apply_filter(_notch_filter0_velocity[axis]);
 	}
 
 	// Apply general notch filter 1 (IMU_GYRO_NF1_FRQ)
 	if (_notch_filter1_velocity[axis].getNotchFreq() > 0.f) {
-		_notch_filter1_velocity[axis].applyArray(data, N);
+		apply_filter(_notch_filter1_velocity[axis]);
 	}
 
 	// Apply general low-pass filter (IMU_GYRO_CUTOFF)
-	_lp_filter_velocity[axis].applyArray(data, N);
+	apply_filter(_lp_filter_velocity[axis]);
 
 	// return last filtered sample
 	return data[N - 1];
@@ -823,11 +836,25 @@ void VehicleAngularVelocity::Run()
 	if (_fifo_available) {
 		// process all outstanding fifo messages
 		int sensor_sub_updates = 0;
-		sensor_gyro_fifo_s sensor_fifo_data;
+		sensor_gyro_fifo_s sensor_fifo_copy;
+
+		while (sensor_sub_updates < sensor_gyro_fifo_s::ORB_QUEUE_LENGTH) {
+			// read the samples in place from the topic queue (zero-copy) if available
+			const sensor_gyro_fifo_s *sensor_fifo = static_cast<const sensor_gyro_fifo_s *>(_sensor_gyro_fifo_sub.peek());
+			const bool peeked = (sensor_fifo != nullptr);
+
+			if (!peeked) {
+				if (!_sensor_gyro_fifo_sub.update(&sensor_fifo_copy)) {
+					break;
+				}
 
-		while ((sensor_sub_updates < sensor_gyro_fifo_s::ORB_QUEUE_LENGTH) && _sensor_gyro_fifo_sub.update(&sensor_fifo_data)) {
+				sensor_fifo = &sensor_fifo_copy;
+			}
+
+			const sensor_gyro_fifo_s &sensor_fifo_data = *sensor_fifo;
 			sensor_sub_updates++;
 
+			const hrt_abstime timestamp_sample = sensor_fifo_data.timestamp_sample;
 			const float inverse_dt_s = 1e6f / sensor_fifo_data.dt;
 			const int N = sensor_fifo_data.samples;
 			static constexpr int FIFO_SIZE_MAX = sizeof(sensor_fifo_data.x) / sizeof(sensor_fifo_data.x[0]);
@@ -836,24 +863,26 @@ void VehicleAngularVelocity::Run()
 				Vector3f angular_velocity_uncalibrated;
 				Vector3f angular_acceleration_uncalibrated;
 
-				int16_t *raw_data_array[] {sensor_fifo_data.x, sensor_fifo_data.y, sensor_fifo_data.z};
+				const int16_t *raw_data_array[] {sensor_fifo_data.x, sensor_fifo_data.y, sensor_fifo_data.z};
 
 				for (int axis = 0; axis < 3; axis++) {
-					// copy raw int16 sensor samples to float array for filtering
+					// raw int16 sensor samples are converted to float by the first filter
 					float data[FIFO_SIZE_MAX];
 
-					for (int n = 0; n < N; n++) {
-						data[n] = sensor_fifo_data.scale * raw_data_array[axis][n];
-					}
-
 					// save last filtered sample
-					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data, N);
+					angular_velocity_uncalibrated(axis) = FilterAngularVelocity(axis, data, N, raw_data_array[axis], sensor_fifo_data.scale);
 					angular_acceleration_uncalibrated(axis) = FilterAngularAcceleration(axis, inverse_dt_s, data, N);
 				}
 
+				if (peeked && !_sensor_gyro_fifo_sub.release()) {
+					// the driver overwrote the samples while filtering, discard and restart the filters
+					_reset_filters = true;
+					continue;
+				}
+
 				// Publish
 				if (!_sensor_gyro_fifo_sub.updated()) {
-					if (CalibrateAndPublish(sensor_fifo_data.timestamp_sample,
+					if (CalibrateAndPublish(timestamp_sample,
 								angular_velocity_uncalibrated,
 								angular_acceleration_uncalibrated)) {
 
@@ -861,6 +890,9 @@ void VehicleAngularVelocity::Run()
 						return;
 					}
 				}
+
+			} else if (peeked) {
+				_sensor_gyro_fifo_sub.release();
 			}
 		}
 
@@ -78,7 +78,8 @@ private:
 	bool CalibrateAndPublish(const hrt_abstime &timestamp_sample, const matrix::Vector3f &angular_velocity_uncalibrated,
 				 const matrix::Vector3f &angular_acceleration_uncalibrated);
 
-	inline float FilterAngularVelocity(int axis, float data[], int N = 1);
+	// filter data in place, or if raw is given filter the raw samples converted with raw_scale into data
+	inline float FilterAngularVelocity(int axis, float data[], int N = 1, const int16_t raw[] = nullptr, float raw_scale = 1.f);
 	inline float FilterAngularAcceleration(int axis, float inverse_dt_s, float data[], int N = 1);
 
 	void DisableDynamicNotchEscRpm();
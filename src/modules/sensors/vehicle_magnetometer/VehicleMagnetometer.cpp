@@ -197,6 +197,9 @@ bool VehicleMagnetometer::ParametersUpdate(bool force)
 					_timestamp_sample_sum[instance] = 0;
 					_data_sum[instance].zero();
 					_data_sum_count[instance] = 0;
+
+					// accept the first sample with the new calibration unconditionally
+					_spike_count[instance] = 1;
 				}
 			}
 		}
@@ -519,6 +522,29 @@ void VehicleMagnetometer::Run()
 					float mag_array[3] {vect(0), vect(1), vect(2)};
 					_voter.put(uorb_index, report.timestamp, mag_array, report.error_count, _priority[uorb_index]);
 
+					// sample interval estimate used to decimate the callback rate
+					if ((_last_timestamp_sample[uorb_index] != 0) && (report.timestamp_sample > _last_timestamp_sample[uorb_index])) {
+						const float interval_us = report.timestamp_sample - _last_timestamp_sample[uorb_index];
+
+						if (interval_us < BACKUP_SCHEDULE_TIMEOUT_US) {
+							_sample_interval_us[uorb_index] = (_sample_interval_us[uorb_index] > 0.f)
+											  ? 0.9f * _sample_interval_us[uorb_index] + 0.1f * interval_us : interval_us;
+						}
+					}
+
+					_last_timestamp_sample[uorb_index] = report.timestamp_sample;
+
+					// reject isolated spikes from the average, a persistent change is accepted with the following sample
+					const float spike_threshold = _param_sens_mag_spike.get();
+
+					if ((spike_threshold > 0.f) && (_spike_count[uorb_index] == 0)
+					    && ((vect - _last_data[uorb_index]).longerThan(spike_threshold))) {
+						_spike_count[uorb_index]++;
+						continue;
+					}
+
+					_spike_count[uorb_index] = 0;
+
 					_timestamp_sample_sum[uorb_index] += report.timestamp_sample;
 					_data_sum[uorb_index] += vect;
 					_data_sum_count[uorb_index]++;
@@ -628,12 +654,45 @@ void VehicleMagnetometer::Run()
 
 	UpdateStatus();
 
+	UpdateCallbackDecimation();
+
 	// reschedule timeout
-	ScheduleDelayed(50_ms);
+	ScheduleDelayed(BACKUP_SCHEDULE_TIMEOUT_US);
 
 	perf_end(_cycle_perf);
 }
 
+void VehicleMagnetometer::UpdateCallbackDecimation()
+{
+	if (_selected_sensor_sub_index < 0) {
+		return;
+	}
+
+	// the fastest magnetometer limits how long the queues can be left unread
+	float sample_interval_us = 0.f;
+
+	for (int instance = 0; instance < MAX_SENSOR_COUNT; instance++) {
+		if (_advertised[instance] && _calibration[instance].enabled() && (_sample_interval_us[instance] > 0.f)) {
+			if ((sample_interval_us <= 0.f) || (_sample_interval_us[instance] < sample_interval_us)) {
+				sample_interval_us = _sample_interval_us[instance];
+			}
+		}
+	}
+
+	// wake up once per publication interval (if the queue depth allows) instead of on every sample
+	int required_updates = 1;
+
+	if ((sample_interval_us > 0.f) && (_param_sens_mag_rate.get() > 0.f)) {
+		const float publish_interval_us = math::min(1e6f / _param_sens_mag_rate.get(), (float)BACKUP_SCHEDULE_TIMEOUT_US);
+
+		// leave one queue entry margin for scheduling jitter
+		required_updates = math::constrain((int)(publish_interval_us / sample_interval_us), 1,
+						   sensor_mag_s::ORB_QUEUE_LENGTH - 1);
+	}
+
+	_sensor_sub[_selected_sensor_sub_index].set_required_updates(required_updates);
+}
+
 void VehicleMagnetometer::CheckFailover(const hrt_abstime &time_now_us)
 {
 	// check failover and report (save failover report for a cycle where parameters didn't update)
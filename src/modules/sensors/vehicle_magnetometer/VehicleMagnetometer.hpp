@@ -94,9 +94,12 @@ private:
 	void UpdateMagBiasEstimate();
 	void UpdateMagCalibration();
 	void UpdatePowerCompensation();
+	void UpdateCallbackDecimation();
 
 	static constexpr int MAX_SENSOR_COUNT = 4;
 
+	static constexpr hrt_abstime BACKUP_SCHEDULE_TIMEOUT_US{50_ms};
+
 	uORB::Publication<sensors_status_s> _sensors_status_mag_pub{ORB_ID(sensors_status_mag)};
 
 	uORB::Publication<sensor_preflight_mag_s> _sensor_preflight_mag_pub{ORB_ID(sensor_preflight_mag)};
@@ -164,6 +167,10 @@ private:
 	hrt_abstime _last_publication_timestamp[MAX_SENSOR_COUNT] {};
 
 	matrix::Vector3f _last_data[MAX_SENSOR_COUNT] {};
+	uint8_t _spike_count[MAX_SENSOR_COUNT] {1, 1, 1, 1}; // first sample is always accepted
+
+	hrt_abstime _last_timestamp_sample[MAX_SENSOR_COUNT] {};
+	float _sample_interval_us[MAX_SENSOR_COUNT] {};
 	bool _advertised[MAX_SENSOR_COUNT] {};
 
 	matrix::Vector3f _sensor_diff[MAX_SENSOR_COUNT] {}; // filtered differences between sensor instances
@@ -179,6 +186,7 @@ private:
 		(ParamInt<px4::params::CAL_MAG_COMP_TYP>) _param_mag_comp_typ,
 		(ParamBool<px4::params::SENS_MAG_MODE>) _param_sens_mag_mode,
 		(ParamFloat<px4::params::SENS_MAG_RATE>) _param_sens_mag_rate,
+		(ParamFloat<px4::params::SENS_MAG_SPIKE>) _param_sens_mag_spike,
 		(ParamBool<px4::params::SENS_MAG_AUTOCAL>) _param_sens_mag_autocal,
 		(ParamInt<px4::params::CAL_MAG_SIDES>) _param_cal_mag_sides,
 		(ParamInt<px4::params::SENS_MAG_SIDES>) _param_sens_mag_sides
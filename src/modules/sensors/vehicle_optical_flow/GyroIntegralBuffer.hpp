@@ -0,0 +1,200 @@
+/****************************************************************************
+ *
+ *   Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file GyroIntegralBuffer.hpp
+ * Buffer of timestamped gyro samples stored as a running (prefix) integral, so the
+ * delta angle over any window of buffered samples is a single difference and the
+ * window boundaries are found with a binary search.
+ */
+
+#pragma once
+
+#include <inttypes.h>
+#include <stddef.h>
+
+#include <lib/matrix/matrix/math.hpp>
+
+template <size_t SIZE>
+class GyroIntegralBuffer
+{
+public:
+	static constexpr float DT_MAX{0.1f}; ///< larger gaps restart the integral (s)
+
+	/**
+	 * Add a gyro sample, integrated (trapezoidal) with the previous one.
+	 *
+	 * @param time_us sample timestamp (us)
+	 * @param rate angular rate (rad/s)
+	 * @param dt time since the previous sample (s)
+	 */
+	void push(const uint64_t time_us, const matrix::Vector3f &rate, const float dt)
+	{
+		if ((_newest_time_us == 0) || (time_us <= _newest_time_us) || !(dt > 0.f) || (dt > DT_MAX)) {
+			// non contiguous sample, restart the integral without a contribution from this sample
+			reset();
+
+			_buffer[0] = {time_us, 0.f, {}};
+			_count = 1;
+			_newest_time_us = time_us;
+			_last_rate = rate;
+			return;
+		}
+
+		// all buffered samples might have been consumed already
+		const matrix::Vector3f &integral_last = (_count > 0) ? _buffer[_head].integral : _tail_integral;
+		const matrix::Vector3f integral{integral_last + (rate + _last_rate) * (0.5f * dt)};
+		_newest_time_us = time_us;
+		_last_rate = rate;
+
+		if (_count == SIZE) {
+			// the overwritten sample becomes the base of the oldest remaining one
+			_tail_integral = _buffer[_tail].integral;
+			_tail = (_tail + 1) % SIZE;
+			_count--;
+		}
+
+		_head = (_head + 1) % SIZE;
+		_buffer[_head] = {time_us, dt, integral};
+		_count++;
+
+		if (integral.longerThan(REBASE_THRESHOLD)) {
+			// keep the running integral small to preserve float resolution
+			const matrix::Vector3f base{_tail_integral};
+
+			for (size_t i = 0; i < SIZE; i++) {
+				_buffer[i].integral -= base;
+			}
+
+			_tail_integral.zero();
+		}
+	}
+
+	/**
+	 * Integrate the buffered samples within [time_oldest_us, time_newest_us], stopping
+	 * at the first sample where the integration time exceeds min_interval_s. The used
+	 * samples (and all older ones) are removed from the buffer.
+	 *
+	 * @param delta_angle integrated angle (rad)
+	 * @param delta_angle_dt_us integration time (us)
+	 * @return true if at least one sample was integrated
+	 */
+	bool integrate(const uint64_t time_oldest_us, const uint64_t time_newest_us, const float min_interval_s,
+		       matrix::Vector3f &delta_angle, uint32_t &delta_angle_dt_us)
+	{
+		if ((_count == 0) || (time_oldest_us >= time_newest_us)) {
+			return false;
+		}
+
+		const size_t first = lower_bound(0, _count, time_oldest_us);
+		const size_t end = lower_bound(first, _count, time_newest_us + 1);
+
+		if (first >= end) {
+			return false;
+		}
+
+		// integration starts at the beginning of the first sample's interval
+		const Sample &first_sample = at(first);
+		const uint64_t time_start_us = first_sample.time_us - (uint64_t)roundf(first_sample.dt * 1e6f);
+		const uint64_t min_interval_us = (uint64_t)ceilf(min_interval_s * 1e6f);
+
+		size_t last = lower_bound(first, end, time_start_us + min_interval_us + 1);
+
+		if (last >= end) {
+			last = end - 1;
+		}
+
+		const Sample &last_sample = at(last);
+		const matrix::Vector3f &base = (first == 0) ? _tail_integral : at(first - 1).integral;
+
+		delta_angle = last_sample.integral - base;
+		delta_angle_dt_us = last_sample.time_us - time_start_us;
+
+		// consume
+		_tail_integral = last_sample.integral;
+		_tail = (_tail + last + 1) % SIZE;
+		_count -= last + 1;
+
+		return true;
+	}
+
+	void reset()
+	{
+		_head = 0;
+		_tail = 0;
+		_count = 0;
+		_newest_time_us = 0;
+		_tail_integral.zero();
+	}
+
+	size_t entries() const { return _count; }
+
+private:
+	struct Sample {
+		uint64_t time_us{0};     ///< timestamp of the measurement (uSec)
+		float dt{0.f};           ///< integration time of this sample (s)
+		matrix::Vector3f integral{}; ///< running integral including this sample (rad)
+	};
+
+	static constexpr float REBASE_THRESHOLD{10.f};
+
+	const Sample &at(const size_t index) const { return _buffer[(_tail + index) % SIZE]; }
+
+	// first index in [first, last) with a timestamp >= time_us
+	size_t lower_bound(size_t first, size_t last, const uint64_t time_us) const
+	{
+		while (first < last) {
+			const size_t mid = first + (last - first) / 2;
+
+			if (at(mid).time_us < time_us) {
+				first = mid + 1;
+
+			} else {
+				last = mid;
+			}
+		}
+
+		return first;
+	}
+
+	Sample _buffer[SIZE] {};
+
+	matrix::Vector3f _tail_integral{}; ///< running integral before the oldest sample
+	matrix::Vector3f _last_rate{};
+
+	uint64_t _newest_time_us{0};
+
+	size_t _head{0};
+	size_t _tail{0};
+	size_t _count{0};
+};
@@ -48,8 +48,6 @@ VehicleOpticalFlow::VehicleOpticalFlow() :
 	ScheduledWorkItem(MODULE_NAME, px4::wq_configurations::nav_and_controllers)
 {
 	_vehicle_optical_flow_pub.advertise();
-
-	_gyro_integrator.set_reset_samples(1);
 }
 
 VehicleOpticalFlow::~VehicleOpticalFlow()
@@ -146,29 +144,13 @@ void VehicleOpticalFlow::Run()
 			_delta_angle_available = false;
 
 			// integrate synchronized gyro
-			gyroSample gyro_sample;
-
-			while (_gyro_buffer.pop_oldest(timestamp_oldest, timestamp_newest, &gyro_sample)) {
-
-				_gyro_integrator.put(gyro_sample.data, gyro_sample.dt);
-
-				float min_interval_s = (sensor_optical_flow.integration_timespan_us * 1e-6f) * 0.99f;
-
-				if (_gyro_integrator.integral_dt() > min_interval_s) {
-					//PX4_INFO("integral dt: %.6f, min interval: %.6f", (double)_gyro_integrator.integral_dt(),(double) min_interval_s);
-					break;
-				}
-			}
+			const float min_interval_s = (sensor_optical_flow.integration_timespan_us * 1e-6f) * 0.99f;
 
 			Vector3f delta_angle{NAN, NAN, NAN};
 			uint32_t delta_angle_dt;
 
-			if (_gyro_integrator.reset(delta_angle, delta_angle_dt)) {
+			if (_gyro_buffer.integrate(timestamp_oldest, timestamp_newest, min_interval_s, delta_angle, delta_angle_dt)) {
 				_delta_angle += delta_angle;
-
-			} else {
-				// force integrator reset
-				_gyro_integrator.reset();
 			}
 		}
 
@@ -457,12 +439,8 @@ void VehicleOpticalFlow::UpdateSensorGyro()
 			const float dt_s = (sensor_gyro.timestamp_sample - _gyro_timestamp_sample_last) * 1e-6f;
 			_gyro_timestamp_sample_last = sensor_gyro.timestamp_sample;
 
-			gyroSample gyro_sample;
-			gyro_sample.time_us = sensor_gyro.timestamp_sample;
-			gyro_sample.data = _gyro_calibration.Correct(Vector3f{sensor_gyro.x, sensor_gyro.y, sensor_gyro.z});
-			gyro_sample.dt = dt_s;
-
-			_gyro_buffer.push(gyro_sample);
+			_gyro_buffer.push(sensor_gyro.timestamp_sample,
+					  _gyro_calibration.Correct(Vector3f{sensor_gyro.x, sensor_gyro.y, sensor_gyro.z}), dt_s);
 		}
 	}
 }
@@ -480,8 +458,6 @@ void VehicleOpticalFlow::ClearAccumulatedData()
 
 	_quality_sum = 0;
 	_accumulated_count = 0;
-
-	_gyro_integrator.reset();
 }
 
 void VehicleOpticalFlow::PrintStatus()
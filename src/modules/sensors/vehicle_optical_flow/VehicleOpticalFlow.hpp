@@ -34,9 +34,9 @@
 #pragma once
 
 #include "data_validator/DataValidatorGroup.hpp"
+#include "GyroIntegralBuffer.hpp"
 #include "RingBuffer.hpp"
 
-#include <Integrator.hpp>
 
 #include <lib/mathlib/math/Limits.hpp>
 #include <lib/matrix/matrix/math.hpp>
@@ -101,8 +101,6 @@ private:
 	uORB::SubscriptionCallbackWorkItem _sensor_gyro_sub{this, ORB_ID(sensor_gyro)};
 	uORB::SubscriptionCallbackWorkItem _sensor_selection_sub{this, ORB_ID(sensor_selection)};
 
-	sensors::IntegratorConing _gyro_integrator{};
-
 	hrt_abstime _gyro_timestamp_sample_last{0};
 
 	calibration::Gyroscope _gyro_calibration{};
@@ -124,18 +122,12 @@ private:
 
 	bool _delta_angle_available{false};
 
-	struct gyroSample {
-		uint64_t time_us{}; ///< timestamp of the measurement (uSec)
-		matrix::Vector3f data{};
-		float dt{0.f};
-	};
-
 	struct rangeSample {
 		uint64_t time_us{}; ///< timestamp of the measurement (uSec)
 		float data{};
 	};
 
-	RingBuffer<gyroSample, 32> _gyro_buffer{};
+	GyroIntegralBuffer<32> _gyro_buffer{};
 	RingBuffer<rangeSample, 5> _range_buffer{};
 
 	DEFINE_PARAMETERS(
@@ -116,3 +116,78 @@ TEST_F(VehicleOpticalFlowTest, CameraFacingForward)
 	// THEN: sensor is not selected
 	EXPECT_FALSE(testable.IsDistanceSensorSelected());
 }
+
+TEST(GyroIntegralBufferTest, IntegrateWindow)
+{
+	// GIVEN: 1 kHz gyro samples at a constant rate
+	GyroIntegralBuffer<32> buffer;
+	const matrix::Vector3f rate{0.1f, -0.2f, 0.3f};
+
+	for (uint64_t t = 1'000'000; t <= 1'020'000; t += 1'000) {
+		buffer.push(t, rate, 1e-3f);
+	}
+
+	// WHEN: integrating a 10 ms window
+	matrix::Vector3f delta_angle;
+	uint32_t delta_angle_dt_us = 0;
+	EXPECT_TRUE(buffer.integrate(1'005'000, 1'020'000, 0.0099f, delta_angle, delta_angle_dt_us));
+
+	// THEN: the integral starts with the first sample in the window and stops once the interval is reached
+	EXPECT_EQ(delta_angle_dt_us, 10'000u);
+	EXPECT_FALSE((delta_angle - rate * 0.01f).longerThan(1e-6f));
+
+	// the used and older samples were consumed
+	EXPECT_EQ(buffer.entries(), 6u);
+	EXPECT_FALSE(buffer.integrate(1'000'000, 1'014'000, 0.f, delta_angle, delta_angle_dt_us));
+}
+
+TEST(GyroIntegralBufferTest, ContinuesAfterConsumed)
+{
+	GyroIntegralBuffer<32> buffer;
+	const matrix::Vector3f rate{1.f, 0.f, 0.f};
+
+	matrix::Vector3f delta_angle;
+	uint32_t delta_angle_dt_us = 0;
+
+	// the first sample only starts the integral
+	buffer.push(1'000'000, rate, 1e-3f);
+	buffer.push(1'001'000, rate, 1e-3f);
+	EXPECT_TRUE(buffer.integrate(1'000'000, 1'001'000, 1.f, delta_angle, delta_angle_dt_us));
+	EXPECT_EQ(delta_angle_dt_us, 1'000u);
+	EXPECT_FLOAT_EQ(delta_angle(0), 1e-3f);
+	EXPECT_EQ(buffer.entries(), 0u);
+
+	// WHEN: the buffer is empty, the next sample is still integrated from the previous one
+	buffer.push(1'002'000, rate, 1e-3f);
+	EXPECT_TRUE(buffer.integrate(1'001'500, 1'002'000, 1.f, delta_angle, delta_angle_dt_us));
+	EXPECT_EQ(delta_angle_dt_us, 1'000u);
+	EXPECT_FLOAT_EQ(delta_angle(0), 1e-3f);
+
+	// WHEN: there is a gap, the integral restarts
+	buffer.push(1'500'000, rate, 0.498f);
+	EXPECT_TRUE(buffer.integrate(1'400'000, 1'500'000, 1.f, delta_angle, delta_angle_dt_us));
+	EXPECT_EQ(delta_angle_dt_us, 0u);
+	EXPECT_FLOAT_EQ(delta_angle(0), 0.f);
+}
+
+TEST(GyroIntegralBufferTest, RebaseKeepsIntegral)
+{
+	GyroIntegralBuffer<8> buffer;
+	const matrix::Vector3f rate{20.f, 0.f, 0.f};
+
+	uint64_t t = 1'000'000;
+
+	for (int i = 0; i < 200; i++) {
+		buffer.push(t, rate, 1e-2f);
+		t += 10'000;
+	}
+
+	// WHEN: integrating over the buffered samples after the running integral was rebased several times
+	matrix::Vector3f delta_angle;
+	uint32_t delta_angle_dt_us = 0;
+	EXPECT_TRUE(buffer.integrate(t - 50'000, t, 0.05f, delta_angle, delta_angle_dt_us));
+
+	// THEN
+	EXPECT_EQ(delta_angle_dt_us, 50'000u);
+	EXPECT_NEAR(delta_angle(0), 1.f, 1e-5f);
+}
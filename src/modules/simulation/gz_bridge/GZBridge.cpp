@@ -452,14 +452,6 @@ void GZBridge::imuCallback(const gz::msgs::IMU &msg)
 {
 	const uint64_t timestamp = hrt_absolute_time();
 
-	// FLU -> FRD
-	static const auto q_FLU_to_FRD = gz::math::Quaterniond(0, 1, 0, 0);
-
-	gz::math::Vector3d accel_b = q_FLU_to_FRD.RotateVector(gz::math::Vector3d(
-					     msg.linear_acceleration().x(),
-					     msg.linear_acceleration().y(),
-					     msg.linear_acceleration().z()));
-
 	device::Device::DeviceId id{};
 	id.devid_s.bus_type = device::Device::DeviceBusType::DeviceBusType_SIMULATION;
 	id.devid_s.devtype = DRV_IMU_DEVTYPE_SIM;
@@ -473,26 +465,22 @@ void GZBridge::imuCallback(const gz::msgs::IMU &msg)
 	accel.timestamp = timestamp;
 	accel.device_id = id.devid;
 
-	accel.x = accel_b.X();
-	accel.y = accel_b.Y();
-	accel.z = accel_b.Z();
+	// FLU -> FRD (rotation by 180 deg around x), decoded directly from the message
+	accel.x = msg.linear_acceleration().x();
+	accel.y = -msg.linear_acceleration().y();
+	accel.z = -msg.linear_acceleration().z();
 	accel.temperature = NAN;
 	accel.samples = 1;
 	_sensor_accel_pub.publish(accel);
 
-	gz::math::Vector3d gyro_b = q_FLU_to_FRD.RotateVector(gz::math::Vector3d(
-					    msg.angular_velocity().x(),
-					    msg.angular_velocity().y(),
-					    msg.angular_velocity().z()));
-
 	// publish gyro
 	sensor_gyro_s gyro{};
 	gyro.timestamp_sample = timestamp;
 	gyro.timestamp = timestamp;
 	gyro.device_id = id.devid;
-	gyro.x = gyro_b.X();
-	gyro.y = gyro_b.Y();
-	gyro.z = gyro_b.Z();
+	gyro.x = msg.angular_velocity().x();
+	gyro.y = -msg.angular_velocity().y();
+	gyro.z = -msg.angular_velocity().z();
 	gyro.temperature = NAN;
 	gyro.samples = 1;
 	_sensor_gyro_pub.publish(gyro);
@@ -508,8 +496,8 @@ void GZBridge::poseInfoCallback(const gz::msgs::Pose_V &msg)
 			const double dt = math::constrain((timestamp - _timestamp_prev) * 1e-6, 0.001, 0.1);
 			_timestamp_prev = timestamp;
 
-			gz::msgs::Vector3d pose_position = msg.pose(p).position();
-			gz::msgs::Quaternion pose_orientation = msg.pose(p).orientation();
+			const gz::msgs::Vector3d &pose_position = msg.pose(p).position();
+			const gz::msgs::Quaternion &pose_orientation = msg.pose(p).orientation();
 
 			// ground truth
 			gz::math::Quaterniond q_gr = gz::math::Quaterniond(
@@ -604,7 +592,7 @@ void GZBridge::odometryCallback(const gz::msgs::OdometryWithCovariance &msg)
 	report.position[2] = -msg.pose_with_covariance().pose().position().z();
 
 	// gz odometry orientation is "body FLU->ENU" and needs to be converted in "body FRD->NED"
-	gz::msgs::Quaternion pose_orientation = msg.pose_with_covariance().pose().orientation();
+	const gz::msgs::Quaternion &pose_orientation = msg.pose_with_covariance().pose().orientation();
 	gz::math::Quaterniond q_gr = gz::math::Quaterniond(
 					     pose_orientation.w(),
 					     pose_orientation.x(),
@@ -819,7 +807,7 @@ void GZBridge::laserScantoLidarSensorCallback(const gz::msgs::LaserScan &msg)
 	report.signal_quality = -1;
 	report.type = distance_sensor_s::MAV_DISTANCE_SENSOR_LASER;
 
-	gz::msgs::Quaternion pose_orientation = msg.world_pose().orientation();
+	const gz::msgs::Quaternion &pose_orientation = msg.world_pose().orientation();
 	gz::math::Quaterniond q_sensor = gz::math::Quaterniond(
 			pose_orientation.w(),
 			pose_orientation.x(),
@@ -856,15 +844,30 @@ void GZBridge::laserScanCallback(const gz::msgs::LaserScan &msg)
 {
 	static constexpr int SECTOR_SIZE_DEG = 5; // PX4 Collision Prevention uses 5 degree sectors
 
+	// Publish to uORB
+	obstacle_distance_s report {};
+	static constexpr int MAX_SECTORS = sizeof(report.distances) / sizeof(report.distances[0]);
+
 	double angle_min_deg = msg.angle_min() * 180 / M_PI;
 	double angle_step_deg = msg.angle_step() * 180 / M_PI;
 
-	int samples_per_sector = std::round(SECTOR_SIZE_DEG / angle_step_deg);
-	int number_of_sectors = msg.ranges_size() / samples_per_sector;
+	int samples_per_sector = math::max(static_cast<int>(std::round(SECTOR_SIZE_DEG / angle_step_deg)), 1);
+	int number_of_sectors = math::min(msg.ranges_size() / samples_per_sector, MAX_SECTORS);
 
-	std::vector<double> ds_array(number_of_sectors, UINT16_MAX);
+	// Initialize unknown
+	for (auto &i : report.distances) {
+		i = UINT16_MAX;
+	}
 
-	// Downsample -- take average of samples per sector
+	report.timestamp = hrt_absolute_time();
+	report.frame = obstacle_distance_s::MAV_FRAME_BODY_FRD;
+	report.sensor_type = obstacle_distance_s::MAV_DISTANCE_SENSOR_LASER;
+	report.min_distance = static_cast<uint16_t>(msg.range_min() * 100.);
+	report.max_distance = static_cast<uint16_t>(msg.range_max() * 100.);
+	report.angle_offset = static_cast<float>(angle_min_deg);
+	report.increment = static_cast<float>(SECTOR_SIZE_DEG);
+
+	// Downsample -- take average of samples per sector, directly into the sectors of ObstacleDistance
 	for (int i = 0; i < number_of_sectors; i++) {
 
 		double sum = 0;
@@ -873,7 +876,7 @@ void GZBridge::laserScanCallback(const gz::msgs::LaserScan &msg)
 
 		for (int j = 0; j < samples_per_sector; j++) {
 
-			double distance = msg.ranges()[i * samples_per_sector + j];
+			double distance = msg.ranges(i * samples_per_sector + j);
 
 			// inf values mean no object
 			if (isinf(distance)) {
@@ -885,37 +888,11 @@ void GZBridge::laserScanCallback(const gz::msgs::LaserScan &msg)
 		}
 
 		// If all samples in a sector are inf then it means the sector is clear
-		if (samples_used_in_sector == 0) {
-			ds_array[i] = msg.range_max();
-
-		} else {
-			ds_array[i] = sum / samples_used_in_sector;
-		}
-	}
+		const double sector_distance = (samples_used_in_sector == 0) ? msg.range_max() : sum / samples_used_in_sector;
+		uint16_t distance_cm = sector_distance * 100.;
 
-	// Publish to uORB
-	obstacle_distance_s report {};
-
-	// Initialize unknown
-	for (auto &i : report.distances) {
-		i = UINT16_MAX;
-	}
-
-	report.timestamp = hrt_absolute_time();
-	report.frame = obstacle_distance_s::MAV_FRAME_BODY_FRD;
-	report.sensor_type = obstacle_distance_s::MAV_DISTANCE_SENSOR_LASER;
-	report.min_distance = static_cast<uint16_t>(msg.range_min() * 100.);
-	report.max_distance = static_cast<uint16_t>(msg.range_max() * 100.);
-	report.angle_offset = static_cast<float>(angle_min_deg);
-	report.increment = static_cast<float>(SECTOR_SIZE_DEG);
-
-	// Map samples in FOV into sectors in ObstacleDistance
-	int index = 0;
-
-	// Iterate in reverse because array is FLU and we need FRD
-	for (std::vector<double>::reverse_iterator i = ds_array.rbegin(); i != ds_array.rend(); ++i) {
-
-		uint16_t distance_cm = (*i) * 100.;
+		// Reverse order because the scan is FLU and we need FRD
+		const int index = number_of_sectors - 1 - i;
 
 		if (distance_cm >= report.max_distance) {
 			report.distances[index] = report.max_distance + 1;
@@ -926,8 +903,6 @@ void GZBridge::laserScanCallback(const gz::msgs::LaserScan &msg)
 		} else {
 			report.distances[index] = distance_cm;
 		}
-
-		index++;
 	}
 
 	_obstacle_distance_pub.publish(report);
@@ -59,6 +59,7 @@
 
 static int _fd;
 static unsigned char _buf[2048];
+static constexpr int MAX_READS_PER_WAKEUP = 16; ///< datagrams (or TCP reads) handled per poll() wakeup
 static sockaddr_in _srcaddr;
 static unsigned _addrlen = sizeof(_srcaddr);
 
@@ -1234,7 +1235,9 @@ void SimulatorMavlink::run()
 
 			int len = ::recvfrom(_fd, _buf, sizeof(_buf), 0, (struct sockaddr *)&_srcaddr, (socklen_t *)&_addrlen);
 
-			if (len > 0) {
+			// handle everything that is pending (e.g. HIL_SENSOR, HIL_GPS and HIL_STATE_QUATERNION
+			// arriving back to back) before going back to poll, so a simulation step is one wakeup
+			for (int reads = 0; len > 0 && reads < MAX_READS_PER_WAKEUP; reads++) {
 				mavlink_message_t msg;
 
 				for (int i = 0; i < len; i++) {
@@ -1242,6 +1245,8 @@ void SimulatorMavlink::run()
 						handle_message(&msg);
 					}
 				}
+
+				len = ::recvfrom(_fd, _buf, sizeof(_buf), MSG_DONTWAIT, (struct sockaddr *)&_srcaddr, (socklen_t *)&_addrlen);
 			}
 		}
 	}
@@ -78,6 +78,7 @@ void Sih::run()
 	_last_run = task_start;
 	_airspeed_time = task_start;
 	_dist_snsr_time = task_start;
+	_ground_truth_time = task_start;
 	_vehicle = static_cast<VehicleType>(constrain(_sih_vtype.get(),
 					    static_cast<int32_t>(VehicleType::First),
 					    static_cast<int32_t>(VehicleType::Last)));
@@ -203,8 +204,6 @@ void Sih::sensor_step()
 		parameters_updated();
 	}
 
-	perf_begin(_loop_perf);
-
 	const hrt_abstime now = hrt_absolute_time();
 	const float dt = (now - _last_run) * 1e-6f;
 	_last_run = now;
@@ -232,9 +231,11 @@ void Sih::sensor_step()
 		send_dist_snsr(now);
 	}
 
-	publish_ground_truth(now);
-
-	perf_end(_loop_perf);
+	// ground truth published at 200 Hz, its consumers (sensor simulators, logger, mavlink) run at 100 Hz or less
+	if (now - _ground_truth_time >= 5_ms) {
+		_ground_truth_time = now;
+		publish_ground_truth(now);
+	}
 }
 
 void Sih::parameters_updated()
@@ -199,6 +199,7 @@ private:
 	hrt_abstime _last_actuator_output_time{0};
 	hrt_abstime _airspeed_time{0};
 	hrt_abstime _dist_snsr_time{0};
+	hrt_abstime _ground_truth_time{0};
 
 	bool _grounded{true}; // whether the vehicle is on the ground
 
@@ -433,11 +433,11 @@ int TemperatureCompensation::update_offsets_accel(int topic_instance, float temp
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only recalculate the offsets if the temperature delta is large enough to warrant a new publication,
+	// the offsets are kept in place otherwise
 	if (fabsf(temperature - _accel_data.last_temperature[topic_instance]) > 1.0f) {
+		calc_thermal_offsets_3D(_parameters.accel_cal_data[mapping], temperature, offsets);
+
 		_accel_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
@@ -459,11 +459,11 @@ int TemperatureCompensation::update_offsets_gyro(int topic_instance, float tempe
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only recalculate the offsets if the temperature delta is large enough to warrant a new publication,
+	// the offsets are kept in place otherwise
 	if (fabsf(temperature - _gyro_data.last_temperature[topic_instance]) > 1.0f) {
+		calc_thermal_offsets_3D(_parameters.gyro_cal_data[mapping], temperature, offsets);
+
 		_gyro_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
@@ -485,11 +485,11 @@ int TemperatureCompensation::update_offsets_mag(int topic_instance, float temper
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only recalculate the offsets if the temperature delta is large enough to warrant a new publication,
+	// the offsets are kept in place otherwise
 	if (fabsf(temperature - _mag_data.last_temperature[topic_instance]) > 1.0f) {
+		calc_thermal_offsets_3D(_parameters.mag_cal_data[mapping], temperature, offsets);
+
 		_mag_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
@@ -511,11 +511,11 @@ int TemperatureCompensation::update_offsets_baro(int topic_instance, float tempe
 		return -1;
 	}
 
-	// Calculate and update the offsets
-	calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
-
-	// Check if temperature delta is large enough to warrant a new publication
+	// Only recalculate the offsets if the temperature delta is large enough to warrant a new publication,
+	// the offsets are kept in place otherwise
 	if (fabsf(temperature - _baro_data.last_temperature[topic_instance]) > 1.0f) {
+		calc_thermal_offsets_1D(_parameters.baro_cal_data[mapping], temperature, *offsets);
+
 		_baro_data.last_temperature[topic_instance] = temperature;
 		return 2;
 	}
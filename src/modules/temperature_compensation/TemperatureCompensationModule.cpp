@@ -189,7 +189,8 @@ void TemperatureCompensationModule::gyroPoll()
 				// Use accelerometer of the same instance if gyro temperature was NAN.
 				sensor_accel_s sensor_accel;
 
-				if (_accel_subs[uorb_index].update(&sensor_accel)) {
+				if (_accel_subs[uorb_index].update(&sensor_accel)
+				    && !(fabsf(sensor_accel.temperature - _corrections.gyro_temperature[uorb_index]) <= 1.f)) {
 					_corrections.gyro_temperature[uorb_index] = sensor_accel.temperature;
 					_corrections_changed = true;
 				}
@@ -224,7 +225,8 @@ void TemperatureCompensationModule::magPoll()
 				// Use primary baro instance if mag temperature was NAN.
 				sensor_baro_s sensor_baro;
 
-				if (_accel_subs[0].update(&sensor_baro)) {
+				if (_accel_subs[0].update(&sensor_baro)
+				    && !(fabsf(sensor_baro.temperature - _corrections.mag_temperature[uorb_index]) <= 1.f)) {
 					_corrections.mag_temperature[uorb_index] = sensor_baro.temperature;
 					_corrections_changed = true;
 				}
@@ -259,7 +261,8 @@ void TemperatureCompensationModule::baroPoll()
 				// Use primary accelerometer instance if baro temperature was NAN.
 				sensor_accel_s sensor_accel;
 
-				if (_accel_subs[0].update(&sensor_accel)) {
+				if (_accel_subs[0].update(&sensor_accel)
+				    && !(fabsf(sensor_accel.temperature - _corrections.baro_temperature[uorb_index]) <= 1.f)) {
 					_corrections.baro_temperature[uorb_index] = sensor_accel.temperature;
 					_corrections_changed = true;
 				}
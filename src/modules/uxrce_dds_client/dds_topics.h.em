@@ -92,7 +92,7 @@ struct SendTopicsSubs {
 	uint32_t num_payload_sent{};
 
 	bool init(uxrSession *session, uxrStreamId reliable_out_stream_id, uxrStreamId reliable_in_stream_id, uxrStreamId best_effort_in_stream_id, uxrObjectId participant_id, const char *client_namespace);
-	void update(uxrSession *session, uxrStreamId reliable_out_stream_id, uxrStreamId best_effort_stream_id, uxrObjectId participant_id, const char *client_namespace);
+	void update(uxrSession *session, uxrStreamId reliable_out_stream_id, uxrStreamId best_effort_stream_id, uxrObjectId participant_id, const char *client_namespace, uint32_t batch_size);
 	void reset();
 };
 
@@ -123,12 +123,18 @@ void SendTopicsSubs::reset() {
 	}
 };
 
-void SendTopicsSubs::update(uxrSession *session, uxrStreamId reliable_out_stream_id, uxrStreamId best_effort_stream_id, uxrObjectId participant_id, const char *client_namespace)
+void SendTopicsSubs::update(uxrSession *session, uxrStreamId reliable_out_stream_id, uxrStreamId best_effort_stream_id, uxrObjectId participant_id, const char *client_namespace, uint32_t batch_size)
 {
+	// XRCE submessage header and WRITE_DATA header, including alignment
+	static constexpr uint32_t submessage_overhead = 12;
+
 	int64_t time_offset_us = session->time_offset / 1000; // ns -> us
 
 	alignas(sizeof(uint64_t)) char topic_data[max_topic_size];
 
+	// bytes written to the best effort stream since the last flush
+	uint32_t batched = 0;
+
 	for (unsigned idx = 0; idx < sizeof(send_subscriptions)/sizeof(send_subscriptions[0]); ++idx) {
 		if (fds[idx].revents & POLLIN) {
 			// Topic updated, copy data and send
@@ -138,11 +144,22 @@ void SendTopicsSubs::update(uxrSession *session, uxrStreamId reliable_out_stream
 
 				ucdrBuffer ub;
 				uint32_t topic_size = send_subscriptions[idx].topic_size;
+
+				// send the batch if this sample does not fit anymore
+				if (batched > 0 && batched + topic_size + submessage_overhead > batch_size) {
+					uxr_flash_output_streams(session);
+					batched = 0;
+				}
+
 				if (uxr_prepare_output_stream(session, best_effort_stream_id, send_subscriptions[idx].data_writer, &ub, topic_size) != UXR_INVALID_REQUEST_ID) {
 					send_subscriptions[idx].ucdr_serialize_method(&topic_data, ub, time_offset_us);
-					// TODO: fill up the MTU and then flush, which reduces the packet overhead
-					uxr_flash_output_streams(session);
 					num_payload_sent += topic_size;
+					batched += topic_size + submessage_overhead;
+
+					if (batched >= batch_size) {
+						uxr_flash_output_streams(session);
+						batched = 0;
+					}
 
 				} else {
 					//PX4_ERR("Error uxr_prepare_output_stream UXR_INVALID_REQUEST_ID %s", send_subscriptions[idx].subscription.get_topic()->o_name);
@@ -154,6 +171,10 @@ void SendTopicsSubs::update(uxrSession *session, uxrStreamId reliable_out_stream
 
 		}
 	}
+
+	if (batched > 0) {
+		uxr_flash_output_streams(session);
+	}
 }
 
 // Publishers for received messages
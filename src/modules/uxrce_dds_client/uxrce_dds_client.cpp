@@ -643,6 +643,18 @@ void UxrceddsClient::run()
 		int poll_error_counter = 0;
 		resetConnectivityCounters();
 
+		// topic writes are batched up to the transport MTU (minus the message header)
+		uint32_t mtu = UXR_CONFIG_SERIAL_TRANSPORT_MTU;
+#if defined(UXRCE_DDS_CLIENT_UDP)
+
+		if (_transport == Transport::Udp) {
+			mtu = UXR_CONFIG_UDP_TRANSPORT_MTU;
+		}
+
+#endif // UXRCE_DDS_CLIENT_UDP
+
+		const uint32_t batch_size = math::constrain(_param_uxrce_dds_batch.get(), (int32_t)0, (int32_t)mtu - 32);
+
 		while (!should_exit() && _connected) {
 			perf_begin(_loop_perf);
 			perf_count(_loop_interval_perf);
@@ -662,7 +674,7 @@ void UxrceddsClient::run()
 
 			/* Handle the poll results */
 			if (poll > 0) {
-				_subs->update(&session, _reliable_out, _best_effort_out, _participant_id, _client_namespace);
+				_subs->update(&session, _reliable_out, _best_effort_out, _participant_id, _client_namespace, batch_size);
 
 			} else {
 				if (poll < 0) {
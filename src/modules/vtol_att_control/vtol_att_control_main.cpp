@@ -281,6 +281,146 @@ VtolAttitudeControl::update_callbacks()
 	_previous_vtol_mode = current_vtol_mode;
 }
 
+void
+VtolAttitudeControl::update_mode(bool mc_att_sp_updated, bool fw_att_sp_updated)
+{
+	parameters_update();
+
+	_vehicle_control_mode_sub.update(&_vehicle_control_mode);
+	_vehicle_attitude_sub.update(&_vehicle_attitude);
+	_local_pos_sub.update(&_local_pos);
+	_local_pos_sp_sub.update(&_local_pos_sp);
+	_pos_sp_triplet_sub.update(&_pos_sp_triplet);
+	_tecs_status_sub.update(&_tecs_status);
+	_land_detected_sub.update(&_land_detected);
+
+	if (_home_position_sub.updated()) {
+		home_position_s home_position;
+
+		if (_home_position_sub.copy(&home_position) && home_position.valid_alt) {
+			_home_position_z = home_position.z;
+
+		} else {
+			_home_position_z = NAN;
+		}
+	}
+
+	if (_airspeed_validated_sub.updated()) {
+		airspeed_validated_s airspeed_validated;
+
+		if (_airspeed_validated_sub.copy(&airspeed_validated)) {
+			const bool airspeed_from_sensor = airspeed_validated.airspeed_source == airspeed_validated_s::SOURCE_SENSOR_1
+							  || airspeed_validated.airspeed_source == airspeed_validated_s::SOURCE_SENSOR_2
+							  || airspeed_validated.airspeed_source == airspeed_validated_s::SOURCE_SENSOR_3;
+			const bool use_airspeed = _param_fw_use_airspd.get() && airspeed_from_sensor;
+
+			_calibrated_airspeed = use_airspeed ? airspeed_validated.calibrated_airspeed_m_s : NAN;
+			_time_last_airspeed_update = airspeed_validated.timestamp;
+
+		} else if (hrt_elapsed_time(&_time_last_airspeed_update) > 1_s) {
+			_calibrated_airspeed = NAN;
+		}
+	}
+
+	vehicle_status_poll();
+	action_request_poll();
+	vehicle_cmd_poll();
+
+	vehicle_air_data_s air_data;
+
+	if (_vehicle_air_data_sub.update(&air_data)) {
+		_air_density = air_data.rho;
+	}
+
+	_vtol_type->handleEkfResets();
+
+	// update the vtol state machine which decides which mode we are in
+	_vtol_type->update_vtol_state();
+
+	// check in which mode we are in and call mode specific functions
+	switch (_vtol_type->get_mode()) {
+	case mode::TRANSITION_TO_FW:
+		// vehicle is doing a transition to FW
+		_vtol_vehicle_status.vehicle_vtol_state = vtol_vehicle_status_s::VEHICLE_VTOL_STATE_TRANSITION_TO_FW;
+
+		if (mc_att_sp_updated || fw_att_sp_updated) {
+			_vtol_type->update_transition_state();
+			_vehicle_attitude_sp_pub.publish(_vehicle_attitude_sp);
+		}
+
+		break;
+
+	case mode::TRANSITION_TO_MC:
+		// vehicle is doing a transition to MC
+		_vtol_vehicle_status.vehicle_vtol_state = vtol_vehicle_status_s::VEHICLE_VTOL_STATE_TRANSITION_TO_MC;
+
+		if (mc_att_sp_updated || fw_att_sp_updated) {
+			_vtol_type->update_transition_state();
+			_vehicle_attitude_sp_pub.publish(_vehicle_attitude_sp);
+		}
+
+		break;
+
+	case mode::ROTARY_WING:
+		// vehicle is in rotary wing mode
+		_vtol_vehicle_status.vehicle_vtol_state = vtol_vehicle_status_s::VEHICLE_VTOL_STATE_MC;
+
+		if (mc_att_sp_updated) {
+			_vtol_type->update_mc_state();
+			_vehicle_attitude_sp_pub.publish(_vehicle_attitude_sp);
+		}
+
+		break;
+
+	case mode::FIXED_WING:
+		// vehicle is in fw mode
+		_vtol_vehicle_status.vehicle_vtol_state = vtol_vehicle_status_s::VEHICLE_VTOL_STATE_FW;
+
+		if (fw_att_sp_updated) {
+			_vtol_type->update_fw_state();
+			_vehicle_attitude_sp_pub.publish(_vehicle_attitude_sp);
+		}
+
+		break;
+	}
+
+	// Advertise/publish vtol vehicle status -- immediately if changed, otherwise at 1 Hz
+	const bool vtol_vehicle_status_changed =
+		(_vtol_vehicle_status.vehicle_vtol_state != _prev_published_vtol_vehicle_status.vehicle_vtol_state) ||
+		(_vtol_vehicle_status.fixed_wing_system_failure != _prev_published_vtol_vehicle_status.fixed_wing_system_failure);
+
+	if (vtol_vehicle_status_changed || hrt_elapsed_time(&_prev_published_vtol_vehicle_status.timestamp) >= 1_s) {
+		_vtol_vehicle_status.timestamp = hrt_absolute_time();
+		_vtol_vehicle_status_pub.publish(_vtol_vehicle_status);
+		_prev_published_vtol_vehicle_status = _vtol_vehicle_status;
+	}
+
+	// Publish flaps/spoiler setpoint with configured deflection in Hover if in Auto.
+	// In Manual always published in FW rate controller, and in Auto FW in FW Position Controller.
+	if (_vehicle_control_mode.flag_control_auto_enabled
+	    && _vtol_vehicle_status.vehicle_vtol_state != vtol_vehicle_status_s::VEHICLE_VTOL_STATE_FW) {
+
+		// flaps
+		normalized_unsigned_setpoint_s flaps_setpoint;
+		flaps_setpoint.normalized_setpoint = 0.f; // for now always set flaps to 0 in transitions and hover
+		flaps_setpoint.timestamp = hrt_absolute_time();
+		_flaps_setpoint_pub.publish(flaps_setpoint);
+
+		// spoilers
+		float spoiler_control = 0.f;
+
+		if ((_pos_sp_triplet.current.valid && _pos_sp_triplet.current.type == position_setpoint_s::SETPOINT_TYPE_LAND) ||
+		    _vehicle_status.nav_state == vehicle_status_s::NAVIGATION_STATE_DESCEND) {
+			spoiler_control = _param_vt_spoiler_mc_ld.get();
+		}
+
+		normalized_unsigned_setpoint_s spoiler_setpoint;
+		spoiler_setpoint.normalized_setpoint = spoiler_control;
+		spoiler_setpoint.timestamp = hrt_absolute_time();
+		_spoilers_setpoint_pub.publish(spoiler_setpoint);
+	}
+}
+
 void
 VtolAttitudeControl::Run()
 {
@@ -345,108 +485,17 @@ VtolAttitudeControl::Run()
 	}
 
 	if (should_run) {
-		parameters_update();
-
-		_vehicle_control_mode_sub.update(&_vehicle_control_mode);
-		_vehicle_attitude_sub.update(&_vehicle_attitude);
-		_local_pos_sub.update(&_local_pos);
-		_local_pos_sp_sub.update(&_local_pos_sp);
-		_pos_sp_triplet_sub.update(&_pos_sp_triplet);
-		_tecs_status_sub.update(&_tecs_status);
-		_land_detected_sub.update(&_land_detected);
-
-		if (_home_position_sub.updated()) {
-			home_position_s home_position;
-
-			if (_home_position_sub.copy(&home_position) && home_position.valid_alt) {
-				_home_position_z = home_position.z;
-
-			} else {
-				_home_position_z = NAN;
-			}
-		}
-
-		if (_airspeed_validated_sub.updated()) {
-			airspeed_validated_s airspeed_validated;
-
-			if (_airspeed_validated_sub.copy(&airspeed_validated)) {
-				const bool airspeed_from_sensor = airspeed_validated.airspeed_source == airspeed_validated_s::SOURCE_SENSOR_1
-								  || airspeed_validated.airspeed_source == airspeed_validated_s::SOURCE_SENSOR_2
-								  || airspeed_validated.airspeed_source == airspeed_validated_s::SOURCE_SENSOR_3;
-				const bool use_airspeed = _param_fw_use_airspd.get() && airspeed_from_sensor;
-
-				_calibrated_airspeed = use_airspeed ? airspeed_validated.calibrated_airspeed_m_s : NAN;
-				_time_last_airspeed_update = airspeed_validated.timestamp;
-
-			} else if (hrt_elapsed_time(&_time_last_airspeed_update) > 1_s) {
-				_calibrated_airspeed = NAN;
-			}
-		}
-
-		vehicle_status_poll();
-		action_request_poll();
-		vehicle_cmd_poll();
-
-		vehicle_air_data_s air_data;
-
-		if (_vehicle_air_data_sub.update(&air_data)) {
-			_air_density = air_data.rho;
-		}
-
-		_vtol_type->handleEkfResets();
-
 		// check if mc and fw sp were updated
 		const bool mc_att_sp_updated = _mc_virtual_att_sp_sub.update(&_mc_virtual_att_sp);
 		const bool fw_att_sp_updated = _fw_virtual_att_sp_sub.update(&_fw_virtual_att_sp);
 
-		// update the vtol state machine which decides which mode we are in
-		_vtol_type->update_vtol_state();
-
-		// check in which mode we are in and call mode specific functions
-		switch (_vtol_type->get_mode()) {
-		case mode::TRANSITION_TO_FW:
-			// vehicle is doing a transition to FW
-			_vtol_vehicle_status.vehicle_vtol_state = vtol_vehicle_status_s::VEHICLE_VTOL_STATE_TRANSITION_TO_FW;
-
-			if (mc_att_sp_updated || fw_att_sp_updated) {
-				_vtol_type->update_transition_state();
-				_vehicle_attitude_sp_pub.publish(_vehicle_attitude_sp);
-			}
+		const hrt_abstime time_now = hrt_absolute_time();
 
-			break;
-
-		case mode::TRANSITION_TO_MC:
-			// vehicle is doing a transition to MC
-			_vtol_vehicle_status.vehicle_vtol_state = vtol_vehicle_status_s::VEHICLE_VTOL_STATE_TRANSITION_TO_MC;
-
-			if (mc_att_sp_updated || fw_att_sp_updated) {
-				_vtol_type->update_transition_state();
-				_vehicle_attitude_sp_pub.publish(_vehicle_attitude_sp);
-			}
-
-			break;
-
-		case mode::ROTARY_WING:
-			// vehicle is in rotary wing mode
-			_vtol_vehicle_status.vehicle_vtol_state = vtol_vehicle_status_s::VEHICLE_VTOL_STATE_MC;
-
-			if (mc_att_sp_updated) {
-				_vtol_type->update_mc_state();
-				_vehicle_attitude_sp_pub.publish(_vehicle_attitude_sp);
-			}
-
-			break;
-
-		case mode::FIXED_WING:
-			// vehicle is in fw mode
-			_vtol_vehicle_status.vehicle_vtol_state = vtol_vehicle_status_s::VEHICLE_VTOL_STATE_FW;
-
-			if (fw_att_sp_updated) {
-				_vtol_type->update_fw_state();
-				_vehicle_attitude_sp_pub.publish(_vehicle_attitude_sp);
-			}
-
-			break;
+		// The mode and transition logic only needs to run when new attitude setpoints arrive, and at a low rate
+		// when there are none (e.g. rate control), while the actuator outputs follow every new virtual setpoint.
+		if (mc_att_sp_updated || fw_att_sp_updated || (time_now - _time_last_mode_update) >= kModeUpdateIntervalMax) {
+			_time_last_mode_update = time_now;
+			update_mode(mc_att_sp_updated, fw_att_sp_updated);
 		}
 
 		_vtol_type->fill_actuator_outputs();
@@ -455,42 +504,6 @@ VtolAttitudeControl::Run()
 		_vehicle_thrust_setpoint1_pub.publish(_thrust_setpoint_1);
 		_vehicle_torque_setpoint0_pub.publish(_torque_setpoint_0);
 		_vehicle_torque_setpoint1_pub.publish(_torque_setpoint_1);
-
-		// Advertise/publish vtol vehicle status -- immediately if changed, otherwise at 1 Hz
-		const bool vtol_vehicle_status_changed =
-			(_vtol_vehicle_status.vehicle_vtol_state != _prev_published_vtol_vehicle_status.vehicle_vtol_state) ||
-			(_vtol_vehicle_status.fixed_wing_system_failure != _prev_published_vtol_vehicle_status.fixed_wing_system_failure);
-
-		if (vtol_vehicle_status_changed || hrt_elapsed_time(&_prev_published_vtol_vehicle_status.timestamp) >= 1_s) {
-			_vtol_vehicle_status.timestamp = hrt_absolute_time();
-			_vtol_vehicle_status_pub.publish(_vtol_vehicle_status);
-			_prev_published_vtol_vehicle_status = _vtol_vehicle_status;
-		}
-
-		// Publish flaps/spoiler setpoint with configured deflection in Hover if in Auto.
-		// In Manual always published in FW rate controller, and in Auto FW in FW Position Controller.
-		if (_vehicle_control_mode.flag_control_auto_enabled
-		    && _vtol_vehicle_status.vehicle_vtol_state != vtol_vehicle_status_s::VEHICLE_VTOL_STATE_FW) {
-
-			// flaps
-			normalized_unsigned_setpoint_s flaps_setpoint;
-			flaps_setpoint.normalized_setpoint = 0.f; // for now always set flaps to 0 in transitions and hover
-			flaps_setpoint.timestamp = hrt_absolute_time();
-			_flaps_setpoint_pub.publish(flaps_setpoint);
-
-			// spoilers
-			float spoiler_control = 0.f;
-
-			if ((_pos_sp_triplet.current.valid && _pos_sp_triplet.current.type == position_setpoint_s::SETPOINT_TYPE_LAND) ||
-			    _vehicle_status.nav_state == vehicle_status_s::NAVIGATION_STATE_DESCEND) {
-				spoiler_control = _param_vt_spoiler_mc_ld.get();
-			}
-
-			normalized_unsigned_setpoint_s spoiler_setpoint;
-			spoiler_setpoint.normalized_setpoint = spoiler_control;
-			spoiler_setpoint.timestamp = hrt_absolute_time();
-			_spoilers_setpoint_pub.publish(spoiler_setpoint);
-		}
 	}
 
 	perf_end(_loop_perf);
@@ -219,6 +219,9 @@ private:
 	hrt_abstime _last_run_timestamp {0};
 #endif // !ENABLE_LOCKSTEP_SCHEDULER
 
+	static constexpr hrt_abstime kModeUpdateIntervalMax{20_ms};	// mode logic update interval without new attitude setpoints
+	hrt_abstime _time_last_mode_update{0};
+
 	/* For multicopters it is usual to have a non-zero idle speed of the engines
 	 * for fixed wings we want to have an idle speed of zero since we do not want
 	 * to waste energy when gliding. */
@@ -234,6 +237,8 @@ private:
 
 	perf_counter_t	_loop_perf;		// loop performance counter
 
+	void		update_mode(bool mc_att_sp_updated, bool fw_att_sp_updated);
+
 	void		vehicle_status_poll();
 
 	void		action_request_poll();
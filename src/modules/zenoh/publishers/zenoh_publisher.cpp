@@ -97,8 +97,10 @@ z_result_t Zenoh_Publisher::publish(const uint8_t *buf, int size)
 
 	options.attachment = z_move(z_attachment);
 
+	// The sample is encoded into the transport buffer within z_publisher_put(), so the
+	// payload can alias the caller's buffer instead of being copied to the heap first
 	z_owned_bytes_t payload;
-	ret = z_bytes_copy_from_buf(&payload, buf, size);
+	ret = z_bytes_from_static_buf(&payload, buf, size);
 
 	if (ret != Z_OK) {
 		return ret;
@@ -41,6 +41,7 @@
 #include <fcntl.h>
 #include <systemlib/err.h>
 #include <drivers/drv_hrt.h>
+#include <lib/mathlib/mathlib.h>
 #include <ctype.h>
 #include <string.h>
 
@@ -52,6 +53,8 @@
 // Auto-generated header to all uORB <-> CDR conversions
 #include <uorb_pubsub_factory.hpp>
 
+using namespace time_literals;
+
 ModuleBase::Descriptor ZENOH::desc{task_spawn, custom_command, print_usage};
 
 #define Z_PUBLISH
@@ -444,8 +447,31 @@ void ZENOH::run()
 		}
 	}
 
+#ifdef CONFIG_ZENOH_BATCHING
+	// Samples published until the next flush are collected into one transport batch
+	const hrt_abstime batch_deadline = _zenoh_batch_ms.get() * 1_ms;
+	hrt_abstime batch_start = 0;
+
+	if (zp_batch_start(z_loan(_s)) < 0) {
+		PX4_WARN("Unable to start batching");
+	}
+
+#endif
+
 	while (!should_exit()) {
-		int pret = px4_poll(pfds, _pub_count, 100);
+		int timeout_ms = 100;
+
+#ifdef CONFIG_ZENOH_BATCHING
+
+		if (batch_start != 0) {
+			// wake up in time to honor the flush deadline of the pending batch
+			const hrt_abstime elapsed = hrt_elapsed_time(&batch_start);
+			timeout_ms = (elapsed < batch_deadline) ? math::max((int)((batch_deadline - elapsed) / 1_ms), 1) : 0;
+		}
+
+#endif
+
+		int pret = px4_poll(pfds, _pub_count, timeout_ms);
 
 		if (pret == 0) {
 			//PX4_INFO("Zenoh poll timeout\n");
@@ -459,11 +485,32 @@ void ZENOH::run()
 						PX4_WARN("%s Publisher error %i", _zenoh_publishers[i]->getName(), ret);
 
 					}
+
+#ifdef CONFIG_ZENOH_BATCHING
+
+					if (ret >= 0 && batch_start == 0) {
+						batch_start = hrt_absolute_time();
+					}
+
+#endif
 				}
 			}
 		}
+
+#ifdef CONFIG_ZENOH_BATCHING
+
+		if (batch_start != 0 && hrt_elapsed_time(&batch_start) >= batch_deadline) {
+			zp_batch_flush(z_loan(_s));
+			batch_start = 0;
+		}
+
+#endif
 	}
 
+#ifdef CONFIG_ZENOH_BATCHING
+	zp_batch_stop(z_loan(_s));
+#endif
+
 	// Exiting cleaning up publisher and subscribers
 	for (i = 0; i < _sub_count; i++) {
 		if (_zenoh_subscribers[i]) {
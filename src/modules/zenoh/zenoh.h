@@ -88,7 +88,8 @@ public:
 
 private:
 	DEFINE_PARAMETERS(
-		(ParamInt<px4::params::ZENOH_DOMAIN_ID>) _zenoh_domain_id
+		(ParamInt<px4::params::ZENOH_DOMAIN_ID>) _zenoh_domain_id,
+		(ParamInt<px4::params::ZENOH_BATCH_MS>) _zenoh_batch_ms
 	)
 
 	int generate_rmw_zenoh_node_liveliness_keyexpr(const z_id_t *id, char *keyexpr);
@@ -46,3 +46,15 @@
  * @max 232
  */
 PARAM_DEFINE_INT32(ZENOH_DOMAIN_ID, 0);
+
+/**
+ * Zenoh batch flush deadline
+ *
+ * Maximum time a published sample is held in the transport batch
+ * (only with CONFIG_ZENOH_BATCHING). 0 flushes after every poll cycle.
+ *
+ * @unit ms
+ * @min 0
+ * @max 100
+ */
+PARAM_DEFINE_INT32(ZENOH_BATCH_MS, 5);
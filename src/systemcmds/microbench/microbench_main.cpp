@@ -41,10 +41,17 @@
 
 __BEGIN_DECLS
 
+extern int test_microbench_adsb(int argc, char *argv[]);
 extern int test_microbench_atomic(int argc, char *argv[]);
+extern int test_microbench_crc(int argc, char *argv[]);
+extern int test_microbench_filters(int argc, char *argv[]);
+extern int test_microbench_geo(int argc, char *argv[]);
 extern int test_microbench_hrt(int argc, char *argv[]);
+extern int test_microbench_latency(int argc, char *argv[]);
 extern int test_microbench_math(int argc, char *argv[]);
 extern int test_microbench_matrix(int argc, char *argv[]);
+extern int test_microbench_param(int argc, char *argv[]);
+extern int test_microbench_ringbuffer(int argc, char *argv[]);
 extern int test_microbench_uorb(int argc, char *argv[]);
 
 __END_DECLS
@@ -63,10 +70,17 @@ const struct {
 	{"help",		microbench_help,		OPT_NOALLTEST | OPT_NOHELP},
 	{"all",		microbench_all,		OPT_NOALLTEST},
 
+	{"microbench_adsb",	test_microbench_adsb,	0},
 	{"microbench_atomic",	test_microbench_atomic,	0},
+	{"microbench_crc",	test_microbench_crc,	0},
+	{"microbench_filters",	test_microbench_filters,	0},
+	{"microbench_geo",	test_microbench_geo,	0},
 	{"microbench_hrt",	test_microbench_hrt,	0},
+	{"microbench_latency",	test_microbench_latency,	0},
 	{"microbench_math",	test_microbench_math,	0},
 	{"microbench_matrix",	test_microbench_matrix,	0},
+	{"microbench_param",	test_microbench_param,	0},
+	{"microbench_ringbuffer",	test_microbench_ringbuffer,	0},
 	{"microbench_uorb",	test_microbench_uorb,	0},
 
 	{"null",			nullptr, 		0}
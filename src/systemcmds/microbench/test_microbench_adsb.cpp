@@ -0,0 +1,201 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_adsb.cpp
+ * Microbenchmark the ADS-B traffic table with synthetic traffic.
+ */
+
+#include <unit_test.h>
+
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <lib/adsb/TrafficTable.h>
+#include <lib/geo/geo.h>
+
+namespace MicroBenchAdsb
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		reset(); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+			reset(); \
+		} \
+		perf_print_counter(p); \
+		perf_free(p); \
+	} while (0)
+
+static constexpr double LAT_NOW = 47.3977;
+static constexpr double LON_NOW = 8.5456;
+
+class MicroBenchAdsb : public UnitTest
+{
+public:
+	MicroBenchAdsb();
+	~MicroBenchAdsb() override { delete _traffic_table; }
+
+	bool run_tests() override;
+
+private:
+
+	bool time_traffic_table();
+	bool time_per_report();
+
+	void reset();
+	void random_report(transponder_report_s &transponder_report, uint32_t icao_address);
+	void detect_per_report(const transponder_report_s &transponder_report);
+
+	TrafficTable *_traffic_table{nullptr};
+	transponder_report_s _reports[TRAFFIC_TABLE_SIZE] {};
+
+	transponder_report_s _report{};
+	volatile int i32_out{0};
+	volatile bool bool_out{false};
+};
+
+MicroBenchAdsb::MicroBenchAdsb()
+{
+	srand(time(nullptr));
+
+	// a full table of synthetic traffic
+	_traffic_table = new TrafficTable();
+
+	for (int i = 0; i < TRAFFIC_TABLE_SIZE; i++) {
+		random_report(_reports[i], i);
+
+		if (_traffic_table) {
+			_traffic_table->update(_reports[i], hrt_absolute_time());
+		}
+	}
+}
+
+bool MicroBenchAdsb::run_tests()
+{
+	ut_run_test(time_traffic_table);
+	ut_run_test(time_per_report);
+
+	return (_tests_failed == 0);
+}
+
+void MicroBenchAdsb::random_report(transponder_report_s &transponder_report, uint32_t icao_address)
+{
+	// within ~50 km, at airliner and general aviation speeds
+	transponder_report.icao_address = icao_address;
+	transponder_report.lat = LAT_NOW + (rand() / (double)RAND_MAX - 0.5) * 0.9;
+	transponder_report.lon = LON_NOW + (rand() / (double)RAND_MAX - 0.5) * 1.3;
+	transponder_report.altitude = (rand() / (float)RAND_MAX) * 10000.f;
+	transponder_report.heading = (rand() / (float)RAND_MAX) * M_TWOPI_F;
+	transponder_report.hor_velocity = 30.f + (rand() / (float)RAND_MAX) * 220.f;
+	transponder_report.ver_velocity = (rand() / (float)RAND_MAX - 0.5f) * 10.f;
+}
+
+void MicroBenchAdsb::reset()
+{
+	random_report(_report, rand() % TRAFFIC_TABLE_SIZE);
+}
+
+ut_declare_test_c(test_microbench_adsb, MicroBenchAdsb)
+
+bool MicroBenchAdsb::time_traffic_table()
+{
+	ut_assert("allocation failed", _traffic_table != nullptr);
+
+	PERF("TrafficTable::update", bool_out = _traffic_table->update(_report, hrt_absolute_time()), 1000);
+	PERF("TrafficTable::detect_conflicts (full table)",
+	     i32_out = _traffic_table->detect_conflicts(LAT_NOW, LON_NOW, 1000.f, 10.f, 0.f, 0.f, 500.f, 500.f, 60.f), 1000);
+	PERF("TrafficTable::detect_conflicts (5s threshold)",
+	     i32_out = _traffic_table->detect_conflicts(LAT_NOW, LON_NOW, 1000.f, 10.f, 0.f, 0.f, 500.f, 500.f, 5.f), 1000);
+
+	return true;
+}
+
+void MicroBenchAdsb::detect_per_report(const transponder_report_s &transponder_report)
+{
+	// the geodesic math of AdsbConflict::detect_traffic_conflict()
+	float d_hor, d_vert;
+	get_distance_to_point_global_wgs84(LAT_NOW, LON_NOW, 1000.f, transponder_report.lat, transponder_report.lon,
+					   transponder_report.altitude, &d_hor, &d_vert);
+
+	double end_lat, end_lon;
+	waypoint_from_heading_and_distance(transponder_report.lat, transponder_report.lon, transponder_report.heading,
+					   d_hor + 1000.f, &end_lat, &end_lon);
+
+	crosstrack_error_s crosstrack_error;
+	bool_out = get_distance_to_line(crosstrack_error, LAT_NOW, LON_NOW, transponder_report.lat, transponder_report.lon,
+					end_lat, end_lon) == 0 && fabsf(crosstrack_error.distance) < 500.f;
+}
+
+bool MicroBenchAdsb::time_per_report()
+{
+	PERF("per report geodesic conflict check (1 report)", detect_per_report(_report), 1000);
+	PERF("per report geodesic conflict check (full table)",
+	for (int k = 0; k < TRAFFIC_TABLE_SIZE; k++) { detect_per_report(_reports[k]); }, 100);
+
+	return true;
+}
+
+} // namespace MicroBenchAdsb
@@ -0,0 +1,146 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_crc.cpp
+ * Microbenchmark the CRC-16 and CRC-32 functions.
+ */
+
+#include <unit_test.h>
+
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+extern "C" {
+#include <lib/crc/crc.h>
+}
+
+namespace MicroBenchCrc
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		reset(); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+			reset(); \
+		} \
+		perf_print_counter(p); \
+		perf_free(p); \
+	} while (0)
+
+static constexpr size_t BUFFER_SIZE = 1024;
+
+class MicroBenchCrc : public UnitTest
+{
+public:
+	bool run_tests() override;
+
+private:
+
+	bool time_crc16();
+	bool time_crc32();
+
+	void reset();
+
+	uint8_t _buffer[BUFFER_SIZE] {};
+	volatile uint32_t u32_out{0};
+};
+
+bool MicroBenchCrc::run_tests()
+{
+	ut_run_test(time_crc16);
+	ut_run_test(time_crc32);
+
+	return (_tests_failed == 0);
+}
+
+void MicroBenchCrc::reset()
+{
+	srand(time(nullptr));
+
+	for (size_t i = 0; i < BUFFER_SIZE; i++) {
+		_buffer[i] = rand();
+	}
+}
+
+ut_declare_test_c(test_microbench_crc, MicroBenchCrc)
+
+bool MicroBenchCrc::time_crc16()
+{
+	PERF("crc16_signature (16 bytes)", u32_out = crc16_signature(CRC16_INITIAL, 16, _buffer), 1000);
+	PERF("crc16_signature (1024 bytes)", u32_out = crc16_signature(CRC16_INITIAL, BUFFER_SIZE, _buffer), 1000);
+
+	return true;
+}
+
+bool MicroBenchCrc::time_crc32()
+{
+	PERF("crc32_signature (16 bytes)", u32_out = crc32_signature(0, 16, _buffer), 1000);
+	PERF("crc32_signature (1024 bytes)", u32_out = crc32_signature(0, BUFFER_SIZE, _buffer), 1000);
+
+	return true;
+}
+
+} // namespace MicroBenchCrc
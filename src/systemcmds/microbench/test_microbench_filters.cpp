@@ -0,0 +1,168 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_filters.cpp
+ * Microbenchmark the low pass and notch filters used on the sensor data.
+ */
+
+#include <unit_test.h>
+
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <lib/mathlib/math/filter/LowPassFilter2p.hpp>
+#include <lib/mathlib/math/filter/NotchFilter.hpp>
+#include <matrix/math.hpp>
+
+namespace MicroBenchFilters
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		reset(); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+			reset(); \
+		} \
+		perf_print_counter(p); \
+		perf_free(p); \
+	} while (0)
+
+static constexpr int FIFO_SIZE = 32; // sensor FIFO samples per update
+
+class MicroBenchFilters : public UnitTest
+{
+public:
+	MicroBenchFilters()
+	{
+		_lpf.set_cutoff_frequency(8000.f, 80.f);
+		_lpf3.set_cutoff_frequency(8000.f, 80.f);
+		_notch.setParameters(8000.f, 150.f, 20.f);
+		_notch3.setParameters(8000.f, 150.f, 20.f);
+	}
+
+	bool run_tests() override;
+
+private:
+
+	bool time_lowpass();
+	bool time_notch();
+
+	void reset();
+
+	math::LowPassFilter2p<float> _lpf{};
+	math::LowPassFilter2p<matrix::Vector3f> _lpf3{};
+	math::NotchFilter<float> _notch{};
+	math::NotchFilter<matrix::Vector3f> _notch3{};
+
+	float f32{0.f};
+	volatile float f32_out{0.f};
+	matrix::Vector3f v3{};
+	matrix::Vector3f v3_out{};
+	int16_t fifo[FIFO_SIZE] {};
+	float fifo_out[FIFO_SIZE] {};
+};
+
+bool MicroBenchFilters::run_tests()
+{
+	ut_run_test(time_lowpass);
+	ut_run_test(time_notch);
+
+	return (_tests_failed == 0);
+}
+
+void MicroBenchFilters::reset()
+{
+	srand(time(nullptr));
+
+	f32 = rand() / (float)RAND_MAX;
+	v3 = matrix::Vector3f(rand(), rand(), rand()) / (float)RAND_MAX;
+
+	for (int i = 0; i < FIFO_SIZE; i++) {
+		fifo[i] = rand();
+	}
+}
+
+ut_declare_test_c(test_microbench_filters, MicroBenchFilters)
+
+bool MicroBenchFilters::time_lowpass()
+{
+	PERF("LowPassFilter2p<float> apply", f32_out = _lpf.apply(f32), 1000);
+	PERF("LowPassFilter2p<Vector3f> apply", v3_out = _lpf3.apply(v3), 1000);
+	PERF("LowPassFilter2p<float> applyArray (32 samples)", _lpf.applyArray(fifo, 0.1f, fifo_out, FIFO_SIZE), 1000);
+
+	return true;
+}
+
+bool MicroBenchFilters::time_notch()
+{
+	PERF("NotchFilter<float> apply", f32_out = _notch.apply(f32), 1000);
+	PERF("NotchFilter<Vector3f> apply", v3_out = _notch3.apply(v3), 1000);
+	PERF("NotchFilter<float> applyArray (32 samples)", _notch.applyArray(fifo, 0.1f, fifo_out, FIFO_SIZE), 1000);
+
+	return true;
+}
+
+} // namespace MicroBenchFilters
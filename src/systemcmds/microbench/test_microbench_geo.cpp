@@ -0,0 +1,156 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_geo.cpp
+ * Microbenchmark the local projection and distance functions.
+ */
+
+#include <unit_test.h>
+
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <lib/geo/geo.h>
+
+namespace MicroBenchGeo
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		reset(); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+			reset(); \
+		} \
+		perf_print_counter(p); \
+		perf_free(p); \
+	} while (0)
+
+class MicroBenchGeo : public UnitTest
+{
+public:
+	MicroBenchGeo()
+	{
+		_projection.initReference(47.3977, 8.5456);
+	}
+
+	bool run_tests() override;
+
+private:
+
+	bool time_projection();
+	bool time_distance();
+
+	void reset();
+
+	MapProjection _projection{};
+
+	double lat{0.};
+	double lon{0.};
+	float x{0.f};
+	float y{0.f};
+	volatile float f32_out{0.f};
+	volatile double f64_out{0.};
+};
+
+bool MicroBenchGeo::run_tests()
+{
+	ut_run_test(time_projection);
+	ut_run_test(time_distance);
+
+	return (_tests_failed == 0);
+}
+
+void MicroBenchGeo::reset()
+{
+	srand(time(nullptr));
+
+	// within ~100 m of the reference
+	lat = 47.3977 + (rand() / (double)RAND_MAX - 0.5) * 1e-3;
+	lon = 8.5456 + (rand() / (double)RAND_MAX - 0.5) * 1e-3;
+	x = (rand() / (float)RAND_MAX - 0.5f) * 100.f;
+	y = (rand() / (float)RAND_MAX - 0.5f) * 100.f;
+}
+
+ut_declare_test_c(test_microbench_geo, MicroBenchGeo)
+
+bool MicroBenchGeo::time_projection()
+{
+	PERF("MapProjection::project", _projection.project(lat, lon, x, y); f32_out = x, 1000);
+	PERF("MapProjection::projectFast", _projection.projectFast(lat, lon, x, y); f32_out = x, 1000);
+	PERF("MapProjection::reproject", _projection.reproject(x, y, lat, lon); f64_out = lat, 1000);
+
+	return true;
+}
+
+bool MicroBenchGeo::time_distance()
+{
+	PERF("get_distance_to_next_waypoint", f32_out = get_distance_to_next_waypoint(47.3977, 8.5456, lat, lon), 1000);
+	PERF("get_bearing_to_next_waypoint", f32_out = get_bearing_to_next_waypoint(47.3977, 8.5456, lat, lon), 1000);
+
+	return true;
+}
+
+} // namespace MicroBenchGeo
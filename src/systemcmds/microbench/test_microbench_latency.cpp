@@ -0,0 +1,339 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2018-2021 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_latency.cpp
+ * Latency benchmarks for the scheduling primitives used in the control path
+ * (work queue wakeup, hrt timer wakeup, uORB publication to callback), each measured
+ * idle and with a synthetic CPU load running at the default task priority.
+ *
+ * For the end-to-end latency from the IMU sample to the actuator output on a running system
+ * see the control_latency topic (published by the output modules).
+ */
+
+#include <unit_test.h>
+
+#include <inttypes.h>
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/atomic.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+#include <px4_platform_common/px4_work_queue/ScheduledWorkItem.hpp>
+#include <px4_platform_common/tasks.h>
+
+#include <uORB/Publication.hpp>
+#include <uORB/SubscriptionCallback.hpp>
+#include <uORB/topics/orb_test.h>
+
+using namespace time_literals;
+
+namespace MicroBenchLatency
+{
+
+static constexpr int ITERATIONS = 1000;
+static constexpr hrt_abstime RUN_TIMEOUT = 100_ms;
+
+/**
+ * Work item on the highest priority test queue that records the time from the trigger
+ * until it runs
+ */
+class LatencyWorkItem : public px4::ScheduledWorkItem
+{
+public:
+	LatencyWorkItem() :
+		ScheduledWorkItem("microbench_latency", px4::wq_configurations::test1)
+	{}
+
+	~LatencyWorkItem() override
+	{
+		_orb_test_sub.unregisterCallback();
+	}
+
+	void set_perf(perf_counter_t perf) { _perf = perf; }
+
+	unsigned runs() const { return _runs.load(); }
+
+	bool register_callback()
+	{
+		_callback_registered = _orb_test_sub.registerCallback();
+		return _callback_registered;
+	}
+
+	void unregister_callback()
+	{
+		_orb_test_sub.unregisterCallback();
+		_callback_registered = false;
+	}
+
+	void trigger_now()
+	{
+		_trigger_time = hrt_absolute_time();
+		ScheduleNow();
+	}
+
+	void trigger_delayed(uint32_t delay_us)
+	{
+		_trigger_time = hrt_absolute_time() + delay_us;
+		ScheduleDelayed(delay_us);
+	}
+
+	void trigger_publication()
+	{
+		orb_test_s orb_test{};
+		orb_test.val = _runs.load();
+		orb_test.timestamp = hrt_absolute_time();
+		_orb_test_pub.publish(orb_test);
+	}
+
+private:
+	void Run() override
+	{
+		const hrt_abstime now = hrt_absolute_time();
+		hrt_abstime trigger_time = _trigger_time;
+
+		orb_test_s orb_test;
+
+		// the subscription would also see earlier publications, only use it in the callback benchmark
+		if (_callback_registered && _orb_test_sub.update(&orb_test)) {
+			trigger_time = orb_test.timestamp;
+		}
+
+		perf_set_elapsed(_perf, now - trigger_time);
+		_runs.fetch_add(1);
+	}
+
+	uORB::Publication<orb_test_s> _orb_test_pub{ORB_ID(orb_test)};
+	uORB::SubscriptionCallbackWorkItem _orb_test_sub{this, ORB_ID(orb_test)};
+
+	perf_counter_t _perf{nullptr};
+	hrt_abstime _trigger_time{0};
+	bool _callback_registered{false};
+	px4::atomic<unsigned> _runs{0};
+};
+
+/**
+ * Synthetic CPU load: a task at the default priority that spins for 900 us of every ms,
+ * so everything up to that priority is delayed and higher priorities have to preempt it
+ */
+class LoadGenerator
+{
+public:
+	bool start()
+	{
+		_should_exit.store(false);
+		_running.store(true);
+		_task_id = px4_task_spawn_cmd("microbench_load", SCHED_DEFAULT, SCHED_PRIORITY_DEFAULT, 1024, &task_main, nullptr);
+
+		if (_task_id < 0) {
+			_running.store(false);
+			return false;
+		}
+
+		return true;
+	}
+
+	void stop()
+	{
+		_should_exit.store(true);
+
+		while (_running.load()) {
+			px4_usleep(1000);
+		}
+	}
+
+private:
+	static int task_main(int argc, char *argv[])
+	{
+		while (!_should_exit.load()) {
+			const hrt_abstime start = hrt_absolute_time();
+
+			while (hrt_elapsed_time(&start) < 900) {
+				// busy loop
+			}
+
+			px4_usleep(100);
+		}
+
+		_running.store(false);
+		return 0;
+	}
+
+	static px4::atomic_bool _should_exit;
+	static px4::atomic_bool _running;
+
+	px4_task_t _task_id{-1};
+};
+
+px4::atomic_bool LoadGenerator::_should_exit{false};
+px4::atomic_bool LoadGenerator::_running{false};
+
+class MicroBenchLatency : public UnitTest
+{
+public:
+	virtual bool run_tests();
+
+private:
+	enum class Trigger {
+		ScheduleNow,
+		ScheduleDelayed,
+		Publication,
+	};
+
+	bool time_wq_schedule_now();
+	bool time_wq_schedule_now_loaded();
+	bool time_hrt_schedule_delayed();
+	bool time_hrt_schedule_delayed_loaded();
+	bool time_uorb_callback();
+	bool time_uorb_callback_loaded();
+
+	bool measure(const char *name, Trigger trigger, bool loaded);
+};
+
+bool MicroBenchLatency::run_tests()
+{
+	ut_run_test(time_wq_schedule_now);
+	ut_run_test(time_wq_schedule_now_loaded);
+	ut_run_test(time_hrt_schedule_delayed);
+	ut_run_test(time_hrt_schedule_delayed_loaded);
+	ut_run_test(time_uorb_callback);
+	ut_run_test(time_uorb_callback_loaded);
+
+	return (_tests_failed == 0);
+}
+
+bool MicroBenchLatency::measure(const char *name, Trigger trigger, bool loaded)
+{
+	LatencyWorkItem work_item;
+	LoadGenerator load;
+
+	if (trigger == Trigger::Publication && !work_item.register_callback()) {
+		PX4_ERR("%s: callback registration failed", name);
+		return false;
+	}
+
+	if (loaded && !load.start()) {
+		PX4_ERR("%s: load task start failed", name);
+		return false;
+	}
+
+	perf_counter_t p = perf_alloc(PC_ELAPSED, name);
+	work_item.set_perf(p);
+
+	px4_usleep(1000);
+
+	bool timeout = false;
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		switch (trigger) {
+		case Trigger::ScheduleNow:
+			work_item.trigger_now();
+			break;
+
+		case Trigger::ScheduleDelayed:
+			work_item.trigger_delayed(500);
+			break;
+
+		case Trigger::Publication:
+			work_item.trigger_publication();
+			break;
+		}
+
+		// wait for the run before the next trigger, so every sample is a single wakeup
+		const hrt_abstime start = hrt_absolute_time();
+
+		while (work_item.runs() <= (unsigned)i) {
+			if (hrt_elapsed_time(&start) > RUN_TIMEOUT) {
+				timeout = true;
+				break;
+			}
+
+			px4_usleep(100);
+		}
+
+		if (timeout) {
+			PX4_ERR("%s: no run after %" PRIu64 " us", name, RUN_TIMEOUT);
+			break;
+		}
+	}
+
+	if (loaded) {
+		load.stop();
+	}
+
+	work_item.unregister_callback();
+	work_item.ScheduleClear();
+
+	perf_print_counter(p);
+	perf_free(p);
+
+	return !timeout;
+}
+
+bool MicroBenchLatency::time_wq_schedule_now()
+{
+	return measure("WorkQueue ScheduleNow to Run", Trigger::ScheduleNow, false);
+}
+
+bool MicroBenchLatency::time_wq_schedule_now_loaded()
+{
+	return measure("WorkQueue ScheduleNow to Run (load)", Trigger::ScheduleNow, true);
+}
+
+bool MicroBenchLatency::time_hrt_schedule_delayed()
+{
+	return measure("hrt ScheduleDelayed lateness", Trigger::ScheduleDelayed, false);
+}
+
+bool MicroBenchLatency::time_hrt_schedule_delayed_loaded()
+{
+	return measure("hrt ScheduleDelayed lateness (load)", Trigger::ScheduleDelayed, true);
+}
+
+bool MicroBenchLatency::time_uorb_callback()
+{
+	return measure("uORB publish to callback Run", Trigger::Publication, false);
+}
+
+bool MicroBenchLatency::time_uorb_callback_loaded()
+{
+	return measure("uORB publish to callback Run (load)", Trigger::Publication, true);
+}
+
+ut_declare_test_c(test_microbench_latency, MicroBenchLatency)
+
+} // namespace MicroBenchLatency
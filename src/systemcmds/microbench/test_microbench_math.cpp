@@ -48,6 +48,8 @@
 #include <px4_platform_common/px4_config.h>
 #include <px4_platform_common/micro_hal.h>
 
+#include <lib/mathlib/mathlib.h>
+
 namespace MicroBenchMath
 {
 
@@ -105,6 +107,7 @@ public:
 private:
 	bool time_single_precision_float();
 	bool time_single_precision_float_trig();
+	bool time_single_precision_float_fast_trig();
 
 	bool time_double_precision_float();
 	bool time_double_precision_float_trig();
@@ -142,6 +145,7 @@ bool MicroBenchMath::run_tests()
 {
 	ut_run_test(time_single_precision_float);
 	ut_run_test(time_single_precision_float_trig);
+	ut_run_test(time_single_precision_float_fast_trig);
 	ut_run_test(time_double_precision_float);
 	ut_run_test(time_double_precision_float_trig);
 	ut_run_test(time_8bit_integers);
@@ -212,6 +216,18 @@ bool MicroBenchMath::time_single_precision_float_trig()
 	return true;
 }
 
+bool MicroBenchMath::time_single_precision_float_fast_trig()
+{
+	PERF("math::fast::sin() (1k ops)", f32_out = math::fast::sin(f32), 1000);
+	PERF("math::fast::cos() (1k ops)", f32_out = math::fast::cos(f32), 1000);
+	PERF("math::fast::atan2() (1k ops)", f32_out = math::fast::atan2(f32, 2.0f * f32), 1000);
+
+	PERF("expf() (1k ops)", f32_out = expf(f32), 1000);
+	PERF("math::fast::exp() (1k ops)", f32_out = math::fast::exp(f32), 1000);
+
+	return true;
+}
+
 bool MicroBenchMath::time_double_precision_float()
 {
 	PERF("double add (1k ops)", f64_out += f64, 1000);
@@ -99,6 +99,7 @@ private:
 	bool time_matrix_quaternion();
 	bool time_matrix_dcm();
 	bool time_matrix_pseduo_inverse();
+	bool time_matrix_multiplication();
 
 	void reset();
 
@@ -108,6 +109,14 @@ private:
 	matrix::Matrix<float, 16, 6> A16;
 	matrix::Matrix<float, 6, 16> B16;
 	matrix::Matrix<float, 6, 16> B16_4;
+	matrix::Matrix3f M3;
+	matrix::Matrix3f N3;
+	matrix::Matrix3f R3;
+	matrix::SquareMatrix<float, 4> M4;
+	matrix::SquareMatrix<float, 4> N4;
+	matrix::SquareMatrix<float, 4> R4;
+	matrix::Vector3f v3;
+	matrix::Vector3f r3;
 };
 
 bool MicroBenchMatrix::run_tests()
@@ -116,6 +125,7 @@ bool MicroBenchMatrix::run_tests()
 	ut_run_test(time_matrix_quaternion);
 	ut_run_test(time_matrix_dcm);
 	ut_run_test(time_matrix_pseduo_inverse);
+	ut_run_test(time_matrix_multiplication);
 
 	return (_tests_failed == 0);
 }
@@ -145,6 +155,17 @@ void MicroBenchMatrix::reset()
 			B16_4(j, i) = random(-10.0, 10.0);
 		}
 	}
+
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t j = 0; j < 4; j++) {
+			M4(i, j) = random(-10.f, 10.f);
+			N4(i, j) = random(-10.f, 10.f);
+		}
+	}
+
+	M3 = M4.slice<3, 3>(0, 0);
+	N3 = N4.slice<3, 3>(0, 0);
+	v3 = N4.slice<3, 1>(0, 3);
 }
 
 bool MicroBenchMatrix::time_matrix_euler()
@@ -175,6 +196,18 @@ bool MicroBenchMatrix::time_matrix_pseduo_inverse()
 	return true;
 }
 
+bool MicroBenchMatrix::time_matrix_multiplication()
+{
+	// unrolled small shape operator* vs the generic loops
+	PERF("matrix 3x3 * 3x3", R3 = M3 * N3, 100);
+	PERF("matrix 3x3 * 3x3 (generic)", R3 = M3.multiplyGeneric(N3), 100);
+	PERF("matrix 4x4 * 4x4", R4 = M4 * N4, 100);
+	PERF("matrix 4x4 * 4x4 (generic)", R4 = M4.multiplyGeneric(N4), 100);
+	PERF("matrix 3x3 * 3x1", r3 = M3 * v3, 100);
+	PERF("matrix 3x3 * 3x1 (generic)", r3 = M3.multiplyGeneric(v3), 100);
+	return true;
+}
+
 ut_declare_test_c(test_microbench_matrix, MicroBenchMatrix)
 
 } // namespace MicroBenchMatrix
@@ -0,0 +1,142 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+
+/**
+ * @file test_microbench_param.cpp
+ * Microbenchmark the parameter access.
+ */
+
+#include <unit_test.h>
+
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <parameters/param.h>
+
+namespace MicroBenchParam
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		reset(); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+			reset(); \
+		} \
+		perf_print_counter(p); \
+		perf_free(p); \
+	} while (0)
+
+class MicroBenchParam : public UnitTest
+{
+public:
+	bool run_tests() override;
+
+private:
+
+	bool time_param_find();
+	bool time_param_get();
+
+	void reset() {}
+
+	volatile param_t handle{PARAM_INVALID};
+	int32_t i32{0};
+	float f32{0.f};
+};
+
+bool MicroBenchParam::run_tests()
+{
+	ut_run_test(time_param_find);
+	ut_run_test(time_param_get);
+
+	return (_tests_failed == 0);
+}
+
+ut_declare_test_c(test_microbench_param, MicroBenchParam)
+
+bool MicroBenchParam::time_param_find()
+{
+	PERF("param_find (SYS_AUTOSTART)", handle = param_find("SYS_AUTOSTART"), 1000);
+	PERF("param_find_no_notification (SYS_AUTOSTART)", handle = param_find_no_notification("SYS_AUTOSTART"), 1000);
+
+	return true;
+}
+
+bool MicroBenchParam::time_param_get()
+{
+	const param_t autostart = param_find("SYS_AUTOSTART");
+	const param_t gyro_cutoff = param_find("IMU_GYRO_CUTOFF");
+
+	if (autostart == PARAM_INVALID || gyro_cutoff == PARAM_INVALID) {
+		PX4_ERR("parameters not found");
+		return false;
+	}
+
+	PERF("param_get (int32)", param_get(autostart, &i32), 1000);
+	PERF("param_get (float)", param_get(gyro_cutoff, &f32), 1000);
+
+	return true;
+}
+
+} // namespace MicroBenchParam
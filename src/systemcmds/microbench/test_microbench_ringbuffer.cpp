@@ -0,0 +1,180 @@
+/****************************************************************************
+ *
+ *  Copyright (C) 2026 PX4 Development Team. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ * 3. Neither the name PX4 nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************/
+/**
+ * @file test_microbench_ringbuffer.cpp
+ * Microbenchmark the mutex protected and the lock-free ringbuffers.
+ */
+
+#include <unit_test.h>
+
+#include <pthread.h>
+#include <time.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <drivers/drv_hrt.h>
+#include <perf/perf_counter.h>
+#include <px4_platform_common/px4_config.h>
+#include <px4_platform_common/micro_hal.h>
+
+#include <lib/ringbuffer/Ringbuffer.hpp>
+#include <lib/ringbuffer/LockFreeRingbuffer.hpp>
+
+namespace MicroBenchRingbuffer
+{
+
+#ifdef __PX4_NUTTX
+#include <nuttx/irq.h>
+static irqstate_t flags;
+#endif
+
+void lock()
+{
+#ifdef __PX4_NUTTX
+	flags = px4_enter_critical_section();
+#endif
+}
+
+void unlock()
+{
+#ifdef __PX4_NUTTX
+	px4_leave_critical_section(flags);
+#endif
+}
+
+#define PERF(name, op, count) do { \
+		px4_usleep(1000); \
+		reset(); \
+		perf_counter_t p = perf_alloc(PC_ELAPSED, name); \
+		for (int i = 0; i < count; i++) { \
+			px4_usleep(1); \
+			lock(); \
+			perf_begin(p); \
+			op; \
+			perf_end(p); \
+			unlock(); \
+			reset(); \
+		} \
+		perf_print_counter(p); \
+		perf_free(p); \
+	} while (0)
+
+static constexpr size_t BUFFER_SIZE = 256;
+static constexpr size_t BULK_SIZE = 64;
+
+class MicroBenchRingbuffer : public UnitTest
+{
+public:
+	MicroBenchRingbuffer()
+	{
+		// Ringbuffer keeps one byte free
+		_ringbuffer.allocate(BUFFER_SIZE + 1);
+		pthread_mutex_init(&_mutex, nullptr);
+	}
+
+	~MicroBenchRingbuffer()
+	{
+		pthread_mutex_destroy(&_mutex);
+	}
+
+	bool run_tests() override;
+
+private:
+
+	bool time_ringbuffer_single();
+	bool time_ringbuffer_bulk();
+
+	void reset();
+
+	// the way the current users share a Ringbuffer between threads
+	size_t lockedPushPop(size_t len)
+	{
+		pthread_mutex_lock(&_mutex);
+		_ringbuffer.push_back(_in, len);
+		pthread_mutex_unlock(&_mutex);
+
+		pthread_mutex_lock(&_mutex);
+		const size_t ret = _ringbuffer.pop_front(_out, len);
+		pthread_mutex_unlock(&_mutex);
+		return ret;
+	}
+
+	Ringbuffer _ringbuffer{};
+	pthread_mutex_t _mutex{};
+
+	SpscRingbuffer<uint8_t, BUFFER_SIZE> _spsc{};
+	MpscRingbuffer<uint8_t, BUFFER_SIZE> _mpsc{};
+
+	uint8_t _in[BULK_SIZE] {};
+	uint8_t _out[BULK_SIZE] {};
+	volatile size_t _popped{0};
+};
+
+bool MicroBenchRingbuffer::run_tests()
+{
+	ut_run_test(time_ringbuffer_single);
+	ut_run_test(time_ringbuffer_bulk);
+
+	return (_tests_failed == 0);
+}
+
+void MicroBenchRingbuffer::reset()
+{
+	srand(time(nullptr));
+
+	for (size_t i = 0; i < BULK_SIZE; i++) {
+		_in[i] = rand();
+	}
+}
+
+ut_declare_test_c(test_microbench_ringbuffer, MicroBenchRingbuffer)
+
+bool MicroBenchRingbuffer::time_ringbuffer_single()
+{
+	PERF("Ringbuffer + mutex push & pop 1 byte", _popped = lockedPushPop(1), 1000);
+	PERF("SpscRingbuffer push & pop 1 byte", _spsc.push(_in[0]); _popped = _spsc.pop(_out[0]), 1000);
+	PERF("MpscRingbuffer push & pop 1 byte", _mpsc.push(_in[0]); _popped = _mpsc.pop(_out[0]), 1000);
+
+	return true;
+}
+
+bool MicroBenchRingbuffer::time_ringbuffer_bulk()
+{
+	PERF("Ringbuffer + mutex push & pop 64 bytes", _popped = lockedPushPop(BULK_SIZE), 1000);
+	PERF("SpscRingbuffer push & pop 64 bytes", _spsc.push(_in, BULK_SIZE); _popped = _spsc.pop(_out, BULK_SIZE), 1000);
+	PERF("MpscRingbuffer push & pop 64 bytes", _mpsc.push(_in, BULK_SIZE); _popped = _mpsc.pop(_out, BULK_SIZE), 1000);
+
+	return true;
+}
+
+} // namespace MicroBenchRingbuffer
@@ -40,6 +40,7 @@
 #include <string.h>
 
 #include <lib/perf/perf_counter.h>
+#include <lib/perf/perf_trace.h>
 
 static void print_usage()
 {
@@ -47,7 +48,12 @@ static void print_usage()
 
 	PRINT_MODULE_USAGE_NAME_SIMPLE("perf", "command");
 	PRINT_MODULE_USAGE_COMMAND_DESCR("reset", "Reset all counters");
-	PRINT_MODULE_USAGE_COMMAND_DESCR("latency", "Print HRT timer latency histogram");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("latency", "Print HRT timer latency histogram and the buckets of histogram counters");
+#if defined(PERF_TRACE_ENABLED)
+	PRINT_MODULE_USAGE_COMMAND_DESCR("trace", "Trace buffer (convert with Tools/perf_trace_to_chrome.py)");
+	PRINT_MODULE_USAGE_ARG("dump|reset", "Write the buffered events to a file or drop them", false);
+	PRINT_MODULE_USAGE_ARG("<file>", "Output file (default " PX4_STORAGEDIR "/trace.csv)", true);
+#endif // PERF_TRACE_ENABLED
 
 	PRINT_MODULE_USAGE_PARAM_COMMENT("Prints all performance counters if no arguments given");
 }
@@ -65,6 +71,29 @@ extern "C" __EXPORT int perf_main(int argc, char *argv[])
 			return 0;
 		}
 
+#if defined(PERF_TRACE_ENABLED)
+
+		else if (strcmp(argv[1], "trace") == 0 && argc > 2) {
+			if (strcmp(argv[2], "reset") == 0) {
+				perf_trace_reset();
+				return 0;
+
+			} else if (strcmp(argv[2], "dump") == 0) {
+				const char *path = (argc > 3) ? argv[3] : PX4_STORAGEDIR "/trace.csv";
+				const int events = perf_trace_dump(path);
+
+				if (events < 0) {
+					PX4_ERR("writing %s failed (%i)", path, events);
+					return -1;
+				}
+
+				PX4_INFO("%i events written to %s", events, path);
+				return 0;
+			}
+		}
+
+#endif // PERF_TRACE_ENABLED
+
 		print_usage();
 		return -1;
 	}
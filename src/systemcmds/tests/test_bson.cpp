@@ -43,6 +43,8 @@
 #include <stdlib.h>
 #include <limits.h>
 #include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <systemlib/err.h>
 #include <lib/tinybson/tinybson.h>
@@ -55,7 +57,7 @@ static const int64_t sample_big_int = (int64_t)INT_MAX + 123LL;
 static const double sample_double = 2.5f;
 static const char *sample_string = "this is a test";
 static const uint8_t sample_data[256] = {0};
-//static const char *sample_filename = "/fs/microsd/bson.test";
+static const char *sample_filename = PX4_STORAGEDIR "/bson.test";
 
 static int
 encode(bson_encoder_t encoder)
@@ -295,5 +297,43 @@ test_bson(int argc, char *argv[])
 	decode(&decoder);
 	free(buf);
 
+	/* encode to a file and decode it again using a buffer smaller than the nodes */
+	int fd = ::open(sample_filename, O_RDWR | O_CREAT | O_TRUNC, PX4_O_MODE_666);
+
+	if (fd < 0) {
+		PX4_ERR("FAIL: open %s", sample_filename);
+		return 1;
+	}
+
+	uint8_t file_buf[512];
+	bson_encoder_s file_encoder{};
+
+	if (bson_encoder_init_buf_file(&file_encoder, fd, file_buf, sizeof(file_buf))) {
+		PX4_ERR("FAIL: bson_encoder_init_buf_file");
+		::close(fd);
+		return 1;
+	}
+
+	encode(&file_encoder);
+
+	bson_decoder_s file_decoder{};
+
+	if (lseek(fd, 0, SEEK_SET) != 0
+	    || bson_decoder_init_buf_file(&file_decoder, fd, file_buf, 64, decode_callback)) {
+		PX4_ERR("FAIL: bson_decoder_init_buf_file");
+		::close(fd);
+		return 1;
+	}
+
+	decode(&file_decoder);
+	::close(fd);
+	unlink(sample_filename);
+
+	if (file_decoder.total_decoded_size != file_decoder.total_document_size) {
+		PX4_ERR("FAIL: decoded %" PRIi32 " of %" PRIi32 " bytes", file_decoder.total_decoded_size,
+			file_decoder.total_document_size);
+		return 1;
+	}
+
 	return PX4_OK;
 }
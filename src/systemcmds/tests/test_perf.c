@@ -49,8 +49,9 @@ test_perf(int argc, char *argv[])
 {
 	perf_counter_t cc = perf_alloc(PC_COUNT, "test_count");
 	perf_counter_t ec = perf_alloc(PC_ELAPSED, "test_elapsed");
+	perf_counter_t hc = perf_alloc(PC_HISTOGRAM, "test_histogram");
 
-	if ((cc == NULL) || (ec == NULL)) {
+	if ((cc == NULL) || (ec == NULL) || (hc == NULL)) {
 		printf("perf: counter alloc failed\n");
 		return 1;
 	}
@@ -66,8 +67,21 @@ test_perf(int argc, char *argv[])
 	printf("perf: expect count of 1\n");
 	perf_print_counter(ec);
 
+	for (int i = 1; i <= 1000; i++) {
+		perf_set_elapsed(hc, (i > 990) ? 5000 : 10);
+	}
+
+	printf("perf: expect 1000 events, p50 and p99 in [8, 16) us, p999 >= 4096 us\n");
+	perf_print_counter(hc);
+
+	if (perf_percentile(hc, 0.99f) >= 16.f || perf_percentile(hc, 0.999f) < 4096.f) {
+		printf("perf: histogram percentile out of range\n");
+		return 1;
+	}
+
 	perf_free(cc);
 	perf_free(ec);
+	perf_free(hc);
 
 	return OK;
 }
@@ -51,6 +51,7 @@
 #include <px4_platform_common/printload.h>
 #include <drivers/drv_hrt.h>
 #include <px4_platform_common/module.h>
+#include <px4_platform_common/memory_pool.h>
 
 static void print_usage()
 {
@@ -58,10 +59,16 @@ static void print_usage()
 
 	PRINT_MODULE_USAGE_NAME_SIMPLE("top", "command");
 	PRINT_MODULE_USAGE_COMMAND_DESCR("once", "print load only once");
+	PRINT_MODULE_USAGE_COMMAND_DESCR("pools", "print memory pool usage");
 }
 
 extern "C" __EXPORT int top_main(int argc, char *argv[])
 {
+	if (argc > 1 && !strcmp(argv[1], "pools")) {
+		px4::MemoryPool::printStatus();
+		return 0;
+	}
+
 	print_load_s load{};
 	init_print_load(&load);
 	px4_usleep(200000);
@@ -42,12 +42,20 @@
 
 #include <poll.h>
 
+#include <lib/crc/crc.h>
 #include <uORB/topics/uORBTopics.hpp>
 #include "topic_listener.hpp"
 
 // Amount of time to wait when listening for a message, before giving up.
 static constexpr float MESSAGE_TIMEOUT_S = 2.0f;
 
+// Binary streaming mode (decoded on the host with Tools/uorb_listener_decode.py)
+static constexpr int BINARY_MAX_TOPICS = 8;
+static constexpr uint8_t BINARY_SYNC[2] {0xA5, 0x5A};
+static constexpr uint8_t BINARY_FRAME_DEFINITION = 'D';
+static constexpr uint8_t BINARY_FRAME_SAMPLE = 'S';
+static constexpr hrt_abstime BINARY_DEFINITION_INTERVAL = 1'000'000; // resend definitions to allow late decoder start
+
 extern "C" __EXPORT int listener_main(int argc, char *argv[]);
 
 static void usage();
@@ -167,6 +175,134 @@ void listener(const orb_id_t &id, unsigned num_msgs, int topic_instance,
 
 }
 
+/**
+ * Write a binary frame to stdout: sync bytes, frame type, payload length, payload and CRC-16-CCITT (initial 0xffff)
+ * over type, length and payload. All values are little-endian.
+ * @return false if writing failed (e.g. the shell was closed)
+ */
+static bool binary_write_frame(uint8_t type, const uint8_t *header, size_t header_len, const void *data, size_t data_len)
+{
+	static constexpr size_t max_frame_len = 512 + 16;
+	uint8_t frame[max_frame_len];
+
+	const size_t payload_len = header_len + data_len;
+
+	if (payload_len + 7 > max_frame_len) {
+		return false;
+	}
+
+	frame[0] = BINARY_SYNC[0];
+	frame[1] = BINARY_SYNC[1];
+	frame[2] = type;
+	frame[3] = payload_len & 0xff;
+	frame[4] = (payload_len >> 8) & 0xff;
+	memcpy(&frame[5], header, header_len);
+	memcpy(&frame[5 + header_len], data, data_len);
+
+	const uint16_t crc = crc16_signature(0xffff, payload_len + 3, &frame[2]);
+	frame[5 + payload_len] = crc & 0xff;
+	frame[6 + payload_len] = (crc >> 8) & 0xff;
+
+	return write(1, frame, payload_len + 7) == (ssize_t)(payload_len + 7);
+}
+
+static bool binary_write_definition(uint8_t index, const orb_id_t &id, uint8_t instance)
+{
+	// index, instance, message hash, message size, followed by the topic name
+	const uint8_t header[8] {
+		index,
+		instance,
+		(uint8_t)(id->message_hash & 0xff),
+		(uint8_t)((id->message_hash >> 8) & 0xff),
+		(uint8_t)((id->message_hash >> 16) & 0xff),
+		(uint8_t)((id->message_hash >> 24) & 0xff),
+		(uint8_t)(id->o_size_no_padding & 0xff),
+		(uint8_t)((id->o_size_no_padding >> 8) & 0xff),
+	};
+
+	return binary_write_frame(BINARY_FRAME_DEFINITION, header, sizeof(header), id->o_name, strlen(id->o_name));
+}
+
+/**
+ * Stream raw samples of the given topics to stdout without any formatting.
+ * Runs until num_msgs samples are written (unlimited if 0), or the user aborts.
+ */
+static void listener_binary(const orb_id_t ids[], int num_topics, int topic_instance, unsigned topic_interval,
+			    unsigned num_msgs)
+{
+	static constexpr int max_size = 512;
+	alignas(8) uint8_t container[max_size];
+
+	if (topic_instance == -1) {
+		topic_instance = 0;
+	}
+
+	struct pollfd fds[1 + BINARY_MAX_TOPICS] {};
+	// Poll for user input (for q or escape)
+	fds[0].fd = 0; /* stdin */
+	fds[0].events = POLLIN;
+
+	for (int i = 0; i < num_topics; i++) {
+		fds[1 + i].fd = orb_subscribe_multi(ids[i], topic_instance);
+		fds[1 + i].events = POLLIN;
+		orb_set_interval(fds[1 + i].fd, topic_interval);
+	}
+
+	unsigned msgs_written = 0;
+	hrt_abstime last_definitions = 0;
+	bool ok = true;
+
+	while (ok && (num_msgs == 0 || msgs_written < num_msgs)) {
+
+		if (hrt_elapsed_time(&last_definitions) > BINARY_DEFINITION_INTERVAL) {
+			for (int i = 0; i < num_topics && ok; i++) {
+				ok = binary_write_definition(i, ids[i], topic_instance);
+			}
+
+			last_definitions = hrt_absolute_time();
+		}
+
+		if (poll(&fds[0], 1 + num_topics, int(MESSAGE_TIMEOUT_S * 1000)) <= 0) {
+			// keep waiting, the definitions act as keepalive
+			continue;
+		}
+
+		// Received character from stdin
+		if (fds[0].revents & POLLIN) {
+			char c = 0;
+
+			if (read(0, &c, 1) <= 0 || c == 0x03 || c == 0x1b || c == 'q') {
+				break;
+			}
+		}
+
+		for (int i = 0; i < num_topics && ok; i++) {
+			if ((fds[1 + i].revents & POLLIN) && (orb_copy(ids[i], fds[1 + i].fd, container) == PX4_OK)) {
+				const uint8_t index = i;
+				ok = binary_write_frame(BINARY_FRAME_SAMPLE, &index, sizeof(index), container, ids[i]->o_size_no_padding);
+				msgs_written++;
+			}
+		}
+	}
+
+	for (int i = 0; i < num_topics; i++) {
+		orb_unsubscribe(fds[1 + i].fd);
+	}
+}
+
+static const orb_metadata *find_topic(const char *topic_name)
+{
+	const orb_metadata *const *topics = orb_get_topics();
+
+	for (size_t i = 0; i < orb_topics_count(); i++) {
+		if (strcmp(topics[i]->o_name, topic_name) == 0) {
+			return topics[i];
+		}
+	}
+
+	return nullptr;
+}
+
 int listener_main(int argc, char *argv[])
 {
 	if (argc <= 1) {
@@ -179,14 +315,19 @@ int listener_main(int argc, char *argv[])
 	int topic_instance = -1;
 	unsigned topic_rate = 0;
 	unsigned num_msgs = 0;
+	bool binary = false;
 
 	int myoptind = 1;
 	int ch;
 	const char *myoptarg = nullptr;
 
-	while ((ch = px4_getopt(argc, argv, "i:r:n:", &myoptind, &myoptarg)) != EOF) {
+	while ((ch = px4_getopt(argc, argv, "i:r:n:b", &myoptind, &myoptarg)) != EOF) {
 		switch (ch) {
 
+		case 'b':
+			binary = true;
+			break;
+
 		case 'i':
 			topic_instance = strtol(myoptarg, nullptr, 0);
 			break;
@@ -206,31 +347,50 @@ int listener_main(int argc, char *argv[])
 		}
 	}
 
-	if (num_msgs == 0) {
-		if (topic_rate != 0) {
-			num_msgs = 30 * topic_rate; // arbitrary limit (30 seconds at max rate)
+	unsigned topic_interval = 0;
 
-		} else {
-			num_msgs = 1;
-		}
+	if (topic_rate != 0) {
+		topic_interval = 1000 / topic_rate;
 	}
 
+	if (binary) {
+		// comma separated list of topics
+		orb_id_t ids[BINARY_MAX_TOPICS] {};
+		int num_topics = 0;
+		char *save_ptr = nullptr;
 
-	unsigned topic_interval = 0;
+		for (char *name = strtok_r(topic_name, ",", &save_ptr); name != nullptr; name = strtok_r(nullptr, ",", &save_ptr)) {
+			if (num_topics >= BINARY_MAX_TOPICS) {
+				PX4_ERR("too many topics (max %i)", BINARY_MAX_TOPICS);
+				return -1;
+			}
 
-	if (topic_rate != 0) {
-		topic_interval = 1000 / topic_rate;
+			ids[num_topics] = find_topic(name);
+
+			if (!ids[num_topics]) {
+				PX4_ERR("Topic %s did not match any known topics", name);
+				return -1;
+			}
+
+			num_topics++;
+		}
+
+		listener_binary(ids, num_topics, topic_instance, topic_interval, num_msgs);
+		return 0;
 	}
 
-	const orb_metadata *const *topics = orb_get_topics();
-	const orb_metadata *found_topic = nullptr;
+	if (num_msgs == 0) {
+		if (topic_rate != 0) {
+			num_msgs = 30 * topic_rate; // arbitrary limit (30 seconds at max rate)
 
-	for (size_t i = 0; i < orb_topics_count(); i++) {
-		if (strcmp(topics[i]->o_name, topic_name) == 0) {
-			found_topic = topics[i];
+		} else {
+			num_msgs = 1;
 		}
 	}
 
+
+	const orb_metadata *found_topic = find_topic(topic_name);
+
 	if (found_topic) {
 		listener(found_topic, num_msgs, topic_instance, topic_interval);
 
@@ -251,12 +411,20 @@ usage()
 Utility to listen on uORB topics and print the data to the console.
 
 The listener can be exited any time by pressing Ctrl+C, Esc, or Q.
+
+With -b the raw samples of one or more topics are streamed in a binary framing instead, which avoids the formatting
+cost and allows to watch high-rate topics. It is intended for the MAVLink shell or the POSIX shell and decoded with
+Tools/uorb_listener_decode.py on the host. In this mode the number of messages is unlimited by default.
+
+### Examples
+$ listener -b sensor_gyro,sensor_accel -n 10000
 )DESCR_STR");
 
 	PRINT_MODULE_USAGE_NAME("listener", "command");
-	PRINT_MODULE_USAGE_ARG("<topic_name>", "uORB topic name", false);
+	PRINT_MODULE_USAGE_ARG("<topic_name>", "uORB topic name (comma separated list with -b)", false);
 
 	PRINT_MODULE_USAGE_PARAM_INT('i', 0, 0, ORB_MULTI_MAX_INSTANCES - 1, "Topic instance", true);
 	PRINT_MODULE_USAGE_PARAM_INT('n', 1, 0, 100, "Number of messages", true);
 	PRINT_MODULE_USAGE_PARAM_INT('r', 0, 0, 1000, "Subscription rate (unlimited if 0)", true);
+	PRINT_MODULE_USAGE_PARAM_FLAG('b', "Binary streaming mode", true);
 }